@@ -18,20 +18,39 @@ LOCAL_C_INCLUDES := \
 LOCAL_SRC_FILES := ../../../Src/XrPassthrough.cpp \
     ../../../Src/XrPassthroughGl.cpp \
     ../../../Src/XrPassthroughInput.cpp \
+    ../../../Src/XrPassthroughHands.cpp \
+    ../../../Src/XrPassthroughMidi.cpp \
+    ../../../Src/XrPassthroughAudio.cpp \
     ../../../Src/Engine.cpp \
     ../../../Src/Piarno.cpp \
     ../../../Src/Object.cpp \
+    ../../../Src/KeyContacts.cpp \
+    ../../../Src/HandRecording.cpp \
+    ../../../Src/MidiInput.cpp \
+    ../../../Src/NoteMatcher.cpp \
+    ../../../Src/ScoreKeeper.cpp \
+    ../../../Src/SessionLog.cpp \
+    ../../../Src/SampleBank.cpp \
+    ../../../Src/Synth.cpp \
+    ../../../Src/ContactGrid.cpp \
+    ../../../Src/PlaybackClock.cpp \
+    ../../../Src/TileStore.cpp \
+    ../../../Src/Profiler.cpp \
+    ../../../Src/PerfGovernor.cpp \
+    ../../../Src/FrameArena.cpp \
+    ../../../Src/SongBundle.cpp \
     ../../../Src/midi/Binasc.cpp \
     ../../../Src/midi/MidiEvent.cpp \
     ../../../Src/midi/MidiEventList.cpp \
     ../../../Src/midi/MidiFile.cpp \
     ../../../Src/midi/MidiMessage.cpp \
 
-LOCAL_LDLIBS 			:= -llog -landroid -lGLESv3 -lEGL
-LOCAL_STATIC_LIBRARIES 	:= samplexrframework
+LOCAL_LDLIBS 			:= -llog -landroid -lGLESv3 -lEGL -ldl
+LOCAL_STATIC_LIBRARIES 	:= samplexrframework stb
 LOCAL_SHARED_LIBRARIES := openxr_loader
 
 include $(BUILD_SHARED_LIBRARY)
 
 $(call import-module,SampleXrFramework/Projects/Android/jni)
+$(call import-module,3rdParty/stb/build/android/jni)
 $(call import-module,OpenXR/Projects/AndroidPrebuilt/jni)
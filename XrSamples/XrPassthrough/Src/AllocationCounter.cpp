@@ -0,0 +1,95 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+static thread_local uint64_t threadAllocations = 0;
+
+uint64_t allocations::count() {
+    return threadAllocations;
+}
+
+//the app is built without exceptions, so running out of memory aborts like it would without a handler
+static void* allocate(std::size_t size, bool nothrow) {
+    threadAllocations++;
+    if (size == 0)
+        size = 1;
+    for (;;) {
+        if (void *p = std::malloc(size))
+            return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            break;
+        handler();
+    }
+    if (nothrow)
+        return nullptr;
+    std::abort();
+}
+
+static void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+    threadAllocations++;
+    auto a = static_cast<std::size_t>(alignment);
+    if (a < sizeof(void*))
+        a = sizeof(void*);
+    void *p = nullptr;
+    if (posix_memalign(&p, a, size == 0 ? 1 : size) != 0)
+        std::abort();
+    return p;
+}
+
+void* operator new(std::size_t size) {
+    return allocate(size, false);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size, false);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, true);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, true);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+// Counts the heap allocations (operator new) made by each thread, so the host tools can report how many
+// frames allocate. The global operator new and delete are replaced in AllocationCounter.cpp, which is only
+// linked into the tools (see Tools/), never into the app.
+namespace allocations {
+    //number of allocations made by the calling thread so far
+    uint64_t count();
+}
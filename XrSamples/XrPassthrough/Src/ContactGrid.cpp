@@ -0,0 +1,165 @@
+#include "ContactGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+//radii are in meters, the grid in the group's space
+static float smallestScale(const vec3 &scl) {
+    return std::max(1e-6f, std::min({std::abs(scl.x), std::abs(scl.y), std::abs(scl.z)}));
+}
+
+ContactGrid::ContactGrid(ObjectGroup &g) : group(g) {
+}
+
+void ContactGrid::add(Button &widget) {
+    widgets.push_back(&widget);
+    testedQuery.push_back(0);
+    activeFrame.push_back(0);
+    dirty = true;
+}
+
+void ContactGrid::remove(Button &widget) {
+    auto it = std::find(widgets.begin(), widgets.end(), &widget);
+    if (it == widgets.end())
+        return;
+
+    uint32_t index = it - widgets.begin();
+    widgets.erase(it);
+    testedQuery.erase(testedQuery.begin() + index);
+    activeFrame.erase(activeFrame.begin() + index);
+
+    //the widgets after it move down by one
+    active.erase(std::remove(active.begin(), active.end(), index), active.end());
+    for (auto &w : active)
+        w -= w > index;
+    dirty = true;
+}
+
+void ContactGrid::moved() {
+    dirty = true;
+}
+
+void ContactGrid::rebuild() {
+    dirty = false;
+    builtScale = group.scl;
+    float toLocal = 1 / smallestScale(group.scl);
+
+    //boxes of the collision bodies in the x/z plane
+    struct Box {
+        float x0, z0, x1, z1;
+    };
+    std::vector<Box> boxes(widgets.size());
+    float minX = INFINITY, minZ = INFINITY, maxX = -INFINITY, maxZ = -INFINITY;
+    for (size_t i = 0; i < widgets.size(); i++) {
+        vec3 lo, hi;
+        widgets[i]->bounds(lo, hi);
+        float r = widgets[i]->radius * toLocal;
+        boxes[i] = {lo.x - r, lo.z - r, hi.x + r, hi.z + r};
+        minX = std::min(minX, boxes[i].x0);
+        minZ = std::min(minZ, boxes[i].z0);
+        maxX = std::max(maxX, boxes[i].x1);
+        maxZ = std::max(maxZ, boxes[i].z1);
+    }
+
+    cellSize = CELL_SIZE;
+    if (widgets.empty()) {
+        cellsX = cellsZ = 0;
+    } else {
+        originX = minX;
+        originZ = minZ;
+        do {
+            cellsX = (int) std::floor((maxX - minX) / cellSize) + 1;
+            cellsZ = (int) std::floor((maxZ - minZ) / cellSize) + 1;
+            if ((size_t) cellsX * cellsZ > MAX_CELLS)
+                cellSize *= 2;
+        } while ((size_t) cellsX * cellsZ > MAX_CELLS);
+    }
+
+    //count the widgets of each cell, then fill the cells in order of the widgets
+    auto cellOf = [&](float v, float origin, int cells) {
+        return std::clamp((int) std::floor((v - origin) / cellSize), 0, cells - 1);
+    };
+    cellStart.assign(cellsX * cellsZ + 1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        std::vector<uint32_t> fill(cellStart.begin(), cellStart.end() - 1);
+        for (size_t i = 0; i < widgets.size(); i++) {
+            int cx0 = cellOf(boxes[i].x0, originX, cellsX), cx1 = cellOf(boxes[i].x1, originX, cellsX);
+            int cz0 = cellOf(boxes[i].z0, originZ, cellsZ), cz1 = cellOf(boxes[i].z1, originZ, cellsZ);
+            for (int cz = cz0; cz <= cz1; cz++) {
+                for (int cx = cx0; cx <= cx1; cx++) {
+                    size_t cell = cz * cellsX + cx;
+                    if (pass == 0)
+                        cellStart[cell + 1]++;
+                    else
+                        cellWidgets[fill[cell]++] = i;
+                }
+            }
+        }
+        if (pass == 0) {
+            for (size_t c = 1; c < cellStart.size(); c++)
+                cellStart[c] += cellStart[c - 1];
+            cellWidgets.resize(cellStart.back());
+        }
+    }
+}
+
+void ContactGrid::update(const std::vector<Rigid> &controllers) {
+    if (dirty || group.scl != builtScale)
+        rebuild();
+
+    //widgets still moving from the last frame get their events too
+    frame++;
+    for (auto w : active)
+        activeFrame[w] = frame;
+
+    if (cellsX > 0) {
+        mat4 toLocal = group.transform().Inverted();
+        float radiusToLocal = 1 / smallestScale(group.scl);
+
+        for (size_t i = 0; i < controllers.size(); i++) {
+            const Rigid &c = controllers[i];
+            if (!c.show)
+                continue;
+            vec3 p = toLocal.Transform(c.globalPos(c.pos + c.offset));
+            float r = c.radius * radiusToLocal;
+
+            //cells overlapped by the controller's body, if it is over the grid at all
+            int cx0 = (int) std::floor((p.x - r - originX) / cellSize), cx1 = (int) std::floor((p.x + r - originX) / cellSize);
+            int cz0 = (int) std::floor((p.z - r - originZ) / cellSize), cz1 = (int) std::floor((p.z + r - originZ) / cellSize);
+            if (cx1 < 0 || cz1 < 0 || cx0 >= cellsX || cz0 >= cellsZ)
+                continue;
+            cx0 = std::max(cx0, 0);
+            cz0 = std::max(cz0, 0);
+            cx1 = std::min(cx1, cellsX - 1);
+            cz1 = std::min(cz1, cellsZ - 1);
+
+            query++;
+            for (int cz = cz0; cz <= cz1; cz++) {
+                for (int cx = cx0; cx <= cx1; cx++) {
+                    size_t cell = cz * cellsX + cx;
+                    for (uint32_t j = cellStart[cell]; j < cellStart[cell + 1]; j++) {
+                        uint32_t w = cellWidgets[j];
+                        if (testedQuery[w] == query)
+                            continue;
+                        testedQuery[w] = query;
+
+                        if (!widgets[w]->isColliding(c))
+                            continue;
+                        widgets[w]->contact(i, c);
+                        if (activeFrame[w] != frame) {
+                            activeFrame[w] = frame;
+                            active.push_back(w);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //touched widgets, and those that were and are released or moving back up now
+    for (auto w : active)
+        widgets[w]->endContacts(controllers);
+    active.erase(std::remove_if(active.begin(), active.end(), [&](uint32_t w) {
+        return widgets[w]->isIdle();
+    }), active.end());
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Object.h"
+#include <cstdint>
+#include <vector>
+
+// Broad phase for the touchable widgets of a group: a uniform grid over the group's local x/z plane, each cell
+// listing the widgets whose collision body can reach into it. Widgets don't move inside their group (sliders
+// are entered with their whole track), so the grid is only rebuilt when widgets are added or moved, and moving
+// the whole group costs nothing. Once per frame each controller is taken into the group's space and only
+// tested against the widgets of the cells it overlaps, so the cost depends on the controllers, not on how many
+// widgets there are. The contacts are pushed to the widgets as events (Button::contact/endContacts).
+class ContactGrid {
+public:
+    static constexpr float CELL_SIZE = 0.05f; //in meters of the group's space
+    static constexpr size_t MAX_CELLS = 4096; //cells get bigger if the widgets are spread out further
+
+    explicit ContactGrid(ObjectGroup &group);
+
+    //widgets have to be attached to the group and stay alive while they are in the grid
+    void add(Button &widget);
+    void remove(Button &widget);
+    //call after moving a widget inside the group or changing its radius or slider track
+    void moved();
+
+    //find the contacts of the shown controllers with the widgets and update the press state of the widgets, once
+    //per frame. Only widgets that were touched and aren't idle again get events, the others stay released.
+    void update(const std::vector<Rigid> &controllers);
+
+private:
+    void rebuild();
+
+    ObjectGroup &group;
+    std::vector<Button*> widgets;
+    bool dirty = false;
+    vec3 builtScale{0, 0, 0}; //group scale the radii were converted with
+
+    //cells as ranges into cellWidgets (compressed rows), cellStart has one more entry than there are cells
+    float originX = 0, originZ = 0, cellSize = CELL_SIZE;
+    int cellsX = 0, cellsZ = 0;
+    std::vector<uint32_t> cellStart;
+    std::vector<uint32_t> cellWidgets; //indices into widgets
+
+    //per widget: controller query it was last tested in (a widget can be in several cells),
+    //and frame it was last added to active in
+    std::vector<uint32_t> testedQuery, activeFrame;
+    std::vector<uint32_t> active; //widgets that get endContacts this frame
+    uint32_t query = 0, frame = 0;
+};
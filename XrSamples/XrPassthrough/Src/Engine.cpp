@@ -3,6 +3,7 @@
 //
 
 #include "Engine.h"
+#include <algorithm>
 #include <vector>
 #include <openxr/openxr.h>
 #include <string>
@@ -42,6 +43,17 @@ Engine::Engine(Scene *scene) : scene(scene) {
         controllers.push_back(std::move(r));
     }
 
+    for(size_t i = 0; i < FINGERTIPS; i++) {
+        Rigid r{getGeometry(Mesh::cube)};
+        r.scl = vec3{0.005f, 0.005f, 0.005f};
+        r.col = color{255, 255, 255, 255};
+        r.radius = 0.008;
+        r.show = false;
+        controllers.push_back(std::move(r));
+    }
+
+    playedNotes.reserve(MidiInput::CAPACITY);
+
     piarno.init();
 }
 
@@ -49,10 +61,30 @@ uint64_t Engine::getFrame() {
     return frame;
 }
 
+PlaybackClock& Engine::getClock() {
+    return clock;
+}
+
+FrameArena& Engine::getArena() {
+    return arena;
+}
+
+Profiler& Engine::getProfiler() {
+    return scene->profiler;
+}
+
 const std::vector<Rigid>& Engine::getControllers() {
     return controllers;
 }
 
+const std::vector<NoteEvent>& Engine::getPlayedNotes() {
+    return playedNotes;
+}
+
+Synth& Engine::getSynth() {
+    return scene->synth;
+}
+
 bool Engine::isButtonPressed(IO button) {
     return *buttonStates[(size_t) button] == XR_TRUE;
 }
@@ -65,65 +97,160 @@ Geometry *Engine::getGeometry(Mesh mesh) {
     return &scene->geometries[(size_t) mesh];
 }
 
+InstanceBatch *Engine::getBatch(Mesh mesh) {
+    return &scene->batches[(size_t) mesh];
+}
+
+int Engine::glyphIndex(char c) {
+    if (auto alpha = toupper(c) - 'A'; 0 <= alpha && alpha < 26)
+        return alpha;
+    else if (auto num = c - '0'; 0 <= num && num < 10)
+        return 26 + num;
+    else if (c == '.')
+        return 36;
+    else if (c == ':')
+        return 37;
+    return -1;
+}
+
 float Engine::textWidth(const std::string &text) {
     float xOff = 0;
     for (const auto &c: text) {
         if (isspace(c))
             xOff += fontWidth[0];
-        else if (auto alpha = toupper(c) - 'A'; 0 <= alpha && alpha < 26)
-            xOff += fontWidth[alpha] + 0.1;
-        else if (auto num = c - '0'; 0 <= num && num < 10) {
-            xOff += fontWidth[26+num] + 0.1;
-        } else if (c == '.') {
-            xOff += fontWidth[36] + 0.1;
-        } else if (c == ':') {
-            xOff += fontWidth[37] + 0.1;
-        }
+        else if (auto g = glyphIndex(c); g != -1)
+            xOff += fontWidth[g] + 0.1;
     }
     return xOff - (text.size() == 0 ? 0 : 0.1);
 }
 
 void Engine::renderText(const std::string &text, vec3 pos, vec3 scl, vec3 rot, const color &col, bool centered) {
-    scene->geometries[0].updateColors(col.data);
+    auto &mesh = getTextMesh(text);
+    if (mesh.geometry.indexCount == 0)
+        return;
 
-    float xOff = centered ? -textWidth(text)/2 : 0;
+    float xOff = centered ? -mesh.width/2 : 0;
     float yOff = centered ? -0.4 : 0;
-    for (const auto &c: text) {
-        if (isspace(c)) {
-            xOff += fontWidth[0];
-            continue;
+    mat4 trans = compose(pos, rot, scl) * translate(vec3{xOff, yOff, 0});
+
+    mesh.geometry.updateColors(col.data(), col.size());
+    mesh.geometry.render(trans);
+}
+
+Engine::TextMesh& Engine::getTextMesh(const std::string &text) {
+    auto [it, isNew] = textCache.try_emplace(text);
+    auto &mesh = it->second;
+
+    if (isNew) {
+        //tessellate the string once by copying the glyphs next to each other
+        std::vector<vertex_t> vertices;
+        std::vector<index_t> indices;
+        float xOff = 0;
+        for (const auto &c: text) {
+            if (isspace(c)) {
+                xOff += fontWidth[0];
+                continue;
+            }
+
+            int g = glyphIndex(c);
+            if (g == -1)
+                continue;
+
+            auto first = (index_t) (vertices.size() / 3);
+            for (size_t i = 0; i < glyphVertices[g].size(); i += 3) {
+                vertices.push_back(glyphVertices[g][i] + xOff);
+                vertices.push_back(glyphVertices[g][i + 1]);
+                vertices.push_back(glyphVertices[g][i + 2]);
+            }
+            for (auto i: glyphIndices[g])
+                indices.push_back(first + i);
+
+            xOff += fontWidth[g] + 0.1;
         }
 
-        mat4 trans = translate(pos) * rotate(rot) * scale(scl) * translate(vec3{xOff, yOff, 0});
-        if (auto alpha = toupper(c) - 'A'; 0 <= alpha && alpha < 26) {
-            scene->geometries[alpha].render(trans);
-            xOff += fontWidth[alpha] + 0.1;
-        } else if (auto num = c - '0'; 0 <= num && num < 10) {
-            scene->geometries[26+num].render(trans);
-            xOff += fontWidth[26+num] + 0.1;
-        } else if (c == '.') {
-            scene->geometries[36].render(trans);
-            xOff += fontWidth[36] + 0.1;
-        } else if (c == ':') {
-            scene->geometries[37].render(trans);
-            xOff += fontWidth[37] + 0.1;
+        //the GL objects are made by the render thread, which owns the context
+        mesh.geometry.clear();
+        mesh.geometry.global_color = true;
+        mesh.geometry.draw_mode = GL_TRIANGLES;
+        mesh.geometry.vertexCount = vertices.size();
+        mesh.geometry.indexCount = indices.size();
+        mesh.geometry.id = newMeshId();
+        mesh.geometry.queue = &scene->drawQueue;
+        scene->drawQueue.upload(&mesh.geometry, std::move(vertices), std::move(indices));
+        mesh.width = textWidth(text);
+    }
+
+    mesh.lastUsed = frame;
+    return mesh;
+}
+
+mesh_t Engine::newMeshId() {
+    if (freeMeshIds.empty())
+        return nextMeshId++;
+    auto id = freeMeshIds.back();
+    freeMeshIds.pop_back();
+    return id;
+}
+
+void Engine::evictTextMeshes() {
+    //labels that change (e.g. the timeline) leave unused meshes behind
+    for (auto it = textCache.begin(); it != textCache.end();) {
+        if (frame - it->second.lastUsed > 90) {
+            scene->drawQueue.release(it->second.geometry);
+            freeMeshIds.push_back(it->second.geometry.id);
+            it = textCache.erase(it);
+        } else {
+            ++it;
         }
     }
 }
 
-void Engine::update() {
+void Engine::update(double displayTime) {
     frame++;
+    arena.reset();
+    clock.tick(displayTime);
 
-    for(int i=0; i<controllers.size(); i++) {
+    for(size_t i=0; i<FIRST_FINGERTIP; i++) {
         auto &c = scene->trackedController[i*2];
+        auto &r = controllers[i];
+        r.show = c.active;
         if(c.active) {
-            auto &r = controllers[i];
             r.pos = c.pose.Translation;
             r.rot = vec3{c.pose.Rotation.x, c.pose.Rotation.y, c.pose.Rotation.z};
         }
     }
 
+    //fingertips, located at the same predicted display time as the controllers
+    static const int tipJoints[5] = {XR_HAND_JOINT_THUMB_TIP_EXT, XR_HAND_JOINT_INDEX_TIP_EXT, XR_HAND_JOINT_MIDDLE_TIP_EXT,
+                                     XR_HAND_JOINT_RING_TIP_EXT, XR_HAND_JOINT_LITTLE_TIP_EXT};
+    for(size_t i=0; i<FINGERTIPS; i++) {
+        auto &hand = scene->trackedHand[i / 5];
+        auto &r = controllers[FIRST_FINGERTIP + i];
+        r.show = hand.active;
+        if(hand.active) {
+            auto &joint = hand.joints[tipJoints[i % 5]];
+            r.pos = joint.Translation;
+            r.rot = eulerAngles(joint.Rotation);
+            r.radius = hand.radii[tipJoints[i % 5]];
+        }
+    }
+
+    //played notes, at most as many as the ring holds so the list never grows
+    playedNotes.clear();
+    NoteEvent note;
+    while(playedNotes.size() < MidiInput::CAPACITY && scene->midiInput.pop(note)) {
+        note.time += scene->midiTimeOffset;
+        playedNotes.push_back(note);
+    }
+
     piarno.update();
+
+    //where the song is at this frame's display time, on the monotonic clock of the audio thread; stopped at the
+    //end as well, or the synth would get a new clock every frame as the song time stays at the end
+    scene->synth.setTiming(clock.songTimeAtDisplay(displayTime), displayTime - scene->midiTimeOffset,
+                           clock.speedAtDisplay(displayTime));
+
+    evictTextMeshes();
 }
 
 void Engine::render() {
@@ -133,6 +260,9 @@ void Engine::render() {
     for(auto &c : controllers)
         c.render();
 
+    if(frame % 360 == 0)
+        scene->profiler.dump(clock.displayTime());
+
 
     //DEBUG render all loaded meshes
     /*float x = -1, y = 0, z = -1;
@@ -148,6 +278,8 @@ void Engine::render() {
 }
 
 std::array<float, 38> Engine::fontWidth;
+std::array<std::vector<vertex_t>, 38> Engine::glyphVertices;
+std::array<std::vector<index_t>, 38> Engine::glyphIndices;
 
 
 std::vector <Geometry> Engine::loadGeometries() {
@@ -221,8 +353,13 @@ std::vector <Geometry> Engine::loadGeometries() {
             allIndices[alpha].push_back(indices[i + 2] - offset);
         }
 
-        for (size_t i = 0; i < numChars; i++)
+        for (size_t i = 0; i < numChars; i++) {
             g[i] = Geometry(allVertices[i], allIndices[i]);
+
+            //keep a copy for laying out whole strings, see getTextMesh()
+            glyphVertices[i] = allVertices[i];
+            glyphIndices[i] = allIndices[i];
+        }
     }
 
     {
@@ -6,10 +6,13 @@
 
 #include <array>
 #include <string>
+#include <unordered_map>
 
 #include "Global.h"
 #include "XrPassthroughGl.h"
 #include "Piarno.h"
+#include "PlaybackClock.h"
+#include "FrameArena.h"
 
 //DEBUG LOGGING
 #include "android/log.h"
@@ -48,14 +51,26 @@ public:
 
     // General
     uint64_t getFrame();
+    PlaybackClock& getClock(); //song time and display time of the current frame
+    FrameArena& getArena(); //for temporary data of the current frame, reset at the start of update()
+    Profiler& getProfiler(); //frame timings
 
     // Input
+    //the left and right controller, then the fingertips of the left and right hand (thumb to little finger);
+    //controllers and hands that aren't tracked are hidden and don't touch anything
     const std::vector<Rigid>& getControllers();
+    static const size_t FIRST_FINGERTIP = 2, FINGERTIPS = 10;
+    //notes played on a MIDI keyboard since the last frame, in the order they were played, times are display times
+    const std::vector<NoteEvent>& getPlayedNotes();
+
+    // Sound
+    Synth& getSynth(); //piano sound of the song and the played keys, it follows the clock by itself
     bool isButtonPressed(IO button);
     float getRightTriggerHoldLevel();
 
     // Render related
     Geometry* getGeometry(Mesh mesh);
+    InstanceBatch* getBatch(Mesh mesh);
     float textWidth(const std::string &text);
     void renderText(const std::string &text, vec3 pos, vec3 scl, vec3 rot, const color &col, bool centered = true);
 
@@ -63,8 +78,8 @@ public:
 
     //API calls for lower level stuff (OpenXR and OpenGL)
     Engine(Scene *scene);
-    void update();
-    void render();
+    void update(double displayTime); //predicted display time of the frame, in seconds
+    void render(); //record the frame's draws into the scene's queue, they are submitted by the render thread
     static std::vector<Geometry> loadGeometries();
 
 
@@ -72,9 +87,31 @@ protected:
     Scene *scene;
     Piarno piarno;
     std::vector<Rigid> controllers;
+    std::vector<NoteEvent> playedNotes;
 
     uint64_t frame = 0;
+    PlaybackClock clock;
+    FrameArena arena;
     std::array<XrBool32*, (size_t) IO::NUM> buttonStates;
 
+    //a string laid out into a single mesh, so a label is one draw call; a string that isn't cached yet
+    //allocates its mesh, so the frames in which a label changes (score, timeline) are not allocation free
+    struct TextMesh {
+        Geometry geometry;
+        float width;
+        uint64_t lastUsed; //frame, unused meshes get evicted
+    };
+    TextMesh& getTextMesh(const std::string &text);
+    void evictTextMeshes();
+    std::unordered_map<std::string, TextMesh> textCache;
+
+    //ids of meshes created at run time, they follow the static meshes
+    mesh_t newMeshId();
+    mesh_t nextMeshId = (mesh_t) Mesh::NUM;
+    std::vector<mesh_t> freeMeshIds;
+
+    static int glyphIndex(char c); //index into the glyph arrays, -1 if there is none
     static std::array<float, 38> fontWidth;
+    static std::array<std::vector<vertex_t>, 38> glyphVertices;
+    static std::array<std::vector<index_t>, 38> glyphIndices;
 };
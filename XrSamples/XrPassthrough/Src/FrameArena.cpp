@@ -0,0 +1,35 @@
+#include "FrameArena.h"
+
+FrameArena::FrameArena(size_t capacity) : block(capacity) {
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+    size_t start = (offset + alignment - 1) & ~(alignment - 1);
+    if (start + size <= block.size()) {
+        offset = start + size;
+        return block.data() + start;
+    }
+
+    //vector storage is aligned for any fundamental type
+    overflow.emplace_back(size);
+    overflowSize += size + alignment;
+    return overflow.back().data();
+}
+
+void FrameArena::reset() {
+    if (!overflow.empty()) {
+        //make room for the whole frame next time
+        block.resize(block.size() + overflowSize);
+        overflow.clear();
+        overflowSize = 0;
+    }
+    offset = 0;
+}
+
+size_t FrameArena::used() const {
+    return offset + overflowSize;
+}
+
+size_t FrameArena::capacity() const {
+    return block.size();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Bump allocator for data that only lives during one frame. Allocating is a pointer increment and
+// everything is freed at once by reset(), so the same memory is reused every frame. If a frame needs more
+// than the capacity, the extra blocks come from the heap and the capacity grows on the next reset().
+class FrameArena {
+public:
+    explicit FrameArena(size_t capacity = 64 * 1024);
+
+    //uninitialized storage for count objects, valid until the next reset(), no destructors are run
+    template<typename T>
+    T* allocate(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "arena objects are never destroyed");
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    //storage for count copies of value
+    template<typename T>
+    T* allocate(size_t count, const T &value) {
+        T *p = allocate<T>(count);
+        for (size_t i = 0; i < count; i++)
+            p[i] = value;
+        return p;
+    }
+
+    void* allocate(size_t size, size_t alignment);
+
+    //free everything allocated since the last reset, run at the start of a frame
+    void reset();
+
+    size_t used() const; //in bytes, of the current frame
+    size_t capacity() const;
+
+private:
+    std::vector<uint8_t> block;
+    size_t offset = 0;
+    std::vector<std::vector<uint8_t>> overflow; //blocks of the current frame that did not fit
+    size_t overflowSize = 0;
+};
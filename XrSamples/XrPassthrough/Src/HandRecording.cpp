@@ -0,0 +1,106 @@
+#include "HandRecording.h"
+
+#include <cstring>
+
+using namespace handrec;
+
+HandRecorder::~HandRecorder() {
+    close();
+}
+
+bool HandRecorder::open(const std::string &path) {
+    close();
+    file = fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+
+    HandHeader header{MAGIC, VERSION, XR_HAND_JOINT_COUNT_EXT, 0};
+    fwrite(&header, sizeof(header), 1, file);
+    return true;
+}
+
+void HandRecorder::close() {
+    if (file)
+        fclose(file);
+    file = nullptr;
+}
+
+bool HandRecorder::isOpen() const {
+    return file != nullptr;
+}
+
+void HandRecorder::write(double time, const TrackedHand hands[2]) {
+    if (!file)
+        return;
+
+    uint8_t frame[FRAME_SIZE];
+    uint8_t *out = frame;
+    memcpy(out, &time, sizeof(time));
+    out += sizeof(time);
+    for (int h = 0; h < 2; h++) {
+        uint32_t active = hands[h].active;
+        memcpy(out, &active, sizeof(active));
+        out += sizeof(active);
+        for (int j = 0; j < XR_HAND_JOINT_COUNT_EXT; j++) {
+            auto &pose = hands[h].joints[j];
+            HandJoint joint{{pose.Translation.x, pose.Translation.y, pose.Translation.z},
+                            {pose.Rotation.x, pose.Rotation.y, pose.Rotation.z, pose.Rotation.w},
+                            hands[h].radii[j]};
+            memcpy(out, &joint, sizeof(joint));
+            out += sizeof(joint);
+        }
+    }
+    fwrite(frame, sizeof(frame), 1, file);
+}
+
+
+HandPlayer::~HandPlayer() {
+    close();
+}
+
+bool HandPlayer::open(const std::string &path) {
+    close();
+    file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    HandHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != MAGIC || header.version != VERSION ||
+        header.jointCount != XR_HAND_JOINT_COUNT_EXT) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void HandPlayer::close() {
+    if (file)
+        fclose(file);
+    file = nullptr;
+}
+
+bool HandPlayer::next(double &time, TrackedHand hands[2]) {
+    uint8_t frame[FRAME_SIZE];
+    if (!file || fread(frame, sizeof(frame), 1, file) != 1)
+        return false;
+
+    const uint8_t *in = frame;
+    memcpy(&time, in, sizeof(time));
+    in += sizeof(time);
+    for (int h = 0; h < 2; h++) {
+        uint32_t active;
+        memcpy(&active, in, sizeof(active));
+        in += sizeof(active);
+        hands[h].active = active != 0;
+        for (int j = 0; j < XR_HAND_JOINT_COUNT_EXT; j++) {
+            HandJoint joint;
+            memcpy(&joint, in, sizeof(joint));
+            in += sizeof(joint);
+            hands[h].joints[j].Translation = OVR::Vector3f{joint.position[0], joint.position[1], joint.position[2]};
+            hands[h].joints[j].Rotation = OVR::Quatf{joint.orientation[0], joint.orientation[1], joint.orientation[2],
+                                                     joint.orientation[3]};
+            hands[h].radii[j] = joint.radius;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "XrPassthroughGl.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Binary recording of tracked hand joints, to replay hand input without a headset (Tools/HandReplay.cpp).
+// Written by the app while the system property debug.piarno.record_hands is 1, to <internal data>/hands.bin.
+// Everything is little-endian, frames follow each other without padding.
+//
+// layout: HandHeader | HandFrame...
+// HandFrame: double time (predicted display time in seconds) | HandPose left | HandPose right
+// HandPose: uint32 active | HandJoint[jointCount]
+namespace handrec {
+    const uint32_t MAGIC = 0x444e4850; //"PHND"
+    const uint32_t VERSION = 1;
+
+    struct HandHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t jointCount; //XR_HAND_JOINT_COUNT_EXT
+        uint32_t reserved;
+    };
+
+    struct HandJoint {
+        float position[3]; //in local space, meters
+        float orientation[4]; //x, y, z, w
+        float radius;
+    };
+
+    static_assert(sizeof(HandHeader) == 16 && sizeof(HandJoint) == 32,
+                  "the recording layout must not depend on the compiler");
+
+    const size_t FRAME_SIZE = sizeof(double) + 2 * (sizeof(uint32_t) + XR_HAND_JOINT_COUNT_EXT * sizeof(HandJoint));
+}
+
+// Appends frames to a recording. Writing a frame does not allocate.
+class HandRecorder {
+public:
+    ~HandRecorder();
+
+    bool open(const std::string &path);
+    void close();
+    bool isOpen() const;
+
+    void write(double time, const TrackedHand hands[2]);
+
+private:
+    FILE *file = nullptr;
+};
+
+// Reads the frames of a recording in order.
+class HandPlayer {
+public:
+    ~HandPlayer();
+
+    //returns false if the file can't be read or is not a recording of this version
+    bool open(const std::string &path);
+    void close();
+
+    //false at the end of the recording
+    bool next(double &time, TrackedHand hands[2]);
+
+private:
+    FILE *file = nullptr;
+};
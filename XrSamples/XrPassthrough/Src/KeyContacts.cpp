@@ -0,0 +1,92 @@
+#include "KeyContacts.h"
+
+#include <algorithm>
+#include <cmath>
+
+void KeyContacts::setKeys(const std::vector<Object> &objects) {
+    keys.clear();
+    float minX = INFINITY, maxX = -INFINITY;
+    for (size_t i = 0; i < objects.size() && i < MAX_KEYS; i++) {
+        //the rectangle is scl.x wide and scl.y long, laid flat by the rotation around x
+        auto &o = objects[i];
+        keys.push_back({o.pos.x - o.scl.x / 2, o.pos.x + o.scl.x / 2, o.pos.z - o.scl.y / 2, o.pos.z + o.scl.y / 2, o.pos.y});
+        minX = std::min(minX, keys.back().x0);
+        maxX = std::max(maxX, keys.back().x1);
+    }
+
+    originX = minX;
+    size_t count = keys.empty() ? 0 : (size_t) std::floor((maxX - minX) / BUCKET_SIZE) + 1;
+    buckets.assign(count, {});
+    bucketSize.assign(count, 0);
+
+    //higher keys first, so the first key containing a fingertip is the one it touches
+    std::vector<uint8_t> order(keys.size());
+    for (size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](uint8_t a, uint8_t b) { return keys[a].top > keys[b].top; });
+
+    for (auto k : order) {
+        size_t b0 = (size_t) std::floor((keys[k].x0 - originX) / BUCKET_SIZE);
+        size_t b1 = std::min(count - 1, (size_t) std::floor((keys[k].x1 - originX) / BUCKET_SIZE));
+        for (size_t b = b0; b <= b1; b++)
+            if (bucketSize[b] < MAX_BUCKET_KEYS)
+                buckets[b][bucketSize[b]++] = k;
+    }
+
+    down.reset();
+    downPrev.reset();
+    depths.fill(0);
+}
+
+void KeyContacts::update(const ObjectGroup &piano, const Rigid *fingertips, size_t count) {
+    downPrev = down;
+    depths.fill(0);
+    if (keys.empty())
+        return;
+
+    mat4 toLocal = piano.transform().Inverted();
+    float radiusToLocal = 1 / std::max(1e-6f, std::abs(piano.scl.y));
+
+    for (size_t i = 0; i < count; i++) {
+        const Rigid &tip = fingertips[i];
+        if (!tip.show)
+            continue;
+
+        vec3 p = toLocal.Transform(tip.globalPos(tip.pos + tip.offset));
+        long b = (long) std::floor((p.x - originX) / BUCKET_SIZE);
+        if (b < 0 || b >= (long) buckets.size())
+            continue;
+
+        for (size_t j = 0; j < bucketSize[b]; j++) {
+            const Key &k = keys[buckets[b][j]];
+            if (p.x < k.x0 || p.x > k.x1 || p.z < k.z0 || p.z > k.z1)
+                continue;
+
+            float d = k.top - (p.y - tip.radius * radiusToLocal);
+            if (0 < d && d <= MAX_DEPTH) {
+                float &depth = depths[buckets[b][j]];
+                depth = std::max(depth, d);
+            }
+            break; //only the highest key under the fingertip
+        }
+    }
+
+    for (size_t k = 0; k < keys.size(); k++)
+        down[k] = depths[k] >= (downPrev[k] ? RELEASE_DEPTH : PRESS_DEPTH);
+}
+
+bool KeyContacts::isDown(int key) const {
+    return down[key];
+}
+
+bool KeyContacts::isPressed(int key) const {
+    return down[key] && !downPrev[key];
+}
+
+bool KeyContacts::isReleased(int key) const {
+    return !down[key] && downPrev[key];
+}
+
+float KeyContacts::depth(int key) const {
+    return depths[key];
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Object.h"
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+// Which piano keys the fingertips press down. The keys are the flat rectangles of the overlay in the piano's
+// space; a key is pressed when a fingertip over it reaches PRESS_DEPTH below its top, and released once no
+// fingertip is RELEASE_DEPTH below it anymore. Fingertips are found in buckets along the keyboard, so a test
+// is a handful of comparisons per fingertip, and update() does not allocate.
+class KeyContacts {
+public:
+    static constexpr size_t MAX_KEYS = 128;
+    static constexpr size_t MAX_BUCKET_KEYS = 4; //keys overlapping one bucket, a white key and the black ones next to it
+    static constexpr float BUCKET_SIZE = 0.005f; //meters along the keyboard
+    static constexpr float PRESS_DEPTH = 0.005f; //below the top of the key
+    static constexpr float RELEASE_DEPTH = 0.0025f;
+    static constexpr float MAX_DEPTH = 0.04f; //further below the fingertip is under the keyboard, not on a key
+
+    //keys in index order, with the transforms they have at rest (flat rectangles rotated to lie in x/z)
+    void setKeys(const std::vector<Object> &keys);
+
+    //test the shown fingertips against the keys of the piano group, once per frame
+    void update(const ObjectGroup &piano, const Rigid *fingertips, size_t count);
+
+    bool isDown(int key) const;
+    bool isPressed(int key) const; //went down this frame
+    bool isReleased(int key) const; //came up this frame
+    float depth(int key) const; //how far the deepest fingertip is below the top of the key, 0 if none is
+
+private:
+    struct Key {
+        float x0, x1, z0, z1; //footprint in the piano's space
+        float top; //y of the surface
+    };
+    std::vector<Key> keys;
+
+    //keys overlapping each bucket along x, in order of their tops (highest first, black keys before white)
+    float originX = 0;
+    std::vector<std::array<uint8_t, MAX_BUCKET_KEYS>> buckets;
+    std::vector<uint8_t> bucketSize;
+
+    std::bitset<MAX_KEYS> down, downPrev;
+    std::array<float, MAX_KEYS> depths{};
+};
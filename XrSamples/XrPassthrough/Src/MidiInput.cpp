@@ -0,0 +1,106 @@
+#include "MidiInput.h"
+
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+
+bool MidiParser::feed(uint8_t byte, double time, NoteEvent &note) {
+    if (byte >= 0xf8) //real-time messages can come between any two bytes
+        return false;
+
+    if (byte & 0x80) {
+        //a system message cancels the running status, only the end of a system exclusive one is expected here
+        sysex = byte == 0xf0;
+        status = byte < 0xf0 ? byte : 0;
+        count = 0;
+        return false;
+    }
+
+    if (sysex || status == 0)
+        return false;
+
+    data[count++] = byte;
+    uint8_t command = status & 0xf0;
+    uint8_t length = command == 0xc0 || command == 0xd0 ? 1 : 2;
+    if (count < length)
+        return false;
+    count = 0; //running status: the next data bytes are another message of the same kind
+
+    if (command != 0x80 && command != 0x90)
+        return false;
+    note.time = time;
+    note.key = data[0];
+    note.velocity = command == 0x90 ? data[1] : 0;
+    return true;
+}
+
+
+double MidiInput::now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+void MidiInput::push(const NoteEvent &note) {
+    if (!ring.push(note))
+        drops.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MidiInput::pop(NoteEvent &note) {
+    return ring.pop(note);
+}
+
+uint32_t MidiInput::dropped() const {
+    return drops.load(std::memory_order_relaxed);
+}
+
+
+StreamMidiSource::~StreamMidiSource() {
+    stop();
+}
+
+bool StreamMidiSource::start(int descriptor, MidiInput &target) {
+    stop();
+    if (descriptor < 0)
+        return false;
+
+    fd = descriptor;
+    input = &target;
+    stopping = false;
+    running = true;
+    thread = std::thread(&StreamMidiSource::run, this);
+    return true;
+}
+
+void StreamMidiSource::stop() {
+    stopping = true;
+    if (thread.joinable())
+        thread.join();
+}
+
+bool StreamMidiSource::isRunning() const {
+    return running;
+}
+
+void StreamMidiSource::run() {
+    MidiParser parser;
+    uint8_t bytes[64];
+    while (!stopping) {
+        //wake up now and then to see if the source was stopped
+        pollfd p{fd, POLLIN, 0};
+        if (poll(&p, 1, 50) <= 0)
+            continue;
+
+        ssize_t n = read(fd, bytes, sizeof(bytes));
+        if (n <= 0)
+            break;
+
+        double time = MidiInput::now();
+        NoteEvent note;
+        for (ssize_t i = 0; i < n; i++) {
+            if (parser.feed(bytes[i], time, note))
+                input->push(note);
+        }
+    }
+    running = false;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "SpscRing.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+// A key played on a MIDI keyboard.
+struct NoteEvent {
+    double time; //seconds, on the monotonic clock (MidiInput::now()) until the engine hands it out as display time
+    uint8_t key; //MIDI key number
+    uint8_t velocity; //0 for a release
+
+    bool isPress() const {
+        return velocity > 0;
+    }
+};
+
+// Turns a raw MIDI byte stream into note events. Handles running status and real-time bytes in between
+// the bytes of a message, skips system exclusive messages and drops all other channel messages.
+// A note-on with velocity 0 is a release, as most keyboards send it.
+class MidiParser {
+public:
+    //true if the byte completes a note-on or note-off, which is written to note
+    bool feed(uint8_t byte, double time, NoteEvent &note);
+
+private:
+    uint8_t status = 0; //of the current channel message, 0 while there is none
+    uint8_t data[2] = {};
+    uint8_t count = 0; //data bytes of the message so far
+    bool sysex = false;
+};
+
+// Played notes on their way from the thread of a MIDI source to the main thread (Engine::update).
+// One source thread pushes at a time, so the handoff is a lock-free ring. If the main thread falls behind by
+// more than CAPACITY notes, the newest ones are dropped and counted.
+class MidiInput {
+public:
+    static constexpr size_t CAPACITY = 256;
+
+    //the clock of the time stamps: CLOCK_MONOTONIC in seconds, the clock of Android's MIDI time stamps
+    static double now();
+
+    //source thread
+    void push(const NoteEvent &note);
+
+    //main thread, false once there are no more notes
+    bool pop(NoteEvent &note);
+    uint32_t dropped() const;
+
+private:
+    SpscRing<NoteEvent, CAPACITY> ring;
+    std::atomic<uint32_t> drops{0};
+};
+
+// Reads a raw MIDI byte stream from a file descriptor on its own thread: a pipe, a FIFO, or a raw MIDI device
+// of ALSA (/dev/snd/midiC1D0) on Linux. A note is time stamped when its last byte is read.
+// The thread ends at the end of the stream or when stopped; the descriptor is not closed.
+class StreamMidiSource {
+public:
+    ~StreamMidiSource();
+
+    bool start(int fd, MidiInput &input);
+    void stop();
+    bool isRunning() const; //false once the stream ended
+
+private:
+    void run();
+
+    int fd = -1;
+    MidiInput *input = nullptr;
+    std::thread thread;
+    std::atomic<bool> stopping{false}, running{false};
+};
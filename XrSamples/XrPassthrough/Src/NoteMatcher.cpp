@@ -0,0 +1,111 @@
+#include "NoteMatcher.h"
+
+#include <algorithm>
+
+void NoteMatcher::setTiles(const TileStore &store, int numKeys) {
+    tiles = &store;
+    byKey.assign(numKeys, {});
+    for (size_t i = 0; i < store.size(); i++)
+        byKey[store.key[i]].push_back(i);
+    cursor.assign(numKeys, 0);
+    results.assign(store.size(), Result::pending);
+    missCursor = 0;
+    held.assign(numKeys, 0);
+    hitKeys.assign(numKeys, false);
+    hits = missed = extra = 0;
+}
+
+NoteMatcher::Match NoteMatcher::press(int key, float time) {
+    if (key < 0 || key >= (int) byKey.size()) {
+        extra++;
+        return {-1, 0};
+    }
+    held[key] = std::min(held[key] + 1, 255);
+
+    //tiles before the cursor are played, missed or skipped, and so are the ones before the window
+    auto &list = byKey[key];
+    uint32_t &c = cursor[key];
+    while (c < list.size() && (results[list[c]] != Result::pending || tiles->start[list[c]] < time - WINDOW))
+        c++;
+
+    if (c == list.size() || tiles->start[list[c]] > time + WINDOW) {
+        extra++;
+        hitKeys[key] = false;
+        return {-1, 0};
+    }
+
+    uint32_t tile = list[c++];
+    results[tile] = Result::hit;
+    hits++;
+    hitKeys[key] = true;
+    return {(int32_t) tile, time - tiles->start[tile]};
+}
+
+void NoteMatcher::release(int key) {
+    if (key >= 0 && key < (int) held.size() && held[key] > 0)
+        held[key]--;
+}
+
+void NoteMatcher::advance(float now) {
+    if (!tiles)
+        return;
+    auto &start = tiles->start;
+    for (; missCursor < start.size() && start[missCursor] < now - WINDOW; missCursor++) {
+        if (results[missCursor] == Result::pending) {
+            results[missCursor] = Result::missed;
+            missed++;
+        }
+    }
+}
+
+void NoteMatcher::seek(float now) {
+    if (!tiles)
+        return;
+    auto &start = tiles->start;
+    size_t from = std::partition_point(start.begin(), start.end(), [&](float s) { return s < now - WINDOW; }) - start.begin();
+
+    //everything from the seek time on can be played again, what was jumped over doesn't count as missed
+    for (size_t i = 0; i < start.size(); i++) {
+        Result &r = results[i];
+        if (i >= from) {
+            hits -= r == Result::hit;
+            missed -= r == Result::missed;
+            r = Result::pending;
+        } else if (r == Result::pending) {
+            r = Result::skipped;
+        }
+    }
+    missCursor = from;
+
+    for (size_t k = 0; k < byKey.size(); k++) {
+        auto &list = byKey[k];
+        cursor[k] = std::partition_point(list.begin(), list.end(), [&](uint32_t t) { return t < from; }) - list.begin();
+    }
+}
+
+bool NoteMatcher::isHeld(int key) const {
+    return held[key] > 0;
+}
+
+bool NoteMatcher::isHit(int key) const {
+    return hitKeys[key];
+}
+
+NoteMatcher::Result NoteMatcher::result(size_t tile) const {
+    return results[tile];
+}
+
+size_t NoteMatcher::resolvedTiles() const {
+    return missCursor;
+}
+
+int32_t NoteMatcher::nearestTile(int key, float time) const {
+    if (key < 0 || key >= (int) byKey.size() || byKey[key].empty())
+        return -1;
+    auto &list = byKey[key];
+    auto &start = tiles->start;
+    auto after = std::partition_point(list.begin(), list.end(), [&](uint32_t t) { return start[t] < time; });
+    if (after == list.end() || (after != list.begin() && time - start[after[-1]] < start[*after] - time))
+        --after;
+    return *after;
+}
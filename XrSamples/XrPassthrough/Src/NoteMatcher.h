@@ -0,0 +1,57 @@
+#pragma once
+
+#include "TileStore.h"
+#include <cstdint>
+#include <vector>
+
+// Pairs the notes the player plays with the tiles of the song. A press matches the earliest tile of its key
+// that is not played yet and starts at most WINDOW before or after it; a press that matches none is an extra
+// note, and so is a press of a key the piano doesn't have. Tiles nobody played WINDOW after their start are missed.
+// The tiles of each key are kept in start order with a cursor at the first one that can still be played,
+// and missed tiles are found with a cursor over all tiles, so a press and a frame are O(1) amortized.
+class NoteMatcher {
+public:
+    static constexpr float WINDOW = 0.15f; //song seconds, early or late
+
+    enum class Result : uint8_t {
+        pending,
+        hit,
+        missed,
+        skipped, //jumped over by a seek
+    };
+
+    struct Match {
+        int32_t tile; //-1 for an extra note
+        float error; //song seconds the press was late (negative: early), 0 for an extra note
+    };
+
+    //a new song: all tiles are pending
+    void setTiles(const TileStore &tiles, int numKeys);
+
+    //a press or release at a song time; presses have to come in time order and before advance() of their frame
+    Match press(int key, float time);
+    void release(int key);
+
+    //once per frame with the song time: tiles that can't be played anymore are missed
+    void advance(float now);
+
+    //the song time jumped: tiles from now - WINDOW on are pending again, the ones before are skipped
+    void seek(float now);
+
+    bool isHeld(int key) const;
+    bool isHit(int key) const; //the last press of the key matched a tile
+    Result result(size_t tile) const;
+    size_t resolvedTiles() const; //tiles before this one can't be played anymore, advance() only moves it forward
+    int32_t nearestTile(int key, float time) const; //of the key, starting nearest to a song time, -1 if there is none
+
+    uint32_t hits = 0, missed = 0, extra = 0;
+
+private:
+    const TileStore *tiles = nullptr;
+    std::vector<std::vector<uint32_t>> byKey; //tile indices of each key, in start order
+    std::vector<uint32_t> cursor; //per key: first tile in byKey that may still be pending
+    std::vector<Result> results; //per tile
+    size_t missCursor = 0; //first tile that may still become missed
+    std::vector<uint8_t> held; //presses of each key that weren't released, a key may be played by several sources
+    std::vector<bool> hitKeys;
+};
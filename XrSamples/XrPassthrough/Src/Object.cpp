@@ -7,37 +7,71 @@
 
 using namespace global;
 
-color::color(color_t r, color_t g, color_t b, color_t a, Geometry *perVertexGeom) : data{r, g, b, a} {
+color::color(color_t r, color_t g, color_t b, color_t a, Geometry *perVertexGeom) : rgba{r, g, b, a} {
     if(perVertexGeom && !perVertexGeom->global_color) {
-        data.resize(perVertexGeom->vertexCount * 4 / 3);
-        for (size_t i = 4; i < data.size(); i += 4) {
-            data[i + 0] = r;
-            data[i + 1] = g;
-            data[i + 2] = b;
-            data[i + 3] = a;
+        palette = std::make_shared<std::vector<color_t>>(perVertexGeom->vertexCount * 4 / 3);
+        auto &p = *palette;
+        for (size_t i = 0; i < p.size(); i += 4) {
+            p[i + 0] = r;
+            p[i + 1] = g;
+            p[i + 2] = b;
+            p[i + 3] = a;
         }
     }
 }
 
+color_t* color::channels() {
+    if(!palette)
+        return rgba;
+    if(palette.use_count() > 1)
+        palette = std::make_shared<std::vector<color_t>>(*palette);
+    return palette->data();
+}
+
+const color_t* color::data() const {
+    return palette ? palette->data() : rgba;
+}
+
+size_t color::size() const {
+    return palette ? palette->size() : 4;
+}
+
 color_t& color::r(int i) {
-    return data[4*i + 0];
+    return channels()[4*i + 0];
 }
 
 color_t& color::g(int i) {
-    return data[4*i + 1];
+    return channels()[4*i + 1];
 }
 
 color_t& color::b(int i) {
-    return data[4*i + 2];
+    return channels()[4*i + 2];
 }
 
 color_t& color::a(int i) {
-    return data[4*i + 3];
+    return channels()[4*i + 3];
+}
+
+color_t color::r(int i) const {
+    return data()[4*i + 0];
+}
+
+color_t color::g(int i) const {
+    return data()[4*i + 1];
+}
+
+color_t color::b(int i) const {
+    return data()[4*i + 2];
+}
+
+color_t color::a(int i) const {
+    return data()[4*i + 3];
 }
 
 void color::setAll(size_t channel, color_t val) {
-    for(size_t i = channel; i < data.size(); i += 4)
-        data[i] = val;
+    auto c = channels();
+    for(size_t i = channel; i < size(); i += 4)
+        c[i] = val;
 }
 
 
@@ -53,6 +87,47 @@ mat4 rotate(vec3 rot) {
     return mat4::RotationZ(rot.z) * mat4::RotationY(rot.y) * mat4::RotationX(rot.x);
 }
 
+mat4 compose(vec3 pos, vec3 rot, vec3 scl) {
+    float sx = sin(rot.x), cx = cos(rot.x);
+    float sy = sin(rot.y), cy = cos(rot.y);
+    float sz = sin(rot.z), cz = cos(rot.z);
+
+    //columns of RotationZ * RotationY * RotationX, each multiplied by its scale
+    return mat4(cz*cy * scl.x, (cz*sy*sx - sz*cx) * scl.y, (cz*sy*cx + sz*sx) * scl.z, pos.x,
+                sz*cy * scl.x, (sz*sy*sx + cz*cx) * scl.y, (sz*sy*cx - cz*sx) * scl.z, pos.y,
+                -sy * scl.x,   cy*sx * scl.y,              cy*cx * scl.z,              pos.z,
+                0,             0,                          0,                          1);
+}
+
+quat orientation(vec3 rot) {
+    return quat(vec3{0, 0, 1}, rot.z) * quat(vec3{0, 1, 0}, rot.y) * quat(vec3{1, 0, 0}, rot.x);
+}
+
+vec3 eulerAngles(const quat &q) {
+    vec3 rot;
+    q.GetEulerAngles<OVR::Axis_Z, OVR::Axis_Y, OVR::Axis_X>(&rot.z, &rot.y, &rot.x);
+    return rot;
+}
+
+
+const mat4& TransformCache::matrix(const vec3 &pos, const vec3 &rot, const vec3 &scl) {
+    if(pos != matrixPos || rot != matrixRot || scl != matrixScl) {
+        cachedMatrix = compose(pos, rot, scl);
+        matrixPos = pos;
+        matrixRot = rot;
+        matrixScl = scl;
+    }
+    return cachedMatrix;
+}
+
+const quat& TransformCache::orientation(const vec3 &rot) {
+    if(rot != orientationRot) {
+        cachedOrientation = ::orientation(rot);
+        orientationRot = rot;
+    }
+    return cachedOrientation;
+}
+
 
 Object::Object(Geometry *geometry) : geometry(geometry) {
 }
@@ -61,31 +136,43 @@ void Object::render(mat4 *postTransform) {
     if(!show)
         return;
 
-    geometry->updateColors(col.data);
+    geometry->updateColors(col.data(), col.size());
 
     //set the transformation matrix and render
-    mat4 trans = translate(pos) * rotate(rot) * scale(scl);
+    mat4 trans = transform();
     if(postTransform)
         geometry->render(*postTransform * trans);
     else
         geometry->render(trans);
 }
 
+const mat4& Object::transform() const {
+    return cache.matrix(pos, rot, scl);
+}
+
 vec3 Object::globalPos(std::optional<vec3> p) const {
     if(parent)
-        return (translate(parent->pos) * rotate(parent->rot) * scale(parent->scl)).Transform(p.value_or(pos));
+        return parent->transform().Transform(p.value_or(pos));
     else
         return p.value_or(pos);
 }
 
 vec3 Object::globalRot(std::optional<vec3> r) const {
     if(parent)
-        //FIXME: this is correct... right???
-        return parent->rot + r.value_or(rot);
+        //euler angles don't add up (unless both rotate around the same axis), compose the rotations instead
+        return eulerAngles(globalOrientation(r));
     else
         return r.value_or(rot);
 }
 
+quat Object::globalOrientation(std::optional<vec3> r) const {
+    quat local = r ? orientation(*r) : cache.orientation(rot);
+    if(parent)
+        return parent->orientation() * local;
+    else
+        return local;
+}
+
 vec3 Object::globalScl(std::optional<vec3> s) const {
     if(parent)
         return parent->scl * s.value_or(scl);
@@ -97,12 +184,20 @@ ObjectGroup::ObjectGroup()
 {}
 
 void ObjectGroup::render() {
-    mat4 trans = translate(pos) * rotate(rot) * scale(scl);
+    mat4 trans = transform();
     for(auto o : objects) {
         o->render(&trans);
     }
 }
 
+const mat4& ObjectGroup::transform() const {
+    return cache.matrix(pos, rot, scl);
+}
+
+const quat& ObjectGroup::orientation() const {
+    return cache.orientation(rot);
+}
+
 Object& ObjectGroup::operator[](size_t i) {
     return *objects[i];
 }
@@ -135,7 +230,7 @@ Rigid::Rigid(Geometry *geometry) : Object(geometry) {
 
 }
 
-bool Rigid::isColliding(const Rigid &other) {
+bool Rigid::isColliding(const Rigid &other) const {
     vec3 a = globalPos(pos + offset);
     vec3 b = other.globalPos(other.pos + other.offset);
     float radiusSq = (radius + other.radius) * (radius + other.radius);
@@ -149,26 +244,46 @@ Button::Button(Geometry *geometry) : Rigid(geometry) {
 }
 
 void Button::update(const std::vector<Rigid> &controllers) {
-    pressedPrev = pressed;
-
-    float currentPress = 0;
-    vec3 p1 = globalPos();
-    for(auto &c : controllers) {
-        vec3 p2 = c.globalPos();
-        if(isColliding(c)) { //is pushing down from above
-            //calculate press distance
-            float radiusSq = (radius + c.radius) * (radius + c.radius);
-            float horizontalDistSq = (p1.x - p2.x) * (p1.x - p2.x) + (p1.z - p2.z) * (p1.z - p2.z);
-            float verticalDist = p2.y - p1.y;
-            float pressDist = sqrt(radiusSq - horizontalDistSq) - verticalDist - 0.01;
-            currentPress = std::max(currentPress, pressDist);
-        }
+    for(size_t i = 0; i < controllers.size(); i++)
+        if(controllers[i].show && isColliding(controllers[i]))
+            contact(i, controllers[i]);
+    endContacts(controllers);
+}
+
+void Button::contact(size_t index, const Rigid &controller) {
+    //calculate press distance, the controller is pushing down from above
+    vec3 p1 = pressOrigin();
+    vec3 p2 = controller.globalPos();
+    float radiusSq = (radius + controller.radius) * (radius + controller.radius);
+    float horizontalDistSq = (p1.x - p2.x) * (p1.x - p2.x) + (p1.z - p2.z) * (p1.z - p2.z);
+    float verticalDist = p2.y - p1.y;
+    float pressDist = sqrt(radiusSq - horizontalDistSq) - verticalDist - 0.01;
+
+    if(pressDist > currentPress) {
+        currentPress = pressDist;
+        contactIndex = index;
     }
+}
+
+void Button::endContacts(const std::vector<Rigid> &) {
+    pressedPrev = pressed;
 
     currentPress = std::min(currentPress, maxPress);
     pressed = currentPress >= maxPress / 2;
     offset.y = -currentPress;
     //TODO: vibration for feedback?
+
+    currentPress = 0;
+    contactIndex = -1;
+}
+
+void Button::bounds(vec3 &lo, vec3 &hi) const {
+    lo = hi = pos + vec3{offset.x, 0, offset.z};
+    lo.y -= maxPress;
+}
+
+vec3 Button::pressOrigin() const {
+    return globalPos();
 }
 
 bool Button::isPressed() {
@@ -183,16 +298,20 @@ bool Button::isBeingPressed() {
     return pressed;
 }
 
+bool Button::isIdle() const {
+    return !pressed && !pressedPrev && offset.y == 0;
+}
+
 void Button::render(mat4 *postTransform) {
     if(!show)
         return;
 
-    color c = pressed && pressCol.a() > 0 ? pressCol : col;
-    geometry->updateColors(c.data);
+    const color &c = pressed && pressCol.a() > 0 ? pressCol : col;
+    geometry->updateColors(c.data(), c.size());
 
 
     //set the transformation matrix and render
-    mat4 trans = translate(pos + offset) * rotate(rot) * scale(scl);
+    mat4 trans = compose(pos + offset, rot, scl);
     if(postTransform)
         geometry->render(*postTransform * trans);
     else
@@ -200,7 +319,8 @@ void Button::render(mat4 *postTransform) {
 
     if(!label.empty()) {
         auto p = globalPos(pos + offset + vec3{0, scl.y, 0}), s = globalScl(scl * vec3{0.5, 0.8, 1}), r = globalRot(rot + vec3{-M_PI/2, labelRot, 0});
-        engine->renderText(label, p, s, r, color{255, 255, 255, 200});
+        static const color labelColor{255, 255, 255, 200};
+        engine->renderText(label, p, s, r, labelColor);
     }
 }
 
@@ -214,41 +334,35 @@ Slider::Slider(float minVal, float value, float maxVal, float left, float right,
 }
 
 
-void Slider::update(const std::vector<Rigid> &controllers) {
+void Slider::endContacts(const std::vector<Rigid> &controllers) {
     pressedPrev = pressed;
 
-    float currentPress = 0;
-    int controllerIndex = -1;
-    vec3 p1 = globalPos(pos + vec3{offset.x, 0, offset.z});
-    for(size_t i = 0; i < controllers.size(); i++) {
-        auto &c = controllers[i];
-        vec3 p2 = c.globalPos();
-        if(isColliding(c)) { //is pushing down from above
-            //calculate press distance
-            float radiusSq = (radius + c.radius) * (radius + c.radius);
-            float horizontalDistSq = (p1.x - p2.x) * (p1.x - p2.x) + (p1.z - p2.z) * (p1.z - p2.z);
-            float verticalDist = p2.y - p1.y;
-            float pressDist = sqrt(radiusSq - horizontalDistSq) - verticalDist - 0.01;
-
-            if(pressDist > currentPress) {
-                controllerIndex = i;
-                currentPress = pressDist;
-            }
-        }
-    }
-
     currentPress = std::min(currentPress, maxPress);
     pressed = currentPress >= maxPress / 2;
 
     if(pressed && !pressedPrev) {
-        controllerOffset = calculateOffset(controllers[controllerIndex].pos) - offset;
+        controllerOffset = calculateOffset(controllers[contactIndex].pos) - offset;
     }
 
-    if(controllerIndex != -1 && pressed) {
-        offset = vec3::Max(min * trackDir, vec3::Min(calculateOffset(controllers[controllerIndex].pos) - controllerOffset, max * trackDir));
+    if(contactIndex != -1 && pressed) {
+        offset = vec3::Max(min * trackDir, vec3::Min(calculateOffset(controllers[contactIndex].pos) - controllerOffset, max * trackDir));
         val = sqrt((offset.x * offset.x) + (offset.z * offset.z));
     }
     offset.y = -currentPress;
+
+    currentPress = 0;
+    contactIndex = -1;
+}
+
+void Slider::bounds(vec3 &lo, vec3 &hi) const {
+    //anywhere along the track
+    lo = vec3::Min(pos + min * trackDir, pos + max * trackDir);
+    hi = vec3::Max(pos + min * trackDir, pos + max * trackDir);
+    lo.y -= maxPress;
+}
+
+vec3 Slider::pressOrigin() const {
+    return globalPos(pos + vec3{offset.x, 0, offset.z});
 }
 
 float Slider::get() {
@@ -269,11 +383,12 @@ void Slider::render(mat4 *postTransform) {
     Button::render(postTransform);
 
     //render slider track
+    static const color trackColor{50, 50, 50, 255};
     auto track = engine->getGeometry(Mesh::rect);
-    track->updateColors(color{50, 50, 50, 255}.data);
+    track->updateColors(trackColor.data(), trackColor.size());
 
     //set the transformation matrix and render
-    mat4 trans = translate(pos + vec3{(min+max)/2, -scl.y/2, 0}) * rotate(rot + vec3{(float)-M_PI/2, 0, 0}) * scale(vec3{max - min, 0.01, 1});
+    mat4 trans = compose(pos + vec3{(min+max)/2, -scl.y/2, 0}, rot + vec3{(float)-M_PI/2, 0, 0}, vec3{max - min, 0.01, 1});
     if(postTransform)
         track->render(*postTransform * trans);
     else
@@ -282,7 +397,6 @@ void Slider::render(mat4 *postTransform) {
 
 vec3 Slider::calculateOffset(vec3 controllerPos) {
     vec3 c = (controllerPos - globalPos());
-    vec3 r = globalRot();
-    vec3 relative{c.x * cos(-r.y) + c.z * sin(-r.y), c.y, -c.x * sin(-r.y) + c.z * cos(-r.y)}; //rotate controller pos around y axis to match slider rotation
+    vec3 relative = globalOrientation().InverseRotate(c); //rotate controller pos to match slider rotation
     return relative.ProjectTo(trackDir);
 }
\ No newline at end of file
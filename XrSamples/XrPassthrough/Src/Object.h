@@ -4,16 +4,20 @@
 #include "Global.h"
 #include <string>
 #include <optional>
+#include <memory>
 
 /// USEFUL TYPES AND FUNCTIONS
 using vec3 = OVR::Vector3f;
 using mat4 = OVR::Matrix4f;
+using quat = OVR::Quatf;
 
 const size_t R = 0;
 const size_t G = 1;
 const size_t B = 2;
 const size_t A = 3;
 
+//a single RGBA color stored inline, or per-vertex colors (one RGBA per vertex) of perVertexGeom in a palette
+//palettes are shared between copies and never changed in place: writing to a color copies a shared palette first
 struct color {
     color(color_t r, color_t g, color_t b, color_t a, Geometry *perVertexGeom = nullptr);
 
@@ -21,14 +25,46 @@ struct color {
     color_t& g(int i = 0);
     color_t& b(int i = 0);
     color_t& a(int i = 0);
+    color_t r(int i = 0) const;
+    color_t g(int i = 0) const;
+    color_t b(int i = 0) const;
+    color_t a(int i = 0) const;
     void setAll(size_t channel, color_t val);
 
-    std::vector<color_t> data;
+    //RGBA bytes, size() of them
+    const color_t* data() const;
+    size_t size() const;
+
+private:
+    color_t* channels(); //writable data()
+
+    color_t rgba[4]; //unused when there is a palette
+    std::shared_ptr<std::vector<color_t>> palette;
 };
 
 mat4 translate(vec3 pos);
 mat4 scale(vec3 scl);
 mat4 rotate(vec3 rot);
+//same as translate(pos) * rotate(rot) * scale(scl), but built directly instead of multiplying five matrices
+mat4 compose(vec3 pos, vec3 rot, vec3 scl);
+//orientation of rotate(rot), and back to the euler angles rotate() takes
+quat orientation(vec3 rot);
+vec3 eulerAngles(const quat &q);
+
+//cached compose(pos, rot, scl) of an object or group
+//pos, rot and scl are plain fields that are assigned directly, so instead of setters raising a dirty flag
+//the cache remembers the values it was built from and is rebuilt when they changed
+class TransformCache {
+public:
+    const mat4& matrix(const vec3 &pos, const vec3 &rot, const vec3 &scl);
+    const quat& orientation(const vec3 &rot);
+
+private:
+    mat4 cachedMatrix;
+    quat cachedOrientation;
+    vec3 matrixPos{NAN, NAN, NAN}, matrixRot{NAN, NAN, NAN}, matrixScl{NAN, NAN, NAN};
+    vec3 orientationRot{NAN, NAN, NAN};
+};
 
 
 /// OBJECTS
@@ -40,9 +76,14 @@ public:
     virtual ~Object() = default;
     virtual void render(mat4 *postTransform = nullptr);
 
+    //local transformation from pos, rot and scl
+    const mat4& transform() const;
+
+    //local position/rotation/scale (own ones by default) transformed by the parent group
     vec3 globalPos(std::optional<vec3> p = std::nullopt) const;
     vec3 globalRot(std::optional<vec3> r = std::nullopt) const;
     vec3 globalScl(std::optional<vec3> s = std::nullopt) const;
+    quat globalOrientation(std::optional<vec3> r = std::nullopt) const;
 
     vec3 pos{0, 0, 0};
     vec3 rot{0, 0, 0};
@@ -55,6 +96,8 @@ public:
 protected:
     friend ObjectGroup; //allow it to access parent attribute
     ObjectGroup *parent = nullptr;
+
+    mutable TransformCache cache;
 };
 
 //represents a group of objects that are stuck together (their positions and rotations are local)
@@ -65,6 +108,10 @@ public:
     ObjectGroup();
     void render();
 
+    //local to global transformation of this group, only recalculated when pos, rot or scl changed
+    const mat4& transform() const;
+    const quat& orientation() const;
+
     Object& operator[](size_t i);
     iterator begin();
     iterator end();
@@ -78,6 +125,8 @@ public:
 
 protected:
     std::vector<Object*> objects;
+
+    mutable TransformCache cache;
 };
 
 //represents an object with a spherical collision body that can detect collision with another rigid
@@ -86,7 +135,7 @@ public:
     Rigid(Geometry *geometry = nullptr);
     ~Rigid() override = default;
 
-    bool isColliding(const Rigid &other);
+    bool isColliding(const Rigid &other) const;
 
     //offset position (center of body) relative to Object.pos
     vec3 offset{0, 0, 0};
@@ -100,15 +149,25 @@ public:
     Button(Geometry *geometry = nullptr);
     ~Button() override = default;
 
-    //run this once per frame
+    //run this once per frame, unless the button is in a ContactGrid that does it; hidden controllers are skipped
     void update(const std::vector<Rigid> &controllers);
 
+    //contact events of a frame: contact() for every controller colliding with the button (index into
+    //controllers), then endContacts() once to update the press state, also when there was no contact
+    void contact(size_t index, const Rigid &controller);
+    virtual void endContacts(const std::vector<Rigid> &controllers);
+
+    //box (in the parent group's space) the collision body stays in, without the radius
+    virtual void bounds(vec3 &lo, vec3 &hi) const;
+
     //returns true when button is pressed once
     bool isPressed();
     //returns true when button is released once
     bool isReleased();
     //returns current status
     bool isBeingPressed();
+    //not pressed, not just released and fully up: without contacts nothing changes
+    bool isIdle() const;
 
     void render(mat4 *postTransform = nullptr) override;
 
@@ -117,8 +176,15 @@ public:
     float labelRot = 0;
 
 protected:
+    //where presses are measured from, globally
+    virtual vec3 pressOrigin() const;
+
     bool pressed = false, pressedPrev = false;
     float maxPress = radius;
+
+    //deepest contact of this frame so far
+    float currentPress = 0;
+    int contactIndex = -1;
 };
 
 //a slider that can be moved along a set track (left and right)
@@ -128,8 +194,8 @@ public:
     Slider(float minValue, float value, float maxValue, float left = 0, float right = 0.2, Geometry *geometry = nullptr);
     ~Slider() override = default;
 
-    //run this once per frame
-    void update(const std::vector<Rigid> &controllers);
+    void endContacts(const std::vector<Rigid> &controllers) override;
+    void bounds(vec3 &lo, vec3 &hi) const override;
 
     float get();
     void set(float val);
@@ -140,6 +206,7 @@ public:
     float minVal = 0, maxVal = 1; //range of the value for set/get
 
 protected:
+    vec3 pressOrigin() const override;
     vec3 calculateOffset(vec3 controllerPos);
 
     float val = 0;
@@ -0,0 +1,175 @@
+#include "PerfGovernor.h"
+
+#include <algorithm>
+
+static PerfLevel raised(PerfLevel level) {
+    return std::min(PerfLevel::boost, (PerfLevel) ((uint8_t) level + 1));
+}
+
+PerfGovernor::PerfGovernor(Settings initial) : current(initial) {
+}
+
+void PerfGovernor::setRefreshRates(std::vector<float> supported) {
+    rates = std::move(supported);
+    std::sort(rates.begin(), rates.end());
+
+    //start with the highest rate up to MAX_RATE, the load lowers it if needed
+    preferredRate = 0;
+    for (size_t i = 0; i < rates.size(); i++)
+        if (rates[i] <= MAX_RATE)
+            preferredRate = i;
+}
+
+void PerfGovernor::refreshRateChanged(float rate) {
+    current.refreshRate = rate;
+    lastRateChange = now;
+    lowLoadSince = -1;
+}
+
+void PerfGovernor::thermal(PerfDomain domain, Thermal level) {
+    thermals[(size_t) domain] = level;
+}
+
+PerfLevel PerfGovernor::ceiling(PerfDomain domain) const {
+    switch (thermals[(size_t) domain]) {
+        case Thermal::warning:
+            return PerfLevel::sustainedLow;
+        case Thermal::impaired:
+            return PerfLevel::powerSavings;
+        default:
+            return PerfLevel::boost;
+    }
+}
+
+size_t PerfGovernor::rateCeiling() const {
+    Thermal worst = std::max(thermals[0], thermals[1]);
+    if (worst == Thermal::impaired || rates.empty())
+        return 0;
+
+    if (worst == Thermal::normal)
+        return rates.size() - 1;
+
+    //on a warning at most 90 Hz, the rate the headsets are specified for at sustained levels
+    size_t highest = 0;
+    for (size_t i = 0; i < rates.size(); i++)
+        if (rates[i] <= 90)
+            highest = i;
+    return highest;
+}
+
+size_t PerfGovernor::idleRate() const {
+    for (size_t i = 0; i < rates.size(); i++)
+        if (rates[i] >= IDLE_RATE)
+            return i;
+    return rates.empty() ? 0 : rates.size() - 1;
+}
+
+bool PerfGovernor::update(double time, const Load &load) {
+    now = time;
+    if (load.playing)
+        lastPlaying = time;
+    bool idle = !load.playing && time - lastPlaying >= IDLE_DELAY;
+
+    //the load of the first frames after a rate change was measured at the old rate
+    bool measured = time - lastRateChange >= RATE_HOLD;
+    //and the same for a level change, the timings lag behind by a few seconds
+    bool hold = time - lastLevelChange < LEVEL_HOLD;
+    bool cpuHigh = measured && load.cpu > HIGH_LOAD * load.budget;
+    bool gpuHigh = measured && load.gpu > HIGH_LOAD * load.budget;
+    bool low = measured && load.cpu < LOW_LOAD * load.budget && load.gpu < LOW_LOAD * load.budget;
+    bool dense = load.playing && load.tiles >= DENSE_TILES;
+    if (!low)
+        lowLoadSince = -1;
+    else if (lowLoadSince < 0)
+        lowLoadSince = time;
+
+    //levels: the base of the state, one higher while over budget and back to the base once there is headroom,
+    //while paused the base whatever the load
+    const char *cause = idle ? "paused" : "playing";
+    PerfLevel base = idle ? PerfLevel::powerSavings : PerfLevel::sustainedHigh;
+    auto pick = [&](PerfLevel level, bool high, float ms) {
+        if (idle)
+            return base;
+        if (high)
+            return std::max(base, raised(level));
+        if (measured && ms < LOW_LOAD * load.budget)
+            return base;
+        return std::max(base, level);
+    };
+    Settings target = current;
+    target.cpu = pick(current.cpu, cpuHigh, load.cpu);
+    target.gpu = pick(current.gpu, gpuHigh, load.gpu);
+    if (dense) {
+        target.cpu = PerfLevel::boost;
+        cause = "dense passage";
+    }
+    if (!idle && (cpuHigh || gpuHigh))
+        cause = cpuHigh ? "cpu over budget" : "gpu over budget";
+
+    //refresh rate: lowered when a domain is over budget at its highest level, raised after a while of headroom
+    if (!rates.empty()) {
+        bool cpuMaxed = cpuHigh && !hold && current.cpu >= ceiling(PerfDomain::cpu);
+        bool gpuMaxed = gpuHigh && !hold && current.gpu >= ceiling(PerfDomain::gpu);
+        if (!idle && measured && (cpuMaxed || gpuMaxed) && preferredRate > 0) {
+            preferredRate--;
+            cause = "over budget at the highest level";
+        } else if (!idle && measured && lowLoadSince >= 0 && time - lowLoadSince >= RATE_HOLD &&
+                   preferredRate + 1 < rates.size() && rates[preferredRate + 1] <= MAX_RATE) {
+            preferredRate++;
+            lowLoadSince = time;
+            cause = "headroom";
+        }
+        size_t wanted = idle ? idleRate() : preferredRate;
+        if (rateCeiling() < wanted) {
+            wanted = rateCeiling();
+            cause = "thermal";
+        }
+        target.refreshRate = rates[wanted];
+    }
+
+    //thermal caps, raising to what the state needs at least and power saving once paused apply right away,
+    //other level changes not more often than LEVEL_HOLD
+    auto limit = [&](PerfLevel level, PerfLevel want, PerfLevel floor, PerfDomain domain) {
+        PerfLevel cap = ceiling(domain);
+        if (want > cap) {
+            want = cap;
+            cause = "thermal";
+        }
+        if (level > cap)
+            return cap;
+        return hold && !idle ? std::max(level, std::min(want, floor)) : want;
+    };
+    target.cpu = limit(current.cpu, target.cpu, dense ? PerfLevel::boost : base, PerfDomain::cpu);
+    target.gpu = limit(current.gpu, target.gpu, base, PerfDomain::gpu);
+
+    if (target == current)
+        return false;
+
+    if (target.cpu != current.cpu || target.gpu != current.gpu)
+        lastLevelChange = time;
+    if (target.refreshRate != current.refreshRate) {
+        lastRateChange = time;
+        lowLoadSince = -1;
+    }
+    current = target;
+    why = cause;
+    return true;
+}
+
+const PerfGovernor::Settings& PerfGovernor::settings() const {
+    return current;
+}
+
+const char* PerfGovernor::reason() const {
+    return why;
+}
+
+const char* PerfGovernor::name(PerfLevel level) {
+    static const char *names[(size_t) PerfLevel::NUM] = {"powerSavings", "sustainedLow", "sustainedHigh", "boost"};
+    return names[(size_t) level];
+}
+
+const char* PerfGovernor::name(Thermal level) {
+    static const char *names[] = {"normal", "warning", "impaired"};
+    return names[(size_t) level];
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Levels of XR_EXT_performance_settings, in the order of App::CpuLevel/GpuLevel.
+enum class PerfLevel : uint8_t {
+    powerSavings,
+    sustainedLow,
+    sustainedHigh,
+    boost,
+    NUM
+};
+
+// Notification levels of the thermal sub domain of XR_EXT_performance_settings.
+enum class Thermal : uint8_t {
+    normal,
+    warning,
+    impaired
+};
+
+enum class PerfDomain : uint8_t {
+    cpu,
+    gpu
+};
+
+// Picks the display refresh rate and the CPU/GPU performance levels from what a frame costs and what the app is
+// doing: power saving and IDLE_RATE while the song is paused, higher levels while playing and when the frames get close to
+// their budget, a lower refresh rate when even that doesn't suffice, and capped levels on thermal warnings.
+// Only policy, no OpenXR calls: the app feeds it the measured load and runtime events and applies what it picks,
+// Tools/GovernorSim replays scripted events through it on a host.
+class PerfGovernor {
+public:
+    struct Settings {
+        float refreshRate; //0 if it can't be changed
+        PerfLevel cpu, gpu;
+
+        bool operator==(const Settings &o) const {
+            return refreshRate == o.refreshRate && cpu == o.cpu && gpu == o.gpu;
+        }
+        bool operator!=(const Settings &o) const {
+            return !(*this == o);
+        }
+    };
+
+    //what the current frames cost, all times in milliseconds
+    struct Load {
+        float budget; //time of one frame at the current refresh rate
+        float cpu; //of the busier thread
+        float gpu; //0 if not measured
+        bool playing; //a song is playing
+        size_t tiles; //tiles on screen, how dense the passage is
+    };
+
+    static constexpr size_t DENSE_TILES = 2400; //tiles on screen from which the CPU is boosted, 12 notes per
+                                                //second along the 40 m lane at the default scroll speed
+    static constexpr float HIGH_LOAD = 0.85f; //of the budget, a domain's level is raised above
+    static constexpr float LOW_LOAD = 0.5f; //of the budget, the refresh rate is raised again below
+    static constexpr double IDLE_DELAY = 3; //seconds paused until power saving
+    static constexpr double LEVEL_HOLD = 3; //seconds at least between level changes, the load is measured anew
+    static constexpr double RATE_HOLD = 4; //seconds at least between refresh rate changes, the load is measured anew
+    static constexpr float MAX_RATE = 120; //highest refresh rate used while playing
+    static constexpr float IDLE_RATE = 72; //refresh rate while paused, 60 Hz flickers in passthrough
+
+    explicit PerfGovernor(Settings initial);
+
+    //refresh rates the display supports, empty if the rate can't be changed
+    void setRefreshRates(std::vector<float> rates);
+    //the runtime switched the refresh rate, also when it did so on its own
+    void refreshRateChanged(float rate);
+    void thermal(PerfDomain domain, Thermal level);
+
+    //once per frame, returns true if the settings changed and have to be applied
+    bool update(double time, const Load &load);
+    const Settings& settings() const;
+    const char* reason() const; //of the last change
+
+    static const char* name(PerfLevel level);
+    static const char* name(Thermal level);
+
+private:
+    PerfLevel ceiling(PerfDomain domain) const; //highest level the thermal state allows
+    size_t rateCeiling() const; //index of the highest refresh rate the thermal state allows
+    size_t idleRate() const; //index of the lowest rate from IDLE_RATE on
+
+    Settings current;
+    std::vector<float> rates; //sorted ascending
+    size_t preferredRate = 0; //index of the rate used while playing, lowered while over budget
+    Thermal thermals[2] = {Thermal::normal, Thermal::normal};
+
+    double now = 0; //time of the last update
+    double lastPlaying = -IDLE_DELAY; //time the song was last seen playing
+    double lastLevelChange = -LEVEL_HOLD, lastRateChange = -RATE_HOLD;
+    double lowLoadSince = -1; //time since which both domains have been below LOW_LOAD, -1 if they aren't
+    const char *why = "initial";
+};
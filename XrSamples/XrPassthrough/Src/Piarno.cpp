@@ -2,18 +2,26 @@
 // Created by JW on 24/06/2022.
 //
 
-#include <sstream>
+#include <algorithm>
+#include <cstdio>
 
 #include "Piarno.h"
 #include "Engine.h"
 #include "XrPassthroughGl.h"
+#include "songs/bundle.h"
 
 using namespace global;
 
 void Piarno::init() {
     buildPiano();
 
-    loadMidi(0);
+    //an invalid bundle leaves the song list empty, loadSong then loads an empty song
+    if (!bundle.open(songBundle, sizeof(songBundle)))
+        log("[DEBUG/Piarno] Invalid song bundle");
+    for (size_t i = 0; i < bundle.size(); i++)
+        songs.push_back(bundle.name(i));
+
+    loadSong(0);
     createTiles();
 
     /// Build UI
@@ -45,7 +53,7 @@ void Piarno::init() {
     timeline.min = 0.0;
     timeline.max = 0.5;
     timeline.minVal = 0;
-    timeline.maxVal = midi.getFileDurationInSeconds() + waitTimeBegin;
+    timeline.maxVal = songDuration + waitTimeBegin;
     timeline.set(currentTime);
     pianoScene.attach(timeline);
 
@@ -99,67 +107,68 @@ void Piarno::init() {
     toggleOutline.label = "ALIGN";
     toggleOutline.labelRot = -M_PI/2;
     pianoScene.attach(toggleOutline);
+
+    off.z += 0.1;
+    toggleStats.geometry = engine->getGeometry(Mesh::cube);
+    toggleStats.pos = origin + off;
+    toggleStats.scl = vec3{0.03, 0.02, 0.03};
+    toggleStats.col = color{0, 0, 150, 255};
+    toggleStats.pressCol = color{0, 0, 100, 255};
+    toggleStats.label = "STATS";
+    toggleStats.labelRot = -M_PI/2;
+    pianoScene.attach(toggleStats);
+
+    for (Button *b : std::initializer_list<Button*>{&pauseButton, &timeline, &songListScroll, &playbackSpeed,
+                                                   &scrollSpeed, &toggleOutline, &toggleStats})
+        contacts.add(*b);
 }
 
 
 void Piarno::update() {
     //buttons and UI
     const auto &controllers = engine->getControllers();
-    pauseButton.update(controllers);
-    timeline.update(controllers);
-    scrollSpeed.update(controllers);
-    playbackSpeed.update(controllers);
-    toggleOutline.update(controllers);
-    songListScroll.update(controllers);
-
-    if (pauseButton.isPressed())
-        isPaused = !isPaused;
-
-    // make the pauseButton either red or green displaying the current `isPaused` state
-    if (isPaused) {
-        pauseButton.col = color{255, 0, 0, pauseButton.col.a()};
-        pauseButton.label = "PLAY";
-    } else {
-        pauseButton.col = color{0, 255, 0, pauseButton.col.a()};
-        pauseButton.label = "PAUSE";
+    contacts.update(controllers);
+
+    auto &clock = engine->getClock();
+    if (pauseButton.isPressed()) {
+        if (clock.isPaused())
+            clock.resume();
+        else
+            clock.pause();
     }
 
     if (timeline.isBeingPressed()) {
-        isPaused = true;
-        currentTime = timeline.get();
-    }
-    else {
-        timeline.set(currentTime);
+        clock.pause();
+        clock.seek(timeline.get());
     }
 
-    int sec = floor(currentTime);
-    std::stringstream t;
-    t << std::setfill('0') << std::setw(2) << (sec / 60) << ":"
-      << std::setfill('0') << std::setw(2) << (sec % 60);
-    timeline.label = t.str();
+    // make the pauseButton either red or green displaying the current paused state
+    bool paused = clock.isPaused();
+    pauseButton.col.r() = paused ? 255 : 0;
+    pauseButton.col.g() = paused ? 0 : 255;
+    pauseButton.col.b() = 0;
+    pauseButton.label = paused ? "PLAY" : "PAUSE";
 
     if(playbackSpeed.isReleased()) { //round to 0.25, 0.5, ..., 2.0
         playbackSpeed.set(round(playbackSpeed.get() * 4) / 4);
     }
 
-    std::stringstream s;
-    s << "X" << std::fixed << std::setprecision(2) << playbackSpeed.get();
-    playbackSpeed.label = s.str();
+    //labels are short enough to stay in the strings' inline buffer, so formatting them does not allocate
+    char text[16];
+    snprintf(text, sizeof(text), "X%.2f", playbackSpeed.get());
+    playbackSpeed.label = text;
 
     if(toggleOutline.isPressed())
         pianoOutline.show = !pianoOutline.show;
 
-    if(songListScroll.isReleased()) {
-        songListScroll.set(round(songListScroll.get()));
-        loadMidi((size_t) round(songListScroll.get()));
-        createTiles();
-        currentTime = 0;
-        isPaused = true;
-        timeline.minVal = 0;
-        timeline.maxVal = midi.getFileDurationInSeconds() + waitTimeBegin;
-        timeline.set(currentTime);
+    if(toggleStats.isPressed()) {
+        showStats = !showStats;
+        statsRefreshed = -STATS_PERIOD; //show the current timings right away
     }
 
+    if(songListScroll.isReleased())
+        selectSong((size_t) round(songListScroll.get()));
+
     //set piano position with controller
     auto ctrlL = controllers[0].pos;
     auto ctrlR = controllers[1].pos;
@@ -169,28 +178,58 @@ void Piarno::update() {
         pianoScene.rot.y = atan2(ctrlR.x - ctrlL.x, ctrlR.z - ctrlL.z) - M_PI/2;
     }
 
+    //keys played with the fingers, right where the piano is this frame
+    keyContacts.update(pianoScene, &controllers[Engine::FIRST_FINGERTIP], Engine::FINGERTIPS);
+
     //update time and tiles
-    if(!isPaused)
-        currentTime = std::min(currentTime + 1.0 / 72.0 * playbackSpeed.get(),
-                               midi.getFileDurationInSeconds() + waitTimeBegin);
+    clock.setSpeed(playbackSpeed.get());
+    currentTime = clock.now();
+    if (!timeline.isBeingPressed())
+        timeline.set(currentTime);
+
+    int sec = floor(currentTime);
+    snprintf(text, sizeof(text), "%02d:%02d", sec / 60, sec % 60);
+    timeline.label = text;
 
+    matchNotes();
     updateTiles();
 }
 
 
 void Piarno::render() {
+    mat4 sceneTrans = pianoScene.transform();
+
+    static const std::string welcome = "WELCOME TO", title = "PIARNO";
+    static const color welcomeColor{200, 200, 200, 255}, titleColor{50, 50, 50, 255};
+
     auto &mid = pianoKeys[pianoKeys.size()/2];
-    engine->renderText("WELCOME TO",
-                       mid.globalPos(mid.pos + vec3{0, 1.35f + sin(engine->getFrame() / 72.0f) * 0.05f, -2}),
+    engine->renderText(welcome,
+                       sceneTrans.Transform(mid.pos + vec3{0, 1.35f + (float) sin(engine->getClock().displayTime()) * 0.05f, -2}),
                        vec3{0.27, 0.3, 0.3},
                        pianoScene.rot,
-                       color{200, 200, 200, 255});
+                       welcomeColor);
 
-    engine->renderText("PIARNO",
-                       mid.globalPos(mid.pos + vec3{0, 1 + sin(engine->getFrame() / 72.0f) * 0.05f, -2}),
+    engine->renderText(title,
+                       sceneTrans.Transform(mid.pos + vec3{0, 1 + (float) sin(engine->getClock().displayTime()) * 0.05f, -2}),
                        vec3{0.5, 0.5, 0.3},
                        pianoScene.rot,
-                       color{50, 50, 50, 255});
+                       titleColor);
+
+    //piano keys in one instanced draw, white keys first (for translucent render ordering!)
+    auto keyBatch = engine->getBatch(Mesh::rectGradient);
+    for (bool black : {false, true}) {
+        for (int i = 0; i < numKeys; i++) {
+            auto &k = pianoKeys[i];
+            if (isBlack(i) != black)
+                continue;
+            color_t rgba[4] = {k.col.r(), k.col.g(), k.col.b(), 255}; //alpha comes from the mesh gradient
+            keyBatch->add(sceneTrans * k.transform(), rgba);
+        }
+    }
+    keyBatch->render();
+
+    //tiles inside the active window in one instanced draw, updateTiles already added them
+    engine->getBatch(Mesh::rect)->render();
 
     pianoScene.render();
 
@@ -205,12 +244,58 @@ void Piarno::render() {
 
             color_t a = (1 - std::min(std::abs(songListScroll.get() - i) / (songListScroll.max / height / 1.5f), 1.0f)) * 255;
             if (0 < a) {
-                color c = i == round(songListScroll.get()) ?
-                        color{50, 176, 255, a} : color{255, 255,255, a};
-                engine->renderText(s, listPos, size, rot, c);
+                bool selected = i == round(songListScroll.get());
+                songColor.r() = selected ? 50 : 255;
+                songColor.g() = selected ? 176 : 255;
+                songColor.b() = 255;
+                songColor.a() = a;
+                engine->renderText(s, listPos, size, rot, songColor);
             }
         }
     }
+
+    if (showStats)
+        renderStats();
+}
+
+void Piarno::renderStats() {
+    auto &profiler = engine->getProfiler();
+    float budget = profiler.budget();
+
+    //a new text is a new mesh, so the lines only change once per period, not with every update of the timings
+    double now = engine->getClock().displayTime();
+    if (now - statsRefreshed >= STATS_PERIOD || now < statsRefreshed) {
+        statsRefreshed = now;
+
+        char text[48];
+        snprintf(text, sizeof(text), "BUDGET %.1f  P50 P90 P99", budget);
+        statsLines[0].assign(text);
+        statsOverBudget[0] = false;
+        for (size_t i = 0; i < (size_t) Timer::NUM; i++) {
+            auto s = profiler.stats((Timer) i);
+            snprintf(text, sizeof(text), "%s %.1f %.1f %.1f", Profiler::name((Timer) i), s.p50, s.p90, s.p99);
+            statsLines[i + 1].assign(text);
+            //the frame interval is always about one budget, it is over when frames were dropped
+            statsOverBudget[i + 1] = s.p90 > budget * ((Timer) i == Timer::frame ? 1.5f : 1.0f);
+        }
+        size_t line = (size_t) Timer::NUM + 1;
+        snprintf(text, sizeof(text), "uploads %u %.1f KB", profiler.count(Counter::uploads),
+                 profiler.count(Counter::uploadedBytes) / 1024.0f);
+        statsLines[line].assign(text);
+        statsOverBudget[line] = false;
+        snprintf(text, sizeof(text), "draws %u prg %u vao %u", profiler.count(Counter::draws),
+                 profiler.count(Counter::programChanges), profiler.count(Counter::vaoChanges));
+        statsLines[line + 1].assign(text);
+        statsOverBudget[line + 1] = false;
+    }
+
+    static const color normal{255, 255, 255, 220}, overBudget{255, 60, 60, 255};
+    const mat4 &sceneTrans = pianoScene.transform();
+    for (size_t i = 0; i < statsLines.size(); i++) {
+        vec3 p = sceneTrans.Transform(vec3{0.65, 0.3f - i * 0.03f, 0.3});
+        engine->renderText(statsLines[i], p, vec3{0.015, 0.015, 0.015}, pianoScene.rot,
+                           statsOverBudget[i] ? overBudget : normal, false);
+    }
 }
 
 
@@ -228,11 +313,17 @@ void Piarno::buildPiano() {
 
     pianoKeys.resize(numKeys);
 
+    //keys are rendered instanced: the alpha gradient is stored in the mesh and multiplied with the key color
+    auto keyGeometry = engine->getGeometry(Mesh::rectGradient);
+    color gradient{255, 255, 255, 50, keyGeometry};
+    gradient.a(0) = gradient.a(1) = 230; //make top parts more solid
+    keyGeometry->uploadColors(gradient.data(), gradient.size());
+
     float x = 0;
 
     for (int i = 0; i < numKeys; i++) {
         auto &k = pianoKeys[i];
-        k.geometry = engine->getGeometry(Mesh::rectGradient);
+        k.geometry = keyGeometry;
 
         k.rot = vec3{M_PI / 2, 0, 0};
 
@@ -240,137 +331,140 @@ void Piarno::buildPiano() {
         {
             k.pos = vec3{x, 0, 0};
             k.scl = vec3{widthWhite - gap, heightWhite, 1};
-            k.col = color{255, 255, 255, 50, k.geometry};
-            k.col.a(0) = k.col.a(1) = 230; //make top parts more solid
+            k.col = color{255, 255, 255, 255};
 
             x += widthWhite;
-
-            pianoScene.attach(k); //attach white keys first (for translucent render ordering!)
         } else //black key
         {
             k.pos = vec3{x - widthWhite / 2 + keyOffset[(i + offset) % 12], blackHover, - heightWhite/2 + heightBlack/2};
             k.scl = vec3{widthBlack - gap, heightBlack, 1};
-            k.col = color{0, 0, 0, 50, k.geometry};
-            k.col.a(0) = k.col.a(1) = 230; //make top parts more solid
+            k.col = color{0, 0, 0, 255};
         }
     }
 
-    //attach black keys after white keys
-    for (int i = 0; i < numKeys; i++) {
-        auto &k = pianoKeys[i];
-        if (isBlack(i)) //black key
-            pianoScene.attach(k);
-    }
-
     //center
     float width = x;
     for(auto &k : pianoKeys) {
         k.pos.x -= width/2;
     }
+
+    keyContacts.setKeys(pianoKeys);
 }
 
 void Piarno::createTiles() {
-    // count the total number of key presses events (=notes being played)
-    int keyPressNum = 0;
-    for (int i = 0; i < midi.getNumEvents(0); i++) {
-        int command = midi[0][i][0];
-        int velocity = midi[0][i][2];
-        if (command == 0x90 && velocity > 0) {
-            keyPressNum++;
-        }
-    }
-    // TODO: cleanup after debugging
-    log("[DEBUG/Piarno] Number of notes in this song: " + std::to_string(keyPressNum));
-
-    //clean up previously loaded tiles from scene
-    for(auto &t : allTiles)
-        pianoScene.detach(&t.tile);
-
-    allTiles = std::vector<Tile>(keyPressNum);
-    trackToIndex = std::unordered_map<int, size_t>();
+    tiles.clear();
+    trackToIndex.clear();
 
-    std::vector<Tile *> currentTile(numKeys,nullptr); //"currently" (within the below loop) active tile
+    bool loaded = currentSong < bundle.size();
+    const bundle::BundleNote *notes = loaded ? bundle.notes(currentSong) : nullptr;
+    size_t noteCount = loaded ? bundle.noteCount(currentSong) : 0;
+    tiles.reserve(noteCount);
+    std::vector<uint8_t> tracks; //of each tile, the score tells the hands apart by them
+    tracks.reserve(noteCount);
 
-    int k = 0; //current key press
-    for (int i = 0; i < midi.getNumEvents(0); i++) {
-        int command = midi[0][i][0];
-        int key = midi[0][i][1] - offset;
-        int velocity = midi[0][i][2];
+    //notes are already paired and sorted by start time
+    for (size_t i = 0; i < noteCount; i++) {
+        auto &n = notes[i];
+        int key = n.key - offset;
 
         // this key is out of range for the active piano
         if (key < 0 || key >= numKeys) {
             continue;
         }
 
-        if (command == 0x90 && velocity > 0) {
-            // key press
-//            log("[DEBUG/Piarno] Detected keypress for tile k=" + std::to_string(k) +
-//                " at piano key: " + std::to_string(key) + " with vel = " + std::to_string(velocity));
-            allTiles[k].startTime = midi[0][i].seconds + waitTimeBegin;
-            allTiles[k].key = key;
-            currentTile[key] = &allTiles[k]; //register the currently active tile for this lane
-            k++;
-        } else if (command == 0x80 || command == 0x90 && velocity == 0) {
-            // key release
-//            log("MIDI LOAD: TRACK = "+std::to_string(midi[0][i].track));
-
-            //assign index to track
-            auto [it, isNew] = trackToIndex.try_emplace(midi[0][i].track, trackToIndex.size());
-            size_t track = it->second % (tileColor.size()/2);
-
-            if (currentTile[key] == nullptr) {
-                log("[DEBUG/Piarno] Detected key release for a key that was already released with number: " +
-                    std::to_string(key) + " and time " + std::to_string(midi[0][i].seconds + waitTimeBegin));
-                continue;
-            } else
-//                log("[DEBUG/Piarno] Detected key release for at piano key: " + std::to_string(key) +
-//                    " with time " + std::to_string(midi[0][i].seconds));
-
-            currentTile[key]->endTime = midi[0][i].seconds + waitTimeBegin;
-
-            // draw the tile
-            auto &tile = currentTile[key]->tile;
-            tile.geometry = engine->getGeometry(Mesh::rect);
-            tile.pos = pianoKeys[key].pos; //z will be set every frame based on current time
-            tile.rot = vec3{M_PI / 2, 0, 0};
-            tile.scl = vec3{(isBlack(key) ? widthBlack : widthWhite) - gap, 1, 1}; //height will be updated
-
-            if(isBlack(key)) {
-                tile.pos.y = blackHover - keyPressDepth; //float above keys
-                tile.col = tileColor[2*track + 1];
-            }
-            else {
-                tile.pos.y = -keyPressDepth;
-                tile.col = tileColor[2*track];
-            }
-            tile.col.a() = 191 + velocity / 2; //velocity goes from 0 to 128
+        //assign index to track
+        auto [it, isNew] = trackToIndex.try_emplace(n.track, trackToIndex.size());
+        tracks.push_back(std::min<size_t>(it->second, 255));
+        size_t track = it->second % (tileColor.size()/2);
+
+        //black tiles float above the keys, z and length are laid out every frame based on current time
+        bool black = isBlack(key);
+        tiles.add(n.start + waitTimeBegin, n.end + waitTimeBegin, key,
+                  pianoKeys[key].pos.x,
+                  black ? blackHover - keyPressDepth : -keyPressDepth,
+                  (black ? widthBlack : widthWhite) - gap,
+                  2*track + black,
+                  191 + n.velocity / 2); //velocity goes from 0 to 128
+    }
 
-            pianoScene.attach(tile);
+    log("[DEBUG/Piarno] Number of notes in this song: " + std::to_string(tiles.size()));
 
-            // release the placeholder indicating that there is no more key played at [key] index
-            currentTile[key] = nullptr;
+    //only the active window gets updated and rendered, the tile batch never needs more room than all tiles
+    activeBegin = activeEnd = 0;
+    engine->getBatch(Mesh::rect)->instances.reserve(tiles.size());
 
-        } else {
-            // ignore any other event
-            continue;
+    score.setSong(tiles, tracks, numKeys, currentSong);
+    matchedTime = 0;
+}
+
+void Piarno::scheduleTiles(double from, double to) {
+    //both bounds are monotonic in time, so search forward from the cursor when playing
+    //and only search the part before it when scrubbing backwards
+    auto &endMax = tiles.endMax;
+    auto hasEnded = [from](float end) { return end <= from; };
+    if(activeBegin > 0 && !hasEnded(endMax[activeBegin - 1]))
+        activeBegin = std::partition_point(endMax.begin(), endMax.begin() + activeBegin, hasEnded) - endMax.begin();
+    else
+        activeBegin = std::partition_point(endMax.begin() + activeBegin, endMax.end(), hasEnded) - endMax.begin();
+
+    auto &start = tiles.start;
+    auto hasStarted = [to](float begin) { return begin <= to; };
+    if(activeEnd > 0 && !hasStarted(start[activeEnd - 1]))
+        activeEnd = std::partition_point(start.begin(), start.begin() + activeEnd, hasStarted) - start.begin();
+    else
+        activeEnd = std::partition_point(start.begin() + activeEnd, start.end(), hasStarted) - start.begin();
+
+    activeEnd = std::max(activeBegin, activeEnd);
+}
+
+void Piarno::matchNotes() {
+    //scrubbing or going back makes the tiles from there on playable again
+    if (currentTime < matchedTime || (timeline.isBeingPressed() && currentTime != matchedTime))
+        score.seek(currentTime);
+
+    //presses are matched at the song time they were played, which is before this frame is seen
+    auto &clock = engine->getClock();
+    for (auto &note : engine->getPlayedNotes()) {
+        int key = note.key - offset;
+        if (note.isPress())
+            score.press(key, clock.songTimeAtDisplay(note.time));
+        else
+            score.release(key, clock.songTimeAtDisplay(note.time));
+    }
+    //keys played on the overlay sound, a MIDI keyboard makes its own sound
+    auto &synth = engine->getSynth();
+    for (int k = 0; k < numKeys; k++) {
+        if (keyContacts.isPressed(k)) {
+            score.press(k, currentTime);
+            synth.press(k + offset, 96);
+        } else if (keyContacts.isReleased(k)) {
+            score.release(k, currentTime);
+            synth.release(k + offset);
         }
     }
+
+    score.advance(currentTime);
+    matchedTime = currentTime;
 }
 
 void Piarno::updateTiles() {
-    keyHighlight.assign(numKeys, 0.0f);
-    std::vector<Object*> closestTile(numKeys, nullptr); //ptr to closest tile per key (including currently pressed)
+    auto &arena = engine->getArena();
+    float *keyHighlight = arena.allocate(numKeys, 0.0f); //highlight value for each key for incoming/current key
+    const color **closestTile = arena.allocate<const color*>(numKeys, nullptr); //color of closest tile per key (including currently pressed)
 
-    for(auto &[tile, key, start, end] : allTiles) {
-        float startDist = distFromTime(start - currentTime); //distance in meters to start pos
-        float endDist = distFromTime(end - currentTime); //distance in meters to end pos
+    scheduleTiles(currentTime, currentTime + laneLength / scrollSpeed.get());
 
-        tile.show = endDist > 0; //don't render if tile is already in the past
-        if(!tile.show)
-            continue;
+    //lay out the tiles of the window, the ones that haven't ended go straight into the tile batch
+    size_t count = activeEnd - activeBegin;
+    float *startDists = arena.allocate<float>(count), *endDists = arena.allocate<float>(count); //distance in meters to start/end pos
+    tiles.update(activeBegin, activeEnd, currentTime, scrollSpeed.get(), -heightWhite / 2, pianoScene.transform(),
+                 tileColor, startDists, endDists, *engine->getBatch(Mesh::rect));
 
-        tile.scl.y = std::max(0.0f, endDist) - std::max(0.0f, startDist); //tile length
-        tile.pos.z = -heightWhite / 2 - (std::max(0.0f, startDist) + tile.scl.y / 2); //center of tile
+    for(size_t i = 0; i < count; i++) {
+        float startDist = startDists[i], endDist = endDists[i];
+        if(endDist <= 0) //tile is already in the past
+            continue;
+        int key = tiles.key[activeBegin + i];
 
         //highlight keys depending on its key press time
         float highlightStart = distFromTime(1); //start shadow 1 second before press
@@ -382,16 +476,20 @@ void Piarno::updateTiles() {
 
         //this assumes the tiles are sorted by time
         if(!closestTile[key]) {
-            closestTile[key] = &tile;
+            closestTile[key] = &tileColor[tiles.colorIndex[activeBegin + i]];
         }
     }
 
     //apply highlight (turn red & press down)
     for(int k=0; k<numKeys; k++) {
-        float h = std::max(0.0f, keyHighlight[k]);
+        //played keys (with a finger or on a MIDI keyboard) are fully pressed down, green if they played a tile
+        auto &matcher = score.matcher();
+        bool played = matcher.isHeld(k);
+        float h = played ? 1 : std::max(0.0f, keyHighlight[k]);
         auto &c = pianoKeys[k].col;
 
-        color t = closestTile[k] ? closestTile[k]->col : color{255, 0, 0, 255}; //target color
+        static const color noTile{255, 0, 0, 255}, hitTile{0, 255, 96, 255};
+        const color &t = played ? (matcher.isHit(k) ? hitTile : noTile) : closestTile[k] ? *closestTile[k] : noTile; //target color
         vec3 rgb = (isBlack(k) ? vec3{0,0,0} : vec3{255, 255, 255}) * (1-h) + vec3{(float)t.r(), (float)t.g(), (float)t.b()} * h;
         c.setAll(R, color_t(rgb.x));
         c.setAll(G, color_t(rgb.y));
@@ -406,171 +504,57 @@ float Piarno::distFromTime(double time) {
 }
 
 
-void Piarno::loadMidi(int i) {
-    std::stringstream file;
+size_t Piarno::songCount() const {
+    return songs.size();
+}
 
-    switch(i) {
-        case 0:
-        {
-#include "songs/canon.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 1:
-        {
-#include "songs/ac_2am.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 2:
-        {
-#include "songs/sweden1.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 3:
-        {
-#include "songs/twinkle.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 4:
-        {
-#include "songs/supermario.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 5:
-        {
-#include "songs/hittheroad.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 6:
-        {
-#include "songs/gymnopedie.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 7:
-        {
-#include "songs/elise.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 8:
-        {
-#include "songs/jacque.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 9:
-        {
-#include "songs/ode.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 10:
-        {
-#include "songs/heartnsoul1.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 11:
-        {
-#include "songs/heartnsoul2.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 12:
-        {
-#include "songs/coffin_dance.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 13:
-        {
-#include "songs/wet_hands.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 14:
-        {
-#include "songs/sweden2.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 15:
-        {
-#include "songs/spring.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 16:
-        {
-#include "songs/winter.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 17:
-        {
-#include "songs/game_of_thrones.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 18:
-        {
-#include "songs/minuet.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 19:
-        {
-#include "songs/beethoven.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 20:
-        {
-#include "songs/fairy_tail.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 21:
-        {
-#include "songs/river_flows.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 22:
-        {
-#include "songs/amelie.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 23:
-        {
-#include "songs/name_of_love.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 24:
-        {
-#include "songs/imagine.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 25:
-        {
-#include "songs/winner_takes_it_all.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 26:
-        {
-#include "songs/over_the_rainbow.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 27:
-        {
-#include "songs/paradise.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 28:
-        {
-#include "songs/let_her_go.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 29:
-        {
-#include "songs/take_on_me.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
-        case 30:
-        {
-#include "songs/hp.h"
-            file.str(std::string(bytes, bytes + sizeof(bytes)));
-        } break;
+void Piarno::selectSong(size_t i) {
+    songListScroll.set(i);
+    loadSong(i);
+    createTiles();
+
+    auto &clock = engine->getClock();
+    clock.pause();
+    clock.seek(0);
+    timeline.minVal = 0;
+    timeline.maxVal = songDuration + waitTimeBegin;
+}
+
+size_t Piarno::activeTiles() const {
+    return activeEnd - activeBegin;
+}
+
+const KeyContacts& Piarno::getKeyContacts() const {
+    return keyContacts;
+}
+
+int Piarno::keyOffset() const {
+    return offset;
+}
+
+const ScoreKeeper& Piarno::getScore() const {
+    return score;
+}
+
+void Piarno::setSessionLog(SessionLog *log) {
+    score.setLog(log);
+}
+
+void Piarno::loadSong(size_t i) {
+    if (i >= bundle.size()) {
+        //no such song (or no valid bundle): nothing to play, createTiles makes no tiles
+        currentSong = i;
+        songDuration = 0;
+        engine->getClock().setEnd(waitTimeBegin);
+        engine->getSynth().setSong(nullptr, 0, waitTimeBegin);
+        log("[DEBUG/Piarno] No song " + std::to_string(i) + " in the bundle");
+        return;
     }
 
-    midi = smf::MidiFile(file);
-    //midi.absoluteTicks();
-    midi.joinTracks();
-    midi.doTimeAnalysis();
+    currentSong = i;
+    songDuration = bundle.duration(i);
+    engine->getClock().setEnd(songDuration + waitTimeBegin);
+    engine->getSynth().setSong(bundle.notes(i), bundle.noteCount(i), waitTimeBegin);
 
-    log("[DEBUG/Piarno] LOADED MIDI FILE " + (songs[i]));
+    log("[DEBUG/Piarno] LOADED SONG " + songs[i]);
 }
@@ -5,51 +5,16 @@
 
 #include "Global.h"
 #include "Object.h"
-#include "midi/MidiFile.h"
+#include "SongBundle.h"
+#include "TileStore.h"
+#include "ContactGrid.h"
+#include "KeyContacts.h"
+#include "ScoreKeeper.h"
+#include "Profiler.h"
+#include <array>
+#include <string>
 #include <unordered_map>
 
-const std::vector<std::string> songs = {
-    "Canon",
-    "2AM",
-    "Sweden",
-    "Twinkle",
-    "Supermario",
-    "Hit the Road Jack",
-    "Gymnopedie No.2",
-    "Fuer Elise",
-    "Jacque",
-    "Ode to Joy",
-    "Heart n Soul 1",
-    "Heart n Soul 2",
-    "Coffin Dance",
-    "Wet Hands",
-    "Sweden  I Easy I",
-    "Four Seasons Spring",
-    "Four Seasons Winter",
-    "Game of Thrones",
-    "Minuet in F Major",
-    "Beethoven 7th Symphony",
-    "Fairy Tail",
-    "River Flows in You",
-    "Amelie Theme",
-    "In the Name of Love",
-    "Imagine",
-    "The Winner Takes It All",
-    "Somewhere over the Rainbow",
-    "Paradise",
-    "Let Her Go",
-    "Take On Me",
-    "Harry Potter"
-};
-
-// Represents a falling tile of a note for song visualization
-struct Tile {
-    Object tile;
-    int key; //key index of this tile
-    double startTime; //timestamp of this note start
-    double endTime; //timestamp of this note end
-};
-
 class Piarno {
 public:
     void init();
@@ -60,18 +25,37 @@ public:
     //run once per frame to render
     void render();
 
+    //songs of the song list, selecting one loads it paused at the beginning (same as the song list does)
+    size_t songCount() const;
+    void selectSong(size_t index);
+
+    //tiles on screen this frame, how dense the song is around the current time
+    size_t activeTiles() const;
+
+    //piano keys pressed by the fingertips this frame, indices are keys of the overlay (MIDI key - offset)
+    const KeyContacts& getKeyContacts() const;
+    int keyOffset() const;
+
+    //the played notes paired with the tiles of the current song, and how well they were played
+    const ScoreKeeper& getScore() const;
+    void setSessionLog(SessionLog *log); //where the score of every note is written, nullptr for none
+
 private:
     //internal helpers
     bool isBlack(int index);
     void buildPiano();
-    void loadMidi(int index);
+    void loadSong(size_t index);
     void createTiles();
     void updateTiles();
+    void scheduleTiles(double from, double to);
+    void matchNotes();
     float distFromTime(double time);
 
     //piano overlay
     ObjectGroup pianoScene;
+    ContactGrid contacts{pianoScene}; //the buttons and sliders attached to pianoScene
     std::vector<Object> pianoKeys;
+    KeyContacts keyContacts; //keys pressed by the fingertips
     //int numKeys = 49, offset = 24+12;
     int numKeys = 88, offset = 12-3;
     float widthWhite = 0.0236, widthBlack = 0.011;
@@ -80,8 +64,9 @@ private:
     float overlayOpacity = 0.6;
 
     //song visualization
-    std::vector<Tile> allTiles; //tile objects and their start time in seconds
-    std::vector<float> keyHighlight; //highlight value for each key for incoming/current key
+    TileStore tiles; //falling tiles of the notes, sorted by start time
+    size_t activeBegin = 0, activeEnd = 0; //window [begin, end) of tiles that may be visible at currentTime
+    float laneLength = 40; //tiles further away than this (in meters) are narrower than a pixel, they are not laid out
     std::vector<color> tileColor {
         color{0, 228, 255, 255}, //cyan - track 0 white
         color{0, 188, 215, 255}, //darker cyan - track 0 black
@@ -95,18 +80,38 @@ private:
     std::unordered_map<int, size_t> trackToIndex;
     float keyPressDepth = blackHover - 0.001;
 
+    //notes played on a MIDI keyboard or with the fingers, paired with the tiles and scored
+    ScoreKeeper score;
+    double matchedTime = 0; //song time of the last frame the score advanced to
+
+    //songs, pre-parsed into notes by Tools/SongBundler
+    SongBundle bundle;
+    std::vector<std::string> songs; //titles in menu order
+    size_t currentSong = 0;
+    double songDuration = 0; //in seconds
+
     //playback & UI
-    smf::MidiFile midi;
-    double currentTime = 0, waitTimeBegin = 3;
+    double currentTime = 0, waitTimeBegin = 3; //currentTime is the song time at which this frame is seen
     Slider playbackSpeed{0.25, 1, 2}; //min default max
     Slider timeline;
     Slider songListScroll;
 
-    bool isPaused = true;
     Button pauseButton;
     Slider scrollSpeed{0.05, 0.2, 2}; //min default max of tile velocity, meters per second
 
     Object pianoOutline; //to help aligning
     Button toggleOutline;
+
+    //frame timings next to the right control panel
+    Button toggleStats;
+    bool showStats = false;
+    static constexpr size_t STATS_LINES = (size_t) Timer::NUM + 3;
+    static constexpr double STATS_PERIOD = 1; //seconds between refreshes of the text
+    double statsRefreshed = -STATS_PERIOD; //display time of the last refresh
+    std::array<std::string, STATS_LINES> statsLines; //reformatted in place, their buffers are reused
+    std::array<bool, STATS_LINES> statsOverBudget{};
+    void renderStats();
+
+    color songColor{255, 255, 255, 255}; //of the song list entries, changed while drawing them
 };
 
@@ -0,0 +1,78 @@
+#include "PlaybackClock.h"
+
+#include <algorithm>
+
+void PlaybackClock::tick(double displayTime) {
+    if (firstDisplay < 0)
+        firstDisplay = displayTime;
+    //the runtime never predicts backwards, but don't let a bad value move the song back
+    display = std::max(display, displayTime - firstDisplay);
+}
+
+void PlaybackClock::pause() {
+    if (paused)
+        return;
+    rebase();
+    paused = true;
+}
+
+void PlaybackClock::resume() {
+    if (!paused)
+        return;
+    rebase();
+    paused = false;
+}
+
+bool PlaybackClock::isPaused() const {
+    return paused;
+}
+
+void PlaybackClock::seek(double songTime) {
+    anchorDisplay = display;
+    anchorSong = std::min(songTime, end);
+}
+
+void PlaybackClock::setSpeed(double s) {
+    if (s == speed)
+        return;
+    rebase();
+    speed = s;
+}
+
+double PlaybackClock::getSpeed() const {
+    return speed;
+}
+
+void PlaybackClock::setEnd(double songTime) {
+    rebase();
+    end = songTime;
+    anchorSong = std::min(anchorSong, end);
+}
+
+double PlaybackClock::now() const {
+    return songTimeAt(display);
+}
+
+double PlaybackClock::displayTime() const {
+    return display;
+}
+
+double PlaybackClock::songTimeAtDisplay(double time) const {
+    //the player sees song time songTimeAt(t) at time t, now() is that for the time the current frame is seen
+    return songTimeAt(time - firstDisplay);
+}
+
+double PlaybackClock::speedAtDisplay(double time) const {
+    return paused || songTimeAtDisplay(time) >= end ? 0 : speed;
+}
+
+double PlaybackClock::songTimeAt(double time) const {
+    if (paused)
+        return anchorSong;
+    return std::min(anchorSong + (time - anchorDisplay) * speed, end);
+}
+
+void PlaybackClock::rebase() {
+    anchorSong = now();
+    anchorDisplay = display;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+// Song clock driven by the predicted display time of each frame, so playback follows real time at any
+// refresh rate and across dropped frames.
+//
+// The song time is kept as an anchor (song time at a display time) that only moves when the playback
+// state changes, so it does not accumulate per-frame error.
+class PlaybackClock {
+public:
+    //run once per frame with the predicted display time of the frame, in seconds
+    void tick(double displayTime);
+
+    void pause();
+    void resume();
+    bool isPaused() const;
+
+    //jump to a song time, keeps the paused state
+    void seek(double songTime);
+
+    //rate of song time per real time, 1 is normal speed
+    void setSpeed(double speed);
+    double getSpeed() const;
+
+    //song time at which playback stops advancing
+    void setEnd(double songTime);
+
+    //song time at which the current frame is seen (the "note time at photon")
+    double now() const;
+
+    //display time of the current frame, in seconds since the first frame
+    double displayTime() const;
+
+    //song time seen at a display time given like to tick(), for input that is time stamped (a played note)
+    double songTimeAtDisplay(double displayTime) const;
+    //song seconds per second at a display time given like to tick(): 0 while paused and once at the end
+    double speedAtDisplay(double displayTime) const;
+
+private:
+    double songTimeAt(double time) const;
+    void rebase(); //moves the anchor to the current frame
+
+    double firstDisplay = -1; //display time of the first frame, -1 before it
+    double display = 0; //of the current frame, relative to firstDisplay
+    double anchorDisplay = 0, anchorSong = 0; //song time is anchorSong at display time anchorDisplay
+    double speed = 1;
+    double end = 1e300;
+    bool paused = true;
+};
@@ -0,0 +1,119 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <android/log.h>
+
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, "PIARNO", __VA_ARGS__)
+
+void Profiler::record(Timer timer, float ms) {
+    auto &s = series[(size_t) timer];
+    s.samples[s.count % WINDOW] = ms;
+    s.count++;
+    if (s.count % INTERVAL != 0)
+        return;
+
+    //the percentiles of the window, as long as it isn't full yet only of the samples so far
+    float sorted[WINDOW];
+    size_t n = std::min(s.count, WINDOW);
+    std::copy(s.samples, s.samples + n, sorted);
+    std::sort(sorted, sorted + n);
+    s.p50.store(sorted[n * 50 / 100], std::memory_order_relaxed);
+    s.p90.store(sorted[n * 90 / 100], std::memory_order_relaxed);
+    s.p99.store(sorted[n * 99 / 100], std::memory_order_relaxed);
+    s.max.store(sorted[n - 1], std::memory_order_relaxed);
+}
+
+Profiler::Stats Profiler::stats(Timer timer) const {
+    auto &s = series[(size_t) timer];
+    return {s.p50.load(std::memory_order_relaxed), s.p90.load(std::memory_order_relaxed),
+            s.p99.load(std::memory_order_relaxed), s.max.load(std::memory_order_relaxed)};
+}
+
+const char* Profiler::name(Timer timer) {
+    static const char *names[(size_t) Timer::NUM] = {
+            "frame", "input", "waitFrame", "update", "record", "renderFrame", "endFrame", "gpu"
+    };
+    return names[(size_t) timer];
+}
+
+void Profiler::count(Counter counter, uint32_t value) {
+    counts[(size_t) counter].store(value, std::memory_order_relaxed);
+}
+
+uint32_t Profiler::count(Counter counter) const {
+    return counts[(size_t) counter].load(std::memory_order_relaxed);
+}
+
+const char* Profiler::name(Counter counter) {
+    static const char *names[(size_t) Counter::NUM] = {
+            "uploads", "uploadedBytes", "draws", "programChanges", "vaoChanges"
+    };
+    return names[(size_t) counter];
+}
+
+void Profiler::setBudget(float ms) {
+    frameBudget.store(ms, std::memory_order_relaxed);
+}
+
+float Profiler::budget() const {
+    return frameBudget.load(std::memory_order_relaxed);
+}
+
+void Profiler::dump(double time) {
+    LOGE("[DEBUG/Profiler] budget %.2f ms, p50/p90/p99/max in ms:", budget());
+    for (size_t i = 0; i < (size_t) Timer::NUM; i++) {
+        auto s = stats((Timer) i);
+        LOGE("[DEBUG/Profiler] %-12s %6.2f %6.2f %6.2f %6.2f", name((Timer) i), s.p50, s.p90, s.p99, s.max);
+    }
+    LOGE("[DEBUG/Profiler] last frame: %u buffer uploads, %u bytes", count(Counter::uploads),
+         count(Counter::uploadedBytes));
+    LOGE("[DEBUG/Profiler] last frame: %u draws, %u program changes, %u VAO changes", count(Counter::draws),
+         count(Counter::programChanges), count(Counter::vaoChanges));
+
+    if (!csv)
+        return;
+    fprintf(csv, "%.3f,%.2f", time, budget());
+    for (size_t i = 0; i < (size_t) Timer::NUM; i++) {
+        auto s = stats((Timer) i);
+        fprintf(csv, ",%.3f,%.3f,%.3f,%.3f", s.p50, s.p90, s.p99, s.max);
+    }
+    for (size_t i = 0; i < (size_t) Counter::NUM; i++)
+        fprintf(csv, ",%u", count((Counter) i));
+    fprintf(csv, "\n");
+    fflush(csv);
+}
+
+bool Profiler::openCsv(const std::string &path) {
+    closeCsv();
+    csv = fopen(path.c_str(), "w");
+    if (!csv) {
+        LOGE("[DEBUG/Profiler] could not open %s", path.c_str());
+        return false;
+    }
+
+    fprintf(csv, "time,budget");
+    for (size_t i = 0; i < (size_t) Timer::NUM; i++) {
+        const char *n = name((Timer) i);
+        fprintf(csv, ",%s_p50,%s_p90,%s_p99,%s_max", n, n, n, n);
+    }
+    for (size_t i = 0; i < (size_t) Counter::NUM; i++)
+        fprintf(csv, ",%s", name((Counter) i));
+    fprintf(csv, "\n");
+    return true;
+}
+
+void Profiler::closeCsv() {
+    if (csv)
+        fclose(csv);
+    csv = nullptr;
+}
+
+
+ScopedTimer::ScopedTimer(Profiler &p, Timer t)
+        : profiler(p), timer(t), start(std::chrono::steady_clock::now()) {
+}
+
+ScopedTimer::~ScopedTimer() {
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    profiler.record(timer, elapsed.count());
+}
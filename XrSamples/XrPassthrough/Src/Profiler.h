@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// The measured parts of a frame. The main thread records input to record, the render thread the rest.
+enum class Timer : uint8_t {
+    frame,       //time between the predicted display times of two frames
+    input,       //AppInput_syncActions
+    waitFrame,   //xrWaitFrame
+    update,      //Engine::update
+    record,      //Engine::render and handing the draws to the render thread
+    renderFrame, //AppRenderer::renderFrame on the CPU
+    endFrame,    //xrEndFrame
+    gpu,         //AppRenderer::renderFrame on the GPU, if timer queries are supported
+    NUM
+};
+
+// What the render thread did in a frame, only the count of the last frame is kept.
+enum class Counter : uint8_t {
+    uploads,       //StreamBuffer writes
+    uploadedBytes, //bytes copied by them
+    draws,
+    programChanges,
+    vaoChanges,
+    NUM
+};
+
+// Where a frame's time goes: rolling percentiles of each timer over its last samples.
+// Each timer is recorded by one thread only, the percentiles can be read from any thread.
+class Profiler {
+public:
+    static constexpr size_t WINDOW = 256; //samples the percentiles are taken over
+    static constexpr size_t INTERVAL = 64; //samples between updates of the percentiles
+
+    struct Stats {
+        float p50, p90, p99, max; //in milliseconds
+    };
+
+    //add a sample in milliseconds, only from the thread that owns the timer
+    void record(Timer timer, float ms);
+    Stats stats(Timer timer) const;
+    static const char* name(Timer timer);
+
+    //set the count of the last frame, only from the thread that owns the counter
+    void count(Counter counter, uint32_t value);
+    uint32_t count(Counter counter) const;
+    static const char* name(Counter counter);
+
+    //time available for one frame at the current refresh rate, in milliseconds
+    void setBudget(float ms);
+    float budget() const;
+
+    //write the stats to logcat, and as a row of the CSV file if one is open
+    void dump(double time);
+    bool openCsv(const std::string &path);
+    void closeCsv();
+
+private:
+    struct Series {
+        float samples[WINDOW] = {};
+        size_t count = 0; //samples recorded so far
+        std::atomic<float> p50{0}, p90{0}, p99{0}, max{0};
+    };
+    Series series[(size_t) Timer::NUM];
+    std::atomic<uint32_t> counts[(size_t) Counter::NUM] = {};
+    std::atomic<float> frameBudget{0};
+
+    FILE *csv = nullptr;
+};
+
+// Records the time from its construction to the end of the scope.
+class ScopedTimer {
+public:
+    ScopedTimer(Profiler &profiler, Timer timer);
+    ~ScopedTimer();
+
+private:
+    Profiler &profiler;
+    Timer timer;
+    std::chrono::steady_clock::time_point start;
+};
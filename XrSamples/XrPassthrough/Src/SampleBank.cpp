@@ -0,0 +1,130 @@
+#include "SampleBank.h"
+#include "stb_vorbis.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+size_t SampleBank::loadVorbis(const std::string &directory) {
+    size_t loaded = 0;
+    for (int key = 0; key < 128; key++) {
+        std::string path = directory + "/" + std::to_string(key) + ".ogg";
+        int channels, rate;
+        short *decoded;
+        int frames = stb_vorbis_decode_filename(path.c_str(), &channels, &rate, &decoded);
+        if (frames <= 0)
+            continue;
+
+        std::vector<int16_t> data(frames);
+        for (int i = 0; i < frames; i++)
+            data[i] = decoded[i * channels];
+        free(decoded);
+        add(key, rate, std::move(data));
+        loaded++;
+    }
+    return loaded;
+}
+
+//one note: partials of a string that is a bit stiff (higher ones are sharp), each dying out faster than the
+//one below it, with a short burst of filtered noise for the hammer
+static std::vector<int16_t> pianoNote(int key, float rate) {
+    const double PI = 3.14159265358979323846;
+    double f0 = 440 * std::pow(2, (key - 69) / 12.0);
+    double seconds = std::clamp(4.5 - (key - 21) * 0.045, 1.0, 4.5); //low strings ring longer
+    size_t length = (size_t) (seconds * rate);
+    std::vector<float> mix(length, 0);
+
+    double stiffness = 0.0001 * std::pow(2, (key - 60) / 24.0);
+    for (int n = 1; n <= 32; n++) {
+        double f = n * f0 * std::sqrt(1 + stiffness * n * n);
+        if (f > std::min(0.45 * rate, 12000.0))
+            break;
+        double amplitude = std::pow(n, -1.2) * std::exp(-n * f0 / 6000);
+        //two decays, the sound of a piano drops fast right after the hammer and then rings on
+        double fast = std::pow(0.001, 1 / (0.25 * seconds / n * rate));
+        double slow = std::pow(0.001, 1 / (seconds / (1 + 0.3 * (n - 1)) * rate));
+        double c = std::cos(2 * PI * f / rate), s = std::sin(2 * PI * f / rate);
+        double x = 1, y = 0, eFast = 0.6 * amplitude, eSlow = 0.4 * amplitude;
+        for (size_t i = 0; i < length; i++) {
+            double nx = x * c - y * s;
+            y = x * s + y * c;
+            x = nx;
+            mix[i] += (float) ((eFast + eSlow) * y);
+            eFast *= fast;
+            eSlow *= slow;
+            if ((i & 1023) == 1023) { //keep the oscillator on the unit circle
+                double r = 1 / std::sqrt(x * x + y * y);
+                x *= r;
+                y *= r;
+            }
+        }
+    }
+
+    uint32_t noise = 1;
+    double hammer = 0.2, decay = std::pow(0.001, 1 / (0.01 * rate)), filtered = 0;
+    double smoothing = std::exp(-2 * PI * std::min(4 * f0, 8000.0) / rate);
+    for (size_t i = 0; i < length && hammer > 1e-5; i++) {
+        noise = noise * 1664525 + 1013904223;
+        filtered = filtered * smoothing + ((int32_t) noise / 2147483648.0) * (1 - smoothing);
+        mix[i] += (float) (hammer * filtered);
+        hammer *= decay;
+    }
+
+    //no click at the start, and the end fades to silence
+    size_t attack = (size_t) (0.002 * rate), release = (size_t) (0.05 * rate);
+    for (size_t i = 0; i < attack; i++)
+        mix[i] *= (float) i / attack;
+    for (size_t i = 0; i < release; i++)
+        mix[length - 1 - i] *= (float) i / release;
+
+    float peak = 0;
+    for (float m : mix)
+        peak = std::max(peak, std::abs(m));
+    std::vector<int16_t> data(length);
+    for (size_t i = 0; i < length; i++)
+        data[i] = (int16_t) std::lround(mix[i] / peak * 29000);
+    return data;
+}
+
+void SampleBank::synthesize(float rate) {
+    samples.clear();
+    for (int key = 22; key <= 108; key += 3) //every key is at most a semitone from its sample
+        add(key, rate, pianoNote(key, rate));
+}
+
+bool SampleBank::empty() const {
+    return samples.empty();
+}
+
+const SampleBank::Sample& SampleBank::sample(int key) const {
+    return samples[nearest[key & 127]];
+}
+
+double SampleBank::step(int key, float outputRate) const {
+    auto &s = sample(key);
+    return std::pow(2, (key - s.key) / 12.0) * s.rate / outputRate;
+}
+
+void SampleBank::add(int key, float rate, std::vector<int16_t> &&data) {
+    Sample s;
+    s.length = data.size();
+    s.rate = rate;
+    s.key = key;
+    s.data = std::move(data);
+    s.data.resize(s.length + PADDING, 0);
+
+    auto at = std::find_if(samples.begin(), samples.end(), [&](const Sample &other) { return other.key >= key; });
+    if (at != samples.end() && at->key == key)
+        *at = std::move(s);
+    else
+        samples.insert(at, std::move(s));
+
+    for (int k = 0; k < 128; k++) {
+        size_t best = 0;
+        for (size_t i = 1; i < samples.size(); i++) {
+            if (std::abs(samples[i].key - k) < std::abs(samples[best].key - k))
+                best = i;
+        }
+        nearest[k] = (uint8_t) best;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Recorded piano notes for the synthesizer: mono 16 bit samples of some of the keys, every key is played from
+// the sample of the nearest key, resampled to its pitch. Samples are loaded from Ogg Vorbis files, or when
+// there are none, generated: a few partials of a stiff string with a hammer noise on top.
+// Loading allocates, the samples are then only read (from the audio thread).
+class SampleBank {
+public:
+    static constexpr size_t PADDING = 4; //zeros after the end of each sample, interpolation reads the next frame
+
+    struct Sample {
+        std::vector<int16_t> data; //length frames, then PADDING zeros
+        size_t length;
+        float rate; //frames per second
+        int key; //MIDI key that was recorded
+    };
+
+    //<directory>/<MIDI key>.ogg of all keys that have one, the first channel of each; returns how many were loaded
+    size_t loadVorbis(const std::string &directory);
+
+    //a sample every few keys from A0 to C8, at the given rate (the one of the output, so most keys aren't resampled much)
+    void synthesize(float rate);
+
+    bool empty() const;
+    const Sample& sample(int key) const; //the one to play a key from
+    double step(int key, float outputRate) const; //frames of the key's sample per output frame
+
+private:
+    void add(int key, float rate, std::vector<int16_t> &&data);
+
+    std::vector<Sample> samples; //sorted by key
+    uint8_t nearest[128] = {}; //per MIDI key: index of its sample
+};
@@ -0,0 +1,241 @@
+#include "ScoreKeeper.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace session;
+
+float ScoreKeeper::Accuracy::accuracy() const {
+    uint32_t notes = hits + missed + extra;
+    return notes == 0 ? 1 : (float) hits / notes;
+}
+
+float ScoreKeeper::Accuracy::meanOnsetError() const {
+    return hits == 0 ? 0 : onsetError / hits;
+}
+
+float ScoreKeeper::Accuracy::meanAbsOnsetError() const {
+    return hits == 0 ? 0 : absOnsetError / hits;
+}
+
+float ScoreKeeper::Accuracy::meanAbsOffsetError() const {
+    return releases == 0 ? 0 : absOffsetError / releases;
+}
+
+
+void ScoreKeeper::setSong(const TileStore &store, const std::vector<uint8_t> &tracks, int numKeys, int song) {
+    tiles = &store;
+    songIndex = song;
+    notes.setTiles(store, numKeys);
+
+    //a song with a track per hand has the right one higher up, one with a single track is split at its middle
+    size_t trackCount = tracks.empty() ? 0 : *std::max_element(tracks.begin(), tracks.end()) + 1;
+    std::vector<double> keySum(trackCount, 0);
+    std::vector<size_t> keyCount(trackCount, 0);
+    double allKeys = 0;
+    for (size_t i = 0; i < store.size(); i++) {
+        keySum[tracks[i]] += store.key[i];
+        keyCount[tracks[i]]++;
+        allKeys += store.key[i];
+    }
+    handSplit = store.size() == 0 ? numKeys / 2.0f : allKeys / store.size();
+
+    tileHand.resize(store.size());
+    for (size_t i = 0; i < store.size(); i++) {
+        float key = trackCount > 1 ? keySum[tracks[i]] / keyCount[tracks[i]] : store.key[i];
+        tileHand[i] = key >= handSplit ? RIGHT : LEFT;
+    }
+
+    float end = store.size() == 0 ? 0 : store.endMax.back();
+    perSection.assign((size_t) (end / SECTION_LENGTH) + 1, {});
+    heldTile.assign(numKeys, -1);
+    onsetError.assign(store.size(), NAN);
+    offsetError.assign(store.size(), NAN);
+    reset();
+    log(Kind::song, 0, song, 0);
+}
+
+void ScoreKeeper::setLog(SessionLog *l) {
+    sessionLog = l;
+    if (tiles)
+        log(Kind::song, 0, songIndex, 0);
+}
+
+void ScoreKeeper::press(int key, float time) {
+    log(Kind::press, key, -1, time);
+    auto match = notes.press(key, time);
+    trackTempo(key, time);
+
+    //also a key beyond the piano's, from a MIDI keyboard with more keys
+    if (match.tile < 0) {
+        for (Accuracy *a : {&all, &hands[key >= handSplit ? RIGHT : LEFT], &section(time)})
+            a->extra++;
+        if (key >= 0 && key < (int) heldTile.size())
+            heldTile[key] = -1;
+        log(Kind::extra, key, -1, time);
+        return;
+    }
+
+    onsetError[match.tile] = match.error;
+    offsetError[match.tile] = NAN;
+    addHit(match.tile, match.error);
+    heldTile[key] = match.tile;
+    log(Kind::hit, key, match.tile, time, match.error);
+}
+
+void ScoreKeeper::release(int key, float time) {
+    log(Kind::release, key, -1, time);
+    notes.release(key);
+    if (key < 0 || key >= (int) heldTile.size() || heldTile[key] < 0)
+        return;
+
+    int32_t tile = heldTile[key];
+    heldTile[key] = -1;
+    float error = time - tiles->end[tile];
+    offsetError[tile] = error;
+    addRelease(tile, error);
+    log(Kind::held, key, tile, time, error);
+}
+
+void ScoreKeeper::advance(float now) {
+    //the tiles that just became unplayable, the ones of them nobody played are missed
+    size_t from = notes.resolvedTiles();
+    notes.advance(now);
+    for (size_t i = from; i < notes.resolvedTiles(); i++) {
+        if (notes.result(i) != NoteMatcher::Result::missed)
+            continue;
+        addMissed(i);
+        log(Kind::missed, tiles->key[i], i, now);
+    }
+}
+
+void ScoreKeeper::seek(float now) {
+    log(Kind::seek, 0, -1, now);
+    notes.seek(now);
+    std::fill(heldTile.begin(), heldTile.end(), -1);
+
+    //the sums of the tiles NoteMatcher still has as hit or missed, with the errors they were played with
+    auto keepExtra = [](Accuracy &a) {
+        uint32_t extra = a.extra;
+        a = {};
+        a.extra = extra;
+    };
+    keepExtra(all);
+    keepExtra(hands[LEFT]);
+    keepExtra(hands[RIGHT]);
+    std::for_each(perSection.begin(), perSection.end(), keepExtra);
+    for (size_t i = 0; i < tileHand.size(); i++) {
+        auto result = notes.result(i);
+        if (result == NoteMatcher::Result::missed) {
+            addMissed(i);
+        } else if (result == NoteMatcher::Result::hit) {
+            addHit(i, onsetError[i]);
+            if (!std::isnan(offsetError[i]))
+                addRelease(i, offsetError[i]);
+        }
+    }
+    resetTempo();
+}
+
+const NoteMatcher& ScoreKeeper::matcher() const {
+    return notes;
+}
+
+const ScoreKeeper::Accuracy& ScoreKeeper::total() const {
+    return all;
+}
+
+const ScoreKeeper::Accuracy& ScoreKeeper::hand(Hand h) const {
+    return hands[h];
+}
+
+const std::vector<ScoreKeeper::Accuracy>& ScoreKeeper::sections() const {
+    return perSection;
+}
+
+float ScoreKeeper::tempo() const {
+    return tempoEstimate;
+}
+
+void ScoreKeeper::log(Kind kind, int key, int32_t index, float time, float value) {
+    if (sessionLog)
+        sessionLog->write({kind, (uint8_t) key, 0, index, time, value});
+}
+
+ScoreKeeper::Accuracy& ScoreKeeper::section(float time) {
+    size_t s = time <= 0 ? 0 : (size_t) (time / SECTION_LENGTH);
+    return perSection[std::min(s, perSection.size() - 1)];
+}
+
+void ScoreKeeper::addHit(int32_t tile, float error) {
+    for (Accuracy *a : {&all, &hands[tileHand[tile]], &section(tiles->start[tile])}) {
+        a->hits++;
+        a->onsetError += error;
+        a->absOnsetError += std::abs(error);
+    }
+}
+
+void ScoreKeeper::addRelease(int32_t tile, float error) {
+    for (Accuracy *a : {&all, &hands[tileHand[tile]], &section(tiles->start[tile])}) {
+        a->releases++;
+        a->absOffsetError += std::abs(error);
+    }
+}
+
+void ScoreKeeper::addMissed(size_t tile) {
+    for (Accuracy *a : {&all, &hands[tileHand[tile]], &section(tiles->start[tile])})
+        a->missed++;
+}
+
+void ScoreKeeper::trackTempo(int key, float time) {
+    //the press is taken for the onset of its key nearest to the song time the player is at by the tempo so far,
+    //wrong keys are mostly too far from any
+    double expected = fitExpected + (time - fitPlayed) * tempoEstimate;
+    int32_t tile = notes.nearestTile(key, expected);
+    if (tile >= 0 && std::abs(tiles->start[tile] - expected) <= TEMPO_MATCH)
+        addTempoSample(tiles->start[tile], time);
+}
+
+void ScoreKeeper::addTempoSample(double expected, double played) {
+    expectedTimes[tempoNext] = expected;
+    playedTimes[tempoNext] = played;
+    tempoNext = (tempoNext + 1) % TEMPO_WINDOW;
+    tempoCount = std::min(tempoCount + 1, TEMPO_WINDOW);
+    if (tempoCount < 4)
+        return;
+
+    //fitted around the first sample, so the squares stay small late in long songs
+    double x0 = expectedTimes[0], y0 = playedTimes[0];
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (size_t i = 0; i < tempoCount; i++) {
+        double x = expectedTimes[i] - x0, y = playedTimes[i] - y0;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    double n = tempoCount;
+    double spread = n * sxx - sx * sx; //n^2 times the variance of the expected times
+    if (spread < n * n * 0.25) //chords and trills: the notes have to span some time to tell a tempo
+        return;
+
+    double slope = (n * sxy - sx * sy) / spread;
+    if (slope > 0) {
+        tempoEstimate = 1 / slope;
+        fitExpected = x0 + sx / n;
+        fitPlayed = y0 + sy / n;
+    }
+}
+
+void ScoreKeeper::reset() {
+    all = {};
+    hands[LEFT] = hands[RIGHT] = {};
+    std::fill(perSection.begin(), perSection.end(), Accuracy{});
+    resetTempo();
+}
+
+void ScoreKeeper::resetTempo() {
+    tempoCount = tempoNext = 0;
+    tempoEstimate = 1;
+    fitExpected = fitPlayed = 0;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "NoteMatcher.h"
+#include "SessionLog.h"
+#include <cstdint>
+#include <vector>
+
+// Scores the played notes as they come in: the onset error of every press that plays a tile, the offset
+// error of its release against the end of the tile, tiles missed and extra notes, summed up for the song,
+// for each hand and for each SECTION_LENGTH of the song, and the player's tempo relative to the song.
+// The tiles are paired by NoteMatcher, and all sums and the tempo estimate are updated in place, so a note
+// costs O(1) amortized, and O(log n) in the tiles of its key for the tempo.
+// With a SessionLog the input and every scored note are written to it.
+class ScoreKeeper {
+public:
+    static constexpr float SECTION_LENGTH = 10; //song seconds
+    static constexpr size_t TEMPO_WINDOW = 16; //presses the tempo is estimated from
+    static constexpr float TEMPO_MATCH = 0.25f; //song seconds, further from any onset of its key a press is ignored
+
+    enum Hand : uint8_t {
+        LEFT,
+        RIGHT,
+    };
+
+    struct Accuracy {
+        uint32_t hits = 0, missed = 0, extra = 0;
+        uint32_t releases = 0; //of hit tiles
+        double onsetError = 0, absOnsetError = 0, absOffsetError = 0; //sums in seconds, late is positive
+
+        float accuracy() const; //hits of all tiles and extra notes, 1 before there were any
+        float meanOnsetError() const;
+        float meanAbsOnsetError() const;
+        float meanAbsOffsetError() const;
+    };
+
+    //a new song: its tiles and the track of each tile, the hand of a track is told from its keys.
+    //song is the index in the song list, for the log.
+    void setSong(const TileStore &tiles, const std::vector<uint8_t> &tracks, int numKeys, int song);
+    void setLog(SessionLog *log);
+
+    //the input, in time order: see NoteMatcher
+    void press(int key, float time);
+    void release(int key, float time);
+    void advance(float now);
+
+    //the song time jumped: like in NoteMatcher the tiles before it keep their hits and misses, and the extra
+    //notes stay. The sums are rebuilt from those tiles, the tempo starts over.
+    void seek(float now);
+
+    const NoteMatcher& matcher() const;
+    const Accuracy& total() const;
+    const Accuracy& hand(Hand hand) const;
+    const std::vector<Accuracy>& sections() const;
+
+    //the player's tempo relative to the song's, from a line fitted through the last TEMPO_WINDOW presses (when
+    //they were played over the onset of their key nearest to where the fit so far puts the player), 1 until
+    //there are enough of them. Not only hits: a player drifting by more than NoteMatcher::WINDOW hits nothing.
+    float tempo() const;
+
+private:
+    void log(session::Kind kind, int key, int32_t index, float time, float value = 0);
+    Accuracy& section(float time);
+    void addHit(int32_t tile, float error);
+    void addRelease(int32_t tile, float error);
+    void addMissed(size_t tile);
+    void trackTempo(int key, float time);
+    void addTempoSample(double expected, double played);
+    void reset();
+    void resetTempo();
+
+    NoteMatcher notes;
+    const TileStore *tiles = nullptr;
+    SessionLog *sessionLog = nullptr;
+    int songIndex = -1;
+
+    std::vector<uint8_t> tileHand;
+    float handSplit = 0; //keys from here on are played with the right hand, for extra notes
+    std::vector<int32_t> heldTile; //per key: the tile its press hit, until it is released
+    std::vector<float> onsetError, offsetError; //per tile: of its hit and release, NaN until they happen
+
+    Accuracy all, hands[2];
+    std::vector<Accuracy> perSection;
+
+    //the last hits, for the least squares fit of played = a + b * expected
+    double expectedTimes[TEMPO_WINDOW] = {}, playedTimes[TEMPO_WINDOW] = {};
+    size_t tempoCount = 0, tempoNext = 0;
+    float tempoEstimate = 1;
+    double fitExpected = 0, fitPlayed = 0; //a point on the fitted line, where the player is by the estimate
+};
@@ -0,0 +1,62 @@
+#include "SessionLog.h"
+
+using namespace session;
+
+SessionLog::~SessionLog() {
+    close();
+}
+
+bool SessionLog::open(const std::string &path) {
+    close();
+    file = fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+
+    SessionHeader header{MAGIC, VERSION, {0, 0}};
+    fwrite(&header, sizeof(header), 1, file);
+    return true;
+}
+
+void SessionLog::close() {
+    if (file)
+        fclose(file);
+    file = nullptr;
+}
+
+bool SessionLog::isOpen() const {
+    return file != nullptr;
+}
+
+void SessionLog::write(const SessionRecord &record) {
+    if (file)
+        fwrite(&record, sizeof(record), 1, file);
+}
+
+
+SessionReader::~SessionReader() {
+    close();
+}
+
+bool SessionReader::open(const std::string &path) {
+    close();
+    file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    SessionHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != MAGIC || header.version != VERSION) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void SessionReader::close() {
+    if (file)
+        fclose(file);
+    file = nullptr;
+}
+
+bool SessionReader::next(SessionRecord &record) {
+    return file && fread(&record, sizeof(record), 1, file) == 1;
+}
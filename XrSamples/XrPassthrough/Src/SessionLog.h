@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Binary log of a playing session: the played notes as they came in, and how ScoreKeeper scored them.
+// The input records alone are enough to score the session again (Tools/ScoreBench.cpp).
+// Written by the app while the system property debug.piarno.session_log is 1, to <internal data>/session.bin.
+// Everything is little-endian, records follow each other without padding.
+//
+// layout: SessionHeader | SessionRecord...
+namespace session {
+    const uint32_t MAGIC = 0x53455350; //"PSES"
+    const uint32_t VERSION = 1;
+
+    struct SessionHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t reserved[2];
+    };
+
+    enum class Kind : uint8_t {
+        //input
+        song, //a song was loaded, index is the song in the song list
+        press, //key, time
+        release, //key, time
+        seek, //time jumped to time
+        //scoring
+        hit, //index is the tile, time of the press, value the onset error (late is positive)
+        missed, //index is the tile, time when it couldn't be played anymore
+        extra, //a press that played no tile
+        held, //release of a hit tile's key, index is the tile, value the offset error against its end
+    };
+
+    struct SessionRecord {
+        Kind kind;
+        uint8_t key; //of the piano overlay, keys below its first (of a MIDI keyboard) wrap to 255 and down
+        uint16_t reserved;
+        int32_t index; //song or tile, -1 if none
+        float time; //song seconds
+        float value;
+    };
+
+    static_assert(sizeof(SessionHeader) == 16 && sizeof(SessionRecord) == 16,
+                  "the log layout must not depend on the compiler");
+
+    inline bool isInput(Kind kind) {
+        return kind <= Kind::seek;
+    }
+}
+
+// Appends records to a session log. Writing a record does not allocate.
+class SessionLog {
+public:
+    ~SessionLog();
+
+    bool open(const std::string &path);
+    void close();
+    bool isOpen() const;
+
+    void write(const session::SessionRecord &record);
+
+private:
+    FILE *file = nullptr;
+};
+
+// Reads the records of a session log in order.
+class SessionReader {
+public:
+    ~SessionReader();
+
+    //returns false if the file can't be read or is not a log of this version
+    bool open(const std::string &path);
+    void close();
+
+    //false at the end of the log
+    bool next(session::SessionRecord &record);
+
+private:
+    FILE *file = nullptr;
+};
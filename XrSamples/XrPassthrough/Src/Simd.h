@@ -0,0 +1,61 @@
+#pragma once
+
+#if defined(__ARM_NEON) && !defined(SIMD_SCALAR)
+#include <arm_neon.h>
+#elif defined(__SSE2__) && !defined(SIMD_SCALAR)
+#include <emmintrin.h>
+#endif
+
+// Four floats processed together: NEON on the headset, SSE2 on x86 and plain loops anywhere else.
+// Only the few operations the per-frame kernels need, loads and stores don't have to be aligned.
+// Defining SIMD_SCALAR forces the plain loops, the host tests run the kernels both ways.
+namespace simd {
+
+#if defined(__ARM_NEON) && !defined(SIMD_SCALAR)
+
+struct f32x4 {
+    float32x4_t v;
+};
+
+inline f32x4 load(const float *p) { return {vld1q_f32(p)}; }
+inline void store(float *p, f32x4 a) { vst1q_f32(p, a.v); }
+inline f32x4 splat(float x) { return {vdupq_n_f32(x)}; }
+inline f32x4 operator+(f32x4 a, f32x4 b) { return {vaddq_f32(a.v, b.v)}; }
+inline f32x4 operator-(f32x4 a, f32x4 b) { return {vsubq_f32(a.v, b.v)}; }
+inline f32x4 operator*(f32x4 a, f32x4 b) { return {vmulq_f32(a.v, b.v)}; }
+inline f32x4 max(f32x4 a, f32x4 b) { return {vmaxq_f32(a.v, b.v)}; }
+inline f32x4 min(f32x4 a, f32x4 b) { return {vminq_f32(a.v, b.v)}; }
+
+#elif defined(__SSE2__) && !defined(SIMD_SCALAR)
+
+struct f32x4 {
+    __m128 v;
+};
+
+inline f32x4 load(const float *p) { return {_mm_loadu_ps(p)}; }
+inline void store(float *p, f32x4 a) { _mm_storeu_ps(p, a.v); }
+inline f32x4 splat(float x) { return {_mm_set1_ps(x)}; }
+inline f32x4 operator+(f32x4 a, f32x4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline f32x4 operator-(f32x4 a, f32x4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline f32x4 operator*(f32x4 a, f32x4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline f32x4 max(f32x4 a, f32x4 b) { return {_mm_max_ps(a.v, b.v)}; }
+inline f32x4 min(f32x4 a, f32x4 b) { return {_mm_min_ps(a.v, b.v)}; }
+
+#else
+
+struct f32x4 {
+    float v[4];
+};
+
+inline f32x4 load(const float *p) { return {{p[0], p[1], p[2], p[3]}}; }
+inline void store(float *p, f32x4 a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+inline f32x4 splat(float x) { return {{x, x, x, x}}; }
+inline f32x4 operator+(f32x4 a, f32x4 b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+inline f32x4 operator-(f32x4 a, f32x4 b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+inline f32x4 operator*(f32x4 a, f32x4 b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+inline f32x4 max(f32x4 a, f32x4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+inline f32x4 min(f32x4 a, f32x4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+
+#endif
+
+}
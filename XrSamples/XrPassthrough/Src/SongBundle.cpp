@@ -0,0 +1,54 @@
+#include "SongBundle.h"
+
+using namespace bundle;
+
+bool SongBundle::open(const void *bytes, size_t size) {
+    data = nullptr;
+    songs = nullptr;
+    songCount = 0;
+
+    auto d = static_cast<const uint8_t*>(bytes);
+    if (size < sizeof(BundleHeader) || reinterpret_cast<uintptr_t>(d) % alignof(BundleNote) != 0)
+        return false;
+
+    auto header = reinterpret_cast<const BundleHeader*>(d);
+    if (header->magic != MAGIC || header->version != VERSION || header->size > size)
+        return false;
+    if (sizeof(BundleHeader) + (size_t) header->songCount * sizeof(BundleSong) > header->size)
+        return false;
+
+    //validate all ranges once, so the accessors don't have to
+    auto s = reinterpret_cast<const BundleSong*>(d + sizeof(BundleHeader));
+    for (size_t i = 0; i < header->songCount; i++) {
+        if ((size_t) s[i].nameOffset + s[i].nameLength > header->size ||
+            s[i].noteOffset % alignof(BundleNote) != 0 ||
+            (size_t) s[i].noteOffset + (size_t) s[i].noteCount * sizeof(BundleNote) > header->size)
+            return false;
+    }
+
+    data = d;
+    songs = s;
+    songCount = header->songCount;
+    return true;
+}
+
+size_t SongBundle::size() const {
+    return songCount;
+}
+
+std::string SongBundle::name(size_t song) const {
+    auto &s = songs[song];
+    return std::string(reinterpret_cast<const char*>(data + s.nameOffset), s.nameLength);
+}
+
+double SongBundle::duration(size_t song) const {
+    return songs[song].duration;
+}
+
+const BundleNote* SongBundle::notes(size_t song) const {
+    return reinterpret_cast<const BundleNote*>(data + songs[song].noteOffset);
+}
+
+size_t SongBundle::noteCount(size_t song) const {
+    return songs[song].noteCount;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Binary song bundle: all songs pre-parsed into sorted notes, so loading a song needs no MIDI parsing.
+// Generated by Tools/SongBundler.cpp. Everything is little-endian and naturally aligned, so the bundle
+// can be used in place (an embedded array or a memory-mapped file).
+//
+// layout: BundleHeader | BundleSong[songCount] | BundleNote[...] | song names (not null-terminated)
+namespace bundle {
+    const uint32_t MAGIC = 0x42524150; //"PARB"
+    const uint32_t VERSION = 1;
+
+    struct BundleHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t songCount;
+        uint32_t size; //size of the whole bundle in bytes
+    };
+
+    struct BundleSong {
+        uint32_t nameOffset; //in bytes from the start of the bundle
+        uint32_t nameLength;
+        uint32_t noteOffset; //in bytes from the start of the bundle
+        uint32_t noteCount;
+        float duration; //in seconds
+        uint32_t reserved;
+    };
+
+    //a note-on/note-off pair, notes of a song are sorted by start
+    struct BundleNote {
+        float start; //in seconds
+        float end; //in seconds
+        uint8_t key; //MIDI key number
+        uint8_t velocity; //note-on velocity
+        uint16_t track; //original track in the MIDI file
+    };
+
+    static_assert(sizeof(BundleHeader) == 16 && sizeof(BundleSong) == 24 && sizeof(BundleNote) == 12,
+                  "the bundle layout must not depend on the compiler");
+}
+
+// Read-only view of a song bundle, does not copy or own the data
+class SongBundle {
+public:
+    //returns false (and stays empty) if the data is not a valid bundle of this version
+    bool open(const void *data, size_t size);
+
+    size_t size() const;
+    std::string name(size_t song) const;
+    double duration(size_t song) const;
+    const bundle::BundleNote* notes(size_t song) const;
+    size_t noteCount(size_t song) const;
+
+private:
+    const uint8_t *data = nullptr;
+    const bundle::BundleSong *songs = nullptr;
+    size_t songCount = 0;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Lock-free queue from one producer thread to one consumer thread, with room for N values.
+// Each side only writes its own index and keeps a copy of the other one, so the shared cache lines are read
+// once per time the ring looks full or empty, not on every push or pop. Neither side ever waits; pushing
+// into a full ring fails and the value is dropped.
+template<typename T, size_t N>
+class SpscRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "the capacity has to be a power of two");
+
+public:
+    // producer: false if the ring is full
+    bool push(const T &value) {
+        size_t head = writeIndex.load(std::memory_order_relaxed);
+        if (head - readCopy == N) {
+            readCopy = readIndex.load(std::memory_order_acquire);
+            if (head - readCopy == N)
+                return false;
+        }
+        items[head & (N - 1)] = value;
+        writeIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer: false if the ring is empty
+    bool pop(T &value) {
+        size_t tail = readIndex.load(std::memory_order_relaxed);
+        if (tail == writeCopy) {
+            writeCopy = writeIndex.load(std::memory_order_acquire);
+            if (tail == writeCopy)
+                return false;
+        }
+        value = items[tail & (N - 1)];
+        readIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    //the producer's and the consumer's data on separate cache lines
+    alignas(64) std::atomic<size_t> writeIndex{0};
+    size_t readCopy = 0;
+    alignas(64) std::atomic<size_t> readIndex{0};
+    size_t writeCopy = 0;
+    alignas(64) T items[N];
+};
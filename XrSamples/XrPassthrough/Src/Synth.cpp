@@ -0,0 +1,316 @@
+#include "Synth.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace simd;
+
+static const double JUMP = 0.05; //song seconds the clock may be off from where the notes were started, more is a seek
+static const float RELEASE = 0.3f, DAMP = 0.01f; //seconds to -60 dB of a let go key, and of a stopped voice
+static const float SILENT = 0.001f; //envelope at which a released voice is done
+static const float VOLUME = 0.3f; //of a voice at full velocity, leaves room for chords
+
+void Synth::init(const SampleBank &samples, float r) {
+    bank = &samples;
+    outputRate = r;
+    releaseDecay = std::pow(0.001f, 1 / (RELEASE * r));
+    dampDecay = std::pow(0.001f, 1 / (DAMP * r));
+}
+
+float Synth::rate() const {
+    return outputRate;
+}
+
+void Synth::setSong(const bundle::BundleNote *songNotes, size_t count, double songOffset) {
+    push({Event::song, 0, 0, songNotes, (uint32_t) count, songOffset, {}});
+}
+
+void Synth::setTiming(double songTime, double time, double speed) {
+    //the clock only changes on pause, seek and speed, in between every frame is on the same line
+    double expected = sent.songTime + (time - sent.time) * sent.speed;
+    if (clockSent && speed == sent.speed && std::abs(songTime - expected) < 1e-6)
+        return;
+    sent = {songTime, time, speed};
+    clockSent = push({Event::timing, 0, 0, nullptr, 0, 0, sent}); //or again with the next frame
+}
+
+void Synth::press(int key, int velocity) {
+    push({Event::press, (uint8_t) key, (uint8_t) velocity, nullptr, 0, 0, {}});
+}
+
+void Synth::release(int key) {
+    push({Event::release, (uint8_t) key, 0, nullptr, 0, 0, {}});
+}
+
+uint32_t Synth::dropped() const {
+    return drops.load(std::memory_order_relaxed);
+}
+
+bool Synth::push(const Event &event) {
+    if (events.push(event))
+        return true;
+    drops.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+
+void Synth::render(float *out, size_t frames, double time) {
+    while (frames > 0) {
+        handleEvents();
+        updateClock(time);
+        size_t n = std::min(frames, MAX_BLOCK);
+        if (changeCount > 0) //the block ends where the next change starts
+            n = std::min<size_t>(n, std::max(1L, std::lround((changes[0].time - time) * outputRate)));
+        renderBlock(out, n, time);
+        out += n * CHANNELS;
+        frames -= n;
+        time += n / outputRate;
+        renderedFrames += n;
+    }
+}
+
+size_t Synth::playingVoices() const {
+    return playing;
+}
+
+void Synth::setOnsetLog(std::vector<Onset> *log) {
+    onsets = log;
+}
+
+void Synth::renderBlock(float *out, size_t frames, double time) {
+    std::fill(left, left + frames, 0.0f);
+    std::fill(right, right + frames, 0.0f);
+
+    if (notes && bank) {
+        double speed = clock.speed;
+        double songAtBlock = clock.songTime + (time - clock.time) * speed;
+        double songAtEnd = songAtBlock + frames / outputRate * speed;
+
+        //a seek or another song: what was playing stops, the notes go on from the new time
+        if (!continuous || std::abs(songAtBlock - songPosition) > JUMP) {
+            releaseAll(true, dampDecay);
+            auto first = std::partition_point(notes, notes + noteCount, [&](const bundle::BundleNote &n) {
+                return n.start + offset < songAtBlock - 0.5 / outputRate; //one on this frame is played
+            });
+            cursor = first - notes;
+            continuous = true;
+        }
+        songPosition = songAtBlock;
+
+        if (speed > 0) {
+            startNotes(songAtBlock, speed, frames);
+            songPosition = songAtEnd;
+
+            for (auto &v : voices) {
+                if (v.sample && v.note >= 0 && v.end < songAtEnd) {
+                    double at = (v.end - songAtBlock) / speed * outputRate;
+                    releaseAt(v, at <= 0 ? 0 : std::min((size_t) std::lround(at), frames), releaseDecay);
+                }
+            }
+        } else {
+            releaseAll(true, releaseDecay); //paused, as if all keys were let go
+        }
+    }
+
+    playing = 0;
+    for (auto &v : voices) {
+        if (!v.sample)
+            continue;
+        if (!advance(v, frames)) {
+            v.sample = nullptr;
+            continue;
+        }
+        v.from = 0;
+        if (v.releaseFrame != MAX_BLOCK)
+            v.releaseFrame = 0; //it was on the end of this block
+        playing++;
+    }
+
+    const f32x4 low = splat(-1), high = splat(1);
+    size_t i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        float l[4], r[4];
+        store(l, min(max(load(left + i), low), high));
+        store(r, min(max(load(right + i), low), high));
+        for (int k = 0; k < 4; k++) {
+            out[(i + k) * CHANNELS] = l[k];
+            out[(i + k) * CHANNELS + 1] = r[k];
+        }
+    }
+    for (; i < frames; i++) {
+        out[i * CHANNELS] = std::clamp(left[i], -1.0f, 1.0f);
+        out[i * CHANNELS + 1] = std::clamp(right[i], -1.0f, 1.0f);
+    }
+}
+
+void Synth::handleEvents() {
+    Event e;
+    while (events.pop(e)) {
+        switch (e.type) {
+            case Event::song:
+                notes = e.notes;
+                noteCount = e.count;
+                offset = e.offset;
+                continuous = false;
+                break;
+            case Event::timing:
+                if (changeCount == sizeof(changes) / sizeof(changes[0])) //so many can't be in the future
+                    updateClock(changes[0].time);
+                changes[changeCount++] = e.clock;
+                break;
+            case Event::press:
+                if (bank)
+                    start(e.key, e.velocity, -1, 0, 0);
+                break;
+            case Event::release:
+                for (auto &v : voices) {
+                    if (v.sample && v.note < 0 && v.key == e.key)
+                        releaseAt(v, 0, releaseDecay);
+                }
+                break;
+        }
+    }
+}
+
+void Synth::updateClock(double time) {
+    size_t due = 0;
+    while (due < changeCount && changes[due].time <= time + 0.5 / outputRate)
+        clock = changes[due++];
+    std::copy(changes + due, changes + changeCount, changes);
+    changeCount -= due;
+}
+
+void Synth::startNotes(double songAtBlock, double speed, size_t frames) {
+    //the ones on an output frame of this block, one that rounds to the next is the next block's first
+    double to = songAtBlock + (frames - 0.5) / outputRate * speed;
+    for (; cursor < noteCount && notes[cursor].start + offset < to; cursor++) {
+        auto &n = notes[cursor];
+        double at = (n.start + offset - songAtBlock) / speed * outputRate;
+        size_t frame = at <= 0 ? 0 : std::min((size_t) std::lround(at), frames - 1);
+        start(n.key, n.velocity, (int32_t) cursor, n.end + offset, frame);
+    }
+}
+
+void Synth::start(int key, int velocity, int32_t note, double end, size_t frame) {
+    //the string is struck again, what it still played is damped
+    for (auto &v : voices) {
+        if (v.sample && v.key == key)
+            releaseAt(v, frame, dampDecay);
+    }
+
+    Voice *voice = std::find_if(voices, voices + MAX_VOICES, [](const Voice &v) { return !v.sample; });
+    if (voice == voices + MAX_VOICES) {
+        //all playing: take the quietest released one, or the oldest, after it played up to here
+        voice = std::min_element(voices, voices + MAX_VOICES, [](const Voice &a, const Voice &b) {
+            bool releasedA = a.decay < 1, releasedB = b.decay < 1;
+            if (releasedA != releasedB)
+                return releasedA;
+            return releasedA ? a.envelope < b.envelope : a.started < b.started;
+        });
+        advance(*voice, frame);
+    }
+
+    //loudness grows faster than the velocity, low keys sound a bit more from the left
+    float gain = VOLUME * std::pow(velocity / 127.0f, 1.7f) / 32768;
+    float pan = std::clamp((key - 21) / 87.0f, 0.0f, 1.0f) * 0.5f + 0.25f;
+    auto &sample = bank->sample(key);
+    voice->sample = &sample;
+    voice->position = 0;
+    voice->step = bank->step(key, outputRate);
+    voice->gain[0] = gain * std::cos(pan * (float) M_PI_2);
+    voice->gain[1] = gain * std::sin(pan * (float) M_PI_2);
+    voice->envelope = 1;
+    voice->decay = 1;
+    voice->key = (uint8_t) key;
+    voice->note = note;
+    voice->end = end;
+    voice->from = frame;
+    voice->releaseFrame = MAX_BLOCK;
+    voice->releaseDecay = 1;
+    voice->started = startCount++;
+
+    if (note >= 0 && onsets && onsets->size() < onsets->capacity())
+        onsets->push_back({renderedFrames + frame, (uint32_t) note});
+}
+
+void Synth::releaseAt(Voice &voice, size_t frame, float decay) {
+    frame = std::max(frame, voice.from);
+    if (voice.releaseFrame != MAX_BLOCK) {
+        voice.releaseFrame = std::min(voice.releaseFrame, frame);
+        voice.releaseDecay = std::min(voice.releaseDecay, decay);
+    } else if (decay < voice.decay) { //not when it already fades as fast
+        voice.releaseFrame = frame;
+        voice.releaseDecay = decay;
+    }
+}
+
+void Synth::releaseAll(bool song, float decay) {
+    for (auto &v : voices) {
+        if (v.sample && (v.note >= 0) == song)
+            releaseAt(v, 0, decay);
+    }
+}
+
+bool Synth::advance(Voice &voice, size_t to) {
+    if (voice.releaseFrame < to) {
+        if (!mix(voice, voice.from, voice.releaseFrame))
+            return false;
+        voice.from = voice.releaseFrame;
+        voice.decay = voice.releaseDecay;
+        voice.releaseFrame = MAX_BLOCK;
+    }
+    bool more = mix(voice, voice.from, to);
+    voice.from = to;
+    return more && voice.envelope > SILENT;
+}
+
+bool Synth::mix(Voice &voice, size_t from, size_t to) {
+    //the sample may end in between, interpolation then reads into its padding
+    auto &sample = *voice.sample;
+    double remaining = std::ceil((sample.length - voice.position) / voice.step);
+    bool ends = remaining <= (double) (to - from);
+    if (ends)
+        to = from + (size_t) std::max(remaining, 0.0);
+
+    //four frames at a time: interpolated in the sample, times the envelope of each frame, added to the mix
+    const int16_t *data = sample.data.data();
+    double position = voice.position, step = voice.step;
+    float d = voice.decay, e = voice.envelope;
+    float lanes[4] = {e, e * d, e * d * d, e * d * d * d};
+    f32x4 envelope = load(lanes), decay4 = splat(d * d * d * d);
+    f32x4 gainLeft = splat(voice.gain[0]), gainRight = splat(voice.gain[1]);
+    size_t i = from;
+    for (; i + 4 <= to; i += 4) {
+        float a[4], b[4], t[4];
+        for (int k = 0; k < 4; k++) {
+            double p = position + k * step;
+            size_t index = (size_t) p;
+            t[k] = (float) (p - index);
+            a[k] = data[index];
+            b[k] = data[index + 1];
+        }
+        f32x4 va = load(a);
+        f32x4 x = (va + (load(b) - va) * load(t)) * envelope;
+        store(left + i, load(left + i) + x * gainLeft);
+        store(right + i, load(right + i) + x * gainRight);
+        envelope = envelope * decay4;
+        position += 4 * step;
+    }
+    store(lanes, envelope);
+    e = lanes[0];
+
+    for (; i < to; i++) {
+        size_t index = (size_t) position;
+        float t = (float) (position - index);
+        float x = (data[index] + (data[index + 1] - data[index]) * t) * e;
+        left[i] += x * voice.gain[0];
+        right[i] += x * voice.gain[1];
+        e *= d;
+        position += step;
+    }
+
+    voice.position = position;
+    voice.envelope = e;
+    return !ends;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "SampleBank.h"
+#include "SongBundle.h"
+#include "SpscRing.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// The piano sound of the song and of the keys played on the overlay, rendered on the audio thread.
+// The main thread hands over the song's notes, where the song is at a time and how fast it goes (the playback
+// clock of the frame) and the played keys. The audio thread starts the song's notes itself, on the output frame
+// the clock puts them on, so the sound follows pause, seek and speed without notes being sent one by one.
+// Everything goes through a lock-free ring; of the clock only changes are sent, each one is used from the
+// display time of its frame on, as the picture changes then. render() never allocates, locks or waits.
+// Voices come from a fixed pool and are mixed four frames at a time (Simd.h).
+class Synth {
+public:
+    static constexpr size_t MAX_VOICES = 64;
+    static constexpr size_t MAX_BLOCK = 512; //frames mixed at once, longer renders are split
+    static constexpr size_t CHANNELS = 2; //interleaved stereo
+
+    //a song note that started, on the output frame counted from the first render(), for timing tests
+    struct Onset {
+        uint64_t frame;
+        uint32_t note; //index in the song
+    };
+
+    //before render() is called for the first time; the bank is not copied and has to stay as it is
+    void init(const SampleBank &bank, float outputRate);
+    float rate() const;
+
+    //main thread
+    //the song's notes (they have to stay valid), a note is played at song time offset + start
+    void setSong(const bundle::BundleNote *notes, size_t count, double offset);
+    //the song is at songTime at time (seconds, on the clock of render()) and goes speed song seconds per second,
+    //0 while paused
+    void setTiming(double songTime, double time, double speed);
+    //a key of the overlay pressed or let go, played at once
+    void press(int key, int velocity);
+    void release(int key);
+    uint32_t dropped() const; //events that didn't fit into the ring since the start
+
+    //audio thread: frames of interleaved samples, the first of them is heard at time
+    void render(float *out, size_t frames, double time);
+    size_t playingVoices() const;
+    void setOnsetLog(std::vector<Onset> *log); //song notes started are added until the log reaches its capacity
+
+private:
+    struct Timing {
+        double songTime = 0, time = 0, speed = 0;
+    };
+
+    struct Event {
+        enum Type : uint8_t { song, timing, press, release } type;
+        uint8_t key;
+        uint8_t velocity;
+        const bundle::BundleNote *notes;
+        uint32_t count;
+        double offset;
+        Timing clock;
+    };
+
+    struct Voice {
+        const SampleBank::Sample *sample; //nullptr: free
+        double position; //in the sample, frames
+        double step;
+        float gain[CHANNELS];
+        float envelope; //1 until released, then multiplied with decay every frame
+        float decay;
+        uint8_t key;
+        int32_t note; //index in the song, -1 for a played key
+        double end; //song time of the note's end
+        size_t from; //frame of this block it starts on
+        size_t releaseFrame; //frame of this block it is released on, MAX_BLOCK if not in this block
+        float releaseDecay;
+        uint64_t started; //for stealing the oldest one
+    };
+
+    bool push(const Event &event);
+    void renderBlock(float *out, size_t frames, double time);
+    void handleEvents();
+    void updateClock(double time); //takes the clock changes made for time and before
+    void startNotes(double songAtBlock, double speed, size_t frames);
+    void start(int key, int velocity, int32_t note, double end, size_t frame);
+    void releaseAt(Voice &voice, size_t frame, float decay);
+    void releaseAll(bool song, float decay); //the voices of the song's notes or of the played keys
+    bool advance(Voice &voice, size_t to); //mixes the voice up to a frame of the block, false once it is done
+    bool mix(Voice &voice, size_t from, size_t to); //false once the sample ended
+
+    //main thread to audio thread
+    SpscRing<Event, 256> events;
+    std::atomic<uint32_t> drops{0};
+    Timing sent; //the last clock change
+    bool clockSent = false;
+
+    //audio thread
+    const SampleBank *bank = nullptr;
+    float outputRate = 48000;
+    float releaseDecay, dampDecay; //per frame, of a let go key and of a voice that has to stop fast
+    const bundle::BundleNote *notes = nullptr;
+    size_t noteCount = 0, cursor = 0; //the next note to start
+    double offset = 0;
+    double songPosition = 0; //song time the notes were started up to
+    bool continuous = false; //false until the cursor is found for the current song
+    Timing clock;
+    Timing changes[8]; //of the clock, not yet due
+    size_t changeCount = 0;
+    Voice voices[MAX_VOICES] = {};
+    size_t playing = 0;
+    uint64_t startCount = 0, renderedFrames = 0;
+    std::vector<Onset> *onsets = nullptr;
+    alignas(16) float left[MAX_BLOCK], right[MAX_BLOCK];
+};
@@ -0,0 +1,94 @@
+#include "TileStore.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace simd;
+
+void TileStore::clear() {
+    for (auto *v : {&start, &end, &endMax, &x, &y, &width})
+        v->clear();
+    key.clear();
+    colorIndex.clear();
+    alpha.clear();
+}
+
+void TileStore::reserve(size_t count) {
+    for (auto *v : {&start, &end, &endMax, &x, &y, &width})
+        v->reserve(count);
+    key.reserve(count);
+    colorIndex.reserve(count);
+    alpha.reserve(count);
+}
+
+size_t TileStore::size() const {
+    return start.size();
+}
+
+void TileStore::add(float startTime, float endTime, int k, float lane, float height, float w, uint8_t c, uint8_t a) {
+    start.push_back(startTime);
+    end.push_back(endTime);
+    endMax.push_back(std::max(endMax.empty() ? endTime : endMax.back(), endTime));
+    key.push_back(k);
+    x.push_back(lane);
+    y.push_back(height);
+    width.push_back(w);
+    colorIndex.push_back(c);
+    alpha.push_back(a);
+}
+
+size_t TileStore::update(size_t begin, size_t finish, float now, float speed, float zOffset, const mat4 &sceneTransform,
+                         const std::vector<color> &palette, float *startDist, float *endDist, InstanceBatch &batch) const {
+    //a tile is the rect mesh at (x, y, z), rotated by 90 degrees around x and scaled by (width, length, 1),
+    //so its columns are sceneTransform's columns: x * width, z * length, -y and the position
+    mat4 columns = sceneTransform.Transposed();
+    f32x4 sceneX = load(columns.M[0]), sceneY = load(columns.M[1]), sceneZ = load(columns.M[2]), sceneW = load(columns.M[3]);
+    f32x4 negY = splat(0) - sceneY;
+
+    f32x4 zero = splat(0), half = splat(0.5f), vSpeed = splat(speed), vNow = splat(now), vOffset = splat(zOffset);
+    //instances are written in place, then the room of the hidden tiles is given back
+    size_t first = batch.instances.size();
+    batch.instances.resize(first + (finish - begin));
+    Instance *out = batch.instances.data() + first;
+
+    size_t written = 0;
+    for (size_t i = begin; i < finish; i += 4) {
+        size_t n = std::min<size_t>(4, finish - i);
+
+        //the last block is padded, so the kernel always works on four tiles
+        float s[4] = {}, e[4] = {};
+        memcpy(s, &start[i], n * sizeof(float));
+        memcpy(e, &end[i], n * sizeof(float));
+
+        f32x4 sDist = (load(s) - vNow) * vSpeed;
+        f32x4 eDist = (load(e) - vNow) * vSpeed;
+        f32x4 sClamped = max(zero, sDist);
+        f32x4 length = max(zero, eDist) - sClamped;
+        f32x4 z = vOffset - (sClamped + length * half); //center of tile
+
+        float sOut[4], eOut[4], lengthOut[4], zOut[4];
+        store(sOut, sDist);
+        store(eOut, eDist);
+        store(lengthOut, length);
+        store(zOut, z);
+        memcpy(startDist + (i - begin), sOut, n * sizeof(float));
+        memcpy(endDist + (i - begin), eOut, n * sizeof(float));
+
+        for (size_t j = 0; j < n; j++) {
+            if (eOut[j] <= 0) //already in the past
+                continue;
+            size_t t = i + j;
+            auto &instance = out[written++];
+            store(instance.transform.M[0], sceneX * splat(width[t]));
+            store(instance.transform.M[1], sceneZ * splat(lengthOut[j]));
+            store(instance.transform.M[2], negY);
+            store(instance.transform.M[3], sceneW + sceneX * splat(x[t]) + sceneY * splat(y[t]) + sceneZ * splat(zOut[j]));
+
+            memcpy(instance.color, palette[colorIndex[t]].data(), 3);
+            instance.color[3] = alpha[t];
+        }
+    }
+    batch.instances.resize(first + written);
+    return written;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Object.h"
+#include <cstdint>
+#include <vector>
+
+// The falling tiles of a song as structure of arrays, sorted by start time. The per-frame update only runs
+// over the plain arrays of the visible window and writes the tile instances directly, four tiles at a time.
+// Times are in song seconds, stored as float: enough for sub-millisecond precision over hours of song.
+class TileStore {
+public:
+    void clear();
+    void reserve(size_t count);
+    size_t size() const;
+
+    //tiles have to be added in order of start time
+    void add(float startTime, float endTime, int key, float x, float y, float width, uint8_t colorIndex, uint8_t alpha);
+
+    //lay out the tiles [begin, finish) for song time now and a lane moving speed meters per second:
+    //startDist/endDist get how far (in meters along the lane) each tile's start and end still is,
+    //and every tile that hasn't ended is added to batch, in order.
+    //zOffset is where the lane begins, tile colors are palette[colorIndex] with the alpha of the tile.
+    //Returns the number of instances added.
+    size_t update(size_t begin, size_t finish, float now, float speed, float zOffset, const mat4 &sceneTransform,
+                  const std::vector<color> &palette, float *startDist, float *endDist, InstanceBatch &batch) const;
+
+    std::vector<float> start, end; //start and end time of the note
+    std::vector<float> endMax; //running maximum of end, to find the first tile that hasn't ended
+    std::vector<int16_t> key; //key index of the tile
+    std::vector<float> x, y, width; //lane position above the key, and width of the tile
+    std::vector<uint8_t> colorIndex, alpha;
+};
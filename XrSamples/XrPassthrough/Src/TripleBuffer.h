@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free handoff of the newest value from one producer thread to one consumer thread.
+// The producer fills writeBuffer() and publishes it, the consumer picks up the newest published buffer and
+// reads it while the producer already fills the next one. Neither side ever waits for the other; a buffer
+// that is published again before it was consumed is replaced by the newer one.
+template<typename T>
+class TripleBuffer {
+public:
+    // producer: the buffer to fill, it belongs to the producer until publish()
+    T& writeBuffer() {
+        return buffers[write];
+    }
+
+    // producer: hand the write buffer to the consumer and continue with a free one
+    void publish() {
+        write = middle.exchange(write | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // consumer: switch to the newest published buffer, false if nothing was published since the last call
+    bool consume() {
+        //only the producer changes middle in between, and it can only make it fresh again
+        if ((middle.load(std::memory_order_acquire) & FRESH) == 0)
+            return false;
+        read = middle.exchange(read, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    // consumer: the buffer of the last successful consume(), it belongs to the consumer until the next one
+    T& readBuffer() {
+        return buffers[read];
+    }
+
+private:
+    static constexpr uint8_t INDEX = 3, FRESH = 4;
+
+    T buffers[3];
+    uint8_t write = 0;
+    uint8_t read = 1;
+    std::atomic<uint8_t> middle{2}; //index of the buffer in between, FRESH if it was published but not consumed
+};
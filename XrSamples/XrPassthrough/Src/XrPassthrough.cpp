@@ -21,11 +21,19 @@ Copyright : Copyright (c) Facebook Technologies, LLC and its affiliates. All rig
 #include <android/log.h>
 #include <android/native_window_jni.h> // for native window JNI
 #include <android_native_app_glue.h>
+#include <sys/system_properties.h>
 #include <assert.h>
+#include <algorithm>
+#include <vector>
 
 #include "XrPassthrough.h"
 #include "XrPassthroughInput.h"
+#include "XrPassthroughHands.h"
+#include "XrPassthroughMidi.h"
+#include "XrPassthroughAudio.h"
 #include "XrPassthroughGl.h"
+#include "HandRecording.h"
+#include "SessionLog.h"
 
 #include "Engine.h"
 
@@ -102,6 +110,11 @@ DECL_PFN(xrDestroyGeometryInstanceFB);
 DECL_PFN(xrGeometryInstanceSetTransformFB);
 // FB_passthrough sample end
 
+DECL_PFN(xrPerfSettingsSetPerformanceLevelEXT);
+DECL_PFN(xrEnumerateDisplayRefreshRatesFB);
+DECL_PFN(xrGetDisplayRefreshRateFB);
+DECL_PFN(xrRequestDisplayRefreshRateFB);
+
 /*
 ================================================================================
 
@@ -305,6 +318,10 @@ void App::Clear() {
     LayerCount = 0;
     CpuLevel = 2;
     GpuLevel = 2;
+    RefreshRateSupported = false;
+    RefreshRate = 0;
+    HandTrackingSupported = false;
+    TimespecConversionSupported = false;
     MainThreadTid = 0;
     RenderThreadTid = 0;
     TouchPadDownLastFrame = false;
@@ -331,54 +348,23 @@ void App::HandleSessionStateChanges(XrSessionState state) {
 
         // Set session state once we have entered VR mode and have a valid session object.
         if (SessionActive) {
-            XrPerfSettingsLevelEXT cpuPerfLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
-            switch (CpuLevel) {
-                case 0:
-                    cpuPerfLevel = XR_PERF_SETTINGS_LEVEL_POWER_SAVINGS_EXT;
-                    break;
-                case 1:
-                    cpuPerfLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_LOW_EXT;
-                    break;
-                case 2:
-                    cpuPerfLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
-                    break;
-                case 3:
-                    cpuPerfLevel = XR_PERF_SETTINGS_LEVEL_BOOST_EXT;
-                    break;
-                default:
-                    ALOGE("Invalid CPU level %d", CpuLevel);
-                    break;
-            }
-
-            XrPerfSettingsLevelEXT gpuPerfLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
-            switch (GpuLevel) {
-                case 0:
-                    gpuPerfLevel = XR_PERF_SETTINGS_LEVEL_POWER_SAVINGS_EXT;
-                    break;
-                case 1:
-                    gpuPerfLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_LOW_EXT;
-                    break;
-                case 2:
-                    gpuPerfLevel = XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
-                    break;
-                case 3:
-                    gpuPerfLevel = XR_PERF_SETTINGS_LEVEL_BOOST_EXT;
-                    break;
-                default:
-                    ALOGE("Invalid GPU level %d", GpuLevel);
-                    break;
+            // The governor starts from the initial levels and the rate the display runs at.
+            float refreshRate = 0;
+            std::vector<float> refreshRates;
+            if (RefreshRateSupported) {
+                uint32_t count = 0;
+                OXR(xrEnumerateDisplayRefreshRatesFB(Session, 0, &count, NULL));
+                refreshRates.resize(count);
+                OXR(xrEnumerateDisplayRefreshRatesFB(Session, count, &count, refreshRates.data()));
+                OXR(xrGetDisplayRefreshRateFB(Session, &refreshRate));
+                for (float rate : refreshRates) {
+                    ALOGV("Supported display refresh rate %.1f Hz", rate);
+                }
             }
-
-            PFN_xrPerfSettingsSetPerformanceLevelEXT pfnPerfSettingsSetPerformanceLevelEXT = NULL;
-            OXR(xrGetInstanceProcAddr(
-                Instance,
-                "xrPerfSettingsSetPerformanceLevelEXT",
-                (PFN_xrVoidFunction*)(&pfnPerfSettingsSetPerformanceLevelEXT)));
-
-            OXR(pfnPerfSettingsSetPerformanceLevelEXT(
-                Session, XR_PERF_SETTINGS_DOMAIN_CPU_EXT, cpuPerfLevel));
-            OXR(pfnPerfSettingsSetPerformanceLevelEXT(
-                Session, XR_PERF_SETTINGS_DOMAIN_GPU_EXT, gpuPerfLevel));
+            RefreshRate = refreshRate;
+            Governor = PerfGovernor{{refreshRate, (PerfLevel)CpuLevel, (PerfLevel)GpuLevel}};
+            Governor.setRefreshRates(refreshRates);
+            ApplyPerfSettings();
 
             PFN_xrSetAndroidApplicationThreadKHR pfnSetAndroidApplicationThreadKHR = NULL;
             OXR(xrGetInstanceProcAddr(
@@ -395,11 +381,44 @@ void App::HandleSessionStateChanges(XrSessionState state) {
         assert(Resumed == false);
         assert(SessionActive);
 
+        // The render thread must not be inside a frame when the session ends.
+        Renderer.WaitIdle();
         OXR(xrEndSession(Session));
         SessionActive = false;
     }
 }
 
+static XrPerfSettingsLevelEXT PerfSettingsLevel(int level) {
+    switch (level) {
+        case 0:
+            return XR_PERF_SETTINGS_LEVEL_POWER_SAVINGS_EXT;
+        case 1:
+            return XR_PERF_SETTINGS_LEVEL_SUSTAINED_LOW_EXT;
+        case 2:
+            return XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
+        case 3:
+            return XR_PERF_SETTINGS_LEVEL_BOOST_EXT;
+        default:
+            ALOGE("Invalid performance level %d", level);
+            return XR_PERF_SETTINGS_LEVEL_SUSTAINED_HIGH_EXT;
+    }
+}
+
+void App::ApplyPerfSettings() {
+    OXR(xrPerfSettingsSetPerformanceLevelEXT(
+        Session, XR_PERF_SETTINGS_DOMAIN_CPU_EXT, PerfSettingsLevel(CpuLevel)));
+    OXR(xrPerfSettingsSetPerformanceLevelEXT(
+        Session, XR_PERF_SETTINGS_DOMAIN_GPU_EXT, PerfSettingsLevel(GpuLevel)));
+
+    // Most changes are of the levels only, the rate is requested when it is a new one.
+    const float refreshRate = Governor.settings().refreshRate;
+    if (RefreshRateSupported && refreshRate != 0 && refreshRate != RefreshRate) {
+        // The runtime confirms the switch with XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB.
+        OXR(xrRequestDisplayRefreshRateFB(Session, refreshRate));
+        RefreshRate = refreshRate;
+    }
+}
+
 void App::HandleXrEvents() {
     XrEventDataBuffer eventDataBuffer = {};
 
@@ -433,6 +452,28 @@ void App::HandleXrEvents() {
                     perf_settings_event->subDomain,
                     perf_settings_event->fromLevel,
                     perf_settings_event->toLevel);
+                if (perf_settings_event->subDomain == XR_PERF_SETTINGS_SUB_DOMAIN_THERMAL_EXT) {
+                    Thermal level = Thermal::normal;
+                    if (perf_settings_event->toLevel == XR_PERF_SETTINGS_NOTIF_LEVEL_WARNING_EXT) {
+                        level = Thermal::warning;
+                    } else if (perf_settings_event->toLevel == XR_PERF_SETTINGS_NOTIF_LEVEL_IMPAIRED_EXT) {
+                        level = Thermal::impaired;
+                    }
+                    Governor.thermal(
+                        perf_settings_event->domain == XR_PERF_SETTINGS_DOMAIN_GPU_EXT ? PerfDomain::gpu
+                                                                                       : PerfDomain::cpu,
+                        level);
+                }
+            } break;
+            case XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB: {
+                const XrEventDataDisplayRefreshRateChangedFB* refresh_rate_changed_event =
+                    (XrEventDataDisplayRefreshRateChangedFB*)(baseEventHeader);
+                ALOGV(
+                    "xrPollEvent: received XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB event: %.1f Hz -> %.1f Hz",
+                    refresh_rate_changed_event->fromDisplayRefreshRate,
+                    refresh_rate_changed_event->toDisplayRefreshRate);
+                RefreshRate = refresh_rate_changed_event->toDisplayRefreshRate;
+                Governor.refreshRateChanged(refresh_rate_changed_event->toDisplayRefreshRate);
             } break;
             case XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING:
                 ALOGV(
@@ -472,6 +513,208 @@ void App::HandleXrEvents() {
 /*
 ================================================================================
 
+RenderThread
+
+================================================================================
+*/
+
+static void* RenderThreadFunction(void* parm) {
+    RenderThread* renderer = (RenderThread*)parm;
+    App* app = renderer->app;
+
+    prctl(PR_SET_NAME, (long)"RenderThread", 0, 0, 0);
+
+    if (eglMakeCurrent(
+            app->egl.Display, app->egl.TinySurface, app->egl.TinySurface, app->egl.Context) ==
+        EGL_FALSE) {
+        ALOGE("        eglMakeCurrent() failed: %s", EglErrorString(eglGetError()));
+    }
+    app->RenderThreadTid = gettid();
+    sem_post(&renderer->Started);
+
+    renderer->Run();
+
+    eglMakeCurrent(app->egl.Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    return NULL;
+}
+
+void RenderThread::Start(App* _app, XrPassthroughLayerFB passthroughLayer) {
+    app = _app;
+    PassthroughLayer = passthroughLayer;
+    Quit = false;
+    FramesPublished = 0;
+    FramesSubmitted = 0;
+    pthread_mutex_init(&SubmittedMutex, NULL);
+    pthread_cond_init(&Submitted, NULL);
+    sem_init(&Started, 0, 0);
+    sem_init(&FrameReady, 0, 0);
+
+    // A context can only be current on one thread.
+    eglMakeCurrent(app->egl.Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    pthread_create(&Thread, NULL, RenderThreadFunction, this);
+
+    // RenderThreadTid must be known before the session begins.
+    while (sem_wait(&Started) != 0) {
+    }
+}
+
+void RenderThread::Stop() {
+    WaitIdle();
+    Quit = true;
+    sem_post(&FrameReady);
+    pthread_join(Thread, NULL);
+
+    sem_destroy(&FrameReady);
+    sem_destroy(&Started);
+    pthread_cond_destroy(&Submitted);
+    pthread_mutex_destroy(&SubmittedMutex);
+    app->RenderThreadTid = 0;
+
+    eglMakeCurrent(app->egl.Display, app->egl.TinySurface, app->egl.TinySurface, app->egl.Context);
+}
+
+FrameSnapshot& RenderThread::Frame() {
+    return Frames.writeBuffer();
+}
+
+void RenderThread::Publish() {
+    Frames.writeBuffer().index = ++FramesPublished;
+    Frames.publish();
+    sem_post(&FrameReady);
+}
+
+void RenderThread::WaitIdle() {
+    pthread_mutex_lock(&SubmittedMutex);
+    while (FramesSubmitted < FramesPublished) {
+        pthread_cond_wait(&Submitted, &SubmittedMutex);
+    }
+    pthread_mutex_unlock(&SubmittedMutex);
+}
+
+void RenderThread::Run() {
+    for (;;) {
+        if (sem_wait(&FrameReady) != 0) {
+            continue; // interrupted
+        }
+        if (Quit) {
+            break;
+        }
+        // A frame replaced by a newer one before it was picked up leaves an extra post behind.
+        if (!Frames.consume()) {
+            continue;
+        }
+
+        FrameSnapshot& frame = Frames.readBuffer();
+        SubmitFrame(frame);
+        pthread_mutex_lock(&SubmittedMutex);
+        FramesSubmitted = frame.index;
+        pthread_cond_broadcast(&Submitted);
+        pthread_mutex_unlock(&SubmittedMutex);
+    }
+}
+
+void RenderThread::SubmitFrame(FrameSnapshot& frame) {
+    XrFrameBeginInfo beginFrameDesc = {};
+    beginFrameDesc.type = XR_TYPE_FRAME_BEGIN_INFO;
+    beginFrameDesc.next = NULL;
+    OXR(xrBeginFrame(app->Session, &beginFrameDesc));
+
+    uint32_t chainIndex = 0;
+    XrSwapchainImageAcquireInfo acquireInfo = {XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO, NULL};
+    OXR(xrAcquireSwapchainImage(app->ColorSwapChain, &acquireInfo, &chainIndex));
+    frame.frameIn.swapChainIndex = int(chainIndex);
+
+    XrSwapchainImageWaitInfo waitInfo;
+    waitInfo.type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+    waitInfo.next = NULL;
+    waitInfo.timeout = 1000000000; /* timeout in nanoseconds */
+    XrResult res = xrWaitSwapchainImage(app->ColorSwapChain, &waitInfo);
+    int retry = 0;
+    while (res == XR_TIMEOUT_EXPIRED) {
+        res = xrWaitSwapchainImage(app->ColorSwapChain, &waitInfo);
+        retry++;
+        ALOGV(
+            " Retry xrWaitSwapchainImage %d times due to XR_TIMEOUT_EXPIRED (duration %f seconds)",
+            retry,
+            waitInfo.timeout * (1E-9));
+    }
+
+    {
+        ScopedTimer timer(app->appRenderer.scene.profiler, Timer::renderFrame);
+        app->appRenderer.renderFrame(frame.frameIn, frame.queue);
+    }
+
+    XrSwapchainImageReleaseInfo releaseInfo = {XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO, NULL};
+    OXR(xrReleaseSwapchainImage(app->ColorSwapChain, &releaseInfo));
+
+    // Set-up the compositor layers for this frame.
+    // NOTE: Multiple independent layers are allowed, but they need to be added
+    // in a depth consistent order.
+
+    XrCompositionLayerProjectionView proj_views[2] = {};
+
+    app->LayerCount = 0;
+    memset(app->Layers, 0, sizeof(CompositionLayerUnion) * MaxLayerCount);
+
+    // FB_passthrough sample begin
+    // passthrough layer is backmost layer (if available)
+    if (PassthroughLayer != XR_NULL_HANDLE) {
+        XrCompositionLayerPassthroughFB passthrough_layer = {};
+        passthrough_layer.type = XR_TYPE_COMPOSITION_LAYER_PASSTHROUGH_FB;
+        passthrough_layer.layerHandle = PassthroughLayer;
+        passthrough_layer.flags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+        passthrough_layer.space = XR_NULL_HANDLE;
+        app->Layers[app->LayerCount++].Passthrough = passthrough_layer;
+    }
+    // FB_passthrough sample end
+
+    XrCompositionLayerProjection proj_layer = {};
+    proj_layer.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION;
+    proj_layer.layerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+    proj_layer.layerFlags |= XR_COMPOSITION_LAYER_CORRECT_CHROMATIC_ABERRATION_BIT;
+    proj_layer.layerFlags |= XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT;
+    proj_layer.space = app->LocalSpace;
+    proj_layer.viewCount = NUM_EYES;
+    proj_layer.views = proj_views;
+
+    for (int eye = 0; eye < NUM_EYES; eye++) {
+        XrCompositionLayerProjectionView& proj_view = proj_views[eye];
+        proj_view = {};
+        proj_view.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        proj_view.pose = frame.xfLocalFromEye[eye];
+        proj_view.fov = frame.fov[eye];
+
+        proj_view.subImage.swapchain = app->ColorSwapChain;
+        proj_view.subImage.imageRect.offset.x = 0;
+        proj_view.subImage.imageRect.offset.y = 0;
+        proj_view.subImage.imageRect.extent.width = app->appRenderer.framebuffer.width;
+        proj_view.subImage.imageRect.extent.height = app->appRenderer.framebuffer.height;
+        proj_view.subImage.imageArrayIndex = eye;
+    }
+
+    app->Layers[app->LayerCount++].Projection = proj_layer;
+
+    // Compose the layers for this frame.
+    const XrCompositionLayerBaseHeader* layers[MaxLayerCount] = {};
+    for (int i = 0; i < app->LayerCount; i++) {
+        layers[i] = (const XrCompositionLayerBaseHeader*)&app->Layers[i];
+    }
+
+    XrFrameEndInfo endFrameInfo = {};
+    endFrameInfo.type = XR_TYPE_FRAME_END_INFO;
+    endFrameInfo.displayTime = frame.displayTime;
+    endFrameInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+    endFrameInfo.layerCount = app->LayerCount;
+    endFrameInfo.layers = layers;
+
+    ScopedTimer timer(app->appRenderer.scene.profiler, Timer::endFrame);
+    OXR(xrEndFrame(app->Session, &endFrameInfo));
+}
+
+/*
+================================================================================
+
 Native Activity
 
 ================================================================================
@@ -622,6 +865,8 @@ void android_main(struct android_app* androidApp) {
         XR_FB_TRIANGLE_MESH_EXTENSION_NAME};
     const uint32_t numRequiredExtensions =
         sizeof(requiredExtensionNames) / sizeof(requiredExtensionNames[0]);
+    std::vector<const char*> enabledExtensionNames(
+        requiredExtensionNames, requiredExtensionNames + numRequiredExtensions);
 
     // Check the list of required extensions against what is supported by the runtime.
     {
@@ -672,6 +917,27 @@ void android_main(struct android_app* androidApp) {
             }
         }
 
+        // Without these the display runs at the system's refresh rate, there is no hand input, and the
+        // time stamps of MIDI notes are taken as display times.
+        struct OptionalExtension {
+            const char* name;
+            bool* supported;
+        };
+        const OptionalExtension optionalExtensions[] = {
+            {XR_FB_DISPLAY_REFRESH_RATE_EXTENSION_NAME, &app.RefreshRateSupported},
+            {XR_EXT_HAND_TRACKING_EXTENSION_NAME, &app.HandTrackingSupported},
+            {XR_KHR_CONVERT_TIMESPEC_TIME_EXTENSION_NAME, &app.TimespecConversionSupported}};
+        for (const OptionalExtension& optional : optionalExtensions) {
+            for (uint32_t j = 0; j < numOutputExtensions; j++) {
+                if (!strcmp(optional.name, extensionProperties[j].extensionName)) {
+                    ALOGV("Found optional extension %s", optional.name);
+                    enabledExtensionNames.push_back(optional.name);
+                    *optional.supported = true;
+                    break;
+                }
+            }
+        }
+
         delete[] extensionProperties;
     }
 
@@ -690,8 +956,8 @@ void android_main(struct android_app* androidApp) {
     instanceCreateInfo.applicationInfo = appInfo;
     instanceCreateInfo.enabledApiLayerCount = 0;
     instanceCreateInfo.enabledApiLayerNames = NULL;
-    instanceCreateInfo.enabledExtensionCount = numRequiredExtensions;
-    instanceCreateInfo.enabledExtensionNames = requiredExtensionNames;
+    instanceCreateInfo.enabledExtensionCount = enabledExtensionNames.size();
+    instanceCreateInfo.enabledExtensionNames = enabledExtensionNames.data();
 
     XrResult initResult;
     OXR(initResult = xrCreateInstance(&instanceCreateInfo, &app.Instance));
@@ -798,6 +1064,13 @@ void android_main(struct android_app* androidApp) {
     INIT_PFN(xrGeometryInstanceSetTransformFB);
     // FB_passthrough sample end
 
+    INIT_PFN(xrPerfSettingsSetPerformanceLevelEXT);
+    if (app.RefreshRateSupported) {
+        INIT_PFN(xrEnumerateDisplayRefreshRatesFB);
+        INIT_PFN(xrGetDisplayRefreshRateFB);
+        INIT_PFN(xrRequestDisplayRefreshRateFB);
+    }
+
     // create the OpenXR Session.
     XrGraphicsBindingOpenGLESAndroidKHR graphicsBindingAndroidGLES = {};
     graphicsBindingAndroidGLES.type = XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR;
@@ -992,6 +1265,9 @@ void android_main(struct android_app* androidApp) {
     delete[] colorTextures;
 
     AppInput_init(app);
+    AppHands_init(app);
+    AppMidi_init(app);
+    AppAudio_init(app, std::string(androidApp->activity->internalDataPath) + "/piano");
 
     // FB_passthrough sample begin
     // create passthrough objects
@@ -1071,6 +1347,40 @@ void android_main(struct android_app* androidApp) {
     //create Engine obj and initialize it
     Engine engine{&app.appRenderer.scene};
 
+    // From here on only the render thread makes GL calls.
+    app.Renderer.Start(&app, passthroughLayer);
+
+    Profiler& profiler = app.appRenderer.scene.profiler;
+    profiler.openCsv(std::string(androidApp->activity->internalDataPath) + "/timings.csv");
+
+    // adb shell setprop debug.piarno.record_hands 1 records the hand joints for Tools/HandReplay.
+    HandRecorder handRecorder;
+    char recordHands[PROP_VALUE_MAX] = {};
+    __system_property_get("debug.piarno.record_hands", recordHands);
+    if (!strcmp(recordHands, "1")) {
+        const std::string path = std::string(androidApp->activity->internalDataPath) + "/hands.bin";
+        if (handRecorder.open(path)) {
+            ALOGV("Recording hand joints to %s", path.c_str());
+        } else {
+            ALOGE("Could not open %s", path.c_str());
+        }
+    }
+
+    // adb shell setprop debug.piarno.session_log 1 logs the played notes and their score for Tools/ScoreBench.
+    SessionLog sessionLog;
+    char logSession[PROP_VALUE_MAX] = {};
+    __system_property_get("debug.piarno.session_log", logSession);
+    if (!strcmp(logSession, "1")) {
+        const std::string path = std::string(androidApp->activity->internalDataPath) + "/session.bin";
+        if (sessionLog.open(path)) {
+            ALOGV("Logging the session to %s", path.c_str());
+            global::piarno->setSessionLog(&sessionLog);
+        } else {
+            ALOGE("Could not open %s", path.c_str());
+        }
+    }
+    XrTime lastDisplayTime = 0;
+
     while (androidApp->destroyRequested == 0) {
         frameCount++;
 
@@ -1102,7 +1412,10 @@ void android_main(struct android_app* androidApp) {
             continue;
         }
 
-        AppInput_syncActions(app);
+        {
+            ScopedTimer timer(profiler, Timer::input);
+            AppInput_syncActions(app);
+        }
 
         // Set up
         {
@@ -1138,17 +1451,45 @@ void android_main(struct android_app* androidApp) {
         frameState.type = XR_TYPE_FRAME_STATE;
         frameState.next = NULL;
 
-        OXR(xrWaitFrame(app.Session, &waitFrameInfo, &frameState));
+        // Blocks until the render thread has begun the previous frame.
+        {
+            ScopedTimer timer(profiler, Timer::waitFrame);
+            OXR(xrWaitFrame(app.Session, &waitFrameInfo, &frameState));
+        }
+
+        profiler.setBudget(FromXrTime(frameState.predictedDisplayPeriod) * 1000);
+        if (lastDisplayTime != 0) {
+            profiler.record(Timer::frame, FromXrTime(frameState.predictedDisplayTime - lastDisplayTime) * 1000);
+        }
+        lastDisplayTime = frameState.predictedDisplayTime;
+
+        // Adapt the refresh rate and the performance levels to what the last frames took.
+        {
+            const float mainThread = profiler.stats(Timer::update).p90 + profiler.stats(Timer::record).p90;
+            PerfGovernor::Load load;
+            load.budget = profiler.budget();
+            load.cpu = std::max(mainThread, profiler.stats(Timer::renderFrame).p90);
+            load.gpu = profiler.stats(Timer::gpu).p90;
+            load.playing = !engine.getClock().isPaused();
+            load.tiles = global::piarno->activeTiles();
+            if (app.Governor.update(FromXrTime(frameState.predictedDisplayTime), load)) {
+                const PerfGovernor::Settings& settings = app.Governor.settings();
+                ALOGV(
+                    "PerfGovernor: %.0f Hz, CPU %s, GPU %s (%s)",
+                    settings.refreshRate,
+                    PerfGovernor::name(settings.cpu),
+                    PerfGovernor::name(settings.gpu),
+                    app.Governor.reason());
+                app.CpuLevel = (int)settings.cpu;
+                app.GpuLevel = (int)settings.gpu;
+                app.ApplyPerfSettings();
+            }
+        }
 
         // Get the HMD pose, predicted for the middle of the time period during which
         // the new eye images will be displayed. The number of frames predicted ahead
         // depends on the pipeline depth of the engine and the synthesis rate.
         // The better the prediction, the less black will be pulled in at the edges.
-        XrFrameBeginInfo beginFrameDesc = {};
-        beginFrameDesc.type = XR_TYPE_FRAME_BEGIN_INFO;
-        beginFrameDesc.next = NULL;
-        OXR(xrBeginFrame(app.Session, &beginFrameDesc));
-
         XrPosef xfLocalFromHead;
         {
             XrSpaceLocation loc = {XR_TYPE_SPACE_LOCATION};
@@ -1198,6 +1539,9 @@ void android_main(struct android_app* androidApp) {
             }
         }
 
+        AppHands_locate(app, frameState.predictedDisplayTime);
+        handRecorder.write(FromXrTime(frameState.predictedDisplayTime), app.appRenderer.scene.trackedHand);
+
         // Simple animation
         double timeInSeconds = FromXrTime(frameState.predictedDisplayTime);
         if (startTimeInSeconds < 0.0) {
@@ -1206,24 +1550,24 @@ void android_main(struct android_app* androidApp) {
 
 
         //UPDATE
-        engine.update();
-
+        {
+            ScopedTimer timer(profiler, Timer::update);
+            engine.update(timeInSeconds);
+        }
 
-        //RENDER START
-        AppRenderer::FrameIn frameIn;
-        uint32_t chainIndex = 0;
-        XrSwapchainImageAcquireInfo acquireInfo = {XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO, NULL};
-        OXR(xrAcquireSwapchainImage(app.ColorSwapChain, &acquireInfo, &chainIndex));
-        frameIn.swapChainIndex = int(chainIndex);
 
-        XrPosef xfLocalFromEye[NUM_EYES];
+        //RECORD, the render thread draws it while the next frame is updated
+        FrameSnapshot& frame = app.Renderer.Frame();
+        AppRenderer::FrameIn& frameIn = frame.frameIn;
+        frame.displayTime = frameState.predictedDisplayTime;
 
         for (int eye = 0; eye < NUM_EYES; eye++) {
             // LOG_POSE( "viewTransform", &projectionInfo.projections[eye].viewTransform );
             XrPosef xfHeadFromEye = projections[eye].pose;
-            xfLocalFromEye[eye] = XrPosef_Multiply(xfLocalFromHead, xfHeadFromEye);
+            frame.xfLocalFromEye[eye] = XrPosef_Multiply(xfLocalFromHead, xfHeadFromEye);
+            frame.fov[eye] = projections[eye].fov;
 
-            XrPosef xfEyeFromLocal = XrPosef_Inverse(xfLocalFromEye[eye]);
+            XrPosef xfEyeFromLocal = XrPosef_Inverse(frame.xfLocalFromEye[eye]);
 
             XrMatrix4x4f viewMat = XrMatrix4x4f_CreateFromRigidTransform(&xfEyeFromLocal);
 
@@ -1248,91 +1592,27 @@ void android_main(struct android_app* androidApp) {
             frameIn.hasStage = false;
         }
 
-        XrSwapchainImageWaitInfo waitInfo;
-        waitInfo.type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
-        waitInfo.next = NULL;
-        waitInfo.timeout = 1000000000; /* timeout in nanoseconds */
-        XrResult res = xrWaitSwapchainImage(app.ColorSwapChain, &waitInfo);
-        int retry = 0;
-        while (res == XR_TIMEOUT_EXPIRED) {
-            res = xrWaitSwapchainImage(app.ColorSwapChain, &waitInfo);
-            retry++;
-            ALOGV(
-                " Retry xrWaitSwapchainImage %d times due to XR_TIMEOUT_EXPIRED (duration %f seconds)",
-                retry,
-                waitInfo.timeout * (1E-9));
-        }
-
-        app.appRenderer.renderFrame(frameIn, engine);
-
-        XrSwapchainImageReleaseInfo releaseInfo = {XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO, NULL};
-        OXR(xrReleaseSwapchainImage(app.ColorSwapChain, &releaseInfo));
-
-        // Set-up the compositor layers for this frame.
-        // NOTE: Multiple independent layers are allowed, but they need to be added
-        // in a depth consistent order.
-
-        XrCompositionLayerProjectionView proj_views[2] = {};
-
-        app.LayerCount = 0;
-        memset(app.Layers, 0, sizeof(CompositionLayerUnion) * MaxLayerCount);
-
-        // FB_passthrough sample begin
-        // passthrough layer is backmost layer (if available)
-        if (passthroughLayer != XR_NULL_HANDLE) {
-            XrCompositionLayerPassthroughFB passthrough_layer = {};
-            passthrough_layer.type = XR_TYPE_COMPOSITION_LAYER_PASSTHROUGH_FB;
-            passthrough_layer.layerHandle = passthroughLayer;
-            passthrough_layer.flags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
-            passthrough_layer.space = XR_NULL_HANDLE;
-            app.Layers[app.LayerCount++].Passthrough = passthrough_layer;
-        }
-        // FB_passthrough sample end
-
-        XrCompositionLayerProjection proj_layer = {};
-        proj_layer.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION;
-        proj_layer.layerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
-        proj_layer.layerFlags |= XR_COMPOSITION_LAYER_CORRECT_CHROMATIC_ABERRATION_BIT;
-        proj_layer.layerFlags |= XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT;
-        proj_layer.space = app.LocalSpace;
-        proj_layer.viewCount = NUM_EYES;
-        proj_layer.views = proj_views;
-
-        for (int eye = 0; eye < NUM_EYES; eye++) {
-            XrCompositionLayerProjectionView& proj_view = proj_views[eye];
-            proj_view = {};
-            proj_view.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
-            proj_view.pose = xfLocalFromEye[eye];
-            proj_view.fov = projections[eye].fov;
-
-            proj_view.subImage.swapchain = app.ColorSwapChain;
-            proj_view.subImage.imageRect.offset.x = 0;
-            proj_view.subImage.imageRect.offset.y = 0;
-            proj_view.subImage.imageRect.extent.width = width;
-            proj_view.subImage.imageRect.extent.height = height;
-            proj_view.subImage.imageArrayIndex = eye;
-        }
-
-        app.Layers[app.LayerCount++].Projection = proj_layer;
-
-        // Compose the layers for this frame.
-        const XrCompositionLayerBaseHeader* layers[MaxLayerCount] = {};
-        for (int i = 0; i < app.LayerCount; i++) {
-            layers[i] = (const XrCompositionLayerBaseHeader*)&app.Layers[i];
+        //Piarno will record all objects, then the snapshot takes them over
+        {
+            ScopedTimer timer(profiler, Timer::record);
+            engine.render();
+            app.appRenderer.scene.drawQueue.handOff(frame.queue);
         }
 
-        XrFrameEndInfo endFrameInfo = {};
-        endFrameInfo.type = XR_TYPE_FRAME_END_INFO;
-        endFrameInfo.displayTime = frameState.predictedDisplayTime;
-        endFrameInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
-        endFrameInfo.layerCount = app.LayerCount;
-        endFrameInfo.layers = layers;
-
-        OXR(xrEndFrame(app.Session, &endFrameInfo));
+        app.Renderer.Publish();
     }
 
+    app.Renderer.Stop();
+    profiler.closeCsv();
+    handRecorder.close();
+    global::piarno->setSessionLog(nullptr);
+    sessionLog.close();
+
     app.appRenderer.destroy();
 
+    AppAudio_shutdown();
+    AppMidi_shutdown();
+    AppHands_shutdown();
     AppInput_shutdown();
 
     delete[] projections;
@@ -4,15 +4,22 @@
 #include <EGL/eglext.h>
 #include <GLES3/gl3.h>
 #include <GLES3/gl3ext.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <atomic>
+#include <time.h>
 
 #define XR_USE_GRAPHICS_API_OPENGL_ES 1
 #define XR_USE_PLATFORM_ANDROID 1
+#define XR_USE_TIMESPEC 1
 #include <openxr/openxr.h>
 #include <openxr/openxr_oculus.h>
 #include <openxr/openxr_oculus_helpers.h>
 #include <openxr/openxr_platform.h>
 
 #include "XrPassthroughGl.h"
+#include "TripleBuffer.h"
+#include "PerfGovernor.h"
 
 void OXR_CheckErrors(XrResult result, const char* function, bool failOnError);
 #define OXR(func) OXR_CheckErrors(func, #func, true);
@@ -73,6 +80,60 @@ struct Egl {
 /*
 ================================================================================
 
+RenderThread
+
+================================================================================
+*/
+
+// Everything the render thread needs to submit one frame. The main thread records it and does not
+// touch it anymore once it is published.
+struct FrameSnapshot {
+    uint64_t index; // counts the published frames
+    XrTime displayTime;
+    AppRenderer::FrameIn frameIn; // swapChainIndex is filled in by the render thread
+    XrPosef xfLocalFromEye[NUM_EYES];
+    XrFovf fov[NUM_EYES];
+    DrawQueue queue; // draws recorded by the Engine
+};
+
+struct App;
+
+// Owns the EGL context and submits the frames recorded by the main thread: while the main thread updates
+// the Engine for frame N+1, this thread renders frame N between xrBeginFrame and xrEndFrame.
+// xrWaitFrame of frame N+1 (main thread) blocks until frame N has begun, so the main thread stays
+// at most one frame ahead and frame pacing is still driven by the runtime.
+struct RenderThread {
+    // the main thread must have the EGL context current, it is handed over to the render thread
+    void Start(App* app, XrPassthroughLayerFB passthroughLayer);
+    // submits the remaining frames, then the EGL context is current on the calling thread again
+    void Stop();
+
+    // the snapshot the main thread records into
+    FrameSnapshot& Frame();
+    // hand Frame() to the render thread
+    void Publish();
+    // block until every published frame was submitted, e.g. before the session ends
+    void WaitIdle();
+
+    void Run();
+    void SubmitFrame(FrameSnapshot& frame);
+
+    App* app;
+    XrPassthroughLayerFB PassthroughLayer;
+    pthread_t Thread;
+    sem_t Started;
+    sem_t FrameReady; // posted once per published frame, and to quit
+    std::atomic<bool> Quit;
+    TripleBuffer<FrameSnapshot> Frames;
+    uint64_t FramesPublished;
+    pthread_mutex_t SubmittedMutex;
+    pthread_cond_t Submitted; // signaled after each submitted frame, for WaitIdle
+    uint64_t FramesSubmitted; // index of the last submitted frame, guarded by SubmittedMutex
+};
+
+/*
+================================================================================
+
 App
 
 ================================================================================
@@ -95,6 +156,7 @@ struct App {
     void Clear();
     void HandleSessionStateChanges(XrSessionState state);
     void HandleXrEvents();
+    void ApplyPerfSettings(); // CpuLevel, GpuLevel and the governor's refresh rate
 
     Egl egl;
     ANativeWindow* NativeWindow;
@@ -114,6 +176,12 @@ struct App {
     int SwapInterval;
     int CpuLevel;
     int GpuLevel;
+    bool RefreshRateSupported; // XR_FB_display_refresh_rate
+    float RefreshRate; // the display runs at or was last asked for, 0 if unknown
+    bool HandTrackingSupported; // XR_EXT_hand_tracking
+    bool TimespecConversionSupported; // XR_KHR_convert_timespec_time
+    // Picks the levels and the refresh rate from the frame timings while the session runs.
+    PerfGovernor Governor{{0, PerfLevel::sustainedHigh, PerfLevel::sustainedHigh}};
     // These threads will be marked as performance threads.
     int MainThreadTid;
     int RenderThreadTid;
@@ -127,4 +195,5 @@ struct App {
     OVR::Vector3f StageBounds;
     // Provided by XrPassthroughGl, which is not aware of VrApi or OpenXR
     AppRenderer appRenderer;
+    RenderThread Renderer;
 };
@@ -0,0 +1,204 @@
+#include <android/log.h>
+#include <dlfcn.h>
+#include <mutex>
+#include <thread>
+
+#include "XrPassthrough.h"
+#include "XrPassthroughAudio.h"
+#include "MidiInput.h"
+#include "SampleBank.h"
+#include "Synth.h"
+
+#define LOG_TAG "XrPassthrough"
+
+#define ALOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define ALOGV(...) __android_log_print(ANDROID_LOG_VERBOSE, LOG_TAG, __VA_ARGS__)
+
+namespace {
+
+// The part of <aaudio/AAudio.h> that is used. The library is only there from Android 8 on and the app still
+// starts on 7, so it is loaded with dlopen instead of being linked.
+struct AAudioStreamBuilder;
+struct AAudioStream;
+typedef int32_t aaudio_result_t;
+const int32_t AAUDIO_OK = 0;
+const int32_t AAUDIO_FORMAT_PCM_FLOAT = 2;
+const int32_t AAUDIO_SHARING_MODE_SHARED = 1;
+const int32_t AAUDIO_PERFORMANCE_MODE_LOW_LATENCY = 12;
+const int32_t AAUDIO_CALLBACK_RESULT_CONTINUE = 0;
+typedef int32_t (*DataCallback)(AAudioStream* stream, void* userData, void* audioData, int32_t numFrames);
+typedef void (*ErrorCallback)(AAudioStream* stream, void* userData, aaudio_result_t error);
+
+struct AAudioApi {
+    aaudio_result_t (*createStreamBuilder)(AAudioStreamBuilder** builder) = nullptr;
+    void (*setPerformanceMode)(AAudioStreamBuilder* builder, int32_t mode) = nullptr;
+    void (*setSharingMode)(AAudioStreamBuilder* builder, int32_t mode) = nullptr;
+    void (*setFormat)(AAudioStreamBuilder* builder, int32_t format) = nullptr;
+    void (*setChannelCount)(AAudioStreamBuilder* builder, int32_t channelCount) = nullptr;
+    void (*setDataCallback)(AAudioStreamBuilder* builder, DataCallback callback, void* userData) = nullptr;
+    void (*setErrorCallback)(AAudioStreamBuilder* builder, ErrorCallback callback, void* userData) = nullptr;
+    aaudio_result_t (*openStream)(AAudioStreamBuilder* builder, AAudioStream** stream) = nullptr;
+    aaudio_result_t (*deleteBuilder)(AAudioStreamBuilder* builder) = nullptr;
+    aaudio_result_t (*requestStart)(AAudioStream* stream) = nullptr;
+    aaudio_result_t (*requestStop)(AAudioStream* stream) = nullptr;
+    aaudio_result_t (*close)(AAudioStream* stream) = nullptr;
+    int32_t (*getSampleRate)(AAudioStream* stream) = nullptr;
+    int32_t (*getFramesPerBurst)(AAudioStream* stream) = nullptr;
+    aaudio_result_t (*setBufferSizeInFrames)(AAudioStream* stream, int32_t numFrames) = nullptr;
+    int64_t (*getFramesWritten)(AAudioStream* stream) = nullptr;
+    int64_t (*getFramesRead)(AAudioStream* stream) = nullptr;
+
+    bool load() {
+        if (createStreamBuilder)
+            return true;
+        void* library = dlopen("libaaudio.so", RTLD_NOW);
+        if (!library)
+            return false;
+        void* functions[] = {
+            dlsym(library, "AAudio_createStreamBuilder"),
+            dlsym(library, "AAudioStreamBuilder_setPerformanceMode"),
+            dlsym(library, "AAudioStreamBuilder_setSharingMode"),
+            dlsym(library, "AAudioStreamBuilder_setFormat"),
+            dlsym(library, "AAudioStreamBuilder_setChannelCount"),
+            dlsym(library, "AAudioStreamBuilder_setDataCallback"),
+            dlsym(library, "AAudioStreamBuilder_setErrorCallback"),
+            dlsym(library, "AAudioStreamBuilder_openStream"),
+            dlsym(library, "AAudioStreamBuilder_delete"),
+            dlsym(library, "AAudioStream_requestStart"),
+            dlsym(library, "AAudioStream_requestStop"),
+            dlsym(library, "AAudioStream_close"),
+            dlsym(library, "AAudioStream_getSampleRate"),
+            dlsym(library, "AAudioStream_getFramesPerBurst"),
+            dlsym(library, "AAudioStream_setBufferSizeInFrames"),
+            dlsym(library, "AAudioStream_getFramesWritten"),
+            dlsym(library, "AAudioStream_getFramesRead"),
+        };
+        for (void* f : functions) {
+            if (!f)
+                return false;
+        }
+        createStreamBuilder = (decltype(createStreamBuilder))functions[0];
+        setPerformanceMode = (decltype(setPerformanceMode))functions[1];
+        setSharingMode = (decltype(setSharingMode))functions[2];
+        setFormat = (decltype(setFormat))functions[3];
+        setChannelCount = (decltype(setChannelCount))functions[4];
+        setDataCallback = (decltype(setDataCallback))functions[5];
+        setErrorCallback = (decltype(setErrorCallback))functions[6];
+        openStream = (decltype(openStream))functions[7];
+        deleteBuilder = (decltype(deleteBuilder))functions[8];
+        requestStart = (decltype(requestStart))functions[9];
+        requestStop = (decltype(requestStop))functions[10];
+        close = (decltype(close))functions[11];
+        getSampleRate = (decltype(getSampleRate))functions[12];
+        getFramesPerBurst = (decltype(getFramesPerBurst))functions[13];
+        setBufferSizeInFrames = (decltype(setBufferSizeInFrames))functions[14];
+        getFramesWritten = (decltype(getFramesWritten))functions[15];
+        getFramesRead = (decltype(getFramesRead))functions[16];
+        return true;
+    }
+};
+AAudioApi aaudio;
+
+// The stream is opened by the starter thread and, after a disconnect, by a thread of its own.
+std::mutex mutex;
+Synth* synth = nullptr;
+SampleBank bank;
+std::string sampleDirectory;
+AAudioStream* stream = nullptr;
+std::thread starter;
+
+// The audio thread: the frames are heard after the ones that are still queued in front of them.
+int32_t Render(AAudioStream* audioStream, void* userData, void* audioData, int32_t numFrames) {
+    Synth* target = static_cast<Synth*>(userData);
+    int64_t queued = aaudio.getFramesWritten(audioStream) - aaudio.getFramesRead(audioStream);
+    target->render(static_cast<float*>(audioData), numFrames, MidiInput::now() + queued / target->rate());
+    return AAUDIO_CALLBACK_RESULT_CONTINUE;
+}
+
+void Restart();
+
+// A disconnect (e.g. headphones plugged in) ends the stream, it can't be opened again from its own callback.
+void OnError(AAudioStream*, void*, aaudio_result_t error) {
+    ALOGE("Audio: stream error %d, opening it again", error);
+    std::thread(Restart).detach();
+}
+
+// with the mutex held
+void OpenStream() {
+    if (!synth || stream)
+        return;
+    if (!aaudio.load()) {
+        ALOGV("Audio: no AAudio before Android 8, the songs are silent");
+        return;
+    }
+
+    AAudioStreamBuilder* builder;
+    if (aaudio.createStreamBuilder(&builder) != AAUDIO_OK)
+        return;
+    aaudio.setPerformanceMode(builder, AAUDIO_PERFORMANCE_MODE_LOW_LATENCY);
+    aaudio.setSharingMode(builder, AAUDIO_SHARING_MODE_SHARED);
+    aaudio.setFormat(builder, AAUDIO_FORMAT_PCM_FLOAT);
+    aaudio.setChannelCount(builder, Synth::CHANNELS);
+    aaudio.setDataCallback(builder, Render, synth);
+    aaudio.setErrorCallback(builder, OnError, nullptr);
+    aaudio_result_t result = aaudio.openStream(builder, &stream);
+    aaudio.deleteBuilder(builder);
+    if (result != AAUDIO_OK) {
+        ALOGE("Audio: could not open the output stream (%d)", result);
+        stream = nullptr;
+        return;
+    }
+
+    //two bursts queued: the least that doesn't glitch when the callback is a little late
+    aaudio.setBufferSizeInFrames(stream, 2 * aaudio.getFramesPerBurst(stream));
+    float rate = aaudio.getSampleRate(stream);
+    if (bank.empty()) {
+        size_t loaded = bank.loadVorbis(sampleDirectory);
+        if (loaded == 0)
+            bank.synthesize(rate);
+        ALOGV("Audio: %zu piano samples from %s", loaded, loaded ? sampleDirectory.c_str() : "the synthesizer");
+    }
+    synth->init(bank, rate);
+
+    if (aaudio.requestStart(stream) != AAUDIO_OK) {
+        ALOGE("Audio: could not start the output stream");
+        aaudio.close(stream);
+        stream = nullptr;
+        return;
+    }
+    ALOGV("Audio: %.0f Hz, %d frames per burst", rate, aaudio.getFramesPerBurst(stream));
+}
+
+void CloseStream() {
+    if (!stream)
+        return;
+    aaudio.requestStop(stream);
+    aaudio.close(stream);
+    stream = nullptr;
+}
+
+void Restart() {
+    std::lock_guard<std::mutex> lock(mutex);
+    CloseStream();
+    OpenStream();
+}
+
+} // namespace
+
+void AppAudio_init(App& app, const std::string& samples) {
+    std::lock_guard<std::mutex> lock(mutex);
+    synth = &app.appRenderer.scene.synth;
+    sampleDirectory = samples;
+    starter = std::thread([] {
+        std::lock_guard<std::mutex> starterLock(mutex);
+        OpenStream();
+    });
+}
+
+void AppAudio_shutdown() {
+    if (starter.joinable())
+        starter.join();
+    std::lock_guard<std::mutex> lock(mutex);
+    CloseStream();
+    synth = nullptr;
+}
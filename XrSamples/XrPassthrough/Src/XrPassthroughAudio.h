@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+
+struct App;
+
+// Sound output through AAudio: a low latency stream whose callback renders the scene's synth.
+// The samples are loaded from <sampleDirectory>/<MIDI key>.ogg, or generated if there are none, and the stream
+// is opened on a thread of its own, so AppAudio_init() doesn't hold up the first frames.
+// Needs Android 8 for AAudio, which is loaded at run time; on older versions there is no sound.
+void AppAudio_init(App& app, const std::string& sampleDirectory);
+void AppAudio_shutdown();
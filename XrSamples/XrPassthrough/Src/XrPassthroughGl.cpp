@@ -17,6 +17,8 @@ Copyright	:	Copyright (c) Facebook Technologies, LLC and its affiliates. All rig
 #include <math.h>
 #include <time.h>
 #include <vector>
+#include <algorithm>
+#include <iterator>
 #include <unistd.h>
 #include <pthread.h>
 #include <sys/prctl.h> // for prctl( PR_SET_NAME )
@@ -51,6 +53,15 @@ using namespace OVR;
 #define GL_FRAMEBUFFER_SRGB_EXT 0x8DB9
 #endif
 
+// EXT_disjoint_timer_query, the query functions are the GLES 3 ones
+#ifndef GL_TIME_ELAPSED_EXT
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#endif
+
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
 #if !defined(GL_EXT_multisampled_render_to_texture)
 
 typedef void(GL_APIENTRY *PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)(
@@ -118,6 +129,7 @@ namespace {
         bool multi_view; // GL_OVR_multiview, GL_OVR_multiview2
         bool EXT_texture_border_clamp; // GL_EXT_texture_border_clamp, GL_OES_texture_border_clamp
         bool EXT_sRGB_write_control;
+        bool EXT_disjoint_timer_query;
     };
 
     OpenGLExtensions_t glExtensions;
@@ -135,6 +147,7 @@ static void EglInitExtensions() {
                 strstr(allExtensions, "GL_EXT_texture_border_clamp") ||
                 strstr(allExtensions, "GL_OES_texture_border_clamp");
         glExtensions.EXT_sRGB_write_control = strstr(allExtensions, "GL_EXT_sRGB_write_control");
+        glExtensions.EXT_disjoint_timer_query = strstr(allExtensions, "GL_EXT_disjoint_timer_query");
     }
 }
 
@@ -204,7 +217,8 @@ enum VertexAttributeLocation {
     VERTEX_ATTRIBUTE_LOCATION_POSITION,
     VERTEX_ATTRIBUTE_LOCATION_COLOR,
     VERTEX_ATTRIBUTE_LOCATION_UV,
-    VERTEX_ATTRIBUTE_LOCATION_TRANSFORM
+    VERTEX_ATTRIBUTE_LOCATION_TRANSFORM, // mat4, takes up 4 locations
+    VERTEX_ATTRIBUTE_LOCATION_INSTANCE_COLOR = VERTEX_ATTRIBUTE_LOCATION_TRANSFORM + 4
 };
 
 struct VertexAttribute {
@@ -216,7 +230,8 @@ static VertexAttribute ProgramVertexAttributes[] = {
         {VERTEX_ATTRIBUTE_LOCATION_POSITION,  "vertexPosition"},
         {VERTEX_ATTRIBUTE_LOCATION_COLOR,     "vertexColor"},
         {VERTEX_ATTRIBUTE_LOCATION_UV,        "vertexUv"},
-        {VERTEX_ATTRIBUTE_LOCATION_TRANSFORM, "vertexTransform"}};
+        {VERTEX_ATTRIBUTE_LOCATION_TRANSFORM, "vertexTransform"},
+        {VERTEX_ATTRIBUTE_LOCATION_INSTANCE_COLOR, "vertexInstanceColor"}};
 
 
 /*
@@ -416,6 +431,121 @@ static const char FRAGMENT_SHADER_UNIFORM_COLOR[] =
         "   outColor = fragmentColor;\n"
         "}\n";
 
+static const char VERTEX_SHADER_INSTANCED[] =
+        "#define NUM_VIEWS 2\n"
+        "#define VIEW_ID gl_ViewID_OVR\n"
+        "#extension GL_OVR_multiview2 : require\n"
+        "layout(num_views=NUM_VIEWS) in;\n"
+        "in vec3 vertexPosition;\n"
+        "in vec4 vertexColor;\n"
+        "in mat4 vertexTransform;\n"
+        "in vec4 vertexInstanceColor;\n"
+        "uniform sceneMatrices\n"
+        "{\n"
+        "   uniform mat4 ViewMatrix[NUM_VIEWS];\n"
+        "   uniform mat4 ProjectionMatrix[NUM_VIEWS];\n"
+        "} sm;\n"
+        "out vec4 fragmentColor;\n"
+        "void main()\n"
+        "{\n"
+        "   gl_Position = sm.ProjectionMatrix[VIEW_ID] * ( sm.ViewMatrix[VIEW_ID] * ( vertexTransform * ( vec4( vertexPosition, 1.0 ) ) ) );\n"
+        "   fragmentColor = vertexColor * vertexInstanceColor;\n"
+        "}\n";
+
+/*
+================================================================================
+
+StreamBuffer
+
+================================================================================
+*/
+
+void StreamBuffer::clear() {
+    buffer = 0;
+    frameSize = 0;
+    frameIndex = 0;
+    frameOffset = 0;
+    for (auto &f: fences)
+        f = nullptr;
+    uploads = 0;
+    uploadedBytes = 0;
+}
+
+void StreamBuffer::create(size_t size) {
+    clear();
+    frameSize = size;
+    GL(glGenBuffers(1, &buffer));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+    GL(glBufferData(GL_ARRAY_BUFFER, NUM_FRAMES * frameSize, nullptr, GL_STREAM_DRAW));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+}
+
+void StreamBuffer::destroy() {
+    for (auto &f: fences) {
+        if (f)
+            GL(glDeleteSync(f));
+    }
+    GL(glDeleteBuffers(1, &buffer));
+    clear();
+}
+
+void StreamBuffer::beginFrame(size_t frameBytes) {
+    uploads = 0;
+    uploadedBytes = 0;
+
+    size_t aligned = (frameBytes + 15) & ~size_t(15);
+    if (aligned > frameSize) {
+        //grow all regions: glBufferData orphans the old storage, the GPU still reads the frames in flight
+        //from it and their fences stay, nothing writes to the new storage before they are waited for
+        while (aligned > frameSize)
+            frameSize *= 2;
+        ALOGE("StreamBuffer: growing to %zu bytes per frame", frameSize);
+        GL(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+        GL(glBufferData(GL_ARRAY_BUFFER, NUM_FRAMES * frameSize, nullptr, GL_STREAM_DRAW));
+        GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+    }
+
+    frameIndex = (frameIndex + 1) % NUM_FRAMES;
+    frameOffset = 0;
+
+    //the region was last used NUM_FRAMES frames ago, this will rarely block
+    if (GLsync &f = fences[frameIndex]) {
+        GL(glClientWaitSync(f, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000));
+        GL(glDeleteSync(f));
+        f = nullptr;
+    }
+}
+
+void StreamBuffer::endFrame() {
+    GLsync &f = fences[frameIndex];
+    if (f)
+        GL(glDeleteSync(f));
+    GL(f = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+}
+
+GLintptr StreamBuffer::write(const void *data, size_t size) {
+    size_t aligned = (size + 15) & ~size_t(15);
+
+    if (frameOffset + aligned > frameSize) {
+        ALOGE("StreamBuffer: %zu bytes don't fit into the frame's region, it was sized by beginFrame", size);
+        return -1;
+    }
+
+    GL(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+    GLintptr offset = frameIndex * frameSize + frameOffset;
+    GL(void *dst = glMapBufferRange(GL_ARRAY_BUFFER, offset, size,
+                                    GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT));
+    if (dst != nullptr)
+        memcpy(dst, data, size);
+    GL(glUnmapBuffer(GL_ARRAY_BUFFER));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+
+    frameOffset += aligned;
+    uploads++;
+    uploadedBytes += size;
+    return offset;
+}
+
 /*
 ================================================================================
 
@@ -437,7 +567,7 @@ Geometry::Geometry(
     GL(glGenBuffers(1, &indexBuffer));
 
     updateVertices(vertexPositions);
-    updateColors(colors);
+    uploadColors(colors.data(), colors.size());
     updateIndices(indices);
 }
 
@@ -512,6 +642,23 @@ void Geometry::destroyVAO() {
     GL(glDeleteVertexArrays(1, &vertexArrayObject));
 }
 
+void Geometry::createBuffers(const std::vector<vertex_t> &vertexPositions, const std::vector<index_t> &indices) {
+    GL(glGenBuffers(1, &vertexBuffer));
+    GL(glGenBuffers(1, &indexBuffer));
+
+    GL(glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer));
+    GL(glBufferData(GL_ARRAY_BUFFER, vertexPositions.size() * sizeof(float), vertexPositions.data(),
+                    GL_STATIC_DRAW));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+
+    GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer));
+    GL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned short),
+                    indices.data(), GL_STATIC_DRAW));
+    GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    createVAO();
+}
+
 void Geometry::updateVertices(const std::vector<vertex_t> &vertexPositions) {
     vertexCount = vertexPositions.size();
     GL(glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer));
@@ -520,21 +667,33 @@ void Geometry::updateVertices(const std::vector<vertex_t> &vertexPositions) {
     GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
 }
 
-void Geometry::updateColors(const std::vector<color_t> &colors) {
+static bool isTranslucent(const color_t *rgba, size_t size) {
+    for (size_t i = 3; i < size; i += 4) {
+        if (rgba[i] < 255)
+            return true;
+    }
+    return false;
+}
+
+void Geometry::updateColors(const color_t *colors, size_t size) {
     if(!global_color) {
-        GL(glBindVertexArray(vertexArrayObject));
-        GL(glBindBuffer(GL_ARRAY_BUFFER, colorBuffer));
-        GL(glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(unsigned char), colors.data(),
-                        GL_DYNAMIC_DRAW));
-        GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+        stagedColorOffset = queue->stage(colors, size * sizeof(color_t));
+        stagedColorFrame = queue->frame;
+        stagedTranslucent = isTranslucent(colors, size);
     }
     else {
-        glUseProgram(program->program);
-        glUniform4f(program->colorLocation, colors[0]/255.0, colors[1]/255.0, colors[2]/255.0, colors[3]/255.0);
-        glUseProgram(0);
+        memcpy(uniformColor, colors, sizeof(uniformColor));
     }
 }
 
+void Geometry::uploadColors(const color_t *colors, size_t size) {
+    GL(glBindBuffer(GL_ARRAY_BUFFER, colorBuffer));
+    GL(glBufferData(GL_ARRAY_BUFFER, size * sizeof(unsigned char), colors,
+                    GL_STATIC_DRAW));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+    meshTranslucent = isTranslucent(colors, size);
+}
+
 void Geometry::updateIndices(const std::vector<index_t> &indices) {
     indexCount = indices.size();
     GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer));
@@ -544,27 +703,239 @@ void Geometry::updateIndices(const std::vector<index_t> &indices) {
 }
 
 void Geometry::render(const Matrix4f &transform) {
-    GL(glUseProgram(program->program));
+    DrawCommand cmd;
+    cmd.transform = transform;
+    cmd.instanceOffset = -1;
+    cmd.instanceCount = 0;
+    cmd.mesh = id;
+    cmd.shader = global_color ? Shader::uniformColor : Shader::vertexColor;
+
+    bool translucent;
+    if(global_color) {
+        memcpy(cmd.color, uniformColor, sizeof(cmd.color));
+        cmd.colorOffset = -1;
+        translucent = uniformColor[3] < 255;
+    } else if(stagedColorOffset >= 0 && stagedColorFrame == queue->frame) {
+        memset(cmd.color, 255, sizeof(cmd.color));
+        cmd.colorOffset = stagedColorOffset;
+        translucent = stagedTranslucent;
+    } else {
+        memset(cmd.color, 255, sizeof(cmd.color));
+        cmd.colorOffset = -1;
+        translucent = meshTranslucent;
+    }
+    cmd.pass = translucent ? Pass::translucent : Pass::opaque;
+
+    queue->submit(cmd);
+}
+
+
+/*
+================================================================================
+
+InstanceBatch
+
+================================================================================
+*/
+
+void InstanceBatch::clear() {
+    geometry = nullptr;
+    instances.clear();
+    vertexArrayObject = 0;
+}
+
+void InstanceBatch::create(Geometry *g) {
+    clear();
+    geometry = g;
+}
+
+void InstanceBatch::destroy() {
+    clear();
+}
 
-    //set VAO for this obj
+void InstanceBatch::createVAO() {
+    GL(glGenVertexArrays(1, &vertexArrayObject));
     GL(glBindVertexArray(vertexArrayObject));
 
-    if (program->uniformLocation[Uniform::Index::VIEW_ID] >=
-        0) { // NOTE: will not be present when multiview path is enabled.
-        GL(glUniform1i(program->uniformLocation[Uniform::Index::VIEW_ID], 0));
+    //per-vertex attributes are shared with the geometry
+    GL(glBindBuffer(GL_ARRAY_BUFFER, geometry->vertexBuffer));
+    GL(glEnableVertexAttribArray(VERTEX_ATTRIBUTE_LOCATION_POSITION));
+    GL(glVertexAttribPointer(VERTEX_ATTRIBUTE_LOCATION_POSITION, 3, GL_FLOAT, false,
+                             3 * sizeof(float), (const GLvoid *) 0));
+
+    if(!geometry->global_color) {
+        GL(glBindBuffer(GL_ARRAY_BUFFER, geometry->colorBuffer));
+        GL(glEnableVertexAttribArray(VERTEX_ATTRIBUTE_LOCATION_COLOR));
+        GL(glVertexAttribPointer(VERTEX_ATTRIBUTE_LOCATION_COLOR, 4, GL_UNSIGNED_BYTE, true,
+                                 4 * sizeof(unsigned char), (const GLvoid *) 0));
+    }
+
+    //per-instance attributes, pointers into the stream buffer are set when the draw is issued
+    for(int i = 0; i < 4; i++) {
+        GL(glEnableVertexAttribArray(VERTEX_ATTRIBUTE_LOCATION_TRANSFORM + i));
+        GL(glVertexAttribDivisor(VERTEX_ATTRIBUTE_LOCATION_TRANSFORM + i, 1));
     }
+    GL(glEnableVertexAttribArray(VERTEX_ATTRIBUTE_LOCATION_INSTANCE_COLOR));
+    GL(glVertexAttribDivisor(VERTEX_ATTRIBUTE_LOCATION_INSTANCE_COLOR, 1));
+
+    GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry->indexBuffer));
+
+    GL(glBindVertexArray(0));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+}
+
+void InstanceBatch::destroyVAO() {
+    GL(glDeleteVertexArrays(1, &vertexArrayObject));
+}
+
+void InstanceBatch::add(const Matrix4f &transform, const color_t *rgba) {
+    instances.push_back({transform.Transposed(), {rgba[0], rgba[1], rgba[2], rgba[3]}});
+}
+
+void InstanceBatch::render() {
+    if(instances.empty())
+        return;
+
+    DrawCommand cmd;
+    cmd.transform = Matrix4f::Identity();
+    cmd.colorOffset = -1;
+    cmd.instanceOffset = queue->stage(instances.data(), instances.size() * sizeof(Instance));
+    cmd.instanceCount = instances.size();
+    cmd.mesh = geometry->id;
+    memset(cmd.color, 255, sizeof(cmd.color));
+    cmd.shader = Shader::instanced;
+
+    bool translucent = !geometry->global_color && geometry->meshTranslucent;
+    for(auto &i : instances)
+        translucent |= i.color[3] < 255;
+    cmd.pass = translucent ? Pass::translucent : Pass::opaque;
+
+    queue->submit(cmd);
+    instances.clear();
+}
+
+
+/*
+================================================================================
+
+DrawQueue
+
+================================================================================
+*/
+
+void DrawQueue::clear() {
+    commands.clear();
+    staging.clear();
+    uploads.clear();
+    releases.clear();
+    frame = 1;
+}
 
-    //set transform
-    glUniformMatrix4fv(program->uniformLocation[Uniform::Index::MODEL_MATRIX], 1,
-                       GL_TRUE, &transform.M[0][0]);
+GLintptr DrawQueue::stage(const void *data, size_t size) {
+    size_t offset = staging.size();
+    staging.resize(offset + ((size + 15) & ~size_t(15))); //keep every block 16 byte aligned
+    memcpy(staging.data() + offset, data, size);
+    return offset;
+}
 
-    glDrawElements(draw_mode, indexCount, GL_UNSIGNED_SHORT, NULL);
+void DrawQueue::submit(const DrawCommand &command) {
+    commands.push_back(command);
+}
 
-    glBindVertexArray(0);
-    glUseProgram(0);
+void DrawQueue::upload(Geometry *geometry, std::vector<vertex_t> vertices, std::vector<index_t> indices) {
+    uploads.push_back({geometry, std::move(vertices), std::move(indices)});
 }
 
+void DrawQueue::release(const Geometry &geometry) {
+    releases.push_back(geometry);
+}
 
+void DrawQueue::handOff(DrawQueue &target) {
+    //GL work of a frame that was replaced before being flushed must still be done, before ours
+    uploads.insert(uploads.begin(), std::make_move_iterator(target.uploads.begin()),
+                   std::make_move_iterator(target.uploads.end()));
+    releases.insert(releases.begin(), target.releases.begin(), target.releases.end());
+
+    //swap, so the target's storage is reused for recording instead of reallocated every frame
+    std::swap(commands, target.commands);
+    std::swap(staging, target.staging);
+    std::swap(uploads, target.uploads);
+    std::swap(releases, target.releases);
+    commands.clear();
+    staging.clear();
+    uploads.clear();
+    releases.clear();
+    frame++;
+}
+
+/*
+================================================================================
+
+GpuTimer
+
+================================================================================
+*/
+
+void GpuTimer::clear() {
+    supported = false;
+    memset(queries, 0, sizeof(queries));
+    begun = finished = 0;
+    running = false;
+}
+
+void GpuTimer::create() {
+    clear();
+    supported = glExtensions.EXT_disjoint_timer_query;
+    if (supported) {
+        GL(glGenQueries(QUERIES, queries));
+    }
+}
+
+void GpuTimer::destroy() {
+    if (supported) {
+        GL(glDeleteQueries(QUERIES, queries));
+    }
+    clear();
+}
+
+void GpuTimer::begin() {
+    if (!supported || begun - finished == QUERIES)
+        return;
+    GL(glBeginQuery(GL_TIME_ELAPSED_EXT, queries[begun % QUERIES]));
+    running = true;
+}
+
+void GpuTimer::end() {
+    if (!running)
+        return;
+    GL(glEndQuery(GL_TIME_ELAPSED_EXT));
+    running = false;
+    begun++;
+}
+
+bool GpuTimer::read(float &milliseconds) {
+    if (finished == begun)
+        return false;
+
+    GLuint query = queries[finished % QUERIES];
+    GLuint available = 0;
+    GL(glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available));
+    if (!available)
+        return false;
+
+    GLuint nanoseconds = 0;
+    GL(glGetQueryObjectuiv(query, GL_QUERY_RESULT, &nanoseconds));
+    finished++;
+
+    // the GPU changed frequency or was switched in the meantime, the result is meaningless
+    GLint disjoint = 0;
+    GL(glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint));
+    if (disjoint)
+        return false;
+
+    milliseconds = nanoseconds / 1e6f;
+    return true;
+}
 
 /*
 ================================================================================
@@ -712,6 +1083,14 @@ void TrackedController::clear() {
     pose = OVR::Posef::Identity();
 }
 
+void TrackedHand::clear() {
+    active = false;
+    for (int i = 0; i < XR_HAND_JOINT_COUNT_EXT; i++) {
+        joints[i] = OVR::Posef::Identity();
+        radii[i] = 0;
+    }
+}
+
 /*
 ================================================================================
 
@@ -733,17 +1112,41 @@ void Scene::clear() {
 
     for (auto &g: geometries)
         g.clear();
+    for (auto &b: batches)
+        b.clear();
+    meshes.clear();
+    streamBuffer.clear();
+    drawQueue.clear();
     program.clear();
+    program_uniform_color.clear();
+    program_instanced.clear();
+
+    for (auto &h: trackedHand)
+        h.clear();
+    midiTimeOffset = 0;
 }
 
 bool Scene::isCreated() {
     return createdScene;
 }
 
+Program &Scene::getProgram(Shader shader) {
+    switch (shader) {
+        case Shader::uniformColor:
+            return program_uniform_color;
+        case Shader::instanced:
+            return program_instanced;
+        default:
+            return program;
+    }
+}
+
 void Scene::createVAOs() {
     if (!createdVAOs) {
         for (auto &g: geometries)
             g.createVAO();
+        for (auto &b: batches)
+            b.createVAO();
         createdVAOs = true;
     }
 }
@@ -752,6 +1155,8 @@ void Scene::destroyVAOs() {
     if (createdVAOs) {
         for (auto &g: geometries)
             g.destroyVAO();
+        for (auto &b: batches)
+            b.destroyVAO();
 
         createdVAOs = false;
     }
@@ -772,6 +1177,21 @@ void Scene::create() {
 
     geometries = Engine::loadGeometries();
 
+    batches.resize(geometries.size());
+    meshes.clear();
+    for (size_t i = 0; i < geometries.size(); i++) {
+        geometries[i].id = i;
+        batches[i].create(&geometries[i]);
+        meshes.push_back(&geometries[i]);
+    }
+
+    streamBuffer.create(256 * 1024);
+    drawQueue.clear();
+    for (auto &g: geometries)
+        g.queue = &drawQueue;
+    for (auto &b: batches)
+        b.queue = &drawQueue;
+
     createVAOs();
 
     // Generic program (color per vertex)
@@ -784,11 +1204,9 @@ void Scene::create() {
         ALOGE("Failed to compile uniform color program");
     }
 
-    for (auto &g: geometries) {
-        if(g.global_color)
-            g.program = &program_uniform_color;
-        else
-            g.program = &program;
+    // Instanced program (transform and color per instance)
+    if (!program_instanced.create(VERTEX_SHADER_INSTANCED, FRAGMENT_SHADER)) {
+        ALOGE("Failed to compile instanced program");
     }
 
     createdScene = true;
@@ -801,9 +1219,14 @@ void Scene::destroy() {
     destroyVAOs();
     GL(glDeleteBuffers(1, &sceneMatrices));
 
+    for (auto &b: batches)
+        b.destroy();
     for (auto &g: geometries)
         g.destroy();
+    streamBuffer.destroy();
     program.destroy();
+    program_uniform_color.destroy();
+    program_instanced.destroy();
     createdScene = false;
 }
 
@@ -818,6 +1241,8 @@ AppRenderer
 void AppRenderer::clear() {
     framebuffer.clear();
     scene.clear();
+    gpuTimer.clear();
+    draws = programChanges = vaoChanges = 0;
 }
 
 void AppRenderer::create(
@@ -829,6 +1254,7 @@ void AppRenderer::create(
         GLuint *colorTextures) {
     EglInitExtensions();
     framebuffer.create(format, width, height, numMultiSamples, swapChainLength, colorTextures);
+    gpuTimer.create();
     if (glExtensions.EXT_sRGB_write_control) {
         // This app was originally written with the presumption that
         // its swapchains and compositor front buffer were RGB.
@@ -840,10 +1266,119 @@ void AppRenderer::create(
 }
 
 void AppRenderer::destroy() {
+    gpuTimer.destroy();
     framebuffer.destroy();
 }
 
-void AppRenderer::renderFrame(AppRenderer::FrameIn frameIn, Engine &engine) {
+void AppRenderer::drawList(DrawQueue &list) {
+    //releases first, an id can be released and reused in the same frame
+    for (auto &g: list.releases) {
+        scene.meshes[g.id] = nullptr;
+        g.destroyVAO();
+        g.destroy();
+    }
+    for (auto &u: list.uploads) {
+        auto *g = u.geometry;
+        g->createBuffers(u.vertices, u.indices);
+        if (scene.meshes.size() <= g->id)
+            scene.meshes.resize(g->id + 1, nullptr);
+        scene.meshes[g->id] = g;
+    }
+    list.releases.clear();
+    list.uploads.clear();
+
+    auto &commands = list.commands;
+    std::stable_sort(commands.begin(), commands.end(), [](const DrawCommand &a, const DrawCommand &b) {
+        if (a.pass != b.pass)
+            return a.pass < b.pass;
+        if (a.pass == Pass::translucent) //keep submission order
+            return false;
+        if (a.shader != b.shader)
+            return a.shader < b.shader;
+        return a.mesh < b.mesh;
+    });
+
+    StreamBuffer &stream = scene.streamBuffer;
+    GLintptr base = list.staging.empty() ? 0 : stream.write(list.staging.data(), list.staging.size());
+    if (base < 0) { //the frame's region is too small, nothing to draw from
+        list.commands.clear();
+        list.staging.clear();
+        return;
+    }
+
+    draws = programChanges = vaoChanges = 0;
+    Program *currentProgram = nullptr;
+    GLuint currentVAO = 0;
+    for (auto &cmd: commands) {
+        Geometry *g = scene.meshes[cmd.mesh];
+
+        Program *program = &scene.getProgram(cmd.shader);
+        if (program != currentProgram) {
+            currentProgram = program;
+            GL(glUseProgram(currentProgram->program));
+            if (currentProgram->uniformLocation[Uniform::Index::VIEW_ID] >=
+                0) { // NOTE: will not be present when multiview path is enabled.
+                GL(glUniform1i(currentProgram->uniformLocation[Uniform::Index::VIEW_ID], 0));
+            }
+            programChanges++;
+        }
+
+        GLuint vao = cmd.instanceOffset >= 0 ? scene.batches[cmd.mesh].vertexArrayObject : g->vertexArrayObject;
+        if (vao != currentVAO) {
+            currentVAO = vao;
+            GL(glBindVertexArray(currentVAO));
+            vaoChanges++;
+        }
+
+        if (cmd.instanceOffset >= 0) {
+            //a mat4 is passed as 4 vec4 columns
+            GLintptr offset = base + cmd.instanceOffset;
+            GL(glBindBuffer(GL_ARRAY_BUFFER, stream.buffer));
+            for (int i = 0; i < 4; i++) {
+                GL(glVertexAttribPointer(VERTEX_ATTRIBUTE_LOCATION_TRANSFORM + i, 4, GL_FLOAT, false, sizeof(Instance),
+                                         (const GLvoid *) (offset + offsetof(Instance, transform) + i * 4 * sizeof(float))));
+            }
+            GL(glVertexAttribPointer(VERTEX_ATTRIBUTE_LOCATION_INSTANCE_COLOR, 4, GL_UNSIGNED_BYTE, true, sizeof(Instance),
+                                     (const GLvoid *) (offset + offsetof(Instance, color))));
+
+            //meshes without per-vertex colors read the current (constant) attribute value instead
+            if (g->global_color)
+                GL(glVertexAttrib4f(VERTEX_ATTRIBUTE_LOCATION_COLOR, 1, 1, 1, 1));
+
+            GL(glDrawElementsInstanced(g->draw_mode, g->indexCount, GL_UNSIGNED_SHORT, NULL, cmd.instanceCount));
+        } else {
+            if (g->global_color) {
+                GL(glUniform4f(currentProgram->colorLocation, cmd.color[0]/255.0, cmd.color[1]/255.0, cmd.color[2]/255.0, cmd.color[3]/255.0));
+            } else {
+                //point the color attribute at the staged colors or back at the mesh colors
+                GLintptr colorOffset = cmd.colorOffset < 0 ? -1 : base + cmd.colorOffset;
+                if (colorOffset != g->boundColorOffset) {
+                    GL(glBindBuffer(GL_ARRAY_BUFFER, colorOffset < 0 ? g->colorBuffer : stream.buffer));
+                    GL(glVertexAttribPointer(VERTEX_ATTRIBUTE_LOCATION_COLOR, 4, GL_UNSIGNED_BYTE, true,
+                                             4 * sizeof(unsigned char), (const GLvoid *) (colorOffset < 0 ? 0 : colorOffset)));
+                    g->boundColorOffset = colorOffset;
+                }
+            }
+
+            GL(glUniformMatrix4fv(currentProgram->uniformLocation[Uniform::Index::MODEL_MATRIX], 1,
+                                  GL_TRUE, &cmd.transform.M[0][0]));
+
+            GL(glDrawElements(g->draw_mode, g->indexCount, GL_UNSIGNED_SHORT, NULL));
+        }
+        draws++;
+    }
+
+    GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+    GL(glBindVertexArray(0));
+    GL(glUseProgram(0));
+
+    list.commands.clear();
+    list.staging.clear();
+}
+
+void AppRenderer::renderFrame(const AppRenderer::FrameIn &frameIn, DrawQueue &list) {
+    gpuTimer.begin();
+
     // Update the scene matrices.
     GL(glBindBuffer(GL_UNIFORM_BUFFER, scene.sceneMatrices));
     GL(Matrix4f *sceneMatrices = (Matrix4f *) glMapBufferRange(
@@ -862,6 +1397,8 @@ void AppRenderer::renderFrame(AppRenderer::FrameIn frameIn, Engine &engine) {
     scene.clearColor[0] = scene.clearColor[1] = scene.clearColor[2] = 0.0f;
     scene.clearColor[3] = 0.0f;
 
+    scene.streamBuffer.beginFrame(list.staging.size());
+
     // Render the eye images.
     framebuffer.bind(frameIn.swapChainIndex);
 
@@ -929,10 +1466,23 @@ void AppRenderer::renderFrame(AppRenderer::FrameIn frameIn, Engine &engine) {
             GL(glUniform1i(prg.uniformLocation[Uniform::Index::VIEW_ID], 0));
         }
 
-        //Piarno will render all objects
-        engine.render();
+        //the objects were recorded by the main thread
+        drawList(list);
     }
 
+    scene.streamBuffer.endFrame();
+    scene.profiler.count(Counter::uploads, scene.streamBuffer.uploads);
+    scene.profiler.count(Counter::uploadedBytes, (uint32_t) scene.streamBuffer.uploadedBytes);
+    scene.profiler.count(Counter::draws, draws);
+    scene.profiler.count(Counter::programChanges, programChanges);
+    scene.profiler.count(Counter::vaoChanges, vaoChanges);
+
     framebuffer.resolve();
     framebuffer.unbind();
+
+    gpuTimer.end();
+    float gpuTime;
+    while (gpuTimer.read(gpuTime)) {
+        scene.profiler.record(Timer::gpu, gpuTime);
+    }
 }
@@ -3,7 +3,11 @@
 #include <GLES3/gl3.h>
 #include "OVR_Math.h"
 #include <vector>
+#include <type_traits>
 #include <openxr/openxr.h>
+#include "Profiler.h"
+#include "MidiInput.h"
+#include "Synth.h"
 
 #ifndef NUM_EYES
 #define NUM_EYES 2
@@ -34,6 +38,106 @@ struct Program {
 using vertex_t = float;
 using color_t = uint8_t;
 using index_t = uint16_t;
+using mesh_t = uint32_t; // index into Scene::meshes, the static meshes use the values of Engine's Mesh enum
+
+// Ring buffer for vertex data that changes every frame (colors, instances).
+// It holds one region per frame in flight and sub-allocates from the current region with
+// unsynchronized mappings, so the driver never has to orphan and reallocate storage.
+struct StreamBuffer {
+    static constexpr int NUM_FRAMES = 3;
+
+    void clear();
+
+    void create(size_t frameSize);
+
+    void destroy();
+
+    // switch to the next region, waits (if needed) until the GPU is done reading it; the regions grow first
+    // when the frame will write more than frameBytes, so offsets handed out in a frame stay in one buffer
+    void beginFrame(size_t frameBytes);
+
+    // mark the end of the current region's use by this frame
+    void endFrame();
+
+    // copy data into the current region, returns its offset in the buffer or -1 when it doesn't fit
+    GLintptr write(const void *data, size_t size);
+
+    GLuint buffer;
+    size_t frameSize;
+    int frameIndex;
+    size_t frameOffset;
+    GLsync fences[NUM_FRAMES];
+
+    // statistics of the current frame, reported to the profiler by AppRenderer::renderFrame
+    uint32_t uploads;
+    size_t uploadedBytes;
+};
+
+struct Geometry;
+
+// A mesh created while recording a frame. Its GL objects are made when the queue is flushed, by the thread
+// that owns the GL context.
+struct MeshUpload {
+    Geometry *geometry;
+    std::vector<vertex_t> vertices;
+    std::vector<index_t> indices;
+};
+
+enum class Shader : uint8_t {
+    vertexColor, // Scene::program
+    uniformColor, // Scene::program_uniform_color
+    instanced, // Scene::program_instanced
+};
+
+enum class Pass : uint8_t {
+    opaque, // sorted by shader and mesh
+    translucent, // drawn after the opaque pass in submission order, so back-to-front ordering is kept
+};
+
+// A draw recorded by Geometry/InstanceBatch::render() and drawn by AppRenderer.
+// It is plain data: the mesh is an id and per-vertex data is an offset into the queue's staging area,
+// so a recorded frame can be handed to another thread, copied or inspected without the scene.
+struct DrawCommand {
+    OVR::Matrix4f transform; // model matrix of regular draws
+    GLintptr colorOffset; // staged per-vertex colors, -1 to use the colors stored in the mesh
+    GLintptr instanceOffset; // staged instances, -1 for a regular draw
+    GLsizei instanceCount;
+    mesh_t mesh;
+    color_t color[4]; // uniform color of global color meshes
+    Shader shader;
+    Pass pass;
+};
+
+static_assert(std::is_trivially_copyable<DrawCommand>::value, "draw commands must stay plain data");
+
+// The render list of a frame: the draws and their per-frame vertex data (the staging area is a bump
+// allocator that is reset every frame), plus the meshes created and destroyed while recording.
+// Recording needs no GL, AppRenderer::renderFrame() consumes the list.
+struct DrawQueue {
+    void clear();
+
+    // copy per-frame vertex data into the staging area, returns its offset there
+    GLintptr stage(const void *data, size_t size);
+
+    void submit(const DrawCommand &command);
+
+    // register a global color mesh under its id and create its GL objects before the list is drawn,
+    // its vertexCount and indexCount must be set already
+    void upload(Geometry *geometry, std::vector<vertex_t> vertices, std::vector<index_t> indices);
+
+    // unregister a mesh and destroy its GL objects before the list is drawn, the handles are copied so the
+    // mesh itself can go away, its id can be reused in the same frame
+    void release(const Geometry &geometry);
+
+    // move everything recorded to another queue (e.g. of a frame snapshot) and start recording the next frame
+    void handOff(DrawQueue &target);
+
+    std::vector<DrawCommand> commands;
+    std::vector<uint8_t> staging;
+    std::vector<MeshUpload> uploads;
+    std::vector<Geometry> releases;
+    uint64_t frame = 1; // number of recorded frames so far, staged data is only valid in the frame it was staged
+};
 
 // Represents a mesh loaded into the GPU
 struct Geometry {
@@ -63,24 +167,98 @@ struct Geometry {
 
     void destroyVAO();
 
+    // create the buffers and the VAO of a global color mesh without touching its counts, see DrawQueue::upload()
+    void createBuffers(const std::vector<vertex_t> &vertexPositions, const std::vector<index_t> &indices);
+
     void updateVertices(const std::vector<vertex_t> &vertexPositions);
-    void updateColors(const std::vector<color_t> &colors);
+    // set the colors (size RGBA bytes) used by the next render() calls, per-vertex colors are streamed for
+    // this frame only
+    void updateColors(const color_t *colors, size_t size);
+    // permanently store per-vertex colors in the mesh (used by instanced rendering and when nothing is streamed)
+    void uploadColors(const color_t *colors, size_t size);
     void updateIndices(const std::vector<index_t> &indices);
 
     void render(const OVR::Matrix4f &transform);
 
     /// Internal
+    mesh_t id = 0;
     GLuint vertexBuffer;
     GLuint colorBuffer;
     GLuint indexBuffer;
     size_t vertexCount;
     size_t indexCount;
 
-    GLuint vertexArrayObject;
+    GLuint vertexArrayObject = 0;
 
-    Program *program = nullptr;
+    DrawQueue *queue = nullptr;
     GLenum draw_mode;
     bool global_color;
+    color_t uniformColor[4] = {255, 255, 255, 255}; // used on render() if global_color
+
+    // per-vertex color state
+    GLintptr stagedColorOffset = -1; // colors from updateColors(), in the queue's staging area
+    uint64_t stagedColorFrame = 0;
+    bool stagedTranslucent = false;
+    bool meshTranslucent = false; // colors from uploadColors()
+    GLintptr boundColorOffset = -1; // where the VAO's color attribute points to, -1 = colorBuffer
+};
+
+// Per-instance attributes of an InstanceBatch
+struct Instance {
+    OVR::Matrix4f transform; // column-major, as expected by the vertexTransform attribute
+    color_t color[4]; // multiplied with the vertex color (white for global color meshes)
+};
+
+// Draws many copies of one mesh with a single instanced draw call
+struct InstanceBatch {
+    void clear();
+
+    void create(Geometry *geometry);
+
+    void destroy();
+
+    void createVAO();
+
+    void destroyVAO();
+
+    // queue an instance, they are drawn in the order they were added
+    void add(const OVR::Matrix4f &transform, const color_t *rgba);
+
+    // upload and draw all queued instances, then empty the queue
+    void render();
+
+    Geometry *geometry;
+    std::vector<Instance> instances;
+
+    GLuint vertexArrayObject;
+
+    DrawQueue *queue = nullptr;
+};
+
+// GPU time of frames, with GL_EXT_disjoint_timer_query. The results are read some frames later, when they
+// are available, so measuring never waits for the GPU.
+struct GpuTimer {
+    static constexpr int QUERIES = 4; // frames that can be in flight
+
+    void clear();
+
+    void create();
+
+    void destroy();
+
+    // around the GL commands of a frame, frames are skipped while all queries are in flight
+    void begin();
+
+    void end();
+
+    // time of the oldest measured frame that finished, false if there is none (or it was disjoint)
+    bool read(float &milliseconds);
+
+    bool supported;
+    GLuint queries[QUERIES];
+    uint32_t begun; // queries begun so far, the next one is queries[begun % QUERIES]
+    uint32_t finished; // queries read so far
+    bool running;
 };
 
 struct Framebuffer {
@@ -121,6 +299,15 @@ struct TrackedController {
     OVR::Posef pose;
 };
 
+// Joints of a tracked hand in local space, in the order of XrHandJointEXT.
+struct TrackedHand {
+    void clear();
+
+    bool active;
+    OVR::Posef joints[XR_HAND_JOINT_COUNT_EXT];
+    float radii[XR_HAND_JOINT_COUNT_EXT];
+};
+
 struct Scene {
     void clear();
 
@@ -136,15 +323,23 @@ struct Scene {
 
     void destroyVAOs();
 
+    Program &getProgram(Shader shader);
+
     bool createdScene;
     bool createdVAOs;
     GLuint sceneMatrices;
 
-    Program program, program_uniform_color;
+    Program program, program_uniform_color, program_instanced;
     std::vector<Geometry> geometries;
+    std::vector<InstanceBatch> batches; // one per geometry
+    std::vector<Geometry*> meshes; // by mesh id, only used by the thread drawing (see DrawQueue::upload())
+    StreamBuffer streamBuffer;
+    DrawQueue drawQueue;
+    Profiler profiler; // shared by the main and render thread
 
     float clearColor[4];
     TrackedController trackedController[4]; // left aim, left grip, right aim, right grip
+    TrackedHand trackedHand[2]; // left, right
 
     // States for all defined pressing actions
     XrBool32 leftTriggerPressed;
@@ -161,9 +356,14 @@ struct Scene {
 
     // States for all defined holding actions
     float rightTriggerHoldLevel;
-};
 
-class Engine;
+    // Notes played on a MIDI keyboard, pushed by the thread of the MIDI source
+    MidiInput midiInput;
+    double midiTimeOffset; // from the monotonic clock of the notes (and of the audio) to display time, in seconds
+
+    // Piano sound, rendered by the audio thread (XrPassthroughAudio)
+    Synth synth;
+};
 
 struct AppRenderer {
     void clear();
@@ -187,8 +387,19 @@ struct AppRenderer {
         OVR::Vector3f stageScale;
     };
 
-    void renderFrame(FrameIn frameIn, Engine &engine);
+    // draw the recorded list into the swapchain image, the list is emptied
+    void renderFrame(const FrameIn &frameIn, DrawQueue &list);
 
     Framebuffer framebuffer;
     Scene scene;
+    GpuTimer gpuTimer;
+
+    // statistics of the last frame
+    uint32_t draws;
+    uint32_t programChanges;
+    uint32_t vaoChanges;
+
+    // create and destroy the list's meshes, then upload the staging area to the stream buffer in one go and
+    // issue the draws sorted to minimize state changes
+    void drawList(DrawQueue &list);
 };
@@ -0,0 +1,90 @@
+#include <android/log.h>
+#include <android/native_window_jni.h> // for native window JNI
+
+#include "XrPassthrough.h"
+#include "XrPassthroughHands.h"
+
+#define LOG_TAG "XrPassthrough"
+
+#define ALOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define ALOGV(...) __android_log_print(ANDROID_LOG_VERBOSE, LOG_TAG, __VA_ARGS__)
+
+namespace {
+
+PFN_xrCreateHandTrackerEXT xrCreateHandTrackerEXT = nullptr;
+PFN_xrDestroyHandTrackerEXT xrDestroyHandTrackerEXT = nullptr;
+PFN_xrLocateHandJointsEXT xrLocateHandJointsEXT = nullptr;
+
+XrHandTrackerEXT handTracker[2] = {XR_NULL_HANDLE, XR_NULL_HANDLE};
+
+} // namespace
+
+void AppHands_init(App& app) {
+    if (!app.HandTrackingSupported) {
+        ALOGV("Hand tracking: XR_EXT_hand_tracking is not supported");
+        return;
+    }
+
+    XrSystemHandTrackingPropertiesEXT handTrackingProperties = {XR_TYPE_SYSTEM_HAND_TRACKING_PROPERTIES_EXT};
+    XrSystemProperties systemProperties = {XR_TYPE_SYSTEM_PROPERTIES};
+    systemProperties.next = &handTrackingProperties;
+    OXR(xrGetSystemProperties(app.Instance, app.SystemId, &systemProperties));
+    if (!handTrackingProperties.supportsHandTracking) {
+        ALOGV("Hand tracking: not supported by the system");
+        return;
+    }
+
+    OXR(xrGetInstanceProcAddr(
+        app.Instance, "xrCreateHandTrackerEXT", (PFN_xrVoidFunction*)(&xrCreateHandTrackerEXT)));
+    OXR(xrGetInstanceProcAddr(
+        app.Instance, "xrDestroyHandTrackerEXT", (PFN_xrVoidFunction*)(&xrDestroyHandTrackerEXT)));
+    OXR(xrGetInstanceProcAddr(
+        app.Instance, "xrLocateHandJointsEXT", (PFN_xrVoidFunction*)(&xrLocateHandJointsEXT)));
+
+    const XrHandEXT hands[2] = {XR_HAND_LEFT_EXT, XR_HAND_RIGHT_EXT};
+    for (int i = 0; i < 2; i++) {
+        XrHandTrackerCreateInfoEXT createInfo = {XR_TYPE_HAND_TRACKER_CREATE_INFO_EXT};
+        createInfo.hand = hands[i];
+        createInfo.handJointSet = XR_HAND_JOINT_SET_DEFAULT_EXT;
+        OXR(xrCreateHandTrackerEXT(app.Session, &createInfo, &handTracker[i]));
+    }
+}
+
+void AppHands_shutdown() {
+    for (auto& tracker : handTracker) {
+        if (tracker != XR_NULL_HANDLE) {
+            OXR(xrDestroyHandTrackerEXT(tracker));
+            tracker = XR_NULL_HANDLE;
+        }
+    }
+}
+
+void AppHands_locate(App& app, XrTime time) {
+    for (int i = 0; i < 2; i++) {
+        TrackedHand& hand = app.appRenderer.scene.trackedHand[i];
+        if (handTracker[i] == XR_NULL_HANDLE) {
+            hand.active = false;
+            continue;
+        }
+
+        XrHandJointLocationEXT jointLocations[XR_HAND_JOINT_COUNT_EXT];
+        XrHandJointLocationsEXT locations = {XR_TYPE_HAND_JOINT_LOCATIONS_EXT};
+        locations.jointCount = XR_HAND_JOINT_COUNT_EXT;
+        locations.jointLocations = jointLocations;
+
+        XrHandJointsLocateInfoEXT locateInfo = {XR_TYPE_HAND_JOINTS_LOCATE_INFO_EXT};
+        locateInfo.baseSpace = app.LocalSpace;
+        locateInfo.time = time;
+        OXR(xrLocateHandJointsEXT(handTracker[i], &locateInfo, &locations));
+
+        // Only a hand with all joints located is used, a partly tracked hand gives wrong key presses.
+        const XrSpaceLocationFlags valid =
+            XR_SPACE_LOCATION_POSITION_VALID_BIT | XR_SPACE_LOCATION_ORIENTATION_VALID_BIT;
+        hand.active = locations.isActive;
+        for (int j = 0; j < XR_HAND_JOINT_COUNT_EXT && hand.active; j++) {
+            hand.active = (jointLocations[j].locationFlags & valid) == valid;
+            hand.joints[j] = OvrFromXr(jointLocations[j].pose);
+            hand.radii[j] = jointLocations[j].radius;
+        }
+    }
+}
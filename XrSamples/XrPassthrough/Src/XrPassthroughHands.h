@@ -0,0 +1,12 @@
+#pragma once
+
+#include <openxr/openxr.h>
+
+struct App;
+
+// XR_EXT_hand_tracking: all joints of both hands, written to the scene's trackedHand.
+// Does nothing if the runtime or the system has no hand tracking.
+void AppHands_init(App& app);
+void AppHands_shutdown();
+// Locate the joints at the time the frame will be displayed, in the local space.
+void AppHands_locate(App& app, XrTime time);
@@ -0,0 +1,175 @@
+#include <android/log.h>
+#include <dlfcn.h>
+#include <jni.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "XrPassthrough.h"
+#include "XrPassthroughMidi.h"
+
+#define LOG_TAG "XrPassthrough"
+
+#define ALOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define ALOGV(...) __android_log_print(ANDROID_LOG_VERBOSE, LOG_TAG, __VA_ARGS__)
+
+namespace {
+
+// The part of <amidi/AMidi.h> that is used. The library is only there from Android 10 on, so it is loaded
+// with dlopen instead of being linked, which would keep the app from starting on older versions.
+struct AMidiDevice;
+struct AMidiOutputPort;
+const int32_t AMIDI_OPCODE_DATA = 1;
+
+struct AMidiApi {
+    int32_t (*deviceFromJava)(JNIEnv* env, jobject device, AMidiDevice** outDevice) = nullptr;
+    int32_t (*deviceRelease)(const AMidiDevice* device) = nullptr;
+    int32_t (*outputPortOpen)(const AMidiDevice* device, int32_t portNumber, AMidiOutputPort** outPort) = nullptr;
+    void (*outputPortClose)(const AMidiOutputPort* port) = nullptr;
+    ssize_t (*outputPortReceive)(const AMidiOutputPort* port, int32_t* opcode, uint8_t* buffer, size_t maxBytes,
+                                 size_t* numBytes, int64_t* timestamp) = nullptr;
+
+    bool load() {
+        if (deviceFromJava)
+            return true;
+        void* library = dlopen("libamidi.so", RTLD_NOW);
+        if (!library)
+            return false;
+        deviceFromJava = (decltype(deviceFromJava))dlsym(library, "AMidiDevice_fromJava");
+        deviceRelease = (decltype(deviceRelease))dlsym(library, "AMidiDevice_release");
+        outputPortOpen = (decltype(outputPortOpen))dlsym(library, "AMidiOutputPort_open");
+        outputPortClose = (decltype(outputPortClose))dlsym(library, "AMidiOutputPort_close");
+        outputPortReceive = (decltype(outputPortReceive))dlsym(library, "AMidiOutputPort_receive");
+        if (!deviceFromJava || !deviceRelease || !outputPortOpen || !outputPortClose || !outputPortReceive) {
+            deviceFromJava = nullptr;
+            return false;
+        }
+        return true;
+    }
+};
+AMidiApi amidi;
+
+// The keyboard comes from the activity's thread, the input from the app's thread.
+std::mutex mutex;
+MidiInput* input = nullptr;
+AMidiDevice* device = nullptr;
+AMidiOutputPort* port = nullptr;
+std::thread reader;
+std::atomic<bool> reading{false};
+
+// AMidi has no blocking receive, so the port is polled. A millisecond between polls is far below the
+// latency anyone can hear or see, and costs nothing measurable.
+void ReadPort(AMidiOutputPort* outputPort, MidiInput* target) {
+    MidiParser parser;
+    uint8_t bytes[128];
+    while (reading) {
+        int32_t opcode;
+        size_t count;
+        int64_t timestamp;
+        ssize_t messages = amidi.outputPortReceive(outputPort, &opcode, bytes, sizeof(bytes), &count, &timestamp);
+        if (messages < 0) {
+            ALOGE("MIDI: reading the keyboard failed (%zd)", messages);
+            break;
+        }
+        if (messages == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        if (opcode != AMIDI_OPCODE_DATA)
+            continue;
+
+        // time stamps are System.nanoTime(), which is CLOCK_MONOTONIC
+        NoteEvent note;
+        for (size_t i = 0; i < count; i++) {
+            if (parser.feed(bytes[i], timestamp * 1e-9, note))
+                target->push(note);
+        }
+    }
+}
+
+// with the mutex held
+void StartReading() {
+    if (!input || !port || reading)
+        return;
+    reading = true;
+    reader = std::thread(ReadPort, port, input);
+}
+
+void StopReading() {
+    reading = false;
+    if (reader.joinable())
+        reader.join();
+}
+
+void CloseDevice() {
+    StopReading();
+    if (port)
+        amidi.outputPortClose(port);
+    if (device)
+        amidi.deviceRelease(device);
+    port = nullptr;
+    device = nullptr;
+}
+
+} // namespace
+
+// The display times are XrTime, which the runtime only promises to convert from the monotonic clock.
+// Without the conversion XrTime is taken to count the monotonic clock, as the Quest runtime's does.
+static double MonotonicToDisplayTime(App& app) {
+    if (!app.TimespecConversionSupported) {
+        ALOGE("MIDI: no XR_KHR_convert_timespec_time, notes and audio are timed as if XrTime was CLOCK_MONOTONIC");
+        return 0;
+    }
+
+    PFN_xrConvertTimespecTimeToTimeKHR xrConvertTimespecTimeToTimeKHR = nullptr;
+    OXR(xrGetInstanceProcAddr(
+        app.Instance,
+        "xrConvertTimespecTimeToTimeKHR",
+        (PFN_xrVoidFunction*)(&xrConvertTimespecTimeToTimeKHR)));
+
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    XrTime time;
+    OXR(xrConvertTimespecTimeToTimeKHR(app.Instance, &now, &time));
+    return FromXrTime(time) - (now.tv_sec + now.tv_nsec * 1e-9);
+}
+
+void AppMidi_init(App& app) {
+    app.appRenderer.scene.midiTimeOffset = MonotonicToDisplayTime(app);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    input = &app.appRenderer.scene.midiInput;
+    StartReading();
+}
+
+void AppMidi_shutdown() {
+    std::lock_guard<std::mutex> lock(mutex);
+    StopReading();
+    input = nullptr;
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL
+Java_com_oculus_NativeActivity_nativeMidiDeviceOpened(JNIEnv* env, jclass, jobject midiDevice) {
+    std::lock_guard<std::mutex> lock(mutex);
+    CloseDevice();
+    if (!amidi.load()) {
+        ALOGV("MIDI: no AMidi before Android 10, the keyboard is not used");
+        return;
+    }
+    if (amidi.deviceFromJava(env, midiDevice, &device) != 0 || amidi.outputPortOpen(device, 0, &port) != 0) {
+        ALOGE("MIDI: could not open the keyboard's output port");
+        CloseDevice();
+        return;
+    }
+    ALOGV("MIDI: keyboard connected");
+    StartReading();
+}
+
+JNIEXPORT void JNICALL Java_com_oculus_NativeActivity_nativeMidiDeviceClosed(JNIEnv*, jclass) {
+    std::lock_guard<std::mutex> lock(mutex);
+    CloseDevice();
+}
+
+} // extern "C"
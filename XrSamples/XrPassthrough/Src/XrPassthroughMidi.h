@@ -0,0 +1,10 @@
+#pragma once
+
+struct App;
+
+// USB MIDI keyboards through the Android MIDI API, the played notes go to the scene's midiInput.
+// The activity opens the keyboard (java/com/oculus/NativeActivity.java) and hands it over at any time,
+// its output port is read on a thread of its own from AppMidi_init() to AppMidi_shutdown().
+// Needs Android 10 for AMidi, which is loaded at run time; on older versions there is no MIDI input.
+void AppMidi_init(App& app);
+void AppMidi_shutdown();
@@ -0,0 +1,358 @@
+//
+// Creation Date: Sat Oct 17 2026
+// Filename:      midifile/src/MidiEventArray.cpp
+// Syntax:        C++11
+// vim:           ts=3 noexpandtab
+//
+// Description:   A contiguous, compact list of MIDI events.
+//
+
+#include "MidiEventArray.h"
+#include "MidiFile.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+namespace smf {
+
+//////////////////////////////
+//
+// MidiEventArray::MidiEventArray -- Constructor.
+//
+
+MidiEventArray::MidiEventArray(void) {
+	// do nothing
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::~MidiEventArray -- Deconstructor.
+//
+
+MidiEventArray::~MidiEventArray() {
+	// do nothing
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::operator[] --
+//
+
+CompactEvent& MidiEventArray::operator[](int index) {
+	return m_events[index];
+}
+
+
+const CompactEvent& MidiEventArray::operator[](int index) const {
+	return m_events[index];
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::size -- Return the number of events in the list.
+//
+
+int MidiEventArray::size(void) const {
+	return (int)m_events.size();
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::clear -- Remove all events.  The storage is kept
+//    for reuse.
+//
+
+void MidiEventArray::clear(void) {
+	m_events.clear();
+	m_bytes.clear();
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::reserve -- Pre-allocate space for events and for
+//    the bytes of long messages.
+//    default value: bytes = 0
+//
+
+void MidiEventArray::reserve(int count, int bytes) {
+	m_events.reserve(count);
+	m_bytes.reserve(bytes);
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::getMessage -- Return the bytes of an event's message,
+//    which are size bytes long.  The pointer is valid until the next
+//    event is added.
+//
+
+const uchar* MidiEventArray::getMessage(int index) const {
+	const CompactEvent& event = m_events[index];
+	if (event.size <= 3) {
+		return event.bytes;
+	} else {
+		return m_bytes.data() + event.offset;
+	}
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::push_back -- Add an event at the end of the list.
+//    Returns the index of the event.  The sequence number is the
+//    position in the list.
+//
+
+int MidiEventArray::push_back(int tick, int track, const uchar* message,
+		int size) {
+	CompactEvent event;
+	event.tick     = tick;
+	event.track    = track;
+	event.seq      = (int)m_events.size() + 1;
+	event.link     = -1;
+	event.seconds  = 0.0;
+	event.size     = size;
+	event.offset   = 0;
+	event.bytes[0] = 0;
+	event.bytes[1] = 0;
+	event.bytes[2] = 0;
+	if (size <= 3) {
+		if (size > 0) {
+			memcpy(event.bytes, message, size);
+		}
+	} else {
+		event.offset = (int)m_bytes.size();
+		m_bytes.insert(m_bytes.end(), message, message + size);
+	}
+	m_events.push_back(event);
+	return (int)m_events.size() - 1;
+}
+
+
+int MidiEventArray::push_back(const MidiEvent& event) {
+	return push_back(event.tick, event.track, event.data(), (int)event.size());
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::append -- Add all events of a MidiEventList.
+//
+
+void MidiEventArray::append(const MidiEventList& list) {
+	m_events.reserve(m_events.size() + list.size());
+	for (int i=0; i<list.size(); i++) {
+		push_back(list[i]);
+	}
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::toMidiEventList -- Copy the events into a
+//    MidiEventList (for example to write them with MidiFile).  Note links
+//    are not copied.
+//
+
+void MidiEventArray::toMidiEventList(MidiEventList& list) const {
+	list.clear();
+	list.reserve(size());
+	std::vector<uchar> message;
+	for (int i=0; i<size(); i++) {
+		const uchar* bytes = getMessage(i);
+		message.assign(bytes, bytes + m_events[i].size);
+		MidiEvent event(m_events[i].tick, m_events[i].track, message);
+		event.seconds = m_events[i].seconds;
+		event.seq = m_events[i].seq;
+		list.push_back(event);
+	}
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::joinTracks -- Replace the contents with all events
+//    of a MIDI file, in the same order as MidiFile::joinTracks() gives
+//    for a file that was read (events at the same tick stay in track
+//    order), and with the time in seconds calculated.  The MIDI file is
+//    not changed and can be in delta or absolute tick state.
+//
+
+void MidiEventArray::joinTracks(const MidiFile& midifile) {
+	clear();
+	int count = 0;
+	for (int i=0; i<midifile.getTrackCount(); i++) {
+		count += midifile[i].size();
+	}
+	m_events.reserve(count);
+
+	for (int i=0; i<midifile.getTrackCount(); i++) {
+		const MidiEventList& list = midifile[i];
+		int tick = 0;
+		for (int j=0; j<list.size(); j++) {
+			tick = midifile.isDeltaTicks() ? tick + list[j].tick : list[j].tick;
+			push_back(tick, list[j].track, list[j].data(), (int)list[j].size());
+		}
+	}
+
+	sort();
+	doTimeAnalysis(midifile.getTicksPerQuarterNote());
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::sort -- Stable sort by tick, so events at the same tick
+//    keep their order in the list.  When the events were added in their
+//    sequence order (such as with joinTracks()), this is the same order
+//    as sortTracks() gives with eventcompare.  Uses a radix sort on the
+//    tick values (skipping the bytes that all ticks share), or a merge
+//    sort for short lists.  Note links are cleared since they are
+//    indexes into the list.
+//
+
+void MidiEventArray::sort(void) {
+	int count = size();
+	for (int i=0; i<count; i++) {
+		m_events[i].link = -1;
+	}
+	if (count < 64) {
+		std::stable_sort(m_events.begin(), m_events.end(),
+				[](const CompactEvent& a, const CompactEvent& b) { return a.tick < b.tick; });
+		return;
+	}
+
+	m_scratch.resize(count);
+	CompactEvent* source = m_events.data();
+	CompactEvent* target = m_scratch.data();
+
+	// Flipping the sign bit makes negative ticks sort before positive ones.
+	for (int shift=0; shift<32; shift+=8) {
+		int histogram[256] = {0};
+		for (int i=0; i<count; i++) {
+			histogram[(((unsigned)source[i].tick ^ 0x80000000u) >> shift) & 0xff]++;
+		}
+		if (histogram[(((unsigned)source[0].tick ^ 0x80000000u) >> shift) & 0xff] == count) {
+			// all ticks have the same byte here
+			continue;
+		}
+		int offset = 0;
+		for (int b=0; b<256; b++) {
+			int bucket = histogram[b];
+			histogram[b] = offset;
+			offset += bucket;
+		}
+		for (int i=0; i<count; i++) {
+			target[histogram[(((unsigned)source[i].tick ^ 0x80000000u) >> shift) & 0xff]++] = source[i];
+		}
+		std::swap(source, target);
+	}
+
+	if (source != m_events.data()) {
+		m_events.swap(m_scratch);
+	}
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::doTimeAnalysis -- Calculate the time in seconds of the
+//    events, which must be sorted by tick.  Same calculation as
+//    MidiFile::buildTimeMap(): 120 bpm until the first tempo message,
+//    which applies to the events after it.
+//
+
+void MidiEventArray::doTimeAnalysis(int tpq) {
+	double secondsPerTick = 60.0 / (120.0 * tpq);
+	int lasttick = 0;
+	double lastsec = 0.0;
+	for (int i=0; i<size(); i++) {
+		CompactEvent& event = m_events[i];
+		if (event.tick > lasttick) {
+			lastsec += (event.tick - lasttick) * secondsPerTick;
+			lasttick = event.tick;
+		}
+		event.seconds = lastsec;
+		if ((event.size == 6) && (m_bytes[event.offset] == 0xff) &&
+				(m_bytes[event.offset + 1] == 0x51)) {
+			const uchar* tempo = m_bytes.data() + event.offset + 3;
+			int microseconds = (tempo[0] << 16) | (tempo[1] << 8) | tempo[2];
+			secondsPerTick = (double)microseconds / 1000000.0 / tpq;
+		}
+	}
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventArray::linkNotePairs -- Link note-ons to note-offs, in the same
+//    way as MidiEventList::linkNotePairs(): a note-off ends the last
+//    unmatched note-on of the same key and channel.  Controllers are not
+//    linked.  The events must be sorted by tick.  Returns the number of
+//    linked notes.
+//
+
+int MidiEventArray::linkNotePairs(void) {
+	// one stack of unmatched note-ons per channel and key, chained
+	// through the link field of the note-ons:
+	std::vector<int> noteons(16 * 128, -1);
+	int counter = 0;
+	for (int i=0; i<size(); i++) {
+		CompactEvent& event = m_events[i];
+		event.link = -1;
+		if (event.size != 3) {
+			continue;
+		}
+		int command = event.bytes[0] & 0xf0;
+		int index = (event.bytes[0] & 0x0f) * 128 + (event.bytes[1] & 0x7f);
+		if ((command == 0x90) && (event.bytes[2] != 0)) {
+			event.link = noteons[index];
+			noteons[index] = i;
+		} else if ((command == 0x80) || (command == 0x90)) {
+			int noteon = noteons[index];
+			if (noteon >= 0) {
+				noteons[index] = m_events[noteon].link;
+				m_events[noteon].link = i;
+				event.link = noteon;
+				counter++;
+			}
+		}
+	}
+
+	// note-ons that were never matched still hold the stack chain:
+	for (int i=0; i<(int)noteons.size(); i++) {
+		int noteon = noteons[i];
+		while (noteon >= 0) {
+			int next = m_events[noteon].link;
+			m_events[noteon].link = -1;
+			noteon = next;
+		}
+	}
+	return counter;
+}
+
+
+} // end of namespace smf
+
+
+
@@ -0,0 +1,79 @@
+//
+// Creation Date: Sat Oct 17 2026
+// Filename:      midifile/include/MidiEventArray.h
+// Syntax:        C++11
+// vim:           ts=3 noexpandtab
+//
+// Description:   A contiguous, compact list of MIDI events.  Messages of up
+//                to three bytes (all channel messages) are stored inline,
+//                longer meta and sysex messages are kept in one side buffer.
+//                It is an optional storage for read-only passes over a whole
+//                MIDI file (joining, time analysis, note linking), the
+//                MidiFile/MidiEventList interface is unchanged.  Only the
+//                song bundler (Tools/SongBundler.cpp) uses it, the app
+//                reads pre-parsed notes and does not build it.
+//
+
+#ifndef _MIDIEVENTARRAY_H_INCLUDED
+#define _MIDIEVENTARRAY_H_INCLUDED
+
+#include "MidiEventList.h"
+
+#include <vector>
+
+namespace smf {
+
+class MidiFile;
+
+class CompactEvent {
+	public:
+		int    tick;      // absolute MIDI ticks
+		int    track;     // [original] track number of event in MIDI file
+		int    seq;       // sorting sequence number of event
+		int    link;      // index of the linked note-on/note-off, -1 if none
+		double seconds;   // calculated time in sec. (after doTimeAnalysis())
+		int    size;      // number of bytes in the message
+		int    offset;    // index in the side buffer when size > 3
+		uchar  bytes[3];  // message bytes when size <= 3
+};
+
+
+class MidiEventArray {
+	public:
+		                    MidiEventArray     (void);
+		                   ~MidiEventArray     ();
+
+		CompactEvent&       operator[]         (int index);
+		const CompactEvent& operator[]         (int index) const;
+		int                 size               (void) const;
+		void                clear              (void);
+		void                reserve            (int count, int bytes = 0);
+
+		const uchar*        getMessage         (int index) const;
+		int                 push_back          (int tick, int track,
+		                                        const uchar* message, int size);
+		int                 push_back          (const MidiEvent& event);
+		void                append             (const MidiEventList& list);
+		void                toMidiEventList    (MidiEventList& list) const;
+
+		void                joinTracks         (const MidiFile& midifile);
+		void                sort               (void);
+		void                doTimeAnalysis     (int tpq);
+		int                 linkNotePairs      (void);
+
+	protected:
+		std::vector<CompactEvent> m_events;
+
+		// m_bytes == side buffer for messages longer than three bytes.
+		std::vector<uchar> m_bytes;
+
+		// m_scratch == reused by sort() so that sorting does not allocate.
+		std::vector<CompactEvent> m_scratch;
+};
+
+} // end of namespace smf
+
+#endif /* _MIDIEVENTARRAY_H_INCLUDED */
+
+
+
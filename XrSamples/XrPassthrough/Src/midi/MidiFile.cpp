@@ -23,6 +23,7 @@
 #include <sstream>
 #include <iterator>
 #include <algorithm>
+#include <utility>
 
 
 namespace smf {
@@ -128,6 +129,7 @@ MidiFile::~MidiFile() {
 	m_events.resize(0);
 	m_rwstatus = false;
 	m_timemap.clear();
+	m_tempomap.clear();
 	m_timemapvalid = 0;
 }
 
@@ -155,6 +157,8 @@ MidiFile& MidiFile::operator=(const MidiFile& other) {
 	m_readFileName        = other.m_readFileName;
 	m_timemapvalid        = other.m_timemapvalid;
 	m_timemap             = other.m_timemap;
+	m_tempomap            = other.m_tempomap;
+	m_tempohint           = 0;
 	m_rwstatus            = other.m_rwstatus;
 	if (other.m_linkedEventsQ) {
 		linkEventPairs();
@@ -175,6 +179,8 @@ MidiFile& MidiFile::operator=(MidiFile&& other) {
 	m_readFileName        = other.m_readFileName;
 	m_timemapvalid        = other.m_timemapvalid;
 	m_timemap             = other.m_timemap;
+	m_tempomap            = other.m_tempomap;
+	m_tempohint           = 0;
 	m_rwstatus            = other.m_rwstatus;
 	return *this;
 }
@@ -547,6 +553,199 @@ bool MidiFile::readSmf(std::istream& input) {
 
 
 
+//////////////////////////////
+//
+// MidiFile::readSmfEvents -- Parse a Standard MIDI File which is already
+//    in memory (such as an embedded byte array or a memory-mapped file)
+//    into a flat list of events.  This is a lighter alternative to readSmf()
+//    for read-only uses: there is no allocation per event, meta and sysex
+//    data are not copied, and the events of all tracks are returned joined
+//    and with their time in seconds.  The event order and times are the
+//    same as readSmf() followed by joinTracks() and doTimeAnalysis()
+//    (including the end-of-track messages).  The events vector is cleared
+//    first, but its capacity is reused.
+//    default value: tpq = NULL
+//
+
+bool MidiFile::readSmfEvents(const uchar* data, size_t size,
+		std::vector<SmfEvent>& events, int* tpq) {
+	events.clear();
+	const uchar* p   = data;
+	const uchar* end = data + size;
+
+	if ((size < 14) || (p[0] != 'M') || (p[1] != 'T') || (p[2] != 'h') || (p[3] != 'd')) {
+		std::cerr << "Error: data is not a MIDI file" << std::endl;
+		return false;
+	}
+	ulong headersize = ((ulong)p[4] << 24) | (p[5] << 16) | (p[6] << 8) | p[7];
+	if (headersize != 6) {
+		std::cerr << "Error: data is not a MIDI 1.0 Standard MIDI file." << std::endl;
+		std::cerr << "The header size is " << headersize << " bytes." << std::endl;
+		return false;
+	}
+	int type     = (p[8]  << 8) | p[9];
+	int tracks   = (p[10] << 8) | p[11];
+	int division = (p[12] << 8) | p[13];
+	if ((type != 0) && (type != 1)) {
+		std::cerr << "Error: cannot handle a type-" << type << " MIDI file" << std::endl;
+		return false;
+	}
+	if ((type == 0) && (tracks != 1)) {
+		std::cerr << "Error: Type 0 MIDI file can only contain one track" << std::endl;
+		std::cerr << "Instead track count is: " << tracks << std::endl;
+		return false;
+	}
+
+	// Same ticks per quarter note as readSmf() (SMPTE frames per second
+	// times subframes per frame):
+	int ticks = division;
+	if (division >= 0x8000) {
+		ticks = (255 - ((division >> 8) & 0x00ff) + 1) * (division & 0x00ff);
+	}
+	if (tpq != NULL) {
+		*tpq = ticks;
+	}
+	p += 14;
+
+	// Rough guess of the event count (running-status note messages take
+	// at least three bytes with their delta time), so that the storage
+	// is allocated only once for typical files.
+	events.reserve(size / 3);
+
+	for (int i=0; i<tracks; i++) {
+		if ((end - p < 8) || (p[0] != 'M') || (p[1] != 'T') || (p[2] != 'r') || (p[3] != 'k')) {
+			std::cerr << "Error: expecting track " << i + 1 << " of " << tracks
+			     << " at byte " << (p - data) << std::endl;
+			return false;
+		}
+		// Like readSmf(), ignore the chunk size and read until the
+		// end-of-track message, since many MIDI files found in the wild
+		// do not correctly give the track size.
+		p += 8;
+
+		uchar runningCommand = 0;
+		int absticks = 0;
+		bool endoftrack = false;
+		while (!endoftrack) {
+			ulong delta;
+			if (!readVLValue(p, end, delta) || (p >= end)) {
+				std::cerr << "Error: unexpected end of data in track " << i + 1 << std::endl;
+				return false;
+			}
+			absticks += delta;
+
+			if (*p < 0x80) {
+				if (runningCommand == 0) {
+					std::cerr << "Error: running command with no previous command" << std::endl;
+					return false;
+				}
+				if (runningCommand >= 0xf0) {
+					std::cerr << "Error: running status not permitted with meta and sysex"
+					     << " event." << std::endl;
+					return false;
+				}
+			} else {
+				runningCommand = *p++;
+			}
+
+			SmfEvent event;
+			event.tick        = absticks;
+			event.track       = i;
+			event.seconds     = 0.0;
+			event.bytes[0]    = runningCommand;
+			event.bytes[1]    = 0;
+			event.bytes[2]    = 0;
+			event.size        = 1;
+			event.payloadSize = 0;
+			event.payload     = NULL;
+
+			switch (runningCommand & 0xf0) {
+				case 0x80:        // note off (2 more bytes)
+				case 0x90:        // note on (2 more bytes)
+				case 0xA0:        // aftertouch (2 more bytes)
+				case 0xB0:        // cont. controller (2 more bytes)
+				case 0xE0:        // pitch wheel (2 more bytes)
+					if ((end - p < 2) || ((p[0] | p[1]) & 0x80)) {
+						std::cerr << "Error: bad MIDI data bytes in track " << i + 1 << std::endl;
+						return false;
+					}
+					event.bytes[1] = p[0];
+					event.bytes[2] = p[1];
+					event.size = 3;
+					p += 2;
+					break;
+				case 0xC0:        // patch change (1 more byte)
+				case 0xD0:        // channel pressure (1 more byte)
+					if ((p >= end) || (p[0] & 0x80)) {
+						std::cerr << "Error: bad MIDI data byte in track " << i + 1 << std::endl;
+						return false;
+					}
+					event.bytes[1] = p[0];
+					event.size = 2;
+					p++;
+					break;
+				case 0xF0:
+					// Other "F" commands than meta and sysex are kept as
+					// single bytes, as readSmf() does.
+					if ((runningCommand == 0xff) || (runningCommand == 0xf0) ||
+							(runningCommand == 0xf7)) {
+						if (runningCommand == 0xff) {
+							if (p >= end) {
+								std::cerr << "Error: unexpected end of data in track " << i + 1 << std::endl;
+								return false;
+							}
+							event.bytes[1] = *p++;  // meta type
+							event.size = 2;
+						}
+						ulong length;
+						if (!readVLValue(p, end, length) || (length > (ulong)(end - p))) {
+							std::cerr << "Error: bad meta or sysex length in track " << i + 1 << std::endl;
+							return false;
+						}
+						event.payload = p;
+						event.payloadSize = (int)length;
+						p += length;
+						endoftrack = (runningCommand == 0xff) && (event.bytes[1] == 0x2f);
+					}
+					break;
+				default:
+					std::cerr << "Error: command byte was " << (int)runningCommand << std::endl;
+					return false;
+			}
+			events.push_back(event);
+		}
+	}
+
+	// Join the tracks: the events of each track are in tick order, and
+	// readSmf() marks the sequence of all events in track order, so a
+	// stable sort by tick gives the same order as joinTracks().
+	if (tracks > 1) {
+		std::stable_sort(events.begin(), events.end(),
+				[](const SmfEvent& a, const SmfEvent& b) { return a.tick < b.tick; });
+	}
+
+	// Same time calculation as buildTimeMap(): 120 bpm until the
+	// first tempo message, which applies to the events after it.
+	double secondsPerTick = 60.0 / (120.0 * ticks);
+	int lasttick = 0;
+	double lastsec = 0.0;
+	for (SmfEvent& event : events) {
+		if (event.tick > lasttick) {
+			lastsec += (event.tick - lasttick) * secondsPerTick;
+			lasttick = event.tick;
+		}
+		event.seconds = lastsec;
+		if ((event.bytes[0] == 0xff) && (event.bytes[1] == 0x51) && (event.payloadSize == 3)) {
+			int microseconds = (event.payload[0] << 16) | (event.payload[1] << 8) | event.payload[2];
+			secondsPerTick = (double)microseconds / 1000000.0 / ticks;
+		}
+	}
+
+	return true;
+}
+
+
+
 //////////////////////////////
 //
 // MidiFile::write -- write a standard MIDI file to a file or an output
@@ -1040,9 +1239,64 @@ void MidiFile::joinTracks(void) {
 	if (oldTimeState == TIME_STATE_DELTA) {
 		makeAbsoluteTicks();
 	}
-	for (i=0; i<length; i++) {
-		for (j=0; j<(int)m_events[i]->size(); j++) {
-			joinedTrack->push_back_no_copy(&(*m_events[i])[j]);
+	// Tracks are usually sorted already (always after reading a file),
+	// in which case a k-way merge gives the same order as sorting all of
+	// the events, in O(N log k) and with sequential access to each track.
+	// The full eventcompare is only needed for events at the same tick.
+	bool merge = true;
+	for (i=0; (i<length) && merge; i++) {
+		MidiEventList& track = *m_events[i];
+		for (j=1; j<(int)track.size(); j++) {
+			MidiEvent* a = &track[j-1];
+			MidiEvent* b = &track[j];
+			if ((a->tick > b->tick) || ((a->tick == b->tick) && (eventcompare(&a, &b) > 0))) {
+				merge = false;
+				break;
+			}
+		}
+	}
+
+	if (merge) {
+		// heap of the next event in each track, ordered so that the
+		// front is the earliest event (ties go to the lower track):
+		struct TrackHead {
+			MidiEvent* event;
+			int        track;
+			int        index;
+		};
+		std::vector<TrackHead> heap;
+		heap.reserve(length);
+		auto later = [](const TrackHead& a, const TrackHead& b) {
+			if (a.event->tick != b.event->tick) {
+				return a.event->tick > b.event->tick;
+			}
+			MidiEvent* aevent = a.event;
+			MidiEvent* bevent = b.event;
+			int order = eventcompare(&aevent, &bevent);
+			return order != 0 ? order > 0 : a.track > b.track;
+		};
+		for (i=0; i<length; i++) {
+			if (m_events[i]->size() > 0) {
+				heap.push_back({&(*m_events[i])[0], i, 0});
+			}
+		}
+		std::make_heap(heap.begin(), heap.end(), later);
+		while (!heap.empty()) {
+			std::pop_heap(heap.begin(), heap.end(), later);
+			TrackHead& next = heap.back();
+			joinedTrack->push_back_no_copy(next.event);
+			if (++next.index < (int)m_events[next.track]->size()) {
+				next.event = &(*m_events[next.track])[next.index];
+				std::push_heap(heap.begin(), heap.end(), later);
+			} else {
+				heap.pop_back();
+			}
+		}
+	} else {
+		for (i=0; i<length; i++) {
+			for (j=0; j<(int)m_events[i]->size(); j++) {
+				joinedTrack->push_back_no_copy(&(*m_events[i])[j]);
+			}
 		}
 	}
 
@@ -1051,7 +1305,9 @@ void MidiFile::joinTracks(void) {
 	delete m_events[0];
 	m_events.resize(0);
 	m_events.push_back(joinedTrack);
-	sortTracks();
+	if (!merge) {
+		sortTracks();
+	}
 	if (oldTimeState == TIME_STATE_DELTA) {
 		makeDeltaTicks();
 	}
@@ -2283,6 +2539,7 @@ void MidiFile::clear(void) {
 	m_events[0] = new MidiEventList;
 	m_timemapvalid=0;
 	m_timemap.clear();
+	m_tempomap.clear();
 	m_theTrackState = TRACK_STATE_SPLIT;
 	m_theTimeState = TIME_STATE_ABSOLUTE;
 }
@@ -2541,8 +2798,6 @@ double MidiFile::linearTickInterpolationAtSecond(double seconds) {
 		}
 	}
 
-	int i;
-	double lasttime = m_timemap[m_timemap.size()-1].seconds;
 	// give an error value of -1 if time is out of range of data.
 	if (seconds < 0.0) {
 		return -1.0;
@@ -2551,46 +2806,13 @@ double MidiFile::linearTickInterpolationAtSecond(double seconds) {
 		return -1.0;
 	}
 
-	// Guess which side of the list is closest to target:
-	// Could do a more efficient algorithm since time values are sorted,
-	// but good enough for now...
-	int startindex = -1;
-	if (seconds < lasttime / 2) {
-		for (i=0; i<(int)m_timemap.size(); i++) {
-			if (m_timemap[i].seconds > seconds) {
-				startindex = i-1;
-				break;
-			} else if (m_timemap[i].seconds == seconds) {
-				startindex = i;
-				break;
-			}
-		}
-	} else {
-		for (i=(int)m_timemap.size()-1; i>0; i--) {
-			if (m_timemap[i].seconds < seconds) {
-				startindex = i+1;
-				break;
-			} else if (m_timemap[i].seconds == seconds) {
-				startindex = i;
-				break;
-			}
-		}
-	}
-
-	if (startindex < 0) {
-		return -1.0;
-	}
-	if (startindex >= (int)m_timemap.size()-1) {
-		return -1.0;
+	// Ticks are linear in seconds within a tempo segment, so this is the
+	// same as interpolating between the two neighboring time map entries.
+	const _TempoSegment& segment = m_tempomap[tempoSegmentAtSecond(seconds)];
+	if (segment.secondsPerTick <= 0.0) {
+		return segment.tick;
 	}
-
-	double x1 = m_timemap[startindex].seconds;
-	double x2 = m_timemap[startindex+1].seconds;
-	double y1 = m_timemap[startindex].tick;
-	double y2 = m_timemap[startindex+1].tick;
-	double xi = seconds;
-
-	return (xi-x1) * ((y2-y1)/(x2-x1)) + y1;
+	return segment.tick + (seconds - segment.seconds) / segment.secondsPerTick;
 }
 
 
@@ -2609,8 +2831,6 @@ double MidiFile::linearSecondInterpolationAtTick(int ticktime) {
 		}
 	}
 
-	int i;
-	double lasttick = m_timemap[m_timemap.size()-1].tick;
 	// give an error value of -1 if time is out of range of data.
 	if (ticktime < 0.0) {
 		return -1;
@@ -2619,50 +2839,57 @@ double MidiFile::linearSecondInterpolationAtTick(int ticktime) {
 		return -1;  // don't try to extrapolate
 	}
 
-	// Guess which side of the list is closest to target:
-	// Could do a more efficient algorithm since time values are sorted,
-	// but good enough for now...
-	int startindex = -1;
-	if (ticktime < lasttick / 2) {
-		for (i=0; i<(int)m_timemap.size(); i++) {
-			if (m_timemap[i].tick > ticktime) {
-				startindex = i-1;
-				break;
-			} else if (m_timemap[i].tick == ticktime) {
-				startindex = i;
-				break;
-			}
-		}
-	} else {
-		for (i=(int)m_timemap.size()-1; i>0; i--) {
-			if (m_timemap[i].tick < ticktime) {
-				startindex = i;
-				break;
-			} else if (m_timemap[i].tick == ticktime) {
-				startindex = i;
-				break;
-			}
+	const _TempoSegment& segment = m_tempomap[tempoSegmentAtTick(ticktime)];
+	return segment.seconds + (ticktime - segment.tick) * segment.secondsPerTick;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::tempoSegmentAtTick -- return the index of the tempo segment
+//    which contains the given tick time.  The segment of the previous
+//    lookup and the one after it are checked first, so looking up
+//    increasing times (as during playback) is O(1), otherwise the
+//    segment is found with a binary search.
+//
+
+int MidiFile::tempoSegmentAtTick(int ticktime) {
+	int count = (int)m_tempomap.size();
+	for (int i=m_tempohint; (i<count) && (i<=m_tempohint+1); i++) {
+		if ((m_tempomap[i].tick <= ticktime) &&
+				((i+1 == count) || (ticktime < m_tempomap[i+1].tick))) {
+			m_tempohint = i;
+			return i;
 		}
 	}
+	auto next = std::upper_bound(m_tempomap.begin(), m_tempomap.end(), ticktime,
+			[](int tick, const _TempoSegment& segment) { return tick < segment.tick; });
+	m_tempohint = std::max(0, (int)(next - m_tempomap.begin()) - 1);
+	return m_tempohint;
+}
 
-	if (startindex < 0) {
-		return -1;
-	}
-	if (startindex >= (int)m_timemap.size()-1) {
-		return -1;
-	}
 
-	if (m_timemap[startindex].tick == ticktime) {
-		return m_timemap[startindex].seconds;
-	}
 
-	double x1 = m_timemap[startindex].tick;
-	double x2 = m_timemap[startindex+1].tick;
-	double y1 = m_timemap[startindex].seconds;
-	double y2 = m_timemap[startindex+1].seconds;
-	double xi = ticktime;
+//////////////////////////////
+//
+// MidiFile::tempoSegmentAtSecond -- return the index of the tempo segment
+//    which contains the given time in seconds, same as tempoSegmentAtTick().
+//
 
-	return (xi-x1) * ((y2-y1)/(x2-x1)) + y1;
+int MidiFile::tempoSegmentAtSecond(double seconds) {
+	int count = (int)m_tempomap.size();
+	for (int i=m_tempohint; (i<count) && (i<=m_tempohint+1); i++) {
+		if ((m_tempomap[i].seconds <= seconds) &&
+				((i+1 == count) || (seconds < m_tempomap[i+1].seconds))) {
+			m_tempohint = i;
+			return i;
+		}
+	}
+	auto next = std::upper_bound(m_tempomap.begin(), m_tempomap.end(), seconds,
+			[](double time, const _TempoSegment& segment) { return time < segment.seconds; });
+	m_tempohint = std::max(0, (int)(next - m_tempomap.begin()) - 1);
+	return m_tempohint;
 }
 
 
@@ -2710,6 +2937,14 @@ void MidiFile::buildTimeMap(void) {
 	double lastsec = 0.0;
 	double cursec = 0.0;
 
+	_TempoSegment segment;
+	segment.tick = 0;
+	segment.seconds = 0.0;
+	segment.secondsPerTick = secondsPerTick;
+	m_tempomap.clear();
+	m_tempomap.push_back(segment);
+	m_tempohint = 0;
+
 	for (i=0; i<getNumEvents(0); i++) {
 		int curtick = getEvent(0, i).tick;
 		getEvent(0, i).seconds = cursec;
@@ -2731,6 +2966,17 @@ void MidiFile::buildTimeMap(void) {
 		// update the tempo if needed:
 		if (getEvent(0,i).isTempo()) {
 			secondsPerTick = getEvent(0,i).getTempoSPT(getTicksPerQuarterNote());
+
+			// start a new tempo segment, or replace the tempo of one which
+			// starts at the same tick:
+			segment.tick = curtick;
+			segment.seconds = cursec;
+			segment.secondsPerTick = secondsPerTick;
+			if (m_tempomap.back().tick == curtick) {
+				m_tempomap.back() = segment;
+			} else {
+				m_tempomap.push_back(segment);
+			}
 		}
 	}
 
@@ -2945,6 +3191,29 @@ ulong MidiFile::readVLValue(std::istream& input) {
 
 
 
+//
+// In-memory version of MidiFile::readVLValue(), which advances the data
+// pointer past the VLV.  Returns false if the data ends within the VLV
+// or the VLV is longer than five bytes.
+//
+
+bool MidiFile::readVLValue(const uchar*& data, const uchar* end, ulong& value) {
+	value = 0;
+	for (int i=0; i<5; i++) {
+		if (data >= end) {
+			return false;
+		}
+		uchar byte = *data++;
+		value = (value << 7) | (byte & 0x7f);
+		if (byte < 0x80) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+
 //////////////////////////////
 //
 // MidiFile::unpackVLV -- converts a VLV value to an unsigned long value.
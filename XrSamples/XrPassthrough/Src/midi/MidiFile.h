@@ -36,6 +36,31 @@ class _TickTime {
 };
 
 
+// _TempoSegment == the time map from one tempo change to the next,
+// in which seconds are linear in ticks.
+class _TempoSegment {
+	public:
+		int    tick;            // start of the segment
+		double seconds;         // time in seconds at the start
+		double secondsPerTick;  // tempo of the segment
+};
+
+
+// SmfEvent == flat event filled in by MidiFile::readSmfEvents().  Meta
+// and sysex contents are not copied: the payload points into the buffer
+// that was parsed, so that buffer has to outlive the events.
+class SmfEvent {
+	public:
+		int          tick;         // absolute time in ticks
+		int          track;        // track of the event in the MIDI file
+		double       seconds;      // absolute time in seconds
+		uchar        bytes[3];     // command byte and up to two data bytes
+		uchar        size;         // number of valid bytes in bytes[]
+		int          payloadSize;  // meta/sysex data size (0 otherwise)
+		const uchar* payload;      // meta/sysex data (after the length VLV)
+};
+
+
 class MidiFile {
 	public:
 		               MidiFile                    (void);
@@ -61,6 +86,12 @@ class MidiFile {
 		bool           readSmf                     (const std::string& filename);
 		bool           readSmf                     (std::istream& instream);
 
+		// Flat parsing of an in-memory SMF without building MidiEvents:
+		static bool    readSmfEvents               (const uchar* data,
+		                                            size_t size,
+		                                            std::vector<SmfEvent>& events,
+		                                            int* tpq = NULL);
+
 		bool           write                       (const std::string& filename);
 		bool           write                       (std::ostream& out);
 		bool           writeBase64                 (const std::string& out, int width = 0);
@@ -285,6 +316,14 @@ class MidiFile {
 		// m_timemap ==
 		std::vector<_TickTime> m_timemap;
 
+		// m_tempomap == tempo segments in tick (and seconds) order, built
+		// along with m_timemap for interpolating between its entries.
+		std::vector<_TempoSegment> m_tempomap;
+
+		// m_tempohint == the last segment looked up in m_tempomap, which
+		// is where the next lookup usually is during playback.
+		int m_tempohint = 0;
+
 		// m_rwstatus == True if last read was successful, false if a problem.
 		bool m_rwstatus = true;
 
@@ -296,6 +335,9 @@ class MidiFile {
 		                                             std::vector<uchar>& array,
 		                                             uchar& runningCommand);
 		ulong       readVLValue                     (std::istream& inputfile);
+		static bool readVLValue                     (const uchar*& data,
+		                                             const uchar* end,
+		                                             ulong& value);
 		ulong       unpackVLV                       (uchar a = 0, uchar b = 0,
 		                                             uchar c = 0, uchar d = 0,
 		                                             uchar e = 0);
@@ -307,6 +349,8 @@ class MidiFile {
 		void        buildTimeMap                    (void);
 		double      linearTickInterpolationAtSecond (double seconds);
 		double      linearSecondInterpolationAtTick (int ticktime);
+		int         tempoSegmentAtTick              (int ticktime);
+		int         tempoSegmentAtSecond            (double seconds);
 		std::string base64Encode                    (const std::string &input);
 		std::string base64Decode                    (const std::string &input);
 
@@ -0,0 +1,9242 @@
+//
+// File automatically generated by SongBundler from command line:
+//  SongBundler songs/songs.txt songs/bundle.h
+//
+
+// array size is 147744
+alignas(8) static const unsigned char songBundle[] = {
+        0x50, 0x41, 0x52, 0x42, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x41, 0x02, 0x00,
+        0x8c, 0x3f, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+        0x80, 0x01, 0x96, 0x42, 0x00, 0x00, 0x00, 0x00, 0x91, 0x3f, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
+        0x60, 0x0a, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x8f, 0xde, 0x0c, 0x43, 0x00, 0x00, 0x00, 0x00,
+        0x94, 0x3f, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf0, 0x19, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+        0xbf, 0x90, 0xe4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x3f, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00,
+        0x3c, 0x25, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x48, 0x0d, 0xf2, 0x41, 0x00, 0x00, 0x00, 0x00,
+        0xa1, 0x3f, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x29, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+        0x80, 0x01, 0x0d, 0x42, 0x00, 0x00, 0x00, 0x00, 0xab, 0x3f, 0x02, 0x00, 0x11, 0x00, 0x00, 0x00,
+        0xc8, 0x32, 0x00, 0x00, 0x6e, 0x01, 0x00, 0x00, 0xff, 0xb0, 0xb2, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0xbc, 0x3f, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x43, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00,
+        0x77, 0x33, 0x3b, 0x43, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x3f, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00,
+        0x14, 0x59, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0x1f, 0x88, 0x1a, 0x43, 0x00, 0x00, 0x00, 0x00,
+        0xd5, 0x3f, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x8a, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+        0x82, 0x6e, 0x0b, 0x42, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x3f, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00,
+        0x30, 0x8e, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf2, 0x17, 0x5b, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0xe5, 0x3f, 0x02, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0c, 0x91, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00,
+        0x9a, 0xd9, 0xc2, 0x42, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x3f, 0x02, 0x00, 0x0e, 0x00, 0x00, 0x00,
+        0x94, 0xa2, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x9b, 0xb7, 0x99, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x40, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0xa8, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00,
+        0x9a, 0x99, 0x0f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x40, 0x02, 0x00, 0x09, 0x00, 0x00, 0x00,
+        0xa4, 0xb3, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xcd, 0x35, 0xad, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x16, 0x40, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0xbe, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+        0x45, 0x92, 0xe4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x02, 0x00, 0x13, 0x00, 0x00, 0x00,
+        0x94, 0xc9, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xcd, 0xcc, 0xa3, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x39, 0x40, 0x02, 0x00, 0x13, 0x00, 0x00, 0x00, 0x54, 0xd3, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00,
+        0x18, 0x5c, 0x99, 0x42, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x00,
+        0x18, 0xe2, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x2a, 0x09, 0xc5, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x5b, 0x40, 0x02, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x01, 0x01, 0x00, 0x98, 0x01, 0x00, 0x00,
+        0x62, 0xdb, 0xb6, 0x42, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x40, 0x02, 0x00, 0x16, 0x00, 0x00, 0x00,
+        0x28, 0x14, 0x01, 0x00, 0x9b, 0x01, 0x00, 0x00, 0x3d, 0x2f, 0xc9, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x82, 0x40, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x6c, 0x27, 0x01, 0x00, 0xb4, 0x01, 0x00, 0x00,
+        0xe1, 0xea, 0xe9, 0x42, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x40, 0x02, 0x00, 0x12, 0x00, 0x00, 0x00,
+        0xdc, 0x3b, 0x01, 0x00, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x9e, 0x40, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x34, 0x4d, 0x01, 0x00, 0x7b, 0x02, 0x00, 0x00,
+        0xee, 0x66, 0xfe, 0x42, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x40, 0x02, 0x00, 0x13, 0x00, 0x00, 0x00,
+        0xf8, 0x6a, 0x01, 0x00, 0x50, 0x02, 0x00, 0x00, 0x2a, 0x69, 0x41, 0x43, 0x00, 0x00, 0x00, 0x00,
+        0xbd, 0x40, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0xb8, 0x86, 0x01, 0x00, 0xd0, 0x00, 0x00, 0x00,
+        0xae, 0x47, 0x99, 0x42, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x40, 0x02, 0x00, 0x17, 0x00, 0x00, 0x00,
+        0x78, 0x90, 0x01, 0x00, 0xec, 0x01, 0x00, 0x00, 0xcd, 0xec, 0x24, 0x43, 0x00, 0x00, 0x00, 0x00,
+        0xdb, 0x40, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x88, 0xa7, 0x01, 0x00, 0xe8, 0x00, 0x00, 0x00,
+        0xcd, 0xcc, 0x8b, 0x42, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x40, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00,
+        0x68, 0xb2, 0x01, 0x00, 0x93, 0x03, 0x00, 0x00, 0x20, 0x79, 0x7c, 0x43, 0x00, 0x00, 0x00, 0x00,
+        0xfd, 0x40, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4c, 0xdd, 0x01, 0x00, 0x92, 0x04, 0x00, 0x00,
+        0x9a, 0xf9, 0x98, 0x43, 0x00, 0x00, 0x00, 0x00, 0x07, 0x41, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00,
+        0x24, 0x14, 0x02, 0x00, 0x62, 0x03, 0x00, 0x00, 0xe3, 0x35, 0x5f, 0x43, 0x00, 0x00, 0x00, 0x00,
+        0x11, 0x41, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xbc, 0x3c, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00,
+        0xa2, 0xaa, 0x06, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f,
+        0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0x3c, 0x30, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x3e, 0x30, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x3f,
+        0x00, 0x00, 0x40, 0x40, 0x37, 0x2f, 0x01, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x90, 0x40,
+        0x3c, 0x27, 0x01, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x90, 0x40, 0x39, 0x2f, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x3b, 0x2d, 0x01, 0x00, 0x00, 0x00, 0x90, 0x40,
+        0x00, 0x00, 0xc0, 0x40, 0x34, 0x2d, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xf0, 0x40,
+        0x39, 0x2b, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xf0, 0x40, 0x35, 0x2f, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x37, 0x30, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x40,
+        0x00, 0x00, 0x10, 0x41, 0x30, 0x29, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x28, 0x41,
+        0x39, 0x30, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x28, 0x41, 0x35, 0x34, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x41, 0x00, 0x00, 0x40, 0x41, 0x3b, 0x33, 0x01, 0x00, 0x00, 0x00, 0x28, 0x41,
+        0x00, 0x00, 0x40, 0x41, 0x37, 0x35, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x58, 0x41,
+        0x40, 0x2f, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x58, 0x41, 0x3c, 0x36, 0x01, 0x00,
+        0x00, 0x00, 0x58, 0x41, 0x00, 0x00, 0x70, 0x41, 0x3e, 0x2d, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41,
+        0x00, 0x00, 0x70, 0x41, 0x37, 0x31, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x84, 0x41,
+        0x3c, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x84, 0x41, 0x39, 0x33, 0x01, 0x00,
+        0x00, 0x00, 0x84, 0x41, 0x00, 0x00, 0x90, 0x41, 0x3b, 0x2c, 0x01, 0x00, 0x00, 0x00, 0x84, 0x41,
+        0x00, 0x00, 0x90, 0x41, 0x34, 0x2d, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x9c, 0x41,
+        0x39, 0x30, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x9c, 0x41, 0x35, 0x2c, 0x01, 0x00,
+        0x00, 0x00, 0x9c, 0x41, 0x00, 0x00, 0xa8, 0x41, 0x37, 0x2d, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x41,
+        0x00, 0x00, 0xa8, 0x41, 0x30, 0x2a, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0xb4, 0x41,
+        0x39, 0x37, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0xb4, 0x41, 0x35, 0x34, 0x01, 0x00,
+        0x00, 0x00, 0xb4, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x3b, 0x38, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x41,
+        0x00, 0x00, 0xc0, 0x41, 0x37, 0x35, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xcc, 0x41,
+        0x43, 0x3d, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xcc, 0x41, 0x4c, 0x3d, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xcc, 0x41, 0x3c, 0x3b, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41,
+        0x00, 0x00, 0xd8, 0x41, 0x47, 0x2f, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x00, 0x00, 0xd8, 0x41,
+        0x4a, 0x2f, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x00, 0x00, 0xd8, 0x41, 0x37, 0x2e, 0x01, 0x00,
+        0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0xe4, 0x41, 0x48, 0x2b, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x41,
+        0x00, 0x00, 0xe4, 0x41, 0x39, 0x2f, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x00, 0x00, 0xf0, 0x41,
+        0x43, 0x2c, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x00, 0x00, 0xf0, 0x41, 0x47, 0x2c, 0x01, 0x00,
+        0x00, 0x00, 0xe4, 0x41, 0x00, 0x00, 0xf0, 0x41, 0x34, 0x2c, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0x00, 0x00, 0xfc, 0x41, 0x3c, 0x2e, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0xfc, 0x41,
+        0x45, 0x2e, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0xfc, 0x41, 0x35, 0x31, 0x01, 0x00,
+        0x00, 0x00, 0xfc, 0x41, 0x00, 0x00, 0x04, 0x42, 0x40, 0x2e, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x41,
+        0x00, 0x00, 0x04, 0x42, 0x43, 0x2e, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x41, 0x00, 0x00, 0x04, 0x42,
+        0x30, 0x32, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x0a, 0x42, 0x41, 0x2e, 0x01, 0x00,
+        0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x0a, 0x42, 0x45, 0x2e, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42,
+        0x00, 0x00, 0x0a, 0x42, 0x35, 0x35, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x00, 0x00, 0x10, 0x42,
+        0x3e, 0x34, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x00, 0x00, 0x10, 0x42, 0x47, 0x34, 0x01, 0x00,
+        0x00, 0x00, 0x0a, 0x42, 0x00, 0x00, 0x10, 0x42, 0x37, 0x30, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42,
+        0x00, 0x00, 0x13, 0x42, 0x48, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x16, 0x42,
+        0x3c, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x16, 0x42, 0x40, 0x4e, 0x01, 0x00,
+        0x00, 0x00, 0x13, 0x42, 0x00, 0x0f, 0x16, 0x42, 0x48, 0x42, 0x01, 0x00, 0x00, 0x00, 0x16, 0x42,
+        0x00, 0x0f, 0x19, 0x42, 0x4a, 0x46, 0x01, 0x00, 0x00, 0x00, 0x16, 0x42, 0x00, 0x00, 0x1c, 0x42,
+        0x37, 0x41, 0x01, 0x00, 0x00, 0x00, 0x16, 0x42, 0x00, 0x00, 0x1c, 0x42, 0x3e, 0x41, 0x01, 0x00,
+        0x00, 0x00, 0x19, 0x42, 0x00, 0x0f, 0x1c, 0x42, 0x47, 0x41, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x42,
+        0x00, 0x0f, 0x1f, 0x42, 0x48, 0x45, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x22, 0x42,
+        0x39, 0x38, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x22, 0x42, 0x3c, 0x38, 0x01, 0x00,
+        0x00, 0x00, 0x1f, 0x42, 0x00, 0x0f, 0x22, 0x42, 0x4c, 0x46, 0x01, 0x00, 0x00, 0x00, 0x22, 0x42,
+        0x00, 0x0f, 0x25, 0x42, 0x4f, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x22, 0x42, 0x00, 0x00, 0x28, 0x42,
+        0x34, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x25, 0x42, 0x00, 0x0f, 0x28, 0x42, 0x43, 0x32, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x42, 0x00, 0x0f, 0x2b, 0x42, 0x45, 0x33, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42,
+        0x00, 0x00, 0x2e, 0x42, 0x35, 0x44, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x2e, 0x42,
+        0x39, 0x44, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x42, 0x00, 0x0f, 0x2e, 0x42, 0x41, 0x3c, 0x01, 0x00,
+        0x00, 0x00, 0x2e, 0x42, 0x00, 0x0f, 0x31, 0x42, 0x40, 0x37, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x42,
+        0x00, 0x00, 0x34, 0x42, 0x30, 0x36, 0x01, 0x00, 0x00, 0x00, 0x31, 0x42, 0x00, 0x0f, 0x34, 0x42,
+        0x43, 0x42, 0x01, 0x00, 0x00, 0x00, 0x34, 0x42, 0x00, 0x0f, 0x37, 0x42, 0x41, 0x42, 0x01, 0x00,
+        0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x3a, 0x42, 0x35, 0x45, 0x01, 0x00, 0x00, 0x00, 0x34, 0x42,
+        0x00, 0x00, 0x3a, 0x42, 0x39, 0x45, 0x01, 0x00, 0x00, 0x00, 0x37, 0x42, 0x00, 0x0f, 0x3a, 0x42,
+        0x48, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x42, 0x00, 0x0f, 0x3d, 0x42, 0x47, 0x4b, 0x01, 0x00,
+        0x00, 0x00, 0x3a, 0x42, 0x00, 0x00, 0x40, 0x42, 0x37, 0x41, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x42,
+        0x00, 0x00, 0x40, 0x42, 0x3b, 0x41, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x42, 0x00, 0x0f, 0x40, 0x42,
+        0x43, 0x36, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0x00, 0xd9, 0x42, 0x42, 0x48, 0x3e, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x46, 0x42, 0x3c, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42,
+        0x00, 0x00, 0x46, 0x42, 0x40, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x43, 0x42, 0x00, 0x86, 0x44, 0x42,
+        0x4c, 0x58, 0x01, 0x00, 0x00, 0x80, 0x44, 0x42, 0x00, 0x00, 0x46, 0x42, 0x4f, 0x61, 0x01, 0x00,
+        0x00, 0x00, 0x46, 0x42, 0x00, 0x86, 0x47, 0x42, 0x4f, 0x56, 0x01, 0x00, 0x00, 0x00, 0x46, 0x42,
+        0x00, 0x00, 0x4c, 0x42, 0x37, 0x47, 0x01, 0x00, 0x00, 0x80, 0x47, 0x42, 0x00, 0x06, 0x49, 0x42,
+        0x51, 0x58, 0x01, 0x00, 0x00, 0x00, 0x49, 0x42, 0x00, 0x86, 0x4a, 0x42, 0x4f, 0x48, 0x01, 0x00,
+        0x00, 0x80, 0x4a, 0x42, 0x00, 0x06, 0x4c, 0x42, 0x4d, 0x44, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42,
+        0x00, 0x44, 0x50, 0x42, 0x4c, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x52, 0x42,
+        0x39, 0x5a, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x52, 0x42, 0x3c, 0x5a, 0x01, 0x00,
+        0x00, 0x80, 0x50, 0x42, 0x00, 0x00, 0x52, 0x42, 0x4c, 0x55, 0x01, 0x00, 0x00, 0x00, 0x52, 0x42,
+        0x00, 0x86, 0x53, 0x42, 0x4c, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x52, 0x42, 0x00, 0x00, 0x58, 0x42,
+        0x34, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x52, 0x42, 0x00, 0x00, 0x58, 0x42, 0x37, 0x4e, 0x01, 0x00,
+        0x00, 0x80, 0x53, 0x42, 0x00, 0x06, 0x55, 0x42, 0x4d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x55, 0x42,
+        0x00, 0x86, 0x56, 0x42, 0x4c, 0x4e, 0x01, 0x00, 0x00, 0x80, 0x56, 0x42, 0x00, 0x06, 0x58, 0x42,
+        0x4a, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x58, 0x42, 0x00, 0x86, 0x59, 0x42, 0x48, 0x4c, 0x01, 0x00,
+        0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x5e, 0x42, 0x35, 0x55, 0x01, 0x00, 0x00, 0x00, 0x58, 0x42,
+        0x00, 0x00, 0x5e, 0x42, 0x39, 0x55, 0x01, 0x00, 0x00, 0x80, 0x59, 0x42, 0x00, 0x06, 0x5b, 0x42,
+        0x46, 0x49, 0x01, 0x00, 0x00, 0x00, 0x5b, 0x42, 0x00, 0x86, 0x5c, 0x42, 0x45, 0x4b, 0x01, 0x00,
+        0x00, 0x80, 0x5c, 0x42, 0x00, 0x06, 0x5e, 0x42, 0x46, 0x49, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x42,
+        0x00, 0x0f, 0x61, 0x42, 0x43, 0x49, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x42, 0x00, 0x00, 0x64, 0x42,
+        0x30, 0x46, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x42, 0x00, 0x00, 0x64, 0x42, 0x34, 0x46, 0x01, 0x00,
+        0x00, 0x00, 0x61, 0x42, 0x00, 0x0f, 0x64, 0x42, 0x40, 0x41, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42,
+        0x00, 0x0f, 0x67, 0x42, 0x3c, 0x48, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x6a, 0x42,
+        0x35, 0x54, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x6a, 0x42, 0x39, 0x54, 0x01, 0x00,
+        0x00, 0x00, 0x67, 0x42, 0x00, 0x86, 0x68, 0x42, 0x41, 0x4e, 0x01, 0x00, 0x00, 0x80, 0x68, 0x42,
+        0x00, 0x06, 0x6a, 0x42, 0x40, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x00, 0x0f, 0x6d, 0x42,
+        0x3e, 0x48, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x00, 0x00, 0x70, 0x42, 0x37, 0x53, 0x01, 0x00,
+        0x00, 0x00, 0x6a, 0x42, 0x00, 0x00, 0x70, 0x42, 0x3b, 0x53, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x42,
+        0x00, 0x86, 0x6e, 0x42, 0x43, 0x5c, 0x01, 0x00, 0x00, 0x80, 0x6e, 0x42, 0x00, 0xeb, 0x6f, 0x42,
+        0x41, 0x5a, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x76, 0x42, 0x3c, 0x57, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x76, 0x42, 0x40, 0x57, 0x01, 0x00, 0x00, 0x00, 0x73, 0x42,
+        0x00, 0x0f, 0x76, 0x42, 0x48, 0x32, 0x01, 0x00, 0x00, 0x00, 0x76, 0x42, 0x00, 0x0f, 0x79, 0x42,
+        0x4a, 0x36, 0x01, 0x00, 0x00, 0x00, 0x76, 0x42, 0x00, 0x00, 0x7c, 0x42, 0x37, 0x34, 0x01, 0x00,
+        0x00, 0x00, 0x79, 0x42, 0x00, 0x0f, 0x7c, 0x42, 0x47, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42,
+        0x00, 0x0f, 0x7f, 0x42, 0x48, 0x42, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x81, 0x42,
+        0x39, 0x46, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x81, 0x42, 0x3c, 0x46, 0x01, 0x00,
+        0x00, 0x00, 0x7f, 0x42, 0x80, 0x07, 0x81, 0x42, 0x40, 0x32, 0x01, 0x00, 0x00, 0x00, 0x81, 0x42,
+        0x80, 0x4a, 0x83, 0x42, 0x43, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x81, 0x42, 0x00, 0x00, 0x84, 0x42,
+        0x34, 0x40, 0x01, 0x00, 0x00, 0x00, 0x81, 0x42, 0x00, 0x00, 0x84, 0x42, 0x3b, 0x40, 0x01, 0x00,
+        0x00, 0x40, 0x83, 0x42, 0x00, 0x03, 0x84, 0x42, 0x45, 0x49, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42,
+        0x80, 0x87, 0x85, 0x42, 0x41, 0x40, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x87, 0x42,
+        0x35, 0x39, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x87, 0x42, 0x39, 0x39, 0x01, 0x00,
+        0x00, 0x80, 0x85, 0x42, 0x80, 0x07, 0x87, 0x42, 0x3c, 0x34, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42,
+        0x80, 0x87, 0x88, 0x42, 0x40, 0x39, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42, 0x00, 0x00, 0x8a, 0x42,
+        0x30, 0x42, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x37, 0x42, 0x01, 0x00,
+        0x00, 0x80, 0x88, 0x42, 0x80, 0x07, 0x8a, 0x42, 0x43, 0x44, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x42,
+        0x80, 0x87, 0x8b, 0x42, 0x41, 0x38, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x8d, 0x42,
+        0x35, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x8d, 0x42, 0x39, 0x3a, 0x01, 0x00,
+        0x00, 0x80, 0x8b, 0x42, 0x80, 0x07, 0x8d, 0x42, 0x40, 0x36, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x42,
+        0x80, 0x87, 0x8e, 0x42, 0x3e, 0x34, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x42, 0x00, 0x00, 0x90, 0x42,
+        0x37, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x42, 0x00, 0x00, 0x90, 0x42, 0x3b, 0x3c, 0x01, 0x00,
+        0x00, 0x80, 0x8e, 0x42, 0x80, 0x07, 0x90, 0x42, 0x43, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x90, 0x42,
+        0x00, 0xb2, 0x95, 0x42, 0x3c, 0x35, 0x01, 0x00, 0x00, 0x00, 0x90, 0x42, 0x00, 0xb2, 0x95, 0x42,
+        0x40, 0x35, 0x01, 0x00, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x96, 0x42, 0x30, 0x33, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xcf, 0xf4, 0x26, 0x3f, 0x39, 0x50, 0x00, 0x00, 0xbf, 0x9b, 0xde, 0x3e,
+        0x9b, 0x90, 0x79, 0x40, 0x58, 0x3b, 0x10, 0x00, 0xcf, 0xf4, 0x26, 0x3f, 0xff, 0xb1, 0xf8, 0x3f,
+        0x40, 0x34, 0x00, 0x00, 0xcf, 0xf4, 0x26, 0x3f, 0x9b, 0x90, 0x79, 0x40, 0x64, 0x2d, 0x10, 0x00,
+        0x07, 0xb2, 0x28, 0x3f, 0xff, 0xb1, 0xf8, 0x3f, 0x44, 0x34, 0x00, 0x00, 0x76, 0x2c, 0x2c, 0x3f,
+        0xff, 0xb1, 0xf8, 0x3f, 0x49, 0x34, 0x00, 0x00, 0x37, 0x6f, 0xfa, 0x3f, 0x34, 0x16, 0x26, 0x40,
+        0x37, 0x50, 0x00, 0x00, 0xcf, 0xf4, 0x26, 0x40, 0x9b, 0x90, 0x79, 0x40, 0x3e, 0x34, 0x00, 0x00,
+        0x1d, 0x64, 0x27, 0x40, 0x9b, 0x90, 0x79, 0x40, 0x42, 0x34, 0x00, 0x00, 0x07, 0xb2, 0x28, 0x40,
+        0x9b, 0x90, 0x79, 0x40, 0x47, 0x34, 0x00, 0x00, 0x37, 0x6f, 0x7a, 0x40, 0x35, 0x16, 0x92, 0x40,
+        0x39, 0x50, 0x00, 0x00, 0x57, 0x21, 0x8b, 0x40, 0xe9, 0xff, 0xf9, 0x40, 0x58, 0x3b, 0x10, 0x00,
+        0x35, 0x16, 0x92, 0x40, 0x1b, 0x64, 0xbb, 0x40, 0x40, 0x34, 0x00, 0x00, 0x35, 0x16, 0x92, 0x40,
+        0xe9, 0xff, 0xf9, 0x40, 0x64, 0x2d, 0x10, 0x00, 0x83, 0x85, 0x92, 0x40, 0x1b, 0x64, 0xbb, 0x40,
+        0x44, 0x34, 0x00, 0x00, 0x1f, 0x64, 0x93, 0x40, 0x1b, 0x64, 0xbb, 0x40, 0x49, 0x34, 0x00, 0x00,
+        0x69, 0xd3, 0xbb, 0x40, 0x03, 0xb2, 0xd0, 0x40, 0x37, 0x50, 0x00, 0x00, 0x03, 0xb2, 0xd0, 0x40,
+        0xe9, 0xff, 0xf9, 0x40, 0x3e, 0x34, 0x00, 0x00, 0x51, 0x21, 0xd1, 0x40, 0xe9, 0xff, 0xf9, 0x40,
+        0x42, 0x34, 0x00, 0x00, 0x51, 0x21, 0xd1, 0x40, 0xe9, 0xff, 0xf9, 0x40, 0x47, 0x34, 0x00, 0x00,
+        0x37, 0x6f, 0xfa, 0x40, 0xdb, 0x4d, 0x1c, 0x41, 0x39, 0x50, 0x00, 0x00, 0x37, 0x6f, 0xfa, 0x40,
+        0x64, 0x7a, 0x00, 0x41, 0x49, 0x54, 0x10, 0x00, 0x79, 0x2c, 0x04, 0x41, 0xdb, 0x4d, 0x1c, 0x41,
+        0x4c, 0x54, 0x10, 0x00, 0xe8, 0xa6, 0x07, 0x41, 0xdb, 0x4d, 0x1c, 0x41, 0x44, 0x34, 0x00, 0x00,
+        0x82, 0x85, 0x1c, 0x41, 0xc2, 0x9b, 0x3b, 0x41, 0x37, 0x50, 0x00, 0x00, 0x82, 0x85, 0x1c, 0x41,
+        0x4a, 0xc8, 0x1f, 0x41, 0x4a, 0x54, 0x10, 0x00, 0x60, 0x7a, 0x23, 0x41, 0xc2, 0x9b, 0x3b, 0x41,
+        0x47, 0x54, 0x10, 0x00, 0xcf, 0xf4, 0x26, 0x41, 0xc2, 0x9b, 0x3b, 0x41, 0x42, 0x34, 0x00, 0x00,
+        0x69, 0xd3, 0x3b, 0x41, 0xa9, 0xe9, 0x5a, 0x41, 0x39, 0x50, 0x00, 0x00, 0x69, 0xd3, 0x3b, 0x41,
+        0xa0, 0x90, 0x42, 0x41, 0x49, 0x54, 0x10, 0x00, 0xb6, 0x42, 0x46, 0x41, 0xa9, 0xe9, 0x5a, 0x41,
+        0x44, 0x24, 0x00, 0x00, 0xb6, 0x42, 0x46, 0x41, 0xed, 0xff, 0x4c, 0x41, 0x45, 0x54, 0x10, 0x00,
+        0x03, 0xb2, 0x50, 0x41, 0x3a, 0x6f, 0x57, 0x41, 0x49, 0x54, 0x10, 0x00, 0x50, 0x21, 0x5b, 0x41,
+        0x90, 0x37, 0x7a, 0x41, 0x37, 0x50, 0x00, 0x00, 0x50, 0x21, 0x5b, 0x41, 0x21, 0xbd, 0x76, 0x41,
+        0x47, 0x54, 0x10, 0x00, 0x9d, 0x90, 0x65, 0x41, 0x90, 0x37, 0x7a, 0x41, 0x42, 0x34, 0x00, 0x00,
+        0x37, 0x6f, 0x7a, 0x41, 0xbb, 0xc2, 0x8c, 0x41, 0x36, 0x50, 0x00, 0x00, 0x37, 0x6f, 0x7a, 0x41,
+        0x6e, 0x53, 0x82, 0x41, 0x45, 0x54, 0x10, 0x00, 0x42, 0x6f, 0x82, 0x41, 0xbb, 0xc2, 0x8c, 0x41,
+        0x3d, 0x34, 0x00, 0x00, 0x42, 0x6f, 0x82, 0x41, 0x15, 0x8b, 0x87, 0x41, 0x47, 0x54, 0x10, 0x00,
+        0x2c, 0x7d, 0x82, 0x41, 0xbb, 0xc2, 0x8c, 0x41, 0x40, 0x34, 0x00, 0x00, 0xe8, 0xa6, 0x87, 0x41,
+        0xbb, 0xc2, 0x8c, 0x41, 0x49, 0x54, 0x10, 0x00, 0x8f, 0xde, 0x8c, 0x41, 0xaf, 0x69, 0x9c, 0x41,
+        0x3b, 0x50, 0x00, 0x00, 0x8f, 0xde, 0x8c, 0x41, 0x08, 0x32, 0x97, 0x41, 0x50, 0x54, 0x10, 0x00,
+        0x35, 0x16, 0x92, 0x41, 0xaf, 0x69, 0x9c, 0x41, 0x3f, 0x34, 0x00, 0x00, 0xdc, 0x4d, 0x97, 0x41,
+        0x77, 0xac, 0x9a, 0x41, 0x51, 0x54, 0x10, 0x00, 0x82, 0x85, 0x9c, 0x41, 0x96, 0xb7, 0xbb, 0x41,
+        0x34, 0x50, 0x00, 0x00, 0x82, 0x85, 0x9c, 0x41, 0x8b, 0x5e, 0xb7, 0x41, 0x4c, 0x54, 0x10, 0x00,
+        0x29, 0xbd, 0xa1, 0x41, 0xa2, 0x10, 0xac, 0x41, 0x39, 0x34, 0x00, 0x00, 0xfc, 0xd8, 0xa1, 0x41,
+        0x96, 0xb7, 0xbb, 0x41, 0x3e, 0x34, 0x00, 0x00, 0x76, 0x2c, 0xac, 0x41, 0x96, 0xb7, 0xbb, 0x41,
+        0x38, 0x34, 0x00, 0x00, 0x69, 0xd3, 0xbb, 0x41, 0x89, 0x5e, 0xcb, 0x41, 0x32, 0x50, 0x00, 0x00,
+        0x69, 0xd3, 0xbb, 0x41, 0x89, 0x5e, 0xcb, 0x41, 0x3d, 0x34, 0x00, 0x00, 0x69, 0xd3, 0xbb, 0x41,
+        0x69, 0x53, 0xbe, 0x41, 0x4e, 0x54, 0x10, 0x00, 0x10, 0x0b, 0xc1, 0x41, 0x0f, 0x8b, 0xc3, 0x41,
+        0x50, 0x54, 0x10, 0x00, 0xb6, 0x42, 0xc6, 0x41, 0xb6, 0xc2, 0xc8, 0x41, 0x51, 0x54, 0x10, 0x00,
+        0x5d, 0x7a, 0xcb, 0x41, 0x03, 0xb2, 0xd0, 0x41, 0x31, 0x50, 0x00, 0x00, 0x5d, 0x7a, 0xcb, 0x41,
+        0x03, 0xb2, 0xd0, 0x41, 0x3b, 0x34, 0x00, 0x00, 0x5d, 0x7a, 0xcb, 0x41, 0x72, 0xac, 0xd6, 0x41,
+        0x50, 0x54, 0x10, 0x00, 0x03, 0xb2, 0xd0, 0x41, 0x7d, 0x05, 0xdb, 0x41, 0x41, 0x3c, 0x00, 0x00,
+        0x50, 0x21, 0xdb, 0x41, 0x70, 0xac, 0xea, 0x41, 0x3b, 0x34, 0x00, 0x00, 0x50, 0x21, 0xdb, 0x41,
+        0x44, 0xc8, 0xea, 0x41, 0x31, 0x50, 0x00, 0x00, 0x50, 0x21, 0xdb, 0x41, 0x50, 0xa1, 0xdd, 0x41,
+        0x4c, 0x54, 0x10, 0x00, 0xf7, 0x58, 0xe0, 0x41, 0xf6, 0xd8, 0xe2, 0x41, 0x4e, 0x54, 0x10, 0x00,
+        0x9d, 0x90, 0xe5, 0x41, 0x9d, 0x10, 0xe8, 0x41, 0x50, 0x54, 0x10, 0x00, 0x44, 0xc8, 0xea, 0x41,
+        0x63, 0x53, 0xfa, 0x41, 0x3a, 0x34, 0x00, 0x00, 0x44, 0xc8, 0xea, 0x41, 0x59, 0xfa, 0xf5, 0x41,
+        0x4e, 0x54, 0x10, 0x00, 0xea, 0xff, 0xef, 0x41, 0x63, 0x53, 0xfa, 0x41, 0x40, 0x34, 0x00, 0x00,
+        0x37, 0x6f, 0xfa, 0x41, 0xdd, 0xa6, 0xff, 0x41, 0x2f, 0x50, 0x00, 0x00, 0x37, 0x6f, 0xfa, 0x41,
+        0xd2, 0xcd, 0xfd, 0x41, 0x42, 0x54, 0x10, 0x00, 0xdd, 0xa6, 0xff, 0x41, 0x2b, 0xfd, 0x04, 0x42,
+        0x36, 0x34, 0x00, 0x00, 0xdd, 0xa6, 0xff, 0x41, 0x2b, 0xfd, 0x04, 0x42, 0x3e, 0x34, 0x00, 0x00,
+        0xdd, 0xa6, 0xff, 0x41, 0xbc, 0x82, 0x01, 0x42, 0x45, 0x54, 0x10, 0x00, 0x42, 0x6f, 0x02, 0x42,
+        0x90, 0x1e, 0x04, 0x42, 0x49, 0x54, 0x10, 0x00, 0x15, 0x0b, 0x05, 0x42, 0xa5, 0xd0, 0x0c, 0x42,
+        0x34, 0x30, 0x00, 0x00, 0x15, 0x0b, 0x05, 0x42, 0x36, 0x56, 0x09, 0x42, 0x4c, 0x54, 0x10, 0x00,
+        0xe8, 0xa6, 0x07, 0x42, 0xa5, 0xd0, 0x0c, 0x42, 0x3b, 0x34, 0x00, 0x00, 0xdd, 0xad, 0x07, 0x42,
+        0xa5, 0xd0, 0x0c, 0x42, 0x3e, 0x34, 0x00, 0x00, 0xbc, 0x42, 0x0a, 0x42, 0xa5, 0xd0, 0x0c, 0x42,
+        0x44, 0x54, 0x10, 0x00, 0x8f, 0xde, 0x0c, 0x42, 0x1f, 0xa4, 0x14, 0x42, 0x3c, 0x34, 0x00, 0x00,
+        0x8f, 0xde, 0x0c, 0x42, 0x13, 0x4b, 0x1a, 0x42, 0x45, 0x54, 0x10, 0x00, 0x84, 0xe5, 0x0c, 0x42,
+        0x1f, 0xa4, 0x14, 0x42, 0x3f, 0x34, 0x00, 0x00, 0x09, 0xb2, 0x14, 0x42, 0x99, 0x77, 0x1c, 0x42,
+        0x3d, 0x34, 0x00, 0x00, 0xf2, 0xbf, 0x14, 0x42, 0x99, 0x77, 0x1c, 0x42, 0x40, 0x34, 0x00, 0x00,
+        0x82, 0x85, 0x1c, 0x42, 0x12, 0x4b, 0x24, 0x42, 0x36, 0x54, 0x00, 0x00, 0x82, 0x85, 0x1c, 0x42,
+        0x6c, 0x13, 0x1f, 0x42, 0x45, 0x50, 0x10, 0x00, 0x82, 0x85, 0x1c, 0x42, 0x12, 0x4b, 0x24, 0x42,
+        0x4c, 0x46, 0x10, 0x00, 0x56, 0x21, 0x1f, 0x42, 0x12, 0x4b, 0x24, 0x42, 0x3d, 0x34, 0x00, 0x00,
+        0x56, 0x21, 0x1f, 0x42, 0x3f, 0xaf, 0x21, 0x42, 0x45, 0x50, 0x10, 0x00, 0x4a, 0x28, 0x1f, 0x42,
+        0x12, 0x4b, 0x24, 0x42, 0x40, 0x34, 0x00, 0x00, 0x29, 0xbd, 0x21, 0x42, 0x12, 0x4b, 0x24, 0x42,
+        0x45, 0x50, 0x10, 0x00, 0xfc, 0x58, 0x24, 0x42, 0xcf, 0xf4, 0x26, 0x42, 0x2f, 0x50, 0x00, 0x00,
+        0xfc, 0x58, 0x24, 0x42, 0xe6, 0xe6, 0x26, 0x42, 0x45, 0x50, 0x10, 0x00, 0xfc, 0x58, 0x24, 0x42,
+        0x8c, 0x1e, 0x2c, 0x42, 0x4b, 0x46, 0x10, 0x00, 0xcf, 0xf4, 0x26, 0x42, 0x8c, 0x1e, 0x2c, 0x42,
+        0x39, 0x34, 0x00, 0x00, 0xcf, 0xf4, 0x26, 0x42, 0xb9, 0x82, 0x29, 0x42, 0x44, 0x50, 0x10, 0x00,
+        0xb9, 0x02, 0x27, 0x42, 0x8c, 0x1e, 0x2c, 0x42, 0x3f, 0x34, 0x00, 0x00, 0xa3, 0x90, 0x29, 0x42,
+        0x8c, 0x1e, 0x2c, 0x42, 0x42, 0x54, 0x10, 0x00, 0x76, 0x2c, 0x2c, 0x42, 0x06, 0xf2, 0x33, 0x42,
+        0x34, 0x50, 0x00, 0x00, 0x76, 0x2c, 0x2c, 0x42, 0x06, 0xf2, 0x33, 0x42, 0x4b, 0x46, 0x10, 0x00,
+        0x76, 0x2c, 0x2c, 0x42, 0xfa, 0x98, 0x39, 0x42, 0x44, 0x50, 0x10, 0x00, 0x49, 0xc8, 0x2e, 0x42,
+        0x06, 0xf2, 0x33, 0x42, 0x38, 0x34, 0x00, 0x00, 0x28, 0xdd, 0x2e, 0x42, 0x06, 0xf2, 0x33, 0x42,
+        0x3f, 0x34, 0x00, 0x00, 0xef, 0xff, 0x33, 0x42, 0xc3, 0x9b, 0x36, 0x42, 0x2f, 0x50, 0x00, 0x00,
+        0xef, 0xff, 0x33, 0x42, 0x7f, 0xc5, 0x3b, 0x42, 0x49, 0x46, 0x10, 0x00, 0xc3, 0x9b, 0x36, 0x42,
+        0x7f, 0xc5, 0x3b, 0x42, 0x38, 0x34, 0x00, 0x00, 0xa1, 0xb0, 0x36, 0x42, 0x7f, 0xc5, 0x3b, 0x42,
+        0x3d, 0x34, 0x00, 0x00, 0x69, 0xd3, 0x3b, 0x42, 0xf9, 0x98, 0x43, 0x42, 0x31, 0x50, 0x00, 0x00,
+        0x69, 0xd3, 0x3b, 0x42, 0x53, 0x61, 0x3e, 0x42, 0x44, 0x50, 0x10, 0x00, 0x69, 0xd3, 0x3b, 0x42,
+        0xf9, 0x98, 0x43, 0x42, 0x47, 0x46, 0x10, 0x00, 0x3c, 0x6f, 0x3e, 0x42, 0xf9, 0x98, 0x43, 0x42,
+        0x34, 0x34, 0x00, 0x00, 0x3c, 0x6f, 0x3e, 0x42, 0x26, 0xfd, 0x40, 0x42, 0x44, 0x50, 0x10, 0x00,
+        0x26, 0x7d, 0x3e, 0x42, 0xf9, 0x98, 0x43, 0x42, 0x3b, 0x34, 0x00, 0x00, 0x10, 0x0b, 0x41, 0x42,
+        0xf9, 0x98, 0x43, 0x42, 0x44, 0x50, 0x10, 0x00, 0xe3, 0xa6, 0x43, 0x42, 0x73, 0x6c, 0x4b, 0x42,
+        0x36, 0x50, 0x00, 0x00, 0xe3, 0xa6, 0x43, 0x42, 0xcc, 0x34, 0x46, 0x42, 0x44, 0x50, 0x10, 0x00,
+        0xe3, 0xa6, 0x43, 0x42, 0x73, 0x6c, 0x4b, 0x42, 0x46, 0x46, 0x10, 0x00, 0xb6, 0x42, 0x46, 0x42,
+        0x73, 0x6c, 0x4b, 0x42, 0x3a, 0x34, 0x00, 0x00, 0xb6, 0x42, 0x46, 0x42, 0xa0, 0xd0, 0x48, 0x42,
+        0x42, 0x54, 0x10, 0x00, 0x89, 0xde, 0x48, 0x42, 0x73, 0x6c, 0x4b, 0x42, 0x40, 0x54, 0x10, 0x00,
+        0x5d, 0x7a, 0x4b, 0x42, 0x30, 0x16, 0x4e, 0x42, 0x2f, 0x50, 0x00, 0x00, 0x5d, 0x7a, 0x4b, 0x42,
+        0x50, 0x21, 0x5b, 0x42, 0x42, 0x54, 0x10, 0x00, 0x5d, 0x7a, 0x4b, 0x42, 0x50, 0x21, 0x5b, 0x42,
+        0x47, 0x46, 0x10, 0x00, 0x30, 0x16, 0x4e, 0x42, 0xed, 0x3f, 0x53, 0x42, 0x39, 0x34, 0x00, 0x00,
+        0x0e, 0x2b, 0x4e, 0x42, 0xed, 0x3f, 0x53, 0x42, 0x3d, 0x34, 0x00, 0x00, 0xd6, 0x4d, 0x53, 0x42,
+        0x66, 0x13, 0x5b, 0x42, 0x34, 0x50, 0x00, 0x00, 0xaa, 0xe9, 0x55, 0x42, 0x66, 0x13, 0x5b, 0x42,
+        0x39, 0x34, 0x00, 0x00, 0x67, 0x13, 0x56, 0x42, 0x66, 0x13, 0x5b, 0x42, 0x3e, 0x34, 0x00, 0x00,
+        0x50, 0x21, 0x5b, 0x42, 0x3a, 0xaf, 0x5d, 0x42, 0x39, 0x54, 0x00, 0x00, 0x50, 0x21, 0x5b, 0x42,
+        0x3a, 0xaf, 0x5d, 0x42, 0x43, 0x46, 0x10, 0x00, 0x50, 0x21, 0x5b, 0x42, 0x23, 0xbd, 0x5d, 0x42,
+        0x47, 0x46, 0x10, 0x00, 0x23, 0xbd, 0x5d, 0x42, 0xe0, 0xe6, 0x62, 0x42, 0x3e, 0x34, 0x00, 0x00,
+        0x02, 0xd2, 0x5d, 0x42, 0xe0, 0xe6, 0x62, 0x42, 0x43, 0x34, 0x00, 0x00, 0xec, 0xdf, 0x5d, 0x42,
+        0xe0, 0xe6, 0x62, 0x42, 0x47, 0x34, 0x00, 0x00, 0xca, 0xf4, 0x62, 0x42, 0x44, 0x48, 0x63, 0x42,
+        0x32, 0x50, 0x00, 0x00, 0xca, 0xf4, 0x62, 0x42, 0xe0, 0x66, 0x65, 0x42, 0x49, 0x4b, 0x10, 0x00,
+        0xa8, 0x09, 0x63, 0x42, 0x92, 0xb7, 0x63, 0x42, 0x3d, 0x34, 0x00, 0x00, 0x44, 0x48, 0x63, 0x42,
+        0xeb, 0x1f, 0x64, 0x42, 0x42, 0x34, 0x00, 0x00, 0xeb, 0x7f, 0x63, 0x42, 0x18, 0xa4, 0x64, 0x42,
+        0x45, 0x34, 0x00, 0x00, 0x9d, 0x90, 0x65, 0x42, 0xb3, 0x02, 0x68, 0x42, 0x49, 0x4b, 0x10, 0x00,
+        0x70, 0x2c, 0x68, 0x42, 0x86, 0x9e, 0x6a, 0x42, 0x49, 0x4b, 0x10, 0x00, 0x44, 0xc8, 0x6a, 0x42,
+        0xd3, 0x8d, 0x72, 0x42, 0x3d, 0x34, 0x00, 0x00, 0x44, 0xc8, 0x6a, 0x42, 0x2d, 0x56, 0x6d, 0x42,
+        0x49, 0x4b, 0x10, 0x00, 0x01, 0xf2, 0x6a, 0x42, 0xd3, 0x8d, 0x72, 0x42, 0x42, 0x34, 0x00, 0x00,
+        0x17, 0x64, 0x6d, 0x42, 0x00, 0xf2, 0x6f, 0x42, 0x47, 0x4b, 0x10, 0x00, 0xea, 0xff, 0x6f, 0x42,
+        0xd3, 0x8d, 0x72, 0x42, 0x45, 0x4b, 0x10, 0x00, 0xbd, 0x9b, 0x72, 0x42, 0x21, 0xfd, 0x72, 0x42,
+        0x31, 0x50, 0x00, 0x00, 0xbd, 0x9b, 0x72, 0x42, 0xd3, 0x0d, 0x75, 0x42, 0x47, 0x4b, 0x10, 0x00,
+        0x9c, 0xb0, 0x72, 0x42, 0xc8, 0x34, 0x73, 0x42, 0x3b, 0x34, 0x00, 0x00, 0x21, 0xfd, 0x72, 0x42,
+        0xea, 0xbf, 0x73, 0x42, 0x40, 0x34, 0x00, 0x00, 0xa7, 0x49, 0x73, 0x42, 0xea, 0x5f, 0x74, 0x42,
+        0x44, 0x34, 0x00, 0x00, 0x90, 0x37, 0x75, 0x42, 0xa6, 0xa9, 0x77, 0x42, 0x47, 0x4b, 0x10, 0x00,
+        0x64, 0xd3, 0x77, 0x42, 0x7a, 0x45, 0x7a, 0x42, 0x47, 0x4b, 0x10, 0x00, 0x37, 0x6f, 0x7a, 0x42,
+        0x63, 0x1a, 0x81, 0x42, 0x3b, 0x34, 0x00, 0x00, 0x37, 0x6f, 0x7a, 0x42, 0x20, 0xfd, 0x7c, 0x42,
+        0x47, 0x4b, 0x10, 0x00, 0xf4, 0x98, 0x7a, 0x42, 0x63, 0x1a, 0x81, 0x42, 0x40, 0x34, 0x00, 0x00,
+        0x0a, 0x0b, 0x7d, 0x42, 0xf4, 0x98, 0x7f, 0x42, 0x45, 0x4b, 0x10, 0x00, 0xdd, 0xa6, 0x7f, 0x42,
+        0x63, 0x1a, 0x81, 0x42, 0x44, 0x4b, 0x10, 0x00, 0x58, 0x21, 0x81, 0x42, 0x90, 0x4e, 0x81, 0x42,
+        0x2f, 0x50, 0x00, 0x00, 0x58, 0x21, 0x81, 0x42, 0xd2, 0xf4, 0x88, 0x42, 0x45, 0x4b, 0x10, 0x00,
+        0xb1, 0x39, 0x81, 0x42, 0xd3, 0x74, 0x81, 0x42, 0x39, 0x34, 0x00, 0x00, 0xff, 0x58, 0x81, 0x42,
+        0x90, 0x9e, 0x81, 0x42, 0x3e, 0x34, 0x00, 0x00, 0x63, 0x6a, 0x81, 0x42, 0x58, 0xc1, 0x81, 0x42,
+        0x42, 0x34, 0x00, 0x00, 0xa6, 0x00, 0x85, 0x42, 0xdd, 0xed, 0x88, 0x42, 0x34, 0x50, 0x00, 0x00,
+        0x79, 0x1c, 0x85, 0x42, 0xdd, 0xed, 0x88, 0x42, 0x39, 0x34, 0x00, 0x00, 0xbc, 0x42, 0x85, 0x42,
+        0xdd, 0xed, 0x88, 0x42, 0x3e, 0x34, 0x00, 0x00, 0xd2, 0xf4, 0x88, 0x42, 0xbc, 0x42, 0x8a, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x6e, 0xd3, 0x89, 0x42, 0x57, 0xc1, 0x90, 0x42, 0x58, 0x3b, 0x10, 0x00,
+        0xbc, 0x42, 0x8a, 0x42, 0x9a, 0xd7, 0x8c, 0x42, 0x40, 0x34, 0x00, 0x00, 0xbc, 0x42, 0x8a, 0x42,
+        0x57, 0xc1, 0x90, 0x42, 0x64, 0x2d, 0x10, 0x00, 0x36, 0x46, 0x8a, 0x42, 0x9a, 0xd7, 0x8c, 0x42,
+        0x44, 0x34, 0x00, 0x00, 0x2b, 0x4d, 0x8a, 0x42, 0x9a, 0xd7, 0x8c, 0x42, 0x49, 0x34, 0x00, 0x00,
+        0x8f, 0xde, 0x8c, 0x42, 0x84, 0x25, 0x8e, 0x42, 0x37, 0x50, 0x00, 0x00, 0x79, 0x2c, 0x8e, 0x42,
+        0x57, 0xc1, 0x90, 0x42, 0x3e, 0x34, 0x00, 0x00, 0xf3, 0x2f, 0x8e, 0x42, 0x57, 0xc1, 0x90, 0x42,
+        0x42, 0x34, 0x00, 0x00, 0x62, 0x3a, 0x8e, 0x42, 0x57, 0xc1, 0x90, 0x42, 0x47, 0x34, 0x00, 0x00,
+        0x4c, 0xc8, 0x90, 0x42, 0x35, 0x16, 0x92, 0x42, 0x39, 0x50, 0x00, 0x00, 0xe8, 0xa6, 0x91, 0x42,
+        0xd1, 0x94, 0x98, 0x42, 0x58, 0x3b, 0x10, 0x00, 0x35, 0x16, 0x92, 0x42, 0x14, 0xab, 0x94, 0x42,
+        0x40, 0x34, 0x00, 0x00, 0x35, 0x16, 0x92, 0x42, 0xd1, 0x94, 0x98, 0x42, 0x64, 0x2d, 0x10, 0x00,
+        0x2a, 0x1d, 0x92, 0x42, 0x14, 0xab, 0x94, 0x42, 0x44, 0x34, 0x00, 0x00, 0x14, 0x2b, 0x92, 0x42,
+        0x14, 0xab, 0x94, 0x42, 0x49, 0x34, 0x00, 0x00, 0x09, 0xb2, 0x94, 0x42, 0xf2, 0xff, 0x95, 0x42,
+        0x37, 0x50, 0x00, 0x00, 0xf2, 0xff, 0x95, 0x42, 0xd1, 0x94, 0x98, 0x42, 0x3e, 0x34, 0x00, 0x00,
+        0xe7, 0x06, 0x96, 0x42, 0xd1, 0x94, 0x98, 0x42, 0x42, 0x34, 0x00, 0x00, 0xe7, 0x06, 0x96, 0x42,
+        0xd1, 0x94, 0x98, 0x42, 0x47, 0x34, 0x00, 0x00, 0xc5, 0x9b, 0x98, 0x42, 0x8d, 0x7e, 0x9c, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0xc5, 0x9b, 0x98, 0x42, 0x1e, 0x04, 0x99, 0x42, 0x49, 0x54, 0x10, 0x00,
+        0x61, 0x7a, 0x99, 0x42, 0x8d, 0x7e, 0x9c, 0x42, 0x4c, 0x54, 0x10, 0x00, 0xaf, 0xe9, 0x99, 0x42,
+        0x8d, 0x7e, 0x9c, 0x42, 0x44, 0x34, 0x00, 0x00, 0x82, 0x85, 0x9c, 0x42, 0x4a, 0x68, 0xa0, 0x42,
+        0x37, 0x50, 0x00, 0x00, 0x82, 0x85, 0x9c, 0x42, 0xdb, 0xed, 0x9c, 0x42, 0x4a, 0x54, 0x10, 0x00,
+        0x1e, 0x64, 0x9d, 0x42, 0x4a, 0x68, 0xa0, 0x42, 0x47, 0x54, 0x10, 0x00, 0x6c, 0xd3, 0x9d, 0x42,
+        0x4a, 0x68, 0xa0, 0x42, 0x42, 0x34, 0x00, 0x00, 0x3f, 0x6f, 0xa0, 0x42, 0x07, 0x52, 0xa4, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x3f, 0x6f, 0xa0, 0x42, 0xe6, 0x46, 0xa1, 0x42, 0x49, 0x54, 0x10, 0x00,
+        0x29, 0xbd, 0xa1, 0x42, 0x07, 0x52, 0xa4, 0x42, 0x44, 0x24, 0x00, 0x00, 0x29, 0xbd, 0xa1, 0x42,
+        0xd0, 0x94, 0xa2, 0x42, 0x45, 0x54, 0x10, 0x00, 0x12, 0x0b, 0xa3, 0x42, 0xb9, 0xe2, 0xa3, 0x42,
+        0x49, 0x54, 0x10, 0x00, 0xfc, 0x58, 0xa4, 0x42, 0xc4, 0x3b, 0xa8, 0x42, 0x37, 0x50, 0x00, 0x00,
+        0xfc, 0x58, 0xa4, 0x42, 0x76, 0xcc, 0xa7, 0x42, 0x47, 0x54, 0x10, 0x00, 0xe6, 0xa6, 0xa5, 0x42,
+        0xc4, 0x3b, 0xa8, 0x42, 0x42, 0x34, 0x00, 0x00, 0xb9, 0x42, 0xa8, 0x42, 0x81, 0x25, 0xac, 0x42,
+        0x36, 0x50, 0x00, 0x00, 0xb9, 0x42, 0xa8, 0x42, 0xae, 0x89, 0xa9, 0x42, 0x45, 0x54, 0x10, 0x00,
+        0xa3, 0x90, 0xa9, 0x42, 0x81, 0x25, 0xac, 0x42, 0x3d, 0x34, 0x00, 0x00, 0xa3, 0x90, 0xa9, 0x42,
+        0x97, 0xd7, 0xaa, 0x42, 0x47, 0x54, 0x10, 0x00, 0x1d, 0x94, 0xa9, 0x42, 0x81, 0x25, 0xac, 0x42,
+        0x40, 0x34, 0x00, 0x00, 0x8c, 0xde, 0xaa, 0x42, 0x81, 0x25, 0xac, 0x42, 0x49, 0x54, 0x10, 0x00,
+        0x76, 0x2c, 0xac, 0x42, 0x3e, 0x0f, 0xb0, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x76, 0x2c, 0xac, 0x42,
+        0x54, 0xc1, 0xae, 0x42, 0x50, 0x54, 0x10, 0x00, 0x5f, 0x7a, 0xad, 0x42, 0x3e, 0x0f, 0xb0, 0x42,
+        0x3f, 0x34, 0x00, 0x00, 0x49, 0xc8, 0xae, 0x42, 0xf0, 0x9f, 0xaf, 0x42, 0x51, 0x54, 0x10, 0x00,
+        0x33, 0x16, 0xb0, 0x42, 0xb7, 0xe2, 0xb7, 0x42, 0x34, 0x50, 0x00, 0x00, 0x33, 0x16, 0xb0, 0x42,
+        0x75, 0xcc, 0xb6, 0x42, 0x4c, 0x54, 0x10, 0x00, 0x1c, 0x64, 0xb1, 0x42, 0xfb, 0xf8, 0xb3, 0x42,
+        0x39, 0x34, 0x00, 0x00, 0x11, 0x6b, 0xb1, 0x42, 0xb7, 0xe2, 0xb7, 0x42, 0x3e, 0x34, 0x00, 0x00,
+        0xef, 0xff, 0xb3, 0x42, 0xb7, 0xe2, 0xb7, 0x42, 0x38, 0x34, 0x00, 0x00, 0xac, 0xe9, 0xb7, 0x42,
+        0x74, 0xcc, 0xbb, 0x42, 0x32, 0x50, 0x00, 0x00, 0xac, 0xe9, 0xb7, 0x42, 0x74, 0xcc, 0xbb, 0x42,
+        0x3d, 0x34, 0x00, 0x00, 0xac, 0xe9, 0xb7, 0x42, 0xac, 0x89, 0xb8, 0x42, 0x4e, 0x54, 0x10, 0x00,
+        0x96, 0x37, 0xb9, 0x42, 0x96, 0xd7, 0xb9, 0x42, 0x50, 0x54, 0x10, 0x00, 0x80, 0x85, 0xba, 0x42,
+        0x80, 0x25, 0xbb, 0x42, 0x51, 0x54, 0x10, 0x00, 0x69, 0xd3, 0xbb, 0x42, 0x53, 0x21, 0xbd, 0x42,
+        0x31, 0x50, 0x00, 0x00, 0x69, 0xd3, 0xbb, 0x42, 0x53, 0x21, 0xbd, 0x42, 0x3b, 0x34, 0x00, 0x00,
+        0x69, 0xd3, 0xbb, 0x42, 0xef, 0x9f, 0xbe, 0x42, 0x50, 0x54, 0x10, 0x00, 0x53, 0x21, 0xbd, 0x42,
+        0x31, 0xb6, 0xbf, 0x42, 0x41, 0x3c, 0x00, 0x00, 0x26, 0xbd, 0xbf, 0x42, 0xee, 0x9f, 0xc3, 0x42,
+        0x3b, 0x34, 0x00, 0x00, 0x26, 0xbd, 0xbf, 0x42, 0xe3, 0xa6, 0xc3, 0x42, 0x31, 0x50, 0x00, 0x00,
+        0x26, 0xbd, 0xbf, 0x42, 0x26, 0x5d, 0xc0, 0x42, 0x4c, 0x54, 0x10, 0x00, 0x10, 0x0b, 0xc1, 0x42,
+        0x10, 0xab, 0xc1, 0x42, 0x4e, 0x54, 0x10, 0x00, 0xf9, 0x58, 0xc2, 0x42, 0xf9, 0xf8, 0xc2, 0x42,
+        0x50, 0x54, 0x10, 0x00, 0xe3, 0xa6, 0xc3, 0x42, 0xab, 0x89, 0xc7, 0x42, 0x3a, 0x34, 0x00, 0x00,
+        0xe3, 0xa6, 0xc3, 0x42, 0x68, 0x73, 0xc6, 0x42, 0x4e, 0x54, 0x10, 0x00, 0xcd, 0xf4, 0xc4, 0x42,
+        0xab, 0x89, 0xc7, 0x42, 0x40, 0x34, 0x00, 0x00, 0xa0, 0x90, 0xc7, 0x42, 0x89, 0xde, 0xc8, 0x42,
+        0x2f, 0x50, 0x00, 0x00, 0xa0, 0x90, 0xc7, 0x42, 0x47, 0x68, 0xc8, 0x42, 0x42, 0x54, 0x10, 0x00,
+        0x89, 0xde, 0xc8, 0x42, 0x68, 0x73, 0xcb, 0x42, 0x36, 0x34, 0x00, 0x00, 0x89, 0xde, 0xc8, 0x42,
+        0x68, 0x73, 0xcb, 0x42, 0x3e, 0x34, 0x00, 0x00, 0x89, 0xde, 0xc8, 0x42, 0x30, 0xb6, 0xc9, 0x42,
+        0x45, 0x54, 0x10, 0x00, 0x73, 0x2c, 0xca, 0x42, 0x1a, 0x04, 0xcb, 0x42, 0x49, 0x54, 0x10, 0x00,
+        0x5d, 0x7a, 0xcb, 0x42, 0x25, 0x5d, 0xcf, 0x42, 0x34, 0x30, 0x00, 0x00, 0x5d, 0x7a, 0xcb, 0x42,
+        0xed, 0x9f, 0xcd, 0x42, 0x4c, 0x54, 0x10, 0x00, 0x46, 0xc8, 0xcc, 0x42, 0x25, 0x5d, 0xcf, 0x42,
+        0x3b, 0x34, 0x00, 0x00, 0xc1, 0xcb, 0xcc, 0x42, 0x25, 0x5d, 0xcf, 0x42, 0x3e, 0x34, 0x00, 0x00,
+        0x30, 0x16, 0xce, 0x42, 0x25, 0x5d, 0xcf, 0x42, 0x44, 0x54, 0x10, 0x00, 0x19, 0x64, 0xcf, 0x42,
+        0xe1, 0x46, 0xd3, 0x42, 0x3c, 0x34, 0x00, 0x00, 0x19, 0x64, 0xcf, 0x42, 0x5c, 0x1a, 0xd6, 0x42,
+        0x45, 0x54, 0x10, 0x00, 0x94, 0x67, 0xcf, 0x42, 0xe1, 0x46, 0xd3, 0x42, 0x3f, 0x34, 0x00, 0x00,
+        0xd6, 0x4d, 0xd3, 0x42, 0x9e, 0x30, 0xd7, 0x42, 0x3d, 0x34, 0x00, 0x00, 0xcb, 0x54, 0xd3, 0x42,
+        0x9e, 0x30, 0xd7, 0x42, 0x40, 0x34, 0x00, 0x00, 0x93, 0x37, 0xd7, 0x42, 0x5b, 0x1a, 0xdb, 0x42,
+        0x36, 0x54, 0x00, 0x00, 0x93, 0x37, 0xd7, 0x42, 0x88, 0x7e, 0xd8, 0x42, 0x45, 0x50, 0x10, 0x00,
+        0x93, 0x37, 0xd7, 0x42, 0x5b, 0x1a, 0xdb, 0x42, 0x4c, 0x46, 0x10, 0x00, 0x7d, 0x85, 0xd8, 0x42,
+        0x5b, 0x1a, 0xdb, 0x42, 0x3d, 0x34, 0x00, 0x00, 0x7d, 0x85, 0xd8, 0x42, 0x72, 0xcc, 0xd9, 0x42,
+        0x45, 0x50, 0x10, 0x00, 0xf7, 0x88, 0xd8, 0x42, 0x5b, 0x1a, 0xdb, 0x42, 0x40, 0x34, 0x00, 0x00,
+        0x66, 0xd3, 0xd9, 0x42, 0x5b, 0x1a, 0xdb, 0x42, 0x45, 0x50, 0x10, 0x00, 0x50, 0x21, 0xdb, 0x42,
+        0x3a, 0x6f, 0xdc, 0x42, 0x2f, 0x50, 0x00, 0x00, 0x50, 0x21, 0xdb, 0x42, 0x45, 0x68, 0xdc, 0x42,
+        0x45, 0x50, 0x10, 0x00, 0x50, 0x21, 0xdb, 0x42, 0x18, 0x04, 0xdf, 0x42, 0x4b, 0x46, 0x10, 0x00,
+        0x3a, 0x6f, 0xdc, 0x42, 0x18, 0x04, 0xdf, 0x42, 0x39, 0x34, 0x00, 0x00, 0x3a, 0x6f, 0xdc, 0x42,
+        0x2e, 0xb6, 0xdd, 0x42, 0x44, 0x50, 0x10, 0x00, 0x2f, 0x76, 0xdc, 0x42, 0x18, 0x04, 0xdf, 0x42,
+        0x3f, 0x34, 0x00, 0x00, 0x23, 0xbd, 0xdd, 0x42, 0x18, 0x04, 0xdf, 0x42, 0x42, 0x54, 0x10, 0x00,
+        0x0d, 0x0b, 0xdf, 0x42, 0xd5, 0xed, 0xe2, 0x42, 0x34, 0x50, 0x00, 0x00, 0x0d, 0x0b, 0xdf, 0x42,
+        0xd5, 0xed, 0xe2, 0x42, 0x4b, 0x46, 0x10, 0x00, 0x0d, 0x0b, 0xdf, 0x42, 0x4f, 0xc1, 0xe5, 0x42,
+        0x44, 0x50, 0x10, 0x00, 0xf7, 0x58, 0xe0, 0x42, 0xd5, 0xed, 0xe2, 0x42, 0x38, 0x34, 0x00, 0x00,
+        0x66, 0x63, 0xe0, 0x42, 0xd5, 0xed, 0xe2, 0x42, 0x3f, 0x34, 0x00, 0x00, 0xca, 0xf4, 0xe2, 0x42,
+        0xb3, 0x42, 0xe4, 0x42, 0x2f, 0x50, 0x00, 0x00, 0xca, 0xf4, 0xe2, 0x42, 0x92, 0xd7, 0xe6, 0x42,
+        0x49, 0x46, 0x10, 0x00, 0xb3, 0x42, 0xe4, 0x42, 0x92, 0xd7, 0xe6, 0x42, 0x38, 0x34, 0x00, 0x00,
+        0x23, 0x4d, 0xe4, 0x42, 0x92, 0xd7, 0xe6, 0x42, 0x3d, 0x34, 0x00, 0x00, 0x87, 0xde, 0xe6, 0x42,
+        0x4f, 0xc1, 0xea, 0x42, 0x31, 0x50, 0x00, 0x00, 0x87, 0xde, 0xe6, 0x42, 0x7b, 0x25, 0xe8, 0x42,
+        0x44, 0x50, 0x10, 0x00, 0x87, 0xde, 0xe6, 0x42, 0x4f, 0xc1, 0xea, 0x42, 0x47, 0x46, 0x10, 0x00,
+        0x70, 0x2c, 0xe8, 0x42, 0x4f, 0xc1, 0xea, 0x42, 0x34, 0x34, 0x00, 0x00, 0x70, 0x2c, 0xe8, 0x42,
+        0x65, 0x73, 0xe9, 0x42, 0x44, 0x50, 0x10, 0x00, 0x65, 0x33, 0xe8, 0x42, 0x4f, 0xc1, 0xea, 0x42,
+        0x3b, 0x34, 0x00, 0x00, 0x5a, 0x7a, 0xe9, 0x42, 0x4f, 0xc1, 0xea, 0x42, 0x44, 0x50, 0x10, 0x00,
+        0x44, 0xc8, 0xea, 0x42, 0x0b, 0xab, 0xee, 0x42, 0x36, 0x50, 0x00, 0x00, 0x44, 0xc8, 0xea, 0x42,
+        0x38, 0x0f, 0xec, 0x42, 0x44, 0x50, 0x10, 0x00, 0x44, 0xc8, 0xea, 0x42, 0x0b, 0xab, 0xee, 0x42,
+        0x46, 0x46, 0x10, 0x00, 0x2d, 0x16, 0xec, 0x42, 0x0b, 0xab, 0xee, 0x42, 0x3a, 0x34, 0x00, 0x00,
+        0x2d, 0x16, 0xec, 0x42, 0x22, 0x5d, 0xed, 0x42, 0x42, 0x54, 0x10, 0x00, 0x17, 0x64, 0xed, 0x42,
+        0x0b, 0xab, 0xee, 0x42, 0x40, 0x54, 0x10, 0x00, 0x00, 0xb2, 0xee, 0x42, 0xea, 0xff, 0xef, 0x42,
+        0x2f, 0x50, 0x00, 0x00, 0x00, 0xb2, 0xee, 0x42, 0x7a, 0x85, 0xf6, 0x42, 0x42, 0x54, 0x10, 0x00,
+        0x00, 0xb2, 0xee, 0x42, 0x7a, 0x85, 0xf6, 0x42, 0x47, 0x46, 0x10, 0x00, 0xea, 0xff, 0xef, 0x42,
+        0xc8, 0x94, 0xf2, 0x42, 0x39, 0x34, 0x00, 0x00, 0x59, 0x0a, 0xf0, 0x42, 0xc8, 0x94, 0xf2, 0x42,
+        0x3d, 0x34, 0x00, 0x00, 0xbd, 0x9b, 0xf2, 0x42, 0x85, 0x7e, 0xf6, 0x42, 0x34, 0x50, 0x00, 0x00,
+        0xa7, 0xe9, 0xf3, 0x42, 0x85, 0x7e, 0xf6, 0x42, 0x39, 0x34, 0x00, 0x00, 0x85, 0xfe, 0xf3, 0x42,
+        0x85, 0x7e, 0xf6, 0x42, 0x3e, 0x34, 0x00, 0x00, 0x7a, 0x85, 0xf6, 0x42, 0x6f, 0xcc, 0xf7, 0x42,
+        0x39, 0x54, 0x00, 0x00, 0x7a, 0x85, 0xf6, 0x42, 0x6f, 0xcc, 0xf7, 0x42, 0x43, 0x46, 0x10, 0x00,
+        0x7a, 0x85, 0xf6, 0x42, 0x64, 0xd3, 0xf7, 0x42, 0x47, 0x46, 0x10, 0x00, 0x64, 0xd3, 0xf7, 0x42,
+        0x42, 0x68, 0xfa, 0x42, 0x3e, 0x34, 0x00, 0x00, 0xd3, 0xdd, 0xf7, 0x42, 0x42, 0x68, 0xfa, 0x42,
+        0x43, 0x34, 0x00, 0x00, 0xc8, 0xe4, 0xf7, 0x42, 0x42, 0x68, 0xfa, 0x42, 0x47, 0x34, 0x00, 0x00,
+        0x37, 0x6f, 0xfa, 0x42, 0xf4, 0x98, 0xfa, 0x42, 0x32, 0x50, 0x00, 0x00, 0x37, 0x6f, 0xfa, 0x42,
+        0x42, 0xa8, 0xfb, 0x42, 0x49, 0x4b, 0x10, 0x00, 0xa6, 0x79, 0xfa, 0x42, 0x9b, 0xd0, 0xfa, 0x42,
+        0x3d, 0x34, 0x00, 0x00, 0xf4, 0x98, 0xfa, 0x42, 0xc8, 0x04, 0xfb, 0x42, 0x42, 0x34, 0x00, 0x00,
+        0xc8, 0xb4, 0xfa, 0x42, 0xde, 0x46, 0xfb, 0x42, 0x45, 0x34, 0x00, 0x00, 0x21, 0xbd, 0xfb, 0x42,
+        0x2c, 0xf6, 0xfc, 0x42, 0x49, 0x4b, 0x10, 0x00, 0x0a, 0x0b, 0xfd, 0x42, 0x15, 0x44, 0xfe, 0x42,
+        0x49, 0x4b, 0x10, 0x00, 0xf4, 0x58, 0xfe, 0x42, 0xde, 0x1d, 0x01, 0x43, 0x3d, 0x34, 0x00, 0x00,
+        0xf4, 0x58, 0xfe, 0x42, 0xe9, 0x9f, 0xff, 0x42, 0x49, 0x4b, 0x10, 0x00, 0xd2, 0x6d, 0xfe, 0x42,
+        0xde, 0x1d, 0x01, 0x43, 0x42, 0x34, 0x00, 0x00, 0xdd, 0xa6, 0xff, 0x42, 0xe9, 0x76, 0x00, 0x43,
+        0x47, 0x4b, 0x10, 0x00, 0x64, 0x7a, 0x00, 0x43, 0xde, 0x1d, 0x01, 0x43, 0x45, 0x4b, 0x10, 0x00,
+        0x58, 0x21, 0x01, 0x43, 0xb1, 0x39, 0x01, 0x43, 0x31, 0x50, 0x00, 0x00, 0x58, 0x21, 0x01, 0x43,
+        0xde, 0xbd, 0x01, 0x43, 0x47, 0x4b, 0x10, 0x00, 0x90, 0x26, 0x01, 0x43, 0x9b, 0x47, 0x01, 0x43,
+        0x3b, 0x34, 0x00, 0x00, 0xb1, 0x39, 0x01, 0x43, 0x63, 0x6a, 0x01, 0x43, 0x40, 0x34, 0x00, 0x00,
+        0xd3, 0x4c, 0x01, 0x43, 0x63, 0x92, 0x01, 0x43, 0x44, 0x34, 0x00, 0x00, 0x4d, 0xc8, 0x01, 0x43,
+        0xd3, 0x64, 0x02, 0x43, 0x47, 0x4b, 0x10, 0x00, 0x42, 0x6f, 0x02, 0x43, 0xc7, 0x0b, 0x03, 0x43,
+        0x47, 0x4b, 0x10, 0x00, 0x37, 0x16, 0x03, 0x43, 0x9b, 0x07, 0x05, 0x43, 0x3b, 0x34, 0x00, 0x00,
+        0x37, 0x16, 0x03, 0x43, 0xb1, 0xb9, 0x03, 0x43, 0x47, 0x4b, 0x10, 0x00, 0xa6, 0x20, 0x03, 0x43,
+        0x9b, 0x07, 0x05, 0x43, 0x40, 0x34, 0x00, 0x00, 0x2c, 0xbd, 0x03, 0x43, 0xa6, 0x60, 0x04, 0x43,
+        0x45, 0x4b, 0x10, 0x00, 0x20, 0x64, 0x04, 0x43, 0x9b, 0x07, 0x05, 0x43, 0x44, 0x4b, 0x10, 0x00,
+        0x15, 0x0b, 0x05, 0x43, 0xb1, 0x21, 0x05, 0x43, 0x2f, 0x50, 0x00, 0x00, 0x15, 0x0b, 0x05, 0x43,
+        0xd2, 0xf4, 0x08, 0x43, 0x45, 0x4b, 0x10, 0x00, 0x42, 0x17, 0x05, 0x43, 0xd2, 0x34, 0x05, 0x43,
+        0x39, 0x34, 0x00, 0x00, 0xe9, 0x26, 0x05, 0x43, 0xb1, 0x49, 0x05, 0x43, 0x3e, 0x34, 0x00, 0x00,
+        0x9b, 0x2f, 0x05, 0x43, 0x15, 0x5b, 0x05, 0x43, 0x42, 0x34, 0x00, 0x00, 0xbc, 0xfa, 0x06, 0x43,
+        0x58, 0xf1, 0x08, 0x43, 0x34, 0x50, 0x00, 0x00, 0xa6, 0x08, 0x07, 0x43, 0x58, 0xf1, 0x08, 0x43,
+        0x39, 0x34, 0x00, 0x00, 0xc7, 0x1b, 0x07, 0x43, 0x58, 0xf1, 0x08, 0x43, 0x3e, 0x34, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xe4, 0x79, 0xb6, 0x3f, 0x34, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xa7, 0xaa, 0x36, 0x40, 0x37, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x79, 0xb6, 0x3f,
+        0x28, 0x31, 0x01, 0x00, 0x6a, 0xdb, 0xb6, 0x3f, 0xa7, 0xaa, 0x36, 0x40, 0x2a, 0x31, 0x01, 0x00,
+        0x6a, 0xdb, 0x36, 0x40, 0x2e, 0x0c, 0x89, 0x40, 0x39, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x40,
+        0x09, 0xc3, 0xb6, 0x40, 0x3e, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x40, 0x2e, 0x0c, 0x89, 0x40,
+        0x2b, 0x31, 0x01, 0x00, 0x90, 0x24, 0x89, 0x40, 0x09, 0xc3, 0xb6, 0x40, 0x2f, 0x31, 0x01, 0x00,
+        0x6a, 0xdb, 0xb6, 0x40, 0xe3, 0x79, 0xe4, 0x40, 0x36, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x40,
+        0x5f, 0x18, 0x09, 0x41, 0x39, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x40, 0xe3, 0x79, 0xe4, 0x40,
+        0x2d, 0x31, 0x01, 0x00, 0x45, 0x92, 0xe4, 0x40, 0x5f, 0x18, 0x09, 0x41, 0x2b, 0x31, 0x01, 0x00,
+        0x90, 0x24, 0x09, 0x41, 0xcc, 0xf3, 0x1f, 0x41, 0x39, 0x31, 0x00, 0x00, 0x90, 0x24, 0x09, 0x41,
+        0x39, 0xcf, 0x36, 0x41, 0x3d, 0x31, 0x00, 0x00, 0x90, 0x24, 0x09, 0x41, 0x39, 0xcf, 0x36, 0x41,
+        0x26, 0x31, 0x01, 0x00, 0x6a, 0xdb, 0x36, 0x41, 0xa7, 0xaa, 0x4d, 0x41, 0x34, 0x31, 0x00, 0x00,
+        0x6a, 0xdb, 0x36, 0x41, 0xa7, 0xaa, 0x4d, 0x41, 0x37, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x41,
+        0x14, 0x86, 0x64, 0x41, 0x3b, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x41, 0xa7, 0xaa, 0x4d, 0x41,
+        0x28, 0x31, 0x01, 0x00, 0xd7, 0xb6, 0x4d, 0x41, 0x14, 0x86, 0x64, 0x41, 0x2a, 0x31, 0x01, 0x00,
+        0x45, 0x92, 0x64, 0x41, 0x81, 0x61, 0x7b, 0x41, 0x39, 0x31, 0x00, 0x00, 0x45, 0x92, 0x64, 0x41,
+        0x81, 0x61, 0x7b, 0x41, 0x3e, 0x31, 0x00, 0x00, 0x45, 0x92, 0x64, 0x41, 0x77, 0x1e, 0x89, 0x41,
+        0x42, 0x31, 0x00, 0x00, 0x45, 0x92, 0x64, 0x41, 0x81, 0x61, 0x7b, 0x41, 0x2b, 0x31, 0x01, 0x00,
+        0xb2, 0x6d, 0x7b, 0x41, 0x77, 0x1e, 0x89, 0x41, 0x2f, 0x31, 0x01, 0x00, 0x90, 0x24, 0x89, 0x41,
+        0x2e, 0x8c, 0x94, 0x41, 0x36, 0x31, 0x00, 0x00, 0x90, 0x24, 0x89, 0x41, 0x2e, 0x8c, 0x94, 0x41,
+        0x39, 0x31, 0x00, 0x00, 0x90, 0x24, 0x89, 0x41, 0xe4, 0xf9, 0x9f, 0x41, 0x3d, 0x31, 0x00, 0x00,
+        0x90, 0x24, 0x89, 0x41, 0x2e, 0x8c, 0x94, 0x41, 0x2d, 0x31, 0x01, 0x00, 0x46, 0x92, 0x94, 0x41,
+        0xe4, 0xf9, 0x9f, 0x41, 0x2b, 0x31, 0x01, 0x00, 0xfd, 0xff, 0x9f, 0x41, 0x9b, 0x67, 0xab, 0x41,
+        0x39, 0x31, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x41, 0x9b, 0x67, 0xab, 0x41, 0x3d, 0x31, 0x00, 0x00,
+        0xfd, 0xff, 0x9f, 0x41, 0x52, 0xd5, 0xb6, 0x41, 0x40, 0x31, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x41,
+        0x52, 0xd5, 0xb6, 0x41, 0x26, 0x31, 0x01, 0x00, 0x6a, 0xdb, 0xb6, 0x41, 0x08, 0x43, 0xc2, 0x41,
+        0x34, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x41, 0x08, 0x43, 0xc2, 0x41, 0x37, 0x31, 0x00, 0x00,
+        0x6a, 0xdb, 0xb6, 0x41, 0xbf, 0xb0, 0xcd, 0x41, 0x3b, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x41,
+        0x08, 0x43, 0xc2, 0x41, 0x28, 0x31, 0x01, 0x00, 0x21, 0x49, 0xc2, 0x41, 0xbf, 0xb0, 0xcd, 0x41,
+        0x2a, 0x31, 0x01, 0x00, 0xd7, 0xb6, 0xcd, 0x41, 0x76, 0x1e, 0xd9, 0x41, 0x39, 0x31, 0x00, 0x00,
+        0xd7, 0xb6, 0xcd, 0x41, 0x76, 0x1e, 0xd9, 0x41, 0x3e, 0x31, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x41,
+        0x2c, 0x8c, 0xe4, 0x41, 0x42, 0x31, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x41, 0x76, 0x1e, 0xd9, 0x41,
+        0x2b, 0x31, 0x01, 0x00, 0x8e, 0x24, 0xd9, 0x41, 0x2c, 0x8c, 0xe4, 0x41, 0x2f, 0x31, 0x01, 0x00,
+        0x45, 0x92, 0xe4, 0x41, 0xe3, 0xf9, 0xef, 0x41, 0x36, 0x31, 0x00, 0x00, 0x45, 0x92, 0xe4, 0x41,
+        0xe3, 0xf9, 0xef, 0x41, 0x39, 0x31, 0x00, 0x00, 0x45, 0x92, 0xe4, 0x41, 0x9a, 0x67, 0xfb, 0x41,
+        0x3d, 0x31, 0x00, 0x00, 0x45, 0x92, 0xe4, 0x41, 0xe3, 0xf9, 0xef, 0x41, 0x2d, 0x31, 0x01, 0x00,
+        0xfb, 0xff, 0xef, 0x41, 0x9a, 0x67, 0xfb, 0x41, 0x2b, 0x31, 0x01, 0x00, 0xb2, 0x6d, 0xfb, 0x41,
+        0xa8, 0x6a, 0x03, 0x42, 0x39, 0x31, 0x00, 0x00, 0xb2, 0x6d, 0xfb, 0x41, 0xa8, 0x6a, 0x03, 0x42,
+        0x3d, 0x31, 0x00, 0x00, 0xb2, 0x6d, 0xfb, 0x41, 0x83, 0x21, 0x09, 0x42, 0x40, 0x31, 0x00, 0x00,
+        0xb2, 0x6d, 0xfb, 0x41, 0x83, 0x21, 0x09, 0x42, 0x26, 0x31, 0x01, 0x00, 0x90, 0x24, 0x09, 0x42,
+        0x5f, 0xd8, 0x0e, 0x42, 0x34, 0x50, 0x00, 0x00, 0x90, 0x24, 0x09, 0x42, 0x5f, 0xd8, 0x0e, 0x42,
+        0x37, 0x50, 0x00, 0x00, 0x90, 0x24, 0x09, 0x42, 0x5f, 0xd8, 0x0e, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x90, 0x24, 0x09, 0x42, 0x5f, 0xd8, 0x0e, 0x42, 0x28, 0x50, 0x01, 0x00, 0x6b, 0xdb, 0x0e, 0x42,
+        0xcc, 0xb3, 0x11, 0x42, 0x45, 0x50, 0x00, 0x00, 0x6b, 0xdb, 0x0e, 0x42, 0x3a, 0x8f, 0x14, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0xd9, 0xb6, 0x11, 0x42, 0x3a, 0x8f, 0x14, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x46, 0x92, 0x14, 0x42, 0x83, 0x21, 0x1d, 0x42, 0x39, 0x50, 0x00, 0x00, 0x46, 0x92, 0x14, 0x42,
+        0x83, 0x21, 0x1d, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x46, 0x92, 0x14, 0x42, 0x83, 0x21, 0x1d, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x46, 0x92, 0x14, 0x42, 0x15, 0x46, 0x1a, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x22, 0x49, 0x1a, 0x42, 0x83, 0x21, 0x1d, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x8f, 0x24, 0x1d, 0x42,
+        0x3a, 0x8f, 0x1e, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x46, 0x92, 0x1e, 0x42, 0xf1, 0xfc, 0x1f, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x1f, 0x42, 0xcc, 0xb3, 0x25, 0x42, 0x36, 0x50, 0x00, 0x00,
+        0xfd, 0xff, 0x1f, 0x42, 0x3a, 0x8f, 0x28, 0x42, 0x39, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x1f, 0x42,
+        0x3a, 0x8f, 0x28, 0x42, 0x3d, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x1f, 0x42, 0xcc, 0xb3, 0x25, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0xd8, 0xb6, 0x25, 0x42, 0xa7, 0x6a, 0x2b, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x46, 0x92, 0x28, 0x42, 0xf0, 0xfc, 0x29, 0x42, 0x42, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x29, 0x42,
+        0xa7, 0x6a, 0x2b, 0x42, 0x45, 0x50, 0x00, 0x00, 0xb3, 0x6d, 0x2b, 0x42, 0x5e, 0xd8, 0x36, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0xb3, 0x6d, 0x2b, 0x42, 0x5e, 0xd8, 0x36, 0x42, 0x3d, 0x50, 0x00, 0x00,
+        0xb3, 0x6d, 0x2b, 0x42, 0x5e, 0xd8, 0x36, 0x42, 0x40, 0x50, 0x00, 0x00, 0xb3, 0x6d, 0x2b, 0x42,
+        0x5e, 0xd8, 0x36, 0x42, 0x26, 0x50, 0x01, 0x00, 0x6a, 0xdb, 0x36, 0x42, 0xcc, 0xb3, 0x39, 0x42,
+        0x34, 0x50, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x42, 0xcc, 0xb3, 0x39, 0x42, 0x37, 0x50, 0x00, 0x00,
+        0x6a, 0xdb, 0x36, 0x42, 0xcc, 0xb3, 0x39, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x42,
+        0x39, 0x8f, 0x3c, 0x42, 0x28, 0x50, 0x01, 0x00, 0xd8, 0xb6, 0x39, 0x42, 0x39, 0x8f, 0x3c, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x45, 0x92, 0x3c, 0x42, 0xa7, 0x6a, 0x3f, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x45, 0x92, 0x3c, 0x42, 0x15, 0x46, 0x42, 0x42, 0x2a, 0x50, 0x01, 0x00, 0xb3, 0x6d, 0x3f, 0x42,
+        0x15, 0x46, 0x42, 0x42, 0x45, 0x50, 0x00, 0x00, 0x21, 0x49, 0x42, 0x42, 0x5e, 0xd8, 0x4a, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x21, 0x49, 0x42, 0x42, 0x5e, 0xd8, 0x4a, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x21, 0x49, 0x42, 0x42, 0x5e, 0xd8, 0x4a, 0x42, 0x42, 0x50, 0x00, 0x00, 0x21, 0x49, 0x42, 0x42,
+        0xf0, 0xfc, 0x47, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xfc, 0xff, 0x47, 0x42, 0x5e, 0xd8, 0x4a, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x6a, 0xdb, 0x4a, 0x42, 0x14, 0x46, 0x4c, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x21, 0x49, 0x4c, 0x42, 0xcb, 0xb3, 0x4d, 0x42, 0x40, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x4d, 0x42,
+        0xa7, 0x6a, 0x53, 0x42, 0x36, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x4d, 0x42, 0x14, 0x46, 0x56, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x4d, 0x42, 0x14, 0x46, 0x56, 0x42, 0x3d, 0x50, 0x00, 0x00,
+        0xd7, 0xb6, 0x4d, 0x42, 0xa7, 0x6a, 0x53, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xb3, 0x6d, 0x53, 0x42,
+        0x82, 0x21, 0x59, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x20, 0x49, 0x56, 0x42, 0xcb, 0xb3, 0x57, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x57, 0x42, 0x82, 0x21, 0x59, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x8e, 0x24, 0x59, 0x42, 0x38, 0x8f, 0x64, 0x42, 0x39, 0x50, 0x00, 0x00, 0x8e, 0x24, 0x59, 0x42,
+        0x38, 0x8f, 0x64, 0x42, 0x3d, 0x50, 0x00, 0x00, 0x8e, 0x24, 0x59, 0x42, 0x38, 0x8f, 0x64, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x8e, 0x24, 0x59, 0x42, 0x38, 0x8f, 0x64, 0x42, 0x26, 0x50, 0x01, 0x00,
+        0x45, 0x92, 0x64, 0x42, 0x14, 0x46, 0x6a, 0x42, 0x34, 0x50, 0x00, 0x00, 0x45, 0x92, 0x64, 0x42,
+        0x14, 0x46, 0x6a, 0x42, 0x37, 0x50, 0x00, 0x00, 0x45, 0x92, 0x64, 0x42, 0x14, 0x46, 0x6a, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x45, 0x92, 0x64, 0x42, 0x14, 0x46, 0x6a, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0x20, 0x49, 0x6a, 0x42, 0x81, 0x21, 0x6d, 0x42, 0x45, 0x50, 0x00, 0x00, 0x20, 0x49, 0x6a, 0x42,
+        0xef, 0xfc, 0x6f, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x8e, 0x24, 0x6d, 0x42, 0xef, 0xfc, 0x6f, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x6f, 0x42, 0xca, 0xb3, 0x75, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0xfb, 0xff, 0x6f, 0x42, 0xca, 0xb3, 0x75, 0x42, 0x42, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x6f, 0x42,
+        0x38, 0x8f, 0x78, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x6f, 0x42, 0xca, 0xb3, 0x75, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0xfb, 0xff, 0x6f, 0x42, 0xca, 0xb3, 0x75, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0xd7, 0xb6, 0x75, 0x42, 0x38, 0x8f, 0x78, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x44, 0x92, 0x78, 0x42,
+        0xef, 0xfc, 0x79, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x44, 0x92, 0x78, 0x42, 0xef, 0xfc, 0x79, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x79, 0x42, 0xa6, 0x6a, 0x7b, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0xfb, 0xff, 0x79, 0x42, 0xa6, 0x6a, 0x7b, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xb2, 0x6d, 0x7b, 0x42,
+        0x77, 0xfe, 0x81, 0x42, 0x3e, 0x50, 0x00, 0x00, 0xb2, 0x6d, 0x7b, 0x42, 0x77, 0xfe, 0x81, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0xb2, 0x6d, 0x7b, 0x42, 0xc1, 0x90, 0x80, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0xb2, 0x6d, 0x7b, 0x42, 0xc1, 0x90, 0x80, 0x42, 0x36, 0x50, 0x01, 0x00, 0xb2, 0x6d, 0x7b, 0x42,
+        0xc1, 0x90, 0x80, 0x42, 0x39, 0x50, 0x01, 0x00, 0x47, 0x92, 0x80, 0x42, 0x2e, 0x6c, 0x83, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0xfd, 0xff, 0x81, 0x42, 0x53, 0xb5, 0x82, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0xfd, 0xff, 0x81, 0x42, 0x53, 0xb5, 0x82, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xd9, 0xb6, 0x82, 0x42,
+        0x2e, 0x6c, 0x83, 0x42, 0x49, 0x50, 0x00, 0x00, 0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42, 0x3d, 0x50, 0x00, 0x00,
+        0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42, 0x40, 0x50, 0x00, 0x00, 0xb4, 0x6d, 0x83, 0x42,
+        0x09, 0x23, 0x89, 0x42, 0x45, 0x50, 0x00, 0x00, 0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x90, 0x24, 0x89, 0x42, 0x77, 0xfe, 0x8b, 0x42, 0x34, 0x50, 0x00, 0x00,
+        0x90, 0x24, 0x89, 0x42, 0x77, 0xfe, 0x8b, 0x42, 0x37, 0x50, 0x00, 0x00, 0x90, 0x24, 0x89, 0x42,
+        0x77, 0xfe, 0x8b, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x90, 0x24, 0x89, 0x42, 0x77, 0xfe, 0x8b, 0x42,
+        0x28, 0x50, 0x01, 0x00, 0xfd, 0xff, 0x8b, 0x42, 0x2e, 0x6c, 0x8d, 0x42, 0x47, 0x60, 0x00, 0x00,
+        0xfd, 0xff, 0x8b, 0x42, 0xe5, 0xd9, 0x8e, 0x42, 0x2a, 0x60, 0x01, 0x00, 0xb4, 0x6d, 0x8d, 0x42,
+        0xe5, 0xd9, 0x8e, 0x42, 0x45, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0x8e, 0x42, 0x09, 0x23, 0x93, 0x42,
+        0x39, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0x8e, 0x42, 0x09, 0x23, 0x93, 0x42, 0x3e, 0x60, 0x00, 0x00,
+        0x6b, 0xdb, 0x8e, 0x42, 0x09, 0x23, 0x93, 0x42, 0x42, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0x8e, 0x42,
+        0x52, 0xb5, 0x91, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xd9, 0xb6, 0x91, 0x42, 0x09, 0x23, 0x93, 0x42,
+        0x2f, 0x60, 0x01, 0x00, 0x8f, 0x24, 0x93, 0x42, 0xe5, 0xd9, 0x93, 0x42, 0x3e, 0x60, 0x00, 0x00,
+        0x6b, 0xdb, 0x93, 0x42, 0xc0, 0x90, 0x94, 0x42, 0x40, 0x60, 0x00, 0x00, 0x46, 0x92, 0x94, 0x42,
+        0x2e, 0x6c, 0x97, 0x42, 0x36, 0x60, 0x00, 0x00, 0x46, 0x92, 0x94, 0x42, 0xe5, 0xd9, 0x98, 0x42,
+        0x39, 0x60, 0x00, 0x00, 0x46, 0x92, 0x94, 0x42, 0xe5, 0xd9, 0x98, 0x42, 0x3d, 0x60, 0x00, 0x00,
+        0x46, 0x92, 0x94, 0x42, 0x2e, 0x6c, 0x97, 0x42, 0x2d, 0x60, 0x01, 0x00, 0xb4, 0x6d, 0x97, 0x42,
+        0x9b, 0x47, 0x9a, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x6b, 0xdb, 0x98, 0x42, 0xc0, 0x90, 0x99, 0x42,
+        0x42, 0x60, 0x00, 0x00, 0x46, 0x92, 0x99, 0x42, 0x9b, 0x47, 0x9a, 0x42, 0x45, 0x60, 0x00, 0x00,
+        0x22, 0x49, 0x9a, 0x42, 0x77, 0xfe, 0x9f, 0x42, 0x39, 0x60, 0x00, 0x00, 0x22, 0x49, 0x9a, 0x42,
+        0x77, 0xfe, 0x9f, 0x42, 0x3d, 0x60, 0x00, 0x00, 0x22, 0x49, 0x9a, 0x42, 0x77, 0xfe, 0x9f, 0x42,
+        0x40, 0x60, 0x00, 0x00, 0x22, 0x49, 0x9a, 0x42, 0x77, 0xfe, 0x9f, 0x42, 0x26, 0x60, 0x01, 0x00,
+        0xfd, 0xff, 0x9f, 0x42, 0xe4, 0xd9, 0xa2, 0x42, 0x34, 0x60, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x42,
+        0xe4, 0xd9, 0xa2, 0x42, 0x37, 0x60, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x42, 0xe4, 0xd9, 0xa2, 0x42,
+        0x3b, 0x60, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x42, 0xe4, 0xd9, 0xa2, 0x42, 0x28, 0x60, 0x01, 0x00,
+        0x6b, 0xdb, 0xa2, 0x42, 0x9b, 0x47, 0xa4, 0x42, 0x45, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0xa2, 0x42,
+        0x52, 0xb5, 0xa5, 0x42, 0x2a, 0x60, 0x01, 0x00, 0x21, 0x49, 0xa4, 0x42, 0x52, 0xb5, 0xa5, 0x42,
+        0x47, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xa5, 0x42, 0x77, 0xfe, 0xa9, 0x42, 0x39, 0x60, 0x00, 0x00,
+        0xd8, 0xb6, 0xa5, 0x42, 0x77, 0xfe, 0xa9, 0x42, 0x3e, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xa5, 0x42,
+        0x77, 0xfe, 0xa9, 0x42, 0x42, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xa5, 0x42, 0xc0, 0x90, 0xa8, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x46, 0x92, 0xa8, 0x42, 0x77, 0xfe, 0xa9, 0x42, 0x2f, 0x60, 0x01, 0x00,
+        0xfd, 0xff, 0xa9, 0x42, 0x52, 0xb5, 0xaa, 0x42, 0x3e, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xaa, 0x42,
+        0x2d, 0x6c, 0xab, 0x42, 0x40, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xab, 0x42, 0x9b, 0x47, 0xae, 0x42,
+        0x36, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xab, 0x42, 0x52, 0xb5, 0xaf, 0x42, 0x39, 0x60, 0x00, 0x00,
+        0xb3, 0x6d, 0xab, 0x42, 0x52, 0xb5, 0xaf, 0x42, 0x3d, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xab, 0x42,
+        0x9b, 0x47, 0xae, 0x42, 0x2d, 0x60, 0x01, 0x00, 0x21, 0x49, 0xae, 0x42, 0x52, 0xb5, 0xaf, 0x42,
+        0x4e, 0x60, 0x00, 0x00, 0x21, 0x49, 0xae, 0x42, 0x09, 0x23, 0xb1, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0xd8, 0xb6, 0xaf, 0x42, 0x2d, 0x6c, 0xb0, 0x42, 0x42, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xb0, 0x42,
+        0x09, 0x23, 0xb1, 0x42, 0x45, 0x60, 0x00, 0x00, 0x8f, 0x24, 0xb1, 0x42, 0xe4, 0xd9, 0xb6, 0x42,
+        0x39, 0x60, 0x00, 0x00, 0x8f, 0x24, 0xb1, 0x42, 0xe4, 0xd9, 0xb6, 0x42, 0x3d, 0x60, 0x00, 0x00,
+        0x8f, 0x24, 0xb1, 0x42, 0xe4, 0xd9, 0xb6, 0x42, 0x40, 0x60, 0x00, 0x00, 0x8f, 0x24, 0xb1, 0x42,
+        0xe4, 0xd9, 0xb6, 0x42, 0x26, 0x60, 0x01, 0x00, 0x6a, 0xdb, 0xb6, 0x42, 0x09, 0x23, 0xbb, 0x42,
+        0x3b, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x42, 0x09, 0x23, 0xbb, 0x42, 0x3e, 0x40, 0x00, 0x00,
+        0x6a, 0xdb, 0xb6, 0x42, 0x09, 0x23, 0xbb, 0x42, 0x42, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x42,
+        0xbf, 0x90, 0xbc, 0x42, 0x23, 0x40, 0x01, 0x00, 0x6a, 0xdb, 0xb6, 0x42, 0xbf, 0x90, 0xbc, 0x42,
+        0x2f, 0x40, 0x01, 0x00, 0x8f, 0x24, 0xbb, 0x42, 0xe4, 0xd9, 0xbb, 0x42, 0x47, 0x40, 0x00, 0x00,
+        0x6a, 0xdb, 0xbb, 0x42, 0xbf, 0x90, 0xbc, 0x42, 0x45, 0x40, 0x00, 0x00, 0x45, 0x92, 0xbc, 0x42,
+        0x2d, 0x6c, 0xbf, 0x42, 0x38, 0x40, 0x00, 0x00, 0x45, 0x92, 0xbc, 0x42, 0x2d, 0x6c, 0xbf, 0x42,
+        0x3b, 0x40, 0x00, 0x00, 0x45, 0x92, 0xbc, 0x42, 0x2d, 0x6c, 0xbf, 0x42, 0x40, 0x40, 0x00, 0x00,
+        0x45, 0x92, 0xbc, 0x42, 0x9b, 0x47, 0xc2, 0x42, 0x28, 0x40, 0x01, 0x00, 0x45, 0x92, 0xbc, 0x42,
+        0x9b, 0x47, 0xc2, 0x42, 0x34, 0x40, 0x01, 0x00, 0xb3, 0x6d, 0xbf, 0x42, 0xe4, 0xd9, 0xc0, 0x42,
+        0x40, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xc0, 0x42, 0x9b, 0x47, 0xc2, 0x42, 0x3e, 0x40, 0x00, 0x00,
+        0x21, 0x49, 0xc2, 0x42, 0xbf, 0x90, 0xc6, 0x42, 0x34, 0x40, 0x00, 0x00, 0x21, 0x49, 0xc2, 0x42,
+        0xbf, 0x90, 0xc6, 0x42, 0x39, 0x40, 0x00, 0x00, 0x21, 0x49, 0xc2, 0x42, 0xbf, 0x90, 0xc6, 0x42,
+        0x3d, 0x40, 0x00, 0x00, 0x21, 0x49, 0xc2, 0x42, 0x76, 0xfe, 0xc7, 0x42, 0x21, 0x40, 0x01, 0x00,
+        0x21, 0x49, 0xc2, 0x42, 0x76, 0xfe, 0xc7, 0x42, 0x2d, 0x40, 0x01, 0x00, 0x45, 0x92, 0xc6, 0x42,
+        0x9b, 0x47, 0xc7, 0x42, 0x3e, 0x40, 0x00, 0x00, 0x21, 0x49, 0xc7, 0x42, 0x76, 0xfe, 0xc7, 0x42,
+        0x40, 0x40, 0x00, 0x00, 0xfc, 0xff, 0xc7, 0x42, 0x51, 0xb5, 0xcd, 0x42, 0x32, 0x40, 0x00, 0x00,
+        0xfc, 0xff, 0xc7, 0x42, 0x51, 0xb5, 0xcd, 0x42, 0x37, 0x40, 0x00, 0x00, 0xfc, 0xff, 0xc7, 0x42,
+        0x51, 0xb5, 0xcd, 0x42, 0x3b, 0x40, 0x00, 0x00, 0xfc, 0xff, 0xc7, 0x42, 0x51, 0xb5, 0xcd, 0x42,
+        0x1f, 0x40, 0x01, 0x00, 0xfc, 0xff, 0xc7, 0x42, 0x51, 0xb5, 0xcd, 0x42, 0x2b, 0x40, 0x01, 0x00,
+        0xd7, 0xb6, 0xcd, 0x42, 0x76, 0xfe, 0xd1, 0x42, 0x3b, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x42,
+        0x76, 0xfe, 0xd1, 0x42, 0x3e, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x42, 0x76, 0xfe, 0xd1, 0x42,
+        0x42, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x42, 0x76, 0xfe, 0xd1, 0x42, 0x4a, 0x40, 0x00, 0x00,
+        0xd7, 0xb6, 0xcd, 0x42, 0x2d, 0x6c, 0xd3, 0x42, 0x23, 0x40, 0x01, 0x00, 0xd7, 0xb6, 0xcd, 0x42,
+        0x2d, 0x6c, 0xd3, 0x42, 0x2f, 0x40, 0x01, 0x00, 0xfc, 0xff, 0xd1, 0x42, 0x51, 0xb5, 0xd2, 0x42,
+        0x47, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xd2, 0x42, 0x2d, 0x6c, 0xd3, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0xb3, 0x6d, 0xd3, 0x42, 0x9a, 0x47, 0xd6, 0x42, 0x38, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xd3, 0x42,
+        0x9a, 0x47, 0xd6, 0x42, 0x3b, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xd3, 0x42, 0x9a, 0x47, 0xd6, 0x42,
+        0x40, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xd3, 0x42, 0x08, 0x23, 0xd9, 0x42, 0x28, 0x40, 0x01, 0x00,
+        0xb3, 0x6d, 0xd3, 0x42, 0x08, 0x23, 0xd9, 0x42, 0x34, 0x40, 0x01, 0x00, 0x20, 0x49, 0xd6, 0x42,
+        0x51, 0xb5, 0xd7, 0x42, 0x40, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xd7, 0x42, 0x08, 0x23, 0xd9, 0x42,
+        0x3e, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xd7, 0x42, 0x08, 0x23, 0xd9, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0x8e, 0x24, 0xd9, 0x42, 0x76, 0xfe, 0xdb, 0x42, 0x34, 0x40, 0x00, 0x00, 0x8e, 0x24, 0xd9, 0x42,
+        0x76, 0xfe, 0xdb, 0x42, 0x39, 0x40, 0x00, 0x00, 0x8e, 0x24, 0xd9, 0x42, 0x76, 0xfe, 0xdb, 0x42,
+        0x3d, 0x40, 0x00, 0x00, 0x8e, 0x24, 0xd9, 0x42, 0x76, 0xfe, 0xdb, 0x42, 0x49, 0x40, 0x00, 0x00,
+        0x8e, 0x24, 0xd9, 0x42, 0xe3, 0xd9, 0xde, 0x42, 0x21, 0x40, 0x01, 0x00, 0x8e, 0x24, 0xd9, 0x42,
+        0xe3, 0xd9, 0xde, 0x42, 0x2d, 0x40, 0x01, 0x00, 0xfc, 0xff, 0xdb, 0x42, 0x2c, 0x6c, 0xdd, 0x42,
+        0x4a, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xdd, 0x42, 0xe3, 0xd9, 0xde, 0x42, 0x4e, 0x40, 0x00, 0x00,
+        0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42, 0x47, 0x40, 0x00, 0x00, 0x69, 0xdb, 0xde, 0x42,
+        0xbf, 0x90, 0xe4, 0x42, 0x1f, 0x40, 0x01, 0x00, 0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42,
+        0x32, 0x40, 0x01, 0x00, 0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42, 0x37, 0x40, 0x01, 0x00,
+        0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xd3, 0x1a, 0x1a, 0x3f, 0x3c, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc9, 0x99, 0x3f,
+        0x34, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc9, 0x99, 0x3f, 0x30, 0x40, 0x01, 0x00,
+        0x08, 0xaf, 0x21, 0x3f, 0xee, 0xe4, 0x9d, 0x3f, 0x3c, 0x53, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x3f,
+        0x71, 0xbc, 0xee, 0x3f, 0x43, 0x5a, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x3f, 0x82, 0xbc, 0x1d, 0x40,
+        0x3c, 0x4d, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x3f, 0x82, 0xbc, 0x1d, 0x40, 0x30, 0x47, 0x01, 0x00,
+        0x8c, 0x86, 0xf2, 0x3f, 0xfb, 0xc9, 0x1f, 0x40, 0x43, 0x57, 0x01, 0x00, 0x08, 0xaf, 0x21, 0x40,
+        0xbd, 0x35, 0x48, 0x40, 0x45, 0x56, 0x01, 0x00, 0x08, 0xaf, 0x21, 0x40, 0x06, 0x94, 0x6e, 0x40,
+        0x3c, 0x49, 0x01, 0x00, 0x08, 0xaf, 0x21, 0x40, 0x06, 0x94, 0x6e, 0x40, 0x29, 0x42, 0x01, 0x00,
+        0xca, 0x1a, 0x4a, 0x40, 0x7f, 0xa1, 0x70, 0x40, 0x45, 0x53, 0x01, 0x00, 0x8c, 0x86, 0x72, 0x40,
+        0xc5, 0xb5, 0x9f, 0x40, 0x43, 0x51, 0x01, 0x00, 0x8c, 0x86, 0x72, 0x40, 0xc5, 0xb5, 0x9f, 0x40,
+        0x3c, 0x4b, 0x01, 0x00, 0x8c, 0x86, 0x72, 0x40, 0xc5, 0xb5, 0x9f, 0x40, 0x30, 0x47, 0x01, 0x00,
+        0x08, 0xaf, 0xa1, 0x40, 0x62, 0xf2, 0xb4, 0x40, 0x41, 0x50, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x40,
+        0x87, 0x21, 0xc8, 0x40, 0x39, 0x46, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x40, 0x87, 0x21, 0xc8, 0x40,
+        0x29, 0x44, 0x01, 0x00, 0xe9, 0xe4, 0xb5, 0x40, 0x43, 0x28, 0xc9, 0x40, 0x41, 0x55, 0x01, 0x00,
+        0xca, 0x1a, 0xca, 0x40, 0x24, 0x5e, 0xdd, 0x40, 0x40, 0x52, 0x01, 0x00, 0xca, 0x1a, 0xca, 0x40,
+        0x49, 0x8d, 0xf0, 0x40, 0x37, 0x45, 0x01, 0x00, 0xca, 0x1a, 0xca, 0x40, 0x49, 0x8d, 0xf0, 0x40,
+        0x30, 0x4c, 0x01, 0x00, 0xab, 0x50, 0xde, 0x40, 0x05, 0x94, 0xf1, 0x40, 0x40, 0x54, 0x01, 0x00,
+        0x8c, 0x86, 0xf2, 0x40, 0xf3, 0xe4, 0x02, 0x41, 0x3e, 0x51, 0x01, 0x00, 0x8c, 0x86, 0xf2, 0x40,
+        0x85, 0x7c, 0x0c, 0x41, 0x37, 0x47, 0x01, 0x00, 0x8c, 0x86, 0xf2, 0x40, 0x85, 0x7c, 0x0c, 0x41,
+        0x2b, 0x45, 0x01, 0x00, 0x36, 0x5e, 0x03, 0x41, 0xe4, 0xff, 0x0c, 0x41, 0x3e, 0x53, 0x01, 0x00,
+        0x27, 0x79, 0x0d, 0x41, 0x66, 0xb2, 0x20, 0x41, 0x3c, 0x51, 0x01, 0x00, 0x27, 0x79, 0x0d, 0x41,
+        0x66, 0xb2, 0x20, 0x41, 0x34, 0x47, 0x01, 0x00, 0x27, 0x79, 0x0d, 0x41, 0x66, 0xb2, 0x20, 0x41,
+        0x30, 0x4b, 0x01, 0x00, 0x08, 0xaf, 0x21, 0x41, 0xb5, 0x50, 0x2b, 0x41, 0x43, 0x5e, 0x01, 0x00,
+        0x08, 0xaf, 0x21, 0x41, 0x47, 0xe8, 0x34, 0x41, 0x3c, 0x50, 0x01, 0x00, 0x08, 0xaf, 0x21, 0x41,
+        0x47, 0xe8, 0x34, 0x41, 0x30, 0x48, 0x01, 0x00, 0xf8, 0xc9, 0x2b, 0x41, 0xa5, 0x6b, 0x35, 0x41,
+        0x43, 0x53, 0x01, 0x00, 0xe9, 0xe4, 0x35, 0x41, 0x96, 0x86, 0x3f, 0x41, 0x41, 0x51, 0x01, 0x00,
+        0xe9, 0xe4, 0x35, 0x41, 0x28, 0x1e, 0x49, 0x41, 0x39, 0x47, 0x01, 0x00, 0xe9, 0xe4, 0x35, 0x41,
+        0x28, 0x1e, 0x49, 0x41, 0x29, 0x44, 0x01, 0x00, 0xd9, 0xff, 0x3f, 0x41, 0x86, 0xa1, 0x49, 0x41,
+        0x41, 0x54, 0x01, 0x00, 0xca, 0x1a, 0x4a, 0x41, 0x77, 0xbc, 0x53, 0x41, 0x40, 0x52, 0x01, 0x00,
+        0xca, 0x1a, 0x4a, 0x41, 0x09, 0x54, 0x5d, 0x41, 0x37, 0x46, 0x01, 0x00, 0xca, 0x1a, 0x4a, 0x41,
+        0x09, 0x54, 0x5d, 0x41, 0x2b, 0x49, 0x01, 0x00, 0xba, 0x35, 0x54, 0x41, 0x67, 0xd7, 0x5d, 0x41,
+        0x40, 0x54, 0x01, 0x00, 0xab, 0x50, 0x5e, 0x41, 0xea, 0x89, 0x71, 0x41, 0x3e, 0x52, 0x01, 0x00,
+        0xab, 0x50, 0x5e, 0x41, 0xea, 0x89, 0x71, 0x41, 0x37, 0x43, 0x01, 0x00, 0xab, 0x50, 0x5e, 0x41,
+        0xea, 0x89, 0x71, 0x41, 0x2b, 0x48, 0x01, 0x00, 0x8c, 0x86, 0x72, 0x41, 0x39, 0x28, 0x7c, 0x41,
+        0x43, 0x5a, 0x01, 0x00, 0x8c, 0x86, 0x72, 0x41, 0xe6, 0xdf, 0x82, 0x41, 0x3c, 0x4c, 0x01, 0x00,
+        0x8c, 0x86, 0x72, 0x41, 0xe6, 0xdf, 0x82, 0x41, 0x30, 0x49, 0x01, 0x00, 0x7c, 0xa1, 0x7c, 0x41,
+        0x95, 0x21, 0x83, 0x41, 0x43, 0x54, 0x01, 0x00, 0x36, 0x5e, 0x83, 0x41, 0x0d, 0x2f, 0x88, 0x41,
+        0x41, 0x54, 0x01, 0x00, 0x36, 0x5e, 0x83, 0x41, 0xd6, 0xfa, 0x8c, 0x41, 0x39, 0x47, 0x01, 0x00,
+        0x36, 0x5e, 0x83, 0x41, 0xd6, 0xfa, 0x8c, 0x41, 0x29, 0x44, 0x01, 0x00, 0xaf, 0x6b, 0x88, 0x41,
+        0x85, 0x3c, 0x8d, 0x41, 0x41, 0x55, 0x01, 0x00, 0x27, 0x79, 0x8d, 0x41, 0xfd, 0x49, 0x92, 0x41,
+        0x40, 0x52, 0x01, 0x00, 0x27, 0x79, 0x8d, 0x41, 0xc7, 0x15, 0x97, 0x41, 0x37, 0x46, 0x01, 0x00,
+        0x27, 0x79, 0x8d, 0x41, 0xc7, 0x15, 0x97, 0x41, 0x2b, 0x49, 0x01, 0x00, 0x9f, 0x86, 0x92, 0x41,
+        0x76, 0x57, 0x97, 0x41, 0x40, 0x52, 0x01, 0x00, 0x17, 0x94, 0x97, 0x41, 0xb7, 0x30, 0xa1, 0x41,
+        0x3e, 0x53, 0x01, 0x00, 0x17, 0x94, 0x97, 0x41, 0xb7, 0x30, 0xa1, 0x41, 0x37, 0x46, 0x01, 0x00,
+        0x17, 0x94, 0x97, 0x41, 0xb7, 0x30, 0xa1, 0x41, 0x2b, 0x45, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x41,
+        0xde, 0x7f, 0xa6, 0x41, 0x3c, 0x52, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x41, 0xa7, 0x4b, 0xab, 0x41,
+        0x34, 0x45, 0x01, 0x00, 0x08, 0xaf, 0xa1, 0x41, 0xa7, 0x4b, 0xab, 0x41, 0x30, 0x49, 0x01, 0x00,
+        0x80, 0xbc, 0xa6, 0x41, 0x57, 0x8d, 0xab, 0x41, 0x3c, 0x53, 0x01, 0x00, 0xf8, 0xc9, 0xab, 0x41,
+        0xcf, 0x9a, 0xb0, 0x41, 0x43, 0x5a, 0x01, 0x00, 0xf8, 0xc9, 0xab, 0x41, 0x98, 0x66, 0xb5, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0xf8, 0xc9, 0xab, 0x41, 0x98, 0x66, 0xb5, 0x41, 0x30, 0x48, 0x01, 0x00,
+        0x70, 0xd7, 0xb0, 0x41, 0x47, 0xa8, 0xb5, 0x41, 0x43, 0x53, 0x01, 0x00, 0xe9, 0xe4, 0xb5, 0x41,
+        0xbf, 0xb5, 0xba, 0x41, 0x45, 0x57, 0x01, 0x00, 0xe9, 0xe4, 0xb5, 0x41, 0x88, 0x81, 0xbf, 0x41,
+        0x3c, 0x45, 0x01, 0x00, 0xe9, 0xe4, 0xb5, 0x41, 0x88, 0x81, 0xbf, 0x41, 0x29, 0x44, 0x01, 0x00,
+        0x61, 0xf2, 0xba, 0x41, 0x38, 0xc3, 0xbf, 0x41, 0x45, 0x51, 0x01, 0x00, 0xd9, 0xff, 0xbf, 0x41,
+        0x79, 0x9c, 0xc9, 0x41, 0x43, 0x4f, 0x01, 0x00, 0xd9, 0xff, 0xbf, 0x41, 0x79, 0x9c, 0xc9, 0x41,
+        0x3c, 0x48, 0x01, 0x00, 0xd9, 0xff, 0xbf, 0x41, 0x79, 0x9c, 0xc9, 0x41, 0x30, 0x49, 0x01, 0x00,
+        0xca, 0x1a, 0xca, 0x41, 0xa0, 0xeb, 0xce, 0x41, 0x41, 0x51, 0x01, 0x00, 0xca, 0x1a, 0xca, 0x41,
+        0x69, 0xb7, 0xd3, 0x41, 0x39, 0x45, 0x01, 0x00, 0xca, 0x1a, 0xca, 0x41, 0x69, 0xb7, 0xd3, 0x41,
+        0x29, 0x44, 0x01, 0x00, 0x42, 0x28, 0xcf, 0x41, 0x19, 0xf9, 0xd3, 0x41, 0x41, 0x53, 0x01, 0x00,
+        0xba, 0x35, 0xd4, 0x41, 0x91, 0x06, 0xd9, 0x41, 0x40, 0x51, 0x01, 0x00, 0xba, 0x35, 0xd4, 0x41,
+        0x5a, 0xd2, 0xdd, 0x41, 0x37, 0x46, 0x01, 0x00, 0xba, 0x35, 0xd4, 0x41, 0x5a, 0xd2, 0xdd, 0x41,
+        0x30, 0x4b, 0x01, 0x00, 0x32, 0x43, 0xd9, 0x41, 0x09, 0x14, 0xde, 0x41, 0x40, 0x54, 0x01, 0x00,
+        0xab, 0x50, 0xde, 0x41, 0x81, 0x21, 0xe3, 0x41, 0x3e, 0x52, 0x01, 0x00, 0xab, 0x50, 0xde, 0x41,
+        0x4a, 0xed, 0xe7, 0x41, 0x37, 0x47, 0x01, 0x00, 0xab, 0x50, 0xde, 0x41, 0x4a, 0xed, 0xe7, 0x41,
+        0x2b, 0x45, 0x01, 0x00, 0x23, 0x5e, 0xe3, 0x41, 0xfa, 0x2e, 0xe8, 0x41, 0x3e, 0x53, 0x01, 0x00,
+        0x9b, 0x6b, 0xe8, 0x41, 0x3b, 0x08, 0xf2, 0x41, 0x3c, 0x50, 0x01, 0x00, 0x9b, 0x6b, 0xe8, 0x41,
+        0x3b, 0x08, 0xf2, 0x41, 0x34, 0x46, 0x01, 0x00, 0x9b, 0x6b, 0xe8, 0x41, 0x3b, 0x08, 0xf2, 0x41,
+        0x30, 0x4a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3e, 0x3e, 0x45, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x3e, 0x00, 0x00, 0x40, 0x3f, 0x40, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x3f,
+        0x00, 0x00, 0x90, 0x3f, 0x42, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x90, 0x3f, 0x00, 0x00, 0xc0, 0x3f,
+        0x43, 0x51, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0xf0, 0x3f, 0x45, 0x56, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x10, 0x40, 0x46, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x10, 0x40,
+        0x00, 0x00, 0x1c, 0x40, 0x47, 0x52, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x40, 0x00, 0x00, 0x28, 0x40,
+        0x47, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x40, 0x40, 0x47, 0x4b, 0x01, 0x00,
+        0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x58, 0x40, 0x43, 0x46, 0x01, 0x00, 0x00, 0x00, 0x58, 0x40,
+        0x00, 0x00, 0x90, 0x40, 0x4c, 0x56, 0x01, 0x00, 0x00, 0x00, 0x58, 0x40, 0x00, 0x00, 0x70, 0x40,
+        0x30, 0x44, 0x01, 0x00, 0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x84, 0x40, 0x34, 0x51, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x84, 0x40, 0x37, 0x51, 0x01, 0x00, 0x00, 0x00, 0x84, 0x40,
+        0x00, 0x00, 0x90, 0x40, 0x34, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x84, 0x40, 0x00, 0x00, 0x90, 0x40,
+        0x37, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x90, 0x40, 0x00, 0x00, 0xb4, 0x40, 0x4b, 0x48, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x40, 0x00, 0x00, 0x9c, 0x40, 0x2b, 0x3d, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x40,
+        0x00, 0x00, 0xa8, 0x40, 0x34, 0x55, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x40, 0x00, 0x00, 0xa8, 0x40,
+        0x37, 0x55, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x40, 0x00, 0x00, 0xb4, 0x40, 0x34, 0x4c, 0x01, 0x00,
+        0x00, 0x00, 0xa8, 0x40, 0x00, 0x00, 0xb4, 0x40, 0x37, 0x4c, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x40,
+        0x00, 0x00, 0xd8, 0x40, 0x4c, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x40, 0x00, 0x00, 0xc0, 0x40,
+        0x30, 0x4a, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xcc, 0x40, 0x34, 0x51, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xcc, 0x40, 0x37, 0x51, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x40,
+        0x00, 0x00, 0xd8, 0x40, 0x34, 0x4b, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x40, 0x00, 0x00, 0xd8, 0x40,
+        0x37, 0x4b, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x40, 0x00, 0x00, 0xe4, 0x40, 0x2b, 0x47, 0x01, 0x00,
+        0x00, 0x00, 0xde, 0x40, 0x00, 0x00, 0xe4, 0x40, 0x43, 0x41, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x40,
+        0x00, 0x00, 0xea, 0x40, 0x45, 0x52, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x40, 0x00, 0x00, 0xf0, 0x40,
+        0x34, 0x54, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x40, 0x00, 0x00, 0xf0, 0x40, 0x37, 0x54, 0x01, 0x00,
+        0x00, 0x00, 0xea, 0x40, 0x00, 0x00, 0xf0, 0x40, 0x47, 0x51, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x40,
+        0x00, 0x00, 0xf6, 0x40, 0x48, 0x52, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x00, 0x00, 0xfc, 0x40,
+        0x34, 0x4e, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x00, 0x00, 0xfc, 0x40, 0x37, 0x4e, 0x01, 0x00,
+        0x00, 0x00, 0xf6, 0x40, 0x00, 0x00, 0xfc, 0x40, 0x4a, 0x52, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x40,
+        0x00, 0x00, 0x10, 0x41, 0x4c, 0x4f, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x40, 0x00, 0x00, 0x04, 0x41,
+        0x30, 0x46, 0x01, 0x00, 0x00, 0x00, 0x04, 0x41, 0x00, 0x00, 0x0a, 0x41, 0x34, 0x53, 0x01, 0x00,
+        0x00, 0x00, 0x04, 0x41, 0x00, 0x00, 0x0a, 0x41, 0x37, 0x53, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x41,
+        0x00, 0x00, 0x10, 0x41, 0x34, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x41, 0x00, 0x00, 0x10, 0x41,
+        0x37, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x1f, 0x41, 0x4b, 0x4b, 0x01, 0x00,
+        0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x16, 0x41, 0x2b, 0x48, 0x01, 0x00, 0x00, 0x00, 0x16, 0x41,
+        0x00, 0x00, 0x1c, 0x41, 0x34, 0x55, 0x01, 0x00, 0x00, 0x00, 0x16, 0x41, 0x00, 0x00, 0x1c, 0x41,
+        0x37, 0x55, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x41, 0x00, 0x00, 0x22, 0x41, 0x34, 0x4d, 0x01, 0x00,
+        0x00, 0x00, 0x1c, 0x41, 0x00, 0x00, 0x22, 0x41, 0x37, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x41,
+        0x00, 0x00, 0x22, 0x41, 0x4d, 0x55, 0x01, 0x00, 0x00, 0x00, 0x22, 0x41, 0x00, 0x00, 0x34, 0x41,
+        0x4c, 0x4a, 0x01, 0x00, 0x00, 0x00, 0x22, 0x41, 0x00, 0x00, 0x28, 0x41, 0x30, 0x49, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x41, 0x00, 0x00, 0x2e, 0x41, 0x34, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x28, 0x41,
+        0x00, 0x00, 0x2e, 0x41, 0x37, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x41, 0x00, 0x00, 0x34, 0x41,
+        0x34, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x41, 0x00, 0x00, 0x34, 0x41, 0x37, 0x4c, 0x01, 0x00,
+        0x00, 0x00, 0x34, 0x41, 0x00, 0x00, 0x3a, 0x41, 0x2b, 0x40, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x41,
+        0x00, 0x00, 0x40, 0x41, 0x34, 0x51, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x41, 0x00, 0x00, 0x40, 0x41,
+        0x37, 0x51, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x46, 0x41, 0x34, 0x48, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x46, 0x41, 0x37, 0x48, 0x01, 0x00, 0x00, 0x00, 0x43, 0x41,
+        0x00, 0x00, 0x46, 0x41, 0x43, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x46, 0x41, 0x00, 0x00, 0x58, 0x41,
+        0x4a, 0x5c, 0x01, 0x00, 0x00, 0x00, 0x46, 0x41, 0x00, 0x00, 0x4c, 0x41, 0x2f, 0x46, 0x01, 0x00,
+        0x00, 0x00, 0x4c, 0x41, 0x00, 0x00, 0x52, 0x41, 0x35, 0x54, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x41,
+        0x00, 0x00, 0x52, 0x41, 0x37, 0x54, 0x01, 0x00, 0x00, 0x00, 0x52, 0x41, 0x00, 0x00, 0x58, 0x41,
+        0x35, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x52, 0x41, 0x00, 0x00, 0x58, 0x41, 0x37, 0x4f, 0x01, 0x00,
+        0x00, 0x00, 0x58, 0x41, 0x00, 0x00, 0x6a, 0x41, 0x49, 0x47, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41,
+        0x00, 0x00, 0x5e, 0x41, 0x2b, 0x43, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x41, 0x00, 0x00, 0x64, 0x41,
+        0x35, 0x54, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x41, 0x00, 0x00, 0x64, 0x41, 0x37, 0x54, 0x01, 0x00,
+        0x00, 0x00, 0x64, 0x41, 0x00, 0x00, 0x6a, 0x41, 0x35, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x64, 0x41,
+        0x00, 0x00, 0x6a, 0x41, 0x37, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x41, 0x00, 0x00, 0x7c, 0x41,
+        0x4a, 0x51, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x41, 0x00, 0x00, 0x70, 0x41, 0x2f, 0x44, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x76, 0x41, 0x35, 0x51, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41,
+        0x00, 0x00, 0x76, 0x41, 0x37, 0x51, 0x01, 0x00, 0x00, 0x00, 0x76, 0x41, 0x00, 0x00, 0x7c, 0x41,
+        0x35, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x76, 0x41, 0x00, 0x00, 0x7c, 0x41, 0x37, 0x4c, 0x01, 0x00,
+        0x00, 0x00, 0x7c, 0x41, 0x00, 0x00, 0x81, 0x41, 0x2b, 0x43, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x41,
+        0x00, 0x00, 0x81, 0x41, 0x43, 0x45, 0x01, 0x00, 0x00, 0x00, 0x81, 0x41, 0x00, 0x80, 0x82, 0x41,
+        0x45, 0x51, 0x01, 0x00, 0x00, 0x00, 0x81, 0x41, 0x00, 0x00, 0x84, 0x41, 0x35, 0x52, 0x01, 0x00,
+        0x00, 0x00, 0x81, 0x41, 0x00, 0x00, 0x84, 0x41, 0x37, 0x52, 0x01, 0x00, 0x00, 0x80, 0x82, 0x41,
+        0x00, 0x00, 0x84, 0x41, 0x47, 0x54, 0x01, 0x00, 0x00, 0x00, 0x84, 0x41, 0x00, 0x80, 0x85, 0x41,
+        0x48, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x41, 0x00, 0x00, 0x87, 0x41, 0x35, 0x4e, 0x01, 0x00,
+        0x00, 0x00, 0x84, 0x41, 0x00, 0x00, 0x87, 0x41, 0x37, 0x4e, 0x01, 0x00, 0x00, 0x80, 0x85, 0x41,
+        0x00, 0x00, 0x87, 0x41, 0x49, 0x51, 0x01, 0x00, 0x00, 0x00, 0x87, 0x41, 0x00, 0x00, 0x90, 0x41,
+        0x4a, 0x53, 0x01, 0x00, 0x00, 0x00, 0x87, 0x41, 0x00, 0x00, 0x8a, 0x41, 0x2f, 0x45, 0x01, 0x00,
+        0x00, 0x00, 0x8a, 0x41, 0x00, 0x00, 0x8d, 0x41, 0x35, 0x55, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x41,
+        0x00, 0x00, 0x8d, 0x41, 0x37, 0x55, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x41, 0x00, 0x00, 0x90, 0x41,
+        0x35, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x41, 0x00, 0x00, 0x90, 0x41, 0x37, 0x4f, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x41, 0x00, 0x80, 0x97, 0x41, 0x43, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41,
+        0x00, 0x00, 0x93, 0x41, 0x2b, 0x43, 0x01, 0x00, 0x00, 0x00, 0x93, 0x41, 0x00, 0x00, 0x96, 0x41,
+        0x35, 0x54, 0x01, 0x00, 0x00, 0x00, 0x93, 0x41, 0x00, 0x00, 0x96, 0x41, 0x37, 0x54, 0x01, 0x00,
+        0x00, 0x00, 0x96, 0x41, 0x00, 0x00, 0x99, 0x41, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x96, 0x41,
+        0x00, 0x00, 0x99, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x97, 0x41, 0x00, 0x00, 0x99, 0x41,
+        0x4d, 0x5e, 0x01, 0x00, 0x00, 0x00, 0x99, 0x41, 0x00, 0x00, 0xa2, 0x41, 0x4c, 0x4a, 0x01, 0x00,
+        0x00, 0x00, 0x99, 0x41, 0x00, 0x00, 0x9c, 0x41, 0x30, 0x46, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x41,
+        0x00, 0x00, 0x9f, 0x41, 0x34, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x41, 0x00, 0x00, 0x9f, 0x41,
+        0x37, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x9f, 0x41, 0x00, 0x00, 0xa2, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x9f, 0x41, 0x00, 0x00, 0xa2, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa2, 0x41,
+        0x00, 0x00, 0xa5, 0x41, 0x2b, 0x45, 0x01, 0x00, 0x00, 0x00, 0xa5, 0x41, 0x00, 0x00, 0xa8, 0x41,
+        0x34, 0x52, 0x01, 0x00, 0x00, 0x00, 0xa5, 0x41, 0x00, 0x00, 0xa8, 0x41, 0x37, 0x52, 0x01, 0x00,
+        0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0xab, 0x41, 0x34, 0x4c, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41,
+        0x00, 0x00, 0xab, 0x41, 0x37, 0x4c, 0x01, 0x00, 0x00, 0x80, 0xa9, 0x41, 0x00, 0x00, 0xab, 0x41,
+        0x43, 0x41, 0x01, 0x00, 0x00, 0x00, 0xab, 0x41, 0x00, 0x00, 0xb4, 0x41, 0x4f, 0x60, 0x01, 0x00,
+        0x00, 0x00, 0xab, 0x41, 0x00, 0x00, 0xae, 0x41, 0x30, 0x47, 0x01, 0x00, 0x00, 0x00, 0xae, 0x41,
+        0x00, 0x00, 0xb1, 0x41, 0x34, 0x52, 0x01, 0x00, 0x00, 0x00, 0xae, 0x41, 0x00, 0x00, 0xb1, 0x41,
+        0x37, 0x52, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x41, 0x00, 0x00, 0xb4, 0x41, 0x34, 0x4d, 0x01, 0x00,
+        0x00, 0x00, 0xb1, 0x41, 0x00, 0x00, 0xb4, 0x41, 0x37, 0x4d, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x41,
+        0x00, 0x00, 0xbd, 0x41, 0x4f, 0x52, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x41, 0x00, 0x00, 0xb7, 0x41,
+        0x2f, 0x3f, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x41, 0x00, 0x00, 0xba, 0x41, 0x34, 0x56, 0x01, 0x00,
+        0x00, 0x00, 0xb7, 0x41, 0x00, 0x00, 0xba, 0x41, 0x37, 0x56, 0x01, 0x00, 0x00, 0x00, 0xba, 0x41,
+        0x00, 0x00, 0xbd, 0x41, 0x34, 0x4c, 0x01, 0x00, 0x00, 0x00, 0xba, 0x41, 0x00, 0x00, 0xbd, 0x41,
+        0x37, 0x4c, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x41, 0x00, 0x80, 0xc4, 0x41, 0x4f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xbd, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x2e, 0x41, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41,
+        0x00, 0x00, 0xc3, 0x41, 0x34, 0x53, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xc3, 0x41,
+        0x37, 0x53, 0x01, 0x00, 0x00, 0x00, 0xc3, 0x41, 0x00, 0x00, 0xc6, 0x41, 0x34, 0x4c, 0x01, 0x00,
+        0x00, 0x00, 0xc3, 0x41, 0x00, 0x00, 0xc6, 0x41, 0x37, 0x4c, 0x01, 0x00, 0x00, 0x80, 0xc4, 0x41,
+        0x00, 0x00, 0xc6, 0x41, 0x4f, 0x4c, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x41, 0x00, 0x00, 0xcc, 0x41,
+        0x51, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x41, 0x00, 0x00, 0xc9, 0x41, 0x2d, 0x43, 0x01, 0x00,
+        0x00, 0x00, 0xc9, 0x41, 0x00, 0x00, 0xcc, 0x41, 0x31, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc9, 0x41,
+        0x00, 0x00, 0xcc, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x00, 0x00, 0xcf, 0x41,
+        0x4f, 0x4a, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x00, 0x00, 0xcf, 0x41, 0x31, 0x46, 0x01, 0x00,
+        0x00, 0x00, 0xcc, 0x41, 0x00, 0x00, 0xcf, 0x41, 0x34, 0x46, 0x01, 0x00, 0x00, 0x00, 0xcf, 0x41,
+        0x00, 0x00, 0xd8, 0x41, 0x4d, 0x44, 0x01, 0x00, 0x00, 0x00, 0xcf, 0x41, 0x00, 0x00, 0xd2, 0x41,
+        0x32, 0x4f, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x41, 0x00, 0x00, 0xd5, 0x41, 0x35, 0x5a, 0x01, 0x00,
+        0x00, 0x00, 0xd2, 0x41, 0x00, 0x00, 0xd5, 0x41, 0x39, 0x5a, 0x01, 0x00, 0x00, 0x00, 0xd5, 0x41,
+        0x00, 0x00, 0xd8, 0x41, 0x35, 0x4d, 0x01, 0x00, 0x00, 0x00, 0xd5, 0x41, 0x00, 0x00, 0xd8, 0x41,
+        0x39, 0x4d, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0xe1, 0x41, 0x4d, 0x4a, 0x01, 0x00,
+        0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0xdb, 0x41, 0x31, 0x43, 0x01, 0x00, 0x00, 0x00, 0xdb, 0x41,
+        0x00, 0x00, 0xde, 0x41, 0x35, 0x53, 0x01, 0x00, 0x00, 0x00, 0xdb, 0x41, 0x00, 0x00, 0xde, 0x41,
+        0x39, 0x53, 0x01, 0x00, 0x00, 0x00, 0xde, 0x41, 0x00, 0x00, 0xe1, 0x41, 0x35, 0x4a, 0x01, 0x00,
+        0x00, 0x00, 0xde, 0x41, 0x00, 0x00, 0xe1, 0x41, 0x39, 0x4a, 0x01, 0x00, 0x00, 0x00, 0xe1, 0x41,
+        0x00, 0x80, 0xe8, 0x41, 0x4d, 0x4b, 0x01, 0x00, 0x00, 0x00, 0xe1, 0x41, 0x00, 0x00, 0xe4, 0x41,
+        0x30, 0x42, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x00, 0x00, 0xe7, 0x41, 0x35, 0x55, 0x01, 0x00,
+        0x00, 0x00, 0xe4, 0x41, 0x00, 0x00, 0xe7, 0x41, 0x39, 0x55, 0x01, 0x00, 0x00, 0x00, 0xe7, 0x41,
+        0x00, 0x00, 0xea, 0x41, 0x35, 0x4c, 0x01, 0x00, 0x00, 0x00, 0xe7, 0x41, 0x00, 0x00, 0xea, 0x41,
+        0x39, 0x4c, 0x01, 0x00, 0x00, 0x80, 0xe8, 0x41, 0x00, 0x00, 0xea, 0x41, 0x4d, 0x4d, 0x01, 0x00,
+        0x00, 0x00, 0xea, 0x41, 0x00, 0x00, 0xf0, 0x41, 0x4f, 0x51, 0x01, 0x00, 0x00, 0x00, 0xea, 0x41,
+        0x00, 0x00, 0xed, 0x41, 0x2f, 0x42, 0x01, 0x00, 0x00, 0x00, 0xed, 0x41, 0x00, 0x00, 0xf0, 0x41,
+        0x35, 0x54, 0x01, 0x00, 0x00, 0x00, 0xed, 0x41, 0x00, 0x00, 0xf0, 0x41, 0x37, 0x54, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0xf3, 0x41, 0x4d, 0x4b, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0x00, 0x00, 0xf3, 0x41, 0x35, 0x49, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0xf3, 0x41,
+        0x37, 0x49, 0x01, 0x00, 0x00, 0x00, 0xf3, 0x41, 0x00, 0x00, 0xfc, 0x41, 0x4c, 0x45, 0x01, 0x00,
+        0x00, 0x00, 0xf3, 0x41, 0x00, 0x00, 0xf6, 0x41, 0x30, 0x43, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x41,
+        0x00, 0x00, 0xf9, 0x41, 0x34, 0x51, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x41, 0x00, 0x00, 0xf9, 0x41,
+        0x37, 0x51, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x41, 0x00, 0x00, 0xfc, 0x41, 0x34, 0x46, 0x01, 0x00,
+        0x00, 0x00, 0xf9, 0x41, 0x00, 0x00, 0xfc, 0x41, 0x37, 0x46, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x41,
+        0x00, 0x00, 0xff, 0x41, 0x45, 0x3f, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x41, 0x00, 0x00, 0xff, 0x41,
+        0x32, 0x48, 0x01, 0x00, 0x00, 0x00, 0xff, 0x41, 0x00, 0x00, 0x01, 0x42, 0x47, 0x52, 0x01, 0x00,
+        0x00, 0x00, 0xff, 0x41, 0x00, 0x00, 0x01, 0x42, 0x35, 0x54, 0x01, 0x00, 0x00, 0x00, 0xff, 0x41,
+        0x00, 0x00, 0x01, 0x42, 0x37, 0x54, 0x01, 0x00, 0x00, 0x00, 0x01, 0x42, 0x00, 0x80, 0x02, 0x42,
+        0x4d, 0x56, 0x01, 0x00, 0x00, 0x00, 0x01, 0x42, 0x00, 0x80, 0x02, 0x42, 0x35, 0x4a, 0x01, 0x00,
+        0x00, 0x00, 0x01, 0x42, 0x00, 0x80, 0x02, 0x42, 0x37, 0x4a, 0x01, 0x00, 0x00, 0x80, 0x02, 0x42,
+        0x00, 0x40, 0x03, 0x42, 0x4c, 0x4c, 0x01, 0x00, 0x00, 0x80, 0x02, 0x42, 0x00, 0x40, 0x03, 0x42,
+        0x2f, 0x44, 0x01, 0x00, 0x00, 0x40, 0x03, 0x42, 0x00, 0x00, 0x04, 0x42, 0x4c, 0x4d, 0x01, 0x00,
+        0x00, 0x40, 0x03, 0x42, 0x00, 0x00, 0x04, 0x42, 0x2f, 0x47, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42,
+        0x00, 0x80, 0x05, 0x42, 0x4c, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42, 0x00, 0x80, 0x05, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x40, 0x06, 0x42, 0x00, 0x00, 0x07, 0x42, 0x47, 0x41, 0x01, 0x00,
+        0x00, 0x00, 0x07, 0x42, 0x00, 0x80, 0x0b, 0x42, 0x48, 0x51, 0x01, 0x00, 0x00, 0x00, 0x07, 0x42,
+        0x00, 0x80, 0x08, 0x42, 0x30, 0x45, 0x01, 0x00, 0x00, 0x80, 0x08, 0x42, 0x00, 0x00, 0x0a, 0x42,
+        0x34, 0x52, 0x01, 0x00, 0x00, 0x80, 0x08, 0x42, 0x00, 0x00, 0x0a, 0x42, 0x37, 0x52, 0x01, 0x00,
+        0x00, 0x00, 0x0a, 0x42, 0x00, 0x80, 0x0b, 0x42, 0x34, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x42,
+        0x00, 0x80, 0x0b, 0x42, 0x37, 0x4e, 0x01, 0x00, 0x00, 0x80, 0x0b, 0x42, 0x00, 0x00, 0x0d, 0x42,
+        0x40, 0x4e, 0x01, 0x00, 0x00, 0x80, 0x0b, 0x42, 0x00, 0x00, 0x0d, 0x42, 0x43, 0x4e, 0x01, 0x00,
+        0x00, 0x80, 0x0b, 0x42, 0x00, 0x00, 0x0d, 0x42, 0x48, 0x4e, 0x01, 0x00, 0x00, 0x80, 0x0b, 0x42,
+        0x00, 0x00, 0x0d, 0x42, 0x30, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x5d, 0x04, 0x3f,
+        0x24, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x5d, 0x04, 0x3f, 0x30, 0x40, 0x01, 0x00,
+        0x01, 0xa3, 0x0b, 0x3f, 0x09, 0x2a, 0x51, 0x3f, 0x3c, 0x40, 0x00, 0x00, 0x01, 0xa3, 0x0b, 0x3f,
+        0x09, 0x2a, 0x51, 0x3f, 0x3f, 0x40, 0x00, 0x00, 0x01, 0xa3, 0x0b, 0x3f, 0x09, 0x2a, 0x51, 0x3f,
+        0x43, 0x40, 0x00, 0x00, 0x01, 0xa3, 0x8b, 0x3f, 0x98, 0xd1, 0xcd, 0x3f, 0x22, 0x40, 0x01, 0x00,
+        0x01, 0xa3, 0x8b, 0x3f, 0x98, 0xd1, 0xcd, 0x3f, 0x2e, 0x40, 0x01, 0x00, 0x82, 0x74, 0xd1, 0x3f,
+        0x05, 0x38, 0xf4, 0x3f, 0x3c, 0x40, 0x00, 0x00, 0x82, 0x74, 0xd1, 0x3f, 0x05, 0x38, 0xf4, 0x3f,
+        0x3f, 0x40, 0x00, 0x00, 0x82, 0x74, 0xd1, 0x3f, 0x05, 0x38, 0xf4, 0x3f, 0x43, 0x40, 0x00, 0x00,
+        0x01, 0xa3, 0x0b, 0x40, 0x4d, 0xba, 0x2c, 0x40, 0x20, 0x40, 0x01, 0x00, 0x01, 0xa3, 0x0b, 0x40,
+        0x4d, 0xba, 0x2c, 0x40, 0x2c, 0x40, 0x01, 0x00, 0xc1, 0x8b, 0x2e, 0x40, 0x83, 0xed, 0x3f, 0x40,
+        0x3c, 0x40, 0x00, 0x00, 0xc1, 0x8b, 0x2e, 0x40, 0x83, 0xed, 0x3f, 0x40, 0x3f, 0x40, 0x00, 0x00,
+        0xc1, 0x8b, 0x2e, 0x40, 0x83, 0xed, 0x3f, 0x40, 0x42, 0x40, 0x00, 0x00, 0x82, 0x74, 0x51, 0x40,
+        0xcd, 0x8b, 0x72, 0x40, 0x1f, 0x40, 0x01, 0x00, 0x82, 0x74, 0x51, 0x40, 0xcd, 0x8b, 0x72, 0x40,
+        0x2b, 0x40, 0x01, 0x00, 0x42, 0x5d, 0x74, 0x40, 0x82, 0xdf, 0x82, 0x40, 0x3b, 0x40, 0x00, 0x00,
+        0x42, 0x5d, 0x74, 0x40, 0x82, 0xdf, 0x82, 0x40, 0x3e, 0x40, 0x00, 0x00, 0x42, 0x5d, 0x74, 0x40,
+        0x82, 0xdf, 0x82, 0x40, 0x43, 0x40, 0x00, 0x00, 0x01, 0xa3, 0x8b, 0x40, 0xa7, 0x2e, 0x9c, 0x40,
+        0x24, 0x40, 0x01, 0x00, 0x01, 0xa3, 0x8b, 0x40, 0xa7, 0x2e, 0x9c, 0x40, 0x30, 0x40, 0x01, 0x00,
+        0x61, 0x17, 0x9d, 0x40, 0x42, 0xc8, 0xa5, 0x40, 0x3c, 0x40, 0x00, 0x00, 0x61, 0x17, 0x9d, 0x40,
+        0x42, 0xc8, 0xa5, 0x40, 0x3f, 0x40, 0x00, 0x00, 0x61, 0x17, 0x9d, 0x40, 0x42, 0xc8, 0xa5, 0x40,
+        0x43, 0x40, 0x00, 0x00, 0xc1, 0x8b, 0xae, 0x40, 0x67, 0x17, 0xbf, 0x40, 0x22, 0x40, 0x01, 0x00,
+        0xc1, 0x8b, 0xae, 0x40, 0x67, 0x17, 0xbf, 0x40, 0x2e, 0x40, 0x01, 0x00, 0x22, 0x00, 0xc0, 0x40,
+        0x02, 0xb1, 0xc8, 0x40, 0x3c, 0x40, 0x00, 0x00, 0x22, 0x00, 0xc0, 0x40, 0x02, 0xb1, 0xc8, 0x40,
+        0x3f, 0x40, 0x00, 0x00, 0x22, 0x00, 0xc0, 0x40, 0x02, 0xb1, 0xc8, 0x40, 0x43, 0x40, 0x00, 0x00,
+        0x82, 0x74, 0xd1, 0x40, 0x27, 0x00, 0xe2, 0x40, 0x20, 0x40, 0x01, 0x00, 0x82, 0x74, 0xd1, 0x40,
+        0x27, 0x00, 0xe2, 0x40, 0x2c, 0x40, 0x01, 0x00, 0xe2, 0xe8, 0xe2, 0x40, 0xc3, 0x99, 0xeb, 0x40,
+        0x3c, 0x40, 0x00, 0x00, 0xe2, 0xe8, 0xe2, 0x40, 0xc3, 0x99, 0xeb, 0x40, 0x3f, 0x40, 0x00, 0x00,
+        0xe2, 0xe8, 0xe2, 0x40, 0xc3, 0x99, 0xeb, 0x40, 0x42, 0x40, 0x00, 0x00, 0x42, 0x5d, 0xf4, 0x40,
+        0x74, 0x74, 0x02, 0x41, 0x1f, 0x40, 0x01, 0x00, 0x42, 0x5d, 0xf4, 0x40, 0x74, 0x74, 0x02, 0x41,
+        0x2b, 0x40, 0x01, 0x00, 0xd1, 0xe8, 0x02, 0x41, 0xd1, 0xe8, 0x03, 0x41, 0x42, 0x40, 0x00, 0x00,
+        0x79, 0xed, 0x03, 0x41, 0x26, 0x6b, 0x09, 0x41, 0x42, 0x40, 0x00, 0x00, 0x75, 0x74, 0x09, 0x41,
+        0x5a, 0x9e, 0x0b, 0x41, 0x3f, 0x40, 0x00, 0x00, 0x01, 0xa3, 0x0b, 0x41, 0xba, 0x12, 0x1d, 0x41,
+        0x41, 0x50, 0x00, 0x00, 0x01, 0xa3, 0x0b, 0x41, 0xd4, 0xe8, 0x13, 0x41, 0x24, 0x50, 0x01, 0x00,
+        0x01, 0xa3, 0x0b, 0x41, 0xd4, 0xe8, 0x13, 0x41, 0x30, 0x50, 0x01, 0x00, 0x61, 0x17, 0x1d, 0x41,
+        0x71, 0x82, 0x29, 0x41, 0x3c, 0x50, 0x00, 0x00, 0x61, 0x17, 0x1d, 0x41, 0x34, 0x5d, 0x25, 0x41,
+        0x22, 0x50, 0x01, 0x00, 0x61, 0x17, 0x1d, 0x41, 0x34, 0x5d, 0x25, 0x41, 0x2e, 0x50, 0x01, 0x00,
+        0xa9, 0x2e, 0x2a, 0x41, 0x1a, 0x87, 0x2e, 0x41, 0x3c, 0x50, 0x00, 0x00, 0xc1, 0x8b, 0x2e, 0x41,
+        0xbe, 0x12, 0x35, 0x41, 0x3f, 0x50, 0x00, 0x00, 0xc1, 0x8b, 0x2e, 0x41, 0x94, 0xd1, 0x36, 0x41,
+        0x20, 0x50, 0x01, 0x00, 0xc1, 0x8b, 0x2e, 0x41, 0x94, 0xd1, 0x36, 0x41, 0x2c, 0x50, 0x01, 0x00,
+        0x65, 0x17, 0x35, 0x41, 0x4a, 0x41, 0x37, 0x41, 0x3f, 0x50, 0x00, 0x00, 0xf1, 0x45, 0x37, 0x41,
+        0x7a, 0xfb, 0x3f, 0x41, 0x41, 0x50, 0x00, 0x00, 0x22, 0x00, 0x40, 0x41, 0xaa, 0xb5, 0x48, 0x41,
+        0x41, 0x50, 0x00, 0x00, 0x22, 0x00, 0x40, 0x41, 0xf4, 0x45, 0x48, 0x41, 0x1f, 0x50, 0x01, 0x00,
+        0x22, 0x00, 0x40, 0x41, 0xf4, 0x45, 0x48, 0x41, 0x2b, 0x50, 0x01, 0x00, 0x52, 0xba, 0x48, 0x41,
+        0x25, 0x00, 0x51, 0x41, 0x3f, 0x50, 0x00, 0x00, 0x82, 0x74, 0x51, 0x41, 0x55, 0xba, 0x59, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x82, 0x74, 0x51, 0x41, 0x55, 0xba, 0x59, 0x41, 0x24, 0x50, 0x01, 0x00,
+        0x82, 0x74, 0x51, 0x41, 0x55, 0xba, 0x59, 0x41, 0x30, 0x50, 0x01, 0x00, 0xb2, 0x2e, 0x5a, 0x41,
+        0x85, 0x74, 0x62, 0x41, 0x43, 0x50, 0x00, 0x00, 0xe2, 0xe8, 0x62, 0x41, 0xb5, 0x2e, 0x6b, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0xe2, 0xe8, 0x62, 0x41, 0xb5, 0x2e, 0x6b, 0x41, 0x22, 0x50, 0x01, 0x00,
+        0xe2, 0xe8, 0x62, 0x41, 0xb5, 0x2e, 0x6b, 0x41, 0x2e, 0x50, 0x01, 0x00, 0x12, 0xa3, 0x6b, 0x41,
+        0xe5, 0xe8, 0x73, 0x41, 0x48, 0x50, 0x00, 0x00, 0x42, 0x5d, 0x74, 0x41, 0x15, 0xa3, 0x7c, 0x41,
+        0x4b, 0x50, 0x00, 0x00, 0x42, 0x5d, 0x74, 0x41, 0x15, 0xa3, 0x7c, 0x41, 0x20, 0x50, 0x01, 0x00,
+        0x42, 0x5d, 0x74, 0x41, 0x15, 0xa3, 0x7c, 0x41, 0x2c, 0x50, 0x01, 0x00, 0x72, 0x17, 0x7d, 0x41,
+        0xa2, 0xae, 0x82, 0x41, 0x4b, 0x50, 0x00, 0x00, 0xd1, 0xe8, 0x82, 0x41, 0xbb, 0x0b, 0x87, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0xd1, 0xe8, 0x82, 0x41, 0xbb, 0x0b, 0x87, 0x41, 0x1f, 0x50, 0x01, 0x00,
+        0xd1, 0xe8, 0x82, 0x41, 0xbb, 0x0b, 0x87, 0x41, 0x2b, 0x50, 0x01, 0x00, 0xe9, 0x45, 0x87, 0x41,
+        0xe9, 0xc5, 0x87, 0x41, 0x42, 0x50, 0x00, 0x00, 0x3d, 0xc8, 0x87, 0x41, 0x14, 0x87, 0x8a, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0xbb, 0x8b, 0x8a, 0x41, 0xad, 0xa0, 0x8b, 0x41, 0x3f, 0x50, 0x00, 0x00,
+        0x01, 0xa3, 0x8b, 0x41, 0xdd, 0x5a, 0x94, 0x41, 0x41, 0x50, 0x00, 0x00, 0x01, 0xa3, 0x8b, 0x41,
+        0xeb, 0xc5, 0x8f, 0x41, 0x24, 0x50, 0x01, 0x00, 0x01, 0xa3, 0x8b, 0x41, 0xeb, 0xc5, 0x8f, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x31, 0x5d, 0x94, 0x41, 0xb9, 0x92, 0x9a, 0x41, 0x3c, 0x50, 0x00, 0x00,
+        0x31, 0x5d, 0x94, 0x41, 0x1b, 0x80, 0x98, 0x41, 0x22, 0x50, 0x01, 0x00, 0x31, 0x5d, 0x94, 0x41,
+        0x1b, 0x80, 0x98, 0x41, 0x2e, 0x50, 0x01, 0x00, 0xd5, 0xe8, 0x9a, 0x41, 0x0d, 0x15, 0x9d, 0x41,
+        0x3c, 0x50, 0x00, 0x00, 0x61, 0x17, 0x9d, 0x41, 0xe0, 0x5a, 0xa0, 0x41, 0x3f, 0x50, 0x00, 0x00,
+        0x61, 0x17, 0x9d, 0x41, 0x4b, 0x3a, 0xa1, 0x41, 0x20, 0x50, 0x01, 0x00, 0x61, 0x17, 0x9d, 0x41,
+        0x4b, 0x3a, 0xa1, 0x41, 0x2c, 0x50, 0x01, 0x00, 0x33, 0x5d, 0xa0, 0x41, 0x26, 0x72, 0xa1, 0x41,
+        0x3f, 0x50, 0x00, 0x00, 0x79, 0x74, 0xa1, 0x41, 0x3e, 0xcf, 0xa5, 0x41, 0x41, 0x50, 0x00, 0x00,
+        0x91, 0xd1, 0xa5, 0x41, 0x56, 0x2c, 0xaa, 0x41, 0x41, 0x50, 0x00, 0x00, 0x91, 0xd1, 0xa5, 0x41,
+        0x7b, 0xf4, 0xa9, 0x41, 0x1f, 0x50, 0x01, 0x00, 0x91, 0xd1, 0xa5, 0x41, 0x7b, 0xf4, 0xa9, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0xa9, 0x2e, 0xaa, 0x41, 0x93, 0x51, 0xae, 0x41, 0x3f, 0x50, 0x00, 0x00,
+        0xc1, 0x8b, 0xae, 0x41, 0xce, 0xfd, 0xbf, 0x41, 0x3c, 0x50, 0x00, 0x00, 0xc1, 0x8b, 0xae, 0x41,
+        0xab, 0xae, 0xb2, 0x41, 0x24, 0x50, 0x01, 0x00, 0xd9, 0xe8, 0xb2, 0x41, 0xc3, 0x0b, 0xb7, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0xf1, 0x45, 0xb7, 0x41, 0xdb, 0x68, 0xbb, 0x41, 0x22, 0x50, 0x01, 0x00,
+        0x0a, 0xa3, 0xbb, 0x41, 0xf3, 0xc5, 0xbf, 0x41, 0x2e, 0x50, 0x01, 0x00, 0x22, 0x00, 0xc0, 0x41,
+        0x85, 0x6d, 0xcc, 0x41, 0x3c, 0x50, 0x00, 0x00, 0x22, 0x00, 0xc0, 0x41, 0x0b, 0x23, 0xc4, 0x41,
+        0x20, 0x50, 0x01, 0x00, 0x3a, 0x5d, 0xc4, 0x41, 0x23, 0x80, 0xc8, 0x41, 0x2c, 0x50, 0x01, 0x00,
+        0x52, 0xba, 0xc8, 0x41, 0x3b, 0xdd, 0xcc, 0x41, 0x1f, 0x50, 0x01, 0x00, 0x6a, 0x17, 0xcd, 0x41,
+        0x6a, 0x97, 0xcd, 0x41, 0x42, 0x50, 0x00, 0x00, 0x6a, 0x17, 0xcd, 0x41, 0x53, 0x3a, 0xd1, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0xbe, 0x99, 0xcd, 0x41, 0x94, 0x58, 0xd0, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x3c, 0x5d, 0xd0, 0x41, 0x2e, 0x72, 0xd1, 0x41, 0x3f, 0x50, 0x00, 0x00, 0x82, 0x74, 0xd1, 0x41,
+        0x5e, 0x2c, 0xda, 0x41, 0x41, 0x60, 0x00, 0x00, 0x82, 0x74, 0xd1, 0x41, 0x6b, 0x97, 0xd5, 0x41,
+        0x24, 0x60, 0x01, 0x00, 0x9a, 0xd1, 0xd5, 0x41, 0x83, 0xf4, 0xd9, 0x41, 0x30, 0x60, 0x01, 0x00,
+        0xb2, 0x2e, 0xda, 0x41, 0x3a, 0x64, 0xe0, 0x41, 0x3c, 0x60, 0x00, 0x00, 0xb2, 0x2e, 0xda, 0x41,
+        0x9b, 0x51, 0xde, 0x41, 0x22, 0x60, 0x01, 0x00, 0xca, 0x8b, 0xde, 0x41, 0xb3, 0xae, 0xe2, 0x41,
+        0x2e, 0x60, 0x01, 0x00, 0x56, 0xba, 0xe0, 0x41, 0x8e, 0xe6, 0xe2, 0x41, 0x3c, 0x60, 0x00, 0x00,
+        0xe2, 0xe8, 0xe2, 0x41, 0x60, 0x2c, 0xe6, 0x41, 0x3f, 0x60, 0x00, 0x00, 0xe2, 0xe8, 0xe2, 0x41,
+        0xcb, 0x0b, 0xe7, 0x41, 0x20, 0x60, 0x01, 0x00, 0xb4, 0x2e, 0xe6, 0x41, 0xa6, 0x43, 0xe7, 0x41,
+        0x3f, 0x60, 0x00, 0x00, 0xfa, 0x45, 0xe7, 0x41, 0xbe, 0xa0, 0xeb, 0x41, 0x41, 0x60, 0x00, 0x00,
+        0xfa, 0x45, 0xe7, 0x41, 0xe3, 0x68, 0xeb, 0x41, 0x2c, 0x60, 0x01, 0x00, 0x12, 0xa3, 0xeb, 0x41,
+        0xd6, 0xfd, 0xef, 0x41, 0x41, 0x60, 0x00, 0x00, 0x12, 0xa3, 0xeb, 0x41, 0xfb, 0xc5, 0xef, 0x41,
+        0x1f, 0x60, 0x01, 0x00, 0x2a, 0x00, 0xf0, 0x41, 0x13, 0x23, 0xf4, 0x41, 0x3f, 0x60, 0x00, 0x00,
+        0x2a, 0x00, 0xf0, 0x41, 0x13, 0x23, 0xf4, 0x41, 0x2b, 0x60, 0x01, 0x00, 0x42, 0x5d, 0xf4, 0x41,
+        0x2b, 0x80, 0xf8, 0x41, 0x43, 0x60, 0x00, 0x00, 0x42, 0x5d, 0xf4, 0x41, 0x2b, 0x80, 0xf8, 0x41,
+        0x24, 0x60, 0x01, 0x00, 0x5a, 0xba, 0xf8, 0x41, 0x43, 0xdd, 0xfc, 0x41, 0x43, 0x60, 0x00, 0x00,
+        0x5a, 0xba, 0xf8, 0x41, 0x43, 0xdd, 0xfc, 0x41, 0x30, 0x60, 0x01, 0x00, 0x72, 0x17, 0xfd, 0x41,
+        0x2e, 0x9d, 0x00, 0x42, 0x48, 0x60, 0x00, 0x00, 0x72, 0x17, 0xfd, 0x41, 0x2e, 0x9d, 0x00, 0x42,
+        0x22, 0x60, 0x01, 0x00, 0x45, 0xba, 0x00, 0x42, 0xba, 0xcb, 0x02, 0x42, 0x48, 0x60, 0x00, 0x00,
+        0x45, 0xba, 0x00, 0x42, 0xba, 0xcb, 0x02, 0x42, 0x2e, 0x60, 0x01, 0x00, 0xd1, 0xe8, 0x02, 0x42,
+        0x46, 0xfa, 0x04, 0x42, 0x4b, 0x60, 0x00, 0x00, 0xd1, 0xe8, 0x02, 0x42, 0x46, 0xfa, 0x04, 0x42,
+        0x20, 0x60, 0x01, 0x00, 0x5d, 0x17, 0x05, 0x42, 0xd2, 0x28, 0x07, 0x42, 0x4b, 0x60, 0x00, 0x00,
+        0x5d, 0x17, 0x05, 0x42, 0xd2, 0x28, 0x07, 0x42, 0x2c, 0x60, 0x01, 0x00, 0xe9, 0x45, 0x07, 0x42,
+        0x5e, 0x57, 0x09, 0x42, 0x48, 0x60, 0x00, 0x00, 0xe9, 0x45, 0x07, 0x42, 0x5e, 0x57, 0x09, 0x42,
+        0x1f, 0x60, 0x01, 0x00, 0x75, 0x74, 0x09, 0x42, 0x75, 0xb4, 0x09, 0x42, 0x42, 0x60, 0x00, 0x00,
+        0x75, 0x74, 0x09, 0x42, 0xea, 0x85, 0x0b, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x9f, 0xb5, 0x09, 0x42,
+        0x0a, 0x15, 0x0b, 0x42, 0x43, 0x60, 0x00, 0x00, 0x5e, 0x17, 0x0b, 0x42, 0xd7, 0xa1, 0x0b, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0x01, 0xa3, 0x0b, 0x42, 0xef, 0xfe, 0x0f, 0x42, 0x41, 0x60, 0x00, 0x00,
+        0x01, 0xa3, 0x0b, 0x42, 0x76, 0xb4, 0x0d, 0x42, 0x24, 0x60, 0x01, 0x00, 0x8d, 0xd1, 0x0d, 0x42,
+        0x02, 0xe3, 0x0f, 0x42, 0x30, 0x60, 0x01, 0x00, 0x19, 0x00, 0x10, 0x42, 0xdd, 0x1a, 0x13, 0x42,
+        0x3c, 0x60, 0x00, 0x00, 0x19, 0x00, 0x10, 0x42, 0x8e, 0x11, 0x12, 0x42, 0x22, 0x60, 0x01, 0x00,
+        0xa5, 0x2e, 0x12, 0x42, 0x1a, 0x40, 0x14, 0x42, 0x2e, 0x60, 0x01, 0x00, 0xeb, 0x45, 0x13, 0x42,
+        0x07, 0x5c, 0x14, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x31, 0x5d, 0x14, 0x42, 0xf0, 0xfe, 0x15, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0x31, 0x5d, 0x14, 0x42, 0xa6, 0x6e, 0x16, 0x42, 0x20, 0x60, 0x01, 0x00,
+        0x1a, 0x00, 0x16, 0x42, 0x93, 0x8a, 0x16, 0x42, 0x3f, 0x60, 0x00, 0x00, 0xbd, 0x8b, 0x16, 0x42,
+        0x1f, 0xb9, 0x18, 0x42, 0x41, 0x60, 0x00, 0x00, 0xbd, 0x8b, 0x16, 0x42, 0x32, 0x9d, 0x18, 0x42,
+        0x2c, 0x60, 0x01, 0x00, 0x49, 0xba, 0x18, 0x42, 0xab, 0xe7, 0x1a, 0x42, 0x41, 0x60, 0x00, 0x00,
+        0x49, 0xba, 0x18, 0x42, 0xbe, 0xcb, 0x1a, 0x42, 0x1f, 0x60, 0x01, 0x00, 0xd5, 0xe8, 0x1a, 0x42,
+        0x4a, 0xfa, 0x1c, 0x42, 0x3f, 0x60, 0x00, 0x00, 0xd5, 0xe8, 0x1a, 0x42, 0x4a, 0xfa, 0x1c, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x61, 0x17, 0x1d, 0x42, 0x67, 0xd0, 0x25, 0x42, 0x3c, 0x60, 0x00, 0x00,
+        0x61, 0x17, 0x1d, 0x42, 0xd6, 0x28, 0x1f, 0x42, 0x24, 0x60, 0x01, 0x00, 0xed, 0x45, 0x1f, 0x42,
+        0x62, 0x57, 0x21, 0x42, 0x30, 0x60, 0x01, 0x00, 0x79, 0x74, 0x21, 0x42, 0xee, 0x85, 0x23, 0x42,
+        0x22, 0x60, 0x01, 0x00, 0x05, 0xa3, 0x23, 0x42, 0x7a, 0xb4, 0x25, 0x42, 0x2e, 0x60, 0x01, 0x00,
+        0x91, 0xd1, 0x25, 0x42, 0xa5, 0xf5, 0x29, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x91, 0xd1, 0x25, 0x42,
+        0x06, 0xe3, 0x27, 0x42, 0x20, 0x60, 0x01, 0x00, 0x1d, 0x00, 0x28, 0x42, 0x92, 0x11, 0x2a, 0x42,
+        0x2c, 0x60, 0x01, 0x00, 0xa9, 0x2e, 0x2a, 0x42, 0x1e, 0x40, 0x2c, 0x42, 0x1f, 0x60, 0x01, 0x00,
+        0x35, 0x5d, 0x2c, 0x42, 0x98, 0x8a, 0x2e, 0x42, 0x48, 0x60, 0x00, 0x00, 0x35, 0x5d, 0x2c, 0x42,
+        0xaa, 0x6e, 0x2e, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xc1, 0x8b, 0x2e, 0x42, 0x81, 0x2d, 0x30, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0xc1, 0x8b, 0x2e, 0x42, 0x36, 0x9d, 0x30, 0x42, 0x24, 0x40, 0x01, 0x00,
+        0xaa, 0x2e, 0x30, 0x42, 0x24, 0xb9, 0x30, 0x42, 0x46, 0x40, 0x00, 0x00, 0x4d, 0xba, 0x30, 0x42,
+        0xb0, 0xe7, 0x32, 0x42, 0x43, 0x40, 0x00, 0x00, 0x4d, 0xba, 0x30, 0x42, 0xc2, 0xcb, 0x32, 0x42,
+        0x30, 0x40, 0x01, 0x00, 0xd9, 0xe8, 0x32, 0x42, 0x99, 0x8a, 0x34, 0x42, 0x41, 0x40, 0x00, 0x00,
+        0xd9, 0xe8, 0x32, 0x42, 0x4e, 0xfa, 0x34, 0x42, 0x22, 0x40, 0x01, 0x00, 0xc2, 0x8b, 0x34, 0x42,
+        0x3c, 0x16, 0x35, 0x42, 0x3f, 0x40, 0x00, 0x00, 0x65, 0x17, 0x35, 0x42, 0xc8, 0x44, 0x37, 0x42,
+        0x41, 0x40, 0x00, 0x00, 0x65, 0x17, 0x35, 0x42, 0xda, 0x28, 0x37, 0x42, 0x2e, 0x40, 0x01, 0x00,
+        0xf1, 0x45, 0x37, 0x42, 0xb1, 0xe7, 0x38, 0x42, 0x41, 0x40, 0x00, 0x00, 0xf1, 0x45, 0x37, 0x42,
+        0x66, 0x57, 0x39, 0x42, 0x20, 0x40, 0x01, 0x00, 0xda, 0xe8, 0x38, 0x42, 0x54, 0x73, 0x39, 0x42,
+        0x3f, 0x40, 0x00, 0x00, 0x7e, 0x74, 0x39, 0x42, 0xe0, 0xa1, 0x3b, 0x42, 0x41, 0x40, 0x00, 0x00,
+        0x7e, 0x74, 0x39, 0x42, 0xf2, 0x85, 0x3b, 0x42, 0x2c, 0x40, 0x01, 0x00, 0x0a, 0xa3, 0x3b, 0x42,
+        0x7e, 0xb4, 0x3d, 0x42, 0x43, 0x40, 0x00, 0x00, 0x0a, 0xa3, 0x3b, 0x42, 0x7e, 0xb4, 0x3d, 0x42,
+        0x1f, 0x40, 0x01, 0x00, 0x96, 0xd1, 0x3d, 0x42, 0x55, 0x73, 0x3f, 0x42, 0x3f, 0x40, 0x00, 0x00,
+        0x96, 0xd1, 0x3d, 0x42, 0x0a, 0xe3, 0x3f, 0x42, 0x2b, 0x40, 0x01, 0x00, 0x7f, 0x74, 0x3f, 0x42,
+        0xf8, 0xfe, 0x3f, 0x42, 0x3f, 0x40, 0x00, 0x00, 0x22, 0x00, 0x40, 0x42, 0xe1, 0xa1, 0x41, 0x42,
+        0x42, 0x40, 0x00, 0x00, 0x22, 0x00, 0x40, 0x42, 0x96, 0x11, 0x42, 0x42, 0x24, 0x40, 0x01, 0x00,
+        0x0b, 0xa3, 0x41, 0x42, 0x84, 0x2d, 0x42, 0x42, 0x42, 0x40, 0x00, 0x00, 0xae, 0x2e, 0x42, 0x42,
+        0x10, 0x5c, 0x44, 0x42, 0x41, 0x40, 0x00, 0x00, 0xae, 0x2e, 0x42, 0x42, 0x22, 0x40, 0x44, 0x42,
+        0x30, 0x40, 0x01, 0x00, 0x3a, 0x5d, 0x44, 0x42, 0x56, 0x73, 0x45, 0x42, 0x3f, 0x40, 0x00, 0x00,
+        0x3a, 0x5d, 0x44, 0x42, 0xae, 0x6e, 0x46, 0x42, 0x22, 0x40, 0x01, 0x00, 0x80, 0x74, 0x45, 0x42,
+        0x9c, 0x8a, 0x46, 0x42, 0x3c, 0x40, 0x00, 0x00, 0xc6, 0x8b, 0x46, 0x42, 0xe2, 0xa1, 0x47, 0x42,
+        0x3c, 0x40, 0x00, 0x00, 0xc6, 0x8b, 0x46, 0x42, 0x3a, 0x9d, 0x48, 0x42, 0x2e, 0x40, 0x01, 0x00,
+        0x0c, 0xa3, 0x47, 0x42, 0x28, 0xb9, 0x48, 0x42, 0x3c, 0x40, 0x00, 0x00, 0x52, 0xba, 0x48, 0x42,
+        0xb4, 0xe7, 0x4a, 0x42, 0x3f, 0x40, 0x00, 0x00, 0x52, 0xba, 0x48, 0x42, 0xc6, 0xcb, 0x4a, 0x42,
+        0x20, 0x40, 0x01, 0x00, 0xde, 0xe8, 0x4a, 0x42, 0xfa, 0xfe, 0x4b, 0x42, 0x3c, 0x40, 0x00, 0x00,
+        0xde, 0xe8, 0x4a, 0x42, 0x52, 0xfa, 0x4c, 0x42, 0x2c, 0x40, 0x01, 0x00, 0x24, 0x00, 0x4c, 0x42,
+        0x2e, 0x32, 0x50, 0x42, 0x3c, 0x40, 0x00, 0x00, 0x6a, 0x17, 0x4d, 0x42, 0xde, 0x28, 0x4f, 0x42,
+        0x1f, 0x40, 0x01, 0x00, 0xf6, 0x45, 0x4f, 0x42, 0x6a, 0x57, 0x51, 0x42, 0x2b, 0x40, 0x01, 0x00,
+        0x3c, 0x5d, 0x50, 0x42, 0x58, 0x73, 0x51, 0x42, 0x3c, 0x40, 0x00, 0x00, 0x82, 0x74, 0x51, 0x42,
+        0xe4, 0xa1, 0x53, 0x42, 0x3f, 0x40, 0x00, 0x00, 0x82, 0x74, 0x51, 0x42, 0xf6, 0x85, 0x53, 0x42,
+        0x24, 0x40, 0x01, 0x00, 0x0e, 0xa3, 0x53, 0x42, 0x70, 0xd0, 0x55, 0x42, 0x41, 0x40, 0x00, 0x00,
+        0x0e, 0xa3, 0x53, 0x42, 0x82, 0xb4, 0x55, 0x42, 0x30, 0x40, 0x01, 0x00, 0x9a, 0xd1, 0x55, 0x42,
+        0xfc, 0xfe, 0x57, 0x42, 0x41, 0x40, 0x00, 0x00, 0x9a, 0xd1, 0x55, 0x42, 0x0e, 0xe3, 0x57, 0x42,
+        0x22, 0x40, 0x01, 0x00, 0x26, 0x00, 0x58, 0x42, 0x88, 0x2d, 0x5a, 0x42, 0x3f, 0x40, 0x00, 0x00,
+        0x26, 0x00, 0x58, 0x42, 0x9a, 0x11, 0x5a, 0x42, 0x2e, 0x40, 0x01, 0x00, 0xb2, 0x2e, 0x5a, 0x42,
+        0xce, 0x44, 0x5b, 0x42, 0x42, 0x40, 0x00, 0x00, 0xb2, 0x2e, 0x5a, 0x42, 0x26, 0x40, 0x5c, 0x42,
+        0x20, 0x40, 0x01, 0x00, 0xf8, 0x45, 0x5b, 0x42, 0x8e, 0xa6, 0x61, 0x42, 0x43, 0x40, 0x00, 0x00,
+        0x3e, 0x5d, 0x5c, 0x42, 0xb3, 0x6e, 0x5e, 0x42, 0x2c, 0x40, 0x01, 0x00, 0xca, 0x8b, 0x5e, 0x42,
+        0x3f, 0x9d, 0x60, 0x42, 0x1f, 0x40, 0x01, 0x00, 0x56, 0xba, 0x60, 0x42, 0xcb, 0xcb, 0x62, 0x42,
+        0x2b, 0x40, 0x01, 0x00, 0x9c, 0xd1, 0x61, 0x42, 0xb8, 0xe7, 0x62, 0x42, 0x3f, 0x40, 0x00, 0x00,
+        0xe2, 0xe8, 0x62, 0x42, 0xa1, 0x8a, 0x64, 0x42, 0x41, 0x40, 0x00, 0x00, 0xe2, 0xe8, 0x62, 0x42,
+        0x57, 0xfa, 0x64, 0x42, 0x24, 0x40, 0x01, 0x00, 0xcb, 0x8b, 0x64, 0x42, 0x44, 0x16, 0x65, 0x42,
+        0x3f, 0x43, 0x00, 0x00, 0x6e, 0x17, 0x65, 0x42, 0x2d, 0xb9, 0x66, 0x42, 0x41, 0x44, 0x00, 0x00,
+        0x6e, 0x17, 0x65, 0x42, 0xe3, 0x28, 0x67, 0x42, 0x30, 0x44, 0x01, 0x00, 0x57, 0xba, 0x66, 0x42,
+        0xd0, 0x44, 0x67, 0x42, 0x3f, 0x48, 0x00, 0x00, 0xfa, 0x45, 0x67, 0x42, 0xb9, 0xe7, 0x68, 0x42,
+        0x41, 0x49, 0x00, 0x00, 0xfa, 0x45, 0x67, 0x42, 0x6f, 0x57, 0x69, 0x42, 0x22, 0x49, 0x01, 0x00,
+        0xe3, 0xe8, 0x68, 0x42, 0x5c, 0x73, 0x69, 0x42, 0x3f, 0x4c, 0x00, 0x00, 0x86, 0x74, 0x69, 0x42,
+        0xe8, 0xa1, 0x6b, 0x42, 0x3c, 0x4d, 0x00, 0x00, 0x86, 0x74, 0x69, 0x42, 0xfb, 0x85, 0x6b, 0x42,
+        0x2e, 0x4d, 0x01, 0x00, 0x12, 0xa3, 0x6b, 0x42, 0x87, 0xb4, 0x6d, 0x42, 0x3c, 0x52, 0x00, 0x00,
+        0x12, 0xa3, 0x6b, 0x42, 0x87, 0xb4, 0x6d, 0x42, 0x20, 0x52, 0x01, 0x00, 0x9e, 0xd1, 0x6d, 0x42,
+        0x00, 0xff, 0x6f, 0x42, 0x3f, 0x67, 0x00, 0x00, 0x9e, 0xd1, 0x6d, 0x42, 0x00, 0xff, 0x6f, 0x42,
+        0x43, 0x67, 0x00, 0x00, 0x9e, 0xd1, 0x6d, 0x42, 0x00, 0xff, 0x6f, 0x42, 0x48, 0x67, 0x00, 0x00,
+        0x9e, 0xd1, 0x6d, 0x42, 0x13, 0xe3, 0x6f, 0x42, 0x2c, 0x56, 0x01, 0x00, 0x2a, 0x00, 0x70, 0x42,
+        0x8c, 0x2d, 0x72, 0x42, 0x3e, 0x6d, 0x00, 0x00, 0x2a, 0x00, 0x70, 0x42, 0x8c, 0x2d, 0x72, 0x42,
+        0x41, 0x6d, 0x00, 0x00, 0x2a, 0x00, 0x70, 0x42, 0x8c, 0x2d, 0x72, 0x42, 0x48, 0x6d, 0x00, 0x00,
+        0x2a, 0x00, 0x70, 0x42, 0x9f, 0x11, 0x72, 0x42, 0x1f, 0x5b, 0x01, 0x00, 0xb6, 0x2e, 0x72, 0x42,
+        0xb6, 0x6e, 0x72, 0x42, 0x42, 0x60, 0x00, 0x00, 0xb6, 0x2e, 0x72, 0x42, 0x2b, 0x40, 0x74, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0xe0, 0x6f, 0x72, 0x42, 0x4b, 0xcf, 0x73, 0x42, 0x42, 0x60, 0x00, 0x00,
+        0x9f, 0xd1, 0x73, 0x42, 0x18, 0x5c, 0x74, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x42, 0x5d, 0x74, 0x42,
+        0x30, 0xb9, 0x78, 0x42, 0x41, 0x60, 0x00, 0x00, 0x42, 0x5d, 0x74, 0x42, 0xb7, 0x6e, 0x76, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0xce, 0x8b, 0x76, 0x42, 0x43, 0x9d, 0x78, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0x5a, 0xba, 0x78, 0x42, 0x1e, 0xd5, 0x7b, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x5a, 0xba, 0x78, 0x42,
+        0xcf, 0xcb, 0x7a, 0x42, 0x22, 0x60, 0x01, 0x00, 0xe6, 0xe8, 0x7a, 0x42, 0x5b, 0xfa, 0x7c, 0x42,
+        0x2e, 0x60, 0x01, 0x00, 0x2c, 0x00, 0x7c, 0x42, 0x48, 0x16, 0x7d, 0x42, 0x3c, 0x60, 0x00, 0x00,
+        0x72, 0x17, 0x7d, 0x42, 0x31, 0xb9, 0x7e, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x72, 0x17, 0x7d, 0x42,
+        0xe7, 0x28, 0x7f, 0x42, 0x20, 0x60, 0x01, 0x00, 0x5b, 0xba, 0x7e, 0x42, 0xd4, 0x44, 0x7f, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0xfe, 0x45, 0x7f, 0x42, 0xb0, 0xb9, 0x80, 0x42, 0x41, 0x60, 0x00, 0x00,
+        0xfe, 0x45, 0x7f, 0x42, 0xb9, 0xab, 0x80, 0x42, 0x2c, 0x60, 0x01, 0x00, 0x45, 0xba, 0x80, 0x42,
+        0xf6, 0xd0, 0x81, 0x42, 0x41, 0x60, 0x00, 0x00, 0x45, 0xba, 0x80, 0x42, 0xff, 0xc2, 0x81, 0x42,
+        0x1f, 0x60, 0x01, 0x00, 0x8b, 0xd1, 0x81, 0x42, 0x45, 0xda, 0x82, 0x42, 0x3f, 0x60, 0x00, 0x00,
+        0x8b, 0xd1, 0x81, 0x42, 0x45, 0xda, 0x82, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xd1, 0xe8, 0x82, 0x42,
+        0x8b, 0xf1, 0x83, 0x42, 0x3c, 0x60, 0x00, 0x00, 0xd1, 0xe8, 0x82, 0x42, 0x8b, 0xf1, 0x83, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0xd1, 0xe8, 0x82, 0x42, 0x8b, 0xf1, 0x83, 0x42, 0x43, 0x60, 0x00, 0x00,
+        0xd1, 0xe8, 0x82, 0x42, 0x8b, 0xf1, 0x83, 0x42, 0x24, 0x60, 0x01, 0x00, 0x17, 0x00, 0x84, 0x42,
+        0xd1, 0x08, 0x85, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x17, 0x00, 0x84, 0x42, 0xd1, 0x08, 0x85, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0x17, 0x00, 0x84, 0x42, 0xd1, 0x08, 0x85, 0x42, 0x43, 0x60, 0x00, 0x00,
+        0x17, 0x00, 0x84, 0x42, 0xd1, 0x08, 0x85, 0x42, 0x30, 0x60, 0x01, 0x00, 0x5d, 0x17, 0x85, 0x42,
+        0x17, 0x20, 0x86, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x5d, 0x17, 0x85, 0x42, 0x17, 0x20, 0x86, 0x42,
+        0x43, 0x60, 0x00, 0x00, 0x5d, 0x17, 0x85, 0x42, 0x17, 0x20, 0x86, 0x42, 0x48, 0x60, 0x00, 0x00,
+        0x5d, 0x17, 0x85, 0x42, 0x17, 0x20, 0x86, 0x42, 0x22, 0x60, 0x01, 0x00, 0xa3, 0x2e, 0x86, 0x42,
+        0x5d, 0x37, 0x87, 0x42, 0x3f, 0x60, 0x00, 0x00, 0xa3, 0x2e, 0x86, 0x42, 0x5d, 0x37, 0x87, 0x42,
+        0x43, 0x60, 0x00, 0x00, 0xa3, 0x2e, 0x86, 0x42, 0x5d, 0x37, 0x87, 0x42, 0x48, 0x60, 0x00, 0x00,
+        0xa3, 0x2e, 0x86, 0x42, 0x5d, 0x37, 0x87, 0x42, 0x2e, 0x60, 0x01, 0x00, 0xe9, 0x45, 0x87, 0x42,
+        0xa3, 0x4e, 0x88, 0x42, 0x42, 0x60, 0x00, 0x00, 0xe9, 0x45, 0x87, 0x42, 0xa3, 0x4e, 0x88, 0x42,
+        0x48, 0x60, 0x00, 0x00, 0xe9, 0x45, 0x87, 0x42, 0xa3, 0x4e, 0x88, 0x42, 0x4b, 0x60, 0x00, 0x00,
+        0xe9, 0x45, 0x87, 0x42, 0xa3, 0x4e, 0x88, 0x42, 0x20, 0x60, 0x01, 0x00, 0x2f, 0x5d, 0x88, 0x42,
+        0xe9, 0x65, 0x89, 0x42, 0x42, 0x60, 0x00, 0x00, 0x2f, 0x5d, 0x88, 0x42, 0xe9, 0x65, 0x89, 0x42,
+        0x48, 0x60, 0x00, 0x00, 0x2f, 0x5d, 0x88, 0x42, 0xe9, 0x65, 0x89, 0x42, 0x4b, 0x60, 0x00, 0x00,
+        0x2f, 0x5d, 0x88, 0x42, 0xe9, 0x65, 0x89, 0x42, 0x2c, 0x60, 0x01, 0x00, 0x75, 0x74, 0x89, 0x42,
+        0x2f, 0x7d, 0x8a, 0x42, 0x3e, 0x60, 0x00, 0x00, 0x75, 0x74, 0x89, 0x42, 0x2f, 0x7d, 0x8a, 0x42,
+        0x41, 0x60, 0x00, 0x00, 0x75, 0x74, 0x89, 0x42, 0x2f, 0x7d, 0x8a, 0x42, 0x48, 0x60, 0x00, 0x00,
+        0x75, 0x74, 0x89, 0x42, 0x2f, 0x7d, 0x8a, 0x42, 0x1f, 0x60, 0x01, 0x00, 0xbb, 0x8b, 0x8a, 0x42,
+        0xbb, 0xab, 0x8a, 0x42, 0x42, 0x60, 0x00, 0x00, 0xbb, 0x8b, 0x8a, 0x42, 0x75, 0x94, 0x8b, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x50, 0xac, 0x8a, 0x42, 0x06, 0x5c, 0x8b, 0x42, 0x43, 0x60, 0x00, 0x00,
+        0x30, 0x5d, 0x8b, 0x42, 0x6c, 0xa2, 0x8b, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x01, 0xa3, 0x8b, 0x42,
+        0xf8, 0xd0, 0x8d, 0x42, 0x41, 0x60, 0x00, 0x00, 0x01, 0xa3, 0x8b, 0x42, 0xbb, 0xab, 0x8c, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x47, 0xba, 0x8c, 0x42, 0x02, 0xc3, 0x8d, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0x8d, 0xd1, 0x8d, 0x42, 0xef, 0x5e, 0x8f, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x8d, 0xd1, 0x8d, 0x42,
+        0x48, 0xda, 0x8e, 0x42, 0x22, 0x60, 0x01, 0x00, 0xd3, 0xe8, 0x8e, 0x42, 0x8e, 0xf1, 0x8f, 0x42,
+        0x2e, 0x60, 0x01, 0x00, 0x76, 0x74, 0x8f, 0x42, 0x84, 0xff, 0x8f, 0x42, 0x3c, 0x60, 0x00, 0x00,
+        0x19, 0x00, 0x90, 0x42, 0xf9, 0xd0, 0x90, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x19, 0x00, 0x90, 0x42,
+        0xd4, 0x08, 0x91, 0x42, 0x20, 0x60, 0x01, 0x00, 0x8e, 0xd1, 0x90, 0x42, 0xca, 0x16, 0x91, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0x5f, 0x17, 0x91, 0x42, 0x10, 0x2e, 0x92, 0x42, 0x41, 0x60, 0x00, 0x00,
+        0x5f, 0x17, 0x91, 0x42, 0x1a, 0x20, 0x92, 0x42, 0x2c, 0x60, 0x01, 0x00, 0xa5, 0x2e, 0x92, 0x42,
+        0x56, 0x45, 0x93, 0x42, 0x41, 0x60, 0x00, 0x00, 0xa5, 0x2e, 0x92, 0x42, 0x60, 0x37, 0x93, 0x42,
+        0x1f, 0x60, 0x01, 0x00, 0xeb, 0x45, 0x93, 0x42, 0x9c, 0x5c, 0x94, 0x42, 0x3f, 0x60, 0x00, 0x00,
+        0xeb, 0x45, 0x93, 0x42, 0xa6, 0x4e, 0x94, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x31, 0x5d, 0x94, 0x42,
+        0xb4, 0xb9, 0x98, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x31, 0x5d, 0x94, 0x42, 0xec, 0x65, 0x95, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x77, 0x74, 0x95, 0x42, 0x32, 0x7d, 0x96, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0xbd, 0x8b, 0x96, 0x42, 0x78, 0x94, 0x97, 0x42, 0x22, 0x60, 0x01, 0x00, 0x03, 0xa3, 0x97, 0x42,
+        0xbe, 0xab, 0x98, 0x42, 0x2e, 0x60, 0x01, 0x00, 0x49, 0xba, 0x98, 0x42, 0x53, 0xcc, 0x9a, 0x42,
+        0x3c, 0x60, 0x00, 0x00, 0x49, 0xba, 0x98, 0x42, 0x04, 0xc3, 0x99, 0x42, 0x20, 0x60, 0x01, 0x00,
+        0x8f, 0xd1, 0x99, 0x42, 0x4a, 0xda, 0x9a, 0x42, 0x2c, 0x60, 0x01, 0x00, 0xd5, 0xe8, 0x9a, 0x42,
+        0x90, 0xf1, 0x9b, 0x42, 0x1f, 0x60, 0x01, 0x00, 0x1b, 0x00, 0x9c, 0x42, 0xd6, 0x08, 0x9d, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x61, 0x17, 0x9d, 0x42, 0x1c, 0x20, 0x9e, 0x42, 0x24, 0x50, 0x01, 0x00,
+        0x61, 0x17, 0x9d, 0x42, 0x1c, 0x20, 0x9e, 0x42, 0x30, 0x50, 0x01, 0x00, 0xa7, 0x2e, 0x9e, 0x42,
+        0xb5, 0xb9, 0x9e, 0x42, 0x3c, 0x50, 0x00, 0x00, 0xa7, 0x2e, 0x9e, 0x42, 0xb5, 0xb9, 0x9e, 0x42,
+        0x3f, 0x50, 0x00, 0x00, 0xa7, 0x2e, 0x9e, 0x42, 0xb5, 0xb9, 0x9e, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xed, 0x45, 0x9f, 0x42, 0xa8, 0x4e, 0xa0, 0x42, 0x22, 0x50, 0x01, 0x00, 0xed, 0x45, 0x9f, 0x42,
+        0xa8, 0x4e, 0xa0, 0x42, 0x2e, 0x50, 0x01, 0x00, 0x33, 0x5d, 0xa0, 0x42, 0x41, 0xe8, 0xa0, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x33, 0x5d, 0xa0, 0x42, 0x41, 0xe8, 0xa0, 0x42, 0x3f, 0x50, 0x00, 0x00,
+        0x33, 0x5d, 0xa0, 0x42, 0x41, 0xe8, 0xa0, 0x42, 0x43, 0x50, 0x00, 0x00, 0x79, 0x74, 0xa1, 0x42,
+        0x34, 0x7d, 0xa2, 0x42, 0x20, 0x50, 0x01, 0x00, 0x79, 0x74, 0xa1, 0x42, 0x34, 0x7d, 0xa2, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0xbf, 0x8b, 0xa2, 0x42, 0xcd, 0x16, 0xa3, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0xbf, 0x8b, 0xa2, 0x42, 0xcd, 0x16, 0xa3, 0x42, 0x3f, 0x50, 0x00, 0x00, 0xbf, 0x8b, 0xa2, 0x42,
+        0xcd, 0x16, 0xa3, 0x42, 0x42, 0x50, 0x00, 0x00, 0x05, 0xa3, 0xa3, 0x42, 0x6c, 0x69, 0xa4, 0x42,
+        0x1f, 0x50, 0x01, 0x00, 0x05, 0xa3, 0xa3, 0x42, 0x6c, 0x69, 0xa4, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x7a, 0x74, 0xa4, 0x42, 0x88, 0xbf, 0xa5, 0x42, 0x1f, 0x50, 0x01, 0x00, 0x7a, 0x74, 0xa4, 0x42,
+        0x88, 0xbf, 0xa5, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x4b, 0xba, 0xa4, 0x42, 0x59, 0x45, 0xa5, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x4b, 0xba, 0xa4, 0x42, 0x59, 0x45, 0xa5, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x4b, 0xba, 0xa4, 0x42, 0x59, 0x45, 0xa5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x91, 0xd1, 0xa5, 0x42,
+        0x4c, 0xda, 0xa6, 0x42, 0x24, 0x50, 0x01, 0x00, 0x91, 0xd1, 0xa5, 0x42, 0x4c, 0xda, 0xa6, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0xd7, 0xe8, 0xa6, 0x42, 0xe5, 0x73, 0xa7, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0xd7, 0xe8, 0xa6, 0x42, 0xe5, 0x73, 0xa7, 0x42, 0x3f, 0x50, 0x00, 0x00, 0xd7, 0xe8, 0xa6, 0x42,
+        0xe5, 0x73, 0xa7, 0x42, 0x43, 0x50, 0x00, 0x00, 0x1d, 0x00, 0xa8, 0x42, 0xd8, 0x08, 0xa9, 0x42,
+        0x22, 0x50, 0x01, 0x00, 0x1d, 0x00, 0xa8, 0x42, 0xd8, 0x08, 0xa9, 0x42, 0x2e, 0x50, 0x01, 0x00,
+        0x63, 0x17, 0xa9, 0x42, 0x71, 0xa2, 0xa9, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x63, 0x17, 0xa9, 0x42,
+        0x71, 0xa2, 0xa9, 0x42, 0x3f, 0x50, 0x00, 0x00, 0x63, 0x17, 0xa9, 0x42, 0x71, 0xa2, 0xa9, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xa9, 0x2e, 0xaa, 0x42, 0x64, 0x37, 0xab, 0x42, 0x20, 0x50, 0x01, 0x00,
+        0xa9, 0x2e, 0xaa, 0x42, 0x64, 0x37, 0xab, 0x42, 0x2c, 0x50, 0x01, 0x00, 0xef, 0x45, 0xab, 0x42,
+        0xfd, 0xd0, 0xab, 0x42, 0x3c, 0x50, 0x00, 0x00, 0xef, 0x45, 0xab, 0x42, 0xfd, 0xd0, 0xab, 0x42,
+        0x3f, 0x50, 0x00, 0x00, 0xef, 0x45, 0xab, 0x42, 0xfd, 0xd0, 0xab, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x35, 0x5d, 0xac, 0x42, 0x9c, 0x23, 0xad, 0x42, 0x1f, 0x50, 0x01, 0x00, 0x35, 0x5d, 0xac, 0x42,
+        0x9c, 0x23, 0xad, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xaa, 0x2e, 0xad, 0x42, 0xb8, 0x79, 0xae, 0x42,
+        0x1f, 0x50, 0x01, 0x00, 0xaa, 0x2e, 0xad, 0x42, 0xb8, 0x79, 0xae, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x7b, 0x74, 0xad, 0x42, 0x89, 0xff, 0xad, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x7b, 0x74, 0xad, 0x42,
+        0x89, 0xff, 0xad, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x7b, 0x74, 0xad, 0x42, 0x89, 0xff, 0xad, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xc1, 0x8b, 0xae, 0x42, 0x6a, 0xb0, 0xb2, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0xc1, 0x8b, 0xae, 0x42, 0x6a, 0xb0, 0xb2, 0x42, 0x3f, 0x50, 0x00, 0x00, 0xc1, 0x8b, 0xae, 0x42,
+        0x6a, 0xb0, 0xb2, 0x42, 0x43, 0x50, 0x00, 0x00, 0xc1, 0x8b, 0xae, 0x42, 0x6a, 0xb0, 0xb2, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0xc1, 0x8b, 0xae, 0x42, 0x6a, 0xb0, 0xb2, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xe6, 0x3f, 0x2b, 0x25, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x3f,
+        0x66, 0x66, 0xe6, 0x3f, 0x3b, 0x23, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x3f, 0x66, 0x66, 0xe6, 0x3f,
+        0x3e, 0x23, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x3f, 0x66, 0x66, 0xe6, 0x3f, 0x42, 0x23, 0x01, 0x00,
+        0x66, 0x66, 0xe6, 0x3f, 0x66, 0x66, 0x66, 0x40, 0x26, 0x1f, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x40,
+        0x66, 0x66, 0x66, 0x40, 0x39, 0x24, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x40, 0x66, 0x66, 0x66, 0x40,
+        0x3d, 0x24, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x40, 0x66, 0x66, 0x66, 0x40, 0x42, 0x24, 0x01, 0x00,
+        0x66, 0x66, 0x66, 0x40, 0xcd, 0xcc, 0xac, 0x40, 0x2b, 0x26, 0x01, 0x00, 0x66, 0x66, 0x86, 0x40,
+        0xcd, 0xcc, 0xac, 0x40, 0x3b, 0x23, 0x01, 0x00, 0x66, 0x66, 0x86, 0x40, 0xcd, 0xcc, 0xac, 0x40,
+        0x3e, 0x23, 0x01, 0x00, 0x66, 0x66, 0x86, 0x40, 0xcd, 0xcc, 0xac, 0x40, 0x42, 0x23, 0x01, 0x00,
+        0xcd, 0xcc, 0xac, 0x40, 0x66, 0x66, 0xe6, 0x40, 0x26, 0x22, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40,
+        0x66, 0x66, 0xe6, 0x40, 0x39, 0x27, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x66, 0x66, 0xe6, 0x40,
+        0x3d, 0x27, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x66, 0x66, 0xe6, 0x40, 0x42, 0x27, 0x01, 0x00,
+        0x66, 0x66, 0xe6, 0x40, 0x00, 0x00, 0x10, 0x41, 0x2b, 0x1e, 0x01, 0x00, 0x9a, 0x99, 0xf9, 0x40,
+        0x0a, 0x97, 0x06, 0x41, 0x4e, 0x26, 0x01, 0x00, 0x9a, 0x99, 0xf9, 0x40, 0x00, 0x00, 0x10, 0x41,
+        0x3b, 0x28, 0x01, 0x00, 0x9a, 0x99, 0xf9, 0x40, 0x00, 0x00, 0x10, 0x41, 0x3e, 0x28, 0x01, 0x00,
+        0x9a, 0x99, 0xf9, 0x40, 0x00, 0x00, 0x10, 0x41, 0x42, 0x28, 0x01, 0x00, 0x66, 0x66, 0x06, 0x41,
+        0xa4, 0x30, 0x10, 0x41, 0x51, 0x2c, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0x3d, 0xca, 0x19, 0x41,
+        0x4f, 0x26, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0xcd, 0xcc, 0x2c, 0x41, 0x26, 0x26, 0x01, 0x00,
+        0x9a, 0x99, 0x19, 0x41, 0xd7, 0x63, 0x23, 0x41, 0x4e, 0x2a, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x41,
+        0xcd, 0xcc, 0x2c, 0x41, 0x39, 0x2a, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x41, 0xcd, 0xcc, 0x2c, 0x41,
+        0x3d, 0x2a, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x41, 0xcd, 0xcc, 0x2c, 0x41, 0x42, 0x2a, 0x01, 0x00,
+        0x33, 0x33, 0x23, 0x41, 0x71, 0xfd, 0x2c, 0x41, 0x49, 0x29, 0x01, 0x00, 0xcd, 0xcc, 0x2c, 0x41,
+        0x0a, 0x97, 0x36, 0x41, 0x47, 0x30, 0x01, 0x00, 0xcd, 0xcc, 0x2c, 0x41, 0x9a, 0x99, 0x49, 0x41,
+        0x2b, 0x3a, 0x01, 0x00, 0x66, 0x66, 0x36, 0x41, 0xa4, 0x30, 0x40, 0x41, 0x49, 0x3e, 0x01, 0x00,
+        0x66, 0x66, 0x36, 0x41, 0x9a, 0x99, 0x49, 0x41, 0x3b, 0x30, 0x01, 0x00, 0x66, 0x66, 0x36, 0x41,
+        0x9a, 0x99, 0x49, 0x41, 0x3e, 0x30, 0x01, 0x00, 0x66, 0x66, 0x36, 0x41, 0x9a, 0x99, 0x49, 0x41,
+        0x42, 0x30, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41, 0x3d, 0xca, 0x49, 0x41, 0x4a, 0x3f, 0x01, 0x00,
+        0x9a, 0x99, 0x49, 0x41, 0xa4, 0xf0, 0x64, 0x41, 0x45, 0x34, 0x01, 0x00, 0x9a, 0x99, 0x49, 0x41,
+        0x66, 0x66, 0x66, 0x41, 0x26, 0x38, 0x01, 0x00, 0x33, 0x33, 0x53, 0x41, 0x66, 0x66, 0x66, 0x41,
+        0x39, 0x2b, 0x01, 0x00, 0x33, 0x33, 0x53, 0x41, 0x66, 0x66, 0x66, 0x41, 0x3d, 0x2b, 0x01, 0x00,
+        0x66, 0x66, 0x66, 0x41, 0x66, 0x66, 0x66, 0x41, 0x42, 0x52, 0x01, 0x00, 0x66, 0x66, 0x66, 0x41,
+        0x9a, 0x99, 0x81, 0x41, 0x2b, 0x54, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x9a, 0x99, 0x81, 0x41,
+        0x3b, 0x48, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x9a, 0x99, 0x81, 0x41, 0x3e, 0x48, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x41, 0x9a, 0x99, 0x81, 0x41, 0x42, 0x48, 0x01, 0x00, 0x9a, 0x99, 0x81, 0x41,
+        0x00, 0x00, 0x90, 0x41, 0x26, 0x4f, 0x01, 0x00, 0x66, 0x66, 0x86, 0x41, 0x00, 0x00, 0x90, 0x41,
+        0x39, 0x4c, 0x01, 0x00, 0x66, 0x66, 0x86, 0x41, 0x00, 0x00, 0x90, 0x41, 0x3d, 0x4c, 0x01, 0x00,
+        0x66, 0x66, 0x86, 0x41, 0x00, 0x00, 0x90, 0x41, 0x42, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41,
+        0x66, 0x66, 0x9e, 0x41, 0x2b, 0x5c, 0x01, 0x00, 0xcd, 0xcc, 0x94, 0x41, 0x66, 0x66, 0x9e, 0x41,
+        0x3b, 0x4c, 0x01, 0x00, 0xcd, 0xcc, 0x94, 0x41, 0x66, 0x66, 0x9e, 0x41, 0x3e, 0x4c, 0x01, 0x00,
+        0xcd, 0xcc, 0x94, 0x41, 0x66, 0x66, 0x9e, 0x41, 0x42, 0x4c, 0x01, 0x00, 0x66, 0x66, 0x9e, 0x41,
+        0xcd, 0xcc, 0xac, 0x41, 0x26, 0x4a, 0x01, 0x00, 0x33, 0x33, 0xa3, 0x41, 0xcd, 0xcc, 0xac, 0x41,
+        0x39, 0x4a, 0x01, 0x00, 0x33, 0x33, 0xa3, 0x41, 0xcd, 0xcc, 0xac, 0x41, 0x3d, 0x4a, 0x01, 0x00,
+        0x33, 0x33, 0xa3, 0x41, 0xcd, 0xcc, 0xac, 0x41, 0x42, 0x4a, 0x01, 0x00, 0xcd, 0xcc, 0xac, 0x41,
+        0x33, 0x33, 0xbb, 0x41, 0x2b, 0x58, 0x01, 0x00, 0x9a, 0x99, 0xb1, 0x41, 0xb8, 0x7e, 0xb6, 0x41,
+        0x4e, 0x22, 0x01, 0x00, 0x9a, 0x99, 0xb1, 0x41, 0x33, 0x33, 0xbb, 0x41, 0x3b, 0x24, 0x01, 0x00,
+        0x9a, 0x99, 0xb1, 0x41, 0x33, 0x33, 0xbb, 0x41, 0x3e, 0x24, 0x01, 0x00, 0x9a, 0x99, 0xb1, 0x41,
+        0x33, 0x33, 0xbb, 0x41, 0x42, 0x24, 0x01, 0x00, 0x66, 0x66, 0xb6, 0x41, 0x85, 0x4b, 0xbb, 0x41,
+        0x51, 0x2c, 0x01, 0x00, 0x33, 0x33, 0xbb, 0x41, 0x52, 0x18, 0xc0, 0x41, 0x4f, 0x2c, 0x01, 0x00,
+        0x33, 0x33, 0xbb, 0x41, 0x9a, 0x99, 0xc9, 0x41, 0x26, 0x2b, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41,
+        0x1f, 0xe5, 0xc4, 0x41, 0x4e, 0x29, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x9a, 0x99, 0xc9, 0x41,
+        0x39, 0x28, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x9a, 0x99, 0xc9, 0x41, 0x3d, 0x28, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0x9a, 0x99, 0xc9, 0x41, 0x42, 0x28, 0x01, 0x00, 0xcd, 0xcc, 0xc4, 0x41,
+        0xec, 0xb1, 0xc9, 0x41, 0x49, 0x2b, 0x01, 0x00, 0x9a, 0x99, 0xc9, 0x41, 0xb8, 0x7e, 0xce, 0x41,
+        0x47, 0x2d, 0x01, 0x00, 0x9a, 0x99, 0xc9, 0x41, 0x00, 0x00, 0xd8, 0x41, 0x2b, 0x37, 0x01, 0x00,
+        0x66, 0x66, 0xce, 0x41, 0x85, 0x4b, 0xd3, 0x41, 0x49, 0x38, 0x01, 0x00, 0x66, 0x66, 0xce, 0x41,
+        0x00, 0x00, 0xd8, 0x41, 0x3b, 0x33, 0x01, 0x00, 0x66, 0x66, 0xce, 0x41, 0x00, 0x00, 0xd8, 0x41,
+        0x3e, 0x33, 0x01, 0x00, 0x66, 0x66, 0xce, 0x41, 0x00, 0x00, 0xd8, 0x41, 0x42, 0x33, 0x01, 0x00,
+        0x33, 0x33, 0xd3, 0x41, 0x52, 0x18, 0xd8, 0x41, 0x4a, 0x3a, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x41,
+        0x14, 0xae, 0xe6, 0x41, 0x45, 0x38, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x41, 0x66, 0x66, 0xe6, 0x41,
+        0x26, 0x3e, 0x01, 0x00, 0xcd, 0xcc, 0xdc, 0x41, 0x66, 0x66, 0xe6, 0x41, 0x39, 0x33, 0x01, 0x00,
+        0xcd, 0xcc, 0xdc, 0x41, 0x66, 0x66, 0xe6, 0x41, 0x3d, 0x33, 0x01, 0x00, 0xcd, 0xcc, 0xdc, 0x41,
+        0x66, 0x66, 0xe6, 0x41, 0x42, 0x33, 0x01, 0x00, 0x66, 0x66, 0xe6, 0x41, 0x7b, 0x14, 0xf5, 0x41,
+        0x49, 0x43, 0x01, 0x00, 0x66, 0x66, 0xe6, 0x41, 0xcd, 0xcc, 0xf4, 0x41, 0x2a, 0x3f, 0x01, 0x00,
+        0x33, 0x33, 0xeb, 0x41, 0xcd, 0xcc, 0xf4, 0x41, 0x39, 0x3a, 0x01, 0x00, 0x33, 0x33, 0xeb, 0x41,
+        0xcd, 0xcc, 0xf4, 0x41, 0x3d, 0x3a, 0x01, 0x00, 0x33, 0x33, 0xeb, 0x41, 0xcd, 0xcc, 0xf4, 0x41,
+        0x42, 0x3a, 0x01, 0x00, 0xcd, 0xcc, 0xf4, 0x41, 0x71, 0xbd, 0x01, 0x42, 0x4e, 0x3b, 0x01, 0x00,
+        0xcd, 0xcc, 0xf4, 0x41, 0x9a, 0x99, 0x01, 0x42, 0x23, 0x30, 0x01, 0x00, 0x9a, 0x99, 0xf9, 0x41,
+        0x9a, 0x99, 0x01, 0x42, 0x3b, 0x2a, 0x01, 0x00, 0x9a, 0x99, 0xf9, 0x41, 0x9a, 0x99, 0x01, 0x42,
+        0x3e, 0x2a, 0x01, 0x00, 0x9a, 0x99, 0xf9, 0x41, 0x9a, 0x99, 0x01, 0x42, 0x42, 0x2a, 0x01, 0x00,
+        0x9a, 0x99, 0x01, 0x42, 0xcd, 0x1c, 0x16, 0x42, 0x40, 0x1b, 0x01, 0x00, 0x9a, 0x99, 0x01, 0x42,
+        0xcd, 0xcc, 0x08, 0x42, 0x28, 0x25, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42, 0xcd, 0xcc, 0x08, 0x42,
+        0x37, 0x20, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42, 0xcd, 0xcc, 0x08, 0x42, 0x3b, 0x20, 0x01, 0x00,
+        0xcd, 0xcc, 0x08, 0x42, 0x00, 0x00, 0x10, 0x42, 0x28, 0x28, 0x01, 0x00, 0x33, 0x33, 0x0b, 0x42,
+        0x00, 0x00, 0x10, 0x42, 0x3b, 0x22, 0x01, 0x00, 0x33, 0x33, 0x0b, 0x42, 0x00, 0x00, 0x10, 0x42,
+        0x3e, 0x22, 0x01, 0x00, 0x33, 0x33, 0x0b, 0x42, 0x00, 0x00, 0x10, 0x42, 0x43, 0x22, 0x01, 0x00,
+        0x00, 0x00, 0x10, 0x42, 0x33, 0x33, 0x17, 0x42, 0x26, 0x24, 0x01, 0x00, 0x66, 0x66, 0x12, 0x42,
+        0x33, 0x33, 0x17, 0x42, 0x35, 0x20, 0x01, 0x00, 0x66, 0x66, 0x12, 0x42, 0x33, 0x33, 0x17, 0x42,
+        0x39, 0x20, 0x01, 0x00, 0x66, 0x66, 0x12, 0x42, 0x33, 0x33, 0x17, 0x42, 0x3e, 0x20, 0x01, 0x00,
+        0x33, 0x33, 0x17, 0x42, 0xc3, 0xa5, 0x19, 0x42, 0x45, 0x47, 0x01, 0x00, 0x33, 0x33, 0x17, 0x42,
+        0x66, 0x66, 0x1e, 0x42, 0x21, 0x3c, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x42, 0x29, 0x0c, 0x1c, 0x42,
+        0x47, 0x43, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x42, 0x66, 0x66, 0x1e, 0x42, 0x39, 0x39, 0x01, 0x00,
+        0x9a, 0x99, 0x19, 0x42, 0x66, 0x66, 0x1e, 0x42, 0x3c, 0x39, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x42,
+        0x66, 0x66, 0x1e, 0x42, 0x40, 0x39, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x8f, 0x72, 0x1e, 0x42,
+        0x48, 0x3f, 0x01, 0x00, 0x66, 0x66, 0x1e, 0x42, 0xf6, 0xd8, 0x20, 0x42, 0x4c, 0x49, 0x01, 0x00,
+        0x66, 0x66, 0x1e, 0x42, 0x9a, 0x99, 0x25, 0x42, 0x26, 0x42, 0x01, 0x00, 0xcd, 0xcc, 0x20, 0x42,
+        0x5c, 0x3f, 0x23, 0x42, 0x4a, 0x41, 0x01, 0x00, 0xcd, 0xcc, 0x20, 0x42, 0x9a, 0x99, 0x25, 0x42,
+        0x37, 0x3c, 0x01, 0x00, 0xcd, 0xcc, 0x20, 0x42, 0x9a, 0x99, 0x25, 0x42, 0x3b, 0x3c, 0x01, 0x00,
+        0xcd, 0xcc, 0x20, 0x42, 0x9a, 0x99, 0x25, 0x42, 0x40, 0x3c, 0x01, 0x00, 0x33, 0x33, 0x23, 0x42,
+        0xc3, 0xa5, 0x25, 0x42, 0x47, 0x39, 0x01, 0x00, 0x9a, 0x99, 0x25, 0x42, 0x29, 0x0c, 0x28, 0x42,
+        0x4a, 0x49, 0x01, 0x00, 0x9a, 0x99, 0x25, 0x42, 0xcd, 0xcc, 0x2c, 0x42, 0x26, 0x46, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x42, 0x8f, 0x72, 0x2a, 0x42, 0x48, 0x41, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42,
+        0xcd, 0xcc, 0x2c, 0x42, 0x32, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42, 0xcd, 0xcc, 0x2c, 0x42,
+        0x37, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42, 0xcd, 0xcc, 0x2c, 0x42, 0x3b, 0x3f, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x42, 0xcd, 0xcc, 0x2c, 0x42, 0x40, 0x3f, 0x01, 0x00, 0x66, 0x66, 0x2a, 0x42,
+        0xf6, 0xd8, 0x2c, 0x42, 0x47, 0x40, 0x01, 0x00, 0xcd, 0xcc, 0x2c, 0x42, 0x33, 0x33, 0x38, 0x42,
+        0x4a, 0x4d, 0x01, 0x00, 0xcd, 0xcc, 0x2c, 0x42, 0x00, 0x00, 0x34, 0x42, 0x26, 0x4c, 0x01, 0x00,
+        0x33, 0x33, 0x2f, 0x42, 0x00, 0x00, 0x34, 0x42, 0x30, 0x3e, 0x01, 0x00, 0x33, 0x33, 0x2f, 0x42,
+        0x00, 0x00, 0x34, 0x42, 0x34, 0x3e, 0x01, 0x00, 0x33, 0x33, 0x2f, 0x42, 0x00, 0x00, 0x34, 0x42,
+        0x39, 0x3e, 0x01, 0x00, 0x33, 0x33, 0x2f, 0x42, 0x00, 0x00, 0x34, 0x42, 0x3e, 0x3e, 0x01, 0x00,
+        0x00, 0x00, 0x34, 0x42, 0x33, 0x33, 0x3b, 0x42, 0x26, 0x42, 0x01, 0x00, 0x66, 0x66, 0x36, 0x42,
+        0x33, 0x33, 0x3b, 0x42, 0x30, 0x3e, 0x01, 0x00, 0x66, 0x66, 0x36, 0x42, 0x33, 0x33, 0x3b, 0x42,
+        0x36, 0x3e, 0x01, 0x00, 0x66, 0x66, 0x36, 0x42, 0x33, 0x33, 0x3b, 0x42, 0x39, 0x3e, 0x01, 0x00,
+        0x66, 0x66, 0x36, 0x42, 0x33, 0x33, 0x3b, 0x42, 0x3e, 0x3e, 0x01, 0x00, 0xcd, 0xcc, 0x38, 0x42,
+        0x5c, 0x3f, 0x3b, 0x42, 0x4a, 0x41, 0x01, 0x00, 0x33, 0x33, 0x3b, 0x42, 0xc3, 0xa5, 0x3d, 0x42,
+        0x4c, 0x43, 0x01, 0x00, 0x33, 0x33, 0x3b, 0x42, 0x66, 0x66, 0x42, 0x42, 0x26, 0x41, 0x01, 0x00,
+        0x9a, 0x99, 0x3d, 0x42, 0x29, 0x0c, 0x40, 0x42, 0x4d, 0x43, 0x01, 0x00, 0x9a, 0x99, 0x3d, 0x42,
+        0x66, 0x66, 0x42, 0x42, 0x39, 0x39, 0x01, 0x00, 0x9a, 0x99, 0x3d, 0x42, 0x66, 0x66, 0x42, 0x42,
+        0x3c, 0x39, 0x01, 0x00, 0x9a, 0x99, 0x3d, 0x42, 0x66, 0x66, 0x42, 0x42, 0x41, 0x39, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x42, 0x8f, 0x72, 0x42, 0x42, 0x4f, 0x45, 0x01, 0x00, 0x66, 0x66, 0x42, 0x42,
+        0xf6, 0xd8, 0x44, 0x42, 0x51, 0x48, 0x01, 0x00, 0x66, 0x66, 0x42, 0x42, 0x9a, 0x99, 0x49, 0x42,
+        0x26, 0x40, 0x01, 0x00, 0xcd, 0xcc, 0x44, 0x42, 0x5c, 0x3f, 0x47, 0x42, 0x48, 0x36, 0x01, 0x00,
+        0xcd, 0xcc, 0x44, 0x42, 0x9a, 0x99, 0x49, 0x42, 0x39, 0x3c, 0x01, 0x00, 0xcd, 0xcc, 0x44, 0x42,
+        0x9a, 0x99, 0x49, 0x42, 0x3c, 0x3c, 0x01, 0x00, 0xcd, 0xcc, 0x44, 0x42, 0x9a, 0x99, 0x49, 0x42,
+        0x40, 0x3c, 0x01, 0x00, 0x33, 0x33, 0x47, 0x42, 0xc3, 0xa5, 0x49, 0x42, 0x4a, 0x47, 0x01, 0x00,
+        0x9a, 0x99, 0x49, 0x42, 0x29, 0x0c, 0x4c, 0x42, 0x4c, 0x4c, 0x01, 0x00, 0x9a, 0x99, 0x49, 0x42,
+        0xcd, 0xcc, 0x50, 0x42, 0x26, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42, 0x8f, 0x72, 0x4e, 0x42,
+        0x4a, 0x45, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42, 0xcd, 0xcc, 0x50, 0x42, 0x32, 0x3e, 0x01, 0x00,
+        0x00, 0x00, 0x4c, 0x42, 0xcd, 0xcc, 0x50, 0x42, 0x37, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42,
+        0xcd, 0xcc, 0x50, 0x42, 0x3b, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42, 0xcd, 0xcc, 0x50, 0x42,
+        0x40, 0x3e, 0x01, 0x00, 0x66, 0x66, 0x4e, 0x42, 0xf6, 0xd8, 0x50, 0x42, 0x47, 0x3d, 0x01, 0x00,
+        0xcd, 0xcc, 0x50, 0x42, 0x33, 0x33, 0x5c, 0x42, 0x4a, 0x4a, 0x01, 0x00, 0xcd, 0xcc, 0x50, 0x42,
+        0x00, 0x00, 0x58, 0x42, 0x26, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x53, 0x42, 0x00, 0x00, 0x58, 0x42,
+        0x30, 0x39, 0x01, 0x00, 0x33, 0x33, 0x53, 0x42, 0x00, 0x00, 0x58, 0x42, 0x34, 0x39, 0x01, 0x00,
+        0x33, 0x33, 0x53, 0x42, 0x00, 0x00, 0x58, 0x42, 0x39, 0x39, 0x01, 0x00, 0x33, 0x33, 0x53, 0x42,
+        0x00, 0x00, 0x58, 0x42, 0x3e, 0x39, 0x01, 0x00, 0x00, 0x00, 0x58, 0x42, 0x33, 0x33, 0x5f, 0x42,
+        0x26, 0x42, 0x01, 0x00, 0x66, 0x66, 0x5a, 0x42, 0x33, 0x33, 0x5f, 0x42, 0x30, 0x36, 0x01, 0x00,
+        0x66, 0x66, 0x5a, 0x42, 0x33, 0x33, 0x5f, 0x42, 0x36, 0x36, 0x01, 0x00, 0x66, 0x66, 0x5a, 0x42,
+        0x33, 0x33, 0x5f, 0x42, 0x39, 0x36, 0x01, 0x00, 0x66, 0x66, 0x5a, 0x42, 0x33, 0x33, 0x5f, 0x42,
+        0x3e, 0x36, 0x01, 0x00, 0xcd, 0xcc, 0x5c, 0x42, 0x5c, 0x3f, 0x5f, 0x42, 0x4a, 0x3b, 0x01, 0x00,
+        0x33, 0x33, 0x5f, 0x42, 0x3d, 0x8a, 0x66, 0x42, 0x4f, 0x45, 0x01, 0x00, 0x33, 0x33, 0x5f, 0x42,
+        0x66, 0x66, 0x66, 0x42, 0x28, 0x42, 0x01, 0x00, 0x9a, 0x99, 0x61, 0x42, 0x66, 0x66, 0x66, 0x42,
+        0x3b, 0x3f, 0x01, 0x00, 0x9a, 0x99, 0x61, 0x42, 0x66, 0x66, 0x66, 0x42, 0x40, 0x3f, 0x01, 0x00,
+        0x9a, 0x99, 0x61, 0x42, 0x66, 0x66, 0x66, 0x42, 0x43, 0x3f, 0x01, 0x00, 0x66, 0x66, 0x66, 0x42,
+        0x71, 0xbd, 0x6d, 0x42, 0x4e, 0x44, 0x01, 0x00, 0x66, 0x66, 0x66, 0x42, 0x9a, 0x99, 0x6d, 0x42,
+        0x2a, 0x4a, 0x01, 0x00, 0xcd, 0xcc, 0x68, 0x42, 0x9a, 0x99, 0x6d, 0x42, 0x39, 0x43, 0x01, 0x00,
+        0xcd, 0xcc, 0x68, 0x42, 0x9a, 0x99, 0x6d, 0x42, 0x3d, 0x43, 0x01, 0x00, 0xcd, 0xcc, 0x68, 0x42,
+        0x9a, 0x99, 0x6d, 0x42, 0x42, 0x43, 0x01, 0x00, 0x9a, 0x99, 0x6d, 0x42, 0x29, 0x0c, 0x70, 0x42,
+        0x47, 0x35, 0x01, 0x00, 0x9a, 0x99, 0x6d, 0x42, 0xcd, 0xcc, 0x74, 0x42, 0x23, 0x3d, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x42, 0x8f, 0x72, 0x72, 0x42, 0x45, 0x44, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42,
+        0xcd, 0xcc, 0x74, 0x42, 0x3b, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42, 0xcd, 0xcc, 0x74, 0x42,
+        0x3e, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42, 0xcd, 0xcc, 0x74, 0x42, 0x42, 0x3f, 0x01, 0x00,
+        0x66, 0x66, 0x72, 0x42, 0xf6, 0xd8, 0x74, 0x42, 0x47, 0x4f, 0x01, 0x00, 0xcd, 0xcc, 0x74, 0x42,
+        0x5c, 0x3f, 0x77, 0x42, 0x49, 0x51, 0x01, 0x00, 0xcd, 0xcc, 0x74, 0x42, 0x00, 0x00, 0x7c, 0x42,
+        0x28, 0x47, 0x01, 0x00, 0x33, 0x33, 0x77, 0x42, 0xc3, 0xa5, 0x79, 0x42, 0x4a, 0x51, 0x01, 0x00,
+        0x33, 0x33, 0x77, 0x42, 0x00, 0x00, 0x7c, 0x42, 0x3d, 0x3e, 0x01, 0x00, 0x33, 0x33, 0x77, 0x42,
+        0x00, 0x00, 0x7c, 0x42, 0x40, 0x3e, 0x01, 0x00, 0x33, 0x33, 0x77, 0x42, 0x00, 0x00, 0x7c, 0x42,
+        0x45, 0x3e, 0x01, 0x00, 0x9a, 0x99, 0x79, 0x42, 0x29, 0x0c, 0x7c, 0x42, 0x4c, 0x4b, 0x01, 0x00,
+        0x00, 0x00, 0x7c, 0x42, 0x8f, 0x72, 0x7e, 0x42, 0x49, 0x45, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42,
+        0x9a, 0x99, 0x81, 0x42, 0x28, 0x46, 0x01, 0x00, 0x66, 0x66, 0x7e, 0x42, 0x7b, 0x6c, 0x80, 0x42,
+        0x4a, 0x48, 0x01, 0x00, 0x66, 0x66, 0x7e, 0x42, 0x9a, 0x99, 0x81, 0x42, 0x39, 0x3d, 0x01, 0x00,
+        0x66, 0x66, 0x7e, 0x42, 0x9a, 0x99, 0x81, 0x42, 0x3d, 0x3d, 0x01, 0x00, 0x66, 0x66, 0x7e, 0x42,
+        0x9a, 0x99, 0x81, 0x42, 0x45, 0x3d, 0x01, 0x00, 0x66, 0x66, 0x80, 0x42, 0xae, 0x9f, 0x81, 0x42,
+        0x4c, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x81, 0x42, 0x9a, 0x99, 0x81, 0x42, 0x42, 0x3a, 0x01, 0x00,
+        0x9a, 0x99, 0x81, 0x42, 0x33, 0x33, 0x85, 0x42, 0x28, 0x45, 0x01, 0x00, 0xcd, 0xcc, 0x82, 0x42,
+        0x00, 0x00, 0x84, 0x42, 0x2f, 0x3a, 0x01, 0x00, 0xcd, 0xcc, 0x82, 0x42, 0x00, 0x00, 0x84, 0x42,
+        0x39, 0x3a, 0x01, 0x00, 0xcd, 0xcc, 0x82, 0x42, 0x00, 0x00, 0x84, 0x42, 0x3e, 0x3a, 0x01, 0x00,
+        0x00, 0x00, 0x84, 0x42, 0x48, 0x39, 0x85, 0x42, 0x43, 0x40, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42,
+        0x33, 0x33, 0x85, 0x42, 0x34, 0x42, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42, 0x33, 0x33, 0x85, 0x42,
+        0x3b, 0x42, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42, 0x33, 0x33, 0x85, 0x42, 0x3e, 0x42, 0x01, 0x00,
+        0x33, 0x33, 0x85, 0x42, 0x14, 0x9e, 0x88, 0x42, 0x48, 0x4a, 0x01, 0x00, 0x33, 0x33, 0x85, 0x42,
+        0xcd, 0xcc, 0x88, 0x42, 0x3c, 0x4f, 0x01, 0x00, 0x33, 0x33, 0x85, 0x42, 0xcd, 0xcc, 0x88, 0x42,
+        0x40, 0x4f, 0x01, 0x00, 0x33, 0x33, 0x85, 0x42, 0xcd, 0xcc, 0x88, 0x42, 0x45, 0x4f, 0x01, 0x00,
+        0x33, 0x33, 0x85, 0x42, 0xcd, 0xcc, 0x88, 0x42, 0x2d, 0x4d, 0x01, 0x00, 0x33, 0x33, 0x85, 0x42,
+        0xcd, 0xcc, 0x88, 0x42, 0x37, 0x4d, 0x01, 0x00, 0xcd, 0xcc, 0x88, 0x42, 0x66, 0x66, 0x8c, 0x42,
+        0x4a, 0x4b, 0x01, 0x00, 0xcd, 0xcc, 0x88, 0x42, 0x66, 0x66, 0x8c, 0x42, 0x3e, 0x40, 0x01, 0x00,
+        0xcd, 0xcc, 0x88, 0x42, 0x66, 0x66, 0x8c, 0x42, 0x42, 0x40, 0x01, 0x00, 0xcd, 0xcc, 0x88, 0x42,
+        0x66, 0x66, 0x8c, 0x42, 0x45, 0x40, 0x01, 0x00, 0xcd, 0xcc, 0x88, 0x42, 0x66, 0x66, 0x8c, 0x42,
+        0x26, 0x41, 0x01, 0x00, 0xcd, 0xcc, 0x88, 0x42, 0x66, 0x66, 0x8c, 0x42, 0x2d, 0x41, 0x01, 0x00,
+        0xcd, 0xcc, 0x88, 0x42, 0x66, 0x66, 0x8c, 0x42, 0x32, 0x41, 0x01, 0x00, 0x66, 0x66, 0x8c, 0x42,
+        0x66, 0x66, 0x92, 0x42, 0x2b, 0x25, 0x01, 0x00, 0x66, 0x66, 0x8e, 0x42, 0x66, 0x66, 0x92, 0x42,
+        0x3b, 0x21, 0x01, 0x00, 0x66, 0x66, 0x8e, 0x42, 0x66, 0x66, 0x92, 0x42, 0x3e, 0x21, 0x01, 0x00,
+        0x66, 0x66, 0x8e, 0x42, 0x66, 0x66, 0x92, 0x42, 0x42, 0x21, 0x01, 0x00, 0x66, 0x66, 0x92, 0x42,
+        0x66, 0x66, 0x98, 0x42, 0x26, 0x24, 0x01, 0x00, 0x66, 0x66, 0x94, 0x42, 0x66, 0x66, 0x98, 0x42,
+        0x39, 0x1f, 0x01, 0x00, 0x66, 0x66, 0x94, 0x42, 0x66, 0x66, 0x98, 0x42, 0x3d, 0x1f, 0x01, 0x00,
+        0x66, 0x66, 0x94, 0x42, 0x66, 0x66, 0x98, 0x42, 0x42, 0x1f, 0x01, 0x00, 0x66, 0x66, 0x98, 0x42,
+        0x66, 0x66, 0x9e, 0x42, 0x2b, 0x27, 0x01, 0x00, 0x66, 0x66, 0x9a, 0x42, 0x66, 0x66, 0x9e, 0x42,
+        0x3b, 0x20, 0x01, 0x00, 0x66, 0x66, 0x9a, 0x42, 0x66, 0x66, 0x9e, 0x42, 0x3e, 0x20, 0x01, 0x00,
+        0x66, 0x66, 0x9a, 0x42, 0x66, 0x66, 0x9e, 0x42, 0x42, 0x20, 0x01, 0x00, 0x66, 0x66, 0x9e, 0x42,
+        0x66, 0x66, 0xa4, 0x42, 0x26, 0x22, 0x01, 0x00, 0x66, 0x66, 0xa0, 0x42, 0x66, 0x66, 0xa4, 0x42,
+        0x39, 0x23, 0x01, 0x00, 0x66, 0x66, 0xa0, 0x42, 0x66, 0x66, 0xa4, 0x42, 0x3d, 0x23, 0x01, 0x00,
+        0x66, 0x66, 0xa0, 0x42, 0x66, 0x66, 0xa4, 0x42, 0x42, 0x23, 0x01, 0x00, 0x66, 0x66, 0xa4, 0x42,
+        0x66, 0x66, 0xaa, 0x42, 0x2b, 0x20, 0x01, 0x00, 0x66, 0x66, 0xa6, 0x42, 0x89, 0x70, 0xa8, 0x42,
+        0x4e, 0x26, 0x01, 0x00, 0x66, 0x66, 0xa6, 0x42, 0x66, 0x66, 0xaa, 0x42, 0x3b, 0x23, 0x01, 0x00,
+        0x66, 0x66, 0xa6, 0x42, 0x66, 0x66, 0xaa, 0x42, 0x3e, 0x23, 0x01, 0x00, 0x66, 0x66, 0xa6, 0x42,
+        0x66, 0x66, 0xaa, 0x42, 0x42, 0x23, 0x01, 0x00, 0x66, 0x66, 0xa8, 0x42, 0x89, 0x70, 0xaa, 0x42,
+        0x51, 0x2a, 0x01, 0x00, 0x66, 0x66, 0xaa, 0x42, 0x89, 0x70, 0xac, 0x42, 0x4f, 0x2a, 0x01, 0x00,
+        0x66, 0x66, 0xaa, 0x42, 0x66, 0x66, 0xb0, 0x42, 0x26, 0x27, 0x01, 0x00, 0x66, 0x66, 0xac, 0x42,
+        0x89, 0x70, 0xae, 0x42, 0x4e, 0x2e, 0x01, 0x00, 0x66, 0x66, 0xac, 0x42, 0x66, 0x66, 0xb0, 0x42,
+        0x39, 0x2b, 0x01, 0x00, 0x66, 0x66, 0xac, 0x42, 0x66, 0x66, 0xb0, 0x42, 0x3d, 0x2b, 0x01, 0x00,
+        0x66, 0x66, 0xac, 0x42, 0x66, 0x66, 0xb0, 0x42, 0x42, 0x2b, 0x01, 0x00, 0x66, 0x66, 0xae, 0x42,
+        0x89, 0x70, 0xb0, 0x42, 0x49, 0x26, 0x01, 0x00, 0x66, 0x66, 0xb0, 0x42, 0x89, 0x70, 0xb2, 0x42,
+        0x47, 0x36, 0x01, 0x00, 0x66, 0x66, 0xb0, 0x42, 0x66, 0x66, 0xb6, 0x42, 0x2b, 0x39, 0x01, 0x00,
+        0x66, 0x66, 0xb2, 0x42, 0x89, 0x70, 0xb4, 0x42, 0x49, 0x3c, 0x01, 0x00, 0x66, 0x66, 0xb2, 0x42,
+        0x66, 0x66, 0xb6, 0x42, 0x3b, 0x33, 0x01, 0x00, 0x66, 0x66, 0xb2, 0x42, 0x66, 0x66, 0xb6, 0x42,
+        0x3e, 0x33, 0x01, 0x00, 0x66, 0x66, 0xb2, 0x42, 0x66, 0x66, 0xb6, 0x42, 0x42, 0x33, 0x01, 0x00,
+        0x66, 0x66, 0xb4, 0x42, 0x89, 0x70, 0xb6, 0x42, 0x4a, 0x43, 0x01, 0x00, 0x66, 0x66, 0xb6, 0x42,
+        0x89, 0x18, 0xbc, 0x42, 0x45, 0x30, 0x01, 0x00, 0x66, 0x66, 0xb6, 0x42, 0x66, 0x66, 0xbc, 0x42,
+        0x26, 0x34, 0x01, 0x00, 0x66, 0x66, 0xb8, 0x42, 0x66, 0x66, 0xbc, 0x42, 0x39, 0x2c, 0x01, 0x00,
+        0x66, 0x66, 0xb8, 0x42, 0x66, 0x66, 0xbc, 0x42, 0x3d, 0x2c, 0x01, 0x00, 0x66, 0x66, 0xbc, 0x42,
+        0x66, 0x66, 0xbc, 0x42, 0x42, 0x52, 0x01, 0x00, 0x66, 0x66, 0xbc, 0x42, 0x66, 0x66, 0xc2, 0x42,
+        0x2b, 0x57, 0x01, 0x00, 0x66, 0x66, 0xbe, 0x42, 0x66, 0x66, 0xc2, 0x42, 0x3b, 0x4c, 0x01, 0x00,
+        0x66, 0x66, 0xbe, 0x42, 0x66, 0x66, 0xc2, 0x42, 0x3e, 0x4c, 0x01, 0x00, 0x66, 0x66, 0xbe, 0x42,
+        0x66, 0x66, 0xc2, 0x42, 0x42, 0x4c, 0x01, 0x00, 0x66, 0x66, 0xc2, 0x42, 0x66, 0x66, 0xc8, 0x42,
+        0x26, 0x52, 0x01, 0x00, 0x66, 0x66, 0xc4, 0x42, 0x66, 0x66, 0xc8, 0x42, 0x39, 0x4e, 0x01, 0x00,
+        0x66, 0x66, 0xc4, 0x42, 0x66, 0x66, 0xc8, 0x42, 0x3d, 0x4e, 0x01, 0x00, 0x66, 0x66, 0xc4, 0x42,
+        0x66, 0x66, 0xc8, 0x42, 0x42, 0x4e, 0x01, 0x00, 0x66, 0x66, 0xc8, 0x42, 0x66, 0x66, 0xce, 0x42,
+        0x2b, 0x5b, 0x01, 0x00, 0x66, 0x66, 0xca, 0x42, 0x66, 0x66, 0xce, 0x42, 0x3b, 0x4f, 0x01, 0x00,
+        0x66, 0x66, 0xca, 0x42, 0x66, 0x66, 0xce, 0x42, 0x3e, 0x4f, 0x01, 0x00, 0x66, 0x66, 0xca, 0x42,
+        0x66, 0x66, 0xce, 0x42, 0x42, 0x4f, 0x01, 0x00, 0x66, 0x66, 0xce, 0x42, 0x66, 0x66, 0xd4, 0x42,
+        0x26, 0x52, 0x01, 0x00, 0x66, 0x66, 0xd0, 0x42, 0x66, 0x66, 0xd4, 0x42, 0x39, 0x47, 0x01, 0x00,
+        0x66, 0x66, 0xd0, 0x42, 0x66, 0x66, 0xd4, 0x42, 0x3d, 0x47, 0x01, 0x00, 0x66, 0x66, 0xd0, 0x42,
+        0x66, 0x66, 0xd4, 0x42, 0x42, 0x47, 0x01, 0x00, 0x66, 0x66, 0xd4, 0x42, 0x66, 0x66, 0xda, 0x42,
+        0x2b, 0x57, 0x01, 0x00, 0x66, 0x66, 0xd6, 0x42, 0x89, 0x70, 0xd8, 0x42, 0x4e, 0x22, 0x01, 0x00,
+        0x66, 0x66, 0xd6, 0x42, 0x66, 0x66, 0xda, 0x42, 0x3b, 0x23, 0x01, 0x00, 0x66, 0x66, 0xd6, 0x42,
+        0x66, 0x66, 0xda, 0x42, 0x3e, 0x23, 0x01, 0x00, 0x66, 0x66, 0xd6, 0x42, 0x66, 0x66, 0xda, 0x42,
+        0x42, 0x23, 0x01, 0x00, 0x66, 0x66, 0xd8, 0x42, 0x89, 0x70, 0xda, 0x42, 0x51, 0x28, 0x01, 0x00,
+        0x66, 0x66, 0xda, 0x42, 0x89, 0x70, 0xdc, 0x42, 0x4f, 0x2b, 0x01, 0x00, 0x66, 0x66, 0xda, 0x42,
+        0x66, 0x66, 0xe0, 0x42, 0x26, 0x29, 0x01, 0x00, 0x66, 0x66, 0xdc, 0x42, 0x89, 0x70, 0xde, 0x42,
+        0x4e, 0x2a, 0x01, 0x00, 0x66, 0x66, 0xdc, 0x42, 0x66, 0x66, 0xe0, 0x42, 0x39, 0x27, 0x01, 0x00,
+        0x66, 0x66, 0xdc, 0x42, 0x66, 0x66, 0xe0, 0x42, 0x3d, 0x27, 0x01, 0x00, 0x66, 0x66, 0xdc, 0x42,
+        0x66, 0x66, 0xe0, 0x42, 0x42, 0x27, 0x01, 0x00, 0x66, 0x66, 0xde, 0x42, 0x89, 0x70, 0xe0, 0x42,
+        0x49, 0x2a, 0x01, 0x00, 0x66, 0x66, 0xe0, 0x42, 0x89, 0x70, 0xe2, 0x42, 0x47, 0x31, 0x01, 0x00,
+        0x66, 0x66, 0xe0, 0x42, 0x66, 0x66, 0xe6, 0x42, 0x2b, 0x38, 0x01, 0x00, 0x66, 0x66, 0xe2, 0x42,
+        0x89, 0x70, 0xe4, 0x42, 0x49, 0x36, 0x01, 0x00, 0x66, 0x66, 0xe2, 0x42, 0x66, 0x66, 0xe6, 0x42,
+        0x3b, 0x2f, 0x01, 0x00, 0x66, 0x66, 0xe2, 0x42, 0x66, 0x66, 0xe6, 0x42, 0x3e, 0x2f, 0x01, 0x00,
+        0x66, 0x66, 0xe2, 0x42, 0x66, 0x66, 0xe6, 0x42, 0x42, 0x2f, 0x01, 0x00, 0x66, 0x66, 0xe4, 0x42,
+        0x89, 0x70, 0xe6, 0x42, 0x4a, 0x3f, 0x01, 0x00, 0x66, 0x66, 0xe6, 0x42, 0x44, 0x84, 0xec, 0x42,
+        0x45, 0x33, 0x01, 0x00, 0x66, 0x66, 0xe6, 0x42, 0x66, 0x66, 0xec, 0x42, 0x26, 0x3a, 0x01, 0x00,
+        0x66, 0x66, 0xe8, 0x42, 0x66, 0x66, 0xec, 0x42, 0x39, 0x37, 0x01, 0x00, 0x66, 0x66, 0xe8, 0x42,
+        0x66, 0x66, 0xec, 0x42, 0x3d, 0x37, 0x01, 0x00, 0x66, 0x66, 0xe8, 0x42, 0x66, 0x66, 0xec, 0x42,
+        0x42, 0x37, 0x01, 0x00, 0x66, 0x66, 0xec, 0x42, 0x44, 0x84, 0xf2, 0x42, 0x49, 0x44, 0x01, 0x00,
+        0x66, 0x66, 0xec, 0x42, 0x66, 0x66, 0xf2, 0x42, 0x2a, 0x41, 0x01, 0x00, 0x66, 0x66, 0xee, 0x42,
+        0x66, 0x66, 0xf2, 0x42, 0x39, 0x31, 0x01, 0x00, 0x66, 0x66, 0xee, 0x42, 0x66, 0x66, 0xf2, 0x42,
+        0x3d, 0x31, 0x01, 0x00, 0x66, 0x66, 0xee, 0x42, 0x66, 0x66, 0xf2, 0x42, 0x42, 0x31, 0x01, 0x00,
+        0x66, 0x66, 0xf2, 0x42, 0x44, 0x84, 0xf8, 0x42, 0x4e, 0x3c, 0x01, 0x00, 0x66, 0x66, 0xf2, 0x42,
+        0x66, 0x66, 0xf8, 0x42, 0x23, 0x30, 0x01, 0x00, 0x66, 0x66, 0xf4, 0x42, 0x66, 0x66, 0xf8, 0x42,
+        0x3b, 0x29, 0x01, 0x00, 0x66, 0x66, 0xf4, 0x42, 0x66, 0x66, 0xf8, 0x42, 0x3e, 0x29, 0x01, 0x00,
+        0x66, 0x66, 0xf4, 0x42, 0x66, 0x66, 0xf8, 0x42, 0x42, 0x29, 0x01, 0x00, 0x66, 0x66, 0xf8, 0x42,
+        0x33, 0xbf, 0x04, 0x43, 0x40, 0x19, 0x01, 0x00, 0x66, 0x66, 0xf8, 0x42, 0x66, 0x66, 0xfe, 0x42,
+        0x28, 0x2b, 0x01, 0x00, 0x66, 0x66, 0xfa, 0x42, 0x66, 0x66, 0xfe, 0x42, 0x37, 0x1f, 0x01, 0x00,
+        0x66, 0x66, 0xfa, 0x42, 0x66, 0x66, 0xfe, 0x42, 0x3b, 0x1f, 0x01, 0x00, 0x66, 0x66, 0xfe, 0x42,
+        0x33, 0x33, 0x02, 0x43, 0x28, 0x2a, 0x01, 0x00, 0x33, 0x33, 0x00, 0x43, 0x33, 0x33, 0x02, 0x43,
+        0x3b, 0x21, 0x01, 0x00, 0x33, 0x33, 0x00, 0x43, 0x33, 0x33, 0x02, 0x43, 0x3e, 0x21, 0x01, 0x00,
+        0x33, 0x33, 0x00, 0x43, 0x33, 0x33, 0x02, 0x43, 0x43, 0x21, 0x01, 0x00, 0x33, 0x33, 0x02, 0x43,
+        0x33, 0x33, 0x05, 0x43, 0x26, 0x26, 0x01, 0x00, 0x33, 0x33, 0x03, 0x43, 0x33, 0x33, 0x05, 0x43,
+        0x35, 0x23, 0x01, 0x00, 0x33, 0x33, 0x03, 0x43, 0x33, 0x33, 0x05, 0x43, 0x39, 0x23, 0x01, 0x00,
+        0x33, 0x33, 0x03, 0x43, 0x33, 0x33, 0x05, 0x43, 0x3e, 0x23, 0x01, 0x00, 0x33, 0x33, 0x05, 0x43,
+        0x44, 0x38, 0x06, 0x43, 0x45, 0x46, 0x01, 0x00, 0x33, 0x33, 0x05, 0x43, 0x33, 0x33, 0x08, 0x43,
+        0x21, 0x38, 0x01, 0x00, 0x33, 0x33, 0x06, 0x43, 0x44, 0x38, 0x07, 0x43, 0x47, 0x44, 0x01, 0x00,
+        0x33, 0x33, 0x06, 0x43, 0x33, 0x33, 0x08, 0x43, 0x39, 0x39, 0x01, 0x00, 0x33, 0x33, 0x06, 0x43,
+        0x33, 0x33, 0x08, 0x43, 0x3c, 0x39, 0x01, 0x00, 0x33, 0x33, 0x06, 0x43, 0x33, 0x33, 0x08, 0x43,
+        0x40, 0x39, 0x01, 0x00, 0x33, 0x33, 0x07, 0x43, 0x44, 0x38, 0x08, 0x43, 0x48, 0x42, 0x01, 0x00,
+        0x33, 0x33, 0x08, 0x43, 0x44, 0x38, 0x09, 0x43, 0x4c, 0x44, 0x01, 0x00, 0x33, 0x33, 0x08, 0x43,
+        0x33, 0x33, 0x0b, 0x43, 0x26, 0x3f, 0x01, 0x00, 0x33, 0x33, 0x09, 0x43, 0x44, 0x38, 0x0a, 0x43,
+        0x4a, 0x42, 0x01, 0x00, 0x33, 0x33, 0x09, 0x43, 0x33, 0x33, 0x0b, 0x43, 0x37, 0x3a, 0x01, 0x00,
+        0x33, 0x33, 0x09, 0x43, 0x33, 0x33, 0x0b, 0x43, 0x3b, 0x3a, 0x01, 0x00, 0x33, 0x33, 0x09, 0x43,
+        0x33, 0x33, 0x0b, 0x43, 0x40, 0x3a, 0x01, 0x00, 0x33, 0x33, 0x0a, 0x43, 0x44, 0x38, 0x0b, 0x43,
+        0x47, 0x3b, 0x01, 0x00, 0x33, 0x33, 0x0b, 0x43, 0x44, 0x38, 0x0c, 0x43, 0x4a, 0x4b, 0x01, 0x00,
+        0x33, 0x33, 0x0b, 0x43, 0x33, 0x33, 0x0e, 0x43, 0x26, 0x46, 0x01, 0x00, 0x33, 0x33, 0x0c, 0x43,
+        0x44, 0x38, 0x0d, 0x43, 0x48, 0x3f, 0x01, 0x00, 0x33, 0x33, 0x0c, 0x43, 0x33, 0x33, 0x0e, 0x43,
+        0x32, 0x40, 0x01, 0x00, 0x33, 0x33, 0x0c, 0x43, 0x33, 0x33, 0x0e, 0x43, 0x37, 0x40, 0x01, 0x00,
+        0x33, 0x33, 0x0c, 0x43, 0x33, 0x33, 0x0e, 0x43, 0x3b, 0x40, 0x01, 0x00, 0x33, 0x33, 0x0c, 0x43,
+        0x33, 0x33, 0x0e, 0x43, 0x40, 0x40, 0x01, 0x00, 0x33, 0x33, 0x0d, 0x43, 0x44, 0x38, 0x0e, 0x43,
+        0x47, 0x40, 0x01, 0x00, 0x33, 0x33, 0x0e, 0x43, 0x33, 0xf3, 0x12, 0x43, 0x4a, 0x4c, 0x01, 0x00,
+        0x33, 0x33, 0x0e, 0x43, 0x33, 0x33, 0x11, 0x43, 0x26, 0x45, 0x01, 0x00, 0x33, 0x33, 0x0f, 0x43,
+        0x33, 0x33, 0x11, 0x43, 0x30, 0x3b, 0x01, 0x00, 0x33, 0x33, 0x0f, 0x43, 0x33, 0x33, 0x11, 0x43,
+        0x34, 0x3b, 0x01, 0x00, 0x33, 0x33, 0x0f, 0x43, 0x33, 0x33, 0x11, 0x43, 0x39, 0x3b, 0x01, 0x00,
+        0x33, 0x33, 0x0f, 0x43, 0x33, 0x33, 0x11, 0x43, 0x3e, 0x3b, 0x01, 0x00, 0x33, 0x33, 0x11, 0x43,
+        0x33, 0x33, 0x14, 0x43, 0x26, 0x46, 0x01, 0x00, 0x33, 0x33, 0x12, 0x43, 0x33, 0x33, 0x14, 0x43,
+        0x30, 0x37, 0x01, 0x00, 0x33, 0x33, 0x12, 0x43, 0x33, 0x33, 0x14, 0x43, 0x36, 0x37, 0x01, 0x00,
+        0x33, 0x33, 0x12, 0x43, 0x33, 0x33, 0x14, 0x43, 0x39, 0x37, 0x01, 0x00, 0x33, 0x33, 0x12, 0x43,
+        0x33, 0x33, 0x14, 0x43, 0x3e, 0x37, 0x01, 0x00, 0x33, 0x33, 0x13, 0x43, 0x44, 0x38, 0x14, 0x43,
+        0x4a, 0x3f, 0x01, 0x00, 0x33, 0x33, 0x14, 0x43, 0x44, 0x38, 0x15, 0x43, 0x4c, 0x47, 0x01, 0x00,
+        0x33, 0x33, 0x14, 0x43, 0x33, 0x33, 0x17, 0x43, 0x26, 0x3f, 0x01, 0x00, 0x33, 0x33, 0x15, 0x43,
+        0x44, 0x38, 0x16, 0x43, 0x4d, 0x46, 0x01, 0x00, 0x33, 0x33, 0x15, 0x43, 0x33, 0x33, 0x17, 0x43,
+        0x39, 0x35, 0x01, 0x00, 0x33, 0x33, 0x15, 0x43, 0x33, 0x33, 0x17, 0x43, 0x3c, 0x35, 0x01, 0x00,
+        0x33, 0x33, 0x15, 0x43, 0x33, 0x33, 0x17, 0x43, 0x41, 0x35, 0x01, 0x00, 0x33, 0x33, 0x16, 0x43,
+        0x44, 0x38, 0x17, 0x43, 0x4f, 0x49, 0x01, 0x00, 0x33, 0x33, 0x17, 0x43, 0x44, 0x38, 0x18, 0x43,
+        0x51, 0x47, 0x01, 0x00, 0x33, 0x33, 0x17, 0x43, 0x33, 0x33, 0x1a, 0x43, 0x26, 0x42, 0x01, 0x00,
+        0x33, 0x33, 0x18, 0x43, 0x44, 0x38, 0x19, 0x43, 0x48, 0x31, 0x01, 0x00, 0x33, 0x33, 0x18, 0x43,
+        0x33, 0x33, 0x1a, 0x43, 0x39, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x18, 0x43, 0x33, 0x33, 0x1a, 0x43,
+        0x3c, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x18, 0x43, 0x33, 0x33, 0x1a, 0x43, 0x40, 0x3d, 0x01, 0x00,
+        0x33, 0x33, 0x19, 0x43, 0x44, 0x38, 0x1a, 0x43, 0x4a, 0x48, 0x01, 0x00, 0x33, 0x33, 0x1a, 0x43,
+        0x44, 0x38, 0x1b, 0x43, 0x4c, 0x4e, 0x01, 0x00, 0x33, 0x33, 0x1a, 0x43, 0x33, 0x33, 0x1d, 0x43,
+        0x26, 0x47, 0x01, 0x00, 0x33, 0x33, 0x1b, 0x43, 0x44, 0x38, 0x1c, 0x43, 0x4a, 0x41, 0x01, 0x00,
+        0x33, 0x33, 0x1b, 0x43, 0x33, 0x33, 0x1d, 0x43, 0x32, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x1b, 0x43,
+        0x33, 0x33, 0x1d, 0x43, 0x37, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x1b, 0x43, 0x33, 0x33, 0x1d, 0x43,
+        0x3b, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x1b, 0x43, 0x33, 0x33, 0x1d, 0x43, 0x40, 0x3d, 0x01, 0x00,
+        0x33, 0x33, 0x1c, 0x43, 0x44, 0x38, 0x1d, 0x43, 0x47, 0x3b, 0x01, 0x00, 0x33, 0x33, 0x1d, 0x43,
+        0x33, 0xf3, 0x21, 0x43, 0x4a, 0x4a, 0x01, 0x00, 0x33, 0x33, 0x1d, 0x43, 0x33, 0x33, 0x20, 0x43,
+        0x26, 0x41, 0x01, 0x00, 0x33, 0x33, 0x1e, 0x43, 0x33, 0x33, 0x20, 0x43, 0x30, 0x39, 0x01, 0x00,
+        0x33, 0x33, 0x1e, 0x43, 0x33, 0x33, 0x20, 0x43, 0x34, 0x39, 0x01, 0x00, 0x33, 0x33, 0x1e, 0x43,
+        0x33, 0x33, 0x20, 0x43, 0x39, 0x39, 0x01, 0x00, 0x33, 0x33, 0x1e, 0x43, 0x33, 0x33, 0x20, 0x43,
+        0x3e, 0x39, 0x01, 0x00, 0x33, 0x33, 0x20, 0x43, 0x33, 0x33, 0x23, 0x43, 0x26, 0x3c, 0x01, 0x00,
+        0x33, 0x33, 0x21, 0x43, 0x33, 0x33, 0x23, 0x43, 0x30, 0x33, 0x01, 0x00, 0x33, 0x33, 0x21, 0x43,
+        0x33, 0x33, 0x23, 0x43, 0x36, 0x33, 0x01, 0x00, 0x33, 0x33, 0x21, 0x43, 0x33, 0x33, 0x23, 0x43,
+        0x39, 0x33, 0x01, 0x00, 0x33, 0x33, 0x21, 0x43, 0x33, 0x33, 0x23, 0x43, 0x3e, 0x33, 0x01, 0x00,
+        0x33, 0x33, 0x22, 0x43, 0x44, 0x38, 0x23, 0x43, 0x4a, 0x41, 0x01, 0x00, 0x33, 0x33, 0x23, 0x43,
+        0x55, 0x51, 0x26, 0x43, 0x4f, 0x47, 0x01, 0x00, 0x33, 0x33, 0x23, 0x43, 0x33, 0x33, 0x26, 0x43,
+        0x28, 0x43, 0x01, 0x00, 0x33, 0x33, 0x24, 0x43, 0x33, 0x33, 0x26, 0x43, 0x3b, 0x3a, 0x01, 0x00,
+        0x33, 0x33, 0x24, 0x43, 0x33, 0x33, 0x26, 0x43, 0x40, 0x3a, 0x01, 0x00, 0x33, 0x33, 0x24, 0x43,
+        0x33, 0x33, 0x26, 0x43, 0x43, 0x3a, 0x01, 0x00, 0x33, 0x33, 0x26, 0x43, 0x55, 0x51, 0x29, 0x43,
+        0x4d, 0x42, 0x01, 0x00, 0x33, 0x33, 0x26, 0x43, 0x33, 0x33, 0x29, 0x43, 0x28, 0x47, 0x01, 0x00,
+        0x33, 0x33, 0x27, 0x43, 0x33, 0x33, 0x29, 0x43, 0x39, 0x42, 0x01, 0x00, 0x33, 0x33, 0x27, 0x43,
+        0x33, 0x33, 0x29, 0x43, 0x3e, 0x42, 0x01, 0x00, 0x33, 0x33, 0x27, 0x43, 0x33, 0x33, 0x29, 0x43,
+        0x41, 0x42, 0x01, 0x00, 0x33, 0x33, 0x27, 0x43, 0x33, 0x33, 0x29, 0x43, 0x45, 0x42, 0x01, 0x00,
+        0x33, 0x33, 0x29, 0x43, 0x55, 0x3d, 0x2a, 0x43, 0x47, 0x37, 0x01, 0x00, 0x33, 0x33, 0x29, 0x43,
+        0x33, 0x33, 0x2c, 0x43, 0x28, 0x48, 0x01, 0x00, 0x33, 0x33, 0x2a, 0x43, 0x55, 0x3d, 0x2b, 0x43,
+        0x48, 0x47, 0x01, 0x00, 0x33, 0x33, 0x2a, 0x43, 0x33, 0x33, 0x2c, 0x43, 0x39, 0x3f, 0x01, 0x00,
+        0x33, 0x33, 0x2a, 0x43, 0x33, 0x33, 0x2c, 0x43, 0x3c, 0x3f, 0x01, 0x00, 0x33, 0x33, 0x2a, 0x43,
+        0x33, 0x33, 0x2c, 0x43, 0x41, 0x3f, 0x01, 0x00, 0x33, 0x33, 0x2b, 0x43, 0x55, 0x3d, 0x2c, 0x43,
+        0x4d, 0x51, 0x01, 0x00, 0x33, 0x33, 0x2c, 0x43, 0x55, 0x3d, 0x2d, 0x43, 0x4c, 0x47, 0x01, 0x00,
+        0x33, 0x33, 0x2c, 0x43, 0x33, 0x33, 0x2f, 0x43, 0x28, 0x44, 0x01, 0x00, 0x33, 0x33, 0x2d, 0x43,
+        0x55, 0x3d, 0x2e, 0x43, 0x4a, 0x43, 0x01, 0x00, 0x33, 0x33, 0x2d, 0x43, 0x33, 0x33, 0x2f, 0x43,
+        0x3c, 0x40, 0x01, 0x00, 0x33, 0x33, 0x2d, 0x43, 0x33, 0x33, 0x2f, 0x43, 0x40, 0x40, 0x01, 0x00,
+        0x33, 0x33, 0x2d, 0x43, 0x33, 0x33, 0x2f, 0x43, 0x45, 0x40, 0x01, 0x00, 0x33, 0x33, 0x2e, 0x43,
+        0x55, 0x3d, 0x2f, 0x43, 0x48, 0x42, 0x01, 0x00, 0x33, 0x33, 0x2f, 0x43, 0x55, 0x3d, 0x30, 0x43,
+        0x4c, 0x47, 0x01, 0x00, 0x33, 0x33, 0x2f, 0x43, 0x33, 0x33, 0x32, 0x43, 0x28, 0x46, 0x01, 0x00,
+        0x33, 0x33, 0x30, 0x43, 0x55, 0x3d, 0x31, 0x43, 0x4a, 0x42, 0x01, 0x00, 0x33, 0x33, 0x30, 0x43,
+        0x33, 0x33, 0x32, 0x43, 0x39, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x30, 0x43, 0x33, 0x33, 0x32, 0x43,
+        0x3c, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x30, 0x43, 0x33, 0x33, 0x32, 0x43, 0x45, 0x3d, 0x01, 0x00,
+        0x33, 0x33, 0x31, 0x43, 0x55, 0x3d, 0x32, 0x43, 0x48, 0x3d, 0x01, 0x00, 0x33, 0x33, 0x32, 0x43,
+        0x33, 0x33, 0x32, 0x43, 0x41, 0x38, 0x01, 0x00, 0x33, 0x33, 0x32, 0x43, 0x33, 0x33, 0x35, 0x43,
+        0x28, 0x45, 0x01, 0x00, 0x33, 0x33, 0x33, 0x43, 0x44, 0x38, 0x34, 0x43, 0x2f, 0x40, 0x01, 0x00,
+        0x33, 0x33, 0x33, 0x43, 0x44, 0x38, 0x34, 0x43, 0x39, 0x40, 0x01, 0x00, 0x33, 0x33, 0x33, 0x43,
+        0x33, 0x33, 0x34, 0x43, 0x3e, 0x40, 0x01, 0x00, 0x33, 0x33, 0x34, 0x43, 0x55, 0x3d, 0x35, 0x43,
+        0x43, 0x46, 0x01, 0x00, 0x33, 0x33, 0x34, 0x43, 0x44, 0x38, 0x35, 0x43, 0x34, 0x42, 0x01, 0x00,
+        0x33, 0x33, 0x34, 0x43, 0x44, 0x38, 0x35, 0x43, 0x3b, 0x42, 0x01, 0x00, 0x33, 0x33, 0x34, 0x43,
+        0x44, 0x38, 0x35, 0x43, 0x3e, 0x42, 0x01, 0x00, 0x33, 0x33, 0x35, 0x43, 0x33, 0xe7, 0x37, 0x43,
+        0x48, 0x54, 0x01, 0x00, 0x33, 0x33, 0x35, 0x43, 0x44, 0x0c, 0x38, 0x43, 0x3c, 0x52, 0x01, 0x00,
+        0x33, 0x33, 0x35, 0x43, 0x44, 0x0c, 0x38, 0x43, 0x40, 0x52, 0x01, 0x00, 0x33, 0x33, 0x35, 0x43,
+        0x44, 0x0c, 0x38, 0x43, 0x45, 0x52, 0x01, 0x00, 0x33, 0x33, 0x35, 0x43, 0x44, 0x0c, 0x38, 0x43,
+        0x2d, 0x50, 0x01, 0x00, 0x33, 0x33, 0x35, 0x43, 0x44, 0x0c, 0x38, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x33, 0x33, 0x38, 0x43, 0x33, 0x33, 0x3b, 0x43, 0x4a, 0x46, 0x01, 0x00, 0x33, 0x33, 0x38, 0x43,
+        0x33, 0x33, 0x3b, 0x43, 0x3e, 0x47, 0x01, 0x00, 0x33, 0x33, 0x38, 0x43, 0x33, 0x33, 0x3b, 0x43,
+        0x41, 0x47, 0x01, 0x00, 0x33, 0x33, 0x38, 0x43, 0x33, 0x33, 0x3b, 0x43, 0x45, 0x47, 0x01, 0x00,
+        0x33, 0x33, 0x38, 0x43, 0x33, 0x33, 0x3b, 0x43, 0x26, 0x40, 0x01, 0x00, 0x33, 0x33, 0x38, 0x43,
+        0x33, 0x33, 0x3b, 0x43, 0x2d, 0x40, 0x01, 0x00, 0x33, 0x33, 0x38, 0x43, 0x33, 0x33, 0x3b, 0x43,
+        0x32, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3e, 0x4c, 0x24, 0x01, 0x00,
+        0xcd, 0xcc, 0x4c, 0x3e, 0x66, 0x66, 0xce, 0x3e, 0x4b, 0x21, 0x01, 0x00, 0xcd, 0xcc, 0xcc, 0x3e,
+        0x66, 0x66, 0x1a, 0x3f, 0x4c, 0x2d, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x3f, 0x9a, 0x99, 0x4d, 0x3f,
+        0x4b, 0x2b, 0x01, 0x00, 0xcd, 0xcc, 0x4c, 0x3f, 0x66, 0x66, 0x80, 0x3f, 0x4c, 0x32, 0x01, 0x00,
+        0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x9a, 0x3f, 0x47, 0x27, 0x01, 0x00, 0x9a, 0x99, 0x99, 0x3f,
+        0x9a, 0x99, 0xb3, 0x3f, 0x4a, 0x2e, 0x01, 0x00, 0x33, 0x33, 0xb3, 0x3f, 0x33, 0x33, 0xcd, 0x3f,
+        0x48, 0x2c, 0x01, 0x00, 0xcd, 0xcc, 0xcc, 0x3f, 0x33, 0x33, 0xfd, 0x3f, 0x45, 0x27, 0x01, 0x00,
+        0xcd, 0xcc, 0xcc, 0x3f, 0xcd, 0xcc, 0xe6, 0x3f, 0x2d, 0x27, 0x01, 0x00, 0x66, 0x66, 0xe6, 0x3f,
+        0x33, 0x33, 0x00, 0x40, 0x34, 0x27, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0c, 0x40,
+        0x39, 0x2f, 0x01, 0x00, 0xcd, 0xcc, 0x0c, 0x40, 0xcd, 0xcc, 0x19, 0x40, 0x3c, 0x2d, 0x01, 0x00,
+        0x9a, 0x99, 0x19, 0x40, 0x9a, 0x99, 0x26, 0x40, 0x40, 0x33, 0x01, 0x00, 0x66, 0x66, 0x26, 0x40,
+        0x66, 0x66, 0x33, 0x40, 0x45, 0x2e, 0x01, 0x00, 0x33, 0x33, 0x33, 0x40, 0x66, 0x66, 0x4b, 0x40,
+        0x47, 0x36, 0x01, 0x00, 0x33, 0x33, 0x33, 0x40, 0x33, 0x33, 0x40, 0x40, 0x28, 0x28, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x4d, 0x40, 0x34, 0x2b, 0x01, 0x00, 0xcd, 0xcc, 0x4c, 0x40,
+        0xcd, 0xcc, 0x58, 0x40, 0x38, 0x30, 0x01, 0x00, 0x9a, 0x99, 0x59, 0x40, 0x9a, 0x99, 0x66, 0x40,
+        0x40, 0x24, 0x01, 0x00, 0x66, 0x66, 0x66, 0x40, 0x66, 0x66, 0x73, 0x40, 0x44, 0x2a, 0x01, 0x00,
+        0x33, 0x33, 0x73, 0x40, 0x9a, 0x19, 0x80, 0x40, 0x47, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x80, 0x40,
+        0x9a, 0x19, 0x8c, 0x40, 0x48, 0x2e, 0x01, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x80, 0x86, 0x40,
+        0x2d, 0x29, 0x01, 0x00, 0x66, 0x66, 0x86, 0x40, 0x66, 0xe6, 0x8c, 0x40, 0x34, 0x2a, 0x01, 0x00,
+        0xcd, 0xcc, 0x8c, 0x40, 0xcd, 0xcc, 0x92, 0x40, 0x39, 0x2d, 0x01, 0x00, 0x33, 0x33, 0x93, 0x40,
+        0x33, 0xb3, 0x99, 0x40, 0x40, 0x23, 0x01, 0x00, 0x9a, 0x99, 0x99, 0x40, 0x9a, 0x19, 0xa0, 0x40,
+        0x4c, 0x28, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x80, 0xa6, 0x40, 0x4b, 0x26, 0x01, 0x00,
+        0x66, 0x66, 0xa6, 0x40, 0x66, 0xe6, 0xac, 0x40, 0x4c, 0x26, 0x01, 0x00, 0xcd, 0xcc, 0xac, 0x40,
+        0xcd, 0x4c, 0xb3, 0x40, 0x4b, 0x28, 0x01, 0x00, 0x33, 0x33, 0xb3, 0x40, 0x33, 0xb3, 0xb9, 0x40,
+        0x4c, 0x2b, 0x01, 0x00, 0x9a, 0x99, 0xb9, 0x40, 0x9a, 0x19, 0xc0, 0x40, 0x47, 0x2a, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x40, 0x00, 0x80, 0xc6, 0x40, 0x4a, 0x2d, 0x01, 0x00, 0x66, 0x66, 0xc6, 0x40,
+        0x66, 0xe6, 0xcc, 0x40, 0x48, 0x27, 0x01, 0x00, 0xcd, 0xcc, 0xcc, 0x40, 0x66, 0xe6, 0xd8, 0x40,
+        0x45, 0x26, 0x01, 0x00, 0xcd, 0xcc, 0xcc, 0x40, 0xcd, 0x4c, 0xd3, 0x40, 0x2d, 0x27, 0x01, 0x00,
+        0x33, 0x33, 0xd3, 0x40, 0x33, 0xb3, 0xd9, 0x40, 0x34, 0x2a, 0x01, 0x00, 0x9a, 0x99, 0xd9, 0x40,
+        0x9a, 0x99, 0xdf, 0x40, 0x39, 0x34, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x80, 0xe6, 0x40,
+        0x3c, 0x24, 0x01, 0x00, 0x66, 0x66, 0xe6, 0x40, 0x66, 0xe6, 0xec, 0x40, 0x40, 0x28, 0x01, 0x00,
+        0xcd, 0xcc, 0xec, 0x40, 0xcd, 0x4c, 0xf3, 0x40, 0x45, 0x33, 0x01, 0x00, 0x33, 0x33, 0xf3, 0x40,
+        0xcd, 0x4c, 0xff, 0x40, 0x47, 0x3d, 0x01, 0x00, 0x33, 0x33, 0xf3, 0x40, 0x33, 0xb3, 0xf9, 0x40,
+        0x28, 0x26, 0x01, 0x00, 0x9a, 0x99, 0xf9, 0x40, 0xcd, 0x0c, 0x00, 0x41, 0x34, 0x2b, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x03, 0x41, 0x38, 0x2e, 0x01, 0x00, 0x33, 0x33, 0x03, 0x41,
+        0x33, 0x73, 0x06, 0x41, 0x3e, 0x2c, 0x01, 0x00, 0x66, 0x66, 0x06, 0x41, 0x66, 0xa6, 0x09, 0x41,
+        0x48, 0x39, 0x01, 0x00, 0x9a, 0x99, 0x09, 0x41, 0x9a, 0xd9, 0x0c, 0x41, 0x47, 0x2b, 0x01, 0x00,
+        0xcd, 0xcc, 0x0c, 0x41, 0x33, 0xf3, 0x18, 0x41, 0x45, 0x2a, 0x01, 0x00, 0xcd, 0xcc, 0x0c, 0x41,
+        0xcd, 0x0c, 0x10, 0x41, 0x2d, 0x27, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0x00, 0x40, 0x13, 0x41,
+        0x34, 0x29, 0x01, 0x00, 0x33, 0x33, 0x13, 0x41, 0x33, 0x33, 0x16, 0x41, 0x39, 0x33, 0x01, 0x00,
+        0x9a, 0x99, 0x19, 0x41, 0x9a, 0xd9, 0x1c, 0x41, 0x4c, 0x2c, 0x01, 0x00, 0xcd, 0xcc, 0x1c, 0x41,
+        0xcd, 0x0c, 0x20, 0x41, 0x4b, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x40, 0x23, 0x41,
+        0x4c, 0x32, 0x01, 0x00, 0x33, 0x33, 0x23, 0x41, 0x33, 0x73, 0x26, 0x41, 0x4b, 0x32, 0x01, 0x00,
+        0x66, 0x66, 0x26, 0x41, 0x66, 0xa6, 0x29, 0x41, 0x4c, 0x2c, 0x01, 0x00, 0x9a, 0x99, 0x29, 0x41,
+        0x9a, 0xd9, 0x2c, 0x41, 0x47, 0x24, 0x01, 0x00, 0xcd, 0xcc, 0x2c, 0x41, 0xcd, 0x0c, 0x30, 0x41,
+        0x4a, 0x2f, 0x01, 0x00, 0x00, 0x00, 0x30, 0x41, 0x00, 0x40, 0x33, 0x41, 0x48, 0x2b, 0x01, 0x00,
+        0x33, 0x33, 0x33, 0x41, 0x00, 0x40, 0x39, 0x41, 0x45, 0x2b, 0x01, 0x00, 0x33, 0x33, 0x33, 0x41,
+        0x33, 0x73, 0x36, 0x41, 0x2d, 0x25, 0x01, 0x00, 0x66, 0x66, 0x36, 0x41, 0x66, 0xa6, 0x39, 0x41,
+        0x34, 0x2c, 0x01, 0x00, 0x9a, 0x99, 0x39, 0x41, 0x9a, 0x99, 0x3c, 0x41, 0x39, 0x31, 0x01, 0x00,
+        0xcd, 0xcc, 0x3c, 0x41, 0xcd, 0x0c, 0x40, 0x41, 0x3c, 0x26, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41,
+        0x00, 0x40, 0x43, 0x41, 0x40, 0x29, 0x01, 0x00, 0x33, 0x33, 0x43, 0x41, 0x33, 0x73, 0x46, 0x41,
+        0x45, 0x32, 0x01, 0x00, 0x66, 0x66, 0x46, 0x41, 0x33, 0x73, 0x4c, 0x41, 0x47, 0x3c, 0x01, 0x00,
+        0x66, 0x66, 0x46, 0x41, 0x66, 0xa6, 0x49, 0x41, 0x28, 0x2b, 0x01, 0x00, 0x9a, 0x99, 0x49, 0x41,
+        0x9a, 0xd9, 0x4c, 0x41, 0x34, 0x30, 0x01, 0x00, 0xcd, 0xcc, 0x4c, 0x41, 0xcd, 0xcc, 0x4f, 0x41,
+        0x38, 0x35, 0x01, 0x00, 0x00, 0x00, 0x50, 0x41, 0x00, 0x40, 0x53, 0x41, 0x40, 0x24, 0x01, 0x00,
+        0x33, 0x33, 0x53, 0x41, 0x33, 0x73, 0x56, 0x41, 0x44, 0x23, 0x01, 0x00, 0x66, 0x66, 0x56, 0x41,
+        0x66, 0xa6, 0x59, 0x41, 0x47, 0x33, 0x01, 0x00, 0x9a, 0x99, 0x59, 0x41, 0x66, 0xa6, 0x5f, 0x41,
+        0x48, 0x31, 0x01, 0x00, 0x9a, 0x99, 0x59, 0x41, 0x9a, 0xd9, 0x5c, 0x41, 0x2d, 0x24, 0x01, 0x00,
+        0xcd, 0xcc, 0x5c, 0x41, 0xcd, 0x0c, 0x60, 0x41, 0x34, 0x25, 0x01, 0x00, 0x00, 0x00, 0x60, 0x41,
+        0x00, 0x00, 0x63, 0x41, 0x39, 0x2f, 0x01, 0x00, 0x33, 0x33, 0x63, 0x41, 0x33, 0x73, 0x66, 0x41,
+        0x40, 0x28, 0x01, 0x00, 0x66, 0x66, 0x66, 0x41, 0x66, 0xa6, 0x69, 0x41, 0x4c, 0x32, 0x01, 0x00,
+        0x9a, 0x99, 0x69, 0x41, 0x9a, 0xd9, 0x6c, 0x41, 0x4b, 0x2b, 0x01, 0x00, 0xcd, 0xcc, 0x6c, 0x41,
+        0xcd, 0x0c, 0x70, 0x41, 0x4c, 0x32, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x00, 0x40, 0x73, 0x41,
+        0x4b, 0x23, 0x01, 0x00, 0x33, 0x33, 0x73, 0x41, 0x33, 0x73, 0x76, 0x41, 0x4c, 0x28, 0x01, 0x00,
+        0x66, 0x66, 0x76, 0x41, 0x66, 0xa6, 0x79, 0x41, 0x47, 0x28, 0x01, 0x00, 0x9a, 0x99, 0x79, 0x41,
+        0x9a, 0xd9, 0x7c, 0x41, 0x4a, 0x2b, 0x01, 0x00, 0xcd, 0xcc, 0x7c, 0x41, 0x66, 0x06, 0x80, 0x41,
+        0x48, 0x26, 0x01, 0x00, 0x00, 0x00, 0x80, 0x41, 0x66, 0x06, 0x83, 0x41, 0x45, 0x1d, 0x01, 0x00,
+        0x00, 0x00, 0x80, 0x41, 0x00, 0xa0, 0x81, 0x41, 0x2d, 0x27, 0x01, 0x00, 0x9a, 0x99, 0x81, 0x41,
+        0x9a, 0x39, 0x83, 0x41, 0x34, 0x2d, 0x01, 0x00, 0x33, 0x33, 0x83, 0x41, 0x33, 0xb3, 0x84, 0x41,
+        0x39, 0x2b, 0x01, 0x00, 0xcd, 0xcc, 0x84, 0x41, 0xcd, 0x6c, 0x86, 0x41, 0x3c, 0x29, 0x01, 0x00,
+        0x66, 0x66, 0x86, 0x41, 0x66, 0x06, 0x88, 0x41, 0x40, 0x2d, 0x01, 0x00, 0x00, 0x00, 0x88, 0x41,
+        0x00, 0xa0, 0x89, 0x41, 0x45, 0x31, 0x01, 0x00, 0x9a, 0x99, 0x89, 0x41, 0x00, 0xa0, 0x8c, 0x41,
+        0x47, 0x35, 0x01, 0x00, 0x9a, 0x99, 0x89, 0x41, 0x9a, 0x39, 0x8b, 0x41, 0x28, 0x27, 0x01, 0x00,
+        0x33, 0x33, 0x8b, 0x41, 0x33, 0xd3, 0x8c, 0x41, 0x34, 0x2f, 0x01, 0x00, 0xcd, 0xcc, 0x8c, 0x41,
+        0xcd, 0x4c, 0x8e, 0x41, 0x38, 0x2d, 0x01, 0x00, 0x66, 0x66, 0x8e, 0x41, 0x66, 0x06, 0x90, 0x41,
+        0x3e, 0x23, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41, 0x00, 0xa0, 0x91, 0x41, 0x48, 0x28, 0x01, 0x00,
+        0x9a, 0x99, 0x91, 0x41, 0x9a, 0x39, 0x93, 0x41, 0x47, 0x2f, 0x01, 0x00, 0x33, 0x33, 0x93, 0x41,
+        0x9a, 0x39, 0x96, 0x41, 0x45, 0x27, 0x01, 0x00, 0x33, 0x33, 0x93, 0x41, 0x33, 0xd3, 0x94, 0x41,
+        0x2d, 0x29, 0x01, 0x00, 0xcd, 0xcc, 0x94, 0x41, 0xcd, 0x6c, 0x96, 0x41, 0x34, 0x2e, 0x01, 0x00,
+        0x66, 0x66, 0x96, 0x41, 0x66, 0xe6, 0x97, 0x41, 0x39, 0x31, 0x01, 0x00, 0x00, 0x00, 0x98, 0x41,
+        0x00, 0xa0, 0x99, 0x41, 0x47, 0x35, 0x01, 0x00, 0x9a, 0x99, 0x99, 0x41, 0x9a, 0x39, 0x9b, 0x41,
+        0x48, 0x43, 0x01, 0x00, 0x33, 0x33, 0x9b, 0x41, 0x33, 0xd3, 0x9c, 0x41, 0x4a, 0x55, 0x01, 0x00,
+        0xcd, 0xcc, 0x9c, 0x41, 0x9a, 0x59, 0xa1, 0x41, 0x4c, 0x52, 0x01, 0x00, 0xcd, 0xcc, 0x9c, 0x41,
+        0xcd, 0x6c, 0x9e, 0x41, 0x30, 0x4b, 0x01, 0x00, 0x66, 0x66, 0x9e, 0x41, 0x66, 0x06, 0xa0, 0x41,
+        0x37, 0x4f, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x80, 0xa1, 0x41, 0x3c, 0x58, 0x01, 0x00,
+        0x9a, 0x99, 0xa1, 0x41, 0x9a, 0x39, 0xa3, 0x41, 0x43, 0x40, 0x01, 0x00, 0x33, 0x33, 0xa3, 0x41,
+        0x33, 0xd3, 0xa4, 0x41, 0x4d, 0x4d, 0x01, 0x00, 0xcd, 0xcc, 0xa4, 0x41, 0xcd, 0x6c, 0xa6, 0x41,
+        0x4c, 0x55, 0x01, 0x00, 0x66, 0x66, 0xa6, 0x41, 0x33, 0xf3, 0xaa, 0x41, 0x4a, 0x50, 0x01, 0x00,
+        0x66, 0x66, 0xa6, 0x41, 0x66, 0x06, 0xa8, 0x41, 0x2b, 0x4a, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41,
+        0x00, 0xa0, 0xa9, 0x41, 0x37, 0x55, 0x01, 0x00, 0x9a, 0x99, 0xa9, 0x41, 0x9a, 0x19, 0xab, 0x41,
+        0x3b, 0x5a, 0x01, 0x00, 0x33, 0x33, 0xab, 0x41, 0x33, 0xd3, 0xac, 0x41, 0x41, 0x40, 0x01, 0x00,
+        0xcd, 0xcc, 0xac, 0x41, 0xcd, 0x6c, 0xae, 0x41, 0x4c, 0x50, 0x01, 0x00, 0x66, 0x66, 0xae, 0x41,
+        0x66, 0x06, 0xb0, 0x41, 0x4a, 0x4c, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x41, 0xcd, 0x8c, 0xb4, 0x41,
+        0x48, 0x46, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x41, 0x00, 0xa0, 0xb1, 0x41, 0x2d, 0x44, 0x01, 0x00,
+        0x9a, 0x99, 0xb1, 0x41, 0x9a, 0x39, 0xb3, 0x41, 0x34, 0x48, 0x01, 0x00, 0x33, 0x33, 0xb3, 0x41,
+        0x33, 0xb3, 0xb4, 0x41, 0x39, 0x4d, 0x01, 0x00, 0xcd, 0xcc, 0xb4, 0x41, 0xcd, 0x6c, 0xb6, 0x41,
+        0x40, 0x36, 0x01, 0x00, 0x66, 0x66, 0xb6, 0x41, 0x66, 0x06, 0xb8, 0x41, 0x4a, 0x44, 0x01, 0x00,
+        0x00, 0x00, 0xb8, 0x41, 0x00, 0xa0, 0xb9, 0x41, 0x48, 0x47, 0x01, 0x00, 0x9a, 0x99, 0xb9, 0x41,
+        0x00, 0xa0, 0xbc, 0x41, 0x47, 0x3a, 0x01, 0x00, 0x9a, 0x99, 0xb9, 0x41, 0x66, 0x66, 0xba, 0x41,
+        0x28, 0x30, 0x01, 0x00, 0x33, 0x33, 0xbb, 0x41, 0x33, 0xd3, 0xbc, 0x41, 0x34, 0x45, 0x01, 0x00,
+        0xcd, 0xcc, 0xbc, 0x41, 0xcd, 0x4c, 0xbe, 0x41, 0x40, 0x57, 0x01, 0x00, 0x66, 0x66, 0xbe, 0x41,
+        0x66, 0x06, 0xc0, 0x41, 0x40, 0x35, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x80, 0xc1, 0x41,
+        0x4c, 0x40, 0x01, 0x00, 0x9a, 0x99, 0xc1, 0x41, 0x42, 0x3a, 0xc3, 0x41, 0x40, 0x36, 0x01, 0x00,
+        0x33, 0x33, 0xc3, 0x41, 0xba, 0xda, 0xc4, 0x41, 0x4c, 0x43, 0x01, 0x00, 0xf7, 0xf6, 0xc4, 0x41,
+        0xc9, 0xc1, 0xc6, 0x41, 0x4c, 0x31, 0x01, 0x00, 0xba, 0xba, 0xc6, 0x41, 0x42, 0x62, 0xc8, 0x41,
+        0x58, 0x3c, 0x01, 0x00, 0x7e, 0x7e, 0xc8, 0x41, 0x50, 0x49, 0xca, 0x41, 0x4b, 0x30, 0x01, 0x00,
+        0x41, 0x42, 0xca, 0x41, 0xc9, 0xe9, 0xcb, 0x41, 0x4c, 0x37, 0x01, 0x00, 0x05, 0x06, 0xcc, 0x41,
+        0xd7, 0xd0, 0xcd, 0x41, 0x4b, 0x2c, 0x01, 0x00, 0xc8, 0xc9, 0xcd, 0x41, 0x50, 0x71, 0xcf, 0x41,
+        0x4c, 0x31, 0x01, 0x00, 0x8c, 0x8d, 0xcf, 0x41, 0x5e, 0x58, 0xd1, 0x41, 0x4b, 0x2d, 0x01, 0x00,
+        0x4f, 0x51, 0xd1, 0x41, 0xd7, 0xf8, 0xd2, 0x41, 0x4c, 0x2b, 0x01, 0x00, 0x13, 0x15, 0xd3, 0x41,
+        0xe5, 0xdf, 0xd4, 0x41, 0x4b, 0x23, 0x01, 0x00, 0xd6, 0xd8, 0xd4, 0x41, 0xa9, 0xa3, 0xd6, 0x41,
+        0x4c, 0x21, 0x01, 0x00, 0x9a, 0x9c, 0xd6, 0x41, 0x6c, 0x67, 0xd8, 0x41, 0x4b, 0x24, 0x01, 0x00,
+        0x5d, 0x60, 0xd8, 0x41, 0x30, 0x2b, 0xda, 0x41, 0x4c, 0x26, 0x01, 0x00, 0x21, 0x24, 0xda, 0x41,
+        0xf3, 0xee, 0xdb, 0x41, 0x4b, 0x2a, 0x01, 0x00, 0xe4, 0xe7, 0xdb, 0x41, 0x0e, 0xb2, 0xdd, 0x41,
+        0x4c, 0x2a, 0x01, 0x00, 0xa8, 0xab, 0xdd, 0x41, 0xa8, 0x4b, 0xdf, 0x41, 0x47, 0x29, 0x01, 0x00,
+        0x41, 0x45, 0xdf, 0x41, 0x41, 0xe5, 0xe0, 0x41, 0x4a, 0x2b, 0x01, 0x00, 0xdb, 0xde, 0xe0, 0x41,
+        0xdb, 0x7e, 0xe2, 0x41, 0x48, 0x29, 0x01, 0x00, 0x75, 0x78, 0xe2, 0x41, 0xdb, 0x7e, 0xe5, 0x41,
+        0x45, 0x24, 0x01, 0x00, 0x75, 0x78, 0xe2, 0x41, 0x75, 0x18, 0xe4, 0x41, 0x2d, 0x25, 0x01, 0x00,
+        0x0e, 0x12, 0xe4, 0x41, 0x0e, 0xb2, 0xe5, 0x41, 0x34, 0x28, 0x01, 0x00, 0xa8, 0xab, 0xe5, 0x41,
+        0xa8, 0x2b, 0xe7, 0x41, 0x39, 0x29, 0x01, 0x00, 0x41, 0x45, 0xe7, 0x41, 0x41, 0xe5, 0xe8, 0x41,
+        0x3c, 0x25, 0x01, 0x00, 0xdb, 0xde, 0xe8, 0x41, 0xdb, 0x7e, 0xea, 0x41, 0x40, 0x29, 0x01, 0x00,
+        0x75, 0x78, 0xea, 0x41, 0x75, 0x18, 0xec, 0x41, 0x45, 0x2f, 0x01, 0x00, 0x0e, 0x12, 0xec, 0x41,
+        0x75, 0x18, 0xef, 0x41, 0x47, 0x33, 0x01, 0x00, 0x0e, 0x12, 0xec, 0x41, 0x0e, 0xb2, 0xed, 0x41,
+        0x28, 0x25, 0x01, 0x00, 0xa8, 0xab, 0xed, 0x41, 0xa8, 0x4b, 0xef, 0x41, 0x34, 0x27, 0x01, 0x00,
+        0x41, 0x45, 0xef, 0x41, 0x41, 0xc5, 0xf0, 0x41, 0x38, 0x30, 0x01, 0x00, 0xdb, 0xde, 0xf0, 0x41,
+        0xdb, 0x7e, 0xf2, 0x41, 0x40, 0x22, 0x01, 0x00, 0x75, 0x78, 0xf2, 0x41, 0x75, 0x18, 0xf4, 0x41,
+        0x44, 0x25, 0x01, 0x00, 0x0e, 0x12, 0xf4, 0x41, 0x0e, 0xb2, 0xf5, 0x41, 0x47, 0x2e, 0x01, 0x00,
+        0xa8, 0xab, 0xf5, 0x41, 0x0e, 0xb2, 0xf8, 0x41, 0x48, 0x30, 0x01, 0x00, 0xa8, 0xab, 0xf5, 0x41,
+        0xa8, 0x4b, 0xf7, 0x41, 0x2d, 0x26, 0x01, 0x00, 0x41, 0x45, 0xf7, 0x41, 0x41, 0xe5, 0xf8, 0x41,
+        0x34, 0x29, 0x01, 0x00, 0xdb, 0xde, 0xf8, 0x41, 0xdb, 0x5e, 0xfa, 0x41, 0x39, 0x2b, 0x01, 0x00,
+        0x75, 0x78, 0xfa, 0x41, 0x75, 0x18, 0xfc, 0x41, 0x40, 0x27, 0x01, 0x00, 0x0e, 0x12, 0xfc, 0x41,
+        0x0e, 0xb2, 0xfd, 0x41, 0x4c, 0x30, 0x01, 0x00, 0xa8, 0xab, 0xfd, 0x41, 0xa8, 0x4b, 0xff, 0x41,
+        0x4b, 0x2a, 0x01, 0x00, 0x41, 0x45, 0xff, 0x41, 0xa1, 0x72, 0x00, 0x42, 0x4c, 0x2b, 0x01, 0x00,
+        0x6e, 0x6f, 0x00, 0x42, 0x6e, 0x3f, 0x01, 0x42, 0x4b, 0x2c, 0x01, 0x00, 0x3a, 0x3c, 0x01, 0x42,
+        0x3a, 0x0c, 0x02, 0x42, 0x4c, 0x30, 0x01, 0x00, 0x07, 0x09, 0x02, 0x42, 0x07, 0xd9, 0x02, 0x42,
+        0x47, 0x2a, 0x01, 0x00, 0xd4, 0xd5, 0x02, 0x42, 0xd4, 0xa5, 0x03, 0x42, 0x4a, 0x2d, 0x01, 0x00,
+        0xa1, 0xa2, 0x03, 0x42, 0xa1, 0x72, 0x04, 0x42, 0x48, 0x29, 0x01, 0x00, 0x6e, 0x6f, 0x04, 0x42,
+        0xa1, 0xf2, 0x05, 0x42, 0x45, 0x26, 0x01, 0x00, 0x6e, 0x6f, 0x04, 0x42, 0x6e, 0x3f, 0x05, 0x42,
+        0x2d, 0x23, 0x01, 0x00, 0x3a, 0x3c, 0x05, 0x42, 0x3a, 0x0c, 0x06, 0x42, 0x34, 0x26, 0x01, 0x00,
+        0x07, 0x09, 0x06, 0x42, 0x07, 0xc9, 0x06, 0x42, 0x39, 0x30, 0x01, 0x00, 0xd4, 0xd5, 0x06, 0x42,
+        0xd4, 0xa5, 0x07, 0x42, 0x3c, 0x2a, 0x01, 0x00, 0xa1, 0xa2, 0x07, 0x42, 0xa1, 0x72, 0x08, 0x42,
+        0x40, 0x2a, 0x01, 0x00, 0x6e, 0x6f, 0x08, 0x42, 0x6e, 0x3f, 0x09, 0x42, 0x45, 0x32, 0x01, 0x00,
+        0x3a, 0x3c, 0x09, 0x42, 0x6e, 0xbf, 0x0a, 0x42, 0x47, 0x34, 0x01, 0x00, 0x3a, 0x3c, 0x09, 0x42,
+        0x3a, 0x0c, 0x0a, 0x42, 0x28, 0x25, 0x01, 0x00, 0x07, 0x09, 0x0a, 0x42, 0x07, 0xd9, 0x0a, 0x42,
+        0x34, 0x27, 0x01, 0x00, 0xd4, 0xd5, 0x0a, 0x42, 0xd4, 0x95, 0x0b, 0x42, 0x38, 0x2d, 0x01, 0x00,
+        0xa1, 0xa2, 0x0b, 0x42, 0xa1, 0x72, 0x0c, 0x42, 0x3e, 0x29, 0x01, 0x00, 0x6e, 0x6f, 0x0c, 0x42,
+        0x6e, 0x3f, 0x0d, 0x42, 0x48, 0x2e, 0x01, 0x00, 0x3a, 0x3c, 0x0d, 0x42, 0x3a, 0x0c, 0x0e, 0x42,
+        0x47, 0x27, 0x01, 0x00, 0x07, 0x09, 0x0e, 0x42, 0x3a, 0x8c, 0x0f, 0x42, 0x45, 0x24, 0x01, 0x00,
+        0x07, 0x09, 0x0e, 0x42, 0x07, 0xd9, 0x0e, 0x42, 0x2d, 0x27, 0x01, 0x00, 0xd4, 0xd5, 0x0e, 0x42,
+        0xd4, 0xa5, 0x0f, 0x42, 0x34, 0x2d, 0x01, 0x00, 0xa1, 0xa2, 0x0f, 0x42, 0xa1, 0x62, 0x10, 0x42,
+        0x39, 0x2f, 0x01, 0x00, 0x6e, 0x6f, 0x10, 0x42, 0x6e, 0x3f, 0x11, 0x42, 0x47, 0x31, 0x01, 0x00,
+        0x3a, 0x3c, 0x11, 0x42, 0x3a, 0x0c, 0x12, 0x42, 0x48, 0x48, 0x01, 0x00, 0x07, 0x09, 0x12, 0x42,
+        0x07, 0xd9, 0x12, 0x42, 0x4a, 0x52, 0x01, 0x00, 0xd4, 0xd5, 0x12, 0x42, 0x3a, 0x1c, 0x15, 0x42,
+        0x4c, 0x5c, 0x01, 0x00, 0xd4, 0xd5, 0x12, 0x42, 0xd4, 0xa5, 0x13, 0x42, 0x30, 0x4c, 0x01, 0x00,
+        0xa1, 0xa2, 0x13, 0x42, 0xa1, 0x72, 0x14, 0x42, 0x37, 0x53, 0x01, 0x00, 0x6e, 0x6f, 0x14, 0x42,
+        0x6e, 0x2f, 0x15, 0x42, 0x3c, 0x5d, 0x01, 0x00, 0x3a, 0x3c, 0x15, 0x42, 0x3a, 0x0c, 0x16, 0x42,
+        0x43, 0x42, 0x01, 0x00, 0x07, 0x09, 0x16, 0x42, 0x07, 0xd9, 0x16, 0x42, 0x4d, 0x52, 0x01, 0x00,
+        0xd4, 0xd5, 0x16, 0x42, 0xd4, 0xa5, 0x17, 0x42, 0x4c, 0x52, 0x01, 0x00, 0xa1, 0xa2, 0x17, 0x42,
+        0x07, 0xe9, 0x19, 0x42, 0x4a, 0x4f, 0x01, 0x00, 0xa1, 0xa2, 0x17, 0x42, 0xa1, 0x72, 0x18, 0x42,
+        0x2b, 0x4c, 0x01, 0x00, 0x6e, 0x6f, 0x18, 0x42, 0x6e, 0x3f, 0x19, 0x42, 0x37, 0x54, 0x01, 0x00,
+        0x3a, 0x3c, 0x19, 0x42, 0x3a, 0xfc, 0x19, 0x42, 0x3b, 0x59, 0x01, 0x00, 0x07, 0x09, 0x1a, 0x42,
+        0x07, 0xd9, 0x1a, 0x42, 0x41, 0x44, 0x01, 0x00, 0xd4, 0xd5, 0x1a, 0x42, 0xd4, 0xa5, 0x1b, 0x42,
+        0x4c, 0x50, 0x01, 0x00, 0xa1, 0xa2, 0x1b, 0x42, 0xa1, 0x72, 0x1c, 0x42, 0x4a, 0x51, 0x01, 0x00,
+        0x6e, 0x6f, 0x1c, 0x42, 0xd4, 0xb5, 0x1e, 0x42, 0x48, 0x46, 0x01, 0x00, 0x6e, 0x6f, 0x1c, 0x42,
+        0x6e, 0x3f, 0x1d, 0x42, 0x2d, 0x42, 0x01, 0x00, 0x3a, 0x3c, 0x1d, 0x42, 0x3a, 0x0c, 0x1e, 0x42,
+        0x34, 0x46, 0x01, 0x00, 0x07, 0x09, 0x1e, 0x42, 0x07, 0xc9, 0x1e, 0x42, 0x39, 0x4b, 0x01, 0x00,
+        0xd4, 0xd5, 0x1e, 0x42, 0xd4, 0xa5, 0x1f, 0x42, 0x40, 0x3c, 0x01, 0x00, 0xa1, 0xa2, 0x1f, 0x42,
+        0xa1, 0x72, 0x20, 0x42, 0x4a, 0x48, 0x01, 0x00, 0x6e, 0x6f, 0x20, 0x42, 0x6e, 0x3f, 0x21, 0x42,
+        0x48, 0x47, 0x01, 0x00, 0x3a, 0x3c, 0x21, 0x42, 0x6e, 0xbf, 0x22, 0x42, 0x47, 0x33, 0x01, 0x00,
+        0x3a, 0x3c, 0x21, 0x42, 0xa1, 0xa2, 0x21, 0x42, 0x28, 0x31, 0x01, 0x00, 0x07, 0x09, 0x22, 0x42,
+        0x07, 0xd9, 0x22, 0x42, 0x34, 0x3d, 0x01, 0x00, 0xd4, 0xd5, 0x22, 0x42, 0xd4, 0x95, 0x23, 0x42,
+        0x40, 0x50, 0x01, 0x00, 0xa1, 0xa2, 0x23, 0x42, 0xa1, 0x72, 0x24, 0x42, 0x40, 0x31, 0x01, 0x00,
+        0x6e, 0x6f, 0x24, 0x42, 0x6e, 0x2f, 0x25, 0x42, 0x4c, 0x3f, 0x01, 0x00, 0x3a, 0x3c, 0x25, 0x42,
+        0x8f, 0x0c, 0x26, 0x42, 0x40, 0x32, 0x01, 0x00, 0x07, 0x09, 0x26, 0x42, 0xcb, 0xdc, 0x26, 0x42,
+        0x4c, 0x3f, 0x01, 0x00, 0xe9, 0xea, 0x26, 0x42, 0x52, 0xd0, 0x27, 0x42, 0x4c, 0x38, 0x01, 0x00,
+        0xcb, 0xcc, 0x27, 0x42, 0x8e, 0xa0, 0x28, 0x42, 0x58, 0x3c, 0x01, 0x00, 0xac, 0xae, 0x28, 0x42,
+        0x16, 0x94, 0x29, 0x42, 0x4b, 0x2d, 0x01, 0x00, 0x8e, 0x90, 0x29, 0x42, 0x52, 0x64, 0x2a, 0x42,
+        0x4c, 0x2c, 0x01, 0x00, 0x70, 0x72, 0x2a, 0x42, 0xd9, 0x57, 0x2b, 0x42, 0x4b, 0x2d, 0x01, 0x00,
+        0x52, 0x54, 0x2b, 0x42, 0x15, 0x28, 0x2c, 0x42, 0x4c, 0x2b, 0x01, 0x00, 0x33, 0x36, 0x2c, 0x42,
+        0x9d, 0x1b, 0x2d, 0x42, 0x4b, 0x2f, 0x01, 0x00, 0x15, 0x18, 0x2d, 0x42, 0xd9, 0xeb, 0x2d, 0x42,
+        0x4c, 0x29, 0x01, 0x00, 0xf7, 0xf9, 0x2d, 0x42, 0x60, 0xdf, 0x2e, 0x42, 0x4b, 0x26, 0x01, 0x00,
+        0xd9, 0xdb, 0x2e, 0x42, 0x42, 0xc1, 0x2f, 0x42, 0x4c, 0x23, 0x01, 0x00, 0xba, 0xbd, 0x2f, 0x42,
+        0x24, 0xa3, 0x30, 0x42, 0x4b, 0x2a, 0x01, 0x00, 0x9c, 0x9f, 0x30, 0x42, 0x05, 0x85, 0x31, 0x42,
+        0x4c, 0x29, 0x01, 0x00, 0x7e, 0x81, 0x31, 0x42, 0xe7, 0x66, 0x32, 0x42, 0x4b, 0x2c, 0x01, 0x00,
+        0x60, 0x63, 0x32, 0x42, 0x75, 0x48, 0x33, 0x42, 0x4c, 0x30, 0x01, 0x00, 0x41, 0x45, 0x33, 0x42,
+        0x41, 0x15, 0x34, 0x42, 0x47, 0x28, 0x01, 0x00, 0x0e, 0x12, 0x34, 0x42, 0x0e, 0xe2, 0x34, 0x42,
+        0x4a, 0x2a, 0x01, 0x00, 0xdb, 0xde, 0x34, 0x42, 0xdb, 0xae, 0x35, 0x42, 0x48, 0x2a, 0x01, 0x00,
+        0xa8, 0xab, 0x35, 0x42, 0xdb, 0x2e, 0x37, 0x42, 0x45, 0x29, 0x01, 0x00, 0xa8, 0xab, 0x35, 0x42,
+        0xa8, 0x7b, 0x36, 0x42, 0x2d, 0x2d, 0x01, 0x00, 0x75, 0x78, 0x36, 0x42, 0x75, 0x48, 0x37, 0x42,
+        0x34, 0x2f, 0x01, 0x00, 0x41, 0x45, 0x37, 0x42, 0x41, 0x05, 0x38, 0x42, 0x39, 0x31, 0x01, 0x00,
+        0x0e, 0x12, 0x38, 0x42, 0x0e, 0xe2, 0x38, 0x42, 0x3c, 0x23, 0x01, 0x00, 0xdb, 0xde, 0x38, 0x42,
+        0xdb, 0xae, 0x39, 0x42, 0x40, 0x23, 0x01, 0x00, 0xa8, 0xab, 0x39, 0x42, 0xa8, 0x7b, 0x3a, 0x42,
+        0x45, 0x33, 0x01, 0x00, 0x75, 0x78, 0x3a, 0x42, 0xa8, 0xfb, 0x3b, 0x42, 0x47, 0x37, 0x01, 0x00,
+        0x75, 0x78, 0x3a, 0x42, 0x75, 0x48, 0x3b, 0x42, 0x28, 0x25, 0x01, 0x00, 0x41, 0x45, 0x3b, 0x42,
+        0x41, 0x15, 0x3c, 0x42, 0x34, 0x2a, 0x01, 0x00, 0x0e, 0x12, 0x3c, 0x42, 0x0e, 0xd2, 0x3c, 0x42,
+        0x38, 0x2e, 0x01, 0x00, 0xdb, 0xde, 0x3c, 0x42, 0xdb, 0xae, 0x3d, 0x42, 0x40, 0x25, 0x01, 0x00,
+        0xa8, 0xab, 0x3d, 0x42, 0xa8, 0x7b, 0x3e, 0x42, 0x44, 0x26, 0x01, 0x00, 0x75, 0x78, 0x3e, 0x42,
+        0x75, 0x48, 0x3f, 0x42, 0x47, 0x2f, 0x01, 0x00, 0x41, 0x45, 0x3f, 0x42, 0x75, 0xc8, 0x40, 0x42,
+        0x48, 0x32, 0x01, 0x00, 0x41, 0x45, 0x3f, 0x42, 0x41, 0x15, 0x40, 0x42, 0x2d, 0x29, 0x01, 0x00,
+        0x0e, 0x12, 0x40, 0x42, 0x0e, 0xe2, 0x40, 0x42, 0x34, 0x2d, 0x01, 0x00, 0xdb, 0xde, 0x40, 0x42,
+        0xdb, 0x9e, 0x41, 0x42, 0x39, 0x2e, 0x01, 0x00, 0xa8, 0xab, 0x41, 0x42, 0xa8, 0x7b, 0x42, 0x42,
+        0x40, 0x25, 0x01, 0x00, 0x75, 0x78, 0x42, 0x42, 0x75, 0x48, 0x43, 0x42, 0x4c, 0x2f, 0x01, 0x00,
+        0x41, 0x45, 0x43, 0x42, 0x41, 0x15, 0x44, 0x42, 0x4b, 0x2b, 0x01, 0x00, 0x0e, 0x12, 0x44, 0x42,
+        0x0e, 0xe2, 0x44, 0x42, 0x4c, 0x2b, 0x01, 0x00, 0xdb, 0xde, 0x44, 0x42, 0xdb, 0xae, 0x45, 0x42,
+        0x4b, 0x2d, 0x01, 0x00, 0xa8, 0xab, 0x45, 0x42, 0xa8, 0x7b, 0x46, 0x42, 0x4c, 0x2e, 0x01, 0x00,
+        0x75, 0x78, 0x46, 0x42, 0x75, 0x48, 0x47, 0x42, 0x47, 0x28, 0x01, 0x00, 0x41, 0x45, 0x47, 0x42,
+        0x41, 0x15, 0x48, 0x42, 0x4a, 0x26, 0x01, 0x00, 0x0e, 0x12, 0x48, 0x42, 0x0e, 0xe2, 0x48, 0x42,
+        0x48, 0x27, 0x01, 0x00, 0xdb, 0xde, 0x48, 0x42, 0x0e, 0x62, 0x4a, 0x42, 0x45, 0x25, 0x01, 0x00,
+        0xdb, 0xde, 0x48, 0x42, 0xdb, 0xae, 0x49, 0x42, 0x2d, 0x24, 0x01, 0x00, 0xa8, 0xab, 0x49, 0x42,
+        0xa8, 0x7b, 0x4a, 0x42, 0x34, 0x22, 0x01, 0x00, 0x75, 0x78, 0x4a, 0x42, 0x75, 0x38, 0x4b, 0x42,
+        0x39, 0x30, 0x01, 0x00, 0x41, 0x45, 0x4b, 0x42, 0x41, 0x15, 0x4c, 0x42, 0x3c, 0x29, 0x01, 0x00,
+        0x0e, 0x12, 0x4c, 0x42, 0x0e, 0xe2, 0x4c, 0x42, 0x40, 0x2a, 0x01, 0x00, 0xdb, 0xde, 0x4c, 0x42,
+        0xdb, 0xae, 0x4d, 0x42, 0x45, 0x35, 0x01, 0x00, 0xa8, 0xab, 0x4d, 0x42, 0xdb, 0x2e, 0x4f, 0x42,
+        0x47, 0x3a, 0x01, 0x00, 0xa8, 0xab, 0x4d, 0x42, 0xa8, 0x7b, 0x4e, 0x42, 0x28, 0x26, 0x01, 0x00,
+        0x75, 0x78, 0x4e, 0x42, 0x75, 0x48, 0x4f, 0x42, 0x34, 0x2a, 0x01, 0x00, 0x41, 0x45, 0x4f, 0x42,
+        0x41, 0x05, 0x50, 0x42, 0x38, 0x32, 0x01, 0x00, 0x0e, 0x12, 0x50, 0x42, 0x0e, 0xe2, 0x50, 0x42,
+        0x3e, 0x21, 0x01, 0x00, 0xdb, 0xde, 0x50, 0x42, 0xdb, 0xae, 0x51, 0x42, 0x48, 0x2b, 0x01, 0x00,
+        0xa8, 0xab, 0x51, 0x42, 0xa8, 0x7b, 0x52, 0x42, 0x47, 0x28, 0x01, 0x00, 0x75, 0x78, 0x52, 0x42,
+        0xa8, 0xfb, 0x53, 0x42, 0x45, 0x24, 0x01, 0x00, 0x75, 0x78, 0x52, 0x42, 0x75, 0x48, 0x53, 0x42,
+        0x2d, 0x21, 0x01, 0x00, 0x41, 0x45, 0x53, 0x42, 0x41, 0x15, 0x54, 0x42, 0x34, 0x23, 0x01, 0x00,
+        0x0e, 0x12, 0x54, 0x42, 0x0e, 0xd2, 0x54, 0x42, 0x39, 0x2c, 0x01, 0x00, 0xdb, 0xde, 0x54, 0x42,
+        0x41, 0x45, 0x55, 0x42, 0x40, 0x25, 0x01, 0x00, 0xdb, 0xde, 0x54, 0x42, 0x41, 0x45, 0x55, 0x42,
+        0x48, 0x25, 0x01, 0x00, 0xdb, 0xde, 0x54, 0x42, 0x41, 0x45, 0x55, 0x42, 0x3a, 0x34, 0x01, 0x00,
+        0xdb, 0xde, 0x54, 0x42, 0x41, 0x45, 0x55, 0x42, 0x3c, 0x34, 0x01, 0x00, 0xa8, 0xab, 0x55, 0x42,
+        0x0e, 0x12, 0x56, 0x42, 0x41, 0x36, 0x01, 0x00, 0xa8, 0xab, 0x55, 0x42, 0x0e, 0x12, 0x56, 0x42,
+        0x48, 0x36, 0x01, 0x00, 0xa8, 0xab, 0x55, 0x42, 0x0e, 0x12, 0x56, 0x42, 0x39, 0x38, 0x01, 0x00,
+        0xa8, 0xab, 0x55, 0x42, 0x0e, 0x12, 0x56, 0x42, 0x3c, 0x38, 0x01, 0x00, 0x75, 0x78, 0x56, 0x42,
+        0xdb, 0xde, 0x56, 0x42, 0x40, 0x40, 0x01, 0x00, 0x75, 0x78, 0x56, 0x42, 0xdb, 0xde, 0x56, 0x42,
+        0x43, 0x40, 0x01, 0x00, 0x75, 0x78, 0x56, 0x42, 0xdb, 0xde, 0x56, 0x42, 0x48, 0x40, 0x01, 0x00,
+        0x75, 0x78, 0x56, 0x42, 0xdb, 0xde, 0x56, 0x42, 0x37, 0x43, 0x01, 0x00, 0x75, 0x78, 0x56, 0x42,
+        0xdb, 0xde, 0x56, 0x42, 0x3a, 0x43, 0x01, 0x00, 0x75, 0x78, 0x56, 0x42, 0xdb, 0xde, 0x56, 0x42,
+        0x3c, 0x43, 0x01, 0x00, 0x41, 0x45, 0x57, 0x42, 0x75, 0x88, 0x5a, 0x42, 0x48, 0x37, 0x01, 0x00,
+        0x41, 0x45, 0x57, 0x42, 0x0e, 0x12, 0x58, 0x42, 0x35, 0x32, 0x01, 0x00, 0x0e, 0x12, 0x58, 0x42,
+        0xdb, 0xde, 0x58, 0x42, 0x39, 0x37, 0x01, 0x00, 0xdb, 0xde, 0x58, 0x42, 0xa8, 0xab, 0x59, 0x42,
+        0x3c, 0x32, 0x01, 0x00, 0xa8, 0xab, 0x59, 0x42, 0x75, 0x78, 0x5a, 0x42, 0x39, 0x2e, 0x01, 0x00,
+        0x75, 0x78, 0x5a, 0x42, 0xdb, 0xae, 0x5b, 0x42, 0x4d, 0x38, 0x01, 0x00, 0x75, 0x78, 0x5a, 0x42,
+        0x41, 0x45, 0x5b, 0x42, 0x3c, 0x37, 0x01, 0x00, 0x41, 0x45, 0x5b, 0x42, 0x0e, 0x12, 0x5c, 0x42,
+        0x39, 0x32, 0x01, 0x00, 0xa8, 0xab, 0x5b, 0x42, 0x0e, 0x12, 0x5c, 0x42, 0x4c, 0x33, 0x01, 0x00,
+        0x0e, 0x12, 0x5c, 0x42, 0x0e, 0xb2, 0x5d, 0x42, 0x4c, 0x30, 0x01, 0x00, 0x0e, 0x12, 0x5c, 0x42,
+        0xdb, 0xde, 0x5c, 0x42, 0x35, 0x2b, 0x01, 0x00, 0xdb, 0xde, 0x5c, 0x42, 0xa8, 0xab, 0x5d, 0x42,
+        0x3a, 0x36, 0x01, 0x00, 0xa8, 0xab, 0x5d, 0x42, 0xdb, 0x2e, 0x5f, 0x42, 0x4a, 0x2b, 0x01, 0x00,
+        0xa8, 0xab, 0x5d, 0x42, 0x75, 0x78, 0x5e, 0x42, 0x3e, 0x36, 0x01, 0x00, 0x75, 0x78, 0x5e, 0x42,
+        0x41, 0x45, 0x5f, 0x42, 0x3a, 0x2b, 0x01, 0x00, 0x41, 0x45, 0x5f, 0x42, 0xa8, 0x7b, 0x60, 0x42,
+        0x52, 0x3b, 0x01, 0x00, 0x41, 0x45, 0x5f, 0x42, 0x0e, 0x12, 0x60, 0x42, 0x3e, 0x33, 0x01, 0x00,
+        0x0e, 0x12, 0x60, 0x42, 0xdb, 0xde, 0x60, 0x42, 0x3a, 0x2e, 0x01, 0x00, 0x75, 0x78, 0x60, 0x42,
+        0xdb, 0xde, 0x60, 0x42, 0x51, 0x3d, 0x01, 0x00, 0xdb, 0xde, 0x60, 0x42, 0xdb, 0xae, 0x61, 0x42,
+        0x51, 0x2f, 0x01, 0x00, 0xdb, 0xde, 0x60, 0x42, 0xa8, 0xab, 0x61, 0x42, 0x35, 0x2b, 0x01, 0x00,
+        0xa8, 0xab, 0x61, 0x42, 0xa8, 0x7b, 0x62, 0x42, 0x4f, 0x29, 0x01, 0x00, 0xa8, 0xab, 0x61, 0x42,
+        0x75, 0x78, 0x62, 0x42, 0x40, 0x3e, 0x01, 0x00, 0x75, 0x78, 0x62, 0x42, 0x75, 0x48, 0x63, 0x42,
+        0x4d, 0x2b, 0x01, 0x00, 0x75, 0x78, 0x62, 0x42, 0x41, 0x45, 0x63, 0x42, 0x35, 0x2d, 0x01, 0x00,
+        0x75, 0x78, 0x62, 0x42, 0x41, 0x45, 0x63, 0x42, 0x37, 0x2d, 0x01, 0x00, 0x75, 0x78, 0x62, 0x42,
+        0x41, 0x45, 0x63, 0x42, 0x3a, 0x2d, 0x01, 0x00, 0x41, 0x45, 0x63, 0x42, 0x41, 0x15, 0x64, 0x42,
+        0x4c, 0x26, 0x01, 0x00, 0x41, 0x45, 0x63, 0x42, 0x0e, 0x12, 0x64, 0x42, 0x40, 0x35, 0x01, 0x00,
+        0x0e, 0x12, 0x64, 0x42, 0x0e, 0xe2, 0x64, 0x42, 0x4a, 0x2f, 0x01, 0x00, 0x0e, 0x12, 0x64, 0x42,
+        0xdb, 0xde, 0x64, 0x42, 0x35, 0x30, 0x01, 0x00, 0x0e, 0x12, 0x64, 0x42, 0xdb, 0xde, 0x64, 0x42,
+        0x37, 0x30, 0x01, 0x00, 0x0e, 0x12, 0x64, 0x42, 0xdb, 0xde, 0x64, 0x42, 0x3a, 0x30, 0x01, 0x00,
+        0xdb, 0xde, 0x64, 0x42, 0xdb, 0xae, 0x65, 0x42, 0x48, 0x2d, 0x01, 0x00, 0xdb, 0xde, 0x64, 0x42,
+        0xa8, 0xab, 0x65, 0x42, 0x40, 0x39, 0x01, 0x00, 0xa8, 0xab, 0x65, 0x42, 0xa8, 0x4b, 0x67, 0x42,
+        0x46, 0x30, 0x01, 0x00, 0xa8, 0xab, 0x65, 0x42, 0x75, 0x78, 0x66, 0x42, 0x35, 0x2a, 0x01, 0x00,
+        0x75, 0x78, 0x66, 0x42, 0x41, 0x45, 0x67, 0x42, 0x39, 0x34, 0x01, 0x00, 0x41, 0x45, 0x67, 0x42,
+        0x41, 0xb5, 0x68, 0x42, 0x45, 0x28, 0x01, 0x00, 0x41, 0x45, 0x67, 0x42, 0x0e, 0x12, 0x68, 0x42,
+        0x3c, 0x34, 0x01, 0x00, 0x0e, 0x12, 0x68, 0x42, 0xdb, 0xde, 0x68, 0x42, 0x39, 0x2f, 0x01, 0x00,
+        0x41, 0xb5, 0x68, 0x42, 0xdb, 0xde, 0x68, 0x42, 0x46, 0x2b, 0x01, 0x00, 0xdb, 0xde, 0x68, 0x42,
+        0x41, 0x45, 0x69, 0x42, 0x45, 0x2b, 0x01, 0x00, 0xdb, 0xde, 0x68, 0x42, 0xa8, 0xab, 0x69, 0x42,
+        0x3c, 0x35, 0x01, 0x00, 0x41, 0x45, 0x69, 0x42, 0xa8, 0xab, 0x69, 0x42, 0x43, 0x2e, 0x01, 0x00,
+        0xa8, 0xab, 0x69, 0x42, 0x0e, 0x12, 0x6a, 0x42, 0x45, 0x34, 0x01, 0x00, 0xa8, 0xab, 0x69, 0x42,
+        0x75, 0x78, 0x6a, 0x42, 0x39, 0x2f, 0x01, 0x00, 0x0e, 0x12, 0x6a, 0x42, 0x75, 0x78, 0x6a, 0x42,
+        0x46, 0x36, 0x01, 0x00, 0x75, 0x78, 0x6a, 0x42, 0xa8, 0xbb, 0x6d, 0x42, 0x48, 0x39, 0x01, 0x00,
+        0x75, 0x78, 0x6a, 0x42, 0x41, 0x45, 0x6b, 0x42, 0x35, 0x2f, 0x01, 0x00, 0x41, 0x45, 0x6b, 0x42,
+        0x0e, 0x12, 0x6c, 0x42, 0x39, 0x33, 0x01, 0x00, 0x0e, 0x12, 0x6c, 0x42, 0xdb, 0xde, 0x6c, 0x42,
+        0x3c, 0x3b, 0x01, 0x00, 0xdb, 0xde, 0x6c, 0x42, 0xa8, 0xab, 0x6d, 0x42, 0x39, 0x2c, 0x01, 0x00,
+        0xa8, 0xab, 0x6d, 0x42, 0xa8, 0x7b, 0x6e, 0x42, 0x4a, 0x3e, 0x01, 0x00, 0xa8, 0xab, 0x6d, 0x42,
+        0x75, 0x78, 0x6e, 0x42, 0x3c, 0x32, 0x01, 0x00, 0x75, 0x78, 0x6e, 0x42, 0x75, 0x48, 0x6f, 0x42,
+        0x4b, 0x35, 0x01, 0x00, 0x75, 0x78, 0x6e, 0x42, 0x41, 0x45, 0x6f, 0x42, 0x39, 0x30, 0x01, 0x00,
+        0x41, 0x45, 0x6f, 0x42, 0xa8, 0x8b, 0x71, 0x42, 0x4c, 0x3b, 0x01, 0x00, 0x41, 0x45, 0x6f, 0x42,
+        0x0e, 0x12, 0x70, 0x42, 0x34, 0x30, 0x01, 0x00, 0x0e, 0x12, 0x70, 0x42, 0xdb, 0xde, 0x70, 0x42,
+        0x39, 0x2f, 0x01, 0x00, 0xdb, 0xde, 0x70, 0x42, 0xa8, 0xab, 0x71, 0x42, 0x3c, 0x36, 0x01, 0x00,
+        0xa8, 0xab, 0x71, 0x42, 0xa8, 0x7b, 0x72, 0x42, 0x4c, 0x2e, 0x01, 0x00, 0xa8, 0xab, 0x71, 0x42,
+        0x75, 0x78, 0x72, 0x42, 0x39, 0x2e, 0x01, 0x00, 0x75, 0x78, 0x72, 0x42, 0x75, 0x48, 0x73, 0x42,
+        0x4d, 0x33, 0x01, 0x00, 0x75, 0x78, 0x72, 0x42, 0x41, 0x45, 0x73, 0x42, 0x32, 0x3a, 0x01, 0x00,
+        0x75, 0x78, 0x72, 0x42, 0x41, 0x45, 0x73, 0x42, 0x3e, 0x3a, 0x01, 0x00, 0x41, 0x45, 0x73, 0x42,
+        0x41, 0x15, 0x74, 0x42, 0x45, 0x23, 0x01, 0x00, 0x41, 0x45, 0x73, 0x42, 0x0e, 0x12, 0x74, 0x42,
+        0x35, 0x2a, 0x01, 0x00, 0x0e, 0x12, 0x74, 0x42, 0x0e, 0x82, 0x76, 0x42, 0x48, 0x33, 0x01, 0x00,
+        0x0e, 0x12, 0x74, 0x42, 0xdb, 0xde, 0x74, 0x42, 0x37, 0x35, 0x01, 0x00, 0xdb, 0xde, 0x74, 0x42,
+        0xa8, 0xab, 0x75, 0x42, 0x40, 0x39, 0x01, 0x00, 0xa8, 0xab, 0x75, 0x42, 0x75, 0x78, 0x76, 0x42,
+        0x37, 0x30, 0x01, 0x00, 0x75, 0x78, 0x76, 0x42, 0xa8, 0xab, 0x76, 0x42, 0x4a, 0x35, 0x01, 0x00,
+        0x75, 0x78, 0x76, 0x42, 0x41, 0x45, 0x77, 0x42, 0x40, 0x38, 0x01, 0x00, 0xa8, 0xab, 0x76, 0x42,
+        0xdb, 0xde, 0x76, 0x42, 0x48, 0x38, 0x01, 0x00, 0xdb, 0xde, 0x76, 0x42, 0x0e, 0x12, 0x77, 0x42,
+        0x47, 0x38, 0x01, 0x00, 0x0e, 0x12, 0x77, 0x42, 0x41, 0x45, 0x77, 0x42, 0x48, 0x3b, 0x01, 0x00,
+        0x41, 0x45, 0x77, 0x42, 0xa8, 0x7b, 0x78, 0x42, 0x4a, 0x36, 0x01, 0x00, 0x41, 0x45, 0x77, 0x42,
+        0x0e, 0x12, 0x78, 0x42, 0x37, 0x29, 0x01, 0x00, 0x0e, 0x12, 0x78, 0x42, 0xdb, 0xde, 0x78, 0x42,
+        0x41, 0x3b, 0x01, 0x00, 0x75, 0x78, 0x78, 0x42, 0xdb, 0xde, 0x78, 0x42, 0x47, 0x34, 0x01, 0x00,
+        0xdb, 0xde, 0x78, 0x42, 0xdb, 0x3e, 0x79, 0x42, 0x48, 0x33, 0x01, 0x00, 0xdb, 0xde, 0x78, 0x42,
+        0x75, 0x78, 0x7a, 0x42, 0x3c, 0x33, 0x01, 0x00, 0xdb, 0xde, 0x78, 0x42, 0x75, 0x78, 0x7a, 0x42,
+        0x40, 0x33, 0x01, 0x00, 0x41, 0x45, 0x79, 0x42, 0xa8, 0xab, 0x79, 0x42, 0x4f, 0x38, 0x01, 0x00,
+        0xa8, 0xab, 0x79, 0x42, 0x0e, 0x12, 0x7a, 0x42, 0x43, 0x25, 0x01, 0x00, 0x0e, 0x12, 0x7a, 0x42,
+        0x75, 0x78, 0x7a, 0x42, 0x4f, 0x3e, 0x01, 0x00, 0x75, 0x78, 0x7a, 0x42, 0xdb, 0xde, 0x7a, 0x42,
+        0x45, 0x28, 0x01, 0x00, 0xdb, 0xde, 0x7a, 0x42, 0x41, 0x45, 0x7b, 0x42, 0x4f, 0x3a, 0x01, 0x00,
+        0x41, 0x45, 0x7b, 0x42, 0xa8, 0xab, 0x7b, 0x42, 0x47, 0x26, 0x01, 0x00, 0x41, 0x45, 0x7b, 0x42,
+        0xa8, 0xab, 0x7b, 0x42, 0x41, 0x2a, 0x01, 0x00, 0x41, 0x45, 0x7b, 0x42, 0xa8, 0xab, 0x7b, 0x42,
+        0x43, 0x2a, 0x01, 0x00, 0xa8, 0xab, 0x7b, 0x42, 0x0e, 0x12, 0x7c, 0x42, 0x4f, 0x3a, 0x01, 0x00,
+        0x0e, 0x12, 0x7c, 0x42, 0x75, 0x78, 0x7c, 0x42, 0x48, 0x2a, 0x01, 0x00, 0x0e, 0x12, 0x7c, 0x42,
+        0x75, 0x78, 0x7c, 0x42, 0x40, 0x32, 0x01, 0x00, 0x0e, 0x12, 0x7c, 0x42, 0x75, 0x78, 0x7c, 0x42,
+        0x43, 0x32, 0x01, 0x00, 0x75, 0x78, 0x7c, 0x42, 0xdb, 0xde, 0x7c, 0x42, 0x4f, 0x3a, 0x01, 0x00,
+        0xdb, 0xde, 0x7c, 0x42, 0x41, 0x45, 0x7d, 0x42, 0x4a, 0x29, 0x01, 0x00, 0xdb, 0xde, 0x7c, 0x42,
+        0x41, 0x45, 0x7d, 0x42, 0x3e, 0x33, 0x01, 0x00, 0xdb, 0xde, 0x7c, 0x42, 0x41, 0x45, 0x7d, 0x42,
+        0x41, 0x33, 0x01, 0x00, 0xdb, 0xde, 0x7c, 0x42, 0x41, 0x45, 0x7d, 0x42, 0x43, 0x33, 0x01, 0x00,
+        0x41, 0x45, 0x7d, 0x42, 0xa8, 0xab, 0x7d, 0x42, 0x4f, 0x36, 0x01, 0x00, 0xa8, 0xab, 0x7d, 0x42,
+        0x0e, 0x12, 0x7e, 0x42, 0x4c, 0x2d, 0x01, 0x00, 0xa8, 0xab, 0x7d, 0x42, 0x41, 0x45, 0x7f, 0x42,
+        0x3c, 0x2e, 0x01, 0x00, 0xa8, 0xab, 0x7d, 0x42, 0x41, 0x45, 0x7f, 0x42, 0x40, 0x2e, 0x01, 0x00,
+        0xa8, 0xab, 0x7d, 0x42, 0x41, 0x45, 0x7f, 0x42, 0x43, 0x2e, 0x01, 0x00, 0x0e, 0x12, 0x7e, 0x42,
+        0x75, 0x78, 0x7e, 0x42, 0x4f, 0x38, 0x01, 0x00, 0x75, 0x78, 0x7e, 0x42, 0xdb, 0xde, 0x7e, 0x42,
+        0x54, 0x39, 0x01, 0x00, 0xdb, 0xde, 0x7e, 0x42, 0x41, 0x45, 0x7f, 0x42, 0x53, 0x30, 0x01, 0x00,
+        0x41, 0x45, 0x7f, 0x42, 0xa8, 0xab, 0x7f, 0x42, 0x51, 0x2b, 0x01, 0x00, 0x41, 0x45, 0x7f, 0x42,
+        0x6e, 0x6f, 0x80, 0x42, 0x35, 0x2d, 0x01, 0x00, 0x41, 0x45, 0x7f, 0x42, 0x6e, 0x6f, 0x80, 0x42,
+        0x39, 0x2d, 0x01, 0x00, 0xa8, 0xab, 0x7f, 0x42, 0x07, 0x09, 0x80, 0x42, 0x4f, 0x2a, 0x01, 0x00,
+        0x07, 0x09, 0x80, 0x42, 0x3a, 0x3c, 0x80, 0x42, 0x4d, 0x2d, 0x01, 0x00, 0x3a, 0x3c, 0x80, 0x42,
+        0x6e, 0x6f, 0x80, 0x42, 0x4c, 0x2a, 0x01, 0x00, 0x6e, 0x6f, 0x80, 0x42, 0xa1, 0xa2, 0x80, 0x42,
+        0x4a, 0x2d, 0x01, 0x00, 0x6e, 0x6f, 0x80, 0x42, 0x3a, 0x3c, 0x81, 0x42, 0x37, 0x30, 0x01, 0x00,
+        0x6e, 0x6f, 0x80, 0x42, 0x3a, 0x3c, 0x81, 0x42, 0x3b, 0x30, 0x01, 0x00, 0xa1, 0xa2, 0x80, 0x42,
+        0xd4, 0xd5, 0x80, 0x42, 0x4f, 0x37, 0x01, 0x00, 0xd4, 0xd5, 0x80, 0x42, 0x07, 0x09, 0x81, 0x42,
+        0x4d, 0x30, 0x01, 0x00, 0x07, 0x09, 0x81, 0x42, 0x07, 0x39, 0x81, 0x42, 0x4a, 0x2f, 0x01, 0x00,
+        0x3a, 0x3c, 0x81, 0x42, 0x6e, 0x6f, 0x81, 0x42, 0x48, 0x29, 0x01, 0x00, 0x3a, 0x3c, 0x81, 0x42,
+        0x07, 0x09, 0x82, 0x42, 0x3c, 0x37, 0x01, 0x00, 0x3a, 0x3c, 0x81, 0x42, 0x07, 0x09, 0x82, 0x42,
+        0x40, 0x37, 0x01, 0x00, 0x6e, 0x6f, 0x81, 0x42, 0xa1, 0xa2, 0x81, 0x42, 0x4f, 0x37, 0x01, 0x00,
+        0xa1, 0xa2, 0x81, 0x42, 0xd4, 0xd5, 0x81, 0x42, 0x43, 0x24, 0x01, 0x00, 0xd4, 0xd5, 0x81, 0x42,
+        0x07, 0x09, 0x82, 0x42, 0x4f, 0x3d, 0x01, 0x00, 0x07, 0x09, 0x82, 0x42, 0x3a, 0x3c, 0x82, 0x42,
+        0x45, 0x28, 0x01, 0x00, 0x3a, 0x3c, 0x82, 0x42, 0x6e, 0x6f, 0x82, 0x42, 0x4f, 0x37, 0x01, 0x00,
+        0x6e, 0x6f, 0x82, 0x42, 0xa1, 0xa2, 0x82, 0x42, 0x47, 0x2d, 0x01, 0x00, 0x6e, 0x6f, 0x82, 0x42,
+        0xa1, 0xa2, 0x82, 0x42, 0x41, 0x2c, 0x01, 0x00, 0x6e, 0x6f, 0x82, 0x42, 0xa1, 0xa2, 0x82, 0x42,
+        0x43, 0x2c, 0x01, 0x00, 0xa1, 0xa2, 0x82, 0x42, 0xd4, 0xd5, 0x82, 0x42, 0x4f, 0x38, 0x01, 0x00,
+        0xd4, 0xd5, 0x82, 0x42, 0x07, 0x09, 0x83, 0x42, 0x48, 0x2a, 0x01, 0x00, 0xd4, 0xd5, 0x82, 0x42,
+        0x07, 0x09, 0x83, 0x42, 0x40, 0x30, 0x01, 0x00, 0xd4, 0xd5, 0x82, 0x42, 0x07, 0x09, 0x83, 0x42,
+        0x43, 0x30, 0x01, 0x00, 0x07, 0x09, 0x83, 0x42, 0x3a, 0x3c, 0x83, 0x42, 0x4f, 0x39, 0x01, 0x00,
+        0x3a, 0x3c, 0x83, 0x42, 0x6e, 0x6f, 0x83, 0x42, 0x4a, 0x2a, 0x01, 0x00, 0x3a, 0x3c, 0x83, 0x42,
+        0x6e, 0x6f, 0x83, 0x42, 0x3e, 0x31, 0x01, 0x00, 0x3a, 0x3c, 0x83, 0x42, 0x6e, 0x6f, 0x83, 0x42,
+        0x41, 0x31, 0x01, 0x00, 0x3a, 0x3c, 0x83, 0x42, 0x6e, 0x6f, 0x83, 0x42, 0x43, 0x31, 0x01, 0x00,
+        0x6e, 0x6f, 0x83, 0x42, 0xa1, 0xa2, 0x83, 0x42, 0x4f, 0x31, 0x01, 0x00, 0xa1, 0xa2, 0x83, 0x42,
+        0xd4, 0xd5, 0x83, 0x42, 0x4c, 0x29, 0x01, 0x00, 0xa1, 0xa2, 0x83, 0x42, 0x6e, 0x6f, 0x84, 0x42,
+        0x3c, 0x30, 0x01, 0x00, 0xa1, 0xa2, 0x83, 0x42, 0x6e, 0x6f, 0x84, 0x42, 0x40, 0x30, 0x01, 0x00,
+        0xa1, 0xa2, 0x83, 0x42, 0x6e, 0x6f, 0x84, 0x42, 0x43, 0x30, 0x01, 0x00, 0xd4, 0xd5, 0x83, 0x42,
+        0x07, 0x09, 0x84, 0x42, 0x4f, 0x33, 0x01, 0x00, 0x07, 0x09, 0x84, 0x42, 0x3a, 0x3c, 0x84, 0x42,
+        0x54, 0x3d, 0x01, 0x00, 0x3a, 0x3c, 0x84, 0x42, 0x6e, 0x6f, 0x84, 0x42, 0x53, 0x2b, 0x01, 0x00,
+        0x6e, 0x6f, 0x84, 0x42, 0xa1, 0xa2, 0x84, 0x42, 0x51, 0x31, 0x01, 0x00, 0x6e, 0x6f, 0x84, 0x42,
+        0x3a, 0x3c, 0x85, 0x42, 0x35, 0x2a, 0x01, 0x00, 0x6e, 0x6f, 0x84, 0x42, 0x3a, 0x3c, 0x85, 0x42,
+        0x39, 0x2a, 0x01, 0x00, 0xa1, 0xa2, 0x84, 0x42, 0xd4, 0xd5, 0x84, 0x42, 0x4f, 0x2d, 0x01, 0x00,
+        0xd4, 0xd5, 0x84, 0x42, 0x07, 0x09, 0x85, 0x42, 0x4d, 0x29, 0x01, 0x00, 0x07, 0x09, 0x85, 0x42,
+        0x3a, 0x3c, 0x85, 0x42, 0x4c, 0x31, 0x01, 0x00, 0x3a, 0x3c, 0x85, 0x42, 0x6e, 0x6f, 0x85, 0x42,
+        0x4a, 0x2e, 0x01, 0x00, 0x3a, 0x3c, 0x85, 0x42, 0x07, 0x09, 0x86, 0x42, 0x37, 0x31, 0x01, 0x00,
+        0x3a, 0x3c, 0x85, 0x42, 0x07, 0x09, 0x86, 0x42, 0x3b, 0x31, 0x01, 0x00, 0x6e, 0x6f, 0x85, 0x42,
+        0xa1, 0xa2, 0x85, 0x42, 0x4f, 0x38, 0x01, 0x00, 0xa1, 0xa2, 0x85, 0x42, 0xd4, 0xd5, 0x85, 0x42,
+        0x4d, 0x2e, 0x01, 0x00, 0xd4, 0xd5, 0x85, 0x42, 0xd4, 0x05, 0x86, 0x42, 0x4a, 0x2b, 0x01, 0x00,
+        0x07, 0x09, 0x86, 0x42, 0x3a, 0x3c, 0x86, 0x42, 0x4c, 0x33, 0x01, 0x00, 0x07, 0x09, 0x86, 0x42,
+        0x7c, 0xd9, 0x86, 0x42, 0x38, 0x31, 0x01, 0x00, 0x07, 0x09, 0x86, 0x42, 0x7c, 0xd9, 0x86, 0x42,
+        0x3b, 0x31, 0x01, 0x00, 0x3a, 0x3c, 0x86, 0x42, 0x6e, 0x6f, 0x86, 0x42, 0x4d, 0x35, 0x01, 0x00,
+        0x6e, 0x6f, 0x86, 0x42, 0xa1, 0xa2, 0x86, 0x42, 0x4c, 0x30, 0x01, 0x00, 0xa1, 0xa2, 0x86, 0x42,
+        0x7c, 0xd9, 0x86, 0x42, 0x4b, 0x2c, 0x01, 0x00, 0x7c, 0xd9, 0x86, 0x42, 0x58, 0x10, 0x87, 0x42,
+        0x4c, 0x2e, 0x01, 0x00, 0x58, 0x10, 0x87, 0x42, 0x33, 0x47, 0x87, 0x42, 0x47, 0x2a, 0x01, 0x00,
+        0x33, 0x47, 0x87, 0x42, 0x0e, 0x7e, 0x87, 0x42, 0x4c, 0x34, 0x01, 0x00, 0x0e, 0x7e, 0x87, 0x42,
+        0xea, 0xb4, 0x87, 0x42, 0x4b, 0x2e, 0x01, 0x00, 0xea, 0xb4, 0x87, 0x42, 0xfd, 0xef, 0x87, 0x42,
+        0x4c, 0x33, 0x01, 0x00, 0xfd, 0xef, 0x87, 0x42, 0x11, 0x2b, 0x88, 0x42, 0x47, 0x2c, 0x01, 0x00,
+        0x11, 0x2b, 0x88, 0x42, 0x25, 0x66, 0x88, 0x42, 0x4c, 0x31, 0x01, 0x00, 0x25, 0x66, 0x88, 0x42,
+        0x38, 0xa1, 0x88, 0x42, 0x4b, 0x30, 0x01, 0x00, 0x38, 0xa1, 0x88, 0x42, 0x38, 0xf1, 0x89, 0x42,
+        0x4c, 0x34, 0x01, 0x00, 0xae, 0x03, 0x8a, 0x42, 0xae, 0x7b, 0x8a, 0x42, 0x47, 0x24, 0x01, 0x00,
+        0xd6, 0x79, 0x8a, 0x42, 0xd6, 0xf1, 0x8a, 0x42, 0x4c, 0x26, 0x01, 0x00, 0xfd, 0xef, 0x8a, 0x42,
+        0xfd, 0x67, 0x8b, 0x42, 0x4b, 0x2b, 0x01, 0x00, 0x24, 0x66, 0x8b, 0x42, 0x24, 0xb6, 0x8c, 0x42,
+        0x4c, 0x2d, 0x01, 0x00, 0x9a, 0xc8, 0x8c, 0x42, 0xc2, 0x3e, 0x8d, 0x42, 0x47, 0x2c, 0x01, 0x00,
+        0xc2, 0x3e, 0x8d, 0x42, 0xc2, 0xbe, 0x8e, 0x42, 0x4c, 0x34, 0x01, 0x00, 0xc2, 0xbe, 0x8e, 0x42,
+        0xc2, 0x40, 0x8f, 0x42, 0x4b, 0x2a, 0x01, 0x00, 0xc2, 0x3e, 0x8f, 0x42, 0xc2, 0xb6, 0x8f, 0x42,
+        0x4c, 0x2b, 0x01, 0x00, 0xc2, 0xbe, 0x8f, 0x42, 0xc2, 0x40, 0x90, 0x42, 0x4b, 0x27, 0x01, 0x00,
+        0xc2, 0x3e, 0x90, 0x42, 0xc2, 0xb6, 0x90, 0x42, 0x4c, 0x25, 0x01, 0x00, 0xc2, 0xbe, 0x90, 0x42,
+        0x2f, 0x2e, 0x91, 0x42, 0x4b, 0x2b, 0x01, 0x00, 0x78, 0x2c, 0x91, 0x42, 0x54, 0x93, 0x91, 0x42,
+        0x4c, 0x2c, 0x01, 0x00, 0x2f, 0x9a, 0x91, 0x42, 0x9d, 0x09, 0x92, 0x42, 0x4b, 0x25, 0x01, 0x00,
+        0xe6, 0x07, 0x92, 0x42, 0x54, 0x77, 0x92, 0x42, 0x4c, 0x24, 0x01, 0x00, 0x9d, 0x75, 0x92, 0x42,
+        0x0b, 0xe5, 0x92, 0x42, 0x4b, 0x28, 0x01, 0x00, 0x54, 0xe3, 0x92, 0x42, 0xa4, 0x52, 0x93, 0x42,
+        0x4c, 0x29, 0x01, 0x00, 0x0b, 0x51, 0x93, 0x42, 0x0b, 0xb9, 0x93, 0x42, 0x47, 0x24, 0x01, 0x00,
+        0x71, 0xb7, 0x93, 0x42, 0x71, 0x1f, 0x94, 0x42, 0x4a, 0x25, 0x01, 0x00, 0xd7, 0x1d, 0x94, 0x42,
+        0xd7, 0x85, 0x94, 0x42, 0x48, 0x2d, 0x01, 0x00, 0x3e, 0x84, 0x94, 0x42, 0xd7, 0x45, 0x95, 0x42,
+        0x45, 0x29, 0x01, 0x00, 0x3e, 0x84, 0x94, 0x42, 0x3e, 0xec, 0x94, 0x42, 0x2d, 0x29, 0x01, 0x00,
+        0xa4, 0xea, 0x94, 0x42, 0xa4, 0x52, 0x95, 0x42, 0x34, 0x2e, 0x01, 0x00, 0x0b, 0x51, 0x95, 0x42,
+        0x0b, 0xb1, 0x95, 0x42, 0x39, 0x2f, 0x01, 0x00, 0x71, 0xb7, 0x95, 0x42, 0x71, 0x1f, 0x96, 0x42,
+        0x3c, 0x2e, 0x01, 0x00, 0xd7, 0x1d, 0x96, 0x42, 0xd7, 0x85, 0x96, 0x42, 0x40, 0x32, 0x01, 0x00,
+        0x3e, 0x84, 0x96, 0x42, 0x3e, 0xec, 0x96, 0x42, 0x45, 0x34, 0x01, 0x00, 0xa4, 0xea, 0x96, 0x42,
+        0x3e, 0xac, 0x97, 0x42, 0x47, 0x37, 0x01, 0x00, 0xa4, 0xea, 0x96, 0x42, 0xa4, 0x52, 0x97, 0x42,
+        0x28, 0x2b, 0x01, 0x00, 0x0b, 0x51, 0x97, 0x42, 0x0b, 0xb9, 0x97, 0x42, 0x34, 0x2f, 0x01, 0x00,
+        0x71, 0xb7, 0x97, 0x42, 0x71, 0x17, 0x98, 0x42, 0x38, 0x2b, 0x01, 0x00, 0xd7, 0x1d, 0x98, 0x42,
+        0xd7, 0x85, 0x98, 0x42, 0x40, 0x2c, 0x01, 0x00, 0x3e, 0x84, 0x98, 0x42, 0x3e, 0xec, 0x98, 0x42,
+        0x44, 0x2f, 0x01, 0x00, 0xa4, 0xea, 0x98, 0x42, 0xa4, 0x52, 0x99, 0x42, 0x47, 0x2a, 0x01, 0x00,
+        0x0b, 0x51, 0x99, 0x42, 0xa4, 0x12, 0x9a, 0x42, 0x48, 0x2c, 0x01, 0x00, 0x0b, 0x51, 0x99, 0x42,
+        0x0b, 0xb9, 0x99, 0x42, 0x2d, 0x24, 0x01, 0x00, 0x71, 0xb7, 0x99, 0x42, 0x71, 0x1f, 0x9a, 0x42,
+        0x34, 0x23, 0x01, 0x00, 0xd7, 0x1d, 0x9a, 0x42, 0xd7, 0x7d, 0x9a, 0x42, 0x39, 0x2f, 0x01, 0x00,
+        0x3e, 0x84, 0x9a, 0x42, 0x3e, 0xec, 0x9a, 0x42, 0x40, 0x25, 0x01, 0x00, 0xa4, 0xea, 0x9a, 0x42,
+        0xa4, 0x52, 0x9b, 0x42, 0x4c, 0x30, 0x01, 0x00, 0x0b, 0x51, 0x9b, 0x42, 0x0b, 0xb9, 0x9b, 0x42,
+        0x4b, 0x29, 0x01, 0x00, 0x71, 0xb7, 0x9b, 0x42, 0x71, 0x1f, 0x9c, 0x42, 0x4c, 0x29, 0x01, 0x00,
+        0xd7, 0x1d, 0x9c, 0x42, 0xd7, 0x85, 0x9c, 0x42, 0x4b, 0x2d, 0x01, 0x00, 0x3e, 0x84, 0x9c, 0x42,
+        0x3e, 0xec, 0x9c, 0x42, 0x4c, 0x31, 0x01, 0x00, 0xa4, 0xea, 0x9c, 0x42, 0xa4, 0x52, 0x9d, 0x42,
+        0x47, 0x27, 0x01, 0x00, 0x0b, 0x51, 0x9d, 0x42, 0x0b, 0xb9, 0x9d, 0x42, 0x4a, 0x28, 0x01, 0x00,
+        0x71, 0xb7, 0x9d, 0x42, 0x71, 0x1f, 0x9e, 0x42, 0x48, 0x2b, 0x01, 0x00, 0xd7, 0x1d, 0x9e, 0x42,
+        0x71, 0xdf, 0x9e, 0x42, 0x45, 0x28, 0x01, 0x00, 0xd7, 0x1d, 0x9e, 0x42, 0xd7, 0x85, 0x9e, 0x42,
+        0x2d, 0x22, 0x01, 0x00, 0x3e, 0x84, 0x9e, 0x42, 0x3e, 0xec, 0x9e, 0x42, 0x34, 0x25, 0x01, 0x00,
+        0xa4, 0xea, 0x9e, 0x42, 0xa4, 0x4a, 0x9f, 0x42, 0x39, 0x2b, 0x01, 0x00, 0x0b, 0x51, 0x9f, 0x42,
+        0x0b, 0xb9, 0x9f, 0x42, 0x3c, 0x29, 0x01, 0x00, 0x71, 0xb7, 0x9f, 0x42, 0x71, 0x1f, 0xa0, 0x42,
+        0x40, 0x2e, 0x01, 0x00, 0xd7, 0x1d, 0xa0, 0x42, 0xd7, 0x85, 0xa0, 0x42, 0x45, 0x33, 0x01, 0x00,
+        0x3e, 0x84, 0xa0, 0x42, 0xd7, 0x45, 0xa1, 0x42, 0x47, 0x3a, 0x01, 0x00, 0x3e, 0x84, 0xa0, 0x42,
+        0x3e, 0xec, 0xa0, 0x42, 0x28, 0x2a, 0x01, 0x00, 0xa4, 0xea, 0xa0, 0x42, 0xa4, 0x52, 0xa1, 0x42,
+        0x34, 0x33, 0x01, 0x00, 0x0b, 0x51, 0xa1, 0x42, 0x0b, 0xb1, 0xa1, 0x42, 0x38, 0x31, 0x01, 0x00,
+        0x71, 0xb7, 0xa1, 0x42, 0x71, 0x1f, 0xa2, 0x42, 0x3e, 0x26, 0x01, 0x00, 0xd7, 0x1d, 0xa2, 0x42,
+        0xd7, 0x85, 0xa2, 0x42, 0x48, 0x29, 0x01, 0x00, 0x3e, 0x84, 0xa2, 0x42, 0x3e, 0xec, 0xa2, 0x42,
+        0x47, 0x2c, 0x01, 0x00, 0xa4, 0xea, 0xa2, 0x42, 0x3e, 0xac, 0xa3, 0x42, 0x45, 0x25, 0x01, 0x00,
+        0xa4, 0xea, 0xa2, 0x42, 0xa4, 0x52, 0xa3, 0x42, 0x2d, 0x26, 0x01, 0x00, 0x0b, 0x51, 0xa3, 0x42,
+        0x0b, 0xb9, 0xa3, 0x42, 0x34, 0x29, 0x01, 0x00, 0x71, 0xb7, 0xa3, 0x42, 0x71, 0x17, 0xa4, 0x42,
+        0x39, 0x2c, 0x01, 0x00, 0xd7, 0x1d, 0xa4, 0x42, 0xd7, 0x85, 0xa4, 0x42, 0x47, 0x26, 0x01, 0x00,
+        0x3e, 0x84, 0xa4, 0x42, 0x3e, 0xec, 0xa4, 0x42, 0x48, 0x3f, 0x01, 0x00, 0xa4, 0xea, 0xa4, 0x42,
+        0xa4, 0x52, 0xa5, 0x42, 0x4a, 0x54, 0x01, 0x00, 0x0b, 0x51, 0xa5, 0x42, 0x3e, 0x74, 0xa6, 0x42,
+        0x4c, 0x57, 0x01, 0x00, 0x0b, 0x51, 0xa5, 0x42, 0x0b, 0xb9, 0xa5, 0x42, 0x30, 0x4b, 0x01, 0x00,
+        0x71, 0xb7, 0xa5, 0x42, 0x71, 0x1f, 0xa6, 0x42, 0x37, 0x55, 0x01, 0x00, 0xd7, 0x1d, 0xa6, 0x42,
+        0xd7, 0x7d, 0xa6, 0x42, 0x3c, 0x62, 0x01, 0x00, 0x3e, 0x84, 0xa6, 0x42, 0x3e, 0xec, 0xa6, 0x42,
+        0x43, 0x41, 0x01, 0x00, 0xa4, 0xea, 0xa6, 0x42, 0xa4, 0x52, 0xa7, 0x42, 0x4d, 0x4f, 0x01, 0x00,
+        0x0b, 0x51, 0xa7, 0x42, 0x0b, 0xb9, 0xa7, 0x42, 0x4c, 0x52, 0x01, 0x00, 0x71, 0xb7, 0xa7, 0x42,
+        0xa4, 0xda, 0xa8, 0x42, 0x4a, 0x4f, 0x01, 0x00, 0x71, 0xb7, 0xa7, 0x42, 0x71, 0x1f, 0xa8, 0x42,
+        0x2b, 0x4c, 0x01, 0x00, 0xd7, 0x1d, 0xa8, 0x42, 0xd7, 0x85, 0xa8, 0x42, 0x37, 0x55, 0x01, 0x00,
+        0x3e, 0x84, 0xa8, 0x42, 0x3e, 0xe4, 0xa8, 0x42, 0x3b, 0x5b, 0x01, 0x00, 0xa4, 0xea, 0xa8, 0x42,
+        0xa4, 0x52, 0xa9, 0x42, 0x41, 0x3c, 0x01, 0x00, 0x0b, 0x51, 0xa9, 0x42, 0x0b, 0xb9, 0xa9, 0x42,
+        0x4c, 0x45, 0x01, 0x00, 0x71, 0xb7, 0xa9, 0x42, 0x71, 0x1f, 0xaa, 0x42, 0x4a, 0x4d, 0x01, 0x00,
+        0xd7, 0x1d, 0xaa, 0x42, 0x0b, 0x41, 0xab, 0x42, 0x48, 0x47, 0x01, 0x00, 0xd7, 0x1d, 0xaa, 0x42,
+        0xd7, 0x85, 0xaa, 0x42, 0x2d, 0x3f, 0x01, 0x00, 0x3e, 0x84, 0xaa, 0x42, 0x3e, 0xec, 0xaa, 0x42,
+        0x34, 0x45, 0x01, 0x00, 0xa4, 0xea, 0xaa, 0x42, 0xa4, 0x4a, 0xab, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x0b, 0x51, 0xab, 0x42, 0x0b, 0xb9, 0xab, 0x42, 0x40, 0x38, 0x01, 0x00, 0x71, 0xb7, 0xab, 0x42,
+        0x71, 0x1f, 0xac, 0x42, 0x4a, 0x48, 0x01, 0x00, 0xd7, 0x1d, 0xac, 0x42, 0xd7, 0x85, 0xac, 0x42,
+        0x48, 0x47, 0x01, 0x00, 0x3e, 0x84, 0xac, 0x42, 0xd7, 0x45, 0xad, 0x42, 0x47, 0x3c, 0x01, 0x00,
+        0x3e, 0x84, 0xac, 0x42, 0x71, 0xb7, 0xac, 0x42, 0x28, 0x30, 0x01, 0x00, 0xa4, 0xea, 0xac, 0x42,
+        0xa4, 0x52, 0xad, 0x42, 0x34, 0x3c, 0x01, 0x00, 0x0b, 0x51, 0xad, 0x42, 0x0b, 0xb1, 0xad, 0x42,
+        0x40, 0x4f, 0x01, 0x00, 0x71, 0xb7, 0xad, 0x42, 0x71, 0x1f, 0xae, 0x42, 0x40, 0x34, 0x01, 0x00,
+        0xd7, 0x1d, 0xae, 0x42, 0xd7, 0x7d, 0xae, 0x42, 0x4c, 0x42, 0x01, 0x00, 0x3e, 0x84, 0xae, 0x42,
+        0xac, 0xf3, 0xae, 0x42, 0x40, 0x31, 0x01, 0x00, 0xf5, 0xf1, 0xae, 0x42, 0xd0, 0x58, 0xaf, 0x42,
+        0x4c, 0x43, 0x01, 0x00, 0xab, 0x5f, 0xaf, 0x42, 0x19, 0xcf, 0xaf, 0x42, 0x4c, 0x31, 0x01, 0x00,
+        0x62, 0xcd, 0xaf, 0x42, 0x3e, 0x34, 0xb0, 0x42, 0x58, 0x3c, 0x01, 0x00, 0x19, 0x3b, 0xb0, 0x42,
+        0xa9, 0xaa, 0xb0, 0x42, 0x4b, 0x31, 0x01, 0x00, 0xd0, 0xa8, 0xb0, 0x42, 0x95, 0x17, 0xb1, 0x42,
+        0x4c, 0x33, 0x01, 0x00, 0xf7, 0x1e, 0xb1, 0x42, 0xf7, 0x96, 0xb1, 0x42, 0x4b, 0x30, 0x01, 0x00,
+        0x1f, 0x95, 0xb1, 0x42, 0xe3, 0x03, 0xb2, 0x42, 0x4c, 0x2e, 0x01, 0x00, 0x46, 0x0b, 0xb2, 0x42,
+        0x24, 0x83, 0xb2, 0x42, 0x4b, 0x2a, 0x01, 0x00, 0x6d, 0x81, 0xb2, 0x42, 0x49, 0xe8, 0xb2, 0x42,
+        0x4c, 0x2f, 0x01, 0x00, 0x24, 0xef, 0xb2, 0x42, 0x92, 0x5e, 0xb3, 0x42, 0x4b, 0x27, 0x01, 0x00,
+        0xdb, 0x5c, 0xb3, 0x42, 0x49, 0xcc, 0xb3, 0x42, 0x4c, 0x27, 0x01, 0x00, 0x92, 0xca, 0xb3, 0x42,
+        0xff, 0x39, 0xb4, 0x42, 0x4b, 0x28, 0x01, 0x00, 0x49, 0x38, 0xb4, 0x42, 0xb6, 0xa7, 0xb4, 0x42,
+        0x4c, 0x2a, 0x01, 0x00, 0xff, 0xa5, 0xb4, 0x42, 0x6d, 0x15, 0xb5, 0x42, 0x4b, 0x28, 0x01, 0x00,
+        0xb6, 0x13, 0xb5, 0x42, 0x07, 0x83, 0xb5, 0x42, 0x4c, 0x28, 0x01, 0x00, 0x6d, 0x81, 0xb5, 0x42,
+        0x6d, 0xe9, 0xb5, 0x42, 0x47, 0x25, 0x01, 0x00, 0xd3, 0xe7, 0xb5, 0x42, 0xd3, 0x4f, 0xb6, 0x42,
+        0x4a, 0x25, 0x01, 0x00, 0x3a, 0x4e, 0xb6, 0x42, 0x3a, 0xb6, 0xb6, 0x42, 0x48, 0x2a, 0x01, 0x00,
+        0xa0, 0xb4, 0xb6, 0x42, 0x3a, 0x76, 0xb7, 0x42, 0x45, 0x2b, 0x01, 0x00, 0xa0, 0xb4, 0xb6, 0x42,
+        0xa0, 0x1c, 0xb7, 0x42, 0x2d, 0x25, 0x01, 0x00, 0x07, 0x1b, 0xb7, 0x42, 0x07, 0x83, 0xb7, 0x42,
+        0x34, 0x29, 0x01, 0x00, 0x6d, 0x81, 0xb7, 0x42, 0x6d, 0xe1, 0xb7, 0x42, 0x39, 0x2d, 0x01, 0x00,
+        0xd3, 0xe7, 0xb7, 0x42, 0xd3, 0x4f, 0xb8, 0x42, 0x3c, 0x27, 0x01, 0x00, 0x3a, 0x4e, 0xb8, 0x42,
+        0x3a, 0xb6, 0xb8, 0x42, 0x40, 0x28, 0x01, 0x00, 0xa0, 0xb4, 0xb8, 0x42, 0xa0, 0x1c, 0xb9, 0x42,
+        0x45, 0x32, 0x01, 0x00, 0x07, 0x1b, 0xb9, 0x42, 0xa0, 0xdc, 0xb9, 0x42, 0x47, 0x34, 0x01, 0x00,
+        0x07, 0x1b, 0xb9, 0x42, 0x07, 0x83, 0xb9, 0x42, 0x28, 0x27, 0x01, 0x00, 0x6d, 0x81, 0xb9, 0x42,
+        0x6d, 0xe9, 0xb9, 0x42, 0x34, 0x2b, 0x01, 0x00, 0xd3, 0xe7, 0xb9, 0x42, 0xd3, 0x47, 0xba, 0x42,
+        0x38, 0x2e, 0x01, 0x00, 0x3a, 0x4e, 0xba, 0x42, 0x3a, 0xb6, 0xba, 0x42, 0x40, 0x29, 0x01, 0x00,
+        0xa0, 0xb4, 0xba, 0x42, 0xa0, 0x1c, 0xbb, 0x42, 0x44, 0x2a, 0x01, 0x00, 0x07, 0x1b, 0xbb, 0x42,
+        0x07, 0x83, 0xbb, 0x42, 0x47, 0x30, 0x01, 0x00, 0x6d, 0x81, 0xbb, 0x42, 0x07, 0x43, 0xbc, 0x42,
+        0x48, 0x34, 0x01, 0x00, 0x6d, 0x81, 0xbb, 0x42, 0x6d, 0xe9, 0xbb, 0x42, 0x2d, 0x26, 0x01, 0x00,
+        0xd3, 0xe7, 0xbb, 0x42, 0xd3, 0x4f, 0xbc, 0x42, 0x34, 0x2c, 0x01, 0x00, 0x3a, 0x4e, 0xbc, 0x42,
+        0x3a, 0xae, 0xbc, 0x42, 0x39, 0x2c, 0x01, 0x00, 0xa0, 0xb4, 0xbc, 0x42, 0xa0, 0x1c, 0xbd, 0x42,
+        0x40, 0x29, 0x01, 0x00, 0x07, 0x1b, 0xbd, 0x42, 0x07, 0x83, 0xbd, 0x42, 0x4c, 0x33, 0x01, 0x00,
+        0x6d, 0x81, 0xbd, 0x42, 0x6d, 0xe9, 0xbd, 0x42, 0x4b, 0x29, 0x01, 0x00, 0xd3, 0xe7, 0xbd, 0x42,
+        0xd3, 0x4f, 0xbe, 0x42, 0x4c, 0x2b, 0x01, 0x00, 0x3a, 0x4e, 0xbe, 0x42, 0x3a, 0xb6, 0xbe, 0x42,
+        0x4b, 0x2d, 0x01, 0x00, 0xa0, 0xb4, 0xbe, 0x42, 0xa0, 0x1c, 0xbf, 0x42, 0x4c, 0x33, 0x01, 0x00,
+        0x07, 0x1b, 0xbf, 0x42, 0x07, 0x83, 0xbf, 0x42, 0x47, 0x27, 0x01, 0x00, 0x6d, 0x81, 0xbf, 0x42,
+        0x6d, 0xe9, 0xbf, 0x42, 0x4a, 0x2c, 0x01, 0x00, 0xd3, 0xe7, 0xbf, 0x42, 0xd3, 0x4f, 0xc0, 0x42,
+        0x48, 0x29, 0x01, 0x00, 0x3a, 0x4e, 0xc0, 0x42, 0xd3, 0x0f, 0xc1, 0x42, 0x45, 0x26, 0x01, 0x00,
+        0x3a, 0x4e, 0xc0, 0x42, 0x3a, 0xb6, 0xc0, 0x42, 0x2d, 0x22, 0x01, 0x00, 0xa0, 0xb4, 0xc0, 0x42,
+        0xa0, 0x1c, 0xc1, 0x42, 0x34, 0x24, 0x01, 0x00, 0x07, 0x1b, 0xc1, 0x42, 0x07, 0x7b, 0xc1, 0x42,
+        0x39, 0x2d, 0x01, 0x00, 0x6d, 0x81, 0xc1, 0x42, 0x6d, 0xe9, 0xc1, 0x42, 0x3c, 0x25, 0x01, 0x00,
+        0xd3, 0xe7, 0xc1, 0x42, 0xd3, 0x4f, 0xc2, 0x42, 0x40, 0x2d, 0x01, 0x00, 0x3a, 0x4e, 0xc2, 0x42,
+        0x3a, 0xb6, 0xc2, 0x42, 0x45, 0x31, 0x01, 0x00, 0xa0, 0xb4, 0xc2, 0x42, 0x3a, 0x76, 0xc3, 0x42,
+        0x47, 0x30, 0x01, 0x00, 0xa0, 0xb4, 0xc2, 0x42, 0xa0, 0x1c, 0xc3, 0x42, 0x28, 0x28, 0x01, 0x00,
+        0x07, 0x1b, 0xc3, 0x42, 0x07, 0x83, 0xc3, 0x42, 0x34, 0x2b, 0x01, 0x00, 0x6d, 0x81, 0xc3, 0x42,
+        0x6d, 0xe1, 0xc3, 0x42, 0x38, 0x2c, 0x01, 0x00, 0xd3, 0xe7, 0xc3, 0x42, 0xd3, 0x4f, 0xc4, 0x42,
+        0x3e, 0x2a, 0x01, 0x00, 0x3a, 0x4e, 0xc4, 0x42, 0x3a, 0xb6, 0xc4, 0x42, 0x48, 0x34, 0x01, 0x00,
+        0xa0, 0xb4, 0xc4, 0x42, 0xa0, 0x1c, 0xc5, 0x42, 0x47, 0x2b, 0x01, 0x00, 0x07, 0x1b, 0xc5, 0x42,
+        0xa0, 0xdc, 0xc5, 0x42, 0x45, 0x34, 0x01, 0x00, 0x07, 0x1b, 0xc5, 0x42, 0x3a, 0x4e, 0xc5, 0x42,
+        0x2d, 0x32, 0x01, 0x00, 0x6d, 0x81, 0xc5, 0x42, 0xa0, 0xb4, 0xc5, 0x42, 0x2d, 0x36, 0x01, 0x00,
+        0xd3, 0xe7, 0xc5, 0x42, 0x07, 0x1b, 0xc6, 0x42, 0x2d, 0x42, 0x01, 0x00, 0x3a, 0x4e, 0xc6, 0x42,
+        0x6d, 0x81, 0xc6, 0x42, 0x2d, 0x3e, 0x01, 0x00, 0xa0, 0xb4, 0xc6, 0x42, 0xd3, 0xe7, 0xc6, 0x42,
+        0x2d, 0x3f, 0x01, 0x00, 0x07, 0x1b, 0xc7, 0x42, 0x3a, 0x4e, 0xc7, 0x42, 0x2d, 0x3e, 0x01, 0x00,
+        0x6d, 0x81, 0xc7, 0x42, 0xd3, 0xe7, 0xc9, 0x42, 0x40, 0x3c, 0x01, 0x00, 0x6d, 0x81, 0xc7, 0x42,
+        0xd3, 0xe7, 0xc9, 0x42, 0x43, 0x3c, 0x01, 0x00, 0x6d, 0x81, 0xc7, 0x42, 0xd3, 0xe7, 0xc9, 0x42,
+        0x46, 0x3c, 0x01, 0x00, 0x6d, 0x81, 0xc7, 0x42, 0xd3, 0xe7, 0xc9, 0x42, 0x49, 0x3c, 0x01, 0x00,
+        0x6d, 0x81, 0xc7, 0x42, 0xa0, 0xb4, 0xc7, 0x42, 0x2d, 0x46, 0x01, 0x00, 0xd3, 0xe7, 0xc7, 0x42,
+        0x07, 0x1b, 0xc8, 0x42, 0x2d, 0x49, 0x01, 0x00, 0x3a, 0x4e, 0xc8, 0x42, 0x6d, 0x81, 0xc8, 0x42,
+        0x2d, 0x49, 0x01, 0x00, 0xa0, 0xb4, 0xc8, 0x42, 0xd3, 0xe7, 0xc8, 0x42, 0x2d, 0x4b, 0x01, 0x00,
+        0x07, 0x1b, 0xc9, 0x42, 0x3a, 0x4e, 0xc9, 0x42, 0x2d, 0x44, 0x01, 0x00, 0x6d, 0x81, 0xc9, 0x42,
+        0xa0, 0xb4, 0xc9, 0x42, 0x2d, 0x4d, 0x01, 0x00, 0xd3, 0xe7, 0xc9, 0x42, 0x6d, 0x81, 0xcb, 0x42,
+        0x41, 0x41, 0x01, 0x00, 0xd3, 0xe7, 0xc9, 0x42, 0x6d, 0x81, 0xcb, 0x42, 0x45, 0x41, 0x01, 0x00,
+        0xd3, 0xe7, 0xc9, 0x42, 0x6d, 0x81, 0xcb, 0x42, 0x4a, 0x41, 0x01, 0x00, 0xd3, 0xe7, 0xc9, 0x42,
+        0x07, 0x1b, 0xca, 0x42, 0x2d, 0x55, 0x01, 0x00, 0x3a, 0x4e, 0xca, 0x42, 0x6d, 0x81, 0xca, 0x42,
+        0x2d, 0x4b, 0x01, 0x00, 0xa0, 0xb4, 0xca, 0x42, 0xd3, 0xe7, 0xca, 0x42, 0x2d, 0x48, 0x01, 0x00,
+        0x07, 0x1b, 0xcb, 0x42, 0x3a, 0x4e, 0xcb, 0x42, 0x2d, 0x4c, 0x01, 0x00, 0x6d, 0x81, 0xcb, 0x42,
+        0xd3, 0xe7, 0xcb, 0x42, 0x49, 0x41, 0x01, 0x00, 0x6d, 0x81, 0xcb, 0x42, 0xd3, 0xe7, 0xcb, 0x42,
+        0x4c, 0x41, 0x01, 0x00, 0x6d, 0x81, 0xcb, 0x42, 0xa0, 0xb4, 0xcb, 0x42, 0x2d, 0x4c, 0x01, 0x00,
+        0xd3, 0xe7, 0xcb, 0x42, 0x3a, 0x4e, 0xcc, 0x42, 0x4a, 0x3c, 0x01, 0x00, 0xd3, 0xe7, 0xcb, 0x42,
+        0x3a, 0x4e, 0xcc, 0x42, 0x4d, 0x3c, 0x01, 0x00, 0xd3, 0xe7, 0xcb, 0x42, 0x07, 0x1b, 0xcc, 0x42,
+        0x2d, 0x4a, 0x01, 0x00, 0x3a, 0x4e, 0xcc, 0x42, 0xd3, 0xe7, 0xcd, 0x42, 0x44, 0x53, 0x01, 0x00,
+        0x3a, 0x4e, 0xcc, 0x42, 0xd3, 0xe7, 0xcd, 0x42, 0x4a, 0x53, 0x01, 0x00, 0x3a, 0x4e, 0xcc, 0x42,
+        0xd3, 0xe7, 0xcd, 0x42, 0x4d, 0x53, 0x01, 0x00, 0x3a, 0x4e, 0xcc, 0x42, 0x6d, 0x81, 0xcc, 0x42,
+        0x2d, 0x47, 0x01, 0x00, 0xa0, 0xb4, 0xcc, 0x42, 0xd3, 0xe7, 0xcc, 0x42, 0x2d, 0x4a, 0x01, 0x00,
+        0x07, 0x1b, 0xcd, 0x42, 0x3a, 0x4e, 0xcd, 0x42, 0x2d, 0x45, 0x01, 0x00, 0x6d, 0x81, 0xcd, 0x42,
+        0xa0, 0xb4, 0xcd, 0x42, 0x2d, 0x47, 0x01, 0x00, 0xd3, 0xe7, 0xcd, 0x42, 0xa0, 0xb4, 0xce, 0x42,
+        0x44, 0x57, 0x01, 0x00, 0xd3, 0xe7, 0xcd, 0x42, 0xa0, 0xb4, 0xce, 0x42, 0x4a, 0x57, 0x01, 0x00,
+        0xd3, 0xe7, 0xcd, 0x42, 0xa0, 0xb4, 0xce, 0x42, 0x4d, 0x57, 0x01, 0x00, 0xd3, 0xe7, 0xcd, 0x42,
+        0x07, 0x1b, 0xce, 0x42, 0x2d, 0x46, 0x01, 0x00, 0x3a, 0x4e, 0xce, 0x42, 0x6d, 0x81, 0xce, 0x42,
+        0x2d, 0x45, 0x01, 0x00, 0xa0, 0xb4, 0xce, 0x42, 0x07, 0x1b, 0xd1, 0x42, 0x45, 0x4e, 0x01, 0x00,
+        0xa0, 0xb4, 0xce, 0x42, 0x07, 0x1b, 0xd1, 0x42, 0x48, 0x4e, 0x01, 0x00, 0xa0, 0xb4, 0xce, 0x42,
+        0x07, 0x1b, 0xd1, 0x42, 0x4c, 0x4e, 0x01, 0x00, 0xa0, 0xb4, 0xce, 0x42, 0xd3, 0xe7, 0xce, 0x42,
+        0x2d, 0x46, 0x01, 0x00, 0x07, 0x1b, 0xcf, 0x42, 0x3a, 0x4e, 0xcf, 0x42, 0x2d, 0x47, 0x01, 0x00,
+        0x6d, 0x81, 0xcf, 0x42, 0xa0, 0xb4, 0xcf, 0x42, 0x2d, 0x4b, 0x01, 0x00, 0xd3, 0xe7, 0xcf, 0x42,
+        0x07, 0x1b, 0xd0, 0x42, 0x2d, 0x49, 0x01, 0x00, 0x3a, 0x4e, 0xd0, 0x42, 0x6d, 0x81, 0xd0, 0x42,
+        0x2d, 0x48, 0x01, 0x00, 0xa0, 0xb4, 0xd0, 0x42, 0xd3, 0xe7, 0xd0, 0x42, 0x2d, 0x47, 0x01, 0x00,
+        0x07, 0x1b, 0xd1, 0x42, 0xa0, 0xbc, 0xd2, 0x42, 0x41, 0x43, 0x01, 0x00, 0x07, 0x1b, 0xd1, 0x42,
+        0xa0, 0xbc, 0xd2, 0x42, 0x4a, 0x43, 0x01, 0x00, 0x07, 0x1b, 0xd1, 0x42, 0x3a, 0x4e, 0xd1, 0x42,
+        0x26, 0x42, 0x01, 0x00, 0x07, 0x1b, 0xd1, 0x42, 0x3a, 0x4e, 0xd1, 0x42, 0x2d, 0x42, 0x01, 0x00,
+        0x6d, 0x81, 0xd1, 0x42, 0xa0, 0xb4, 0xd1, 0x42, 0x26, 0x45, 0x01, 0x00, 0x6d, 0x81, 0xd1, 0x42,
+        0xa0, 0xb4, 0xd1, 0x42, 0x2d, 0x45, 0x01, 0x00, 0xd3, 0xe7, 0xd1, 0x42, 0x07, 0x1b, 0xd2, 0x42,
+        0x26, 0x41, 0x01, 0x00, 0xd3, 0xe7, 0xd1, 0x42, 0x07, 0x1b, 0xd2, 0x42, 0x2d, 0x41, 0x01, 0x00,
+        0x3a, 0x4e, 0xd2, 0x42, 0x6d, 0x81, 0xd2, 0x42, 0x26, 0x40, 0x01, 0x00, 0x3a, 0x4e, 0xd2, 0x42,
+        0x6d, 0x81, 0xd2, 0x42, 0x2d, 0x40, 0x01, 0x00, 0xa0, 0xb4, 0xd2, 0x42, 0xa0, 0x1c, 0xd3, 0x42,
+        0x40, 0x40, 0x01, 0x00, 0xa0, 0xb4, 0xd2, 0x42, 0xa0, 0x1c, 0xd3, 0x42, 0x48, 0x40, 0x01, 0x00,
+        0xa0, 0xb4, 0xd2, 0x42, 0xd3, 0xe7, 0xd2, 0x42, 0x26, 0x45, 0x01, 0x00, 0xa0, 0xb4, 0xd2, 0x42,
+        0xd3, 0xe7, 0xd2, 0x42, 0x2d, 0x45, 0x01, 0x00, 0x07, 0x1b, 0xd3, 0x42, 0x07, 0x83, 0xd3, 0x42,
+        0x3e, 0x48, 0x01, 0x00, 0x07, 0x1b, 0xd3, 0x42, 0x07, 0x83, 0xd3, 0x42, 0x47, 0x48, 0x01, 0x00,
+        0x07, 0x1b, 0xd3, 0x42, 0x3a, 0x4e, 0xd3, 0x42, 0x26, 0x43, 0x01, 0x00, 0x07, 0x1b, 0xd3, 0x42,
+        0x3a, 0x4e, 0xd3, 0x42, 0x2d, 0x43, 0x01, 0x00, 0x6d, 0x81, 0xd3, 0x42, 0x3a, 0x06, 0xd5, 0x42,
+        0x3c, 0x44, 0x01, 0x00, 0x6d, 0x81, 0xd3, 0x42, 0x3a, 0x06, 0xd5, 0x42, 0x42, 0x44, 0x01, 0x00,
+        0x6d, 0x81, 0xd3, 0x42, 0x3a, 0x06, 0xd5, 0x42, 0x45, 0x44, 0x01, 0x00, 0x6d, 0x81, 0xd3, 0x42,
+        0xa0, 0xb4, 0xd3, 0x42, 0x27, 0x3b, 0x01, 0x00, 0x6d, 0x81, 0xd3, 0x42, 0xa0, 0xb4, 0xd3, 0x42,
+        0x2d, 0x3b, 0x01, 0x00, 0xd3, 0xe7, 0xd3, 0x42, 0x07, 0x1b, 0xd4, 0x42, 0x27, 0x3e, 0x01, 0x00,
+        0xd3, 0xe7, 0xd3, 0x42, 0x07, 0x1b, 0xd4, 0x42, 0x2d, 0x3e, 0x01, 0x00, 0x3a, 0x4e, 0xd4, 0x42,
+        0x6d, 0x81, 0xd4, 0x42, 0x27, 0x43, 0x01, 0x00, 0x3a, 0x4e, 0xd4, 0x42, 0x6d, 0x81, 0xd4, 0x42,
+        0x2d, 0x43, 0x01, 0x00, 0xa0, 0xb4, 0xd4, 0x42, 0xd3, 0xe7, 0xd4, 0x42, 0x27, 0x3d, 0x01, 0x00,
+        0xa0, 0xb4, 0xd4, 0x42, 0xd3, 0xe7, 0xd4, 0x42, 0x2d, 0x3d, 0x01, 0x00, 0x07, 0x1b, 0xd5, 0x42,
+        0xd3, 0xe7, 0xd5, 0x42, 0x3c, 0x4c, 0x01, 0x00, 0x07, 0x1b, 0xd5, 0x42, 0xd3, 0xe7, 0xd5, 0x42,
+        0x45, 0x4c, 0x01, 0x00, 0x07, 0x1b, 0xd5, 0x42, 0x3a, 0x4e, 0xd5, 0x42, 0x27, 0x3f, 0x01, 0x00,
+        0x07, 0x1b, 0xd5, 0x42, 0x3a, 0x4e, 0xd5, 0x42, 0x2d, 0x3f, 0x01, 0x00, 0x6d, 0x81, 0xd5, 0x42,
+        0xa0, 0xb4, 0xd5, 0x42, 0x27, 0x40, 0x01, 0x00, 0x6d, 0x81, 0xd5, 0x42, 0xa0, 0xb4, 0xd5, 0x42,
+        0x2d, 0x40, 0x01, 0x00, 0xd3, 0xe7, 0xd5, 0x42, 0xd3, 0xb7, 0xd6, 0x42, 0x3c, 0x4b, 0x01, 0x00,
+        0xd3, 0xe7, 0xd5, 0x42, 0xd3, 0xb7, 0xd6, 0x42, 0x45, 0x4b, 0x01, 0x00, 0xd3, 0xe7, 0xd5, 0x42,
+        0x07, 0x1b, 0xd6, 0x42, 0x28, 0x41, 0x01, 0x00, 0xd3, 0xe7, 0xd5, 0x42, 0x07, 0x1b, 0xd6, 0x42,
+        0x2d, 0x41, 0x01, 0x00, 0x3a, 0x4e, 0xd6, 0x42, 0x6d, 0x81, 0xd6, 0x42, 0x28, 0x40, 0x01, 0x00,
+        0x3a, 0x4e, 0xd6, 0x42, 0x6d, 0x81, 0xd6, 0x42, 0x2d, 0x40, 0x01, 0x00, 0xa0, 0xb4, 0xd6, 0x42,
+        0xa0, 0x84, 0xd7, 0x42, 0x40, 0x50, 0x01, 0x00, 0xa0, 0xb4, 0xd6, 0x42, 0xa0, 0x84, 0xd7, 0x42,
+        0x48, 0x50, 0x01, 0x00, 0xa0, 0xb4, 0xd6, 0x42, 0xd3, 0xe7, 0xd6, 0x42, 0x28, 0x3e, 0x01, 0x00,
+        0xa0, 0xb4, 0xd6, 0x42, 0xd3, 0xe7, 0xd6, 0x42, 0x2d, 0x3e, 0x01, 0x00, 0x07, 0x1b, 0xd7, 0x42,
+        0x3a, 0x4e, 0xd7, 0x42, 0x28, 0x3d, 0x01, 0x00, 0x07, 0x1b, 0xd7, 0x42, 0x3a, 0x4e, 0xd7, 0x42,
+        0x2d, 0x3d, 0x01, 0x00, 0x6d, 0x81, 0xd7, 0x42, 0x6d, 0x51, 0xd8, 0x42, 0x3e, 0x48, 0x01, 0x00,
+        0x6d, 0x81, 0xd7, 0x42, 0x6d, 0x51, 0xd8, 0x42, 0x47, 0x48, 0x01, 0x00, 0x6d, 0x81, 0xd7, 0x42,
+        0xa0, 0xb4, 0xd7, 0x42, 0x28, 0x40, 0x01, 0x00, 0x6d, 0x81, 0xd7, 0x42, 0xa0, 0xb4, 0xd7, 0x42,
+        0x2c, 0x40, 0x01, 0x00, 0xd3, 0xe7, 0xd7, 0x42, 0x07, 0x1b, 0xd8, 0x42, 0x28, 0x42, 0x01, 0x00,
+        0xd3, 0xe7, 0xd7, 0x42, 0x07, 0x1b, 0xd8, 0x42, 0x2c, 0x42, 0x01, 0x00, 0x3a, 0x4e, 0xd8, 0x42,
+        0xa0, 0x94, 0xda, 0x42, 0x3c, 0x35, 0x01, 0x00, 0x3a, 0x4e, 0xd8, 0x42, 0xa0, 0x94, 0xda, 0x42,
+        0x45, 0x35, 0x01, 0x00, 0x3a, 0x4e, 0xd8, 0x42, 0x6d, 0x81, 0xd8, 0x42, 0x21, 0x3c, 0x01, 0x00,
+        0x3a, 0x4e, 0xd8, 0x42, 0x6d, 0x81, 0xd8, 0x42, 0x2d, 0x3c, 0x01, 0x00, 0xa0, 0xb4, 0xd8, 0x42,
+        0xd3, 0xe7, 0xd8, 0x42, 0x2d, 0x30, 0x01, 0x00, 0x07, 0x1b, 0xd9, 0x42, 0x3a, 0x4e, 0xd9, 0x42,
+        0x2d, 0x37, 0x01, 0x00, 0x6d, 0x81, 0xd9, 0x42, 0xa0, 0xb4, 0xd9, 0x42, 0x2d, 0x35, 0x01, 0x00,
+        0xd3, 0xe7, 0xd9, 0x42, 0x07, 0x1b, 0xda, 0x42, 0x2d, 0x2d, 0x01, 0x00, 0x3a, 0x4e, 0xda, 0x42,
+        0x6d, 0x81, 0xda, 0x42, 0x2d, 0x31, 0x01, 0x00, 0xa0, 0xb4, 0xda, 0x42, 0x07, 0x1b, 0xdd, 0x42,
+        0x40, 0x43, 0x01, 0x00, 0xa0, 0xb4, 0xda, 0x42, 0x07, 0x1b, 0xdd, 0x42, 0x43, 0x43, 0x01, 0x00,
+        0xa0, 0xb4, 0xda, 0x42, 0x07, 0x1b, 0xdd, 0x42, 0x46, 0x43, 0x01, 0x00, 0xa0, 0xb4, 0xda, 0x42,
+        0x07, 0x1b, 0xdd, 0x42, 0x49, 0x43, 0x01, 0x00, 0xa0, 0xb4, 0xda, 0x42, 0xd3, 0xe7, 0xda, 0x42,
+        0x2d, 0x39, 0x01, 0x00, 0x07, 0x1b, 0xdb, 0x42, 0x3a, 0x4e, 0xdb, 0x42, 0x2d, 0x3a, 0x01, 0x00,
+        0x6d, 0x81, 0xdb, 0x42, 0xa0, 0xb4, 0xdb, 0x42, 0x2d, 0x3a, 0x01, 0x00, 0xd3, 0xe7, 0xdb, 0x42,
+        0x07, 0x1b, 0xdc, 0x42, 0x2d, 0x37, 0x01, 0x00, 0x3a, 0x4e, 0xdc, 0x42, 0x6d, 0x81, 0xdc, 0x42,
+        0x2d, 0x39, 0x01, 0x00, 0xa0, 0xb4, 0xdc, 0x42, 0xd3, 0xe7, 0xdc, 0x42, 0x2d, 0x3b, 0x01, 0x00,
+        0x07, 0x1b, 0xdd, 0x42, 0xa0, 0xb4, 0xde, 0x42, 0x41, 0x40, 0x01, 0x00, 0x07, 0x1b, 0xdd, 0x42,
+        0xa0, 0xb4, 0xde, 0x42, 0x45, 0x40, 0x01, 0x00, 0x07, 0x1b, 0xdd, 0x42, 0xa0, 0xb4, 0xde, 0x42,
+        0x4a, 0x40, 0x01, 0x00, 0x07, 0x1b, 0xdd, 0x42, 0x3a, 0x4e, 0xdd, 0x42, 0x2d, 0x40, 0x01, 0x00,
+        0x6d, 0x81, 0xdd, 0x42, 0xa0, 0xb4, 0xdd, 0x42, 0x2d, 0x3e, 0x01, 0x00, 0xd3, 0xe7, 0xdd, 0x42,
+        0x07, 0x1b, 0xde, 0x42, 0x2d, 0x39, 0x01, 0x00, 0x3a, 0x4e, 0xde, 0x42, 0x6d, 0x81, 0xde, 0x42,
+        0x2d, 0x3f, 0x01, 0x00, 0xa0, 0xb4, 0xde, 0x42, 0x07, 0x1b, 0xdf, 0x42, 0x49, 0x44, 0x01, 0x00,
+        0xa0, 0xb4, 0xde, 0x42, 0x07, 0x1b, 0xdf, 0x42, 0x4c, 0x44, 0x01, 0x00, 0xa0, 0xb4, 0xde, 0x42,
+        0xd3, 0xe7, 0xde, 0x42, 0x2d, 0x3e, 0x01, 0x00, 0x07, 0x1b, 0xdf, 0x42, 0x6d, 0x81, 0xdf, 0x42,
+        0x4a, 0x3e, 0x01, 0x00, 0x07, 0x1b, 0xdf, 0x42, 0x6d, 0x81, 0xdf, 0x42, 0x4d, 0x3e, 0x01, 0x00,
+        0x07, 0x1b, 0xdf, 0x42, 0x3a, 0x4e, 0xdf, 0x42, 0x2d, 0x44, 0x01, 0x00, 0x6d, 0x81, 0xdf, 0x42,
+        0x07, 0x1b, 0xe1, 0x42, 0x4a, 0x5f, 0x01, 0x00, 0x6d, 0x81, 0xdf, 0x42, 0x07, 0x1b, 0xe1, 0x42,
+        0x4d, 0x5f, 0x01, 0x00, 0x6d, 0x81, 0xdf, 0x42, 0xa0, 0xb4, 0xdf, 0x42, 0x2d, 0x47, 0x01, 0x00,
+        0xd3, 0xe7, 0xdf, 0x42, 0x07, 0x1b, 0xe0, 0x42, 0x2d, 0x47, 0x01, 0x00, 0x3a, 0x4e, 0xe0, 0x42,
+        0x6d, 0x81, 0xe0, 0x42, 0x2d, 0x45, 0x01, 0x00, 0xa0, 0xb4, 0xe0, 0x42, 0xd3, 0xe7, 0xe0, 0x42,
+        0x2d, 0x48, 0x01, 0x00, 0x07, 0x1b, 0xe1, 0x42, 0xd3, 0xe7, 0xe1, 0x42, 0x4a, 0x64, 0x01, 0x00,
+        0x07, 0x1b, 0xe1, 0x42, 0xd3, 0xe7, 0xe1, 0x42, 0x4d, 0x64, 0x01, 0x00, 0x07, 0x1b, 0xe1, 0x42,
+        0x3a, 0x4e, 0xe1, 0x42, 0x2d, 0x44, 0x01, 0x00, 0x6d, 0x81, 0xe1, 0x42, 0xa0, 0xb4, 0xe1, 0x42,
+        0x2d, 0x46, 0x01, 0x00, 0xd3, 0xe7, 0xe1, 0x42, 0x3a, 0x4e, 0xe4, 0x42, 0x4a, 0x60, 0x01, 0x00,
+        0xd3, 0xe7, 0xe1, 0x42, 0x3a, 0x4e, 0xe4, 0x42, 0x4d, 0x60, 0x01, 0x00, 0xd3, 0xe7, 0xe1, 0x42,
+        0x07, 0x1b, 0xe2, 0x42, 0x2e, 0x4d, 0x01, 0x00, 0x3a, 0x4e, 0xe2, 0x42, 0x6d, 0x81, 0xe2, 0x42,
+        0x2e, 0x45, 0x01, 0x00, 0xa0, 0xb4, 0xe2, 0x42, 0xd3, 0xe7, 0xe2, 0x42, 0x2e, 0x45, 0x01, 0x00,
+        0x07, 0x1b, 0xe3, 0x42, 0x3a, 0x4e, 0xe3, 0x42, 0x2e, 0x47, 0x01, 0x00, 0x6d, 0x81, 0xe3, 0x42,
+        0xa0, 0xb4, 0xe3, 0x42, 0x2e, 0x48, 0x01, 0x00, 0xd3, 0xe7, 0xe3, 0x42, 0x07, 0x1b, 0xe4, 0x42,
+        0x2e, 0x4b, 0x01, 0x00, 0x3a, 0x4e, 0xe4, 0x42, 0xd3, 0xe7, 0xe5, 0x42, 0x43, 0x53, 0x01, 0x00,
+        0x3a, 0x4e, 0xe4, 0x42, 0xd3, 0xe7, 0xe5, 0x42, 0x4b, 0x53, 0x01, 0x00, 0x3a, 0x4e, 0xe4, 0x42,
+        0x6d, 0x81, 0xe4, 0x42, 0x2e, 0x3e, 0x01, 0x00, 0xa0, 0xb4, 0xe4, 0x42, 0xd3, 0xe7, 0xe4, 0x42,
+        0x2e, 0x43, 0x01, 0x00, 0x07, 0x1b, 0xe5, 0x42, 0x3a, 0x4e, 0xe5, 0x42, 0x2e, 0x3e, 0x01, 0x00,
+        0x6d, 0x81, 0xe5, 0x42, 0xa0, 0xb4, 0xe5, 0x42, 0x2e, 0x3d, 0x01, 0x00, 0xd3, 0xe7, 0xe5, 0x42,
+        0x3a, 0x4e, 0xe6, 0x42, 0x41, 0x53, 0x01, 0x00, 0xd3, 0xe7, 0xe5, 0x42, 0x3a, 0x4e, 0xe6, 0x42,
+        0x4a, 0x53, 0x01, 0x00, 0xd3, 0xe7, 0xe5, 0x42, 0x07, 0x1b, 0xe6, 0x42, 0x2e, 0x41, 0x01, 0x00,
+        0x3a, 0x4e, 0xe6, 0x42, 0xa0, 0xb4, 0xe6, 0x42, 0x3f, 0x51, 0x01, 0x00, 0x3a, 0x4e, 0xe6, 0x42,
+        0xa0, 0xb4, 0xe6, 0x42, 0x48, 0x51, 0x01, 0x00, 0x3a, 0x4e, 0xe6, 0x42, 0x6d, 0x81, 0xe6, 0x42,
+        0x2e, 0x3f, 0x01, 0x00, 0xa0, 0xb4, 0xe6, 0x42, 0x3a, 0x4e, 0xe8, 0x42, 0x3e, 0x4a, 0x01, 0x00,
+        0xa0, 0xb4, 0xe6, 0x42, 0x3a, 0x4e, 0xe8, 0x42, 0x41, 0x4a, 0x01, 0x00, 0xa0, 0xb4, 0xe6, 0x42,
+        0x3a, 0x4e, 0xe8, 0x42, 0x46, 0x4a, 0x01, 0x00, 0xa0, 0xb4, 0xe6, 0x42, 0xd3, 0xe7, 0xe6, 0x42,
+        0x2e, 0x35, 0x01, 0x00, 0x07, 0x1b, 0xe7, 0x42, 0x3a, 0x4e, 0xe7, 0x42, 0x2e, 0x32, 0x01, 0x00,
+        0x6d, 0x81, 0xe7, 0x42, 0xa0, 0xb4, 0xe7, 0x42, 0x2e, 0x33, 0x01, 0x00, 0xd3, 0xe7, 0xe7, 0x42,
+        0x07, 0x1b, 0xe8, 0x42, 0x2e, 0x33, 0x01, 0x00, 0x3a, 0x4e, 0xe8, 0x42, 0x07, 0x1b, 0xe9, 0x42,
+        0x3e, 0x4e, 0x01, 0x00, 0x3a, 0x4e, 0xe8, 0x42, 0x07, 0x1b, 0xe9, 0x42, 0x41, 0x4e, 0x01, 0x00,
+        0x3a, 0x4e, 0xe8, 0x42, 0x07, 0x1b, 0xe9, 0x42, 0x45, 0x4e, 0x01, 0x00, 0x3a, 0x4e, 0xe8, 0x42,
+        0x6d, 0x81, 0xe8, 0x42, 0x2e, 0x3a, 0x01, 0x00, 0xa0, 0xb4, 0xe8, 0x42, 0xd3, 0xe7, 0xe8, 0x42,
+        0x2e, 0x34, 0x01, 0x00, 0x07, 0x1b, 0xe9, 0x42, 0xa0, 0xb4, 0xea, 0x42, 0x3e, 0x49, 0x01, 0x00,
+        0x07, 0x1b, 0xe9, 0x42, 0xa0, 0xb4, 0xea, 0x42, 0x41, 0x49, 0x01, 0x00, 0x07, 0x1b, 0xe9, 0x42,
+        0xa0, 0xb4, 0xea, 0x42, 0x44, 0x49, 0x01, 0x00, 0x07, 0x1b, 0xe9, 0x42, 0x3a, 0x4e, 0xe9, 0x42,
+        0x2f, 0x37, 0x01, 0x00, 0x6d, 0x81, 0xe9, 0x42, 0xa0, 0xb4, 0xe9, 0x42, 0x2f, 0x33, 0x01, 0x00,
+        0xd3, 0xe7, 0xe9, 0x42, 0x07, 0x1b, 0xea, 0x42, 0x2f, 0x32, 0x01, 0x00, 0x3a, 0x4e, 0xea, 0x42,
+        0x6d, 0x81, 0xea, 0x42, 0x2f, 0x34, 0x01, 0x00, 0xa0, 0xb4, 0xea, 0x42, 0x6d, 0x81, 0xeb, 0x42,
+        0x3e, 0x4a, 0x01, 0x00, 0xa0, 0xb4, 0xea, 0x42, 0x6d, 0x81, 0xeb, 0x42, 0x41, 0x4a, 0x01, 0x00,
+        0xa0, 0xb4, 0xea, 0x42, 0x6d, 0x81, 0xeb, 0x42, 0x44, 0x4a, 0x01, 0x00, 0xa0, 0xb4, 0xea, 0x42,
+        0xd3, 0xe7, 0xea, 0x42, 0x2f, 0x30, 0x01, 0x00, 0x07, 0x1b, 0xeb, 0x42, 0x3a, 0x4e, 0xeb, 0x42,
+        0x2f, 0x36, 0x01, 0x00, 0x6d, 0x81, 0xeb, 0x42, 0x07, 0x1b, 0xed, 0x42, 0x3c, 0x3c, 0x01, 0x00,
+        0x6d, 0x81, 0xeb, 0x42, 0x07, 0x1b, 0xed, 0x42, 0x40, 0x3c, 0x01, 0x00, 0x6d, 0x81, 0xeb, 0x42,
+        0x07, 0x1b, 0xed, 0x42, 0x45, 0x3c, 0x01, 0x00, 0x6d, 0x81, 0xeb, 0x42, 0x07, 0x1b, 0xed, 0x42,
+        0x30, 0x3d, 0x01, 0x00, 0xd3, 0xe7, 0xed, 0x42, 0xa0, 0xb4, 0xee, 0x42, 0x3e, 0x32, 0x01, 0x00,
+        0xd3, 0xe7, 0xed, 0x42, 0xa0, 0xb4, 0xee, 0x42, 0x40, 0x32, 0x01, 0x00, 0xd3, 0xe7, 0xed, 0x42,
+        0xa0, 0xb4, 0xee, 0x42, 0x47, 0x32, 0x01, 0x00, 0xd3, 0xe7, 0xed, 0x42, 0xa0, 0xb4, 0xee, 0x42,
+        0x34, 0x34, 0x01, 0x00, 0xd3, 0xe7, 0xed, 0x42, 0xa0, 0xb4, 0xee, 0x42, 0x38, 0x34, 0x01, 0x00,
+        0x3a, 0x4e, 0xf0, 0x42, 0x6d, 0x91, 0xf0, 0x42, 0x39, 0x2c, 0x01, 0x00, 0x3a, 0x4e, 0xf0, 0x42,
+        0x07, 0x1b, 0xf1, 0x42, 0x21, 0x28, 0x01, 0x00, 0x6d, 0x91, 0xf0, 0x42, 0x3a, 0xd6, 0xf0, 0x42,
+        0x3c, 0x2f, 0x01, 0x00, 0x3a, 0xd6, 0xf0, 0x42, 0x07, 0x1b, 0xf1, 0x42, 0x40, 0x2e, 0x01, 0x00,
+        0x07, 0x1b, 0xf1, 0x42, 0x3a, 0x5e, 0xf1, 0x42, 0x45, 0x34, 0x01, 0x00, 0x3a, 0x5e, 0xf1, 0x42,
+        0x07, 0xa3, 0xf1, 0x42, 0x48, 0x31, 0x01, 0x00, 0x07, 0xa3, 0xf1, 0x42, 0xd3, 0xe7, 0xf1, 0x42,
+        0x4c, 0x32, 0x01, 0x00, 0xd3, 0xe7, 0xf1, 0x42, 0x07, 0x2b, 0xf2, 0x42, 0x4a, 0x2d, 0x01, 0x00,
+        0xd3, 0xe7, 0xf1, 0x42, 0x3a, 0x4e, 0xf2, 0x42, 0x39, 0x2a, 0x01, 0x00, 0xd3, 0xe7, 0xf1, 0x42,
+        0x3a, 0x4e, 0xf2, 0x42, 0x3c, 0x2a, 0x01, 0x00, 0xd3, 0xe7, 0xf1, 0x42, 0x3a, 0x4e, 0xf2, 0x42,
+        0x40, 0x2a, 0x01, 0x00, 0x07, 0x2b, 0xf2, 0x42, 0xd3, 0x6f, 0xf2, 0x42, 0x48, 0x25, 0x01, 0x00,
+        0xd3, 0x6f, 0xf2, 0x42, 0xd3, 0xaf, 0xf2, 0x42, 0x47, 0x26, 0x01, 0x00, 0xa0, 0xb4, 0xf2, 0x42,
+        0xd3, 0xf7, 0xf2, 0x42, 0x45, 0x27, 0x01, 0x00, 0xa0, 0xb4, 0xf2, 0x42, 0x07, 0x1b, 0xf3, 0x42,
+        0x39, 0x25, 0x01, 0x00, 0xa0, 0xb4, 0xf2, 0x42, 0x07, 0x1b, 0xf3, 0x42, 0x3c, 0x25, 0x01, 0x00,
+        0xa0, 0xb4, 0xf2, 0x42, 0x07, 0x1b, 0xf3, 0x42, 0x40, 0x25, 0x01, 0x00, 0xd3, 0xf7, 0xf2, 0x42,
+        0xa0, 0x3c, 0xf3, 0x42, 0x48, 0x2d, 0x01, 0x00, 0xa0, 0x3c, 0xf3, 0x42, 0x6d, 0x81, 0xf3, 0x42,
+        0x4c, 0x30, 0x01, 0x00, 0x6d, 0x81, 0xf3, 0x42, 0xa0, 0xc4, 0xf3, 0x42, 0x51, 0x2e, 0x01, 0x00,
+        0xa0, 0xc4, 0xf3, 0x42, 0x6d, 0x09, 0xf4, 0x42, 0x54, 0x2c, 0x01, 0x00, 0x6d, 0x09, 0xf4, 0x42,
+        0x3a, 0x4e, 0xf4, 0x42, 0x58, 0x2c, 0x01, 0x00, 0x3a, 0x4e, 0xf4, 0x42, 0x6d, 0x91, 0xf4, 0x42,
+        0x56, 0x2b, 0x01, 0x00, 0x3a, 0x4e, 0xf4, 0x42, 0xa0, 0xb4, 0xf4, 0x42, 0x39, 0x27, 0x01, 0x00,
+        0x3a, 0x4e, 0xf4, 0x42, 0xa0, 0xb4, 0xf4, 0x42, 0x3c, 0x27, 0x01, 0x00, 0x3a, 0x4e, 0xf4, 0x42,
+        0xa0, 0xb4, 0xf4, 0x42, 0x40, 0x27, 0x01, 0x00, 0x6d, 0x91, 0xf4, 0x42, 0x3a, 0xd6, 0xf4, 0x42,
+        0x54, 0x28, 0x01, 0x00, 0x3a, 0xd6, 0xf4, 0x42, 0x3a, 0x16, 0xf5, 0x42, 0x53, 0x26, 0x01, 0x00,
+        0x07, 0x1b, 0xf5, 0x42, 0x3a, 0x5e, 0xf5, 0x42, 0x51, 0x20, 0x01, 0x00, 0x07, 0x1b, 0xf5, 0x42,
+        0x6d, 0x81, 0xf5, 0x42, 0x39, 0x31, 0x01, 0x00, 0x07, 0x1b, 0xf5, 0x42, 0x6d, 0x81, 0xf5, 0x42,
+        0x3c, 0x31, 0x01, 0x00, 0x07, 0x1b, 0xf5, 0x42, 0x6d, 0x81, 0xf5, 0x42, 0x40, 0x31, 0x01, 0x00,
+        0x3a, 0x5e, 0xf5, 0x42, 0x07, 0xa3, 0xf5, 0x42, 0x54, 0x31, 0x01, 0x00, 0x07, 0xa3, 0xf5, 0x42,
+        0xd3, 0xe7, 0xf5, 0x42, 0x58, 0x32, 0x01, 0x00, 0xd3, 0xe7, 0xf5, 0x42, 0x07, 0x2b, 0xf6, 0x42,
+        0x5d, 0x31, 0x01, 0x00, 0x07, 0x2b, 0xf6, 0x42, 0xd3, 0x6f, 0xf6, 0x42, 0x60, 0x30, 0x01, 0x00,
+        0xd3, 0x6f, 0xf6, 0x42, 0xa0, 0xb4, 0xf6, 0x42, 0x64, 0x2e, 0x01, 0x00, 0xa0, 0xb4, 0xf6, 0x42,
+        0xd3, 0xf7, 0xf6, 0x42, 0x62, 0x2b, 0x01, 0x00, 0xa0, 0xb4, 0xf6, 0x42, 0x07, 0x1b, 0xf7, 0x42,
+        0x39, 0x26, 0x01, 0x00, 0xa0, 0xb4, 0xf6, 0x42, 0x07, 0x1b, 0xf7, 0x42, 0x3c, 0x26, 0x01, 0x00,
+        0xa0, 0xb4, 0xf6, 0x42, 0x07, 0x1b, 0xf7, 0x42, 0x40, 0x26, 0x01, 0x00, 0xd3, 0xf7, 0xf6, 0x42,
+        0xa0, 0x3c, 0xf7, 0x42, 0x60, 0x27, 0x01, 0x00, 0xa0, 0x3c, 0xf7, 0x42, 0x6d, 0x81, 0xf7, 0x42,
+        0x5f, 0x28, 0x01, 0x00, 0x6d, 0x81, 0xf7, 0x42, 0xa0, 0xc4, 0xf7, 0x42, 0x5e, 0x24, 0x01, 0x00,
+        0x6d, 0x81, 0xf7, 0x42, 0xd3, 0xe7, 0xf7, 0x42, 0x39, 0x2c, 0x01, 0x00, 0x6d, 0x81, 0xf7, 0x42,
+        0xd3, 0xe7, 0xf7, 0x42, 0x3c, 0x2c, 0x01, 0x00, 0x6d, 0x81, 0xf7, 0x42, 0xd3, 0xe7, 0xf7, 0x42,
+        0x40, 0x2c, 0x01, 0x00, 0xa0, 0xc4, 0xf7, 0x42, 0x6d, 0x09, 0xf8, 0x42, 0x5d, 0x24, 0x01, 0x00,
+        0x6d, 0x09, 0xf8, 0x42, 0x3a, 0x4e, 0xf8, 0x42, 0x5c, 0x29, 0x01, 0x00, 0x3a, 0x4e, 0xf8, 0x42,
+        0x6d, 0x91, 0xf8, 0x42, 0x5b, 0x29, 0x01, 0x00, 0x6d, 0x91, 0xf8, 0x42, 0x3a, 0xd6, 0xf8, 0x42,
+        0x5a, 0x2a, 0x01, 0x00, 0x3a, 0xd6, 0xf8, 0x42, 0x07, 0x1b, 0xf9, 0x42, 0x59, 0x28, 0x01, 0x00,
+        0x07, 0x1b, 0xf9, 0x42, 0x3a, 0x5e, 0xf9, 0x42, 0x58, 0x29, 0x01, 0x00, 0x3a, 0x5e, 0xf9, 0x42,
+        0x07, 0xa3, 0xf9, 0x42, 0x57, 0x2c, 0x01, 0x00, 0x07, 0xa3, 0xf9, 0x42, 0xd3, 0xe7, 0xf9, 0x42,
+        0x56, 0x2b, 0x01, 0x00, 0xd3, 0xe7, 0xf9, 0x42, 0x07, 0x2b, 0xfa, 0x42, 0x55, 0x35, 0x01, 0x00,
+        0x07, 0x2b, 0xfa, 0x42, 0xd3, 0x6f, 0xfa, 0x42, 0x54, 0x2b, 0x01, 0x00, 0xd3, 0x6f, 0xfa, 0x42,
+        0x41, 0xb7, 0xfa, 0x42, 0x53, 0x28, 0x01, 0x00, 0x41, 0xb7, 0xfa, 0x42, 0x41, 0xff, 0xfa, 0x42,
+        0x52, 0x26, 0x01, 0x00, 0x41, 0xff, 0xfa, 0x42, 0xf8, 0x48, 0xfb, 0x42, 0x51, 0x29, 0x01, 0x00,
+        0xf8, 0x48, 0xfb, 0x42, 0xaf, 0x92, 0xfb, 0x42, 0x50, 0x26, 0x01, 0x00, 0xaf, 0x92, 0xfb, 0x42,
+        0xaf, 0xda, 0xfb, 0x42, 0x4f, 0x28, 0x01, 0x00, 0xaf, 0xda, 0xfb, 0x42, 0x66, 0x24, 0xfc, 0x42,
+        0x4e, 0x2a, 0x01, 0x00, 0x66, 0x24, 0xfc, 0x42, 0xc8, 0x73, 0xfc, 0x42, 0x4d, 0x2e, 0x01, 0x00,
+        0xc8, 0x73, 0xfc, 0x42, 0xc8, 0xeb, 0xfc, 0x42, 0x4c, 0x26, 0x01, 0x00, 0xef, 0xe9, 0xfc, 0x42,
+        0xef, 0x61, 0xfd, 0x42, 0x4b, 0x26, 0x01, 0x00, 0x17, 0x60, 0xfd, 0x42, 0xf5, 0xd7, 0xfd, 0x42,
+        0x4c, 0x2c, 0x01, 0x00, 0x3e, 0xd6, 0xfd, 0x42, 0xac, 0x45, 0xfe, 0x42, 0x47, 0x28, 0x01, 0x00,
+        0xf5, 0x43, 0xfe, 0x42, 0x45, 0xb3, 0xfe, 0x42, 0x4a, 0x30, 0x01, 0x00, 0xac, 0xb1, 0xfe, 0x42,
+        0xac, 0x19, 0xff, 0x42, 0x48, 0x2d, 0x01, 0x00, 0x12, 0x18, 0xff, 0x42, 0xac, 0xd9, 0xff, 0x42,
+        0x45, 0x29, 0x01, 0x00, 0x12, 0x18, 0xff, 0x42, 0x12, 0x80, 0xff, 0x42, 0x2d, 0x25, 0x01, 0x00,
+        0x78, 0x7e, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x42, 0x34, 0x2a, 0x01, 0x00, 0xdf, 0xe4, 0xff, 0x42,
+        0x6f, 0x22, 0x00, 0x43, 0x39, 0x2d, 0x01, 0x00, 0xa3, 0x25, 0x00, 0x43, 0xa3, 0x59, 0x00, 0x43,
+        0x3c, 0x25, 0x01, 0x00, 0xd6, 0x58, 0x00, 0x43, 0xd6, 0x8c, 0x00, 0x43, 0x40, 0x29, 0x01, 0x00,
+        0x09, 0x8c, 0x00, 0x43, 0x09, 0xc0, 0x00, 0x43, 0x45, 0x32, 0x01, 0x00, 0x3c, 0xbf, 0x00, 0x43,
+        0x09, 0x20, 0x01, 0x43, 0x47, 0x3a, 0x01, 0x00, 0x3c, 0xbf, 0x00, 0x43, 0x3c, 0xf3, 0x00, 0x43,
+        0x28, 0x27, 0x01, 0x00, 0x6f, 0xf2, 0x00, 0x43, 0x6f, 0x26, 0x01, 0x43, 0x34, 0x2f, 0x01, 0x00,
+        0xa3, 0x25, 0x01, 0x43, 0xa3, 0x55, 0x01, 0x43, 0x38, 0x2e, 0x01, 0x00, 0xd6, 0x58, 0x01, 0x43,
+        0xd6, 0x8c, 0x01, 0x43, 0x40, 0x26, 0x01, 0x00, 0x09, 0x8c, 0x01, 0x43, 0x09, 0xc0, 0x01, 0x43,
+        0x44, 0x29, 0x01, 0x00, 0x3c, 0xbf, 0x01, 0x43, 0x3c, 0xf3, 0x01, 0x43, 0x47, 0x31, 0x01, 0x00,
+        0x6f, 0xf2, 0x01, 0x43, 0x3c, 0x53, 0x02, 0x43, 0x48, 0x34, 0x01, 0x00, 0x6f, 0xf2, 0x01, 0x43,
+        0x6f, 0x26, 0x02, 0x43, 0x2d, 0x27, 0x01, 0x00, 0xa3, 0x25, 0x02, 0x43, 0xa3, 0x59, 0x02, 0x43,
+        0x34, 0x24, 0x01, 0x00, 0xd6, 0x58, 0x02, 0x43, 0xd6, 0x88, 0x02, 0x43, 0x39, 0x2e, 0x01, 0x00,
+        0x09, 0x8c, 0x02, 0x43, 0x09, 0xc0, 0x02, 0x43, 0x40, 0x24, 0x01, 0x00, 0x3c, 0xbf, 0x02, 0x43,
+        0x3c, 0xf3, 0x02, 0x43, 0x4c, 0x2e, 0x01, 0x00, 0x6f, 0xf2, 0x02, 0x43, 0x6f, 0x26, 0x03, 0x43,
+        0x4b, 0x2e, 0x01, 0x00, 0xa3, 0x25, 0x03, 0x43, 0xa3, 0x59, 0x03, 0x43, 0x4c, 0x2f, 0x01, 0x00,
+        0xd6, 0x58, 0x03, 0x43, 0xd6, 0x8c, 0x03, 0x43, 0x4b, 0x29, 0x01, 0x00, 0x09, 0x8c, 0x03, 0x43,
+        0x09, 0xc0, 0x03, 0x43, 0x4c, 0x29, 0x01, 0x00, 0x3c, 0xbf, 0x03, 0x43, 0x3c, 0xf3, 0x03, 0x43,
+        0x47, 0x26, 0x01, 0x00, 0x6f, 0xf2, 0x03, 0x43, 0x6f, 0x26, 0x04, 0x43, 0x4a, 0x28, 0x01, 0x00,
+        0xa3, 0x25, 0x04, 0x43, 0xa3, 0x59, 0x04, 0x43, 0x48, 0x25, 0x01, 0x00, 0xd6, 0x58, 0x04, 0x43,
+        0xa3, 0xb9, 0x04, 0x43, 0x45, 0x24, 0x01, 0x00, 0xd6, 0x58, 0x04, 0x43, 0xd6, 0x8c, 0x04, 0x43,
+        0x2d, 0x25, 0x01, 0x00, 0x09, 0x8c, 0x04, 0x43, 0x09, 0xc0, 0x04, 0x43, 0x34, 0x23, 0x01, 0x00,
+        0x3c, 0xbf, 0x04, 0x43, 0x3c, 0xef, 0x04, 0x43, 0x39, 0x2e, 0x01, 0x00, 0x6f, 0xf2, 0x04, 0x43,
+        0x6f, 0x26, 0x05, 0x43, 0x3c, 0x28, 0x01, 0x00, 0xa3, 0x25, 0x05, 0x43, 0xa3, 0x59, 0x05, 0x43,
+        0x40, 0x2b, 0x01, 0x00, 0xd6, 0x58, 0x05, 0x43, 0xd6, 0x8c, 0x05, 0x43, 0x45, 0x31, 0x01, 0x00,
+        0x09, 0x8c, 0x05, 0x43, 0xd6, 0xec, 0x05, 0x43, 0x47, 0x36, 0x01, 0x00, 0x09, 0x8c, 0x05, 0x43,
+        0x09, 0xc0, 0x05, 0x43, 0x28, 0x2b, 0x01, 0x00, 0x3c, 0xbf, 0x05, 0x43, 0x3c, 0xf3, 0x05, 0x43,
+        0x34, 0x30, 0x01, 0x00, 0x6f, 0xf2, 0x05, 0x43, 0x6f, 0x22, 0x06, 0x43, 0x38, 0x2d, 0x01, 0x00,
+        0xa3, 0x25, 0x06, 0x43, 0xa3, 0x59, 0x06, 0x43, 0x3e, 0x24, 0x01, 0x00, 0xd6, 0x58, 0x06, 0x43,
+        0xd6, 0x8c, 0x06, 0x43, 0x48, 0x2b, 0x01, 0x00, 0x09, 0x8c, 0x06, 0x43, 0x09, 0xc0, 0x06, 0x43,
+        0x47, 0x28, 0x01, 0x00, 0x3c, 0xbf, 0x06, 0x43, 0x09, 0x20, 0x07, 0x43, 0x45, 0x26, 0x01, 0x00,
+        0x3c, 0xbf, 0x06, 0x43, 0x3c, 0xf3, 0x06, 0x43, 0x2d, 0x28, 0x01, 0x00, 0x6f, 0xf2, 0x06, 0x43,
+        0x6f, 0x26, 0x07, 0x43, 0x34, 0x2d, 0x01, 0x00, 0xa3, 0x25, 0x07, 0x43, 0xa3, 0x55, 0x07, 0x43,
+        0x39, 0x2d, 0x01, 0x00, 0xd6, 0x58, 0x07, 0x43, 0xd6, 0x8c, 0x07, 0x43, 0x47, 0x34, 0x01, 0x00,
+        0x09, 0x8c, 0x07, 0x43, 0x09, 0xc0, 0x07, 0x43, 0x48, 0x52, 0x01, 0x00, 0x3c, 0xbf, 0x07, 0x43,
+        0x3c, 0xf3, 0x07, 0x43, 0x4a, 0x56, 0x01, 0x00, 0x6f, 0xf2, 0x07, 0x43, 0x09, 0x84, 0x08, 0x43,
+        0x4c, 0x56, 0x01, 0x00, 0x6f, 0xf2, 0x07, 0x43, 0x6f, 0x26, 0x08, 0x43, 0x30, 0x4c, 0x01, 0x00,
+        0xa3, 0x25, 0x08, 0x43, 0xa3, 0x59, 0x08, 0x43, 0x37, 0x58, 0x01, 0x00, 0xd6, 0x58, 0x08, 0x43,
+        0xd6, 0x88, 0x08, 0x43, 0x3c, 0x5e, 0x01, 0x00, 0x09, 0x8c, 0x08, 0x43, 0x09, 0xc0, 0x08, 0x43,
+        0x43, 0x3d, 0x01, 0x00, 0x3c, 0xbf, 0x08, 0x43, 0x3c, 0xf3, 0x08, 0x43, 0x4d, 0x4b, 0x01, 0x00,
+        0x6f, 0xf2, 0x08, 0x43, 0x6f, 0x26, 0x09, 0x43, 0x4c, 0x55, 0x01, 0x00, 0xa3, 0x25, 0x09, 0x43,
+        0x3c, 0xb7, 0x09, 0x43, 0x4a, 0x51, 0x01, 0x00, 0xa3, 0x25, 0x09, 0x43, 0xa3, 0x59, 0x09, 0x43,
+        0x2b, 0x44, 0x01, 0x00, 0xd6, 0x58, 0x09, 0x43, 0xd6, 0x8c, 0x09, 0x43, 0x37, 0x53, 0x01, 0x00,
+        0x09, 0x8c, 0x09, 0x43, 0x09, 0xbc, 0x09, 0x43, 0x3b, 0x5d, 0x01, 0x00, 0x3c, 0xbf, 0x09, 0x43,
+        0x3c, 0xf3, 0x09, 0x43, 0x41, 0x40, 0x01, 0x00, 0x6f, 0xf2, 0x09, 0x43, 0x6f, 0x26, 0x0a, 0x43,
+        0x4c, 0x4c, 0x01, 0x00, 0xa3, 0x25, 0x0a, 0x43, 0xa3, 0x59, 0x0a, 0x43, 0x4a, 0x50, 0x01, 0x00,
+        0xd6, 0x58, 0x0a, 0x43, 0x6f, 0xea, 0x0a, 0x43, 0x48, 0x44, 0x01, 0x00, 0xd6, 0x58, 0x0a, 0x43,
+        0xd6, 0x8c, 0x0a, 0x43, 0x2d, 0x43, 0x01, 0x00, 0x09, 0x8c, 0x0a, 0x43, 0x09, 0xc0, 0x0a, 0x43,
+        0x34, 0x4d, 0x01, 0x00, 0x3c, 0xbf, 0x0a, 0x43, 0x3c, 0xef, 0x0a, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x6f, 0xf2, 0x0a, 0x43, 0x6f, 0x26, 0x0b, 0x43, 0x40, 0x37, 0x01, 0x00, 0xa3, 0x25, 0x0b, 0x43,
+        0xa3, 0x59, 0x0b, 0x43, 0x4a, 0x46, 0x01, 0x00, 0xd6, 0x58, 0x0b, 0x43, 0xd6, 0x8c, 0x0b, 0x43,
+        0x48, 0x46, 0x01, 0x00, 0x09, 0x8c, 0x0b, 0x43, 0xd6, 0xec, 0x0b, 0x43, 0x47, 0x33, 0x01, 0x00,
+        0x09, 0x8c, 0x0b, 0x43, 0xa3, 0xa5, 0x0b, 0x43, 0x28, 0x36, 0x01, 0x00, 0x3c, 0xbf, 0x0b, 0x43,
+        0x4b, 0xf3, 0x0b, 0x43, 0x34, 0x40, 0x01, 0x00, 0x6f, 0xf2, 0x0b, 0x43, 0xdd, 0x25, 0x0c, 0x43,
+        0x40, 0x52, 0x01, 0x00, 0x4b, 0x29, 0x0c, 0x43, 0x02, 0x61, 0x0c, 0x43, 0x40, 0x34, 0x01, 0x00,
+        0x26, 0x60, 0x0c, 0x43, 0x94, 0x93, 0x0c, 0x43, 0x4c, 0x42, 0x01, 0x00, 0x02, 0x97, 0x0c, 0x43,
+        0xb9, 0xce, 0x0c, 0x43, 0x40, 0x31, 0x01, 0x00, 0xdd, 0xcd, 0x0c, 0x43, 0x4b, 0x01, 0x0d, 0x43,
+        0x4c, 0x3c, 0x01, 0x00, 0xb9, 0x04, 0x0d, 0x43, 0x6f, 0x3c, 0x0d, 0x43, 0x4c, 0x37, 0x01, 0x00,
+        0x94, 0x3b, 0x0d, 0x43, 0xfc, 0x70, 0x0d, 0x43, 0x58, 0x40, 0x01, 0x00, 0xad, 0x74, 0x0d, 0x43,
+        0xad, 0xb0, 0x0d, 0x43, 0x4b, 0x34, 0x01, 0x00, 0xc1, 0xaf, 0x0d, 0x43, 0x23, 0xe7, 0x0d, 0x43,
+        0x4c, 0x37, 0x01, 0x00, 0xd5, 0xea, 0x0d, 0x43, 0xd5, 0x26, 0x0e, 0x43, 0x4b, 0x2c, 0x01, 0x00,
+        0xe8, 0x25, 0x0e, 0x43, 0x4b, 0x5d, 0x0e, 0x43, 0x4c, 0x2b, 0x01, 0x00, 0xfc, 0x60, 0x0e, 0x43,
+        0xb3, 0x98, 0x0e, 0x43, 0x4b, 0x2a, 0x01, 0x00, 0xd7, 0x97, 0x0e, 0x43, 0x45, 0xcb, 0x0e, 0x43,
+        0x4c, 0x32, 0x01, 0x00, 0xb3, 0xce, 0x0e, 0x43, 0x6a, 0x06, 0x0f, 0x43, 0x4b, 0x26, 0x01, 0x00,
+        0x8e, 0x05, 0x0f, 0x43, 0x45, 0x3d, 0x0f, 0x43, 0x4c, 0x2a, 0x01, 0x00, 0x6a, 0x3c, 0x0f, 0x43,
+        0x20, 0x74, 0x0f, 0x43, 0x4b, 0x2d, 0x01, 0x00, 0x45, 0x73, 0x0f, 0x43, 0xfc, 0xaa, 0x0f, 0x43,
+        0x4c, 0x33, 0x01, 0x00, 0x20, 0xaa, 0x0f, 0x43, 0xd7, 0xe1, 0x0f, 0x43, 0x4b, 0x2d, 0x01, 0x00,
+        0xfc, 0xe0, 0x0f, 0x43, 0xa4, 0x18, 0x10, 0x43, 0x4c, 0x34, 0x01, 0x00, 0xd7, 0x17, 0x10, 0x43,
+        0xd7, 0x4b, 0x10, 0x43, 0x47, 0x25, 0x01, 0x00, 0x0a, 0x4b, 0x10, 0x43, 0x0a, 0x7f, 0x10, 0x43,
+        0x4a, 0x26, 0x01, 0x00, 0x3e, 0x7e, 0x10, 0x43, 0x3e, 0xb2, 0x10, 0x43, 0x48, 0x29, 0x01, 0x00,
+        0x71, 0xb1, 0x10, 0x43, 0x3e, 0x12, 0x11, 0x43, 0x45, 0x24, 0x01, 0x00, 0x71, 0xb1, 0x10, 0x43,
+        0x71, 0xe5, 0x10, 0x43, 0x2d, 0x24, 0x01, 0x00, 0xa4, 0xe4, 0x10, 0x43, 0xa4, 0x18, 0x11, 0x43,
+        0x34, 0x27, 0x01, 0x00, 0xd7, 0x17, 0x11, 0x43, 0xd7, 0x47, 0x11, 0x43, 0x39, 0x2e, 0x01, 0x00,
+        0x0a, 0x4b, 0x11, 0x43, 0x0a, 0x7f, 0x11, 0x43, 0x3c, 0x25, 0x01, 0x00, 0x3e, 0x7e, 0x11, 0x43,
+        0x3e, 0xb2, 0x11, 0x43, 0x40, 0x28, 0x01, 0x00, 0x71, 0xb1, 0x11, 0x43, 0x71, 0xe5, 0x11, 0x43,
+        0x45, 0x30, 0x01, 0x00, 0xa4, 0xe4, 0x11, 0x43, 0x71, 0x45, 0x12, 0x43, 0x47, 0x32, 0x01, 0x00,
+        0xa4, 0xe4, 0x11, 0x43, 0xa4, 0x18, 0x12, 0x43, 0x28, 0x25, 0x01, 0x00, 0xd7, 0x17, 0x12, 0x43,
+        0xd7, 0x4b, 0x12, 0x43, 0x34, 0x26, 0x01, 0x00, 0x0a, 0x4b, 0x12, 0x43, 0x0a, 0x7b, 0x12, 0x43,
+        0x38, 0x2f, 0x01, 0x00, 0x3e, 0x7e, 0x12, 0x43, 0x3e, 0xb2, 0x12, 0x43, 0x40, 0x27, 0x01, 0x00,
+        0x71, 0xb1, 0x12, 0x43, 0x71, 0xe5, 0x12, 0x43, 0x44, 0x2b, 0x01, 0x00, 0xa4, 0xe4, 0x12, 0x43,
+        0xa4, 0x18, 0x13, 0x43, 0x47, 0x30, 0x01, 0x00, 0xd7, 0x17, 0x13, 0x43, 0xa4, 0x78, 0x13, 0x43,
+        0x48, 0x31, 0x01, 0x00, 0xd7, 0x17, 0x13, 0x43, 0xd7, 0x4b, 0x13, 0x43, 0x2d, 0x2c, 0x01, 0x00,
+        0x0a, 0x4b, 0x13, 0x43, 0x0a, 0x7f, 0x13, 0x43, 0x34, 0x32, 0x01, 0x00, 0x3e, 0x7e, 0x13, 0x43,
+        0x3e, 0xae, 0x13, 0x43, 0x39, 0x2b, 0x01, 0x00, 0x71, 0xb1, 0x13, 0x43, 0x71, 0xe5, 0x13, 0x43,
+        0x40, 0x27, 0x01, 0x00, 0xa4, 0xe4, 0x13, 0x43, 0xb3, 0x18, 0x14, 0x43, 0x4c, 0x2e, 0x01, 0x00,
+        0xd7, 0x17, 0x14, 0x43, 0x8e, 0x4f, 0x14, 0x43, 0x4b, 0x2b, 0x01, 0x00, 0xb3, 0x4e, 0x14, 0x43,
+        0x69, 0x86, 0x14, 0x43, 0x4c, 0x2c, 0x01, 0x00, 0x8e, 0x85, 0x14, 0x43, 0x45, 0xbd, 0x14, 0x43,
+        0x4b, 0x29, 0x01, 0x00, 0x69, 0xbc, 0x14, 0x43, 0x20, 0xf4, 0x14, 0x43, 0x4c, 0x31, 0x01, 0x00,
+        0x45, 0xf3, 0x14, 0x43, 0xfc, 0x2a, 0x15, 0x43, 0x47, 0x2a, 0x01, 0x00, 0x20, 0x2a, 0x15, 0x43,
+        0xd7, 0x61, 0x15, 0x43, 0x4a, 0x30, 0x01, 0x00, 0xfc, 0x60, 0x15, 0x43, 0xb3, 0x98, 0x15, 0x43,
+        0x48, 0x2c, 0x01, 0x00, 0xd7, 0x97, 0x15, 0x43, 0x8e, 0xff, 0x15, 0x43, 0x45, 0x2b, 0x01, 0x00,
+        0xd7, 0x97, 0x15, 0x43, 0x8e, 0xcf, 0x15, 0x43, 0x2d, 0x26, 0x01, 0x00, 0xb3, 0xce, 0x15, 0x43,
+        0x7a, 0x06, 0x16, 0x43, 0x34, 0x2a, 0x01, 0x00, 0x8e, 0x05, 0x16, 0x43, 0xf0, 0x3c, 0x16, 0x43,
+        0x39, 0x2f, 0x01, 0x00, 0xa2, 0x40, 0x16, 0x43, 0xa2, 0x7c, 0x16, 0x43, 0x3c, 0x2a, 0x01, 0x00,
+        0xb5, 0x7b, 0x16, 0x43, 0xb5, 0xb7, 0x16, 0x43, 0x40, 0x2c, 0x01, 0x00, 0xc9, 0xb6, 0x16, 0x43,
+        0xc9, 0xf2, 0x16, 0x43, 0x45, 0x2e, 0x01, 0x00, 0xdd, 0xf1, 0x16, 0x43, 0xf0, 0x65, 0x17, 0x43,
+        0x47, 0x2c, 0x01, 0x00, 0xdd, 0xf1, 0x16, 0x43, 0xf0, 0x2d, 0x17, 0x43, 0x28, 0x2a, 0x01, 0x00,
+        0xf0, 0x2c, 0x17, 0x43, 0xf0, 0x6d, 0x17, 0x43, 0x34, 0x2e, 0x01, 0x00, 0xf0, 0x6c, 0x17, 0x43,
+        0xf0, 0xa8, 0x17, 0x43, 0x38, 0x2d, 0x01, 0x00, 0xf0, 0xac, 0x17, 0x43, 0x65, 0xf1, 0x17, 0x43,
+        0x40, 0x26, 0x01, 0x00, 0x4d, 0xf0, 0x17, 0x43, 0x5f, 0x37, 0x18, 0x43, 0x48, 0x2f, 0x01, 0x00,
+        0x1f, 0x36, 0x18, 0x43, 0x1f, 0x88, 0x18, 0x43, 0x47, 0x28, 0x01, 0x00, 0x1f, 0x86, 0x18, 0x43,
+        0x1f, 0x6c, 0x1a, 0x43, 0x45, 0x26, 0x01, 0x00, 0x1f, 0x86, 0x18, 0x43, 0x1f, 0x86, 0x1a, 0x43,
+        0x21, 0x2c, 0x01, 0x00, 0x1f, 0x86, 0x18, 0x43, 0x1f, 0x86, 0x1a, 0x43, 0x2d, 0x2c, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x3d, 0x17, 0x05, 0x3f, 0x41, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x83, 0xae, 0x04, 0x40, 0x35, 0x40, 0x01, 0x00, 0xe0, 0xa2, 0x0b, 0x3f, 0x0e, 0x5d, 0x88, 0x3f,
+        0x43, 0x55, 0x01, 0x00, 0xe0, 0xa2, 0x8b, 0x3f, 0x7e, 0x2e, 0xce, 0x3f, 0x45, 0x58, 0x01, 0x00,
+        0x4f, 0x74, 0xd1, 0x3f, 0xf7, 0xff, 0x09, 0x40, 0x41, 0x4e, 0x01, 0x00, 0xe0, 0xa2, 0x0b, 0x40,
+        0xaf, 0xe8, 0x2c, 0x40, 0x41, 0x53, 0x01, 0x00, 0xe0, 0xa2, 0x0b, 0x40, 0xb1, 0x28, 0x88, 0x40,
+        0x35, 0x46, 0x01, 0x00, 0x97, 0x8b, 0x2e, 0x40, 0x67, 0xd1, 0x4f, 0x40, 0x43, 0x55, 0x01, 0x00,
+        0x4f, 0x74, 0x51, 0x40, 0x1f, 0xba, 0x72, 0x40, 0x45, 0x56, 0x01, 0x00, 0x07, 0x5d, 0x74, 0x40,
+        0x6b, 0xd1, 0x8a, 0x40, 0x41, 0x51, 0x01, 0x00, 0xe0, 0xa2, 0x8b, 0x40, 0xc7, 0x45, 0x9c, 0x40,
+        0x45, 0x58, 0x01, 0x00, 0xe0, 0xa2, 0x8b, 0x40, 0x21, 0xfa, 0xcd, 0x40, 0x35, 0x46, 0x01, 0x00,
+        0x3c, 0x17, 0x9d, 0x40, 0x23, 0xba, 0xad, 0x40, 0x46, 0x57, 0x01, 0x00, 0x97, 0x8b, 0xae, 0x40,
+        0xf2, 0xbf, 0xcf, 0x40, 0x48, 0x55, 0x01, 0x00, 0x4f, 0x74, 0xd1, 0x40, 0x37, 0x17, 0xe2, 0x40,
+        0x45, 0x50, 0x01, 0x00, 0x4f, 0x74, 0xd1, 0x40, 0xc8, 0xe5, 0x09, 0x41, 0x35, 0x47, 0x01, 0x00,
+        0xab, 0xe8, 0xe2, 0x40, 0x93, 0x8b, 0xf3, 0x40, 0x46, 0x59, 0x01, 0x00, 0x07, 0x5d, 0xf4, 0x40,
+        0xb1, 0xc8, 0x0a, 0x41, 0x48, 0x56, 0x01, 0x00, 0xe0, 0xa2, 0x0b, 0x41, 0x99, 0xcb, 0x0f, 0x41,
+        0x48, 0x54, 0x01, 0x00, 0xe0, 0xa2, 0x0b, 0x41, 0x0d, 0x3d, 0x1c, 0x41, 0x30, 0x45, 0x01, 0x00,
+        0xf7, 0xff, 0x0f, 0x41, 0xb0, 0x28, 0x14, 0x41, 0x4a, 0x58, 0x01, 0x00, 0x0e, 0x5d, 0x14, 0x41,
+        0xc7, 0x85, 0x18, 0x41, 0x48, 0x51, 0x01, 0x00, 0x25, 0xba, 0x18, 0x41, 0xde, 0xe2, 0x1c, 0x41,
+        0x46, 0x50, 0x01, 0x00, 0x3c, 0x17, 0x1d, 0x41, 0xaf, 0x68, 0x25, 0x41, 0x45, 0x52, 0x01, 0x00,
+        0x3c, 0x17, 0x1d, 0x41, 0x69, 0xb1, 0x2d, 0x41, 0x35, 0x4a, 0x01, 0x00, 0x69, 0xd1, 0x25, 0x41,
+        0xdd, 0x22, 0x2e, 0x41, 0x41, 0x50, 0x01, 0x00, 0x97, 0x8b, 0x2e, 0x41, 0x51, 0xb4, 0x32, 0x41,
+        0x48, 0x5b, 0x01, 0x00, 0x97, 0x8b, 0x2e, 0x41, 0xc5, 0x25, 0x3f, 0x41, 0x30, 0x43, 0x01, 0x00,
+        0xae, 0xe8, 0x32, 0x41, 0x68, 0x11, 0x37, 0x41, 0x4a, 0x56, 0x01, 0x00, 0xc5, 0x45, 0x37, 0x41,
+        0x7f, 0x6e, 0x3b, 0x41, 0x48, 0x51, 0x01, 0x00, 0xdc, 0xa2, 0x3b, 0x41, 0x96, 0xcb, 0x3f, 0x41,
+        0x46, 0x52, 0x01, 0x00, 0xf3, 0xff, 0x3f, 0x41, 0x67, 0x51, 0x48, 0x41, 0x45, 0x55, 0x01, 0x00,
+        0xf3, 0xff, 0x3f, 0x41, 0x21, 0x9a, 0x50, 0x41, 0x35, 0x47, 0x01, 0x00, 0x21, 0xba, 0x48, 0x41,
+        0x95, 0x0b, 0x51, 0x41, 0x41, 0x51, 0x01, 0x00, 0x4f, 0x74, 0x51, 0x41, 0xc3, 0xc5, 0x59, 0x41,
+        0x43, 0x55, 0x01, 0x00, 0x4f, 0x74, 0x51, 0x41, 0x7d, 0x0e, 0x62, 0x41, 0x30, 0x45, 0x01, 0x00,
+        0x7d, 0x2e, 0x5a, 0x41, 0xf1, 0x7f, 0x62, 0x41, 0x3c, 0x4c, 0x01, 0x00, 0xab, 0xe8, 0x62, 0x41,
+        0xd9, 0x82, 0x73, 0x41, 0x41, 0x59, 0x01, 0x00, 0xab, 0xe8, 0x62, 0x41, 0xd9, 0x82, 0x73, 0x41,
+        0x35, 0x4b, 0x01, 0x00, 0x07, 0x5d, 0x74, 0x41, 0x7b, 0xae, 0x7c, 0x41, 0x43, 0x56, 0x01, 0x00,
+        0x07, 0x5d, 0x74, 0x41, 0x9a, 0x7b, 0x82, 0x41, 0x30, 0x45, 0x01, 0x00, 0x35, 0x17, 0x7d, 0x41,
+        0x55, 0xb4, 0x82, 0x41, 0x3c, 0x4d, 0x01, 0x00, 0xb2, 0xe8, 0x82, 0x41, 0xc8, 0x35, 0x8b, 0x41,
+        0x41, 0x59, 0x01, 0x00, 0xb2, 0xe8, 0x82, 0x41, 0xc8, 0x35, 0x8b, 0x41, 0x35, 0x4b, 0x01, 0x00,
+        0xe0, 0xa2, 0x8b, 0x41, 0x99, 0xcb, 0x8f, 0x41, 0x41, 0x54, 0x01, 0x00, 0xe0, 0xa2, 0x8b, 0x41,
+        0xb0, 0x38, 0x9c, 0x41, 0x35, 0x48, 0x01, 0x00, 0xf7, 0xff, 0x8f, 0x41, 0xb0, 0x28, 0x94, 0x41,
+        0x43, 0x57, 0x01, 0x00, 0x0e, 0x5d, 0x94, 0x41, 0xc7, 0x85, 0x98, 0x41, 0x45, 0x52, 0x01, 0x00,
+        0x25, 0xba, 0x98, 0x41, 0xde, 0xe2, 0x9c, 0x41, 0x41, 0x50, 0x01, 0x00, 0x3c, 0x17, 0x9d, 0x41,
+        0xf5, 0x3f, 0xa1, 0x41, 0x41, 0x54, 0x01, 0x00, 0x3c, 0x17, 0x9d, 0x41, 0x0c, 0xad, 0xad, 0x41,
+        0x35, 0x46, 0x01, 0x00, 0x53, 0x74, 0xa1, 0x41, 0x0c, 0x9d, 0xa5, 0x41, 0x43, 0x56, 0x01, 0x00,
+        0x69, 0xd1, 0xa5, 0x41, 0x23, 0xfa, 0xa9, 0x41, 0x45, 0x59, 0x01, 0x00, 0x80, 0x2e, 0xaa, 0x41,
+        0x3a, 0x57, 0xae, 0x41, 0x41, 0x50, 0x01, 0x00, 0x97, 0x8b, 0xae, 0x41, 0x51, 0xb4, 0xb2, 0x41,
+        0x45, 0x59, 0x01, 0x00, 0x97, 0x8b, 0xae, 0x41, 0x68, 0x21, 0xbf, 0x41, 0x35, 0x48, 0x01, 0x00,
+        0xae, 0xe8, 0xb2, 0x41, 0x68, 0x11, 0xb7, 0x41, 0x46, 0x56, 0x01, 0x00, 0xc5, 0x45, 0xb7, 0x41,
+        0xdc, 0x92, 0xbf, 0x41, 0x48, 0x56, 0x01, 0x00, 0xf3, 0xff, 0xbf, 0x41, 0xad, 0x28, 0xc4, 0x41,
+        0x45, 0x4f, 0x01, 0x00, 0xf3, 0xff, 0xbf, 0x41, 0xc4, 0x95, 0xd0, 0x41, 0x35, 0x48, 0x01, 0x00,
+        0x0a, 0x5d, 0xc4, 0x41, 0xc4, 0x85, 0xc8, 0x41, 0x46, 0x57, 0x01, 0x00, 0x21, 0xba, 0xc8, 0x41,
+        0x38, 0x07, 0xd1, 0x41, 0x48, 0x55, 0x01, 0x00, 0x4f, 0x74, 0xd1, 0x41, 0xac, 0x88, 0xd3, 0x41,
+        0x48, 0x55, 0x01, 0x00, 0x4f, 0x74, 0xd1, 0x41, 0x66, 0xc1, 0xd9, 0x41, 0x30, 0x44, 0x01, 0x00,
+        0xdb, 0xa2, 0xd3, 0x41, 0x38, 0xb7, 0xd5, 0x41, 0x4a, 0x56, 0x01, 0x00, 0x66, 0xd1, 0xd5, 0x41,
+        0xc3, 0xe5, 0xd7, 0x41, 0x48, 0x51, 0x01, 0x00, 0xf2, 0xff, 0xd7, 0x41, 0x4f, 0x14, 0xda, 0x41,
+        0x46, 0x51, 0x01, 0x00, 0x7d, 0x2e, 0xda, 0x41, 0x37, 0x57, 0xde, 0x41, 0x45, 0x54, 0x01, 0x00,
+        0x7d, 0x2e, 0xda, 0x41, 0x94, 0x7b, 0xe2, 0x41, 0x35, 0x49, 0x01, 0x00, 0x94, 0x8b, 0xde, 0x41,
+        0x4e, 0xb4, 0xe2, 0x41, 0x41, 0x4e, 0x01, 0x00, 0xab, 0xe8, 0xe2, 0x41, 0x08, 0xfd, 0xe4, 0x41,
+        0x48, 0x5b, 0x01, 0x00, 0xab, 0xe8, 0xe2, 0x41, 0xc2, 0x35, 0xeb, 0x41, 0x30, 0x45, 0x01, 0x00,
+        0x37, 0x17, 0xe5, 0x41, 0x94, 0x2b, 0xe7, 0x41, 0x4a, 0x54, 0x01, 0x00, 0xc2, 0x45, 0xe7, 0x41,
+        0x1f, 0x5a, 0xe9, 0x41, 0x48, 0x4f, 0x01, 0x00, 0x4e, 0x74, 0xe9, 0x41, 0xab, 0x88, 0xeb, 0x41,
+        0x46, 0x4f, 0x01, 0x00, 0xd9, 0xa2, 0xeb, 0x41, 0x93, 0xcb, 0xef, 0x41, 0x45, 0x53, 0x01, 0x00,
+        0xd9, 0xa2, 0xeb, 0x41, 0xf0, 0xef, 0xf3, 0x41, 0x35, 0x48, 0x01, 0x00, 0xf0, 0xff, 0xef, 0x41,
+        0xaa, 0x28, 0xf4, 0x41, 0x41, 0x4f, 0x01, 0x00, 0x07, 0x5d, 0xf4, 0x41, 0xc1, 0x85, 0xf8, 0x41,
+        0x43, 0x55, 0x01, 0x00, 0x07, 0x5d, 0xf4, 0x41, 0x1e, 0xaa, 0xfc, 0x41, 0x30, 0x44, 0x01, 0x00,
+        0x1e, 0xba, 0xf8, 0x41, 0xd8, 0xe2, 0xfc, 0x41, 0x3c, 0x4c, 0x01, 0x00, 0x35, 0x17, 0xfd, 0x41,
+        0x26, 0xb2, 0x02, 0x42, 0x41, 0x57, 0x01, 0x00, 0x35, 0x17, 0xfd, 0x41, 0x26, 0xb2, 0x02, 0x42,
+        0x35, 0x4a, 0x01, 0x00, 0xb2, 0xe8, 0x02, 0x42, 0x0f, 0xfd, 0x04, 0x42, 0x43, 0x56, 0x01, 0x00,
+        0xb2, 0xe8, 0x02, 0x42, 0x3d, 0x0f, 0x07, 0x42, 0x30, 0x44, 0x01, 0x00, 0x3d, 0x17, 0x05, 0x42,
+        0x9a, 0x2b, 0x07, 0x42, 0x3c, 0x4d, 0x01, 0x00, 0xc9, 0x45, 0x07, 0x42, 0x54, 0x6c, 0x0b, 0x42,
+        0x41, 0x59, 0x01, 0x00, 0xc9, 0x45, 0x07, 0x42, 0x54, 0x6c, 0x0b, 0x42, 0x35, 0x49, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xa8, 0x6d, 0x5b, 0x3f, 0x40, 0x42, 0x01, 0x00, 0xa8, 0x6d, 0x5b, 0x3f,
+        0x3b, 0x92, 0xdd, 0x3f, 0x40, 0x4b, 0x01, 0x00, 0xa8, 0x6d, 0xdb, 0x3f, 0x87, 0xa4, 0x25, 0x40,
+        0x41, 0x4d, 0x01, 0x00, 0x3e, 0x92, 0x24, 0x40, 0xa8, 0x6d, 0x5b, 0x40, 0x43, 0x52, 0x01, 0x00,
+        0xa8, 0x6d, 0x5b, 0x40, 0xae, 0xad, 0x89, 0x40, 0x43, 0x49, 0x01, 0x00, 0x89, 0x24, 0x89, 0x40,
+        0x63, 0x1b, 0xa5, 0x40, 0x41, 0x45, 0x01, 0x00, 0x3e, 0x92, 0xa4, 0x40, 0x18, 0x89, 0xc0, 0x40,
+        0x40, 0x4a, 0x01, 0x00, 0xf3, 0xff, 0xbf, 0x40, 0xcd, 0xf6, 0xdb, 0x40, 0x3e, 0x48, 0x01, 0x00,
+        0xa8, 0x6d, 0xdb, 0x40, 0x5e, 0xdb, 0xf6, 0x40, 0x3c, 0x4a, 0x01, 0x00, 0x5e, 0xdb, 0xf6, 0x40,
+        0x1c, 0x69, 0x09, 0x41, 0x3c, 0x50, 0x01, 0x00, 0x89, 0x24, 0x09, 0x41, 0xf6, 0x1f, 0x17, 0x41,
+        0x3e, 0x51, 0x01, 0x00, 0x64, 0xdb, 0x16, 0x41, 0x3e, 0x92, 0x24, 0x41, 0x40, 0x52, 0x01, 0x00,
+        0x3e, 0x92, 0x24, 0x41, 0x86, 0x84, 0x39, 0x41, 0x40, 0x4f, 0x01, 0x00, 0x86, 0x24, 0x39, 0x41,
+        0xf3, 0xff, 0x3f, 0x41, 0x3e, 0x51, 0x01, 0x00, 0xf3, 0xff, 0x3f, 0x41, 0x16, 0x09, 0x5a, 0x41,
+        0x3e, 0x4c, 0x01, 0x00, 0xa8, 0x6d, 0x5b, 0x41, 0x83, 0x24, 0x69, 0x41, 0x40, 0x50, 0x01, 0x00,
+        0x83, 0x24, 0x69, 0x41, 0xf0, 0x1f, 0x77, 0x41, 0x40, 0x4f, 0x01, 0x00, 0x5e, 0xdb, 0x76, 0x41,
+        0x65, 0x6b, 0x82, 0x41, 0x41, 0x53, 0x01, 0x00, 0x1c, 0x49, 0x82, 0x41, 0x89, 0x24, 0x89, 0x41,
+        0x43, 0x4f, 0x01, 0x00, 0x89, 0x24, 0x89, 0x41, 0x40, 0x22, 0x90, 0x41, 0x43, 0x4e, 0x01, 0x00,
+        0xf7, 0xff, 0x8f, 0x41, 0xad, 0xfd, 0x96, 0x41, 0x41, 0x4d, 0x01, 0x00, 0x64, 0xdb, 0x96, 0x41,
+        0x1a, 0xd9, 0x9d, 0x41, 0x40, 0x4a, 0x01, 0x00, 0xd1, 0xb6, 0x9d, 0x41, 0x87, 0xb4, 0xa4, 0x41,
+        0x3e, 0x44, 0x01, 0x00, 0x3e, 0x92, 0xa4, 0x41, 0xac, 0x6d, 0xab, 0x41, 0x3c, 0x45, 0x01, 0x00,
+        0xac, 0x6d, 0xab, 0x41, 0x62, 0x6b, 0xb2, 0x41, 0x3c, 0x48, 0x01, 0x00, 0x19, 0x49, 0xb2, 0x41,
+        0xcf, 0x46, 0xb9, 0x41, 0x3e, 0x51, 0x01, 0x00, 0x86, 0x24, 0xb9, 0x41, 0x3d, 0x22, 0xc0, 0x41,
+        0x40, 0x4f, 0x01, 0x00, 0xf3, 0xff, 0xbf, 0x41, 0x17, 0x79, 0xca, 0x41, 0x3e, 0x4d, 0x01, 0x00,
+        0x17, 0x49, 0xca, 0x41, 0xce, 0xb6, 0xcd, 0x41, 0x3c, 0x44, 0x01, 0x00, 0xce, 0xb6, 0xcd, 0x41,
+        0x5f, 0xbb, 0xda, 0x41, 0x3c, 0x4e, 0x01, 0x00, 0xa8, 0x6d, 0xdb, 0x41, 0x15, 0x69, 0xe9, 0x41,
+        0x3e, 0x52, 0x01, 0x00, 0x83, 0x24, 0xe9, 0x41, 0x39, 0x22, 0xf0, 0x41, 0x40, 0x56, 0x01, 0x00,
+        0xf0, 0xff, 0xef, 0x41, 0xa7, 0xfd, 0xf6, 0x41, 0x3c, 0x46, 0x01, 0x00, 0x5e, 0xdb, 0xf6, 0x41,
+        0x14, 0xd9, 0xfd, 0x41, 0x3e, 0x4a, 0x01, 0x00, 0xcb, 0xb6, 0xfd, 0x41, 0x1c, 0x99, 0x00, 0x42,
+        0x40, 0x54, 0x01, 0x00, 0x41, 0x92, 0x00, 0x42, 0xf7, 0x4f, 0x02, 0x42, 0x41, 0x5a, 0x01, 0x00,
+        0x1c, 0x49, 0x02, 0x42, 0xf7, 0xc7, 0x05, 0x42, 0x40, 0x4a, 0x01, 0x00, 0xd3, 0xb6, 0x05, 0x42,
+        0xae, 0x35, 0x09, 0x42, 0x3c, 0x43, 0x01, 0x00, 0x89, 0x24, 0x09, 0x42, 0x64, 0xa3, 0x0c, 0x42,
+        0x3e, 0x51, 0x01, 0x00, 0x40, 0x92, 0x0c, 0x42, 0xf7, 0x4f, 0x0e, 0x42, 0x40, 0x55, 0x01, 0x00,
+        0x1b, 0x49, 0x0e, 0x42, 0xd2, 0x06, 0x10, 0x42, 0x41, 0x51, 0x01, 0x00, 0xf7, 0xff, 0x0f, 0x42,
+        0xd2, 0x7e, 0x13, 0x42, 0x40, 0x51, 0x01, 0x00, 0xad, 0x6d, 0x13, 0x42, 0x88, 0xec, 0x16, 0x42,
+        0x3e, 0x4a, 0x01, 0x00, 0x64, 0xdb, 0x16, 0x42, 0x3f, 0x5a, 0x1a, 0x42, 0x3c, 0x43, 0x01, 0x00,
+        0x1a, 0x49, 0x1a, 0x42, 0xf6, 0xc7, 0x1d, 0x42, 0x3e, 0x52, 0x01, 0x00, 0xd1, 0xb6, 0x1d, 0x42,
+        0x1a, 0x39, 0x24, 0x42, 0x43, 0x60, 0x01, 0x00, 0x3e, 0x92, 0x24, 0x42, 0xf5, 0xff, 0x27, 0x42,
+        0x40, 0x58, 0x01, 0x00, 0xf5, 0xff, 0x27, 0x42, 0xd0, 0x7e, 0x2b, 0x42, 0x40, 0x63, 0x01, 0x00,
+        0xac, 0x6d, 0x2b, 0x42, 0x87, 0xec, 0x2e, 0x42, 0x41, 0x68, 0x01, 0x00, 0x62, 0xdb, 0x2e, 0x42,
+        0x19, 0x49, 0x32, 0x42, 0x43, 0x65, 0x01, 0x00, 0x19, 0x49, 0x32, 0x42, 0xf4, 0xc7, 0x35, 0x42,
+        0x43, 0x61, 0x01, 0x00, 0xd0, 0xb6, 0x35, 0x42, 0xab, 0x35, 0x39, 0x42, 0x41, 0x5b, 0x01, 0x00,
+        0x86, 0x24, 0x39, 0x42, 0x61, 0xa3, 0x3c, 0x42, 0x40, 0x59, 0x01, 0x00, 0x3d, 0x92, 0x3c, 0x42,
+        0x18, 0x11, 0x40, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xf3, 0xff, 0x3f, 0x42, 0xaa, 0x6d, 0x43, 0x42,
+        0x3c, 0x59, 0x01, 0x00, 0xaa, 0x6d, 0x43, 0x42, 0x85, 0xec, 0x46, 0x42, 0x3c, 0x63, 0x01, 0x00,
+        0x61, 0xdb, 0x46, 0x42, 0x3c, 0x5a, 0x4a, 0x42, 0x3e, 0x69, 0x01, 0x00, 0x17, 0x49, 0x4a, 0x42,
+        0xf3, 0xc7, 0x4d, 0x42, 0x40, 0x66, 0x01, 0x00, 0xce, 0xb6, 0x4d, 0x42, 0x60, 0xf3, 0x52, 0x42,
+        0x3e, 0x5f, 0x01, 0x00, 0x60, 0xdb, 0x52, 0x42, 0x3b, 0x92, 0x54, 0x42, 0x3c, 0x5a, 0x01, 0x00,
+        0x3b, 0x92, 0x54, 0x42, 0x84, 0x14, 0x5b, 0x42, 0x3c, 0x63, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x22, 0x22, 0x36, 0x3f, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xb6, 0x3f,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xb6, 0x3f, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xb6, 0x3f, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x3f,
+        0x11, 0x11, 0xbb, 0x3f, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0x22, 0x22, 0x3b, 0x40,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0x22, 0x22, 0x3b, 0x40, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x3f, 0x22, 0x22, 0x3b, 0x40, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x3f,
+        0x22, 0x22, 0x3b, 0x40, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x40, 0x11, 0x91, 0x8d, 0x40,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x40, 0x11, 0x91, 0x8d, 0x40, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x40, 0x11, 0x91, 0x8d, 0x40, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x40,
+        0x22, 0x22, 0x6f, 0x40, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40, 0xab, 0x2a, 0x87, 0x40,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x11, 0x91, 0x8f, 0x40, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x90, 0x40, 0xab, 0x2a, 0x9f, 0x40, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40,
+        0x11, 0x91, 0xbd, 0x40, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x40, 0x11, 0x91, 0xbd, 0x40,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x40, 0x11, 0x91, 0xbd, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa0, 0x40, 0x11, 0x91, 0xa7, 0x40, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x40,
+        0x44, 0xc4, 0xbe, 0x40, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x44, 0xc4, 0xd6, 0x40,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x11, 0x91, 0xed, 0x40, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x40, 0x11, 0x91, 0xed, 0x40, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40,
+        0x11, 0x91, 0xed, 0x40, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x40, 0x44, 0xc4, 0xee, 0x40,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x89, 0xc8, 0x0e, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf0, 0x40, 0x89, 0xc8, 0x0e, 0x41, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x40,
+        0x89, 0xc8, 0x0e, 0x41, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x89, 0xc8, 0x0e, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0x89, 0xc8, 0x26, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x10, 0x41, 0x89, 0xc8, 0x26, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41,
+        0x89, 0xc8, 0x26, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x18, 0x41, 0x89, 0xc8, 0x1b, 0x41,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x41, 0x55, 0x95, 0x23, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x24, 0x41, 0x89, 0xc8, 0x27, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x41,
+        0x55, 0x95, 0x2f, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x41, 0x89, 0xc8, 0x3e, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x28, 0x41, 0x89, 0xc8, 0x3e, 0x41, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x41, 0x89, 0xc8, 0x3e, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x30, 0x41,
+        0x89, 0xc8, 0x33, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0x41, 0x22, 0x62, 0x3f, 0x41,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0x89, 0xc8, 0x56, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x41, 0x89, 0xc8, 0x56, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41,
+        0x89, 0xc8, 0x56, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41, 0x89, 0xc8, 0x56, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41, 0x89, 0xc8, 0x6e, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x58, 0x41, 0x89, 0xc8, 0x6e, 0x41, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41,
+        0x89, 0xc8, 0x6e, 0x41, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41, 0x89, 0xc8, 0x6e, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x22, 0x62, 0x7b, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x70, 0x41, 0x44, 0x64, 0x83, 0x41, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41,
+        0x44, 0x64, 0x83, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x44, 0x64, 0x83, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x41, 0xab, 0xca, 0x81, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x82, 0x41, 0x44, 0xe4, 0x83, 0x41, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x41,
+        0x11, 0xb1, 0x89, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x41, 0x44, 0x64, 0x8f, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x41, 0x44, 0x64, 0x8f, 0x41, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x84, 0x41, 0x44, 0x64, 0x8f, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x41,
+        0x11, 0xb1, 0x8f, 0x41, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0x44, 0x64, 0x9b, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0x44, 0x64, 0x9b, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x41, 0x44, 0x64, 0x9b, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41,
+        0x44, 0x64, 0x9b, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x41, 0x44, 0x64, 0xa7, 0x41,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x41, 0x44, 0x64, 0xa7, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x9c, 0x41, 0x44, 0x64, 0xa7, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41,
+        0x44, 0x64, 0xb3, 0x41, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41, 0x44, 0x64, 0xb3, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41, 0x44, 0x64, 0xb3, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb4, 0x41, 0x44, 0x64, 0xbf, 0x41, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x41,
+        0x44, 0x64, 0xbf, 0x41, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x41, 0x44, 0x64, 0xbf, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x11, 0xb1, 0xc5, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0x44, 0x64, 0xcb, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41,
+        0x44, 0x64, 0xcb, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x44, 0x64, 0xcb, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x41, 0xab, 0xca, 0xc9, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xca, 0x41, 0x44, 0xe4, 0xcb, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x41,
+        0x11, 0xb1, 0xd1, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x44, 0x64, 0xd7, 0x41,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x44, 0x64, 0xd7, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xcc, 0x41, 0x44, 0x64, 0xd7, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x41,
+        0x11, 0xb1, 0xd7, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x41, 0xab, 0xca, 0xdb, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x41, 0x44, 0x64, 0xe3, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd8, 0x41, 0x44, 0x64, 0xe3, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x41,
+        0x44, 0x64, 0xe3, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xdc, 0x41, 0x44, 0xe4, 0xdd, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xde, 0x41, 0xab, 0xca, 0xe1, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe2, 0x41, 0x44, 0xe4, 0xe3, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x41,
+        0x11, 0xb1, 0xe9, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x44, 0x64, 0xef, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x44, 0x64, 0xef, 0x41, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe4, 0x41, 0x44, 0x64, 0xef, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xea, 0x41,
+        0xab, 0xca, 0xed, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xee, 0x41, 0x44, 0xe4, 0xef, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x41, 0xab, 0xca, 0xf3, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf0, 0x41, 0x44, 0x64, 0xfb, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0x44, 0x64, 0xfb, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x44, 0x64, 0xfb, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x41, 0x44, 0xe4, 0xf5, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf6, 0x41, 0xab, 0xca, 0xf9, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x41,
+        0x44, 0xe4, 0xfb, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x41, 0xab, 0xca, 0xff, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x41, 0x22, 0xb2, 0x03, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xfc, 0x41, 0x22, 0xb2, 0x03, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x41,
+        0x22, 0xb2, 0x03, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x22, 0xf2, 0x00, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x55, 0xe5, 0x02, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x42, 0x22, 0xf2, 0x03, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42,
+        0x55, 0xe5, 0x05, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42, 0x22, 0xb2, 0x09, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42, 0x22, 0xb2, 0x09, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x04, 0x42, 0x22, 0xb2, 0x09, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x06, 0x42,
+        0x22, 0xf2, 0x06, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x55, 0xe5, 0x08, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x09, 0x42, 0x22, 0xf2, 0x09, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x0a, 0x42, 0x22, 0xf2, 0x0a, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x42,
+        0x22, 0xb2, 0x0f, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x22, 0xb2, 0x0f, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x22, 0xb2, 0x0f, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x0b, 0x42, 0x89, 0xd8, 0x0d, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42,
+        0x22, 0xb2, 0x15, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42, 0x22, 0xb2, 0x15, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42, 0x22, 0xb2, 0x15, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x11, 0x42, 0x22, 0xf2, 0x11, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x12, 0x42,
+        0x22, 0xf2, 0x12, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x13, 0x42, 0x55, 0xe5, 0x14, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0x22, 0xf2, 0x15, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x16, 0x42, 0x55, 0xe5, 0x17, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42,
+        0x22, 0xb2, 0x1b, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x16, 0x42, 0x22, 0xb2, 0x1b, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x16, 0x42, 0x22, 0xb2, 0x1b, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x18, 0x42, 0x22, 0xf2, 0x18, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x19, 0x42,
+        0x89, 0xd8, 0x1b, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x22, 0xb2, 0x21, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x22, 0xb2, 0x21, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x1c, 0x42, 0x22, 0xb2, 0x21, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x42,
+        0x22, 0xf2, 0x1d, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x42, 0x22, 0xf2, 0x1e, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x42, 0x55, 0xe5, 0x20, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x21, 0x42, 0x22, 0xf2, 0x21, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42,
+        0x55, 0xe5, 0x23, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42, 0x22, 0xb2, 0x27, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x22, 0x42, 0x22, 0xb2, 0x27, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x22, 0x42, 0x22, 0xb2, 0x27, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x24, 0x42,
+        0x22, 0xf2, 0x24, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x25, 0x42, 0x89, 0xd8, 0x27, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x22, 0xb2, 0x2d, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x42, 0x22, 0xb2, 0x2d, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42,
+        0x22, 0xb2, 0x2d, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x29, 0x42, 0x22, 0xf2, 0x29, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x42, 0x22, 0xf2, 0x2a, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2b, 0x42, 0x55, 0xe5, 0x2c, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x42,
+        0x22, 0xf2, 0x2d, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x42, 0x55, 0xe5, 0x2f, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x42, 0x22, 0xb2, 0x33, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x2e, 0x42, 0x22, 0xb2, 0x33, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x42,
+        0x22, 0xb2, 0x33, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x30, 0x42, 0x22, 0xf2, 0x30, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x31, 0x42, 0x55, 0xe5, 0x32, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x33, 0x42, 0x22, 0xf2, 0x33, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0x42,
+        0x89, 0xd8, 0x36, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0x42, 0x22, 0xb2, 0x39, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x34, 0x42, 0x22, 0xb2, 0x39, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x34, 0x42, 0x22, 0xb2, 0x39, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x37, 0x42,
+        0x89, 0xd8, 0x39, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x42, 0xbc, 0xcb, 0x3d, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x42, 0x22, 0xb2, 0x3f, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3a, 0x42, 0x22, 0xb2, 0x3f, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x42,
+        0x22, 0xb2, 0x3f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x22, 0xf2, 0x3e, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x42, 0x22, 0xf2, 0x3f, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x42, 0x89, 0xd8, 0x42, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42,
+        0x22, 0xb2, 0x45, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0x22, 0xb2, 0x45, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0x22, 0xb2, 0x45, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x43, 0x42, 0x89, 0xd8, 0x45, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x42,
+        0x22, 0xb2, 0x4b, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x42, 0x22, 0xb2, 0x4b, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x46, 0x42, 0x22, 0xb2, 0x4b, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x46, 0x42, 0x22, 0xb2, 0x4b, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42,
+        0x22, 0xb2, 0x51, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42, 0x22, 0xb2, 0x51, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42, 0x22, 0xb2, 0x51, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x4e, 0x42, 0x22, 0xf2, 0x4e, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x42,
+        0x55, 0xe5, 0x50, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x51, 0x42, 0x22, 0xf2, 0x51, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x52, 0x42, 0x55, 0xe5, 0x53, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x52, 0x42, 0x22, 0xb2, 0x57, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x52, 0x42,
+        0x22, 0xb2, 0x57, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x52, 0x42, 0x22, 0xb2, 0x57, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x54, 0x42, 0x22, 0xf2, 0x54, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x55, 0x42, 0x89, 0xd8, 0x57, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42,
+        0x89, 0xd8, 0x5a, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42, 0x22, 0xb2, 0x5d, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x42, 0x22, 0xb2, 0x5d, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x58, 0x42, 0x22, 0xb2, 0x5d, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5b, 0x42,
+        0x89, 0xd8, 0x5d, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x42, 0x22, 0xb2, 0x63, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x42, 0x22, 0xb2, 0x63, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x5e, 0x42, 0x22, 0xb2, 0x63, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x42,
+        0x22, 0xb2, 0x63, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42, 0x22, 0xb2, 0x69, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42, 0x22, 0xb2, 0x69, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x64, 0x42, 0x22, 0xb2, 0x69, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x66, 0x42,
+        0x22, 0xf2, 0x66, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x67, 0x42, 0x55, 0xe5, 0x68, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x69, 0x42, 0x22, 0xf2, 0x69, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x6a, 0x42, 0x55, 0xe5, 0x6b, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42,
+        0x22, 0xb2, 0x6f, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x22, 0xb2, 0x6f, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x22, 0xb2, 0x6f, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x6c, 0x42, 0x22, 0xf2, 0x6c, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x42,
+        0x89, 0xd8, 0x6f, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42, 0x22, 0xb2, 0x75, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42, 0x22, 0xb2, 0x75, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x42, 0x22, 0xb2, 0x75, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42,
+        0x22, 0xb2, 0x75, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x76, 0x42, 0x22, 0xb2, 0x7b, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x76, 0x42, 0x22, 0xb2, 0x7b, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x76, 0x42, 0x22, 0xb2, 0x7b, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x76, 0x42,
+        0x22, 0xb2, 0x7b, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x89, 0xd8, 0x7e, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x11, 0xd9, 0x80, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x7c, 0x42, 0x11, 0xd9, 0x80, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42,
+        0x11, 0xd9, 0x80, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x42, 0xab, 0x72, 0x80, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x80, 0x80, 0x42, 0x11, 0xf9, 0x80, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x81, 0x42, 0x44, 0x6c, 0x82, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x81, 0x42,
+        0x11, 0xd9, 0x83, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x81, 0x42, 0x11, 0xd9, 0x83, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x81, 0x42, 0x11, 0xd9, 0x83, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x82, 0x42, 0x44, 0xec, 0x83, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42,
+        0x11, 0xd9, 0x86, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42, 0x11, 0xd9, 0x86, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42, 0x11, 0xd9, 0x86, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x84, 0x42, 0x11, 0xd9, 0x86, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42,
+        0x11, 0xd9, 0x89, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42, 0x11, 0xd9, 0x89, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42, 0x11, 0xd9, 0x89, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8a, 0x42, 0x11, 0xd9, 0x8c, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x42,
+        0x11, 0xd9, 0x8c, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x42, 0x11, 0xd9, 0x8c, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x42, 0x11, 0xd9, 0x8f, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8d, 0x42, 0x11, 0xd9, 0x8f, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x42,
+        0x11, 0xd9, 0x8f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x42, 0x44, 0x6c, 0x91, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x42, 0x11, 0x79, 0x90, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x90, 0x42, 0x11, 0xf9, 0x90, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x91, 0x42,
+        0x11, 0x79, 0x91, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x91, 0x42, 0x44, 0xec, 0x92, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x91, 0x42, 0x11, 0xf9, 0x91, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x92, 0x42, 0x11, 0x79, 0x92, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x92, 0x42,
+        0x11, 0xf9, 0x92, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x93, 0x42, 0x11, 0xd9, 0x95, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x93, 0x42, 0x11, 0x79, 0x93, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x93, 0x42, 0x11, 0xf9, 0x93, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x94, 0x42,
+        0x11, 0x79, 0x94, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x94, 0x42, 0x11, 0xf9, 0x94, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x95, 0x42, 0x11, 0x79, 0x95, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x95, 0x42, 0x11, 0xf9, 0x95, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x96, 0x42,
+        0x11, 0x79, 0x96, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0x96, 0x42, 0x11, 0xf9, 0x96, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x97, 0x42, 0x11, 0x79, 0x97, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x97, 0x42, 0x11, 0x79, 0x97, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x97, 0x42,
+        0xab, 0x72, 0x98, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x97, 0x42, 0x11, 0xf9, 0x97, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x98, 0x42, 0x11, 0x79, 0x98, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x98, 0x42, 0x11, 0xf9, 0x98, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x98, 0x42,
+        0x11, 0xf9, 0x98, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x99, 0x42, 0xab, 0xf2, 0x99, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x99, 0x42, 0x11, 0x79, 0x99, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x99, 0x42, 0x11, 0xf9, 0x99, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9a, 0x42,
+        0x11, 0x79, 0x9a, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x42, 0x11, 0x79, 0x9a, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x9a, 0x42, 0x44, 0xec, 0x9b, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x9a, 0x42, 0x11, 0xf9, 0x9a, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9b, 0x42,
+        0x11, 0x79, 0x9b, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x80, 0x9b, 0x42, 0x11, 0xf9, 0x9b, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x42, 0x44, 0x6c, 0x9d, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9c, 0x42, 0x11, 0x79, 0x9c, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x9c, 0x42,
+        0x11, 0xf9, 0x9c, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x42, 0x11, 0x79, 0x9d, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x9d, 0x42, 0x44, 0xec, 0x9e, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x9d, 0x42, 0x11, 0xf9, 0x9d, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9e, 0x42,
+        0x11, 0x79, 0x9e, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x9e, 0x42, 0x11, 0xf9, 0x9e, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9f, 0x42, 0x11, 0xd9, 0xa1, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9f, 0x42, 0x11, 0x79, 0x9f, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x80, 0x9f, 0x42,
+        0x11, 0xf9, 0x9f, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x42, 0x11, 0x79, 0xa0, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa0, 0x42, 0x11, 0xf9, 0xa0, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa1, 0x42, 0x11, 0x79, 0xa1, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa1, 0x42,
+        0x11, 0xf9, 0xa1, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa2, 0x42, 0x11, 0x79, 0xa2, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa2, 0x42, 0x11, 0xf9, 0xa2, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa3, 0x42, 0x11, 0x79, 0xa3, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x42,
+        0x11, 0x79, 0xa3, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa3, 0x42, 0xab, 0x72, 0xa4, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0xa3, 0x42, 0x11, 0xf9, 0xa3, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa4, 0x42, 0x11, 0x79, 0xa4, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa4, 0x42,
+        0x11, 0xf9, 0xa4, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0xa4, 0x42, 0x11, 0xf9, 0xa4, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa5, 0x42, 0xab, 0xf2, 0xa5, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa5, 0x42, 0x11, 0x79, 0xa5, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa5, 0x42,
+        0x11, 0xf9, 0xa5, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa6, 0x42, 0x11, 0x79, 0xa6, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x42, 0x11, 0x79, 0xa6, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xa6, 0x42, 0x44, 0xec, 0xa7, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x80, 0xa6, 0x42,
+        0x11, 0xf9, 0xa6, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa7, 0x42, 0x11, 0x79, 0xa7, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa7, 0x42, 0x11, 0xf9, 0xa7, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa8, 0x42, 0x11, 0xd9, 0xaa, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x42,
+        0x11, 0x79, 0xa8, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa8, 0x42, 0x11, 0xf9, 0xa8, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x42, 0x11, 0x79, 0xa9, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xa9, 0x42, 0x11, 0xf9, 0xa9, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x42,
+        0x11, 0x79, 0xaa, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xaa, 0x42, 0x11, 0xf9, 0xaa, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xab, 0x42, 0x11, 0xd9, 0xad, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xab, 0x42, 0x11, 0x79, 0xab, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x80, 0xab, 0x42,
+        0x11, 0xf9, 0xab, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xac, 0x42, 0x11, 0x79, 0xac, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xac, 0x42, 0x11, 0xf9, 0xac, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xad, 0x42, 0x11, 0x79, 0xad, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0xad, 0x42,
+        0x11, 0xf9, 0xad, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xae, 0x42, 0x44, 0x6c, 0xaf, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xae, 0x42, 0x11, 0x79, 0xae, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xae, 0x42, 0x11, 0xf9, 0xae, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xaf, 0x42,
+        0x11, 0x79, 0xaf, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xaf, 0x42, 0xab, 0x72, 0xb0, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x80, 0xaf, 0x42, 0x11, 0xf9, 0xaf, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb0, 0x42, 0x11, 0x79, 0xb0, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb0, 0x42,
+        0x11, 0xf9, 0xb0, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x80, 0xb0, 0x42, 0x11, 0xf9, 0xb0, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x42, 0x44, 0x6c, 0xb2, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb1, 0x42, 0x11, 0x79, 0xb1, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb1, 0x42,
+        0x11, 0xf9, 0xb1, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb2, 0x42, 0x11, 0x79, 0xb2, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb2, 0x42, 0x44, 0xec, 0xb3, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0xb2, 0x42, 0x11, 0xf9, 0xb2, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb3, 0x42,
+        0x11, 0x79, 0xb3, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb3, 0x42, 0x11, 0xf9, 0xb3, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x42, 0x11, 0xd9, 0xb6, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb4, 0x42, 0x11, 0x79, 0xb4, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb4, 0x42,
+        0x11, 0xf9, 0xb4, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb5, 0x42, 0x11, 0x79, 0xb5, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb5, 0x42, 0x11, 0xf9, 0xb5, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb6, 0x42, 0x11, 0x79, 0xb6, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb6, 0x42,
+        0x11, 0xf9, 0xb6, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x42, 0x11, 0x79, 0xb7, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb7, 0x42, 0x11, 0xf9, 0xb7, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb8, 0x42, 0x11, 0x79, 0xb8, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb8, 0x42,
+        0x11, 0xf9, 0xb8, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x42, 0x11, 0x79, 0xb9, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb9, 0x42, 0x11, 0xf9, 0xb9, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xba, 0x42, 0x11, 0x79, 0xba, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0xba, 0x42,
+        0x11, 0xf9, 0xba, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbb, 0x42, 0x11, 0x79, 0xbb, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xbb, 0x42, 0x11, 0xf9, 0xbb, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xbc, 0x42, 0x11, 0x79, 0xbc, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xbc, 0x42,
+        0x11, 0xf9, 0xbc, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x42, 0x11, 0x79, 0xbd, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0xbd, 0x42, 0x11, 0xf9, 0xbd, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xbe, 0x42, 0x11, 0x79, 0xbe, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xbe, 0x42,
+        0x11, 0xf9, 0xbe, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x42, 0x11, 0x79, 0xbf, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x80, 0xbf, 0x42, 0x11, 0xf9, 0xbf, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x42, 0x11, 0xd9, 0xc2, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x42,
+        0x11, 0xd9, 0xc2, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x42, 0x11, 0xd9, 0xc2, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0xc5, 0x54, 0x08, 0x41, 0x3d, 0x1e, 0x0c, 0x41, 0x48, 0x7f, 0x01, 0x00,
+        0x12, 0xda, 0x10, 0x41, 0x89, 0xa3, 0x14, 0x41, 0x48, 0x7f, 0x01, 0x00, 0x5e, 0x5f, 0x19, 0x41,
+        0xd5, 0x28, 0x1d, 0x41, 0x48, 0x7f, 0x01, 0x00, 0x2a, 0x18, 0x30, 0x41, 0xe5, 0xfc, 0x31, 0x41,
+        0x48, 0x7f, 0x01, 0x00, 0x43, 0xef, 0x32, 0x41, 0xff, 0xd3, 0x34, 0x41, 0x47, 0x7f, 0x01, 0x00,
+        0x76, 0x9d, 0x38, 0x41, 0x32, 0x82, 0x3a, 0x41, 0x45, 0x7f, 0x01, 0x00, 0x8f, 0x74, 0x3b, 0x41,
+        0xc2, 0x22, 0x41, 0x41, 0x47, 0x7f, 0x01, 0x00, 0xc2, 0x22, 0x41, 0x41, 0x7e, 0x07, 0x43, 0x41,
+        0x48, 0x7f, 0x01, 0x00, 0xdc, 0xf9, 0x43, 0x41, 0x97, 0xde, 0x45, 0x41, 0x4a, 0x7f, 0x01, 0x00,
+        0x28, 0x7f, 0x4c, 0x41, 0x9f, 0x48, 0x50, 0x41, 0x4c, 0x7f, 0x01, 0x00, 0x74, 0x04, 0x55, 0x41,
+        0xec, 0xcd, 0x58, 0x41, 0x4c, 0x7f, 0x01, 0x00, 0xc1, 0x89, 0x5d, 0x41, 0x38, 0x53, 0x61, 0x41,
+        0x4c, 0x7f, 0x01, 0x00, 0x8c, 0x42, 0x74, 0x41, 0x48, 0x27, 0x76, 0x41, 0x4c, 0x7f, 0x01, 0x00,
+        0xa6, 0x19, 0x77, 0x41, 0x61, 0xfe, 0x78, 0x41, 0x4a, 0x7f, 0x01, 0x00, 0xd9, 0xc7, 0x7c, 0x41,
+        0x94, 0xac, 0x7e, 0x41, 0x48, 0x7f, 0x01, 0x00, 0xf2, 0x9e, 0x7f, 0x41, 0xd7, 0xc1, 0x80, 0x41,
+        0x4a, 0x7f, 0x01, 0x00, 0x92, 0xa6, 0x82, 0x41, 0xf0, 0x98, 0x83, 0x41, 0x4c, 0x7f, 0x01, 0x00,
+        0x1f, 0x12, 0x84, 0x41, 0x7d, 0x04, 0x85, 0x41, 0x4d, 0x7f, 0x01, 0x00, 0xc5, 0x54, 0x88, 0x41,
+        0x23, 0x47, 0x89, 0x41, 0x4f, 0x7f, 0x01, 0x00, 0x12, 0xda, 0x90, 0x41, 0x6f, 0xcc, 0x91, 0x41,
+        0x48, 0x7f, 0x01, 0x00, 0x77, 0x36, 0x9c, 0x41, 0xd5, 0x28, 0x9d, 0x41, 0x51, 0x7f, 0x01, 0x00,
+        0x04, 0xa2, 0x9d, 0x41, 0x62, 0x94, 0x9e, 0x41, 0x4f, 0x7f, 0x01, 0x00, 0x1e, 0x79, 0xa0, 0x41,
+        0x7b, 0x6b, 0xa1, 0x41, 0x4d, 0x7f, 0x01, 0x00, 0xaa, 0xe4, 0xa1, 0x41, 0x08, 0xd7, 0xa2, 0x41,
+        0x4c, 0x7f, 0x01, 0x00, 0x50, 0x27, 0xa6, 0x41, 0xae, 0x19, 0xa7, 0x41, 0x4a, 0x7f, 0x01, 0x00,
+        0xf7, 0x69, 0xaa, 0x41, 0x54, 0x5c, 0xab, 0x41, 0x48, 0x7f, 0x01, 0x00, 0xb6, 0x83, 0xb1, 0x41,
+        0x14, 0x76, 0xb2, 0x41, 0x47, 0x7f, 0x01, 0x00, 0x43, 0xef, 0xb2, 0x41, 0xa1, 0xe1, 0xb3, 0x41,
+        0x45, 0x7f, 0x01, 0x00, 0x03, 0x09, 0xba, 0x41, 0x60, 0xfb, 0xba, 0x41, 0x43, 0x7f, 0x01, 0x00,
+        0x8f, 0x74, 0xbb, 0x41, 0xed, 0x66, 0xbc, 0x41, 0x41, 0x7f, 0x01, 0x00, 0x4f, 0x8e, 0xc2, 0x41,
+        0xad, 0x80, 0xc3, 0x41, 0x43, 0x7f, 0x01, 0x00, 0xdc, 0xf9, 0xc3, 0x41, 0x39, 0xec, 0xc4, 0x41,
+        0x45, 0x7f, 0x01, 0x00, 0x82, 0x3c, 0xc8, 0x41, 0xe0, 0x2e, 0xc9, 0x41, 0x47, 0x7f, 0x01, 0x00,
+        0x28, 0x7f, 0xcc, 0x41, 0x86, 0x71, 0xcd, 0x41, 0x48, 0x7f, 0x01, 0x00, 0xce, 0xc1, 0xd0, 0x41,
+        0x8a, 0xa6, 0xd2, 0x41, 0x48, 0x7f, 0x01, 0x00, 0x74, 0x04, 0xd5, 0x41, 0x30, 0xe9, 0xd6, 0x41,
+        0x48, 0x7f, 0x01, 0x00, 0xda, 0x60, 0xe0, 0x41, 0x38, 0x53, 0xe1, 0x41, 0x48, 0x7f, 0x01, 0x00,
+        0x67, 0xcc, 0xe1, 0x41, 0xc5, 0xbe, 0xe2, 0x41, 0x47, 0x7f, 0x01, 0x00, 0x80, 0xa3, 0xe4, 0x41,
+        0xde, 0x95, 0xe5, 0x41, 0x45, 0x7f, 0x01, 0x00, 0x0d, 0x0f, 0xe6, 0x41, 0x6b, 0x01, 0xe7, 0x41,
+        0x47, 0x7f, 0x01, 0x00, 0x26, 0xe6, 0xe8, 0x41, 0x84, 0xd8, 0xe9, 0x41, 0x48, 0x7f, 0x01, 0x00,
+        0xb3, 0x51, 0xea, 0x41, 0x11, 0x44, 0xeb, 0x41, 0x4a, 0x7f, 0x01, 0x00, 0x59, 0x94, 0xee, 0x41,
+        0x15, 0x79, 0xf0, 0x41, 0x4c, 0x7f, 0x01, 0x00, 0xff, 0xd6, 0xf2, 0x41, 0xbb, 0xbb, 0xf4, 0x41,
+        0x4c, 0x7f, 0x01, 0x00, 0xa6, 0x19, 0xf7, 0x41, 0x61, 0xfe, 0xf8, 0x41, 0x4c, 0x7f, 0x01, 0x00,
+        0x06, 0x3b, 0x01, 0x42, 0x35, 0xb4, 0x01, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0xcc, 0xf0, 0x01, 0x42,
+        0xfb, 0x69, 0x02, 0x42, 0x4a, 0x7f, 0x01, 0x00, 0x59, 0x5c, 0x03, 0x42, 0x88, 0xd5, 0x03, 0x42,
+        0x48, 0x7f, 0x01, 0x00, 0x1f, 0x12, 0x04, 0x42, 0x4e, 0x8b, 0x04, 0x42, 0x4a, 0x7f, 0x01, 0x00,
+        0xac, 0x7d, 0x05, 0x42, 0xdb, 0xf6, 0x05, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0x72, 0x33, 0x06, 0x42,
+        0xa1, 0xac, 0x06, 0x42, 0x4d, 0x7f, 0x01, 0x00, 0xc5, 0x54, 0x08, 0x42, 0xf4, 0xcd, 0x08, 0x42,
+        0x4f, 0x7f, 0x01, 0x00, 0x6b, 0x97, 0x0c, 0x42, 0x9a, 0x10, 0x0d, 0x42, 0x48, 0x7f, 0x01, 0x00,
+        0x9e, 0x45, 0x12, 0x42, 0xcd, 0xbe, 0x12, 0x42, 0x51, 0x7f, 0x01, 0x00, 0x65, 0xfb, 0x12, 0x42,
+        0x94, 0x74, 0x13, 0x42, 0x4f, 0x7f, 0x01, 0x00, 0xf1, 0x66, 0x14, 0x42, 0x20, 0xe0, 0x14, 0x42,
+        0x4d, 0x7f, 0x01, 0x00, 0xb8, 0x1c, 0x15, 0x42, 0xe7, 0x95, 0x15, 0x42, 0x4c, 0x7f, 0x01, 0x00,
+        0x0b, 0x3e, 0x17, 0x42, 0x3a, 0xb7, 0x17, 0x42, 0x4a, 0x7f, 0x01, 0x00, 0x5e, 0x5f, 0x19, 0x42,
+        0x8d, 0xd8, 0x19, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x3e, 0xec, 0x1c, 0x42, 0x6d, 0x65, 0x1d, 0x42,
+        0x47, 0x7f, 0x01, 0x00, 0x04, 0xa2, 0x1d, 0x42, 0x33, 0x1b, 0x1e, 0x42, 0x45, 0x7f, 0x01, 0x00,
+        0xe4, 0x2e, 0x21, 0x42, 0x13, 0xa8, 0x21, 0x42, 0x43, 0x7f, 0x01, 0x00, 0xaa, 0xe4, 0x21, 0x42,
+        0xd9, 0x5d, 0x22, 0x42, 0x41, 0x7f, 0x01, 0x00, 0x8a, 0x71, 0x25, 0x42, 0xb9, 0xea, 0x25, 0x42,
+        0x43, 0x7f, 0x01, 0x00, 0x50, 0x27, 0x26, 0x42, 0x7f, 0xa0, 0x26, 0x42, 0x45, 0x7f, 0x01, 0x00,
+        0xa4, 0x48, 0x28, 0x42, 0xd2, 0xc1, 0x28, 0x42, 0x47, 0x7f, 0x01, 0x00, 0xf7, 0x69, 0x2a, 0x42,
+        0x26, 0xe3, 0x2a, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x4a, 0x8b, 0x2c, 0x42, 0xa8, 0x7d, 0x2d, 0x42,
+        0x48, 0x7f, 0x01, 0x00, 0x9d, 0xac, 0x2e, 0x42, 0xfb, 0x9e, 0x2f, 0x42, 0x48, 0x7f, 0x01, 0x00,
+        0xd0, 0x5a, 0x34, 0x42, 0xff, 0xd3, 0x34, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x96, 0x10, 0x35, 0x42,
+        0xc5, 0x89, 0x35, 0x42, 0x47, 0x7f, 0x01, 0x00, 0x23, 0x7c, 0x36, 0x42, 0x52, 0xf5, 0x36, 0x42,
+        0x45, 0x7f, 0x01, 0x00, 0xe9, 0x31, 0x37, 0x42, 0x18, 0xab, 0x37, 0x42, 0x47, 0x7f, 0x01, 0x00,
+        0x76, 0x9d, 0x38, 0x42, 0xa5, 0x16, 0x39, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x3c, 0x53, 0x39, 0x42,
+        0x6b, 0xcc, 0x39, 0x42, 0x4a, 0x7f, 0x01, 0x00, 0x8f, 0x74, 0x3b, 0x42, 0xed, 0x66, 0x3c, 0x42,
+        0x4c, 0x7f, 0x01, 0x00, 0xe2, 0x95, 0x3d, 0x42, 0x40, 0x88, 0x3e, 0x42, 0x4c, 0x7f, 0x01, 0x00,
+        0x35, 0xb7, 0x3f, 0x42, 0x93, 0xa9, 0x40, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0x68, 0x65, 0x45, 0x42,
+        0x97, 0xde, 0x45, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0x2f, 0x1b, 0x46, 0x42, 0x5e, 0x94, 0x46, 0x42,
+        0x4a, 0x7f, 0x01, 0x00, 0xbb, 0x86, 0x47, 0x42, 0xea, 0xff, 0x47, 0x42, 0x48, 0x7f, 0x01, 0x00,
+        0x82, 0x3c, 0x48, 0x42, 0xb1, 0xb5, 0x48, 0x42, 0x4a, 0x7f, 0x01, 0x00, 0x0f, 0xa8, 0x49, 0x42,
+        0x3d, 0x21, 0x4a, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0xd5, 0x5d, 0x4a, 0x42, 0x04, 0xd7, 0x4a, 0x42,
+        0x4d, 0x7f, 0x01, 0x00, 0x28, 0x7f, 0x4c, 0x42, 0x57, 0xf8, 0x4c, 0x42, 0x4f, 0x7f, 0x01, 0x00,
+        0xce, 0xc1, 0x50, 0x42, 0xfd, 0x3a, 0x51, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x01, 0x70, 0x56, 0x42,
+        0x30, 0xe9, 0x56, 0x42, 0x51, 0x7f, 0x01, 0x00, 0xc7, 0x25, 0x57, 0x42, 0xf6, 0x9e, 0x57, 0x42,
+        0x4f, 0x7f, 0x01, 0x00, 0x54, 0x91, 0x58, 0x42, 0x83, 0x0a, 0x59, 0x42, 0x4d, 0x7f, 0x01, 0x00,
+        0x1a, 0x47, 0x59, 0x42, 0x49, 0xc0, 0x59, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0x6e, 0x68, 0x5b, 0x42,
+        0x9c, 0xe1, 0x5b, 0x42, 0x4a, 0x7f, 0x01, 0x00, 0xc1, 0x89, 0x5d, 0x42, 0xf0, 0x02, 0x5e, 0x42,
+        0x48, 0x7f, 0x01, 0x00, 0xa0, 0x16, 0x61, 0x42, 0xcf, 0x8f, 0x61, 0x42, 0x47, 0x7f, 0x01, 0x00,
+        0x67, 0xcc, 0x61, 0x42, 0x96, 0x45, 0x62, 0x42, 0x45, 0x7f, 0x01, 0x00, 0x47, 0x59, 0x65, 0x42,
+        0x76, 0xd2, 0x65, 0x42, 0x43, 0x7f, 0x01, 0x00, 0x0d, 0x0f, 0x66, 0x42, 0x3c, 0x88, 0x66, 0x42,
+        0x41, 0x7f, 0x01, 0x00, 0xed, 0x9b, 0x69, 0x42, 0x1c, 0x15, 0x6a, 0x42, 0x43, 0x7f, 0x01, 0x00,
+        0xb3, 0x51, 0x6a, 0x42, 0xe2, 0xca, 0x6a, 0x42, 0x45, 0x7f, 0x01, 0x00, 0x06, 0x73, 0x6c, 0x42,
+        0x35, 0xec, 0x6c, 0x42, 0x47, 0x7f, 0x01, 0x00, 0x59, 0x94, 0x6e, 0x42, 0xb7, 0x86, 0x6f, 0x42,
+        0x48, 0x7f, 0x01, 0x00, 0xac, 0xb5, 0x70, 0x42, 0x0a, 0xa8, 0x71, 0x42, 0x48, 0x7f, 0x01, 0x00,
+        0xff, 0xd6, 0x72, 0x42, 0x5d, 0xc9, 0x73, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x32, 0x85, 0x78, 0x42,
+        0x61, 0xfe, 0x78, 0x42, 0x48, 0x7f, 0x01, 0x00, 0xf9, 0x3a, 0x79, 0x42, 0x28, 0xb4, 0x79, 0x42,
+        0x47, 0x7f, 0x01, 0x00, 0x85, 0xa6, 0x7a, 0x42, 0xb4, 0x1f, 0x7b, 0x42, 0x45, 0x7f, 0x01, 0x00,
+        0x4c, 0x5c, 0x7b, 0x42, 0xd9, 0xc7, 0x7c, 0x42, 0x47, 0x7f, 0x01, 0x00, 0xd9, 0xc7, 0x7c, 0x42,
+        0x07, 0x41, 0x7d, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x9f, 0x7d, 0x7d, 0x42, 0xce, 0xf6, 0x7d, 0x42,
+        0x4a, 0x7f, 0x01, 0x00, 0xf2, 0x9e, 0x7f, 0x42, 0xa8, 0x48, 0x80, 0x42, 0x4c, 0x7f, 0x01, 0x00,
+        0x23, 0xe0, 0x80, 0x42, 0x51, 0x59, 0x81, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0xcc, 0xf0, 0x81, 0x42,
+        0xfb, 0x69, 0x82, 0x42, 0x4c, 0x7f, 0x01, 0x00, 0xe6, 0xc7, 0x84, 0x42, 0x7d, 0x04, 0x85, 0x42,
+        0x4c, 0x7f, 0x01, 0x00, 0xc9, 0x22, 0x85, 0x42, 0x60, 0x5f, 0x85, 0x42, 0x4a, 0x7f, 0x01, 0x00,
+        0x8f, 0xd8, 0x85, 0x42, 0x27, 0x15, 0x86, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x72, 0x33, 0x86, 0x42,
+        0x0a, 0x70, 0x86, 0x42, 0x4a, 0x7f, 0x01, 0x00, 0x39, 0xe9, 0x86, 0x42, 0xd0, 0x25, 0x87, 0x42,
+        0x4c, 0x7f, 0x01, 0x00, 0x1c, 0x44, 0x87, 0x42, 0xb3, 0x80, 0x87, 0x42, 0x4d, 0x7f, 0x01, 0x00,
+        0xc5, 0x54, 0x88, 0x42, 0x5d, 0x91, 0x88, 0x42, 0x4f, 0x7f, 0x01, 0x00, 0x18, 0x76, 0x8a, 0x42,
+        0xb0, 0xb2, 0x8a, 0x42, 0x48, 0x7f, 0x01, 0x00, 0x32, 0x4d, 0x8d, 0x42, 0xc9, 0x89, 0x8d, 0x42,
+        0x51, 0x7f, 0x01, 0x00, 0x15, 0xa8, 0x8d, 0x42, 0xac, 0xe4, 0x8d, 0x42, 0x4f, 0x7f, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x72, 0x3e, 0x43, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x11, 0x11, 0xf3, 0x3f, 0x37, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x72, 0x3e,
+        0x33, 0x31, 0x01, 0x00, 0x00, 0x00, 0x80, 0x3e, 0x11, 0x11, 0xf9, 0x3e, 0x43, 0x31, 0x00, 0x00,
+        0x00, 0x00, 0x80, 0x3e, 0x11, 0x11, 0xf9, 0x3e, 0x33, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3f,
+        0x89, 0x88, 0x3c, 0x3f, 0x43, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x89, 0x88, 0x3c, 0x3f,
+        0x33, 0x31, 0x01, 0x00, 0x00, 0x00, 0x40, 0x3f, 0x89, 0x88, 0x7c, 0x3f, 0x43, 0x21, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x3f, 0x89, 0x88, 0x7c, 0x3f, 0x33, 0x21, 0x01, 0x00, 0x00, 0x00, 0x80, 0x3f,
+        0x44, 0x44, 0x9e, 0x3f, 0x43, 0x30, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x44, 0x44, 0x9e, 0x3f,
+        0x33, 0x30, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x3f, 0x44, 0x44, 0xbe, 0x3f, 0x43, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0xa0, 0x3f, 0x44, 0x44, 0xbe, 0x3f, 0x33, 0x40, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x3f,
+        0x44, 0x44, 0xde, 0x3f, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0x44, 0x44, 0xde, 0x3f,
+        0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x44, 0x44, 0xfe, 0x3f, 0x43, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0xe0, 0x3f, 0x44, 0x44, 0xfe, 0x3f, 0x33, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40,
+        0x22, 0x22, 0x0f, 0x40, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x89, 0x88, 0x79, 0x40,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x22, 0x22, 0x0f, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x10, 0x40, 0x22, 0x22, 0x1f, 0x40, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40,
+        0x22, 0x22, 0x1f, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x20, 0x40, 0x22, 0x22, 0x2f, 0x40,
+        0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x22, 0x22, 0x2f, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x30, 0x40, 0x22, 0x22, 0x3f, 0x40, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x30, 0x40,
+        0x22, 0x22, 0x3f, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x40, 0x40, 0x22, 0x22, 0x4f, 0x40,
+        0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x22, 0x22, 0x4f, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x50, 0x40, 0x22, 0x22, 0x5f, 0x40, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40,
+        0x22, 0x22, 0x5f, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x60, 0x40, 0x22, 0x22, 0x6f, 0x40,
+        0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x22, 0x22, 0x6f, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x40, 0x22, 0x22, 0x7f, 0x40, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40,
+        0x22, 0x22, 0x7f, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x80, 0x40, 0x11, 0x91, 0x87, 0x40,
+        0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x44, 0xc4, 0xbc, 0x40, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x80, 0x40, 0x11, 0x91, 0x87, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x88, 0x40,
+        0x11, 0x91, 0x8f, 0x40, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x11, 0x91, 0x8f, 0x40,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x90, 0x40, 0x11, 0x91, 0x97, 0x40, 0x4a, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x90, 0x40, 0x11, 0x91, 0x97, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x98, 0x40,
+        0x11, 0x91, 0x9f, 0x40, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x98, 0x40, 0x11, 0x91, 0x9f, 0x40,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x11, 0x91, 0xa7, 0x40, 0x48, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xa0, 0x40, 0x11, 0x91, 0xa7, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x40,
+        0x11, 0x91, 0xaf, 0x40, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x40, 0x11, 0x91, 0xaf, 0x40,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x40, 0x11, 0x91, 0xb7, 0x40, 0x48, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xb0, 0x40, 0x11, 0x91, 0xb7, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x40,
+        0x11, 0x91, 0xbf, 0x40, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x40, 0x11, 0x91, 0xbf, 0x40,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x11, 0x91, 0xc7, 0x40, 0x4d, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x40, 0x44, 0xc4, 0xfc, 0x40, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40,
+        0x11, 0x91, 0xc7, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x40, 0x11, 0x91, 0xcf, 0x40,
+        0x4d, 0x70, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x40, 0x11, 0x91, 0xcf, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xd0, 0x40, 0x11, 0x91, 0xd7, 0x40, 0x4d, 0x70, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x40,
+        0x11, 0x91, 0xd7, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x40, 0x11, 0x91, 0xdf, 0x40,
+        0x4d, 0x70, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x40, 0x11, 0x91, 0xdf, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xe0, 0x40, 0x11, 0x91, 0xe7, 0x40, 0x4d, 0x70, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x40,
+        0x11, 0x91, 0xe7, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x40, 0x11, 0x91, 0xef, 0x40,
+        0x4d, 0x70, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x40, 0x11, 0x91, 0xef, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0x40, 0x11, 0x91, 0xf7, 0x40, 0x4d, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x40,
+        0x11, 0x91, 0xf7, 0x40, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xf8, 0x40, 0x11, 0x91, 0xff, 0x40,
+        0x4d, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x40, 0x11, 0x91, 0xff, 0x40, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x41, 0x89, 0xc8, 0x03, 0x41, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0x41,
+        0x89, 0xc8, 0x07, 0x41, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x89, 0xc8, 0x0b, 0x41,
+        0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x41, 0x89, 0xc8, 0x0f, 0x41, 0x41, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x41, 0x55, 0x95, 0x17, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41,
+        0x89, 0xc8, 0x13, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x16, 0x41, 0x22, 0xe2, 0x17, 0x41,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x18, 0x41, 0x89, 0xc8, 0x1b, 0x41, 0x43, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x41, 0x89, 0xc8, 0x1b, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x41,
+        0x89, 0xc8, 0x1f, 0x41, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x41, 0x89, 0xc8, 0x1f, 0x41,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x20, 0x41, 0x55, 0x95, 0x27, 0x41, 0x48, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x41, 0x89, 0xc8, 0x23, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x26, 0x41,
+        0x22, 0xe2, 0x27, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x28, 0x41, 0x55, 0x95, 0x2f, 0x41,
+        0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0x28, 0x41, 0x89, 0xc8, 0x2b, 0x41, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x2c, 0x41, 0x89, 0xc8, 0x2f, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x30, 0x41,
+        0x55, 0x95, 0x37, 0x41, 0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0x89, 0xc8, 0x33, 0x41,
+        0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x36, 0x41, 0x22, 0xe2, 0x37, 0x41, 0x35, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x38, 0x41, 0x89, 0xc8, 0x3b, 0x41, 0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0x38, 0x41,
+        0x89, 0xc8, 0x3b, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x41, 0x89, 0xc8, 0x3f, 0x41,
+        0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x41, 0x89, 0xc8, 0x3f, 0x41, 0x35, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x41, 0x55, 0x95, 0x47, 0x41, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41,
+        0x89, 0xc8, 0x43, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x46, 0x41, 0x22, 0xe2, 0x47, 0x41,
+        0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x48, 0x41, 0x89, 0xc8, 0x4b, 0x41, 0x46, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x48, 0x41, 0x89, 0xc8, 0x4b, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x41,
+        0x89, 0xc8, 0x4f, 0x41, 0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x41, 0x89, 0xc8, 0x4f, 0x41,
+        0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x50, 0x41, 0x55, 0x95, 0x57, 0x41, 0x43, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x50, 0x41, 0x89, 0xc8, 0x53, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x56, 0x41,
+        0x22, 0xe2, 0x57, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41, 0x89, 0xc8, 0x5b, 0x41,
+        0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0x58, 0x41, 0x89, 0xc8, 0x5b, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x5c, 0x41, 0x89, 0xc8, 0x5f, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x41,
+        0x89, 0xc8, 0x5f, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x60, 0x41, 0x89, 0xc8, 0x63, 0x41,
+        0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0x60, 0x41, 0x89, 0xc8, 0x63, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x64, 0x41, 0x89, 0xc8, 0x67, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0x66, 0x41,
+        0x22, 0xe2, 0x67, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x68, 0x41, 0x89, 0xc8, 0x6b, 0x41,
+        0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0x68, 0x41, 0x89, 0xc8, 0x6b, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x6c, 0x41, 0x89, 0xc8, 0x6f, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x41,
+        0x89, 0xc8, 0x6f, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x55, 0x95, 0x77, 0x41,
+        0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x41, 0x89, 0xc8, 0x73, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x76, 0x41, 0x22, 0xe2, 0x77, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x78, 0x41,
+        0x89, 0xc8, 0x7b, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0x78, 0x41, 0x89, 0xc8, 0x7b, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x41, 0x89, 0xc8, 0x7f, 0x41, 0x52, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x7c, 0x41, 0x89, 0xc8, 0x7f, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x80, 0x41,
+        0x44, 0xe4, 0x81, 0x41, 0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0x80, 0x41, 0x44, 0xe4, 0x81, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x82, 0x41, 0x44, 0xe4, 0x83, 0x41, 0x52, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x83, 0x41, 0x11, 0xf1, 0x83, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x84, 0x41,
+        0x44, 0xe4, 0x85, 0x41, 0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0x84, 0x41, 0x44, 0xe4, 0x85, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x86, 0x41, 0x44, 0xe4, 0x87, 0x41, 0x52, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x86, 0x41, 0x44, 0xe4, 0x87, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x88, 0x41,
+        0xab, 0xca, 0x8b, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0x88, 0x41, 0x44, 0xe4, 0x89, 0x41,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x41, 0x11, 0xf1, 0x8b, 0x41, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x8c, 0x41, 0x44, 0xe4, 0x8d, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x41,
+        0x44, 0xe4, 0x8d, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x41, 0x44, 0xe4, 0x8f, 0x41,
+        0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x41, 0x44, 0xe4, 0x8f, 0x41, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x41, 0xab, 0xca, 0x93, 0x41, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41,
+        0x44, 0xe4, 0x91, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x93, 0x41, 0x11, 0xf1, 0x93, 0x41,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x94, 0x41, 0xab, 0xca, 0x97, 0x41, 0x46, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x94, 0x41, 0x44, 0xe4, 0x95, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x96, 0x41,
+        0x44, 0xe4, 0x97, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x98, 0x41, 0xab, 0xca, 0x9b, 0x41,
+        0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0x98, 0x41, 0x44, 0xe4, 0x99, 0x41, 0x35, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0x9b, 0x41, 0x11, 0xf1, 0x9b, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x41,
+        0x44, 0xe4, 0x9d, 0x41, 0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x41, 0x44, 0xe4, 0x9d, 0x41,
+        0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0x9e, 0x41, 0x44, 0xe4, 0x9f, 0x41, 0x45, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x9e, 0x41, 0x44, 0xe4, 0x9f, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x41,
+        0xab, 0xca, 0xa3, 0x41, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x44, 0xe4, 0xa1, 0x41,
+        0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xa3, 0x41, 0x11, 0xf1, 0xa3, 0x41, 0x35, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xa4, 0x41, 0x44, 0xe4, 0xa5, 0x41, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x41,
+        0x44, 0xe4, 0xa5, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xa6, 0x41, 0x44, 0xe4, 0xa7, 0x41,
+        0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x41, 0x44, 0xe4, 0xa7, 0x41, 0x35, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xa8, 0x41, 0xab, 0xca, 0xab, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x41,
+        0x44, 0xe4, 0xa9, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xab, 0x41, 0x11, 0xf1, 0xab, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xac, 0x41, 0x44, 0xe4, 0xad, 0x41, 0x43, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xac, 0x41, 0x44, 0xe4, 0xad, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xae, 0x41,
+        0x44, 0xe4, 0xaf, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xae, 0x41, 0x44, 0xe4, 0xaf, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x41, 0x44, 0xe4, 0xb1, 0x41, 0x51, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xb0, 0x41, 0x44, 0xe4, 0xb1, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xb2, 0x41,
+        0x44, 0xe4, 0xb3, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x41, 0x11, 0xf1, 0xb3, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x41, 0x44, 0xe4, 0xb5, 0x41, 0x51, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xb4, 0x41, 0x44, 0xe4, 0xb5, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xb6, 0x41,
+        0x44, 0xe4, 0xb7, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x41, 0x44, 0xe4, 0xb7, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x41, 0xab, 0xca, 0xbb, 0x41, 0x43, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xb8, 0x41, 0x44, 0xe4, 0xb9, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xbb, 0x41,
+        0x11, 0xf1, 0xbb, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x41, 0x44, 0xe4, 0xbd, 0x41,
+        0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x41, 0x44, 0xe4, 0xbd, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xbe, 0x41, 0x44, 0xe4, 0xbf, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x41,
+        0x44, 0xe4, 0xbf, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x44, 0xe4, 0xc1, 0x41,
+        0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x44, 0xe4, 0xc1, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xc2, 0x41, 0x44, 0xe4, 0xc3, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x41,
+        0x11, 0xf1, 0xc3, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xc4, 0x41, 0x44, 0xe4, 0xc5, 0x41,
+        0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x41, 0x44, 0xe4, 0xc5, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xc6, 0x41, 0x44, 0xe4, 0xc7, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x41,
+        0x44, 0xe4, 0xc7, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x41, 0xab, 0xca, 0xcb, 0x41,
+        0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x44, 0xe4, 0xc9, 0x41, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xcb, 0x41, 0x11, 0xf1, 0xcb, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41,
+        0x44, 0xe4, 0xcd, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x41, 0x44, 0xe4, 0xcd, 0x41,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xce, 0x41, 0x44, 0xe4, 0xcf, 0x41, 0x4a, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xce, 0x41, 0x44, 0xe4, 0xcf, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x41,
+        0xab, 0xca, 0xd3, 0x41, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x41, 0x44, 0xe4, 0xd1, 0x41,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xd3, 0x41, 0x11, 0xf1, 0xd3, 0x41, 0x33, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xd4, 0x41, 0xab, 0xca, 0xd7, 0x41, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x41,
+        0x44, 0xe4, 0xd5, 0x41, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xd6, 0x41, 0x44, 0xe4, 0xd7, 0x41,
+        0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x41, 0xab, 0xca, 0xdb, 0x41, 0x45, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xd8, 0x41, 0x44, 0xe4, 0xd9, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xdb, 0x41,
+        0x11, 0xf1, 0xdb, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xdc, 0x41, 0x44, 0xe4, 0xdd, 0x41,
+        0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x41, 0x44, 0xe4, 0xdd, 0x41, 0x35, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xde, 0x41, 0x44, 0xe4, 0xdf, 0x41, 0x45, 0x70, 0x00, 0x00, 0x00, 0x00, 0xde, 0x41,
+        0x44, 0xe4, 0xdf, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x41, 0xab, 0xca, 0xe3, 0x41,
+        0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x44, 0xe4, 0xe1, 0x41, 0x35, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xe3, 0x41, 0x11, 0xf1, 0xe3, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x41,
+        0x44, 0xe4, 0xe5, 0x41, 0x46, 0x70, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x44, 0xe4, 0xe5, 0x41,
+        0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x41, 0x44, 0xe4, 0xe7, 0x41, 0x45, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xe6, 0x41, 0x44, 0xe4, 0xe7, 0x41, 0x35, 0x70, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x41,
+        0xab, 0xca, 0xeb, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x44, 0xe4, 0xe9, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x41, 0x11, 0xf1, 0xeb, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xec, 0x41, 0x44, 0xe4, 0xed, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0xec, 0x41,
+        0x44, 0xe4, 0xed, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xee, 0x41, 0x44, 0xe4, 0xef, 0x41,
+        0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xee, 0x41, 0x44, 0xe4, 0xef, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0x41, 0x44, 0xe4, 0xf1, 0x41, 0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0x44, 0xe4, 0xf1, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x44, 0xe4, 0xf3, 0x41,
+        0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x41, 0x11, 0xf1, 0xf3, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xf4, 0x41, 0x44, 0xe4, 0xf5, 0x41, 0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x41,
+        0x44, 0xe4, 0xf5, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x41, 0x44, 0xe4, 0xf7, 0x41,
+        0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x41, 0x44, 0xe4, 0xf7, 0x41, 0x37, 0x70, 0x01, 0x00,
+        0x00, 0x00, 0xf8, 0x41, 0xab, 0xca, 0xfb, 0x41, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x41,
+        0x44, 0xe4, 0xf9, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xfb, 0x41, 0x11, 0xf1, 0xfb, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x41, 0x44, 0xe4, 0xfd, 0x41, 0x43, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xfc, 0x41, 0x44, 0xe4, 0xfd, 0x41, 0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x41,
+        0x44, 0xe4, 0xff, 0x41, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x41, 0x44, 0xe4, 0xff, 0x41,
+        0x37, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x22, 0xf2, 0x00, 0x42, 0x51, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x42, 0xef, 0xfe, 0x07, 0x42, 0x33, 0x70, 0x01, 0x00, 0x00, 0x00, 0x01, 0x42,
+        0x22, 0xf2, 0x01, 0x42, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x22, 0xf2, 0x02, 0x42,
+        0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x42, 0x22, 0xf2, 0x03, 0x42, 0x52, 0x6b, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x42, 0xef, 0xfe, 0x07, 0x42, 0x43, 0x66, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42,
+        0x89, 0x98, 0x0f, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x89, 0x98, 0x0f, 0x42,
+        0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x28, 0xbf, 0x3e, 0x2d, 0x50, 0x01, 0x00,
+        0xd6, 0x1a, 0xca, 0x3e, 0x94, 0xa1, 0x44, 0x3f, 0x31, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x3f,
+        0x7f, 0xd7, 0x94, 0x3f, 0x39, 0x50, 0x01, 0x00, 0x21, 0x94, 0x97, 0x3f, 0x35, 0x5e, 0xc7, 0x3f,
+        0x3b, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x3f, 0xeb, 0xe4, 0xf9, 0x3f, 0x3d, 0x50, 0x01, 0x00,
+        0x8c, 0xa1, 0xfc, 0x3f, 0xd0, 0x35, 0x16, 0x40, 0x3b, 0x50, 0x01, 0x00, 0x21, 0x94, 0x17, 0x40,
+        0x2b, 0x79, 0x2f, 0x40, 0x39, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0x30, 0x40, 0x86, 0xbc, 0x48, 0x40,
+        0x34, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x40, 0xe0, 0xff, 0x61, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0x31, 0x5e, 0x63, 0x40, 0x3b, 0x43, 0x7b, 0x40, 0x36, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0x7c, 0x40,
+        0x4b, 0x43, 0x8a, 0x40, 0x3d, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x8a, 0x40, 0xf8, 0xe4, 0x96, 0x40,
+        0x40, 0x50, 0x01, 0x00, 0x21, 0x94, 0x97, 0x40, 0xa6, 0x86, 0xa3, 0x40, 0x3d, 0x50, 0x01, 0x00,
+        0xce, 0x35, 0xa4, 0x40, 0x50, 0x28, 0xc8, 0x40, 0x39, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x40,
+        0x5b, 0x0d, 0xd6, 0x40, 0x2d, 0x50, 0x01, 0x00, 0x84, 0xbc, 0xd6, 0x40, 0x09, 0xaf, 0xe2, 0x40,
+        0x31, 0x50, 0x01, 0x00, 0x31, 0x5e, 0xe3, 0x40, 0xb6, 0x50, 0xef, 0x40, 0x39, 0x50, 0x01, 0x00,
+        0xde, 0xff, 0xef, 0x40, 0x64, 0xf2, 0xfb, 0x40, 0x3b, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0xfc, 0x40,
+        0x08, 0x4a, 0x04, 0x41, 0x3d, 0x50, 0x01, 0x00, 0x9d, 0xa1, 0x04, 0x41, 0xdf, 0x9a, 0x0a, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x0a, 0x41, 0xb6, 0xeb, 0x10, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x4a, 0x43, 0x11, 0x41, 0x8d, 0x3c, 0x17, 0x41, 0x34, 0x50, 0x01, 0x00, 0x21, 0x94, 0x17, 0x41,
+        0x63, 0x8d, 0x1d, 0x41, 0x32, 0x50, 0x01, 0x00, 0xf7, 0xe4, 0x1d, 0x41, 0x3a, 0xde, 0x23, 0x41,
+        0x36, 0x50, 0x01, 0x00, 0xce, 0x35, 0x24, 0x41, 0x11, 0x2f, 0x2a, 0x41, 0x3d, 0x50, 0x01, 0x00,
+        0xa5, 0x86, 0x2a, 0x41, 0xe7, 0x7f, 0x30, 0x41, 0x40, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0x30, 0x41,
+        0xbe, 0xd0, 0x36, 0x41, 0x3d, 0x50, 0x01, 0x00, 0x52, 0x28, 0x37, 0x41, 0x93, 0x21, 0x49, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x41, 0x15, 0x14, 0x6e, 0x41, 0x44, 0x50, 0x00, 0x00,
+        0xd6, 0x1a, 0x4a, 0x41, 0x19, 0x14, 0x50, 0x41, 0x2d, 0x50, 0x01, 0x00, 0xad, 0x6b, 0x50, 0x41,
+        0xef, 0x64, 0x56, 0x41, 0x31, 0x50, 0x01, 0x00, 0x84, 0xbc, 0x56, 0x41, 0xc6, 0xb5, 0x5c, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x5a, 0x0d, 0x5d, 0x41, 0x9d, 0x06, 0x63, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x31, 0x5e, 0x63, 0x41, 0x74, 0x57, 0x69, 0x41, 0x3d, 0x50, 0x01, 0x00, 0x08, 0xaf, 0x69, 0x41,
+        0x4a, 0xa8, 0x6f, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xde, 0xff, 0x6f, 0x41, 0x20, 0xf9, 0x7b, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0xde, 0xff, 0x6f, 0x41, 0x21, 0xf9, 0x75, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0xb5, 0x50, 0x76, 0x41, 0xf8, 0x49, 0x7c, 0x41, 0x34, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0x7c, 0x41,
+        0x65, 0x4d, 0x90, 0x41, 0x42, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0x7c, 0x41, 0x67, 0x4d, 0x81, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x31, 0x79, 0x81, 0x41, 0xd3, 0x75, 0x84, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0x9d, 0xa1, 0x84, 0x41, 0x3e, 0x9e, 0x87, 0x41, 0x3d, 0x50, 0x01, 0x00, 0x08, 0xca, 0x87, 0x41,
+        0xa9, 0xc6, 0x8a, 0x41, 0x40, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x8a, 0x41, 0x15, 0xef, 0x8d, 0x41,
+        0x3d, 0x50, 0x01, 0x00, 0xdf, 0x1a, 0x8e, 0x41, 0x7f, 0x17, 0x97, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x4a, 0x43, 0x91, 0x41, 0xeb, 0x3f, 0x94, 0x41, 0x40, 0x50, 0x00, 0x00, 0xb5, 0x6b, 0x94, 0x41,
+        0x57, 0x68, 0x97, 0x41, 0x42, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x41, 0xc0, 0x90, 0xa9, 0x41,
+        0x44, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x41, 0xc2, 0x90, 0x9a, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x8c, 0xbc, 0x9a, 0x41, 0x2d, 0xb9, 0x9d, 0x41, 0x31, 0x50, 0x01, 0x00, 0xf7, 0xe4, 0x9d, 0x41,
+        0x99, 0xe1, 0xa0, 0x41, 0x39, 0x50, 0x01, 0x00, 0x63, 0x0d, 0xa1, 0x41, 0x04, 0x0a, 0xa4, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0xce, 0x35, 0xa4, 0x41, 0x6f, 0x32, 0xa7, 0x41, 0x3d, 0x50, 0x01, 0x00,
+        0x39, 0x5e, 0xa7, 0x41, 0xdb, 0x5a, 0xaa, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xa5, 0x86, 0xaa, 0x41,
+        0x46, 0x83, 0xad, 0x41, 0x47, 0x50, 0x00, 0x00, 0xa5, 0x86, 0xaa, 0x41, 0x46, 0x83, 0xad, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x10, 0xaf, 0xad, 0x41, 0xb1, 0xab, 0xb3, 0x41, 0x49, 0x50, 0x00, 0x00,
+        0x10, 0xaf, 0xad, 0x41, 0xb1, 0xab, 0xb0, 0x41, 0x34, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0xb0, 0x41,
+        0x1d, 0xd4, 0xb3, 0x41, 0x32, 0x50, 0x01, 0x00, 0xe7, 0xff, 0xb3, 0x41, 0x86, 0xfc, 0xc2, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0xe7, 0xff, 0xb3, 0x41, 0x88, 0xfc, 0xb6, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0x52, 0x28, 0xb7, 0x41, 0xf3, 0x24, 0xba, 0x41, 0x3d, 0x50, 0x01, 0x00, 0xbe, 0x50, 0xba, 0x41,
+        0x5f, 0x4d, 0xbd, 0x41, 0x40, 0x50, 0x01, 0x00, 0x29, 0x79, 0xbd, 0x41, 0xca, 0x75, 0xc0, 0x41,
+        0x3d, 0x50, 0x01, 0x00, 0x94, 0xa1, 0xc0, 0x41, 0x35, 0x9e, 0xc9, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0xca, 0xc3, 0x41, 0xa1, 0xc6, 0xc6, 0x41, 0x49, 0x50, 0x00, 0x00, 0x6b, 0xf2, 0xc6, 0x41,
+        0x0c, 0xef, 0xc9, 0x41, 0x4c, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0xca, 0x41, 0x77, 0x17, 0xd3, 0x41,
+        0x4f, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0xca, 0x41, 0x78, 0x17, 0xcd, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x42, 0x43, 0xcd, 0x41, 0xe3, 0x3f, 0xd0, 0x41, 0x2f, 0x50, 0x01, 0x00, 0xad, 0x6b, 0xd0, 0x41,
+        0x4e, 0x68, 0xd3, 0x41, 0x32, 0x50, 0x01, 0x00, 0x18, 0x94, 0xd3, 0x41, 0xba, 0x90, 0xd6, 0x41,
+        0x4e, 0x50, 0x00, 0x00, 0x18, 0x94, 0xd3, 0x41, 0xba, 0x90, 0xd6, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0x84, 0xbc, 0xd6, 0x41, 0x25, 0xb9, 0xdc, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x84, 0xbc, 0xd6, 0x41,
+        0x25, 0xb9, 0xd9, 0x41, 0x39, 0x50, 0x01, 0x00, 0xef, 0xe4, 0xd9, 0x41, 0x90, 0xe1, 0xdc, 0x41,
+        0x36, 0x50, 0x01, 0x00, 0x5a, 0x0d, 0xdd, 0x41, 0xfc, 0x09, 0xe0, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x5a, 0x0d, 0xdd, 0x41, 0xfc, 0x09, 0xe0, 0x41, 0x32, 0x50, 0x01, 0x00, 0xc6, 0x35, 0xe0, 0x41,
+        0x64, 0x32, 0xfb, 0x41, 0x47, 0x50, 0x00, 0x00, 0xc6, 0x35, 0xe0, 0x41, 0x67, 0x32, 0xe3, 0x41,
+        0x2f, 0x50, 0x01, 0x00, 0x31, 0x5e, 0xe3, 0x41, 0xd2, 0x5a, 0xe6, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x9c, 0x86, 0xe6, 0x41, 0x3e, 0x83, 0xe9, 0x41, 0x2f, 0x50, 0x01, 0x00, 0x08, 0xaf, 0xe9, 0x41,
+        0xa9, 0xab, 0xec, 0x41, 0x32, 0x50, 0x01, 0x00, 0x73, 0xd7, 0xec, 0x41, 0x14, 0xd4, 0xef, 0x41,
+        0x36, 0x50, 0x01, 0x00, 0xde, 0xff, 0xef, 0x41, 0x7e, 0xfc, 0xfb, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x8c, 0xa1, 0xfc, 0x41, 0x16, 0x4f, 0x01, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0xfc, 0x41,
+        0x2d, 0x9e, 0xff, 0x41, 0x2b, 0x50, 0x01, 0x00, 0xf7, 0xc9, 0xff, 0x41, 0x4c, 0x63, 0x01, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x31, 0x79, 0x01, 0x42, 0x82, 0x77, 0x04, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x31, 0x79, 0x01, 0x42, 0x82, 0xf7, 0x02, 0x42, 0x32, 0x50, 0x01, 0x00, 0x67, 0x0d, 0x03, 0x42,
+        0xb8, 0x8b, 0x04, 0x42, 0x36, 0x50, 0x01, 0x00, 0x9d, 0xa1, 0x04, 0x42, 0xed, 0x9f, 0x07, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x9d, 0xa1, 0x04, 0x42, 0xed, 0x1f, 0x06, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0xd2, 0x35, 0x06, 0x42, 0x23, 0xb4, 0x07, 0x42, 0x36, 0x50, 0x01, 0x00, 0x08, 0xca, 0x07, 0x42,
+        0x59, 0x48, 0x09, 0x42, 0x45, 0x50, 0x00, 0x00, 0x08, 0xca, 0x07, 0x42, 0x59, 0x48, 0x09, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x3e, 0x5e, 0x09, 0x42, 0x8d, 0xdc, 0x13, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x3e, 0x5e, 0x09, 0x42, 0x8e, 0xdc, 0x0a, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x0a, 0x42,
+        0xc4, 0x70, 0x0c, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xa9, 0x86, 0x0c, 0x42, 0xfa, 0x04, 0x0e, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0xdf, 0x1a, 0x0e, 0x42, 0x2f, 0x99, 0x0f, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x14, 0xaf, 0x0f, 0x42, 0x65, 0x2d, 0x11, 0x42, 0x36, 0x50, 0x01, 0x00, 0x4a, 0x43, 0x11, 0x42,
+        0x9a, 0x41, 0x17, 0x42, 0x39, 0x50, 0x01, 0x00, 0xb5, 0x6b, 0x14, 0x42, 0x06, 0x6a, 0x17, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x21, 0x94, 0x17, 0x42, 0x6f, 0x92, 0x29, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x21, 0x94, 0x17, 0x42, 0x71, 0x12, 0x19, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x56, 0x28, 0x19, 0x42,
+        0xa7, 0xa6, 0x1a, 0x42, 0x31, 0x50, 0x01, 0x00, 0x8c, 0xbc, 0x1a, 0x42, 0xdd, 0x3a, 0x1c, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xc2, 0x50, 0x1c, 0x42, 0x12, 0xcf, 0x1d, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xf7, 0xe4, 0x1d, 0x42, 0x48, 0x63, 0x1f, 0x42, 0x3d, 0x50, 0x01, 0x00, 0x2d, 0x79, 0x1f, 0x42,
+        0x7e, 0xf7, 0x20, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x63, 0x0d, 0x21, 0x42, 0xb3, 0x8b, 0x22, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x98, 0xa1, 0x22, 0x42, 0xe9, 0x1f, 0x24, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0xce, 0x35, 0x24, 0x42, 0x1f, 0xb4, 0x25, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x04, 0xca, 0x25, 0x42,
+        0x54, 0x48, 0x27, 0x42, 0x31, 0x50, 0x01, 0x00, 0x39, 0x5e, 0x27, 0x42, 0x8a, 0xdc, 0x28, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x6f, 0xf2, 0x28, 0x42, 0xc0, 0x70, 0x2a, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xa5, 0x86, 0x2a, 0x42, 0xf5, 0x04, 0x2c, 0x42, 0x3d, 0x50, 0x00, 0x00, 0xda, 0x1a, 0x2c, 0x42,
+        0x2b, 0x99, 0x2d, 0x42, 0x40, 0x50, 0x00, 0x00, 0x10, 0xaf, 0x2d, 0x42, 0x61, 0x2d, 0x2f, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x46, 0x43, 0x2f, 0x42, 0x96, 0xc1, 0x36, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x52, 0x28, 0x37, 0x42, 0xa2, 0xa6, 0x3b, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x52, 0x28, 0x37, 0x42,
+        0xa3, 0xa6, 0x38, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x88, 0xbc, 0x38, 0x42, 0xd8, 0x3a, 0x3a, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xbe, 0x50, 0x3a, 0x42, 0x0e, 0xcf, 0x3b, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0xf3, 0xe4, 0x3b, 0x42, 0x44, 0x63, 0x3d, 0x42, 0x49, 0x50, 0x00, 0x00, 0xf3, 0xe4, 0x3b, 0x42,
+        0x44, 0x63, 0x3d, 0x42, 0x39, 0x50, 0x01, 0x00, 0x29, 0x79, 0x3d, 0x42, 0x79, 0x77, 0x40, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x29, 0x79, 0x3d, 0x42, 0x79, 0x77, 0x43, 0x42, 0x3d, 0x50, 0x01, 0x00,
+        0x94, 0xa1, 0x40, 0x42, 0xe5, 0x1f, 0x42, 0x42, 0x40, 0x50, 0x00, 0x00, 0x94, 0xa1, 0x40, 0x42,
+        0xe5, 0x1f, 0x42, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xca, 0x35, 0x42, 0x42, 0x1a, 0x34, 0x45, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0xca, 0x35, 0x42, 0x42, 0x1a, 0x34, 0x45, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x00, 0xca, 0x43, 0x42, 0x50, 0x48, 0x45, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x35, 0x5e, 0x45, 0x42,
+        0x85, 0xdc, 0x4c, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x35, 0x5e, 0x45, 0x42, 0x86, 0xdc, 0x46, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x6b, 0xf2, 0x46, 0x42, 0xbc, 0x70, 0x48, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0xa1, 0x86, 0x48, 0x42, 0xf1, 0x04, 0x4a, 0x42, 0x39, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x42,
+        0x26, 0x19, 0x50, 0x42, 0x3d, 0x50, 0x01, 0x00, 0x42, 0x43, 0x4d, 0x42, 0x92, 0xc1, 0x4e, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x77, 0xd7, 0x4e, 0x42, 0xc8, 0x55, 0x50, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0xad, 0x6b, 0x50, 0x42, 0xfd, 0x69, 0x53, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xad, 0x6b, 0x50, 0x42,
+        0xfe, 0xe9, 0x51, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xe3, 0xff, 0x51, 0x42, 0x33, 0x7e, 0x53, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x18, 0x94, 0x53, 0x42, 0x69, 0x12, 0x55, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x18, 0x94, 0x53, 0x42, 0x69, 0x12, 0x55, 0x42, 0x32, 0x50, 0x01, 0x00, 0x4e, 0x28, 0x55, 0x42,
+        0x9e, 0x26, 0x58, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x4e, 0x28, 0x55, 0x42, 0x9f, 0xa6, 0x56, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x84, 0xbc, 0x56, 0x42, 0xd4, 0xba, 0x5c, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0xb9, 0x50, 0x58, 0x42, 0x0a, 0xcf, 0x5c, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x5a, 0x0d, 0x5d, 0x42,
+        0xaa, 0x0b, 0x66, 0x42, 0x49, 0x50, 0x00, 0x00, 0x5a, 0x0d, 0x5d, 0x42, 0xaa, 0x0b, 0x69, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x5a, 0x0d, 0x5d, 0x42, 0xaa, 0x0b, 0x69, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x9c, 0x86, 0x66, 0x42, 0xed, 0x04, 0x68, 0x42, 0x3b, 0x50, 0x00, 0x00, 0xd2, 0x1a, 0x68, 0x42,
+        0x23, 0x99, 0x69, 0x42, 0x39, 0x50, 0x00, 0x00, 0x08, 0xaf, 0x69, 0x42, 0xab, 0xd6, 0x80, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x08, 0xaf, 0x69, 0x42, 0x58, 0x2d, 0x6b, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0x3d, 0x43, 0x6b, 0x42, 0x8e, 0xc1, 0x6c, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x73, 0xd7, 0x6c, 0x42,
+        0xc4, 0x55, 0x6e, 0x42, 0x2f, 0x50, 0x01, 0x00, 0xa9, 0x6b, 0x6e, 0x42, 0xf9, 0xe9, 0x6f, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0xde, 0xff, 0x6f, 0x42, 0x2f, 0x7e, 0x71, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0x14, 0x94, 0x71, 0x42, 0x65, 0x12, 0x73, 0x42, 0x34, 0x50, 0x01, 0x00, 0x4a, 0x28, 0x73, 0x42,
+        0x9a, 0xa6, 0x74, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x7f, 0xbc, 0x74, 0x42, 0xd0, 0x3a, 0x76, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0xb5, 0x50, 0x76, 0x42, 0x06, 0xcf, 0x77, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0xeb, 0xe4, 0x77, 0x42, 0x3b, 0x63, 0x79, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x20, 0x79, 0x79, 0x42,
+        0x71, 0xf7, 0x7a, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x56, 0x0d, 0x7b, 0x42, 0xa7, 0x8b, 0x7c, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0x7c, 0x42, 0xdc, 0x1f, 0x7e, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0xc2, 0x35, 0x7e, 0x42, 0x12, 0xb4, 0x7f, 0x42, 0x34, 0x50, 0x01, 0x00, 0xf7, 0xc9, 0x7f, 0x42,
+        0x24, 0x64, 0x81, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x31, 0x79, 0x81, 0x42, 0x5a, 0x38, 0x82, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x31, 0x79, 0x81, 0x42, 0x5a, 0x38, 0x82, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x4c, 0x43, 0x82, 0x42, 0x74, 0x02, 0x83, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x4c, 0x43, 0x82, 0x42,
+        0x74, 0x02, 0x83, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x67, 0x0d, 0x83, 0x42, 0x8f, 0xcc, 0x83, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x67, 0x0d, 0x83, 0x42, 0x8f, 0xcc, 0x83, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x82, 0xd7, 0x83, 0x42, 0xaa, 0x96, 0x84, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x82, 0xd7, 0x83, 0x42,
+        0xaa, 0x96, 0x84, 0x42, 0x36, 0x50, 0x01, 0x00, 0x9d, 0xa1, 0x84, 0x42, 0xc5, 0x60, 0x85, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x9d, 0xa1, 0x84, 0x42, 0xc5, 0x60, 0x85, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0xb7, 0x6b, 0x85, 0x42, 0xe0, 0x2a, 0x86, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xb7, 0x6b, 0x85, 0x42,
+        0xe0, 0x2a, 0x86, 0x42, 0x36, 0x50, 0x01, 0x00, 0xd2, 0x35, 0x86, 0x42, 0xfb, 0xf4, 0x86, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xd2, 0x35, 0x86, 0x42, 0xfb, 0xf4, 0x86, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xed, 0xff, 0x86, 0x42, 0x15, 0x7f, 0x88, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xed, 0xff, 0x86, 0x42,
+        0x15, 0xbf, 0x87, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x08, 0xca, 0x87, 0x42, 0x30, 0x89, 0x88, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x23, 0x94, 0x88, 0x42, 0x4b, 0xd3, 0x8a, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x23, 0x94, 0x88, 0x42, 0x4b, 0x53, 0x89, 0x42, 0x31, 0x50, 0x01, 0x00, 0x3e, 0x5e, 0x89, 0x42,
+        0x66, 0x1d, 0x8a, 0x42, 0x34, 0x50, 0x01, 0x00, 0x58, 0x28, 0x8a, 0x42, 0x81, 0xe7, 0x8a, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x8a, 0x42, 0x9b, 0xf1, 0x8d, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x73, 0xf2, 0x8a, 0x42, 0x9c, 0xb1, 0x8b, 0x42, 0x3d, 0x50, 0x01, 0x00, 0x8e, 0xbc, 0x8b, 0x42,
+        0xb6, 0x7b, 0x8c, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xa9, 0x86, 0x8c, 0x42, 0xd1, 0x45, 0x8d, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xc4, 0x50, 0x8d, 0x42, 0xec, 0x0f, 0x8e, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0xdf, 0x1a, 0x8e, 0x42, 0x07, 0xda, 0x8e, 0x42, 0x50, 0x50, 0x00, 0x00, 0xdf, 0x1a, 0x8e, 0x42,
+        0x07, 0xda, 0x8e, 0x42, 0x28, 0x50, 0x01, 0x00, 0xf9, 0xe4, 0x8e, 0x42, 0x22, 0xa4, 0x8f, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xf9, 0xe4, 0x8e, 0x42, 0x22, 0xa4, 0x8f, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x14, 0xaf, 0x8f, 0x42, 0x3d, 0x6e, 0x90, 0x42, 0x47, 0x50, 0x00, 0x00, 0x14, 0xaf, 0x8f, 0x42,
+        0x3d, 0x6e, 0x90, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x2f, 0x79, 0x90, 0x42, 0x57, 0x38, 0x91, 0x42,
+        0x44, 0x50, 0x00, 0x00, 0x2f, 0x79, 0x90, 0x42, 0x57, 0x38, 0x91, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x4a, 0x43, 0x91, 0x42, 0x72, 0x42, 0x94, 0x42, 0x40, 0x50, 0x00, 0x00, 0x4a, 0x43, 0x91, 0x42,
+        0x72, 0x42, 0x94, 0x42, 0x38, 0x50, 0x01, 0x00, 0xb5, 0x6b, 0x94, 0x42, 0xde, 0x2a, 0x95, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xb5, 0x6b, 0x94, 0x42, 0xde, 0x2a, 0x95, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0xd0, 0x35, 0x95, 0x42, 0xf9, 0xf4, 0x95, 0x42, 0x47, 0x50, 0x00, 0x00, 0xd0, 0x35, 0x95, 0x42,
+        0xf9, 0xf4, 0x95, 0x42, 0x2c, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x95, 0x42, 0x13, 0xbf, 0x96, 0x42,
+        0x44, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x95, 0x42, 0x13, 0xbf, 0x96, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0x06, 0xca, 0x96, 0x42, 0x2e, 0x89, 0x97, 0x42, 0x40, 0x50, 0x00, 0x00, 0x06, 0xca, 0x96, 0x42,
+        0x2e, 0x89, 0x97, 0x42, 0x34, 0x50, 0x01, 0x00, 0x21, 0x94, 0x97, 0x42, 0x49, 0x93, 0x9a, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x42, 0x49, 0x93, 0x9a, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0x8c, 0xbc, 0x9a, 0x42, 0xb4, 0x7b, 0x9b, 0x42, 0x28, 0x50, 0x01, 0x00, 0xa7, 0x86, 0x9b, 0x42,
+        0xcf, 0x45, 0x9c, 0x42, 0x2c, 0x50, 0x01, 0x00, 0xc2, 0x50, 0x9c, 0x42, 0xea, 0x0f, 0x9d, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0xdd, 0x1a, 0x9d, 0x42, 0x05, 0xda, 0x9d, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0xf7, 0xe4, 0x9d, 0x42, 0x1f, 0xe4, 0xa0, 0x42, 0x34, 0x50, 0x01, 0x00, 0x63, 0x0d, 0xa1, 0x42,
+        0x8b, 0xcc, 0xa1, 0x42, 0x28, 0x50, 0x01, 0x00, 0x7e, 0xd7, 0xa1, 0x42, 0xa6, 0x96, 0xa2, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0x98, 0xa1, 0xa2, 0x42, 0xc1, 0x60, 0xa3, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0xb3, 0x6b, 0xa3, 0x42, 0xdc, 0x2a, 0xa4, 0x42, 0x34, 0x50, 0x01, 0x00, 0xce, 0x35, 0xa4, 0x42,
+        0xf5, 0x34, 0xad, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x79, 0xb6, 0x3f,
+        0x34, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xaa, 0x36, 0x40, 0x37, 0x31, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xe4, 0x79, 0xb6, 0x3f, 0x28, 0x31, 0x01, 0x00, 0x6a, 0xdb, 0xb6, 0x3f,
+        0xa7, 0xaa, 0x36, 0x40, 0x2a, 0x31, 0x01, 0x00, 0x6a, 0xdb, 0x36, 0x40, 0x2e, 0x0c, 0x89, 0x40,
+        0x39, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x40, 0x09, 0xc3, 0xb6, 0x40, 0x3e, 0x31, 0x00, 0x00,
+        0x6a, 0xdb, 0x36, 0x40, 0x2e, 0x0c, 0x89, 0x40, 0x2b, 0x31, 0x01, 0x00, 0x90, 0x24, 0x89, 0x40,
+        0x09, 0xc3, 0xb6, 0x40, 0x2f, 0x31, 0x01, 0x00, 0x6a, 0xdb, 0xb6, 0x40, 0xe3, 0x79, 0xe4, 0x40,
+        0x36, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x40, 0x5f, 0x18, 0x09, 0x41, 0x39, 0x31, 0x00, 0x00,
+        0x6a, 0xdb, 0xb6, 0x40, 0xe3, 0x79, 0xe4, 0x40, 0x2d, 0x31, 0x01, 0x00, 0x45, 0x92, 0xe4, 0x40,
+        0x5f, 0x18, 0x09, 0x41, 0x2b, 0x31, 0x01, 0x00, 0x90, 0x24, 0x09, 0x41, 0xcc, 0xf3, 0x1f, 0x41,
+        0x39, 0x31, 0x00, 0x00, 0x90, 0x24, 0x09, 0x41, 0x39, 0xcf, 0x36, 0x41, 0x3d, 0x31, 0x00, 0x00,
+        0x90, 0x24, 0x09, 0x41, 0x39, 0xcf, 0x36, 0x41, 0x26, 0x31, 0x01, 0x00, 0x6a, 0xdb, 0x36, 0x41,
+        0xa7, 0xaa, 0x4d, 0x41, 0x34, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x41, 0xa7, 0xaa, 0x4d, 0x41,
+        0x37, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x41, 0x14, 0x86, 0x64, 0x41, 0x3b, 0x31, 0x00, 0x00,
+        0x6a, 0xdb, 0x36, 0x41, 0xa7, 0xaa, 0x4d, 0x41, 0x28, 0x31, 0x01, 0x00, 0xd7, 0xb6, 0x4d, 0x41,
+        0x14, 0x86, 0x64, 0x41, 0x2a, 0x31, 0x01, 0x00, 0x45, 0x92, 0x64, 0x41, 0x81, 0x61, 0x7b, 0x41,
+        0x39, 0x31, 0x00, 0x00, 0x45, 0x92, 0x64, 0x41, 0x81, 0x61, 0x7b, 0x41, 0x3e, 0x31, 0x00, 0x00,
+        0x45, 0x92, 0x64, 0x41, 0x77, 0x1e, 0x89, 0x41, 0x42, 0x31, 0x00, 0x00, 0x45, 0x92, 0x64, 0x41,
+        0x81, 0x61, 0x7b, 0x41, 0x2b, 0x31, 0x01, 0x00, 0xb2, 0x6d, 0x7b, 0x41, 0x77, 0x1e, 0x89, 0x41,
+        0x2f, 0x31, 0x01, 0x00, 0x90, 0x24, 0x89, 0x41, 0x2e, 0x8c, 0x94, 0x41, 0x36, 0x31, 0x00, 0x00,
+        0x90, 0x24, 0x89, 0x41, 0x2e, 0x8c, 0x94, 0x41, 0x39, 0x31, 0x00, 0x00, 0x90, 0x24, 0x89, 0x41,
+        0xe4, 0xf9, 0x9f, 0x41, 0x3d, 0x31, 0x00, 0x00, 0x90, 0x24, 0x89, 0x41, 0x2e, 0x8c, 0x94, 0x41,
+        0x2d, 0x31, 0x01, 0x00, 0x46, 0x92, 0x94, 0x41, 0xe4, 0xf9, 0x9f, 0x41, 0x2b, 0x31, 0x01, 0x00,
+        0xfd, 0xff, 0x9f, 0x41, 0x9b, 0x67, 0xab, 0x41, 0x39, 0x31, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x41,
+        0x9b, 0x67, 0xab, 0x41, 0x3d, 0x31, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x41, 0x52, 0xd5, 0xb6, 0x41,
+        0x40, 0x31, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x41, 0x52, 0xd5, 0xb6, 0x41, 0x26, 0x31, 0x01, 0x00,
+        0x6a, 0xdb, 0xb6, 0x41, 0x08, 0x43, 0xc2, 0x41, 0x34, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x41,
+        0x08, 0x43, 0xc2, 0x41, 0x37, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x41, 0xbf, 0xb0, 0xcd, 0x41,
+        0x3b, 0x31, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x41, 0x08, 0x43, 0xc2, 0x41, 0x28, 0x31, 0x01, 0x00,
+        0x21, 0x49, 0xc2, 0x41, 0xbf, 0xb0, 0xcd, 0x41, 0x2a, 0x31, 0x01, 0x00, 0xd7, 0xb6, 0xcd, 0x41,
+        0x76, 0x1e, 0xd9, 0x41, 0x39, 0x31, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x41, 0x76, 0x1e, 0xd9, 0x41,
+        0x3e, 0x31, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x41, 0x2c, 0x8c, 0xe4, 0x41, 0x42, 0x31, 0x00, 0x00,
+        0xd7, 0xb6, 0xcd, 0x41, 0x76, 0x1e, 0xd9, 0x41, 0x2b, 0x31, 0x01, 0x00, 0x8e, 0x24, 0xd9, 0x41,
+        0x2c, 0x8c, 0xe4, 0x41, 0x2f, 0x31, 0x01, 0x00, 0x45, 0x92, 0xe4, 0x41, 0xe3, 0xf9, 0xef, 0x41,
+        0x36, 0x31, 0x00, 0x00, 0x45, 0x92, 0xe4, 0x41, 0xe3, 0xf9, 0xef, 0x41, 0x39, 0x31, 0x00, 0x00,
+        0x45, 0x92, 0xe4, 0x41, 0x9a, 0x67, 0xfb, 0x41, 0x3d, 0x31, 0x00, 0x00, 0x45, 0x92, 0xe4, 0x41,
+        0xe3, 0xf9, 0xef, 0x41, 0x2d, 0x31, 0x01, 0x00, 0xfb, 0xff, 0xef, 0x41, 0x9a, 0x67, 0xfb, 0x41,
+        0x2b, 0x31, 0x01, 0x00, 0xb2, 0x6d, 0xfb, 0x41, 0xa8, 0x6a, 0x03, 0x42, 0x39, 0x31, 0x00, 0x00,
+        0xb2, 0x6d, 0xfb, 0x41, 0xa8, 0x6a, 0x03, 0x42, 0x3d, 0x31, 0x00, 0x00, 0xb2, 0x6d, 0xfb, 0x41,
+        0x83, 0x21, 0x09, 0x42, 0x40, 0x31, 0x00, 0x00, 0xb2, 0x6d, 0xfb, 0x41, 0x83, 0x21, 0x09, 0x42,
+        0x26, 0x31, 0x01, 0x00, 0x90, 0x24, 0x09, 0x42, 0x5f, 0xd8, 0x0e, 0x42, 0x34, 0x50, 0x00, 0x00,
+        0x90, 0x24, 0x09, 0x42, 0x5f, 0xd8, 0x0e, 0x42, 0x37, 0x50, 0x00, 0x00, 0x90, 0x24, 0x09, 0x42,
+        0x5f, 0xd8, 0x0e, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x90, 0x24, 0x09, 0x42, 0x5f, 0xd8, 0x0e, 0x42,
+        0x28, 0x50, 0x01, 0x00, 0x6b, 0xdb, 0x0e, 0x42, 0xcc, 0xb3, 0x11, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x6b, 0xdb, 0x0e, 0x42, 0x3a, 0x8f, 0x14, 0x42, 0x2a, 0x50, 0x01, 0x00, 0xd9, 0xb6, 0x11, 0x42,
+        0x3a, 0x8f, 0x14, 0x42, 0x47, 0x50, 0x00, 0x00, 0x46, 0x92, 0x14, 0x42, 0x83, 0x21, 0x1d, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x46, 0x92, 0x14, 0x42, 0x83, 0x21, 0x1d, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x46, 0x92, 0x14, 0x42, 0x83, 0x21, 0x1d, 0x42, 0x42, 0x50, 0x00, 0x00, 0x46, 0x92, 0x14, 0x42,
+        0x15, 0x46, 0x1a, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x22, 0x49, 0x1a, 0x42, 0x83, 0x21, 0x1d, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x8f, 0x24, 0x1d, 0x42, 0x3a, 0x8f, 0x1e, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x46, 0x92, 0x1e, 0x42, 0xf1, 0xfc, 0x1f, 0x42, 0x40, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x1f, 0x42,
+        0xcc, 0xb3, 0x25, 0x42, 0x36, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x1f, 0x42, 0x3a, 0x8f, 0x28, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x1f, 0x42, 0x3a, 0x8f, 0x28, 0x42, 0x3d, 0x50, 0x00, 0x00,
+        0xfd, 0xff, 0x1f, 0x42, 0xcc, 0xb3, 0x25, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xd8, 0xb6, 0x25, 0x42,
+        0xa7, 0x6a, 0x2b, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x46, 0x92, 0x28, 0x42, 0xf0, 0xfc, 0x29, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x29, 0x42, 0xa7, 0x6a, 0x2b, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xb3, 0x6d, 0x2b, 0x42, 0x5e, 0xd8, 0x36, 0x42, 0x39, 0x50, 0x00, 0x00, 0xb3, 0x6d, 0x2b, 0x42,
+        0x5e, 0xd8, 0x36, 0x42, 0x3d, 0x50, 0x00, 0x00, 0xb3, 0x6d, 0x2b, 0x42, 0x5e, 0xd8, 0x36, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0xb3, 0x6d, 0x2b, 0x42, 0x5e, 0xd8, 0x36, 0x42, 0x26, 0x50, 0x01, 0x00,
+        0x6a, 0xdb, 0x36, 0x42, 0xcc, 0xb3, 0x39, 0x42, 0x34, 0x50, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x42,
+        0xcc, 0xb3, 0x39, 0x42, 0x37, 0x50, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x42, 0xcc, 0xb3, 0x39, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x6a, 0xdb, 0x36, 0x42, 0x39, 0x8f, 0x3c, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0xd8, 0xb6, 0x39, 0x42, 0x39, 0x8f, 0x3c, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x45, 0x92, 0x3c, 0x42,
+        0xa7, 0x6a, 0x3f, 0x42, 0x47, 0x50, 0x00, 0x00, 0x45, 0x92, 0x3c, 0x42, 0x15, 0x46, 0x42, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0xb3, 0x6d, 0x3f, 0x42, 0x15, 0x46, 0x42, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x21, 0x49, 0x42, 0x42, 0x5e, 0xd8, 0x4a, 0x42, 0x39, 0x50, 0x00, 0x00, 0x21, 0x49, 0x42, 0x42,
+        0x5e, 0xd8, 0x4a, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x21, 0x49, 0x42, 0x42, 0x5e, 0xd8, 0x4a, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x21, 0x49, 0x42, 0x42, 0xf0, 0xfc, 0x47, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0xfc, 0xff, 0x47, 0x42, 0x5e, 0xd8, 0x4a, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x6a, 0xdb, 0x4a, 0x42,
+        0x14, 0x46, 0x4c, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x21, 0x49, 0x4c, 0x42, 0xcb, 0xb3, 0x4d, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x4d, 0x42, 0xa7, 0x6a, 0x53, 0x42, 0x36, 0x50, 0x00, 0x00,
+        0xd7, 0xb6, 0x4d, 0x42, 0x14, 0x46, 0x56, 0x42, 0x39, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x4d, 0x42,
+        0x14, 0x46, 0x56, 0x42, 0x3d, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x4d, 0x42, 0xa7, 0x6a, 0x53, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0xb3, 0x6d, 0x53, 0x42, 0x82, 0x21, 0x59, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x20, 0x49, 0x56, 0x42, 0xcb, 0xb3, 0x57, 0x42, 0x45, 0x50, 0x00, 0x00, 0xd7, 0xb6, 0x57, 0x42,
+        0x82, 0x21, 0x59, 0x42, 0x42, 0x50, 0x00, 0x00, 0x8e, 0x24, 0x59, 0x42, 0x38, 0x8f, 0x64, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x8e, 0x24, 0x59, 0x42, 0x38, 0x8f, 0x64, 0x42, 0x3d, 0x50, 0x00, 0x00,
+        0x8e, 0x24, 0x59, 0x42, 0x38, 0x8f, 0x64, 0x42, 0x40, 0x50, 0x00, 0x00, 0x8e, 0x24, 0x59, 0x42,
+        0x38, 0x8f, 0x64, 0x42, 0x26, 0x50, 0x01, 0x00, 0x45, 0x92, 0x64, 0x42, 0x14, 0x46, 0x6a, 0x42,
+        0x34, 0x50, 0x00, 0x00, 0x45, 0x92, 0x64, 0x42, 0x14, 0x46, 0x6a, 0x42, 0x37, 0x50, 0x00, 0x00,
+        0x45, 0x92, 0x64, 0x42, 0x14, 0x46, 0x6a, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x45, 0x92, 0x64, 0x42,
+        0x14, 0x46, 0x6a, 0x42, 0x28, 0x50, 0x01, 0x00, 0x20, 0x49, 0x6a, 0x42, 0x81, 0x21, 0x6d, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x20, 0x49, 0x6a, 0x42, 0xef, 0xfc, 0x6f, 0x42, 0x2a, 0x50, 0x01, 0x00,
+        0x8e, 0x24, 0x6d, 0x42, 0xef, 0xfc, 0x6f, 0x42, 0x47, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x6f, 0x42,
+        0xca, 0xb3, 0x75, 0x42, 0x3e, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x6f, 0x42, 0xca, 0xb3, 0x75, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x6f, 0x42, 0x38, 0x8f, 0x78, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xfb, 0xff, 0x6f, 0x42, 0xca, 0xb3, 0x75, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xfb, 0xff, 0x6f, 0x42,
+        0xca, 0xb3, 0x75, 0x42, 0x39, 0x50, 0x01, 0x00, 0xd7, 0xb6, 0x75, 0x42, 0x38, 0x8f, 0x78, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x44, 0x92, 0x78, 0x42, 0xef, 0xfc, 0x79, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x44, 0x92, 0x78, 0x42, 0xef, 0xfc, 0x79, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x79, 0x42,
+        0xa6, 0x6a, 0x7b, 0x42, 0x40, 0x50, 0x00, 0x00, 0xfb, 0xff, 0x79, 0x42, 0xa6, 0x6a, 0x7b, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xb2, 0x6d, 0x7b, 0x42, 0x77, 0xfe, 0x81, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0xb2, 0x6d, 0x7b, 0x42, 0x77, 0xfe, 0x81, 0x42, 0x49, 0x50, 0x00, 0x00, 0xb2, 0x6d, 0x7b, 0x42,
+        0xc1, 0x90, 0x80, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xb2, 0x6d, 0x7b, 0x42, 0xc1, 0x90, 0x80, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0xb2, 0x6d, 0x7b, 0x42, 0xc1, 0x90, 0x80, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x47, 0x92, 0x80, 0x42, 0x2e, 0x6c, 0x83, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xfd, 0xff, 0x81, 0x42,
+        0x53, 0xb5, 0x82, 0x42, 0x42, 0x50, 0x00, 0x00, 0xfd, 0xff, 0x81, 0x42, 0x53, 0xb5, 0x82, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xd9, 0xb6, 0x82, 0x42, 0x2e, 0x6c, 0x83, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42, 0x39, 0x50, 0x00, 0x00, 0xb4, 0x6d, 0x83, 0x42,
+        0x09, 0x23, 0x89, 0x42, 0x3d, 0x50, 0x00, 0x00, 0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xb4, 0x6d, 0x83, 0x42, 0x09, 0x23, 0x89, 0x42, 0x26, 0x50, 0x01, 0x00, 0x90, 0x24, 0x89, 0x42,
+        0x77, 0xfe, 0x8b, 0x42, 0x34, 0x50, 0x00, 0x00, 0x90, 0x24, 0x89, 0x42, 0x77, 0xfe, 0x8b, 0x42,
+        0x37, 0x50, 0x00, 0x00, 0x90, 0x24, 0x89, 0x42, 0x77, 0xfe, 0x8b, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x90, 0x24, 0x89, 0x42, 0x77, 0xfe, 0x8b, 0x42, 0x28, 0x50, 0x01, 0x00, 0xfd, 0xff, 0x8b, 0x42,
+        0x2e, 0x6c, 0x8d, 0x42, 0x47, 0x60, 0x00, 0x00, 0xfd, 0xff, 0x8b, 0x42, 0xe5, 0xd9, 0x8e, 0x42,
+        0x2a, 0x60, 0x01, 0x00, 0xb4, 0x6d, 0x8d, 0x42, 0xe5, 0xd9, 0x8e, 0x42, 0x45, 0x60, 0x00, 0x00,
+        0x6b, 0xdb, 0x8e, 0x42, 0x09, 0x23, 0x93, 0x42, 0x39, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0x8e, 0x42,
+        0x09, 0x23, 0x93, 0x42, 0x3e, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0x8e, 0x42, 0x09, 0x23, 0x93, 0x42,
+        0x42, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0x8e, 0x42, 0x52, 0xb5, 0x91, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0xd9, 0xb6, 0x91, 0x42, 0x09, 0x23, 0x93, 0x42, 0x2f, 0x60, 0x01, 0x00, 0x8f, 0x24, 0x93, 0x42,
+        0xe5, 0xd9, 0x93, 0x42, 0x3e, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0x93, 0x42, 0xc0, 0x90, 0x94, 0x42,
+        0x40, 0x60, 0x00, 0x00, 0x46, 0x92, 0x94, 0x42, 0x2e, 0x6c, 0x97, 0x42, 0x36, 0x60, 0x00, 0x00,
+        0x46, 0x92, 0x94, 0x42, 0xe5, 0xd9, 0x98, 0x42, 0x39, 0x60, 0x00, 0x00, 0x46, 0x92, 0x94, 0x42,
+        0xe5, 0xd9, 0x98, 0x42, 0x3d, 0x60, 0x00, 0x00, 0x46, 0x92, 0x94, 0x42, 0x2e, 0x6c, 0x97, 0x42,
+        0x2d, 0x60, 0x01, 0x00, 0xb4, 0x6d, 0x97, 0x42, 0x9b, 0x47, 0x9a, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x6b, 0xdb, 0x98, 0x42, 0xc0, 0x90, 0x99, 0x42, 0x42, 0x60, 0x00, 0x00, 0x46, 0x92, 0x99, 0x42,
+        0x9b, 0x47, 0x9a, 0x42, 0x45, 0x60, 0x00, 0x00, 0x22, 0x49, 0x9a, 0x42, 0x77, 0xfe, 0x9f, 0x42,
+        0x39, 0x60, 0x00, 0x00, 0x22, 0x49, 0x9a, 0x42, 0x77, 0xfe, 0x9f, 0x42, 0x3d, 0x60, 0x00, 0x00,
+        0x22, 0x49, 0x9a, 0x42, 0x77, 0xfe, 0x9f, 0x42, 0x40, 0x60, 0x00, 0x00, 0x22, 0x49, 0x9a, 0x42,
+        0x77, 0xfe, 0x9f, 0x42, 0x26, 0x60, 0x01, 0x00, 0xfd, 0xff, 0x9f, 0x42, 0xe4, 0xd9, 0xa2, 0x42,
+        0x34, 0x60, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x42, 0xe4, 0xd9, 0xa2, 0x42, 0x37, 0x60, 0x00, 0x00,
+        0xfd, 0xff, 0x9f, 0x42, 0xe4, 0xd9, 0xa2, 0x42, 0x3b, 0x60, 0x00, 0x00, 0xfd, 0xff, 0x9f, 0x42,
+        0xe4, 0xd9, 0xa2, 0x42, 0x28, 0x60, 0x01, 0x00, 0x6b, 0xdb, 0xa2, 0x42, 0x9b, 0x47, 0xa4, 0x42,
+        0x45, 0x60, 0x00, 0x00, 0x6b, 0xdb, 0xa2, 0x42, 0x52, 0xb5, 0xa5, 0x42, 0x2a, 0x60, 0x01, 0x00,
+        0x21, 0x49, 0xa4, 0x42, 0x52, 0xb5, 0xa5, 0x42, 0x47, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xa5, 0x42,
+        0x77, 0xfe, 0xa9, 0x42, 0x39, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xa5, 0x42, 0x77, 0xfe, 0xa9, 0x42,
+        0x3e, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xa5, 0x42, 0x77, 0xfe, 0xa9, 0x42, 0x42, 0x60, 0x00, 0x00,
+        0xd8, 0xb6, 0xa5, 0x42, 0xc0, 0x90, 0xa8, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x46, 0x92, 0xa8, 0x42,
+        0x77, 0xfe, 0xa9, 0x42, 0x2f, 0x60, 0x01, 0x00, 0xfd, 0xff, 0xa9, 0x42, 0x52, 0xb5, 0xaa, 0x42,
+        0x3e, 0x60, 0x00, 0x00, 0xd8, 0xb6, 0xaa, 0x42, 0x2d, 0x6c, 0xab, 0x42, 0x40, 0x60, 0x00, 0x00,
+        0xb3, 0x6d, 0xab, 0x42, 0x9b, 0x47, 0xae, 0x42, 0x36, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xab, 0x42,
+        0x52, 0xb5, 0xaf, 0x42, 0x39, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xab, 0x42, 0x52, 0xb5, 0xaf, 0x42,
+        0x3d, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xab, 0x42, 0x9b, 0x47, 0xae, 0x42, 0x2d, 0x60, 0x01, 0x00,
+        0x21, 0x49, 0xae, 0x42, 0x52, 0xb5, 0xaf, 0x42, 0x4e, 0x60, 0x00, 0x00, 0x21, 0x49, 0xae, 0x42,
+        0x09, 0x23, 0xb1, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xd8, 0xb6, 0xaf, 0x42, 0x2d, 0x6c, 0xb0, 0x42,
+        0x42, 0x60, 0x00, 0x00, 0xb3, 0x6d, 0xb0, 0x42, 0x09, 0x23, 0xb1, 0x42, 0x45, 0x60, 0x00, 0x00,
+        0x8f, 0x24, 0xb1, 0x42, 0xe4, 0xd9, 0xb6, 0x42, 0x39, 0x60, 0x00, 0x00, 0x8f, 0x24, 0xb1, 0x42,
+        0xe4, 0xd9, 0xb6, 0x42, 0x3d, 0x60, 0x00, 0x00, 0x8f, 0x24, 0xb1, 0x42, 0xe4, 0xd9, 0xb6, 0x42,
+        0x40, 0x60, 0x00, 0x00, 0x8f, 0x24, 0xb1, 0x42, 0xe4, 0xd9, 0xb6, 0x42, 0x26, 0x60, 0x01, 0x00,
+        0x6a, 0xdb, 0xb6, 0x42, 0x09, 0x23, 0xbb, 0x42, 0x3b, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x42,
+        0x09, 0x23, 0xbb, 0x42, 0x3e, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x42, 0x09, 0x23, 0xbb, 0x42,
+        0x42, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xb6, 0x42, 0xbf, 0x90, 0xbc, 0x42, 0x23, 0x40, 0x01, 0x00,
+        0x6a, 0xdb, 0xb6, 0x42, 0xbf, 0x90, 0xbc, 0x42, 0x2f, 0x40, 0x01, 0x00, 0x8f, 0x24, 0xbb, 0x42,
+        0xe4, 0xd9, 0xbb, 0x42, 0x47, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xbb, 0x42, 0xbf, 0x90, 0xbc, 0x42,
+        0x45, 0x40, 0x00, 0x00, 0x45, 0x92, 0xbc, 0x42, 0x2d, 0x6c, 0xbf, 0x42, 0x38, 0x40, 0x00, 0x00,
+        0x45, 0x92, 0xbc, 0x42, 0x2d, 0x6c, 0xbf, 0x42, 0x3b, 0x40, 0x00, 0x00, 0x45, 0x92, 0xbc, 0x42,
+        0x2d, 0x6c, 0xbf, 0x42, 0x40, 0x40, 0x00, 0x00, 0x45, 0x92, 0xbc, 0x42, 0x9b, 0x47, 0xc2, 0x42,
+        0x28, 0x40, 0x01, 0x00, 0x45, 0x92, 0xbc, 0x42, 0x9b, 0x47, 0xc2, 0x42, 0x34, 0x40, 0x01, 0x00,
+        0xb3, 0x6d, 0xbf, 0x42, 0xe4, 0xd9, 0xc0, 0x42, 0x40, 0x40, 0x00, 0x00, 0x6a, 0xdb, 0xc0, 0x42,
+        0x9b, 0x47, 0xc2, 0x42, 0x3e, 0x40, 0x00, 0x00, 0x21, 0x49, 0xc2, 0x42, 0xbf, 0x90, 0xc6, 0x42,
+        0x34, 0x40, 0x00, 0x00, 0x21, 0x49, 0xc2, 0x42, 0xbf, 0x90, 0xc6, 0x42, 0x39, 0x40, 0x00, 0x00,
+        0x21, 0x49, 0xc2, 0x42, 0xbf, 0x90, 0xc6, 0x42, 0x3d, 0x40, 0x00, 0x00, 0x21, 0x49, 0xc2, 0x42,
+        0x76, 0xfe, 0xc7, 0x42, 0x21, 0x40, 0x01, 0x00, 0x21, 0x49, 0xc2, 0x42, 0x76, 0xfe, 0xc7, 0x42,
+        0x2d, 0x40, 0x01, 0x00, 0x45, 0x92, 0xc6, 0x42, 0x9b, 0x47, 0xc7, 0x42, 0x3e, 0x40, 0x00, 0x00,
+        0x21, 0x49, 0xc7, 0x42, 0x76, 0xfe, 0xc7, 0x42, 0x40, 0x40, 0x00, 0x00, 0xfc, 0xff, 0xc7, 0x42,
+        0x51, 0xb5, 0xcd, 0x42, 0x32, 0x40, 0x00, 0x00, 0xfc, 0xff, 0xc7, 0x42, 0x51, 0xb5, 0xcd, 0x42,
+        0x37, 0x40, 0x00, 0x00, 0xfc, 0xff, 0xc7, 0x42, 0x51, 0xb5, 0xcd, 0x42, 0x3b, 0x40, 0x00, 0x00,
+        0xfc, 0xff, 0xc7, 0x42, 0x51, 0xb5, 0xcd, 0x42, 0x1f, 0x40, 0x01, 0x00, 0xfc, 0xff, 0xc7, 0x42,
+        0x51, 0xb5, 0xcd, 0x42, 0x2b, 0x40, 0x01, 0x00, 0xd7, 0xb6, 0xcd, 0x42, 0x76, 0xfe, 0xd1, 0x42,
+        0x3b, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x42, 0x76, 0xfe, 0xd1, 0x42, 0x3e, 0x40, 0x00, 0x00,
+        0xd7, 0xb6, 0xcd, 0x42, 0x76, 0xfe, 0xd1, 0x42, 0x42, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x42,
+        0x76, 0xfe, 0xd1, 0x42, 0x4a, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xcd, 0x42, 0x2d, 0x6c, 0xd3, 0x42,
+        0x23, 0x40, 0x01, 0x00, 0xd7, 0xb6, 0xcd, 0x42, 0x2d, 0x6c, 0xd3, 0x42, 0x2f, 0x40, 0x01, 0x00,
+        0xfc, 0xff, 0xd1, 0x42, 0x51, 0xb5, 0xd2, 0x42, 0x47, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xd2, 0x42,
+        0x2d, 0x6c, 0xd3, 0x42, 0x45, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xd3, 0x42, 0x9a, 0x47, 0xd6, 0x42,
+        0x38, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xd3, 0x42, 0x9a, 0x47, 0xd6, 0x42, 0x3b, 0x40, 0x00, 0x00,
+        0xb3, 0x6d, 0xd3, 0x42, 0x9a, 0x47, 0xd6, 0x42, 0x40, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xd3, 0x42,
+        0x08, 0x23, 0xd9, 0x42, 0x28, 0x40, 0x01, 0x00, 0xb3, 0x6d, 0xd3, 0x42, 0x08, 0x23, 0xd9, 0x42,
+        0x34, 0x40, 0x01, 0x00, 0x20, 0x49, 0xd6, 0x42, 0x51, 0xb5, 0xd7, 0x42, 0x40, 0x40, 0x00, 0x00,
+        0xd7, 0xb6, 0xd7, 0x42, 0x08, 0x23, 0xd9, 0x42, 0x3e, 0x40, 0x00, 0x00, 0xd7, 0xb6, 0xd7, 0x42,
+        0x08, 0x23, 0xd9, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x8e, 0x24, 0xd9, 0x42, 0x76, 0xfe, 0xdb, 0x42,
+        0x34, 0x40, 0x00, 0x00, 0x8e, 0x24, 0xd9, 0x42, 0x76, 0xfe, 0xdb, 0x42, 0x39, 0x40, 0x00, 0x00,
+        0x8e, 0x24, 0xd9, 0x42, 0x76, 0xfe, 0xdb, 0x42, 0x3d, 0x40, 0x00, 0x00, 0x8e, 0x24, 0xd9, 0x42,
+        0x76, 0xfe, 0xdb, 0x42, 0x49, 0x40, 0x00, 0x00, 0x8e, 0x24, 0xd9, 0x42, 0xe3, 0xd9, 0xde, 0x42,
+        0x21, 0x40, 0x01, 0x00, 0x8e, 0x24, 0xd9, 0x42, 0xe3, 0xd9, 0xde, 0x42, 0x2d, 0x40, 0x01, 0x00,
+        0xfc, 0xff, 0xdb, 0x42, 0x2c, 0x6c, 0xdd, 0x42, 0x4a, 0x40, 0x00, 0x00, 0xb3, 0x6d, 0xdd, 0x42,
+        0xe3, 0xd9, 0xde, 0x42, 0x4e, 0x40, 0x00, 0x00, 0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42,
+        0x47, 0x40, 0x00, 0x00, 0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42, 0x1f, 0x40, 0x01, 0x00,
+        0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42, 0x32, 0x40, 0x01, 0x00, 0x69, 0xdb, 0xde, 0x42,
+        0xbf, 0x90, 0xe4, 0x42, 0x37, 0x40, 0x01, 0x00, 0x69, 0xdb, 0xde, 0x42, 0xbf, 0x90, 0xe4, 0x42,
+        0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0xab, 0xaa, 0xfc, 0x3f, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x1e, 0x40, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+        0x89, 0x88, 0x79, 0x40, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x40, 0x55, 0x55, 0x3e, 0x40,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x55, 0x55, 0x5e, 0x40, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x60, 0x40, 0x22, 0x22, 0x6f, 0x40, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40,
+        0x22, 0x22, 0x7f, 0x40, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x11, 0x91, 0xad, 0x40,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0xab, 0x2a, 0x9f, 0x40, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa0, 0x40, 0xab, 0x2a, 0xaf, 0x40, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x40,
+        0x11, 0x91, 0xb7, 0x40, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x40, 0x11, 0x91, 0xbf, 0x40,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0xab, 0x2a, 0xcf, 0x40, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x40, 0x44, 0xc4, 0xfc, 0x40, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x40,
+        0xab, 0x2a, 0xdf, 0x40, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x40, 0xab, 0x2a, 0xef, 0x40,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x11, 0x91, 0xf7, 0x40, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf8, 0x40, 0x11, 0x91, 0xff, 0x40, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+        0x89, 0xc8, 0x16, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x55, 0x95, 0x0f, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0x55, 0x95, 0x17, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x18, 0x41, 0x89, 0xc8, 0x1b, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x41,
+        0x89, 0xc8, 0x1f, 0x41, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x55, 0x95, 0x27, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x22, 0x62, 0x3e, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x41, 0x89, 0xc8, 0x2b, 0x41, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x41,
+        0x89, 0xc8, 0x2f, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0x55, 0x95, 0x37, 0x41,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x41, 0x55, 0x95, 0x3f, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x41, 0xef, 0x2e, 0x4f, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41,
+        0x55, 0x95, 0x4f, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x50, 0x41, 0x55, 0x95, 0x57, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41, 0x55, 0x95, 0x5f, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x60, 0x41, 0x55, 0x95, 0x67, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x41,
+        0x22, 0x62, 0x7e, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x68, 0x41, 0x55, 0x95, 0x6f, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x41, 0x55, 0x95, 0x77, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0x41, 0x89, 0xc8, 0x7b, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x41,
+        0x89, 0xc8, 0x7f, 0x41, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x41, 0x44, 0x64, 0x8b, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x41, 0xab, 0xca, 0x87, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x88, 0x41, 0xab, 0xca, 0x8b, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8c, 0x41,
+        0x44, 0xe4, 0x8d, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x41, 0x44, 0xe4, 0x8f, 0x41,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0xab, 0xca, 0x93, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x90, 0x41, 0x11, 0x31, 0x9f, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x94, 0x41,
+        0xab, 0xca, 0x97, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x98, 0x41, 0xab, 0xca, 0x9b, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x41, 0x44, 0xe4, 0x9d, 0x41, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9e, 0x41, 0x44, 0xe4, 0x9f, 0x41, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x41,
+        0x44, 0x64, 0xab, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x41, 0xab, 0xca, 0xa7, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41, 0xab, 0xca, 0xab, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xac, 0x41, 0x44, 0xe4, 0xad, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xae, 0x41,
+        0x44, 0xe4, 0xaf, 0x41, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x41, 0xab, 0xca, 0xb3, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x41, 0x11, 0x31, 0xbf, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb4, 0x41, 0x44, 0xe4, 0xb5, 0x41, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x41,
+        0x44, 0xe4, 0xb7, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x41, 0xab, 0xca, 0xbb, 0x41,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x41, 0xab, 0xca, 0xbf, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0x77, 0x97, 0xc7, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x41,
+        0xab, 0xca, 0xc7, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x41, 0xab, 0xca, 0xcb, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x41, 0xab, 0xca, 0xcf, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd0, 0x41, 0xab, 0xca, 0xd3, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x41,
+        0x11, 0x31, 0xdf, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd4, 0x41, 0x44, 0xe4, 0xd5, 0x41,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x41, 0x44, 0xe4, 0xd7, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd8, 0x41, 0xab, 0xca, 0xdb, 0x41, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x41,
+        0xab, 0xca, 0xdf, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41, 0xab, 0xca, 0xe3, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41, 0xab, 0xca, 0xe3, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe4, 0x41, 0x77, 0x97, 0xeb, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41,
+        0xab, 0xca, 0xeb, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xec, 0x41, 0xab, 0xca, 0xef, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x41, 0xab, 0xca, 0xf3, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf0, 0x41, 0x11, 0x31, 0xff, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x41,
+        0x44, 0xe4, 0xf5, 0x41, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x41, 0x44, 0xe4, 0xf7, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x41, 0xab, 0xca, 0xfb, 0x41, 0x41, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xfc, 0x41, 0xab, 0xca, 0xff, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+        0x55, 0xe5, 0x01, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x55, 0xe5, 0x01, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x02, 0x42, 0xbc, 0xcb, 0x05, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x42, 0x55, 0xe5, 0x05, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x06, 0x42,
+        0x55, 0xe5, 0x07, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x55, 0xe5, 0x09, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x89, 0x98, 0x0f, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x0a, 0x42, 0x22, 0xf2, 0x0a, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x42,
+        0x22, 0xf2, 0x0b, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x42, 0xbc, 0xcb, 0x0f, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0xbc, 0xcb, 0x13, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x42, 0x89, 0x98, 0x17, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x16, 0x42,
+        0x55, 0xe5, 0x17, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18, 0x42, 0x55, 0xe5, 0x19, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18, 0x42, 0x89, 0x98, 0x1f, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x1a, 0x42, 0x22, 0xf2, 0x1a, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x42,
+        0x22, 0xf2, 0x1b, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x55, 0xe5, 0x1d, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x42, 0x55, 0xe5, 0x1f, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x42, 0x55, 0xe5, 0x21, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x42,
+        0x55, 0xe5, 0x21, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x22, 0x42, 0xbc, 0xcb, 0x25, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x55, 0xe5, 0x25, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x26, 0x42, 0x55, 0xe5, 0x27, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42,
+        0x55, 0xe5, 0x29, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x89, 0x98, 0x2f, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x42, 0x22, 0xf2, 0x2a, 0x42, 0x41, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2b, 0x42, 0x22, 0xf2, 0x2b, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x42,
+        0x55, 0xe5, 0x2d, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x42, 0x55, 0xe5, 0x2f, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x42, 0x55, 0xe5, 0x31, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0x42, 0x55, 0xe5, 0x31, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x32, 0x42,
+        0xbc, 0xcb, 0x35, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0x42, 0x55, 0xe5, 0x35, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x36, 0x42, 0x55, 0xe5, 0x37, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0x42, 0x55, 0xe5, 0x39, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42,
+        0x55, 0xe5, 0x39, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x42, 0xbc, 0xcb, 0x3d, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x55, 0xe5, 0x3d, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3e, 0x42, 0x55, 0xe5, 0x3f, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42,
+        0x55, 0xe5, 0x41, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42, 0xbc, 0xcb, 0x43, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x42, 0x42, 0x22, 0xf2, 0x42, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x43, 0x42, 0x22, 0xf2, 0x43, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x44, 0x42,
+        0xbc, 0xcb, 0x47, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x44, 0x42, 0xbc, 0xcb, 0x47, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x48, 0x42, 0x22, 0xb2, 0x4d, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x48, 0x42, 0x89, 0x98, 0x4f, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x42,
+        0x55, 0xe5, 0x4f, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x42, 0x55, 0xe5, 0x51, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x42, 0x89, 0x98, 0x57, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x52, 0x42, 0x55, 0xe5, 0x53, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x42,
+        0x55, 0xe5, 0x55, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x56, 0x42, 0x22, 0xf2, 0x56, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x57, 0x42, 0x22, 0xf2, 0x57, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x58, 0x42, 0x22, 0xb2, 0x5d, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42,
+        0x89, 0x98, 0x5f, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x42, 0x22, 0xf2, 0x5e, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x42, 0x22, 0xf2, 0x5f, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x60, 0x42, 0x55, 0xe5, 0x61, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x42,
+        0x89, 0x98, 0x67, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x62, 0x42, 0x55, 0xe5, 0x63, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x64, 0x42, 0x55, 0xe5, 0x65, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x66, 0x42, 0x22, 0xf2, 0x66, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x67, 0x42,
+        0x22, 0xf2, 0x67, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42, 0x22, 0xb2, 0x6d, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42, 0x89, 0x98, 0x6f, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x6e, 0x42, 0x22, 0xf2, 0x6e, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x42,
+        0x22, 0xf2, 0x6f, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42, 0x55, 0xe5, 0x71, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42, 0x89, 0x98, 0x77, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x72, 0x42, 0x55, 0xe5, 0x73, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x74, 0x42,
+        0x55, 0xe5, 0x75, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x76, 0x42, 0x22, 0xf2, 0x76, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x77, 0x42, 0x22, 0xf2, 0x77, 0x42, 0x41, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0x42, 0x55, 0xe5, 0x79, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x42,
+        0x89, 0x98, 0x7f, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x42, 0x55, 0xe5, 0x7b, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x55, 0xe5, 0x7d, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x7e, 0x42, 0x22, 0xf2, 0x7e, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x42,
+        0x22, 0xf2, 0x7f, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0xab, 0xf2, 0x80, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x44, 0xcc, 0x83, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x81, 0x42, 0xab, 0xf2, 0x81, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x42,
+        0xab, 0xf2, 0x82, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x42, 0x11, 0x79, 0x83, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x80, 0x83, 0x42, 0x11, 0xf9, 0x83, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x84, 0x42, 0x11, 0xd9, 0x86, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x85, 0x42,
+        0xab, 0xf2, 0x85, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x86, 0x42, 0xab, 0xf2, 0x86, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42, 0xab, 0xf2, 0x87, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x88, 0x42, 0xab, 0xf2, 0x88, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42,
+        0x44, 0xcc, 0x8b, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x89, 0x42, 0x11, 0x79, 0x89, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x80, 0x89, 0x42, 0x11, 0xf9, 0x89, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x8a, 0x42, 0xab, 0xf2, 0x8a, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x42,
+        0xab, 0xf2, 0x8b, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x42, 0xab, 0xf2, 0x8c, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x42, 0xab, 0xf2, 0x8c, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8d, 0x42, 0xde, 0xe5, 0x8e, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x42,
+        0xab, 0xf2, 0x8e, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8f, 0x42, 0xab, 0xf2, 0x8f, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x42, 0xab, 0xf2, 0x90, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x90, 0x42, 0x44, 0xcc, 0x93, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x91, 0x42,
+        0x11, 0x79, 0x91, 0x42, 0x41, 0x50, 0x00, 0x00, 0x00, 0x80, 0x91, 0x42, 0x11, 0xf9, 0x91, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42, 0xab, 0xf2, 0x92, 0x42, 0x41, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x93, 0x42, 0xab, 0xf2, 0x93, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x94, 0x42,
+        0xab, 0xf2, 0x94, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x94, 0x42, 0xab, 0xf2, 0x94, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x95, 0x42, 0xde, 0xe5, 0x96, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x96, 0x42, 0xab, 0xf2, 0x96, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x97, 0x42,
+        0xab, 0xf2, 0x97, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x98, 0x42, 0xab, 0xf2, 0x98, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x98, 0x42, 0xab, 0xf2, 0x98, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x99, 0x42, 0xde, 0xe5, 0x9a, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x42,
+        0xab, 0xf2, 0x9a, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9b, 0x42, 0xab, 0xf2, 0x9b, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x42, 0xab, 0xf2, 0x9c, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9c, 0x42, 0xde, 0xe5, 0x9d, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x42,
+        0x11, 0x79, 0x9d, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x80, 0x9d, 0x42, 0x11, 0xf9, 0x9d, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x42, 0xde, 0xe5, 0x9f, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9e, 0x42, 0xde, 0xe5, 0x9f, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x42,
+        0x44, 0xcc, 0xa3, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x42, 0x44, 0xcc, 0xa3, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x99, 0x11, 0x3f, 0x4a, 0x50, 0x00, 0x00,
+        0x89, 0x99, 0x19, 0x3f, 0x58, 0x3d, 0x62, 0x3f, 0x51, 0x50, 0x00, 0x00, 0x89, 0x99, 0x19, 0x3f,
+        0x89, 0x99, 0x95, 0x3f, 0x32, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x3f, 0x89, 0x99, 0x95, 0x3f,
+        0x36, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x3f, 0x89, 0x99, 0x95, 0x3f, 0x39, 0x50, 0x01, 0x00,
+        0x4d, 0x66, 0x66, 0x3f, 0x0e, 0x85, 0x97, 0x3f, 0x4f, 0x50, 0x00, 0x00, 0x89, 0x99, 0x99, 0x3f,
+        0x4e, 0x66, 0xe2, 0x3f, 0x4e, 0x50, 0x00, 0x00, 0x89, 0x99, 0x99, 0x3f, 0x4e, 0x66, 0xe2, 0x3f,
+        0x32, 0x50, 0x01, 0x00, 0x89, 0x99, 0x99, 0x3f, 0x4e, 0x66, 0xe2, 0x3f, 0x36, 0x50, 0x01, 0x00,
+        0x89, 0x99, 0x99, 0x3f, 0x4e, 0x66, 0xe2, 0x3f, 0x39, 0x50, 0x01, 0x00, 0x4d, 0x66, 0xe6, 0x3f,
+        0x1a, 0x5c, 0x05, 0x40, 0x4c, 0x50, 0x00, 0x00, 0x58, 0x66, 0x06, 0x40, 0x4b, 0x8f, 0x18, 0x40,
+        0x4a, 0x50, 0x00, 0x00, 0x89, 0x99, 0x19, 0x40, 0xeb, 0xff, 0x3d, 0x40, 0x4c, 0x50, 0x00, 0x00,
+        0xeb, 0xff, 0x3f, 0x40, 0x4d, 0x66, 0x64, 0x40, 0x45, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x3f, 0x40,
+        0x4d, 0x66, 0x64, 0x40, 0x31, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x3f, 0x40, 0x4d, 0x66, 0x64, 0x40,
+        0x34, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x3f, 0x40, 0x4d, 0x66, 0x64, 0x40, 0x39, 0x50, 0x01, 0x00,
+        0x4d, 0x66, 0x66, 0x40, 0x58, 0x66, 0x85, 0x40, 0x31, 0x50, 0x01, 0x00, 0x4d, 0x66, 0x66, 0x40,
+        0x58, 0x66, 0x85, 0x40, 0x34, 0x50, 0x01, 0x00, 0x4d, 0x66, 0x66, 0x40, 0x58, 0x66, 0x85, 0x40,
+        0x39, 0x50, 0x01, 0x00, 0x58, 0x66, 0x86, 0x40, 0x89, 0x99, 0x98, 0x40, 0x45, 0x50, 0x00, 0x00,
+        0x89, 0x99, 0x99, 0x40, 0x03, 0xae, 0xa2, 0x40, 0x4f, 0x50, 0x00, 0x00, 0x21, 0x33, 0xa3, 0x40,
+        0x9b, 0x47, 0xac, 0x40, 0x4e, 0x50, 0x00, 0x00, 0xba, 0xcc, 0xac, 0x40, 0x34, 0xe1, 0xb5, 0x40,
+        0x4c, 0x50, 0x00, 0x00, 0xba, 0xcc, 0xac, 0x40, 0xeb, 0xff, 0xbe, 0x40, 0x31, 0x50, 0x01, 0x00,
+        0xba, 0xcc, 0xac, 0x40, 0xeb, 0xff, 0xbe, 0x40, 0x34, 0x50, 0x01, 0x00, 0xba, 0xcc, 0xac, 0x40,
+        0xeb, 0xff, 0xbe, 0x40, 0x39, 0x50, 0x01, 0x00, 0x52, 0x66, 0xb6, 0x40, 0xcc, 0x7a, 0xbf, 0x40,
+        0x4a, 0x50, 0x00, 0x00, 0xeb, 0xff, 0xbf, 0x40, 0x1c, 0x33, 0xd2, 0x40, 0x49, 0x50, 0x00, 0x00,
+        0xeb, 0xff, 0xbf, 0x40, 0x1c, 0x33, 0xd2, 0x40, 0x31, 0x50, 0x01, 0x00, 0xeb, 0xff, 0xbf, 0x40,
+        0x1c, 0x33, 0xd2, 0x40, 0x34, 0x50, 0x01, 0x00, 0xeb, 0xff, 0xbf, 0x40, 0x1c, 0x33, 0xd2, 0x40,
+        0x39, 0x50, 0x01, 0x00, 0x1c, 0x33, 0xd3, 0x40, 0x4d, 0x66, 0xe5, 0x40, 0x4f, 0x50, 0x00, 0x00,
+        0x4d, 0x66, 0xe6, 0x40, 0x7e, 0x99, 0xf8, 0x40, 0x4f, 0x50, 0x00, 0x00, 0x7e, 0x99, 0xf9, 0x40,
+        0x58, 0xe6, 0x05, 0x41, 0x4e, 0x50, 0x00, 0x00, 0x7e, 0x99, 0xf9, 0x40, 0x58, 0xe6, 0x05, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x7e, 0x99, 0xf9, 0x40, 0x58, 0xe6, 0x05, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0x7e, 0x99, 0xf9, 0x40, 0x58, 0xe6, 0x05, 0x41, 0x39, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x41,
+        0xf0, 0x7f, 0x0f, 0x41, 0x32, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x41, 0xf0, 0x7f, 0x0f, 0x41,
+        0x36, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x41, 0xf0, 0x7f, 0x0f, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0xf0, 0xff, 0x0f, 0x41, 0x89, 0x19, 0x19, 0x41, 0x4e, 0x50, 0x00, 0x00, 0x89, 0x99, 0x19, 0x41,
+        0x21, 0xb3, 0x22, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x89, 0x99, 0x19, 0x41, 0xd9, 0xd1, 0x2b, 0x41,
+        0x31, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x41, 0xd9, 0xd1, 0x2b, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x89, 0x99, 0x19, 0x41, 0xd9, 0xd1, 0x2b, 0x41, 0x39, 0x50, 0x01, 0x00, 0x21, 0x33, 0x23, 0x41,
+        0x5e, 0xbd, 0x27, 0x41, 0x4e, 0x50, 0x00, 0x00, 0xee, 0xff, 0x27, 0x41, 0x2b, 0x8a, 0x2c, 0x41,
+        0x4f, 0x50, 0x00, 0x00, 0xba, 0xcc, 0x2c, 0x41, 0x53, 0xe6, 0x35, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0xba, 0xcc, 0x2c, 0x41, 0x0a, 0x05, 0x3f, 0x41, 0x31, 0x50, 0x01, 0x00, 0xba, 0xcc, 0x2c, 0x41,
+        0x0a, 0x05, 0x3f, 0x41, 0x34, 0x50, 0x01, 0x00, 0xba, 0xcc, 0x2c, 0x41, 0x0a, 0x05, 0x3f, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x52, 0x66, 0x36, 0x41, 0x8f, 0xf0, 0x3a, 0x41, 0x53, 0x50, 0x00, 0x00,
+        0x1f, 0x33, 0x3b, 0x41, 0x5c, 0xbd, 0x3f, 0x41, 0x55, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x3f, 0x41,
+        0x84, 0x19, 0x49, 0x41, 0x4a, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x3f, 0x41, 0x3b, 0x38, 0x52, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x3f, 0x41, 0x3b, 0x38, 0x52, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0xeb, 0xff, 0x3f, 0x41, 0x3b, 0x38, 0x52, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x84, 0x99, 0x49, 0x41,
+        0xc1, 0x23, 0x4e, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x50, 0x66, 0x4e, 0x41, 0x8d, 0xf0, 0x52, 0x41,
+        0x4e, 0x50, 0x00, 0x00, 0x1c, 0x33, 0x53, 0x41, 0xb5, 0x4c, 0x5c, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0x1c, 0x33, 0x53, 0x41, 0x6c, 0x6b, 0x65, 0x41, 0x32, 0x50, 0x01, 0x00, 0x1c, 0x33, 0x53, 0x41,
+        0x6c, 0x6b, 0x65, 0x41, 0x37, 0x50, 0x01, 0x00, 0x1c, 0x33, 0x53, 0x41, 0x6c, 0x6b, 0x65, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0x5c, 0x41, 0xf2, 0x56, 0x61, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x81, 0x99, 0x61, 0x41, 0xbe, 0x23, 0x66, 0x41, 0x53, 0x50, 0x00, 0x00, 0x4d, 0x66, 0x66, 0x41,
+        0xe6, 0x7f, 0x6f, 0x41, 0x49, 0x50, 0x00, 0x00, 0x4d, 0x66, 0x66, 0x41, 0x9d, 0x9e, 0x78, 0x41,
+        0x31, 0x50, 0x01, 0x00, 0x4d, 0x66, 0x66, 0x41, 0x9d, 0x9e, 0x78, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x4d, 0x66, 0x66, 0x41, 0x9d, 0x9e, 0x78, 0x41, 0x39, 0x50, 0x01, 0x00, 0xe6, 0xff, 0x6f, 0x41,
+        0x23, 0x8a, 0x74, 0x41, 0x4a, 0x50, 0x00, 0x00, 0xb2, 0xcc, 0x74, 0x41, 0xef, 0x56, 0x79, 0x41,
+        0x4c, 0x50, 0x00, 0x00, 0x7e, 0x99, 0x79, 0x41, 0x8b, 0x59, 0x81, 0x41, 0x4e, 0x50, 0x00, 0x00,
+        0x7e, 0x99, 0x79, 0x41, 0xe7, 0xe8, 0x85, 0x41, 0x31, 0x50, 0x01, 0x00, 0x7e, 0x99, 0x79, 0x41,
+        0xe7, 0xe8, 0x85, 0x41, 0x34, 0x50, 0x01, 0x00, 0x7e, 0x99, 0x79, 0x41, 0xe7, 0xe8, 0x85, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x8b, 0x99, 0x81, 0x41, 0xaa, 0xde, 0x83, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0xf2, 0xff, 0x83, 0x41, 0x10, 0x45, 0x86, 0x41, 0x51, 0x50, 0x00, 0x00, 0x58, 0x66, 0x86, 0x41,
+        0x24, 0xf3, 0x8a, 0x41, 0x47, 0x50, 0x00, 0x00, 0x58, 0x66, 0x86, 0x41, 0x80, 0x82, 0x8f, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x58, 0x66, 0x86, 0x41, 0x80, 0x82, 0x8f, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x58, 0x66, 0x86, 0x41, 0x80, 0x82, 0x8f, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x24, 0x33, 0x8b, 0x41,
+        0x42, 0x78, 0x8d, 0x41, 0x49, 0x50, 0x00, 0x00, 0x8a, 0x99, 0x8d, 0x41, 0xa9, 0xde, 0x8f, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0xf0, 0xff, 0x8f, 0x41, 0xbd, 0x8c, 0x94, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0xf0, 0xff, 0x8f, 0x41, 0x18, 0x1c, 0x99, 0x41, 0x34, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x8f, 0x41,
+        0x18, 0x1c, 0x99, 0x41, 0x38, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x8f, 0x41, 0x18, 0x1c, 0x99, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x94, 0x41, 0xdb, 0x11, 0x97, 0x41, 0x4e, 0x50, 0x00, 0x00,
+        0x23, 0x33, 0x97, 0x41, 0x41, 0x78, 0x99, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x89, 0x99, 0x99, 0x41,
+        0x5f, 0xfd, 0xa4, 0x41, 0x49, 0x50, 0x00, 0x00, 0x89, 0x99, 0x99, 0x41, 0x55, 0x26, 0x9e, 0x41,
+        0x31, 0x50, 0x01, 0x00, 0x89, 0x99, 0x99, 0x41, 0x55, 0x26, 0x9e, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x89, 0x99, 0x99, 0x41, 0x55, 0x26, 0x9e, 0x41, 0x39, 0x50, 0x01, 0x00, 0x55, 0x66, 0x9e, 0x41,
+        0x21, 0xf3, 0xa2, 0x41, 0x31, 0x50, 0x01, 0x00, 0x55, 0x66, 0x9e, 0x41, 0x21, 0xf3, 0xa2, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x55, 0x66, 0x9e, 0x41, 0x21, 0xf3, 0xa2, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x21, 0x33, 0xa3, 0x41, 0xee, 0xbf, 0xa7, 0x41, 0x31, 0x50, 0x01, 0x00, 0x21, 0x33, 0xa3, 0x41,
+        0xee, 0xbf, 0xa7, 0x41, 0x34, 0x50, 0x01, 0x00, 0x21, 0x33, 0xa3, 0x41, 0xee, 0xbf, 0xa7, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x88, 0x99, 0xa5, 0x41, 0xa6, 0xde, 0xa7, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0xee, 0xff, 0xa7, 0x41, 0x0c, 0x45, 0xaa, 0x41, 0x44, 0x50, 0x00, 0x00, 0x54, 0x66, 0xaa, 0x41,
+        0x72, 0xab, 0xac, 0x41, 0x45, 0x50, 0x00, 0x00, 0xba, 0xcc, 0xac, 0x41, 0x90, 0x30, 0xb8, 0x41,
+        0x4c, 0x50, 0x00, 0x00, 0xba, 0xcc, 0xac, 0x41, 0x86, 0x59, 0xb1, 0x41, 0x31, 0x50, 0x01, 0x00,
+        0xba, 0xcc, 0xac, 0x41, 0x86, 0x59, 0xb1, 0x41, 0x34, 0x50, 0x01, 0x00, 0xba, 0xcc, 0xac, 0x41,
+        0x86, 0x59, 0xb1, 0x41, 0x39, 0x50, 0x01, 0x00, 0x86, 0x99, 0xb1, 0x41, 0x53, 0x26, 0xb6, 0x41,
+        0x31, 0x50, 0x01, 0x00, 0x86, 0x99, 0xb1, 0x41, 0x53, 0x26, 0xb6, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x86, 0x99, 0xb1, 0x41, 0x53, 0x26, 0xb6, 0x41, 0x39, 0x50, 0x01, 0x00, 0x52, 0x66, 0xb6, 0x41,
+        0x1f, 0xf3, 0xba, 0x41, 0x31, 0x50, 0x01, 0x00, 0x52, 0x66, 0xb6, 0x41, 0x1f, 0xf3, 0xba, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x52, 0x66, 0xb6, 0x41, 0x1f, 0xf3, 0xba, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0xb9, 0xcc, 0xb8, 0x41, 0xd7, 0x11, 0xbb, 0x41, 0x45, 0x50, 0x00, 0x00, 0x1f, 0x33, 0xbb, 0x41,
+        0x3d, 0x78, 0xbd, 0x41, 0x44, 0x50, 0x00, 0x00, 0x85, 0x99, 0xbd, 0x41, 0xa3, 0xde, 0xbf, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0xeb, 0xff, 0xbf, 0x41, 0xc1, 0x63, 0xcb, 0x41, 0x4e, 0x50, 0x00, 0x00,
+        0xeb, 0xff, 0xbf, 0x41, 0xb7, 0x8c, 0xc4, 0x41, 0x32, 0x50, 0x01, 0x00, 0xeb, 0xff, 0xbf, 0x41,
+        0xb7, 0x8c, 0xc4, 0x41, 0x36, 0x50, 0x01, 0x00, 0xeb, 0xff, 0xbf, 0x41, 0xb7, 0x8c, 0xc4, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0xb7, 0xcc, 0xc4, 0x41, 0x84, 0x59, 0xc9, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0xb7, 0xcc, 0xc4, 0x41, 0x84, 0x59, 0xc9, 0x41, 0x36, 0x50, 0x01, 0x00, 0xb7, 0xcc, 0xc4, 0x41,
+        0x84, 0x59, 0xc9, 0x41, 0x39, 0x50, 0x01, 0x00, 0x84, 0x99, 0xc9, 0x41, 0x50, 0x26, 0xce, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x84, 0x99, 0xc9, 0x41, 0x50, 0x26, 0xce, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0x84, 0x99, 0xc9, 0x41, 0x50, 0x26, 0xce, 0x41, 0x39, 0x50, 0x01, 0x00, 0xea, 0xff, 0xcb, 0x41,
+        0x08, 0x45, 0xce, 0x41, 0x45, 0x50, 0x00, 0x00, 0x50, 0x66, 0xce, 0x41, 0x6e, 0xab, 0xd0, 0x41,
+        0x44, 0x50, 0x00, 0x00, 0xb6, 0xcc, 0xd0, 0x41, 0xd4, 0x11, 0xd3, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x1c, 0x33, 0xd3, 0x41, 0xf2, 0x96, 0xde, 0x41, 0x50, 0x50, 0x00, 0x00, 0x1c, 0x33, 0xd3, 0x41,
+        0xe8, 0xbf, 0xd7, 0x41, 0x34, 0x50, 0x01, 0x00, 0x1c, 0x33, 0xd3, 0x41, 0xe8, 0xbf, 0xd7, 0x41,
+        0x38, 0x50, 0x01, 0x00, 0x1c, 0x33, 0xd3, 0x41, 0xe8, 0xbf, 0xd7, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0xe8, 0xff, 0xd7, 0x41, 0xb5, 0x8c, 0xdc, 0x41, 0x34, 0x50, 0x01, 0x00, 0xe8, 0xff, 0xd7, 0x41,
+        0xb5, 0x8c, 0xdc, 0x41, 0x38, 0x50, 0x01, 0x00, 0xe8, 0xff, 0xd7, 0x41, 0xb5, 0x8c, 0xdc, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xdc, 0x41, 0x81, 0x59, 0xe1, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0xb5, 0xcc, 0xdc, 0x41, 0x81, 0x59, 0xe1, 0x41, 0x38, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xdc, 0x41,
+        0x81, 0x59, 0xe1, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x1b, 0x33, 0xdf, 0x41, 0x39, 0x78, 0xe1, 0x41,
+        0x4c, 0x50, 0x00, 0x00, 0x81, 0x99, 0xe1, 0x41, 0x9f, 0xde, 0xe3, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0xe7, 0xff, 0xe3, 0x41, 0x06, 0x45, 0xe6, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x4d, 0x66, 0xe6, 0x41,
+        0x1a, 0xf3, 0xea, 0x41, 0x51, 0x50, 0x00, 0x00, 0x4d, 0x66, 0xe6, 0x41, 0x1a, 0xf3, 0xea, 0x41,
+        0x31, 0x50, 0x01, 0x00, 0x4d, 0x66, 0xe6, 0x41, 0x1a, 0xf3, 0xea, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x4d, 0x66, 0xe6, 0x41, 0x1a, 0xf3, 0xea, 0x41, 0x39, 0x50, 0x01, 0x00, 0x1a, 0x33, 0xeb, 0x41,
+        0xe6, 0xbf, 0xef, 0x41, 0x45, 0x50, 0x00, 0x00, 0x1a, 0x33, 0xeb, 0x41, 0xe6, 0xbf, 0xef, 0x41,
+        0x31, 0x50, 0x01, 0x00, 0x1a, 0x33, 0xeb, 0x41, 0xe6, 0xbf, 0xef, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0xeb, 0x41, 0xe6, 0xbf, 0xef, 0x41, 0x39, 0x50, 0x01, 0x00, 0xe6, 0xff, 0xef, 0x41,
+        0xb2, 0x8c, 0xf4, 0x41, 0x31, 0x50, 0x01, 0x00, 0xe6, 0xff, 0xef, 0x41, 0xb2, 0x8c, 0xf4, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0xe6, 0xff, 0xef, 0x41, 0xb2, 0x8c, 0xf4, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0xb2, 0xcc, 0xf4, 0x41, 0x7e, 0x59, 0xf9, 0x41, 0x51, 0x50, 0x00, 0x00, 0x7e, 0x99, 0xf9, 0x41,
+        0x9d, 0xde, 0xfb, 0x41, 0x51, 0x50, 0x00, 0x00, 0x7e, 0x99, 0xf9, 0x41, 0xd3, 0x5a, 0x01, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x7e, 0x99, 0xf9, 0x41, 0xd3, 0x5a, 0x01, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0x7e, 0x99, 0xf9, 0x41, 0xd3, 0x5a, 0x01, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xe4, 0xff, 0xfb, 0x41,
+        0x03, 0x45, 0xfe, 0x41, 0x50, 0x50, 0x00, 0x00, 0x4b, 0x66, 0xfe, 0x41, 0xb5, 0x55, 0x00, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x58, 0x66, 0x00, 0x42, 0xe8, 0x88, 0x01, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x8b, 0x99, 0x01, 0x42, 0x1b, 0xbc, 0x02, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x01, 0x42,
+        0x9f, 0x27, 0x06, 0x42, 0x34, 0x50, 0x01, 0x00, 0x8b, 0x99, 0x01, 0x42, 0x9f, 0x27, 0x06, 0x42,
+        0x38, 0x50, 0x01, 0x00, 0x8b, 0x99, 0x01, 0x42, 0x9f, 0x27, 0x06, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xbf, 0xcc, 0x02, 0x42, 0x4e, 0xef, 0x03, 0x42, 0x49, 0x50, 0x00, 0x00, 0xf2, 0xff, 0x03, 0x42,
+        0x81, 0x22, 0x05, 0x42, 0x47, 0x50, 0x00, 0x00, 0x25, 0x33, 0x05, 0x42, 0xb4, 0x55, 0x06, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x58, 0x66, 0x06, 0x42, 0x1a, 0x3c, 0x0d, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x58, 0x66, 0x06, 0x42, 0x6c, 0xf4, 0x0a, 0x42, 0x34, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x42,
+        0x6c, 0xf4, 0x0a, 0x42, 0x38, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x42, 0x6c, 0xf4, 0x0a, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x24, 0x33, 0x0b, 0x42, 0x8a, 0x79, 0x0d, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x24, 0x33, 0x0b, 0x42, 0x8a, 0x79, 0x0d, 0x42, 0x38, 0x50, 0x01, 0x00, 0x24, 0x33, 0x0b, 0x42,
+        0x8a, 0x79, 0x0d, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x8a, 0x99, 0x0d, 0x42, 0xf0, 0xdf, 0x0f, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x42, 0x04, 0x8e, 0x14, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x56, 0x66, 0x12, 0x42, 0xbd, 0xac, 0x14, 0x42, 0x31, 0x50, 0x01, 0x00, 0x56, 0x66, 0x12, 0x42,
+        0xbd, 0xac, 0x14, 0x42, 0x34, 0x50, 0x01, 0x00, 0x56, 0x66, 0x12, 0x42, 0xbd, 0xac, 0x14, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x14, 0x42, 0x23, 0x13, 0x17, 0x42, 0x31, 0x50, 0x01, 0x00,
+        0xbd, 0xcc, 0x14, 0x42, 0x23, 0x13, 0x17, 0x42, 0x34, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x14, 0x42,
+        0x23, 0x13, 0x17, 0x42, 0x39, 0x50, 0x01, 0x00, 0x23, 0x33, 0x17, 0x42, 0x89, 0x79, 0x19, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x23, 0x33, 0x17, 0x42, 0x89, 0x79, 0x19, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x23, 0x33, 0x17, 0x42, 0x89, 0x79, 0x19, 0x42, 0x39, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x42,
+        0xef, 0xdf, 0x1b, 0x42, 0x45, 0x50, 0x00, 0x00, 0x89, 0x99, 0x19, 0x42, 0xef, 0xdf, 0x1b, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x42, 0xef, 0xdf, 0x1b, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x89, 0x99, 0x19, 0x42, 0xef, 0xdf, 0x1b, 0x42, 0x39, 0x50, 0x01, 0x00, 0xef, 0xff, 0x1b, 0x42,
+        0x7e, 0x22, 0x1d, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x22, 0x33, 0x1d, 0x42, 0xb1, 0x55, 0x1e, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x55, 0x66, 0x1e, 0x42, 0xbb, 0xac, 0x20, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x55, 0x66, 0x1e, 0x42, 0x69, 0xf4, 0x22, 0x42, 0x31, 0x50, 0x01, 0x00, 0x55, 0x66, 0x1e, 0x42,
+        0x69, 0xf4, 0x22, 0x42, 0x34, 0x50, 0x01, 0x00, 0x55, 0x66, 0x1e, 0x42, 0x69, 0xf4, 0x22, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xbb, 0xcc, 0x20, 0x42, 0x4a, 0xef, 0x21, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xee, 0xff, 0x21, 0x42, 0x7e, 0x22, 0x23, 0x42, 0x45, 0x50, 0x00, 0x00, 0x21, 0x33, 0x23, 0x42,
+        0x88, 0x79, 0x25, 0x42, 0x47, 0x50, 0x00, 0x00, 0x21, 0x33, 0x23, 0x42, 0x35, 0xc1, 0x27, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0x21, 0x33, 0x23, 0x42, 0x35, 0xc1, 0x27, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0x21, 0x33, 0x23, 0x42, 0x35, 0xc1, 0x27, 0x42, 0x34, 0x50, 0x01, 0x00, 0x88, 0x99, 0x25, 0x42,
+        0xee, 0xdf, 0x27, 0x42, 0x40, 0x50, 0x00, 0x00, 0xee, 0xff, 0x27, 0x42, 0x02, 0x8e, 0x2c, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0xee, 0xff, 0x27, 0x42, 0x02, 0x8e, 0x2c, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0xee, 0xff, 0x27, 0x42, 0x02, 0x8e, 0x2c, 0x42, 0x34, 0x50, 0x01, 0x00, 0x54, 0x66, 0x2a, 0x42,
+        0xba, 0xac, 0x2c, 0x42, 0x40, 0x50, 0x00, 0x00, 0xba, 0xcc, 0x2c, 0x42, 0x49, 0xef, 0x2d, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xed, 0xff, 0x2d, 0x42, 0x7c, 0x22, 0x2f, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x20, 0x33, 0x2f, 0x42, 0xaf, 0x55, 0x30, 0x42, 0x47, 0x50, 0x00, 0x00, 0x20, 0x33, 0x2f, 0x42,
+        0x86, 0x79, 0x31, 0x42, 0x28, 0x50, 0x01, 0x00, 0x53, 0x66, 0x30, 0x42, 0xe2, 0x88, 0x31, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x86, 0x99, 0x31, 0x42, 0xec, 0xdf, 0x33, 0x42, 0x44, 0x50, 0x00, 0x00,
+        0x86, 0x99, 0x31, 0x42, 0xec, 0xdf, 0x33, 0x42, 0x2c, 0x50, 0x01, 0x00, 0xec, 0xff, 0x33, 0x42,
+        0x52, 0x46, 0x36, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xec, 0xff, 0x33, 0x42, 0x52, 0x46, 0x36, 0x42,
+        0x28, 0x50, 0x01, 0x00, 0x52, 0x66, 0x36, 0x42, 0xb9, 0xac, 0x38, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xb9, 0xcc, 0x38, 0x42, 0x1f, 0x13, 0x3b, 0x42, 0x49, 0x50, 0x00, 0x00, 0xb9, 0xcc, 0x38, 0x42,
+        0x1f, 0x13, 0x3b, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x1f, 0x33, 0x3b, 0x42, 0x85, 0x79, 0x3d, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x85, 0x99, 0x3d, 0x42, 0xeb, 0xdf, 0x3f, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x85, 0x99, 0x3d, 0x42, 0xeb, 0xdf, 0x3f, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x3f, 0x42,
+        0x7a, 0x22, 0x41, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x3f, 0x42, 0xff, 0x8d, 0x44, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x1e, 0x33, 0x41, 0x42, 0xad, 0x55, 0x42, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x51, 0x66, 0x42, 0x42, 0xe0, 0x88, 0x43, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x84, 0x99, 0x43, 0x42,
+        0x13, 0xbc, 0x44, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xb7, 0xcc, 0x44, 0x42, 0x1d, 0x13, 0x47, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0xb7, 0xcc, 0x44, 0x42, 0xcb, 0x5a, 0x49, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x1d, 0x33, 0x47, 0x42, 0x84, 0x79, 0x49, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x84, 0x99, 0x49, 0x42,
+        0xea, 0xdf, 0x4b, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xea, 0xff, 0x4b, 0x42, 0x50, 0x46, 0x4e, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0xea, 0xff, 0x4b, 0x42, 0x50, 0x46, 0x4e, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x50, 0x66, 0x4e, 0x42, 0xb6, 0xac, 0x50, 0x42, 0x32, 0x50, 0x01, 0x00, 0xb6, 0xcc, 0x50, 0x42,
+        0x1c, 0x13, 0x53, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1c, 0x33, 0x53, 0x42, 0x82, 0x79, 0x55, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x1c, 0x33, 0x53, 0x42, 0x30, 0xc1, 0x57, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x82, 0x99, 0x55, 0x42, 0x12, 0xbc, 0x56, 0x42, 0x49, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0x56, 0x42,
+        0x45, 0xef, 0x57, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xe8, 0xff, 0x57, 0x42, 0x4f, 0x46, 0x5a, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xe8, 0xff, 0x57, 0x42, 0xfc, 0x8d, 0x5c, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x4f, 0x66, 0x5a, 0x42, 0xde, 0x88, 0x5b, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x82, 0x99, 0x5b, 0x42,
+        0x11, 0xbc, 0x5c, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0x5c, 0x42, 0x1b, 0x13, 0x5f, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0x5c, 0x42, 0xc9, 0x5a, 0x61, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x1b, 0x33, 0x5f, 0x42, 0xaa, 0x55, 0x60, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x4e, 0x66, 0x60, 0x42,
+        0xdd, 0x88, 0x61, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x81, 0x99, 0x61, 0x42, 0xe7, 0xdf, 0x63, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x81, 0x99, 0x61, 0x42, 0x95, 0x27, 0x66, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0xe7, 0xff, 0x63, 0x42, 0x76, 0x22, 0x65, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x1a, 0x33, 0x65, 0x42,
+        0xa9, 0x55, 0x66, 0x42, 0x51, 0x50, 0x00, 0x00, 0x4d, 0x66, 0x66, 0x42, 0xb3, 0xac, 0x68, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x4d, 0x66, 0x66, 0x42, 0x61, 0xf4, 0x6a, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0xb3, 0xcc, 0x68, 0x42, 0x43, 0xef, 0x69, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xe6, 0xff, 0x69, 0x42,
+        0x76, 0x22, 0x6b, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1a, 0x33, 0x6b, 0x42, 0x80, 0x79, 0x6d, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x1a, 0x33, 0x6b, 0x42, 0x2d, 0xc1, 0x6f, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0x80, 0x99, 0x6d, 0x42, 0x0f, 0xbc, 0x6e, 0x42, 0x51, 0x50, 0x00, 0x00, 0xb3, 0xcc, 0x6e, 0x42,
+        0x42, 0xef, 0x6f, 0x42, 0x53, 0x50, 0x00, 0x00, 0xe6, 0xff, 0x6f, 0x42, 0xfa, 0x8d, 0x74, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0xe6, 0xff, 0x6f, 0x42, 0x4c, 0x46, 0x72, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x4c, 0x66, 0x72, 0x42, 0xb2, 0xac, 0x74, 0x42, 0x34, 0x50, 0x01, 0x00, 0xb2, 0xcc, 0x74, 0x42,
+        0x18, 0x13, 0x77, 0x42, 0x39, 0x50, 0x01, 0x00, 0x18, 0x33, 0x77, 0x42, 0xa7, 0x55, 0x78, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0x4b, 0x66, 0x78, 0x42, 0xdb, 0x88, 0x79, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x7e, 0x99, 0x79, 0x42, 0x0e, 0xbc, 0x7a, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x7e, 0x99, 0x79, 0x42,
+        0xe4, 0xdf, 0x7b, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xb1, 0xcc, 0x7a, 0x42, 0x41, 0xef, 0x7b, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0xe4, 0xff, 0x7b, 0x42, 0x74, 0x22, 0x7d, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xe4, 0xff, 0x7b, 0x42, 0x4b, 0x46, 0x7e, 0x42, 0x31, 0x50, 0x01, 0x00, 0x18, 0x33, 0x7d, 0x42,
+        0xa7, 0x55, 0x7e, 0x42, 0x45, 0x50, 0x00, 0x00, 0x4b, 0x66, 0x7e, 0x42, 0xda, 0x88, 0x7f, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x4b, 0x66, 0x7e, 0x42, 0x58, 0x56, 0x80, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x7e, 0x99, 0x7f, 0x42, 0x06, 0x5e, 0x80, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x58, 0x66, 0x80, 0x42,
+        0xa0, 0xf7, 0x80, 0x42, 0x51, 0x50, 0x00, 0x00, 0xf2, 0xff, 0x80, 0x42, 0x3a, 0x91, 0x81, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x81, 0x42, 0xbf, 0xbc, 0x82, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x8b, 0x99, 0x81, 0x42, 0xbf, 0xbc, 0x82, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xbf, 0xcc, 0x82, 0x42,
+        0xf2, 0xef, 0x83, 0x42, 0x45, 0x50, 0x00, 0x00, 0xbf, 0xcc, 0x82, 0x42, 0xf2, 0xef, 0x83, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0xf2, 0xff, 0x83, 0x42, 0x25, 0x23, 0x85, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x25, 0x33, 0x85, 0x42, 0x6c, 0xc4, 0x85, 0x42, 0x49, 0x50, 0x00, 0x00, 0xbe, 0xcc, 0x85, 0x42,
+        0x06, 0x5e, 0x86, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x58, 0x66, 0x86, 0x42, 0x9f, 0xf7, 0x86, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x58, 0x66, 0x86, 0x42, 0x8b, 0x89, 0x87, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0xf1, 0xff, 0x86, 0x42, 0x39, 0x91, 0x87, 0x42, 0x49, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x87, 0x42,
+        0xd2, 0x2a, 0x88, 0x42, 0x47, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x87, 0x42, 0xbe, 0xbc, 0x88, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x24, 0x33, 0x88, 0x42, 0x6c, 0xc4, 0x88, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xbe, 0xcc, 0x88, 0x42, 0x05, 0x5e, 0x89, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xbe, 0xcc, 0x88, 0x42,
+        0xf1, 0xef, 0x89, 0x42, 0x32, 0x50, 0x01, 0x00, 0x57, 0x66, 0x89, 0x42, 0x9f, 0xf7, 0x89, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0xf1, 0xff, 0x89, 0x42, 0x39, 0x91, 0x8a, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x8a, 0x99, 0x8a, 0x42, 0xd2, 0x2a, 0x8b, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x24, 0x33, 0x8b, 0x42,
+        0x57, 0x56, 0x8c, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x24, 0x33, 0x8b, 0x42, 0x57, 0x56, 0x8c, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x57, 0x66, 0x8c, 0x42, 0x8a, 0x89, 0x8d, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x57, 0x66, 0x8c, 0x42, 0x8a, 0x89, 0x8d, 0x42, 0x34, 0x50, 0x01, 0x00, 0x8a, 0x99, 0x8d, 0x42,
+        0xbd, 0xbc, 0x8e, 0x42, 0x39, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x8e, 0x42, 0x05, 0x5e, 0x8f, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x57, 0x66, 0x8f, 0x42, 0x9e, 0xf7, 0x8f, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0xf0, 0xff, 0x8f, 0x42, 0x23, 0x23, 0x91, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xf0, 0xff, 0x8f, 0x42,
+        0xfa, 0x46, 0x92, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x8f, 0x42, 0xfa, 0x46, 0x92, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x23, 0x33, 0x91, 0x42, 0x6b, 0xc4, 0x91, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0xbd, 0xcc, 0x91, 0x42, 0x04, 0x5e, 0x92, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x56, 0x66, 0x92, 0x42,
+        0x75, 0x1b, 0x94, 0x42, 0x49, 0x50, 0x00, 0x00, 0x56, 0x66, 0x92, 0x42, 0x89, 0x89, 0x93, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x56, 0x66, 0x92, 0x42, 0x89, 0x89, 0x93, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x89, 0x99, 0x93, 0x42, 0xbd, 0xbc, 0x94, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x89, 0x99, 0x93, 0x42,
+        0xbd, 0xbc, 0x94, 0x42, 0x37, 0x50, 0x01, 0x00, 0x23, 0x33, 0x94, 0x42, 0x6b, 0xc4, 0x94, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xbd, 0xcc, 0x94, 0x42, 0x74, 0x5b, 0x99, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xbd, 0xcc, 0x94, 0x42, 0x74, 0x5b, 0x99, 0x42, 0x32, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x94, 0x42,
+        0x74, 0x5b, 0x99, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x55, 0xad, 0x3e,
+        0x43, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x3c, 0x02, 0x40, 0x24, 0x40, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xf7, 0x3c, 0x02, 0x40, 0x2b, 0x40, 0x01, 0x00, 0x73, 0xdb, 0xb6, 0x3e,
+        0x66, 0x18, 0x32, 0x3f, 0x3c, 0x40, 0x00, 0x00, 0x73, 0xdb, 0x36, 0x3f, 0x67, 0x18, 0x62, 0x3f,
+        0x3f, 0x40, 0x00, 0x00, 0x4f, 0x92, 0x64, 0x3f, 0xa2, 0xe7, 0x87, 0x3f, 0x41, 0x40, 0x00, 0x00,
+        0x96, 0x24, 0x89, 0x3f, 0xec, 0x79, 0xb4, 0x3f, 0x43, 0x40, 0x00, 0x00, 0x73, 0xdb, 0xb6, 0x3f,
+        0xc9, 0x30, 0xe2, 0x3f, 0x3c, 0x40, 0x00, 0x00, 0x4f, 0x92, 0xe4, 0x3f, 0xca, 0x30, 0xfa, 0x3f,
+        0x3f, 0x40, 0x00, 0x00, 0xbd, 0x6d, 0xfb, 0x3f, 0x1c, 0x86, 0x08, 0x40, 0x41, 0x40, 0x00, 0x00,
+        0x96, 0x24, 0x09, 0x40, 0x41, 0xcf, 0x1e, 0x40, 0x43, 0x40, 0x00, 0x00, 0x96, 0x24, 0x09, 0x40,
+        0xc7, 0xb0, 0x85, 0x40, 0x24, 0x40, 0x01, 0x00, 0x96, 0x24, 0x09, 0x40, 0xc7, 0xb0, 0x85, 0x40,
+        0x2b, 0x40, 0x01, 0x00, 0x04, 0x00, 0x20, 0x40, 0xaf, 0xaa, 0x35, 0x40, 0x3c, 0x40, 0x00, 0x00,
+        0x73, 0xdb, 0x36, 0x40, 0xb0, 0xaa, 0x41, 0x40, 0x3f, 0x40, 0x00, 0x00, 0x2a, 0x49, 0x42, 0x40,
+        0x67, 0x18, 0x4d, 0x40, 0x41, 0x40, 0x00, 0x00, 0xe1, 0xb6, 0x4d, 0x40, 0x8c, 0x61, 0x63, 0x40,
+        0x43, 0x40, 0x00, 0x00, 0x4f, 0x92, 0x64, 0x40, 0xfa, 0x3c, 0x7a, 0x40, 0x3c, 0x40, 0x00, 0x00,
+        0xbd, 0x6d, 0x7b, 0x40, 0x7d, 0x1e, 0x83, 0x40, 0x3f, 0x40, 0x00, 0x00, 0xba, 0x6d, 0x83, 0x40,
+        0x59, 0xd5, 0x88, 0x40, 0x41, 0x40, 0x00, 0x00, 0x96, 0x24, 0x89, 0x40, 0xeb, 0xf9, 0x93, 0x40,
+        0x43, 0x40, 0x00, 0x00, 0x96, 0x24, 0x89, 0x40, 0x11, 0x43, 0xca, 0x40, 0x24, 0x40, 0x01, 0x00,
+        0x96, 0x24, 0x89, 0x40, 0x11, 0x43, 0xca, 0x40, 0x2b, 0x40, 0x01, 0x00, 0x4d, 0x92, 0x94, 0x40,
+        0xa3, 0x67, 0x9f, 0x40, 0x3c, 0x40, 0x00, 0x00, 0x04, 0x00, 0xa0, 0x40, 0xa3, 0x67, 0xa5, 0x40,
+        0x40, 0x40, 0x00, 0x00, 0xe0, 0xb6, 0xa5, 0x40, 0x7e, 0x1e, 0xab, 0x40, 0x41, 0x40, 0x00, 0x00,
+        0xbb, 0x6d, 0xab, 0x40, 0x11, 0x43, 0xb6, 0x40, 0x43, 0x40, 0x00, 0x00, 0x73, 0xdb, 0xb6, 0x40,
+        0xc8, 0xb0, 0xc1, 0x40, 0x3c, 0x40, 0x00, 0x00, 0x2a, 0x49, 0xc2, 0x40, 0xc8, 0xb0, 0xc7, 0x40,
+        0x40, 0x40, 0x00, 0x00, 0x05, 0x00, 0xc8, 0x40, 0xa4, 0x67, 0xcd, 0x40, 0x41, 0x40, 0x00, 0x00,
+        0xe1, 0xb6, 0xcd, 0x40, 0x36, 0x8c, 0xd8, 0x40, 0x43, 0x40, 0x00, 0x00, 0xe1, 0xb6, 0xcd, 0x40,
+        0xae, 0x6a, 0x07, 0x41, 0x24, 0x40, 0x01, 0x00, 0xe1, 0xb6, 0xcd, 0x40, 0xae, 0x6a, 0x07, 0x41,
+        0x2b, 0x40, 0x01, 0x00, 0x98, 0x24, 0xd9, 0x40, 0xee, 0xf9, 0xe3, 0x40, 0x3c, 0x40, 0x00, 0x00,
+        0x4f, 0x92, 0xe4, 0x40, 0xee, 0xf9, 0xe9, 0x40, 0x40, 0x40, 0x00, 0x00, 0x2b, 0x49, 0xea, 0x40,
+        0xc9, 0xb0, 0xef, 0x40, 0x41, 0x40, 0x00, 0x00, 0x06, 0x00, 0xf0, 0x40, 0x5c, 0xd5, 0xfa, 0x40,
+        0x43, 0x40, 0x00, 0x00, 0xbd, 0x6d, 0xfb, 0x40, 0x8a, 0x21, 0x03, 0x41, 0x3c, 0x40, 0x00, 0x00,
+        0xba, 0x6d, 0x03, 0x41, 0x8a, 0x21, 0x06, 0x41, 0x40, 0x40, 0x00, 0x00, 0x28, 0x49, 0x06, 0x41,
+        0xf7, 0xfc, 0x08, 0x41, 0x41, 0x40, 0x00, 0x00, 0x96, 0x24, 0x09, 0x41, 0xaf, 0x6a, 0x19, 0x41,
+        0x43, 0x40, 0x00, 0x00, 0x96, 0x24, 0x09, 0x41, 0xd4, 0xb3, 0x29, 0x41, 0x24, 0x40, 0x01, 0x00,
+        0x96, 0x24, 0x09, 0x41, 0xd4, 0xb3, 0x29, 0x41, 0x2b, 0x40, 0x01, 0x00, 0x29, 0x49, 0x1a, 0x41,
+        0x41, 0x8f, 0x2a, 0x41, 0x3c, 0x40, 0x00, 0x00, 0xbb, 0x6d, 0x2b, 0x41, 0x8b, 0x21, 0x2e, 0x41,
+        0x3c, 0x40, 0x00, 0x00, 0xbb, 0x6d, 0x2b, 0x41, 0x8b, 0x21, 0x2e, 0x41, 0x3f, 0x40, 0x00, 0x00,
+        0xbb, 0x6d, 0x2b, 0x41, 0xf9, 0xfc, 0x4b, 0x41, 0x24, 0x40, 0x01, 0x00, 0xbb, 0x6d, 0x2b, 0x41,
+        0xf9, 0xfc, 0x4b, 0x41, 0x2b, 0x40, 0x01, 0x00, 0x29, 0x49, 0x2e, 0x41, 0xf8, 0xfc, 0x30, 0x41,
+        0x41, 0x40, 0x00, 0x00, 0x97, 0x24, 0x31, 0x41, 0xf9, 0xfc, 0x3b, 0x41, 0x43, 0x40, 0x00, 0x00,
+        0x4e, 0x92, 0x3c, 0x41, 0xb0, 0x6a, 0x47, 0x41, 0x3c, 0x40, 0x00, 0x00, 0x05, 0x00, 0x48, 0x41,
+        0xd5, 0xb3, 0x4a, 0x41, 0x3f, 0x40, 0x00, 0x00, 0x73, 0xdb, 0x4a, 0x41, 0x42, 0x8f, 0x4d, 0x41,
+        0x41, 0x40, 0x00, 0x00, 0xe1, 0xb6, 0x4d, 0x41, 0xb0, 0x6a, 0x53, 0x41, 0x3a, 0x4c, 0x00, 0x00,
+        0xe1, 0xb6, 0x4d, 0x41, 0xb0, 0x6a, 0x53, 0x41, 0x3e, 0x4c, 0x00, 0x00, 0xe1, 0xb6, 0x4d, 0x41,
+        0x1f, 0x46, 0x6e, 0x41, 0x2b, 0x40, 0x01, 0x00, 0xe1, 0xb6, 0x4d, 0x41, 0x1f, 0x46, 0x6e, 0x41,
+        0x32, 0x40, 0x01, 0x00, 0xbc, 0x6d, 0x53, 0x41, 0x67, 0xd8, 0x58, 0x41, 0x37, 0x40, 0x00, 0x00,
+        0x98, 0x24, 0x59, 0x41, 0x67, 0xd8, 0x5b, 0x41, 0x3a, 0x40, 0x00, 0x00, 0x06, 0x00, 0x5c, 0x41,
+        0xd5, 0xb3, 0x5e, 0x41, 0x3c, 0x40, 0x00, 0x00, 0x74, 0xdb, 0x5e, 0x41, 0x43, 0x8f, 0x64, 0x41,
+        0x3e, 0x4c, 0x00, 0x00, 0x4f, 0x92, 0x64, 0x41, 0xfa, 0xfc, 0x69, 0x41, 0x37, 0x40, 0x00, 0x00,
+        0x2b, 0x49, 0x6a, 0x41, 0xfa, 0xfc, 0x6c, 0x41, 0x3a, 0x40, 0x00, 0x00, 0x99, 0x24, 0x6d, 0x41,
+        0x68, 0xd8, 0x6f, 0x41, 0x3c, 0x40, 0x00, 0x00, 0x06, 0x00, 0x70, 0x41, 0xd6, 0xb3, 0x75, 0x41,
+        0x3a, 0x4c, 0x00, 0x00, 0x06, 0x00, 0x70, 0x41, 0xd6, 0xb3, 0x75, 0x41, 0x3e, 0x4c, 0x00, 0x00,
+        0x06, 0x00, 0x70, 0x41, 0xa2, 0x47, 0x88, 0x41, 0x2b, 0x40, 0x01, 0x00, 0x06, 0x00, 0x70, 0x41,
+        0xa2, 0x47, 0x88, 0x41, 0x32, 0x40, 0x01, 0x00, 0xe2, 0xb6, 0x75, 0x41, 0x8d, 0x21, 0x7b, 0x41,
+        0x37, 0x40, 0x00, 0x00, 0xbd, 0x6d, 0x7b, 0x41, 0x8d, 0x21, 0x7e, 0x41, 0x3a, 0x40, 0x00, 0x00,
+        0x2b, 0x49, 0x7e, 0x41, 0x7d, 0x7e, 0x80, 0x41, 0x3c, 0x40, 0x00, 0x00, 0x4d, 0x92, 0x80, 0x41,
+        0x34, 0x6c, 0x83, 0x41, 0x3e, 0x4c, 0x00, 0x00, 0xba, 0x6d, 0x83, 0x41, 0xeb, 0xd9, 0x84, 0x41,
+        0x37, 0x40, 0x00, 0x00, 0x28, 0x49, 0x86, 0x41, 0x59, 0xb5, 0x87, 0x41, 0x3a, 0x40, 0x00, 0x00,
+        0x96, 0x24, 0x89, 0x41, 0xa2, 0x47, 0x91, 0x41, 0x41, 0x40, 0x00, 0x00, 0x96, 0x24, 0x89, 0x41,
+        0x35, 0x6c, 0x99, 0x41, 0x22, 0x40, 0x01, 0x00, 0x96, 0x24, 0x89, 0x41, 0x35, 0x6c, 0x99, 0x41,
+        0x29, 0x40, 0x01, 0x00, 0xdf, 0xb6, 0x91, 0x41, 0xec, 0xd9, 0x99, 0x41, 0x3a, 0x40, 0x00, 0x00,
+        0x29, 0x49, 0x9a, 0x41, 0x10, 0xa3, 0x9b, 0x41, 0x3a, 0x40, 0x00, 0x00, 0x29, 0x49, 0x9a, 0x41,
+        0x10, 0xa3, 0x9b, 0x41, 0x3f, 0x40, 0x00, 0x00, 0x29, 0x49, 0x9a, 0x41, 0xc8, 0x90, 0xaa, 0x41,
+        0x22, 0x40, 0x01, 0x00, 0x29, 0x49, 0x9a, 0x41, 0xc8, 0x90, 0xaa, 0x41, 0x29, 0x40, 0x01, 0x00,
+        0xe0, 0xb6, 0x9b, 0x41, 0xc7, 0x10, 0x9d, 0x41, 0x3e, 0x40, 0x00, 0x00, 0x96, 0x24, 0x9d, 0x41,
+        0xc7, 0x90, 0xa2, 0x41, 0x41, 0x40, 0x00, 0x00, 0x72, 0xdb, 0xa2, 0x41, 0xa3, 0x47, 0xa8, 0x41,
+        0x3a, 0x40, 0x00, 0x00, 0x4e, 0x92, 0xa8, 0x41, 0x35, 0xec, 0xa9, 0x41, 0x3f, 0x40, 0x00, 0x00,
+        0x04, 0x00, 0xaa, 0x41, 0xec, 0x59, 0xab, 0x41, 0x3e, 0x40, 0x00, 0x00, 0xbb, 0x6d, 0xab, 0x41,
+        0xa3, 0x47, 0xae, 0x41, 0x38, 0x4c, 0x00, 0x00, 0xbb, 0x6d, 0xab, 0x41, 0xa3, 0x47, 0xae, 0x41,
+        0x3c, 0x4c, 0x00, 0x00, 0xbb, 0x6d, 0xab, 0x41, 0x5a, 0xb5, 0xbb, 0x41, 0x29, 0x40, 0x01, 0x00,
+        0xbb, 0x6d, 0xab, 0x41, 0x5a, 0xb5, 0xbb, 0x41, 0x30, 0x40, 0x01, 0x00, 0x29, 0x49, 0xae, 0x41,
+        0x7f, 0xfe, 0xb0, 0x41, 0x35, 0x40, 0x00, 0x00, 0x97, 0x24, 0xb1, 0x41, 0x7f, 0x7e, 0xb2, 0x41,
+        0x38, 0x40, 0x00, 0x00, 0x4e, 0x92, 0xb2, 0x41, 0x35, 0xec, 0xb3, 0x41, 0x3a, 0x40, 0x00, 0x00,
+        0x05, 0x00, 0xb4, 0x41, 0xec, 0xd9, 0xb6, 0x41, 0x3c, 0x4c, 0x00, 0x00, 0x73, 0xdb, 0xb6, 0x41,
+        0xc8, 0x90, 0xb9, 0x41, 0x35, 0x40, 0x00, 0x00, 0xe0, 0xb6, 0xb9, 0x41, 0xc8, 0x10, 0xbb, 0x41,
+        0x38, 0x40, 0x00, 0x00, 0x97, 0x24, 0xbb, 0x41, 0x7f, 0x7e, 0xbc, 0x41, 0x3a, 0x40, 0x00, 0x00,
+        0x4e, 0x92, 0xbc, 0x41, 0x36, 0x6c, 0xbf, 0x41, 0x38, 0x4c, 0x00, 0x00, 0x4e, 0x92, 0xbc, 0x41,
+        0x36, 0x6c, 0xbf, 0x41, 0x3c, 0x4c, 0x00, 0x00, 0x4e, 0x92, 0xbc, 0x41, 0x11, 0x23, 0xca, 0x41,
+        0x29, 0x40, 0x01, 0x00, 0x4e, 0x92, 0xbc, 0x41, 0x11, 0x23, 0xca, 0x41, 0x30, 0x40, 0x01, 0x00,
+        0xbc, 0x6d, 0xbf, 0x41, 0x11, 0x23, 0xc2, 0x41, 0x35, 0x40, 0x00, 0x00, 0x2a, 0x49, 0xc2, 0x41,
+        0x11, 0xa3, 0xc3, 0x41, 0x38, 0x40, 0x00, 0x00, 0xe1, 0xb6, 0xc3, 0x41, 0xc8, 0x10, 0xc5, 0x41,
+        0x3a, 0x40, 0x00, 0x00, 0x97, 0x24, 0xc5, 0x41, 0x7f, 0xfe, 0xc7, 0x41, 0x3c, 0x4c, 0x00, 0x00,
+        0x05, 0x00, 0xc8, 0x41, 0x36, 0x6c, 0xc9, 0x41, 0x35, 0x40, 0x00, 0x00, 0x73, 0xdb, 0xca, 0x41,
+        0xa4, 0x47, 0xcc, 0x41, 0x38, 0x40, 0x00, 0x00, 0x73, 0xdb, 0xca, 0x41, 0xa4, 0x47, 0xcc, 0x41,
+        0x29, 0x40, 0x01, 0x00, 0x73, 0xdb, 0xca, 0x41, 0xa4, 0x47, 0xcc, 0x41, 0x30, 0x40, 0x01, 0x00,
+        0xe1, 0xb6, 0xcd, 0x41, 0xed, 0xd9, 0xd5, 0x41, 0x43, 0x50, 0x00, 0x00, 0xe1, 0xb6, 0xcd, 0x41,
+        0x12, 0x23, 0xd3, 0x41, 0x24, 0x50, 0x01, 0x00, 0xe1, 0xb6, 0xcd, 0x41, 0x12, 0x23, 0xd3, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0xbc, 0x6d, 0xd3, 0x41, 0xed, 0xd9, 0xd4, 0x41, 0x24, 0x50, 0x01, 0x00,
+        0xbc, 0x6d, 0xd3, 0x41, 0xed, 0xd9, 0xd4, 0x41, 0x2b, 0x50, 0x01, 0x00, 0x2a, 0x49, 0xd6, 0x41,
+        0x37, 0x6c, 0xde, 0x41, 0x3c, 0x50, 0x00, 0x00, 0x2a, 0x49, 0xd6, 0x41, 0x5b, 0xb5, 0xdb, 0x41,
+        0x24, 0x50, 0x01, 0x00, 0x2a, 0x49, 0xd6, 0x41, 0x5b, 0xb5, 0xdb, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x06, 0x00, 0xdc, 0x41, 0x37, 0x6c, 0xdd, 0x41, 0x24, 0x50, 0x01, 0x00, 0x06, 0x00, 0xdc, 0x41,
+        0x37, 0x6c, 0xdd, 0x41, 0x2b, 0x50, 0x01, 0x00, 0x74, 0xdb, 0xde, 0x41, 0x5b, 0x35, 0xe0, 0x41,
+        0x3c, 0x50, 0x00, 0x00, 0x74, 0xdb, 0xde, 0x41, 0x5b, 0x35, 0xe0, 0x41, 0x3f, 0x50, 0x00, 0x00,
+        0x74, 0xdb, 0xde, 0x41, 0xa4, 0x47, 0xe4, 0x41, 0x24, 0x50, 0x01, 0x00, 0x74, 0xdb, 0xde, 0x41,
+        0xa4, 0x47, 0xe4, 0x41, 0x2b, 0x50, 0x01, 0x00, 0x2a, 0x49, 0xe0, 0x41, 0x12, 0xa3, 0xe1, 0x41,
+        0x41, 0x50, 0x00, 0x00, 0xe1, 0xb6, 0xe1, 0x41, 0x12, 0x23, 0xe7, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x4f, 0x92, 0xe4, 0x41, 0x80, 0xfe, 0xe5, 0x41, 0x24, 0x50, 0x01, 0x00, 0x4f, 0x92, 0xe4, 0x41,
+        0x80, 0xfe, 0xe5, 0x41, 0x2b, 0x50, 0x01, 0x00, 0xbd, 0x6d, 0xe7, 0x41, 0xee, 0xd9, 0xec, 0x41,
+        0x3c, 0x50, 0x00, 0x00, 0xbd, 0x6d, 0xe7, 0x41, 0xee, 0xd9, 0xec, 0x41, 0x24, 0x50, 0x01, 0x00,
+        0xbd, 0x6d, 0xe7, 0x41, 0xee, 0xd9, 0xec, 0x41, 0x2b, 0x50, 0x01, 0x00, 0x99, 0x24, 0xed, 0x41,
+        0x80, 0x7e, 0xee, 0x41, 0x3f, 0x50, 0x00, 0x00, 0x99, 0x24, 0xed, 0x41, 0xc9, 0x90, 0xee, 0x41,
+        0x24, 0x50, 0x01, 0x00, 0x99, 0x24, 0xed, 0x41, 0xc9, 0x90, 0xee, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x4f, 0x92, 0xee, 0x41, 0x37, 0xec, 0xef, 0x41, 0x41, 0x50, 0x00, 0x00, 0x06, 0x00, 0xf0, 0x41,
+        0xee, 0xd9, 0xf2, 0x41, 0x3a, 0x60, 0x00, 0x00, 0x06, 0x00, 0xf0, 0x41, 0xee, 0xd9, 0xf2, 0x41,
+        0x3e, 0x60, 0x00, 0x00, 0x06, 0x00, 0xf0, 0x41, 0x37, 0x6c, 0xf5, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x06, 0x00, 0xf0, 0x41, 0x37, 0x6c, 0xf5, 0x41, 0x32, 0x50, 0x01, 0x00, 0x74, 0xdb, 0xf2, 0x41,
+        0xc9, 0x90, 0xf5, 0x41, 0x37, 0x50, 0x00, 0x00, 0xe2, 0xb6, 0xf5, 0x41, 0xca, 0x10, 0xf7, 0x41,
+        0x3a, 0x50, 0x00, 0x00, 0xe2, 0xb6, 0xf5, 0x41, 0x13, 0x23, 0xf7, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0xe2, 0xb6, 0xf5, 0x41, 0x13, 0x23, 0xf7, 0x41, 0x32, 0x50, 0x01, 0x00, 0x99, 0x24, 0xf7, 0x41,
+        0x80, 0x7e, 0xf8, 0x41, 0x3c, 0x50, 0x00, 0x00, 0x50, 0x92, 0xf8, 0x41, 0x37, 0x6c, 0xfb, 0x41,
+        0x3e, 0x60, 0x00, 0x00, 0x50, 0x92, 0xf8, 0x41, 0x81, 0xfe, 0xfd, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x50, 0x92, 0xf8, 0x41, 0x81, 0xfe, 0xfd, 0x41, 0x32, 0x50, 0x01, 0x00, 0xbd, 0x6d, 0xfb, 0x41,
+        0x13, 0x23, 0xfe, 0x41, 0x37, 0x50, 0x00, 0x00, 0x2b, 0x49, 0xfe, 0x41, 0x13, 0xa3, 0xff, 0x41,
+        0x3a, 0x50, 0x00, 0x00, 0x2b, 0x49, 0xfe, 0x41, 0x5c, 0xb5, 0xff, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x2b, 0x49, 0xfe, 0x41, 0x5c, 0xb5, 0xff, 0x41, 0x32, 0x50, 0x01, 0x00, 0xe2, 0xb6, 0xff, 0x41,
+        0x65, 0x88, 0x00, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x4d, 0x92, 0x00, 0x42, 0x40, 0xff, 0x01, 0x42,
+        0x3a, 0x60, 0x00, 0x00, 0x4d, 0x92, 0x00, 0x42, 0x40, 0xff, 0x01, 0x42, 0x3e, 0x60, 0x00, 0x00,
+        0x4d, 0x92, 0x00, 0x42, 0x65, 0x48, 0x03, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x4d, 0x92, 0x00, 0x42,
+        0x65, 0x48, 0x03, 0x42, 0x32, 0x50, 0x01, 0x00, 0x03, 0x00, 0x02, 0x42, 0xae, 0x5a, 0x03, 0x42,
+        0x37, 0x50, 0x00, 0x00, 0xba, 0x6d, 0x03, 0x42, 0xae, 0x1a, 0x04, 0x42, 0x3a, 0x50, 0x00, 0x00,
+        0xba, 0x6d, 0x03, 0x42, 0xd3, 0x23, 0x04, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xba, 0x6d, 0x03, 0x42,
+        0xd3, 0x23, 0x04, 0x42, 0x32, 0x50, 0x01, 0x00, 0x96, 0x24, 0x04, 0x42, 0x8a, 0xd1, 0x04, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x71, 0xdb, 0x04, 0x42, 0x65, 0x48, 0x06, 0x42, 0x3e, 0x60, 0x00, 0x00,
+        0x71, 0xdb, 0x04, 0x42, 0x8a, 0x91, 0x07, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x71, 0xdb, 0x04, 0x42,
+        0x8a, 0x91, 0x07, 0x42, 0x32, 0x50, 0x01, 0x00, 0x28, 0x49, 0x06, 0x42, 0x40, 0xff, 0x06, 0x42,
+        0x37, 0x50, 0x00, 0x00, 0xdf, 0xb6, 0x07, 0x42, 0xf7, 0x6c, 0x08, 0x42, 0x3a, 0x50, 0x00, 0x00,
+        0xdf, 0xb6, 0x07, 0x42, 0xf7, 0x6c, 0x08, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xdf, 0xb6, 0x07, 0x42,
+        0xf7, 0x6c, 0x08, 0x42, 0x32, 0x50, 0x01, 0x00, 0x96, 0x24, 0x09, 0x42, 0x1c, 0x36, 0x0d, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x96, 0x24, 0x09, 0x42, 0xae, 0xda, 0x0b, 0x42, 0x22, 0x50, 0x01, 0x00,
+        0x96, 0x24, 0x09, 0x42, 0xae, 0xda, 0x0b, 0x42, 0x29, 0x50, 0x01, 0x00, 0x04, 0x00, 0x0c, 0x42,
+        0x1c, 0xb6, 0x0c, 0x42, 0x22, 0x50, 0x01, 0x00, 0x04, 0x00, 0x0c, 0x42, 0x1c, 0xb6, 0x0c, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0xbb, 0x6d, 0x0d, 0x42, 0x41, 0x7f, 0x11, 0x42, 0x3a, 0x50, 0x00, 0x00,
+        0xbb, 0x6d, 0x0d, 0x42, 0xd3, 0x23, 0x10, 0x42, 0x22, 0x50, 0x01, 0x00, 0xbb, 0x6d, 0x0d, 0x42,
+        0xd3, 0x23, 0x10, 0x42, 0x29, 0x50, 0x01, 0x00, 0x28, 0x49, 0x10, 0x42, 0x41, 0xff, 0x10, 0x42,
+        0x22, 0x50, 0x01, 0x00, 0x28, 0x49, 0x10, 0x42, 0x41, 0xff, 0x10, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0xdf, 0xb6, 0x11, 0x42, 0xd3, 0x63, 0x12, 0x42, 0x3a, 0x50, 0x00, 0x00, 0xdf, 0xb6, 0x11, 0x42,
+        0xd3, 0x63, 0x12, 0x42, 0x3f, 0x50, 0x00, 0x00, 0xdf, 0xb6, 0x11, 0x42, 0xf8, 0x6c, 0x14, 0x42,
+        0x22, 0x50, 0x01, 0x00, 0xdf, 0xb6, 0x11, 0x42, 0xf8, 0x6c, 0x14, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0xbb, 0x6d, 0x12, 0x42, 0xaf, 0x1a, 0x13, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x96, 0x24, 0x13, 0x42,
+        0xaf, 0xda, 0x15, 0x42, 0x41, 0x50, 0x00, 0x00, 0x4d, 0x92, 0x14, 0x42, 0x65, 0x48, 0x15, 0x42,
+        0x22, 0x50, 0x01, 0x00, 0x4d, 0x92, 0x14, 0x42, 0x65, 0x48, 0x15, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x04, 0x00, 0x16, 0x42, 0x1c, 0xb6, 0x18, 0x42, 0x3a, 0x50, 0x00, 0x00, 0x04, 0x00, 0x16, 0x42,
+        0x1c, 0xb6, 0x18, 0x42, 0x22, 0x50, 0x01, 0x00, 0x04, 0x00, 0x16, 0x42, 0x1c, 0xb6, 0x18, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x72, 0xdb, 0x18, 0x42, 0x66, 0x88, 0x19, 0x42, 0x3f, 0x50, 0x00, 0x00,
+        0x72, 0xdb, 0x18, 0x42, 0x8a, 0x91, 0x19, 0x42, 0x22, 0x50, 0x01, 0x00, 0x72, 0xdb, 0x18, 0x42,
+        0x8a, 0x91, 0x19, 0x42, 0x29, 0x50, 0x01, 0x00, 0x4d, 0x92, 0x19, 0x42, 0x41, 0x3f, 0x1a, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x29, 0x49, 0x1a, 0x42, 0x1c, 0xb6, 0x1b, 0x42, 0x38, 0x60, 0x00, 0x00,
+        0x29, 0x49, 0x1a, 0x42, 0x1c, 0xb6, 0x1b, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x29, 0x49, 0x1a, 0x42,
+        0x41, 0xff, 0x1c, 0x42, 0x24, 0x50, 0x01, 0x00, 0x29, 0x49, 0x1a, 0x42, 0x41, 0xff, 0x1c, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0xe0, 0xb6, 0x1b, 0x42, 0x8a, 0x11, 0x1d, 0x42, 0x37, 0x50, 0x00, 0x00,
+        0x96, 0x24, 0x1d, 0x42, 0x8a, 0xd1, 0x1d, 0x42, 0x38, 0x50, 0x00, 0x00, 0x96, 0x24, 0x1d, 0x42,
+        0xaf, 0xda, 0x1d, 0x42, 0x24, 0x50, 0x01, 0x00, 0x96, 0x24, 0x1d, 0x42, 0xaf, 0xda, 0x1d, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x72, 0xdb, 0x1d, 0x42, 0x66, 0x88, 0x1e, 0x42, 0x3a, 0x50, 0x00, 0x00,
+        0x4d, 0x92, 0x1e, 0x42, 0x41, 0xff, 0x1f, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x4d, 0x92, 0x1e, 0x42,
+        0x66, 0x48, 0x21, 0x42, 0x24, 0x50, 0x01, 0x00, 0x4d, 0x92, 0x1e, 0x42, 0x66, 0x48, 0x21, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x04, 0x00, 0x20, 0x42, 0xaf, 0x5a, 0x21, 0x42, 0x37, 0x50, 0x00, 0x00,
+        0xbb, 0x6d, 0x21, 0x42, 0xaf, 0x1a, 0x22, 0x42, 0x38, 0x50, 0x00, 0x00, 0xbb, 0x6d, 0x21, 0x42,
+        0xd3, 0x23, 0x22, 0x42, 0x24, 0x50, 0x01, 0x00, 0xbb, 0x6d, 0x21, 0x42, 0xd3, 0x23, 0x22, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x97, 0x24, 0x22, 0x42, 0x8a, 0xd1, 0x22, 0x42, 0x3a, 0x50, 0x00, 0x00,
+        0x72, 0xdb, 0x22, 0x42, 0x66, 0x48, 0x24, 0x42, 0x38, 0x60, 0x00, 0x00, 0x72, 0xdb, 0x22, 0x42,
+        0x66, 0x48, 0x24, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x72, 0xdb, 0x22, 0x42, 0x8a, 0x91, 0x25, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0x72, 0xdb, 0x22, 0x42, 0x8a, 0x91, 0x25, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x29, 0x49, 0x24, 0x42, 0xd4, 0xa3, 0x25, 0x42, 0x37, 0x50, 0x00, 0x00, 0xe0, 0xb6, 0x25, 0x42,
+        0xd4, 0x63, 0x26, 0x42, 0x38, 0x50, 0x00, 0x00, 0xe0, 0xb6, 0x25, 0x42, 0xf8, 0x6c, 0x26, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0xe0, 0xb6, 0x25, 0x42, 0xf8, 0x6c, 0x26, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0xbb, 0x6d, 0x26, 0x42, 0xaf, 0x1a, 0x27, 0x42, 0x3a, 0x50, 0x00, 0x00, 0x97, 0x24, 0x27, 0x42,
+        0x8b, 0x91, 0x28, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x97, 0x24, 0x27, 0x42, 0xaf, 0xda, 0x29, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0x97, 0x24, 0x27, 0x42, 0xaf, 0xda, 0x29, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x4e, 0x92, 0x28, 0x42, 0x66, 0x48, 0x29, 0x42, 0x37, 0x50, 0x00, 0x00, 0x04, 0x00, 0x2a, 0x42,
+        0x1d, 0xb6, 0x2a, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x04, 0x00, 0x2a, 0x42, 0x1d, 0xb6, 0x2a, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0x04, 0x00, 0x2a, 0x42, 0x1d, 0xb6, 0x2a, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0xbb, 0x6d, 0x2b, 0x42, 0x42, 0x7f, 0x2f, 0x42, 0x43, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0x2b, 0x42,
+        0xaf, 0x1a, 0x2c, 0x42, 0x24, 0x60, 0x01, 0x00, 0x97, 0x24, 0x2c, 0x42, 0x8b, 0xd1, 0x2c, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x72, 0xdb, 0x2c, 0x42, 0x66, 0x88, 0x2d, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0x4e, 0x92, 0x2d, 0x42, 0x42, 0x3f, 0x2e, 0x42, 0x33, 0x60, 0x01, 0x00, 0x29, 0x49, 0x2e, 0x42,
+        0xd4, 0xa3, 0x2f, 0x42, 0x37, 0x60, 0x01, 0x00, 0xe0, 0xb6, 0x2f, 0x42, 0x66, 0xc8, 0x33, 0x42,
+        0x3c, 0x60, 0x00, 0x00, 0xe0, 0xb6, 0x2f, 0x42, 0xd4, 0x63, 0x30, 0x42, 0x24, 0x60, 0x01, 0x00,
+        0xbb, 0x6d, 0x30, 0x42, 0xaf, 0x1a, 0x31, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x97, 0x24, 0x31, 0x42,
+        0x8b, 0xd1, 0x31, 0x42, 0x30, 0x60, 0x01, 0x00, 0x72, 0xdb, 0x31, 0x42, 0x66, 0x88, 0x32, 0x42,
+        0x33, 0x60, 0x01, 0x00, 0x4e, 0x92, 0x32, 0x42, 0xf9, 0xec, 0x33, 0x42, 0x37, 0x60, 0x01, 0x00,
+        0x05, 0x00, 0x34, 0x42, 0x1d, 0xb6, 0x34, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x05, 0x00, 0x34, 0x42,
+        0x1d, 0xb6, 0x34, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x05, 0x00, 0x34, 0x42, 0xf9, 0xac, 0x34, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0xe0, 0xb6, 0x34, 0x42, 0xf9, 0x6c, 0x35, 0x42, 0x41, 0x60, 0x00, 0x00,
+        0xe0, 0xb6, 0x34, 0x42, 0xd4, 0x63, 0x35, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xbc, 0x6d, 0x35, 0x42,
+        0xd4, 0x23, 0x38, 0x42, 0x43, 0x60, 0x00, 0x00, 0xbc, 0x6d, 0x35, 0x42, 0xaf, 0x1a, 0x36, 0x42,
+        0x30, 0x60, 0x01, 0x00, 0x97, 0x24, 0x36, 0x42, 0x8b, 0xd1, 0x36, 0x42, 0x33, 0x60, 0x01, 0x00,
+        0x73, 0xdb, 0x36, 0x42, 0x1d, 0x36, 0x38, 0x42, 0x37, 0x60, 0x01, 0x00, 0x29, 0x49, 0x38, 0x42,
+        0xd4, 0x23, 0x3b, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x29, 0x49, 0x38, 0x42, 0x1d, 0xf6, 0x38, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x05, 0x00, 0x39, 0x42, 0xf9, 0xac, 0x39, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0xe0, 0xb6, 0x39, 0x42, 0xd4, 0x63, 0x3a, 0x42, 0x30, 0x60, 0x01, 0x00, 0xbc, 0x6d, 0x3a, 0x42,
+        0xb0, 0x1a, 0x3b, 0x42, 0x33, 0x60, 0x01, 0x00, 0x97, 0x24, 0x3b, 0x42, 0xb0, 0xda, 0x3b, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0x97, 0x24, 0x3b, 0x42, 0x42, 0x7f, 0x3c, 0x42, 0x37, 0x60, 0x01, 0x00,
+        0x73, 0xdb, 0x3b, 0x42, 0x66, 0x88, 0x3c, 0x42, 0x41, 0x60, 0x00, 0x00, 0x4e, 0x92, 0x3c, 0x42,
+        0xf9, 0x6c, 0x3f, 0x42, 0x3e, 0x60, 0x00, 0x00, 0x4e, 0x92, 0x3c, 0x42, 0x42, 0x3f, 0x3d, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x2a, 0x49, 0x3d, 0x42, 0x1d, 0xf6, 0x3d, 0x42, 0x32, 0x60, 0x01, 0x00,
+        0x05, 0x00, 0x3e, 0x42, 0xf9, 0xac, 0x3e, 0x42, 0x37, 0x60, 0x01, 0x00, 0xe0, 0xb6, 0x3e, 0x42,
+        0xd4, 0x63, 0x3f, 0x42, 0x32, 0x60, 0x01, 0x00, 0xbc, 0x6d, 0x3f, 0x42, 0xd4, 0x23, 0x40, 0x42,
+        0x3a, 0x60, 0x00, 0x00, 0xbc, 0x6d, 0x3f, 0x42, 0xb0, 0x1a, 0x40, 0x42, 0x37, 0x60, 0x01, 0x00,
+        0x97, 0x24, 0x40, 0x42, 0x8b, 0xd1, 0x40, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x97, 0x24, 0x40, 0x42,
+        0x8b, 0xd1, 0x40, 0x42, 0x32, 0x60, 0x01, 0x00, 0x73, 0xdb, 0x40, 0x42, 0x1e, 0xb6, 0x43, 0x42,
+        0x3e, 0x60, 0x00, 0x00, 0x73, 0xdb, 0x40, 0x42, 0x67, 0x88, 0x41, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x4e, 0x92, 0x41, 0x42, 0x42, 0x3f, 0x42, 0x42, 0x32, 0x60, 0x01, 0x00, 0x2a, 0x49, 0x42, 0x42,
+        0x1d, 0xf6, 0x42, 0x42, 0x37, 0x60, 0x01, 0x00, 0x05, 0x00, 0x43, 0x42, 0xf9, 0xac, 0x43, 0x42,
+        0x32, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x43, 0x42, 0xf9, 0x6c, 0x44, 0x42, 0x3a, 0x60, 0x00, 0x00,
+        0xe1, 0xb6, 0x43, 0x42, 0xd4, 0x63, 0x44, 0x42, 0x37, 0x60, 0x01, 0x00, 0xbc, 0x6d, 0x44, 0x42,
+        0xb0, 0x1a, 0x45, 0x42, 0x3c, 0x60, 0x00, 0x00, 0xbc, 0x6d, 0x44, 0x42, 0xb0, 0x1a, 0x45, 0x42,
+        0x32, 0x60, 0x01, 0x00, 0x97, 0x24, 0x45, 0x42, 0x42, 0xff, 0x47, 0x42, 0x3e, 0x60, 0x00, 0x00,
+        0x97, 0x24, 0x45, 0x42, 0x8b, 0xd1, 0x45, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x73, 0xdb, 0x45, 0x42,
+        0x67, 0x88, 0x46, 0x42, 0x32, 0x60, 0x01, 0x00, 0x4e, 0x92, 0x46, 0x42, 0x42, 0x3f, 0x47, 0x42,
+        0x37, 0x60, 0x01, 0x00, 0x2a, 0x49, 0x47, 0x42, 0x1e, 0xf6, 0x47, 0x42, 0x32, 0x60, 0x01, 0x00,
+        0x05, 0x00, 0x48, 0x42, 0x1e, 0xb6, 0x48, 0x42, 0x3a, 0x60, 0x00, 0x00, 0x05, 0x00, 0x48, 0x42,
+        0xf9, 0xac, 0x48, 0x42, 0x37, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x48, 0x42, 0xd5, 0x63, 0x49, 0x42,
+        0x3c, 0x60, 0x00, 0x00, 0xe1, 0xb6, 0x48, 0x42, 0xd5, 0x63, 0x49, 0x42, 0x32, 0x60, 0x01, 0x00,
+        0xbc, 0x6d, 0x49, 0x42, 0xb0, 0xda, 0x4a, 0x42, 0x3e, 0x60, 0x00, 0x00, 0xbc, 0x6d, 0x49, 0x42,
+        0xb0, 0x1a, 0x4a, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x98, 0x24, 0x4a, 0x42, 0x8b, 0xd1, 0x4a, 0x42,
+        0x32, 0x60, 0x01, 0x00, 0x73, 0xdb, 0x4a, 0x42, 0x8b, 0x91, 0x4b, 0x42, 0x3a, 0x60, 0x00, 0x00,
+        0x73, 0xdb, 0x4a, 0x42, 0x67, 0x88, 0x4b, 0x42, 0x37, 0x60, 0x01, 0x00, 0x4e, 0x92, 0x4b, 0x42,
+        0x42, 0x3f, 0x4c, 0x42, 0x32, 0x60, 0x01, 0x00, 0x2a, 0x49, 0x4c, 0x42, 0x42, 0xff, 0x4c, 0x42,
+        0x3e, 0x60, 0x00, 0x00, 0x2a, 0x49, 0x4c, 0x42, 0x1e, 0xf6, 0x4c, 0x42, 0x37, 0x60, 0x01, 0x00,
+        0x05, 0x00, 0x4d, 0x42, 0xf9, 0xac, 0x4d, 0x42, 0x32, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x4d, 0x42,
+        0x67, 0xc8, 0x51, 0x42, 0x41, 0x60, 0x00, 0x00, 0xe1, 0xb6, 0x4d, 0x42, 0xd5, 0x63, 0x4e, 0x42,
+        0x2e, 0x60, 0x01, 0x00, 0xbc, 0x6d, 0x4e, 0x42, 0xb0, 0x1a, 0x4f, 0x42, 0x35, 0x60, 0x01, 0x00,
+        0x98, 0x24, 0x4f, 0x42, 0x8c, 0xd1, 0x4f, 0x42, 0x3a, 0x60, 0x01, 0x00, 0x73, 0xdb, 0x4f, 0x42,
+        0x67, 0x88, 0x50, 0x42, 0x35, 0x60, 0x01, 0x00, 0x4f, 0x92, 0x50, 0x42, 0x42, 0x3f, 0x51, 0x42,
+        0x3a, 0x60, 0x01, 0x00, 0x2a, 0x49, 0x51, 0x42, 0x1e, 0xf6, 0x51, 0x42, 0x35, 0x60, 0x01, 0x00,
+        0x06, 0x00, 0x52, 0x42, 0xf9, 0xac, 0x52, 0x42, 0x2e, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x52, 0x42,
+        0xd5, 0x63, 0x53, 0x42, 0x35, 0x60, 0x01, 0x00, 0xbc, 0x6d, 0x53, 0x42, 0xb0, 0x1a, 0x54, 0x42,
+        0x3a, 0x60, 0x01, 0x00, 0x98, 0x24, 0x54, 0x42, 0x8c, 0xd1, 0x54, 0x42, 0x35, 0x60, 0x01, 0x00,
+        0x73, 0xdb, 0x54, 0x42, 0x67, 0x88, 0x55, 0x42, 0x3a, 0x60, 0x01, 0x00, 0x4f, 0x92, 0x55, 0x42,
+        0x43, 0x3f, 0x56, 0x42, 0x35, 0x60, 0x01, 0x00, 0x2a, 0x49, 0x56, 0x42, 0x43, 0xff, 0x58, 0x42,
+        0x3e, 0x60, 0x00, 0x00, 0x2a, 0x49, 0x56, 0x42, 0x1e, 0xf6, 0x56, 0x42, 0x2e, 0x60, 0x01, 0x00,
+        0x06, 0x00, 0x57, 0x42, 0xf9, 0xac, 0x57, 0x42, 0x35, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x57, 0x42,
+        0xd5, 0x63, 0x58, 0x42, 0x3a, 0x60, 0x01, 0x00, 0xbd, 0x6d, 0x58, 0x42, 0xb0, 0x1a, 0x59, 0x42,
+        0x35, 0x60, 0x01, 0x00, 0x98, 0x24, 0x59, 0x42, 0x43, 0x7f, 0x5a, 0x42, 0x3f, 0x60, 0x00, 0x00,
+        0x98, 0x24, 0x59, 0x42, 0x8c, 0xd1, 0x59, 0x42, 0x3a, 0x60, 0x01, 0x00, 0x73, 0xdb, 0x59, 0x42,
+        0x67, 0x88, 0x5a, 0x42, 0x35, 0x60, 0x01, 0x00, 0x4f, 0x92, 0x5a, 0x42, 0xd5, 0xa3, 0x5e, 0x42,
+        0x3e, 0x60, 0x00, 0x00, 0x4f, 0x92, 0x5a, 0x42, 0x43, 0x3f, 0x5b, 0x42, 0x2e, 0x60, 0x01, 0x00,
+        0x2a, 0x49, 0x5b, 0x42, 0x1e, 0xf6, 0x5b, 0x42, 0x35, 0x60, 0x01, 0x00, 0x06, 0x00, 0x5c, 0x42,
+        0xfa, 0xac, 0x5c, 0x42, 0x3a, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x5c, 0x42, 0xd5, 0x63, 0x5d, 0x42,
+        0x35, 0x60, 0x01, 0x00, 0xbd, 0x6d, 0x5d, 0x42, 0xb0, 0x1a, 0x5e, 0x42, 0x3a, 0x60, 0x01, 0x00,
+        0x98, 0x24, 0x5e, 0x42, 0x8c, 0xd1, 0x5e, 0x42, 0x35, 0x60, 0x01, 0x00, 0x74, 0xdb, 0x5e, 0x42,
+        0x67, 0x48, 0x60, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x74, 0xdb, 0x5e, 0x42, 0x67, 0x88, 0x5f, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x4f, 0x92, 0x5f, 0x42, 0x43, 0x3f, 0x60, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x2a, 0x49, 0x60, 0x42, 0xd5, 0xa3, 0x61, 0x42, 0x37, 0x60, 0x00, 0x00, 0x2a, 0x49, 0x60, 0x42,
+        0x1e, 0xf6, 0x60, 0x42, 0x30, 0x60, 0x01, 0x00, 0x06, 0x00, 0x61, 0x42, 0xfa, 0xac, 0x61, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x61, 0x42, 0xfa, 0x6c, 0x62, 0x42, 0x38, 0x60, 0x00, 0x00,
+        0xe1, 0xb6, 0x61, 0x42, 0xd5, 0x63, 0x62, 0x42, 0x30, 0x60, 0x01, 0x00, 0xbd, 0x6d, 0x62, 0x42,
+        0xb1, 0x1a, 0x63, 0x42, 0x3a, 0x60, 0x00, 0x00, 0xbd, 0x6d, 0x62, 0x42, 0xb1, 0x1a, 0x63, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x98, 0x24, 0x63, 0x42, 0x8c, 0x91, 0x64, 0x42, 0x3c, 0x60, 0x00, 0x00,
+        0x98, 0x24, 0x63, 0x42, 0x8c, 0xd1, 0x63, 0x42, 0x24, 0x60, 0x01, 0x00, 0x74, 0xdb, 0x63, 0x42,
+        0x68, 0x88, 0x64, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x4f, 0x92, 0x64, 0x42, 0xfa, 0xec, 0x65, 0x42,
+        0x37, 0x60, 0x00, 0x00, 0x4f, 0x92, 0x64, 0x42, 0x43, 0x3f, 0x65, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0x2b, 0x49, 0x65, 0x42, 0x1e, 0xf6, 0x65, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x06, 0x00, 0x66, 0x42,
+        0x1e, 0xb6, 0x66, 0x42, 0x38, 0x60, 0x00, 0x00, 0x06, 0x00, 0x66, 0x42, 0xfa, 0xac, 0x66, 0x42,
+        0x30, 0x60, 0x01, 0x00, 0xe1, 0xb6, 0x66, 0x42, 0xd5, 0x63, 0x67, 0x42, 0x3a, 0x60, 0x00, 0x00,
+        0xe1, 0xb6, 0x66, 0x42, 0xd5, 0x63, 0x67, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xbd, 0x6d, 0x67, 0x42,
+        0xb1, 0xda, 0x68, 0x42, 0x3c, 0x60, 0x00, 0x00, 0xbd, 0x6d, 0x67, 0x42, 0xb1, 0x1a, 0x68, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x98, 0x24, 0x68, 0x42, 0x8c, 0xd1, 0x68, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x74, 0xdb, 0x68, 0x42, 0x1f, 0x36, 0x6a, 0x42, 0x37, 0x60, 0x00, 0x00, 0x74, 0xdb, 0x68, 0x42,
+        0x68, 0x88, 0x69, 0x42, 0x30, 0x60, 0x01, 0x00, 0x4f, 0x92, 0x69, 0x42, 0x43, 0x3f, 0x6a, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x2b, 0x49, 0x6a, 0x42, 0x43, 0xff, 0x6a, 0x42, 0x38, 0x60, 0x00, 0x00,
+        0x2b, 0x49, 0x6a, 0x42, 0x1f, 0xf6, 0x6a, 0x42, 0x30, 0x60, 0x01, 0x00, 0x06, 0x00, 0x6b, 0x42,
+        0xfa, 0xac, 0x6b, 0x42, 0x3a, 0x60, 0x00, 0x00, 0x06, 0x00, 0x6b, 0x42, 0xfa, 0xac, 0x6b, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0xe2, 0xb6, 0x6b, 0x42, 0x8c, 0x11, 0x6d, 0x42, 0x37, 0x60, 0x00, 0x00,
+        0xe2, 0xb6, 0x6b, 0x42, 0x8c, 0x11, 0x6d, 0x42, 0x3c, 0x60, 0x00, 0x00, 0xe2, 0xb6, 0x6b, 0x42,
+        0x8c, 0x11, 0x6d, 0x42, 0x24, 0x60, 0x01, 0x00, 0xe2, 0xb6, 0x6b, 0x42, 0x8c, 0x11, 0x6d, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x99, 0x24, 0x6d, 0x42, 0x43, 0x7f, 0x6e, 0x42, 0x37, 0x51, 0x00, 0x00,
+        0x99, 0x24, 0x6d, 0x42, 0x43, 0x7f, 0x6e, 0x42, 0x3c, 0x51, 0x00, 0x00, 0x99, 0x24, 0x6d, 0x42,
+        0x43, 0x7f, 0x6e, 0x42, 0x24, 0x51, 0x01, 0x00, 0x99, 0x24, 0x6d, 0x42, 0x43, 0x7f, 0x6e, 0x42,
+        0x2b, 0x51, 0x01, 0x00, 0x4f, 0x92, 0x6e, 0x42, 0x68, 0x48, 0x6f, 0x42, 0x37, 0x41, 0x00, 0x00,
+        0x4f, 0x92, 0x6e, 0x42, 0x68, 0x48, 0x6f, 0x42, 0x3c, 0x41, 0x00, 0x00, 0x4f, 0x92, 0x6e, 0x42,
+        0x68, 0x48, 0x6f, 0x42, 0x24, 0x41, 0x01, 0x00, 0x4f, 0x92, 0x6e, 0x42, 0x68, 0x48, 0x6f, 0x42,
+        0x2b, 0x41, 0x01, 0x00, 0x06, 0x00, 0x70, 0x42, 0xfa, 0x6c, 0x71, 0x42, 0x48, 0x31, 0x00, 0x00,
+        0x06, 0x00, 0x70, 0x42, 0x1f, 0xb6, 0x72, 0x42, 0x2c, 0x31, 0x01, 0x00, 0x06, 0x00, 0x70, 0x42,
+        0x1f, 0xb6, 0x72, 0x42, 0x33, 0x31, 0x01, 0x00, 0xbd, 0x6d, 0x71, 0x42, 0x68, 0xc8, 0x72, 0x42,
+        0x3f, 0x31, 0x00, 0x00, 0x74, 0xdb, 0x72, 0x42, 0x8c, 0x91, 0x73, 0x42, 0x44, 0x31, 0x00, 0x00,
+        0x74, 0xdb, 0x72, 0x42, 0x8c, 0x91, 0x73, 0x42, 0x2c, 0x31, 0x01, 0x00, 0x74, 0xdb, 0x72, 0x42,
+        0x8c, 0x91, 0x73, 0x42, 0x33, 0x31, 0x01, 0x00, 0x50, 0x92, 0x73, 0x42, 0x43, 0x3f, 0x74, 0x42,
+        0x46, 0x31, 0x00, 0x00, 0x2b, 0x49, 0x74, 0x42, 0x1f, 0xb6, 0x75, 0x42, 0x48, 0x31, 0x00, 0x00,
+        0x2b, 0x49, 0x74, 0x42, 0x43, 0xff, 0x76, 0x42, 0x2c, 0x31, 0x01, 0x00, 0x2b, 0x49, 0x74, 0x42,
+        0x43, 0xff, 0x76, 0x42, 0x33, 0x31, 0x01, 0x00, 0xe2, 0xb6, 0x75, 0x42, 0x8d, 0x11, 0x77, 0x42,
+        0x3f, 0x31, 0x00, 0x00, 0x99, 0x24, 0x77, 0x42, 0xb1, 0xda, 0x77, 0x42, 0x44, 0x31, 0x00, 0x00,
+        0x99, 0x24, 0x77, 0x42, 0xb1, 0xda, 0x77, 0x42, 0x2c, 0x31, 0x01, 0x00, 0x99, 0x24, 0x77, 0x42,
+        0xb1, 0xda, 0x77, 0x42, 0x33, 0x31, 0x01, 0x00, 0x74, 0xdb, 0x77, 0x42, 0x68, 0x88, 0x78, 0x42,
+        0x48, 0x31, 0x00, 0x00, 0x50, 0x92, 0x78, 0x42, 0x44, 0xff, 0x79, 0x42, 0x46, 0x31, 0x00, 0x00,
+        0x50, 0x92, 0x78, 0x42, 0x68, 0x48, 0x7b, 0x42, 0x27, 0x31, 0x01, 0x00, 0x50, 0x92, 0x78, 0x42,
+        0x68, 0x48, 0x7b, 0x42, 0x2e, 0x31, 0x01, 0x00, 0x07, 0x00, 0x7a, 0x42, 0xb1, 0x5a, 0x7b, 0x42,
+        0x3f, 0x31, 0x00, 0x00, 0xbd, 0x6d, 0x7b, 0x42, 0xd6, 0x23, 0x7c, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0xbd, 0x6d, 0x7b, 0x42, 0xd6, 0x23, 0x7c, 0x42, 0x27, 0x31, 0x01, 0x00, 0xbd, 0x6d, 0x7b, 0x42,
+        0xd6, 0x23, 0x7c, 0x42, 0x2e, 0x31, 0x01, 0x00, 0x99, 0x24, 0x7c, 0x42, 0x8d, 0xd1, 0x7c, 0x42,
+        0x44, 0x31, 0x00, 0x00, 0x74, 0xdb, 0x7c, 0x42, 0x68, 0x48, 0x7e, 0x42, 0x46, 0x31, 0x00, 0x00,
+        0x74, 0xdb, 0x7c, 0x42, 0x8d, 0x91, 0x7f, 0x42, 0x27, 0x31, 0x01, 0x00, 0x74, 0xdb, 0x7c, 0x42,
+        0x8d, 0x91, 0x7f, 0x42, 0x2e, 0x31, 0x01, 0x00, 0x2b, 0x49, 0x7e, 0x42, 0xd6, 0xa3, 0x7f, 0x42,
+        0x3f, 0x31, 0x00, 0x00, 0xe2, 0xb6, 0x7f, 0x42, 0x7d, 0x36, 0x80, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0xe2, 0xb6, 0x7f, 0x42, 0x7d, 0x36, 0x80, 0x42, 0x27, 0x31, 0x01, 0x00, 0xe2, 0xb6, 0x7f, 0x42,
+        0x7d, 0x36, 0x80, 0x42, 0x2e, 0x31, 0x01, 0x00, 0xdf, 0x36, 0x80, 0x42, 0x59, 0x8d, 0x80, 0x42,
+        0x46, 0x31, 0x00, 0x00, 0x4d, 0x92, 0x80, 0x42, 0xc6, 0x48, 0x81, 0x42, 0x44, 0x31, 0x00, 0x00,
+        0x4d, 0x92, 0x80, 0x42, 0x59, 0xed, 0x81, 0x42, 0x29, 0x31, 0x01, 0x00, 0x4d, 0x92, 0x80, 0x42,
+        0x59, 0xed, 0x81, 0x42, 0x30, 0x31, 0x01, 0x00, 0x28, 0x49, 0x81, 0x42, 0x7d, 0xf6, 0x81, 0x42,
+        0x3c, 0x31, 0x00, 0x00, 0x03, 0x00, 0x82, 0x42, 0x10, 0x5b, 0x82, 0x42, 0x41, 0x31, 0x00, 0x00,
+        0x03, 0x00, 0x82, 0x42, 0x10, 0x5b, 0x82, 0x42, 0x29, 0x31, 0x01, 0x00, 0x03, 0x00, 0x82, 0x42,
+        0x10, 0x5b, 0x82, 0x42, 0x30, 0x31, 0x01, 0x00, 0x71, 0x5b, 0x82, 0x42, 0xeb, 0xb1, 0x82, 0x42,
+        0x43, 0x31, 0x00, 0x00, 0xdf, 0xb6, 0x82, 0x42, 0x59, 0x6d, 0x83, 0x42, 0x44, 0x31, 0x00, 0x00,
+        0xdf, 0xb6, 0x82, 0x42, 0xeb, 0x11, 0x84, 0x42, 0x29, 0x31, 0x01, 0x00, 0xdf, 0xb6, 0x82, 0x42,
+        0xeb, 0x11, 0x84, 0x42, 0x30, 0x31, 0x01, 0x00, 0xba, 0x6d, 0x83, 0x42, 0x10, 0x1b, 0x84, 0x42,
+        0x3c, 0x31, 0x00, 0x00, 0x96, 0x24, 0x84, 0x42, 0xa2, 0x7f, 0x84, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x96, 0x24, 0x84, 0x42, 0xa2, 0x7f, 0x84, 0x42, 0x29, 0x31, 0x01, 0x00, 0x96, 0x24, 0x84, 0x42,
+        0xa2, 0x7f, 0x84, 0x42, 0x30, 0x31, 0x01, 0x00, 0x03, 0x80, 0x84, 0x42, 0x7d, 0xd6, 0x84, 0x42,
+        0x44, 0x31, 0x00, 0x00, 0x71, 0xdb, 0x84, 0x42, 0xeb, 0x91, 0x85, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x71, 0xdb, 0x84, 0x42, 0x7d, 0x36, 0x86, 0x42, 0x24, 0x31, 0x01, 0x00, 0x71, 0xdb, 0x84, 0x42,
+        0x7d, 0x36, 0x86, 0x42, 0x2b, 0x31, 0x01, 0x00, 0x4d, 0x92, 0x85, 0x42, 0xa2, 0x3f, 0x86, 0x42,
+        0x3c, 0x31, 0x00, 0x00, 0x28, 0x49, 0x86, 0x42, 0x34, 0xa4, 0x86, 0x42, 0x3f, 0x31, 0x00, 0x00,
+        0x28, 0x49, 0x86, 0x42, 0x34, 0xa4, 0x86, 0x42, 0x24, 0x31, 0x01, 0x00, 0x28, 0x49, 0x86, 0x42,
+        0x34, 0xa4, 0x86, 0x42, 0x2b, 0x31, 0x01, 0x00, 0x96, 0xa4, 0x86, 0x42, 0x10, 0xfb, 0x86, 0x42,
+        0x41, 0x31, 0x00, 0x00, 0x04, 0x00, 0x87, 0x42, 0x7d, 0xb6, 0x87, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x04, 0x00, 0x87, 0x42, 0x10, 0x5b, 0x88, 0x42, 0x24, 0x31, 0x01, 0x00, 0x04, 0x00, 0x87, 0x42,
+        0x10, 0x5b, 0x88, 0x42, 0x2b, 0x31, 0x01, 0x00, 0xdf, 0xb6, 0x87, 0x42, 0x34, 0x64, 0x88, 0x42,
+        0x3c, 0x31, 0x00, 0x00, 0xba, 0x6d, 0x88, 0x42, 0xc7, 0xc8, 0x88, 0x42, 0x3f, 0x31, 0x00, 0x00,
+        0xba, 0x6d, 0x88, 0x42, 0xc7, 0xc8, 0x88, 0x42, 0x24, 0x31, 0x01, 0x00, 0xba, 0x6d, 0x88, 0x42,
+        0xc7, 0xc8, 0x88, 0x42, 0x2b, 0x31, 0x01, 0x00, 0x28, 0xc9, 0x88, 0x42, 0xa2, 0x1f, 0x89, 0x42,
+        0x41, 0x31, 0x00, 0x00, 0x96, 0x24, 0x89, 0x42, 0x10, 0xdb, 0x89, 0x42, 0x3f, 0x31, 0x00, 0x00,
+        0x96, 0x24, 0x89, 0x42, 0xa2, 0x7f, 0x8a, 0x42, 0x20, 0x31, 0x01, 0x00, 0x96, 0x24, 0x89, 0x42,
+        0xa2, 0x7f, 0x8a, 0x42, 0x27, 0x31, 0x01, 0x00, 0x71, 0xdb, 0x89, 0x42, 0xc7, 0x88, 0x8a, 0x42,
+        0x38, 0x37, 0x00, 0x00, 0x4d, 0x92, 0x8a, 0x42, 0x59, 0xed, 0x8a, 0x42, 0x3c, 0x3e, 0x00, 0x00,
+        0x4d, 0x92, 0x8a, 0x42, 0x59, 0xed, 0x8a, 0x42, 0x20, 0x3e, 0x01, 0x00, 0x4d, 0x92, 0x8a, 0x42,
+        0x59, 0xed, 0x8a, 0x42, 0x27, 0x3e, 0x01, 0x00, 0xba, 0xed, 0x8a, 0x42, 0x34, 0x44, 0x8b, 0x42,
+        0x3e, 0x41, 0x00, 0x00, 0x28, 0x49, 0x8b, 0x42, 0xa2, 0xff, 0x8b, 0x42, 0x3f, 0x45, 0x00, 0x00,
+        0x28, 0x49, 0x8b, 0x42, 0x34, 0xa4, 0x8c, 0x42, 0x20, 0x45, 0x01, 0x00, 0x28, 0x49, 0x8b, 0x42,
+        0x34, 0xa4, 0x8c, 0x42, 0x27, 0x45, 0x01, 0x00, 0x04, 0x00, 0x8c, 0x42, 0x59, 0xad, 0x8c, 0x42,
+        0x38, 0x4b, 0x00, 0x00, 0xdf, 0xb6, 0x8c, 0x42, 0xeb, 0x11, 0x8d, 0x42, 0x3c, 0x52, 0x00, 0x00,
+        0xdf, 0xb6, 0x8c, 0x42, 0xeb, 0x11, 0x8d, 0x42, 0x20, 0x52, 0x01, 0x00, 0xdf, 0xb6, 0x8c, 0x42,
+        0xeb, 0x11, 0x8d, 0x42, 0x27, 0x52, 0x01, 0x00, 0x4d, 0x12, 0x8d, 0x42, 0xc7, 0x68, 0x8d, 0x42,
+        0x3e, 0x55, 0x00, 0x00, 0xbb, 0x6d, 0x8d, 0x42, 0x34, 0x24, 0x8e, 0x42, 0x3f, 0x59, 0x00, 0x00,
+        0xbb, 0x6d, 0x8d, 0x42, 0xc7, 0xc8, 0x8d, 0x42, 0x20, 0x59, 0x01, 0x00, 0xbb, 0x6d, 0x8d, 0x42,
+        0xc7, 0xc8, 0x8d, 0x42, 0x27, 0x59, 0x01, 0x00, 0x96, 0x24, 0x8e, 0x42, 0xa2, 0x7f, 0x8e, 0x42,
+        0x38, 0x60, 0x00, 0x00, 0x96, 0x24, 0x8e, 0x42, 0xa2, 0x7f, 0x8e, 0x42, 0x20, 0x60, 0x01, 0x00,
+        0x96, 0x24, 0x8e, 0x42, 0xa2, 0x7f, 0x8e, 0x42, 0x27, 0x60, 0x01, 0x00, 0x71, 0xdb, 0x8e, 0x42,
+        0x7e, 0x36, 0x8f, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x71, 0xdb, 0x8e, 0x42, 0x7e, 0x36, 0x8f, 0x42,
+        0x20, 0x60, 0x01, 0x00, 0x71, 0xdb, 0x8e, 0x42, 0x7e, 0x36, 0x8f, 0x42, 0x27, 0x60, 0x01, 0x00,
+        0x4d, 0x92, 0x8f, 0x42, 0xc7, 0x48, 0x90, 0x42, 0x41, 0x60, 0x00, 0x00, 0x4d, 0x92, 0x8f, 0x42,
+        0x59, 0xed, 0x8f, 0x42, 0x1f, 0x60, 0x01, 0x00, 0x4d, 0x92, 0x8f, 0x42, 0x59, 0xed, 0x8f, 0x42,
+        0x26, 0x60, 0x01, 0x00, 0x28, 0x49, 0x90, 0x42, 0x35, 0xa4, 0x90, 0x42, 0x3f, 0x60, 0x00, 0x00,
+        0x28, 0x49, 0x90, 0x42, 0x35, 0xa4, 0x90, 0x42, 0x1f, 0x60, 0x01, 0x00, 0x28, 0x49, 0x90, 0x42,
+        0x35, 0xa4, 0x90, 0x42, 0x26, 0x60, 0x01, 0x00, 0x04, 0x00, 0x91, 0x42, 0x10, 0x5b, 0x91, 0x42,
+        0x41, 0x60, 0x00, 0x00, 0x04, 0x00, 0x91, 0x42, 0x10, 0x5b, 0x91, 0x42, 0x1f, 0x60, 0x01, 0x00,
+        0x04, 0x00, 0x91, 0x42, 0x10, 0x5b, 0x91, 0x42, 0x26, 0x60, 0x01, 0x00, 0xdf, 0xb6, 0x91, 0x42,
+        0x59, 0x6d, 0x92, 0x42, 0x43, 0x73, 0x00, 0x00, 0xdf, 0xb6, 0x91, 0x42, 0xeb, 0x11, 0x93, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0xdf, 0xb6, 0x91, 0x42, 0xeb, 0x11, 0x93, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0xbb, 0x6d, 0x92, 0x42, 0x10, 0x1b, 0x93, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x96, 0x24, 0x93, 0x42,
+        0x10, 0x7b, 0x93, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x96, 0x24, 0x93, 0x42, 0xa2, 0x7f, 0x93, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x96, 0x24, 0x93, 0x42, 0xa2, 0x7f, 0x93, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x04, 0x80, 0x93, 0x42, 0x7e, 0xd6, 0x93, 0x42, 0x41, 0x60, 0x00, 0x00, 0x72, 0xdb, 0x93, 0x42,
+        0xec, 0x91, 0x94, 0x42, 0x43, 0x73, 0x00, 0x00, 0x72, 0xdb, 0x93, 0x42, 0x7e, 0x36, 0x95, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x72, 0xdb, 0x93, 0x42, 0x7e, 0x36, 0x95, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x4d, 0x92, 0x94, 0x42, 0xa2, 0x3f, 0x95, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x28, 0x49, 0x95, 0x42,
+        0xa2, 0x9f, 0x95, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x28, 0x49, 0x95, 0x42, 0x35, 0xa4, 0x95, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x28, 0x49, 0x95, 0x42, 0x35, 0xa4, 0x95, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x96, 0xa4, 0x95, 0x42, 0x10, 0xfb, 0x95, 0x42, 0x41, 0x60, 0x00, 0x00, 0x04, 0x00, 0x96, 0x42,
+        0x7e, 0xb6, 0x96, 0x42, 0x43, 0x73, 0x00, 0x00, 0x04, 0x00, 0x96, 0x42, 0x10, 0x5b, 0x97, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x04, 0x00, 0x96, 0x42, 0x10, 0x5b, 0x97, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0xdf, 0xb6, 0x96, 0x42, 0x35, 0x64, 0x97, 0x42, 0x3c, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0x97, 0x42,
+        0x35, 0xc4, 0x97, 0x42, 0x3f, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0x97, 0x42, 0xc7, 0xc8, 0x97, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0xbb, 0x6d, 0x97, 0x42, 0xc7, 0xc8, 0x97, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x29, 0xc9, 0x97, 0x42, 0xa2, 0x1f, 0x98, 0x42, 0x41, 0x60, 0x00, 0x00, 0x96, 0x24, 0x98, 0x42,
+        0x10, 0xdb, 0x98, 0x42, 0x43, 0x60, 0x00, 0x00, 0x96, 0x24, 0x98, 0x42, 0xa3, 0x7f, 0x99, 0x42,
+        0x27, 0x60, 0x01, 0x00, 0x96, 0x24, 0x98, 0x42, 0xa3, 0x7f, 0x99, 0x42, 0x2e, 0x60, 0x01, 0x00,
+        0x72, 0xdb, 0x98, 0x42, 0xec, 0x91, 0x99, 0x42, 0x44, 0x60, 0x00, 0x00, 0x4d, 0x92, 0x99, 0x42,
+        0xa3, 0x3f, 0x9a, 0x42, 0x46, 0x60, 0x00, 0x00, 0x4d, 0x92, 0x99, 0x42, 0x59, 0xed, 0x99, 0x42,
+        0x27, 0x60, 0x01, 0x00, 0x4d, 0x92, 0x99, 0x42, 0x59, 0xed, 0x99, 0x42, 0x2e, 0x60, 0x01, 0x00,
+        0x29, 0x49, 0x9a, 0x42, 0xa3, 0xff, 0x9a, 0x42, 0x48, 0x60, 0x00, 0x00, 0x29, 0x49, 0x9a, 0x42,
+        0x35, 0xa4, 0x9b, 0x42, 0x2c, 0x60, 0x01, 0x00, 0x29, 0x49, 0x9a, 0x42, 0x35, 0xa4, 0x9b, 0x42,
+        0x33, 0x60, 0x01, 0x00, 0x04, 0x00, 0x9b, 0x42, 0x59, 0xad, 0x9b, 0x42, 0x3f, 0x60, 0x00, 0x00,
+        0xe0, 0xb6, 0x9b, 0x42, 0xec, 0x11, 0x9c, 0x42, 0x44, 0x60, 0x00, 0x00, 0xe0, 0xb6, 0x9b, 0x42,
+        0x35, 0xe4, 0x9b, 0x42, 0x2c, 0x60, 0x01, 0x00, 0xe0, 0xb6, 0x9b, 0x42, 0x35, 0xe4, 0x9b, 0x42,
+        0x33, 0x60, 0x01, 0x00, 0x4d, 0x12, 0x9c, 0x42, 0xc7, 0x68, 0x9c, 0x42, 0x46, 0x60, 0x00, 0x00,
+        0x4d, 0x12, 0x9c, 0x42, 0xa3, 0x3f, 0x9c, 0x42, 0x2c, 0x60, 0x01, 0x00, 0x4d, 0x12, 0x9c, 0x42,
+        0xa3, 0x3f, 0x9c, 0x42, 0x33, 0x60, 0x01, 0x00, 0xbb, 0x6d, 0x9c, 0x42, 0x35, 0x24, 0x9d, 0x42,
+        0x48, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0x9c, 0x42, 0xc7, 0xc8, 0x9d, 0x42, 0x2c, 0x60, 0x01, 0x00,
+        0xbb, 0x6d, 0x9c, 0x42, 0xc7, 0xc8, 0x9d, 0x42, 0x33, 0x60, 0x01, 0x00, 0x96, 0x24, 0x9d, 0x42,
+        0xec, 0xd1, 0x9d, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x72, 0xdb, 0x9d, 0x42, 0x7e, 0x36, 0x9e, 0x42,
+        0x44, 0x60, 0x00, 0x00, 0x72, 0xdb, 0x9d, 0x42, 0xc7, 0x08, 0x9e, 0x42, 0x2c, 0x60, 0x01, 0x00,
+        0x72, 0xdb, 0x9d, 0x42, 0xc7, 0x08, 0x9e, 0x42, 0x33, 0x60, 0x01, 0x00, 0xe0, 0x36, 0x9e, 0x42,
+        0x59, 0x8d, 0x9e, 0x42, 0x48, 0x60, 0x00, 0x00, 0xe0, 0x36, 0x9e, 0x42, 0x35, 0x64, 0x9e, 0x42,
+        0x2c, 0x60, 0x01, 0x00, 0xe0, 0x36, 0x9e, 0x42, 0x35, 0x64, 0x9e, 0x42, 0x33, 0x60, 0x01, 0x00,
+        0x4d, 0x92, 0x9e, 0x42, 0xc7, 0x48, 0x9f, 0x42, 0x46, 0x60, 0x00, 0x00, 0x4d, 0x92, 0x9e, 0x42,
+        0x5a, 0xed, 0x9f, 0x42, 0x27, 0x60, 0x01, 0x00, 0x4d, 0x92, 0x9e, 0x42, 0x5a, 0xed, 0x9f, 0x42,
+        0x2e, 0x60, 0x01, 0x00, 0x29, 0x49, 0x9f, 0x42, 0x7e, 0xf6, 0x9f, 0x42, 0x3f, 0x60, 0x00, 0x00,
+        0x04, 0x00, 0xa0, 0x42, 0x10, 0x5b, 0xa0, 0x42, 0x43, 0x60, 0x00, 0x00, 0x04, 0x00, 0xa0, 0x42,
+        0x5a, 0x2d, 0xa0, 0x42, 0x27, 0x60, 0x01, 0x00, 0x04, 0x00, 0xa0, 0x42, 0x5a, 0x2d, 0xa0, 0x42,
+        0x2e, 0x60, 0x01, 0x00, 0x72, 0x5b, 0xa0, 0x42, 0xec, 0xb1, 0xa0, 0x42, 0x44, 0x60, 0x00, 0x00,
+        0x72, 0x5b, 0xa0, 0x42, 0xc7, 0x88, 0xa0, 0x42, 0x27, 0x60, 0x01, 0x00, 0x72, 0x5b, 0xa0, 0x42,
+        0xc7, 0x88, 0xa0, 0x42, 0x2e, 0x60, 0x01, 0x00, 0xe0, 0xb6, 0xa0, 0x42, 0x5a, 0x6d, 0xa1, 0x42,
+        0x46, 0x60, 0x00, 0x00, 0xe0, 0xb6, 0xa0, 0x42, 0xec, 0x11, 0xa2, 0x42, 0x27, 0x60, 0x01, 0x00,
+        0xe0, 0xb6, 0xa0, 0x42, 0xec, 0x11, 0xa2, 0x42, 0x2e, 0x60, 0x01, 0x00, 0xbb, 0x6d, 0xa1, 0x42,
+        0xc7, 0xc8, 0xa1, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x97, 0x24, 0xa2, 0x42, 0xa3, 0x7f, 0xa2, 0x42,
+        0x43, 0x60, 0x00, 0x00, 0x97, 0x24, 0xa2, 0x42, 0xec, 0x51, 0xa2, 0x42, 0x27, 0x60, 0x01, 0x00,
+        0x97, 0x24, 0xa2, 0x42, 0xec, 0x51, 0xa2, 0x42, 0x2e, 0x60, 0x01, 0x00, 0x04, 0x80, 0xa2, 0x42,
+        0x5a, 0xad, 0xa2, 0x42, 0x27, 0x60, 0x01, 0x00, 0x04, 0x80, 0xa2, 0x42, 0x5a, 0xad, 0xa2, 0x42,
+        0x2e, 0x60, 0x01, 0x00, 0x72, 0xdb, 0xa2, 0x42, 0xec, 0x91, 0xa3, 0x42, 0x44, 0x60, 0x00, 0x00,
+        0x72, 0xdb, 0xa2, 0x42, 0x7e, 0x36, 0xa4, 0x42, 0x29, 0x60, 0x01, 0x00, 0x72, 0xdb, 0xa2, 0x42,
+        0x7e, 0x36, 0xa4, 0x42, 0x30, 0x60, 0x01, 0x00, 0x4d, 0x92, 0xa3, 0x42, 0xa3, 0x3f, 0xa4, 0x42,
+        0x3c, 0x60, 0x00, 0x00, 0x29, 0x49, 0xa4, 0x42, 0x35, 0xa4, 0xa4, 0x42, 0x41, 0x60, 0x00, 0x00,
+        0x29, 0x49, 0xa4, 0x42, 0x7e, 0x76, 0xa4, 0x42, 0x29, 0x60, 0x01, 0x00, 0x29, 0x49, 0xa4, 0x42,
+        0x7e, 0x76, 0xa4, 0x42, 0x30, 0x60, 0x01, 0x00, 0x97, 0xa4, 0xa4, 0x42, 0x11, 0xfb, 0xa4, 0x42,
+        0x43, 0x60, 0x00, 0x00, 0x97, 0xa4, 0xa4, 0x42, 0xec, 0xd1, 0xa4, 0x42, 0x29, 0x60, 0x01, 0x00,
+        0x97, 0xa4, 0xa4, 0x42, 0xec, 0xd1, 0xa4, 0x42, 0x30, 0x60, 0x01, 0x00, 0x04, 0x00, 0xa5, 0x42,
+        0x7e, 0xb6, 0xa5, 0x42, 0x44, 0x60, 0x00, 0x00, 0x04, 0x00, 0xa5, 0x42, 0x11, 0x5b, 0xa6, 0x42,
+        0x29, 0x60, 0x01, 0x00, 0x04, 0x00, 0xa5, 0x42, 0x11, 0x5b, 0xa6, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0xe0, 0xb6, 0xa5, 0x42, 0x35, 0x64, 0xa6, 0x42, 0x3c, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0xa6, 0x42,
+        0xc7, 0xc8, 0xa6, 0x42, 0x43, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0xa6, 0x42, 0x11, 0x9b, 0xa6, 0x42,
+        0x29, 0x60, 0x01, 0x00, 0xbb, 0x6d, 0xa6, 0x42, 0x11, 0x9b, 0xa6, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0x29, 0xc9, 0xa6, 0x42, 0xa3, 0x1f, 0xa7, 0x42, 0x44, 0x60, 0x00, 0x00, 0x29, 0xc9, 0xa6, 0x42,
+        0x7e, 0xf6, 0xa6, 0x42, 0x29, 0x60, 0x01, 0x00, 0x29, 0xc9, 0xa6, 0x42, 0x7e, 0xf6, 0xa6, 0x42,
+        0x30, 0x60, 0x01, 0x00, 0x97, 0x24, 0xa7, 0x42, 0x11, 0xdb, 0xa7, 0x42, 0x43, 0x60, 0x00, 0x00,
+        0x97, 0x24, 0xa7, 0x42, 0xa3, 0x7f, 0xa8, 0x42, 0x24, 0x60, 0x01, 0x00, 0x97, 0x24, 0xa7, 0x42,
+        0xa3, 0x7f, 0xa8, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x72, 0xdb, 0xa7, 0x42, 0xc7, 0x88, 0xa8, 0x42,
+        0x3c, 0x60, 0x00, 0x00, 0x4e, 0x92, 0xa8, 0x42, 0x5a, 0xed, 0xa8, 0x42, 0x3f, 0x60, 0x00, 0x00,
+        0x4e, 0x92, 0xa8, 0x42, 0xa3, 0xbf, 0xa8, 0x42, 0x24, 0x60, 0x01, 0x00, 0x4e, 0x92, 0xa8, 0x42,
+        0xa3, 0xbf, 0xa8, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xbb, 0xed, 0xa8, 0x42, 0x35, 0x44, 0xa9, 0x42,
+        0x41, 0x60, 0x00, 0x00, 0xbb, 0xed, 0xa8, 0x42, 0x11, 0x1b, 0xa9, 0x42, 0x24, 0x60, 0x01, 0x00,
+        0xbb, 0xed, 0xa8, 0x42, 0x11, 0x1b, 0xa9, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x29, 0x49, 0xa9, 0x42,
+        0xa3, 0xff, 0xa9, 0x42, 0x43, 0x60, 0x00, 0x00, 0x29, 0x49, 0xa9, 0x42, 0x35, 0xa4, 0xaa, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0x29, 0x49, 0xa9, 0x42, 0x35, 0xa4, 0xaa, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x04, 0x00, 0xaa, 0x42, 0x11, 0x5b, 0xaa, 0x42, 0x3c, 0x60, 0x00, 0x00, 0xe0, 0xb6, 0xaa, 0x42,
+        0xec, 0x11, 0xab, 0x42, 0x3e, 0x60, 0x00, 0x00, 0xe0, 0xb6, 0xaa, 0x42, 0x35, 0xe4, 0xaa, 0x42,
+        0x24, 0x60, 0x01, 0x00, 0xe0, 0xb6, 0xaa, 0x42, 0x35, 0xe4, 0xaa, 0x42, 0x2b, 0x60, 0x01, 0x00,
+        0x4e, 0x12, 0xab, 0x42, 0xa3, 0x3f, 0xab, 0x42, 0x24, 0x60, 0x01, 0x00, 0x4e, 0x12, 0xab, 0x42,
+        0xa3, 0x3f, 0xab, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xbb, 0x6d, 0xab, 0x42, 0x35, 0x24, 0xac, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0xab, 0x42, 0xc8, 0xc8, 0xac, 0x42, 0x20, 0x60, 0x01, 0x00,
+        0xbb, 0x6d, 0xab, 0x42, 0xc8, 0xc8, 0xac, 0x42, 0x27, 0x60, 0x01, 0x00, 0x97, 0x24, 0xac, 0x42,
+        0xec, 0xd1, 0xac, 0x42, 0x38, 0x60, 0x00, 0x00, 0x72, 0xdb, 0xac, 0x42, 0x7e, 0x36, 0xad, 0x42,
+        0x3c, 0x60, 0x00, 0x00, 0x72, 0xdb, 0xac, 0x42, 0xc8, 0x08, 0xad, 0x42, 0x20, 0x60, 0x01, 0x00,
+        0x72, 0xdb, 0xac, 0x42, 0xc8, 0x08, 0xad, 0x42, 0x27, 0x60, 0x01, 0x00, 0xe0, 0x36, 0xad, 0x42,
+        0x5a, 0x8d, 0xad, 0x42, 0x3e, 0x60, 0x00, 0x00, 0xe0, 0x36, 0xad, 0x42, 0x35, 0x64, 0xad, 0x42,
+        0x20, 0x60, 0x01, 0x00, 0xe0, 0x36, 0xad, 0x42, 0x35, 0x64, 0xad, 0x42, 0x27, 0x60, 0x01, 0x00,
+        0x4e, 0x92, 0xad, 0x42, 0xc8, 0x48, 0xae, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x4e, 0x92, 0xad, 0x42,
+        0x5a, 0xed, 0xae, 0x42, 0x20, 0x60, 0x01, 0x00, 0x4e, 0x92, 0xad, 0x42, 0x5a, 0xed, 0xae, 0x42,
+        0x27, 0x60, 0x01, 0x00, 0x29, 0x49, 0xae, 0x42, 0x7e, 0xf6, 0xae, 0x42, 0x38, 0x60, 0x00, 0x00,
+        0x05, 0x00, 0xaf, 0x42, 0x11, 0x5b, 0xaf, 0x42, 0x3c, 0x60, 0x00, 0x00, 0x05, 0x00, 0xaf, 0x42,
+        0x5a, 0x2d, 0xaf, 0x42, 0x20, 0x60, 0x01, 0x00, 0x05, 0x00, 0xaf, 0x42, 0x5a, 0x2d, 0xaf, 0x42,
+        0x27, 0x60, 0x01, 0x00, 0x72, 0x5b, 0xaf, 0x42, 0xec, 0xb1, 0xaf, 0x42, 0x3e, 0x60, 0x00, 0x00,
+        0x72, 0x5b, 0xaf, 0x42, 0xc8, 0x88, 0xaf, 0x42, 0x20, 0x60, 0x01, 0x00, 0x72, 0x5b, 0xaf, 0x42,
+        0xc8, 0x88, 0xaf, 0x42, 0x27, 0x60, 0x01, 0x00, 0xe0, 0xb6, 0xaf, 0x42, 0x5a, 0x6d, 0xb0, 0x42,
+        0x3f, 0x60, 0x00, 0x00, 0xe0, 0xb6, 0xaf, 0x42, 0xec, 0x11, 0xb0, 0x42, 0x20, 0x60, 0x01, 0x00,
+        0xe0, 0xb6, 0xaf, 0x42, 0xec, 0x11, 0xb0, 0x42, 0x27, 0x60, 0x01, 0x00, 0xbb, 0x6d, 0xb0, 0x42,
+        0xc8, 0xc8, 0xb0, 0x42, 0x38, 0x60, 0x00, 0x00, 0xbb, 0x6d, 0xb0, 0x42, 0xc8, 0xc8, 0xb0, 0x42,
+        0x20, 0x60, 0x01, 0x00, 0xbb, 0x6d, 0xb0, 0x42, 0xc8, 0xc8, 0xb0, 0x42, 0x27, 0x60, 0x01, 0x00,
+        0x97, 0x24, 0xb1, 0x42, 0xa3, 0x7f, 0xb1, 0x42, 0x3f, 0x60, 0x00, 0x00, 0x97, 0x24, 0xb1, 0x42,
+        0xa3, 0x7f, 0xb1, 0x42, 0x20, 0x60, 0x01, 0x00, 0x97, 0x24, 0xb1, 0x42, 0xa3, 0x7f, 0xb1, 0x42,
+        0x27, 0x60, 0x01, 0x00, 0x72, 0xdb, 0xb1, 0x42, 0xec, 0x91, 0xb2, 0x42, 0x3e, 0x70, 0x00, 0x00,
+        0x72, 0xdb, 0xb1, 0x42, 0x7f, 0x36, 0xb2, 0x42, 0x1f, 0x70, 0x01, 0x00, 0x72, 0xdb, 0xb1, 0x42,
+        0x7f, 0x36, 0xb2, 0x42, 0x26, 0x70, 0x01, 0x00, 0x4e, 0x92, 0xb2, 0x42, 0x5a, 0xed, 0xb2, 0x42,
+        0x37, 0x70, 0x00, 0x00, 0x4e, 0x92, 0xb2, 0x42, 0x5a, 0xed, 0xb2, 0x42, 0x1f, 0x70, 0x01, 0x00,
+        0x4e, 0x92, 0xb2, 0x42, 0x5a, 0xed, 0xb2, 0x42, 0x26, 0x70, 0x01, 0x00, 0x29, 0x49, 0xb3, 0x42,
+        0x35, 0xa4, 0xb3, 0x42, 0x3e, 0x70, 0x00, 0x00, 0x29, 0x49, 0xb3, 0x42, 0x35, 0xa4, 0xb3, 0x42,
+        0x1f, 0x70, 0x01, 0x00, 0x29, 0x49, 0xb3, 0x42, 0x35, 0xa4, 0xb3, 0x42, 0x26, 0x70, 0x01, 0x00,
+        0x05, 0x00, 0xb4, 0x42, 0x7f, 0xb6, 0xb4, 0x42, 0x3c, 0x7f, 0x00, 0x00, 0x05, 0x00, 0xb4, 0x42,
+        0x11, 0x5b, 0xb5, 0x42, 0x24, 0x70, 0x01, 0x00, 0x05, 0x00, 0xb4, 0x42, 0x11, 0x5b, 0xb5, 0x42,
+        0x2b, 0x70, 0x01, 0x00, 0xe0, 0xb6, 0xb4, 0x42, 0x36, 0x64, 0xb5, 0x42, 0x37, 0x70, 0x00, 0x00,
+        0xbc, 0x6d, 0xb5, 0x42, 0x36, 0xc4, 0xb5, 0x42, 0x38, 0x70, 0x00, 0x00, 0xbc, 0x6d, 0xb5, 0x42,
+        0x11, 0x9b, 0xb5, 0x42, 0x24, 0x70, 0x01, 0x00, 0xbc, 0x6d, 0xb5, 0x42, 0x11, 0x9b, 0xb5, 0x42,
+        0x2b, 0x70, 0x01, 0x00, 0x29, 0xc9, 0xb5, 0x42, 0xa3, 0x1f, 0xb6, 0x42, 0x3a, 0x70, 0x00, 0x00,
+        0x29, 0xc9, 0xb5, 0x42, 0x7f, 0xf6, 0xb5, 0x42, 0x24, 0x70, 0x01, 0x00, 0x29, 0xc9, 0xb5, 0x42,
+        0x7f, 0xf6, 0xb5, 0x42, 0x2b, 0x70, 0x01, 0x00, 0x97, 0x24, 0xb6, 0x42, 0x11, 0xdb, 0xb6, 0x42,
+        0x3c, 0x7f, 0x00, 0x00, 0x97, 0x24, 0xb6, 0x42, 0xa3, 0x7f, 0xb7, 0x42, 0x24, 0x70, 0x01, 0x00,
+        0x97, 0x24, 0xb6, 0x42, 0xa3, 0x7f, 0xb7, 0x42, 0x2b, 0x70, 0x01, 0x00, 0x73, 0xdb, 0xb6, 0x42,
+        0xc8, 0x88, 0xb7, 0x42, 0x37, 0x70, 0x00, 0x00, 0x4e, 0x92, 0xb7, 0x42, 0xc8, 0xe8, 0xb7, 0x42,
+        0x38, 0x70, 0x00, 0x00, 0x4e, 0x92, 0xb7, 0x42, 0xa3, 0xbf, 0xb7, 0x42, 0x24, 0x70, 0x01, 0x00,
+        0x4e, 0x92, 0xb7, 0x42, 0xa3, 0xbf, 0xb7, 0x42, 0x2b, 0x70, 0x01, 0x00, 0xbc, 0xed, 0xb7, 0x42,
+        0x36, 0x44, 0xb8, 0x42, 0x3a, 0x70, 0x00, 0x00, 0xbc, 0xed, 0xb7, 0x42, 0x11, 0x1b, 0xb8, 0x42,
+        0x24, 0x70, 0x01, 0x00, 0xbc, 0xed, 0xb7, 0x42, 0x11, 0x1b, 0xb8, 0x42, 0x2b, 0x70, 0x01, 0x00,
+        0x29, 0x49, 0xb8, 0x42, 0xa3, 0xff, 0xb8, 0x42, 0x3c, 0x7f, 0x00, 0x00, 0x29, 0x49, 0xb8, 0x42,
+        0x36, 0xa4, 0xb9, 0x42, 0x24, 0x70, 0x01, 0x00, 0x29, 0x49, 0xb8, 0x42, 0x36, 0xa4, 0xb9, 0x42,
+        0x2b, 0x70, 0x01, 0x00, 0x05, 0x00, 0xb9, 0x42, 0x5a, 0xad, 0xb9, 0x42, 0x37, 0x70, 0x00, 0x00,
+        0xe0, 0xb6, 0xb9, 0x42, 0x5a, 0x0d, 0xba, 0x42, 0x38, 0x70, 0x00, 0x00, 0xe0, 0xb6, 0xb9, 0x42,
+        0x36, 0xe4, 0xb9, 0x42, 0x24, 0x70, 0x01, 0x00, 0xe0, 0xb6, 0xb9, 0x42, 0x36, 0xe4, 0xb9, 0x42,
+        0x2b, 0x70, 0x01, 0x00, 0x4e, 0x12, 0xba, 0x42, 0xc8, 0x68, 0xba, 0x42, 0x3a, 0x70, 0x00, 0x00,
+        0x4e, 0x12, 0xba, 0x42, 0xa3, 0x3f, 0xba, 0x42, 0x24, 0x70, 0x01, 0x00, 0x4e, 0x12, 0xba, 0x42,
+        0xa3, 0x3f, 0xba, 0x42, 0x2b, 0x70, 0x01, 0x00, 0xbc, 0x6d, 0xba, 0x42, 0x36, 0x24, 0xbb, 0x42,
+        0x3c, 0x7f, 0x00, 0x00, 0xbc, 0x6d, 0xba, 0x42, 0xc8, 0xc8, 0xbb, 0x42, 0x24, 0x70, 0x01, 0x00,
+        0xbc, 0x6d, 0xba, 0x42, 0xc8, 0xc8, 0xbb, 0x42, 0x2b, 0x70, 0x01, 0x00, 0x97, 0x24, 0xbb, 0x42,
+        0xed, 0xd1, 0xbb, 0x42, 0x37, 0x70, 0x00, 0x00, 0x73, 0xdb, 0xbb, 0x42, 0xed, 0x31, 0xbc, 0x42,
+        0x38, 0x70, 0x00, 0x00, 0x73, 0xdb, 0xbb, 0x42, 0xc8, 0x08, 0xbc, 0x42, 0x24, 0x70, 0x01, 0x00,
+        0x73, 0xdb, 0xbb, 0x42, 0xc8, 0x08, 0xbc, 0x42, 0x2b, 0x70, 0x01, 0x00, 0xe0, 0x36, 0xbc, 0x42,
+        0x5a, 0x8d, 0xbc, 0x42, 0x3a, 0x70, 0x00, 0x00, 0xe0, 0x36, 0xbc, 0x42, 0x36, 0x64, 0xbc, 0x42,
+        0x24, 0x70, 0x01, 0x00, 0xe0, 0x36, 0xbc, 0x42, 0x36, 0x64, 0xbc, 0x42, 0x2b, 0x70, 0x01, 0x00,
+        0x4e, 0x92, 0xbc, 0x42, 0xa3, 0x3f, 0xbd, 0x42, 0x3c, 0x40, 0x00, 0x00, 0x4e, 0x92, 0xbc, 0x42,
+        0x36, 0xa4, 0xc0, 0x42, 0x24, 0x40, 0x01, 0x00, 0x2a, 0x49, 0xbd, 0x42, 0x7f, 0xf6, 0xbd, 0x42,
+        0x43, 0x40, 0x00, 0x00, 0x05, 0x00, 0xbe, 0x42, 0x7f, 0x56, 0xbe, 0x42, 0x44, 0x40, 0x00, 0x00,
+        0x73, 0x5b, 0xbe, 0x42, 0xed, 0xb1, 0xbe, 0x42, 0x46, 0x40, 0x00, 0x00, 0xe0, 0xb6, 0xbe, 0x42,
+        0x36, 0x64, 0xbf, 0x42, 0x48, 0x40, 0x00, 0x00, 0xbc, 0x6d, 0xbf, 0x42, 0x11, 0x1b, 0xc0, 0x42,
+        0x43, 0x40, 0x00, 0x00, 0x97, 0x24, 0xc0, 0x42, 0x11, 0x7b, 0xc0, 0x42, 0x44, 0x40, 0x00, 0x00,
+        0x05, 0x80, 0xc0, 0x42, 0x7f, 0xd6, 0xc0, 0x42, 0x46, 0x40, 0x00, 0x00, 0x73, 0xdb, 0xc0, 0x42,
+        0xc8, 0x88, 0xc1, 0x42, 0x48, 0x40, 0x00, 0x00, 0x4e, 0x92, 0xc1, 0x42, 0xa4, 0x3f, 0xc2, 0x42,
+        0x43, 0x40, 0x00, 0x00, 0x2a, 0x49, 0xc2, 0x42, 0xa4, 0x9f, 0xc2, 0x42, 0x44, 0x40, 0x00, 0x00,
+        0x97, 0xa4, 0xc2, 0x42, 0x11, 0xfb, 0xc2, 0x42, 0x46, 0x40, 0x00, 0x00, 0x05, 0x00, 0xc3, 0x42,
+        0xc8, 0x08, 0xc5, 0x42, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4d, 0xf3, 0x3e,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x8e, 0x73, 0x3f, 0x3e, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x29, 0x8e, 0x73, 0x3f, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x29, 0x8e, 0x73, 0x3f, 0x37, 0x50, 0x01, 0x00, 0x2d, 0xcf, 0xf3, 0x3e, 0x5e, 0x9a, 0x36, 0x3f,
+        0x43, 0x50, 0x00, 0x00, 0x62, 0xdb, 0x36, 0x3f, 0x29, 0x8e, 0x73, 0x3f, 0x45, 0x50, 0x00, 0x00,
+        0x2d, 0xcf, 0x73, 0x3f, 0xfa, 0x40, 0x98, 0x3f, 0x47, 0x50, 0x00, 0x00, 0x2d, 0xcf, 0x73, 0x3f,
+        0xe0, 0xba, 0xb6, 0x3f, 0x39, 0x50, 0x01, 0x00, 0x7c, 0x61, 0x98, 0x3f, 0xe0, 0xba, 0xb6, 0x3f,
+        0x48, 0x50, 0x00, 0x00, 0x62, 0xdb, 0xb6, 0x3f, 0xab, 0xae, 0xf3, 0x3f, 0x4a, 0x50, 0x00, 0x00,
+        0x62, 0xdb, 0xb6, 0x3f, 0x21, 0xcb, 0x36, 0x40, 0x3b, 0x50, 0x01, 0x00, 0x2d, 0xcf, 0xf3, 0x3f,
+        0x3b, 0x51, 0x18, 0x40, 0x43, 0x50, 0x00, 0x00, 0x7c, 0x61, 0x18, 0x40, 0x2e, 0x8e, 0x27, 0x40,
+        0x43, 0x50, 0x00, 0x00, 0x62, 0xdb, 0x36, 0x40, 0x06, 0x45, 0x55, 0x40, 0x4c, 0x50, 0x00, 0x00,
+        0x62, 0xdb, 0x36, 0x40, 0x69, 0x1c, 0x89, 0x40, 0x3c, 0x50, 0x01, 0x00, 0x47, 0x55, 0x55, 0x40,
+        0xf9, 0x81, 0x64, 0x40, 0x48, 0x50, 0x00, 0x00, 0x3a, 0x92, 0x64, 0x40, 0xec, 0xbe, 0x73, 0x40,
+        0x4a, 0x50, 0x00, 0x00, 0x2d, 0xcf, 0x73, 0x40, 0xef, 0x7d, 0x81, 0x40, 0x4c, 0x50, 0x00, 0x00,
+        0x10, 0x86, 0x81, 0x40, 0x69, 0x1c, 0x89, 0x40, 0x4e, 0x50, 0x00, 0x00, 0x89, 0x24, 0x89, 0x40,
+        0x5c, 0x59, 0x98, 0x40, 0x4f, 0x50, 0x00, 0x00, 0x89, 0x24, 0x89, 0x40, 0x41, 0xd3, 0xb6, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x7c, 0x61, 0x98, 0x40, 0x4e, 0x96, 0xa7, 0x40, 0x43, 0x50, 0x00, 0x00,
+        0x6f, 0x9e, 0xa7, 0x40, 0xc8, 0x34, 0xaf, 0x40, 0x43, 0x50, 0x00, 0x00, 0x62, 0xdb, 0xb6, 0x40,
+        0x34, 0x10, 0xc6, 0x40, 0x48, 0x50, 0x00, 0x00, 0x62, 0xdb, 0xb6, 0x40, 0x1a, 0x8a, 0xe4, 0x40,
+        0x39, 0x50, 0x01, 0x00, 0x55, 0x18, 0xc6, 0x40, 0xad, 0xae, 0xcd, 0x40, 0x4a, 0x50, 0x00, 0x00,
+        0xce, 0xb6, 0xcd, 0x40, 0x27, 0x4d, 0xd5, 0x40, 0x48, 0x50, 0x00, 0x00, 0x47, 0x55, 0xd5, 0x40,
+        0xa0, 0xeb, 0xdc, 0x40, 0x47, 0x50, 0x00, 0x00, 0xc1, 0xf3, 0xdc, 0x40, 0x1a, 0x8a, 0xe4, 0x40,
+        0x45, 0x50, 0x00, 0x00, 0x3a, 0x92, 0xe4, 0x40, 0x0c, 0xc7, 0xf3, 0x40, 0x47, 0x50, 0x00, 0x00,
+        0x3a, 0x92, 0xe4, 0x40, 0x79, 0x20, 0x09, 0x41, 0x37, 0x50, 0x01, 0x00, 0x2d, 0xcf, 0xf3, 0x40,
+        0x86, 0x65, 0xfb, 0x40, 0x48, 0x50, 0x00, 0x00, 0xa6, 0x6d, 0xfb, 0x40, 0x00, 0x82, 0x01, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x10, 0x86, 0x01, 0x41, 0x3c, 0x51, 0x05, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x4d, 0x55, 0x05, 0x41, 0x79, 0x20, 0x09, 0x41, 0x43, 0x50, 0x00, 0x00, 0x89, 0x24, 0x09, 0x41,
+        0xf2, 0xbe, 0x10, 0x41, 0x42, 0x50, 0x00, 0x00, 0x89, 0x24, 0x09, 0x41, 0xf2, 0xbe, 0x10, 0x41,
+        0x3e, 0x50, 0x01, 0x00, 0x03, 0xc3, 0x10, 0x41, 0x2f, 0x8e, 0x14, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x03, 0xc3, 0x10, 0x41, 0x6c, 0x5d, 0x18, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x3f, 0x92, 0x14, 0x41,
+        0x6c, 0x5d, 0x18, 0x41, 0x45, 0x50, 0x00, 0x00, 0x7c, 0x61, 0x18, 0x41, 0xa9, 0x2c, 0x1c, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x7c, 0x61, 0x18, 0x41, 0xe5, 0xfb, 0x1f, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0xb9, 0x30, 0x1c, 0x41, 0xe5, 0xfb, 0x1f, 0x41, 0x43, 0x50, 0x00, 0x00, 0xf6, 0xff, 0x1f, 0x41,
+        0x22, 0xcb, 0x23, 0x41, 0x47, 0x50, 0x00, 0x00, 0xf6, 0xff, 0x1f, 0x41, 0x5f, 0x9a, 0x27, 0x41,
+        0x3e, 0x50, 0x01, 0x00, 0x32, 0xcf, 0x23, 0x41, 0x8e, 0xa6, 0x3a, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x6f, 0x9e, 0x27, 0x41, 0x9b, 0x69, 0x2b, 0x41, 0x32, 0x50, 0x01, 0x00, 0xac, 0x6d, 0x2b, 0x41,
+        0xd8, 0x38, 0x2f, 0x41, 0x3c, 0x50, 0x01, 0x00, 0xe8, 0x3c, 0x2f, 0x41, 0x15, 0x08, 0x33, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x25, 0x0c, 0x33, 0x41, 0x51, 0xd7, 0x36, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x62, 0xdb, 0x36, 0x41, 0xcb, 0x75, 0x3e, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x62, 0xdb, 0x36, 0x41,
+        0x44, 0x14, 0x46, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xdb, 0x79, 0x3e, 0x41, 0x08, 0x45, 0x42, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x18, 0x49, 0x42, 0x41, 0x44, 0x14, 0x46, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x55, 0x18, 0x46, 0x41, 0x81, 0xe3, 0x49, 0x41, 0x47, 0x50, 0x00, 0x00, 0x55, 0x18, 0x46, 0x41,
+        0xbe, 0xb2, 0x4d, 0x41, 0x39, 0x50, 0x01, 0x00, 0x91, 0xe7, 0x49, 0x41, 0xbe, 0xb2, 0x4d, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0xce, 0xb6, 0x4d, 0x41, 0x37, 0x51, 0x55, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0xce, 0xb6, 0x4d, 0x41, 0x37, 0x51, 0x55, 0x41, 0x37, 0x50, 0x01, 0x00, 0x47, 0x55, 0x55, 0x41,
+        0xb1, 0xef, 0x5c, 0x41, 0x43, 0x50, 0x00, 0x00, 0x47, 0x55, 0x55, 0x41, 0xb1, 0xef, 0x5c, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0xc1, 0xf3, 0x5c, 0x41, 0xed, 0xbe, 0x60, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0xc1, 0xf3, 0x5c, 0x41, 0x2a, 0x8e, 0x64, 0x41, 0x37, 0x50, 0x01, 0x00, 0x3a, 0x92, 0x64, 0x41,
+        0xa3, 0x2c, 0x6c, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x3a, 0x92, 0x64, 0x41, 0x96, 0x69, 0x7b, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0xb4, 0x30, 0x6c, 0x41, 0xe0, 0xfb, 0x6f, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0xf0, 0xff, 0x6f, 0x41, 0x1d, 0xcb, 0x73, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x2d, 0xcf, 0x73, 0x41,
+        0x59, 0x9a, 0x77, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x6a, 0x9e, 0x77, 0x41, 0x96, 0x69, 0x7b, 0x41,
+        0x4e, 0x50, 0x00, 0x00, 0xa6, 0x6d, 0x7b, 0x41, 0x08, 0x84, 0x81, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0xa6, 0x6d, 0x7b, 0x41, 0x08, 0x84, 0x81, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x10, 0x86, 0x81, 0x41,
+        0x44, 0x53, 0x85, 0x41, 0x43, 0x50, 0x00, 0x00, 0x10, 0x86, 0x81, 0x41, 0xa6, 0x6b, 0x83, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0xae, 0x6d, 0x83, 0x41, 0x44, 0x53, 0x85, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x4d, 0x55, 0x85, 0x41, 0x81, 0x22, 0x89, 0x41, 0x43, 0x50, 0x00, 0x00, 0x4d, 0x55, 0x85, 0x41,
+        0xe3, 0x3a, 0x87, 0x41, 0x39, 0x50, 0x01, 0x00, 0xeb, 0x3c, 0x87, 0x41, 0x81, 0x22, 0x89, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x89, 0x24, 0x89, 0x41, 0xbe, 0xf1, 0x8c, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x89, 0x24, 0x89, 0x41, 0xfb, 0xc0, 0x90, 0x41, 0x39, 0x50, 0x01, 0x00, 0xc6, 0xf3, 0x8c, 0x41,
+        0x5c, 0xd9, 0x8e, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x64, 0xdb, 0x8e, 0x41, 0xfb, 0xc0, 0x90, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x03, 0xc3, 0x90, 0x41, 0x99, 0xa8, 0x92, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x03, 0xc3, 0x90, 0x41, 0x37, 0x90, 0x94, 0x41, 0x36, 0x50, 0x01, 0x00, 0xa1, 0xaa, 0x92, 0x41,
+        0x37, 0x90, 0x94, 0x41, 0x45, 0x50, 0x00, 0x00, 0x3f, 0x92, 0x94, 0x41, 0x74, 0x5f, 0x98, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x3f, 0x92, 0x94, 0x41, 0xb1, 0x2e, 0x9c, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x7c, 0x61, 0x98, 0x41, 0x12, 0x47, 0x9a, 0x41, 0x48, 0x50, 0x00, 0x00, 0x1a, 0x49, 0x9a, 0x41,
+        0xb1, 0x2e, 0x9c, 0x41, 0x47, 0x50, 0x00, 0x00, 0xb9, 0x30, 0x9c, 0x41, 0x4f, 0x16, 0x9e, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0xb9, 0x30, 0x9c, 0x41, 0xed, 0xfd, 0x9f, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x57, 0x18, 0x9e, 0x41, 0xed, 0xfd, 0x9f, 0x41, 0x43, 0x50, 0x00, 0x00, 0xf6, 0xff, 0x9f, 0x41,
+        0x2a, 0xcd, 0xa3, 0x41, 0x45, 0x50, 0x00, 0x00, 0xf6, 0xff, 0x9f, 0x41, 0x2a, 0xcd, 0xa3, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0x32, 0xcf, 0xa3, 0x41, 0xc8, 0xb4, 0xa5, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x32, 0xcf, 0xa3, 0x41, 0x67, 0x9c, 0xa7, 0x41, 0x3e, 0x50, 0x01, 0x00, 0xd1, 0xb6, 0xa5, 0x41,
+        0x67, 0x9c, 0xa7, 0x41, 0x45, 0x50, 0x00, 0x00, 0x6f, 0x9e, 0xa7, 0x41, 0x05, 0x84, 0xa9, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x6f, 0x9e, 0xa7, 0x41, 0xa3, 0x6b, 0xab, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x0d, 0x86, 0xa9, 0x41, 0xa3, 0x6b, 0xab, 0x41, 0x42, 0x50, 0x00, 0x00, 0xac, 0x6d, 0xab, 0x41,
+        0x5a, 0xd9, 0xb6, 0x41, 0x43, 0x50, 0x00, 0x00, 0xac, 0x6d, 0xab, 0x41, 0x1d, 0x0a, 0xb3, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x25, 0x0c, 0xb3, 0x41, 0x5a, 0xd9, 0xb6, 0x41, 0x2b, 0x50, 0x01, 0x00,
+        0x62, 0xdb, 0xb6, 0x41, 0x96, 0xa8, 0xba, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x62, 0xdb, 0xb6, 0x41,
+        0xd3, 0x77, 0xbe, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x62, 0xdb, 0xb6, 0x41, 0xd3, 0x77, 0xbe, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x62, 0xdb, 0xb6, 0x41, 0xd3, 0x77, 0xbe, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x9e, 0xaa, 0xba, 0x41, 0x35, 0x90, 0xbc, 0x41, 0x43, 0x50, 0x00, 0x00, 0x3d, 0x92, 0xbc, 0x41,
+        0xd3, 0x77, 0xbe, 0x41, 0x45, 0x50, 0x00, 0x00, 0xdb, 0x79, 0xbe, 0x41, 0x71, 0x5f, 0xc0, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0xdb, 0x79, 0xbe, 0x41, 0x10, 0x47, 0xc2, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x79, 0x61, 0xc0, 0x41, 0x10, 0x47, 0xc2, 0x41, 0x48, 0x50, 0x00, 0x00, 0x18, 0x49, 0xc2, 0x41,
+        0x4c, 0x16, 0xc6, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x18, 0x49, 0xc2, 0x41, 0xc6, 0xb4, 0xcd, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x55, 0x18, 0xc6, 0x41, 0x89, 0xe5, 0xc9, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x91, 0xe7, 0xc9, 0x41, 0x27, 0xcd, 0xcb, 0x41, 0x43, 0x50, 0x00, 0x00, 0xce, 0xb6, 0xcd, 0x41,
+        0x03, 0x84, 0xd1, 0x41, 0x4c, 0x50, 0x00, 0x00, 0xce, 0xb6, 0xcd, 0x41, 0x7c, 0x22, 0xd9, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0x0b, 0x86, 0xd1, 0x41, 0xa1, 0x6b, 0xd3, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0xa9, 0x6d, 0xd3, 0x41, 0x3f, 0x53, 0xd5, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x47, 0x55, 0xd5, 0x41,
+        0xde, 0x3a, 0xd7, 0x41, 0x4c, 0x50, 0x00, 0x00, 0xe6, 0x3c, 0xd7, 0x41, 0x7c, 0x22, 0xd9, 0x41,
+        0x4e, 0x50, 0x00, 0x00, 0x84, 0x24, 0xd9, 0x41, 0xb9, 0xf1, 0xdc, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0x84, 0x24, 0xd9, 0x41, 0x32, 0x90, 0xe4, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xc1, 0xf3, 0xdc, 0x41,
+        0xf5, 0xc0, 0xe0, 0x41, 0x43, 0x50, 0x00, 0x00, 0xfd, 0xc2, 0xe0, 0x41, 0x94, 0xa8, 0xe2, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x3a, 0x92, 0xe4, 0x41, 0x6f, 0x5f, 0xe8, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x3a, 0x92, 0xe4, 0x41, 0xe8, 0xfd, 0xef, 0x41, 0x39, 0x50, 0x01, 0x00, 0x77, 0x61, 0xe8, 0x41,
+        0x0d, 0x47, 0xea, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x15, 0x49, 0xea, 0x41, 0xab, 0x2e, 0xec, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0xb4, 0x30, 0xec, 0x41, 0x4a, 0x16, 0xee, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x52, 0x18, 0xee, 0x41, 0xe8, 0xfd, 0xef, 0x41, 0x45, 0x50, 0x00, 0x00, 0xf0, 0xff, 0xef, 0x41,
+        0x25, 0xcd, 0xf3, 0x41, 0x47, 0x50, 0x00, 0x00, 0xf0, 0xff, 0xef, 0x41, 0x9e, 0x6b, 0xfb, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x2d, 0xcf, 0xf3, 0x41, 0xc3, 0xb4, 0xf5, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0xcb, 0xb6, 0xf5, 0x41, 0x62, 0x9c, 0xf7, 0x41, 0x47, 0x50, 0x00, 0x00, 0x6a, 0x9e, 0xf7, 0x41,
+        0x00, 0x84, 0xf9, 0x41, 0x45, 0x50, 0x00, 0x00, 0x08, 0x86, 0xf9, 0x41, 0x9e, 0x6b, 0xfb, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0xa6, 0x6d, 0xfb, 0x41, 0xdb, 0x3a, 0xff, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0xa6, 0x6d, 0xfb, 0x41, 0xdb, 0x3a, 0xff, 0x41, 0x3e, 0x50, 0x01, 0x00, 0xe3, 0x3c, 0xff, 0x41,
+        0x3d, 0x91, 0x00, 0x42, 0x43, 0x50, 0x00, 0x00, 0xe3, 0x3c, 0xff, 0x41, 0x0c, 0x85, 0x01, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x41, 0x92, 0x00, 0x42, 0x0c, 0x85, 0x01, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x10, 0x86, 0x01, 0x42, 0xdb, 0x78, 0x02, 0x42, 0x47, 0x50, 0x00, 0x00, 0x10, 0x86, 0x01, 0x42,
+        0xaa, 0x6c, 0x03, 0x42, 0x37, 0x50, 0x01, 0x00, 0xdf, 0x79, 0x02, 0x42, 0xaa, 0x6c, 0x03, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xae, 0x6d, 0x03, 0x42, 0x79, 0x60, 0x04, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xae, 0x6d, 0x03, 0x42, 0x49, 0x54, 0x05, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x7d, 0x61, 0x04, 0x42,
+        0x54, 0x17, 0x0a, 0x42, 0x45, 0x50, 0x00, 0x00, 0x4d, 0x55, 0x05, 0x42, 0x18, 0x48, 0x06, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x1c, 0x49, 0x06, 0x42, 0xe7, 0x3b, 0x07, 0x42, 0x3c, 0x50, 0x01, 0x00,
+        0xeb, 0x3c, 0x07, 0x42, 0xb6, 0x2f, 0x08, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xba, 0x30, 0x08, 0x42,
+        0x85, 0x23, 0x09, 0x42, 0x39, 0x50, 0x01, 0x00, 0x89, 0x24, 0x09, 0x42, 0x24, 0x0b, 0x0b, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x89, 0x24, 0x09, 0x42, 0xc2, 0xf2, 0x0c, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x28, 0x0c, 0x0b, 0x42, 0xf3, 0xfe, 0x0b, 0x42, 0x43, 0x50, 0x00, 0x00, 0xf7, 0xff, 0x0b, 0x42,
+        0xc2, 0xf2, 0x0c, 0x42, 0x45, 0x50, 0x00, 0x00, 0xc6, 0xf3, 0x0c, 0x42, 0x91, 0xe6, 0x0d, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xc6, 0xf3, 0x0c, 0x42, 0x60, 0xda, 0x0e, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x95, 0xe7, 0x0d, 0x42, 0x60, 0xda, 0x0e, 0x42, 0x48, 0x50, 0x00, 0x00, 0x64, 0xdb, 0x0e, 0x42,
+        0xff, 0xc1, 0x10, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x64, 0xdb, 0x0e, 0x42, 0xff, 0xc1, 0x10, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x03, 0xc3, 0x10, 0x42, 0x9d, 0xa9, 0x12, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x03, 0xc3, 0x10, 0x42, 0x9d, 0xa9, 0x12, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xa1, 0xaa, 0x12, 0x42,
+        0x6c, 0x9d, 0x13, 0x42, 0x43, 0x50, 0x00, 0x00, 0xa1, 0xaa, 0x12, 0x42, 0x3b, 0x91, 0x14, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x3f, 0x92, 0x14, 0x42, 0xda, 0x78, 0x16, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x3f, 0x92, 0x14, 0x42, 0x16, 0x48, 0x1a, 0x42, 0x3c, 0x50, 0x01, 0x00, 0xde, 0x79, 0x16, 0x42,
+        0xa9, 0x6c, 0x17, 0x42, 0x48, 0x50, 0x00, 0x00, 0xad, 0x6d, 0x17, 0x42, 0x78, 0x60, 0x18, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x7c, 0x61, 0x18, 0x42, 0x47, 0x54, 0x19, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x4b, 0x55, 0x19, 0x42, 0x16, 0x48, 0x1a, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1a, 0x49, 0x1a, 0x42,
+        0xb5, 0x2f, 0x1c, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x1a, 0x49, 0x1a, 0x42, 0xb5, 0x2f, 0x1c, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xb9, 0x30, 0x1c, 0x42, 0x53, 0x17, 0x1e, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xb9, 0x30, 0x1c, 0x42, 0x84, 0x23, 0x1d, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x88, 0x24, 0x1d, 0x42,
+        0x53, 0x17, 0x1e, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x57, 0x18, 0x1e, 0x42, 0xf1, 0xfe, 0x1f, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x57, 0x18, 0x1e, 0x42, 0x22, 0x0b, 0x1f, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x26, 0x0c, 0x1f, 0x42, 0xf1, 0xfe, 0x1f, 0x42, 0x37, 0x50, 0x01, 0x00, 0xf6, 0xff, 0x1f, 0x42,
+        0x90, 0xe6, 0x21, 0x42, 0x48, 0x50, 0x00, 0x00, 0xf6, 0xff, 0x1f, 0x42, 0x2e, 0xce, 0x23, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x94, 0xe7, 0x21, 0x42, 0x5f, 0xda, 0x22, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x63, 0xdb, 0x22, 0x42, 0x2e, 0xce, 0x23, 0x42, 0x48, 0x50, 0x00, 0x00, 0x32, 0xcf, 0x23, 0x42,
+        0xfd, 0xc1, 0x24, 0x42, 0x47, 0x50, 0x00, 0x00, 0x32, 0xcf, 0x23, 0x42, 0xcd, 0xb5, 0x25, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x01, 0xc3, 0x24, 0x42, 0xcd, 0xb5, 0x25, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xd1, 0xb6, 0x25, 0x42, 0x6b, 0x9d, 0x27, 0x42, 0x47, 0x50, 0x00, 0x00, 0xd1, 0xb6, 0x25, 0x42,
+        0x09, 0x85, 0x29, 0x42, 0x37, 0x50, 0x01, 0x00, 0x6f, 0x9e, 0x27, 0x42, 0x3a, 0x91, 0x28, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x3e, 0x92, 0x28, 0x42, 0x09, 0x85, 0x29, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x0d, 0x86, 0x29, 0x42, 0xd8, 0x78, 0x2a, 0x42, 0x45, 0x50, 0x00, 0x00, 0x0d, 0x86, 0x29, 0x42,
+        0xa8, 0x6c, 0x2b, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xdc, 0x79, 0x2a, 0x42, 0xa8, 0x6c, 0x2b, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xac, 0x6d, 0x2b, 0x42, 0x46, 0x54, 0x2d, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xac, 0x6d, 0x2b, 0x42, 0x46, 0x54, 0x2d, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x4a, 0x55, 0x2d, 0x42,
+        0x15, 0x48, 0x2e, 0x42, 0x47, 0x50, 0x00, 0x00, 0x4a, 0x55, 0x2d, 0x42, 0xe4, 0x3b, 0x2f, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x19, 0x49, 0x2e, 0x42, 0xe4, 0x3b, 0x2f, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xe8, 0x3c, 0x2f, 0x42, 0xb3, 0x2f, 0x30, 0x42, 0x43, 0x50, 0x00, 0x00, 0xe8, 0x3c, 0x2f, 0x42,
+        0x83, 0x23, 0x31, 0x42, 0x32, 0x50, 0x01, 0x00, 0xb8, 0x30, 0x30, 0x42, 0x83, 0x23, 0x31, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x87, 0x24, 0x31, 0x42, 0x5e, 0xda, 0x36, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x87, 0x24, 0x31, 0x42, 0xbf, 0xf2, 0x34, 0x42, 0x37, 0x50, 0x01, 0x00, 0xc3, 0xf3, 0x34, 0x42,
+        0x5e, 0xda, 0x36, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x62, 0xdb, 0x36, 0x42, 0xfc, 0xc1, 0x38, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x62, 0xdb, 0x36, 0x42, 0x39, 0x91, 0x3c, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc3, 0x38, 0x42, 0xcb, 0xb5, 0x39, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xcf, 0xb6, 0x39, 0x42,
+        0x9a, 0xa9, 0x3a, 0x42, 0x51, 0x50, 0x00, 0x00, 0x9e, 0xaa, 0x3a, 0x42, 0x6a, 0x9d, 0x3b, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x6e, 0x9e, 0x3b, 0x42, 0x39, 0x91, 0x3c, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x3d, 0x92, 0x3c, 0x42, 0xd7, 0x78, 0x3e, 0x42, 0x51, 0x50, 0x00, 0x00, 0x3d, 0x92, 0x3c, 0x42,
+        0x14, 0x48, 0x42, 0x42, 0x36, 0x50, 0x01, 0x00, 0xdb, 0x79, 0x3e, 0x42, 0xa6, 0x6c, 0x3f, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xaa, 0x6d, 0x3f, 0x42, 0x75, 0x60, 0x40, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x79, 0x61, 0x40, 0x42, 0x45, 0x54, 0x41, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x49, 0x55, 0x41, 0x42,
+        0x14, 0x48, 0x42, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x18, 0x49, 0x42, 0x42, 0xb2, 0x2f, 0x44, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x18, 0x49, 0x42, 0x42, 0xb2, 0x2f, 0x44, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0xb6, 0x30, 0x44, 0x42, 0x81, 0x23, 0x45, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xb6, 0x30, 0x44, 0x42,
+        0x50, 0x17, 0x46, 0x42, 0x37, 0x50, 0x01, 0x00, 0x85, 0x24, 0x45, 0x42, 0x50, 0x17, 0x46, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x55, 0x18, 0x46, 0x42, 0x20, 0x0b, 0x47, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x55, 0x18, 0x46, 0x42, 0xef, 0xfe, 0x47, 0x42, 0x34, 0x50, 0x01, 0x00, 0x24, 0x0c, 0x47, 0x42,
+        0xef, 0xfe, 0x47, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xf3, 0xff, 0x47, 0x42, 0x8d, 0xe6, 0x49, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0xf3, 0xff, 0x47, 0x42, 0x2c, 0xce, 0x4b, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x91, 0xe7, 0x49, 0x42, 0x5c, 0xda, 0x4a, 0x42, 0x47, 0x50, 0x00, 0x00, 0x60, 0xdb, 0x4a, 0x42,
+        0x2c, 0xce, 0x4b, 0x42, 0x49, 0x50, 0x00, 0x00, 0x30, 0xcf, 0x4b, 0x42, 0xca, 0xb5, 0x4d, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x30, 0xcf, 0x4b, 0x42, 0xca, 0xb5, 0x4d, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0xce, 0xb6, 0x4d, 0x42, 0x99, 0xa9, 0x4e, 0x42, 0x45, 0x50, 0x00, 0x00, 0xce, 0xb6, 0x4d, 0x42,
+        0xa5, 0x6c, 0x53, 0x42, 0x39, 0x50, 0x01, 0x00, 0x9d, 0xaa, 0x4e, 0x42, 0x68, 0x9d, 0x4f, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x6c, 0x9e, 0x4f, 0x42, 0x37, 0x91, 0x50, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x3b, 0x92, 0x50, 0x42, 0x07, 0x85, 0x51, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x0b, 0x86, 0x51, 0x42,
+        0xd6, 0x78, 0x52, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xda, 0x79, 0x52, 0x42, 0xa5, 0x6c, 0x53, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0xa9, 0x6d, 0x53, 0x42, 0x43, 0x54, 0x55, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0xa9, 0x6d, 0x53, 0x42, 0x74, 0x60, 0x54, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x47, 0x55, 0x55, 0x42,
+        0xe2, 0x3b, 0x57, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x47, 0x55, 0x55, 0x42, 0x12, 0x48, 0x56, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0xe6, 0x3c, 0x57, 0x42, 0x80, 0x23, 0x59, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0xe6, 0x3c, 0x57, 0x42, 0xb1, 0x2f, 0x58, 0x42, 0x3d, 0x50, 0x01, 0x00, 0x84, 0x24, 0x59, 0x42,
+        0x1e, 0x0b, 0x5b, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x84, 0x24, 0x59, 0x42, 0x4f, 0x17, 0x5a, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x22, 0x0c, 0x5b, 0x42, 0xbd, 0xf2, 0x5c, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x22, 0x0c, 0x5b, 0x42, 0xee, 0xfe, 0x5b, 0x42, 0x36, 0x50, 0x01, 0x00, 0xc1, 0xf3, 0x5c, 0x42,
+        0x5b, 0xda, 0x5e, 0x42, 0x49, 0x50, 0x00, 0x00, 0xc1, 0xf3, 0x5c, 0x42, 0x8c, 0xe6, 0x5d, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x5f, 0xdb, 0x5e, 0x42, 0x36, 0x91, 0x64, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x5f, 0xdb, 0x5e, 0x42, 0xf9, 0xc1, 0x60, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xfd, 0xc2, 0x60, 0x42,
+        0x98, 0xa9, 0x62, 0x42, 0x32, 0x50, 0x01, 0x00, 0x9c, 0xaa, 0x62, 0x42, 0x36, 0x91, 0x64, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0x3a, 0x92, 0x64, 0x42, 0xd4, 0x78, 0x66, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x3a, 0x92, 0x64, 0x42, 0x73, 0x60, 0x68, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xd9, 0x79, 0x66, 0x42,
+        0xa4, 0x6c, 0x67, 0x42, 0x43, 0x50, 0x00, 0x00, 0xd9, 0x79, 0x66, 0x42, 0x11, 0x48, 0x6a, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0xa8, 0x6d, 0x67, 0x42, 0x73, 0x60, 0x68, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x77, 0x61, 0x68, 0x42, 0x11, 0x48, 0x6a, 0x42, 0x43, 0x50, 0x00, 0x00, 0x77, 0x61, 0x68, 0x42,
+        0x11, 0x48, 0x6a, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x15, 0x49, 0x6a, 0x42, 0xb0, 0x2f, 0x6c, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x15, 0x49, 0x6a, 0x42, 0x4e, 0x17, 0x6e, 0x42, 0x3c, 0x50, 0x01, 0x00,
+        0xb4, 0x30, 0x6c, 0x42, 0x7f, 0x23, 0x6d, 0x42, 0x43, 0x50, 0x00, 0x00, 0xb4, 0x30, 0x6c, 0x42,
+        0xec, 0xfe, 0x6f, 0x42, 0x40, 0x50, 0x01, 0x00, 0x83, 0x24, 0x6d, 0x42, 0x4e, 0x17, 0x6e, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x52, 0x18, 0x6e, 0x42, 0xec, 0xfe, 0x6f, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x52, 0x18, 0x6e, 0x42, 0xec, 0xfe, 0x6f, 0x42, 0x3c, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x6f, 0x42,
+        0x8b, 0xe6, 0x71, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xf0, 0xff, 0x6f, 0x42, 0x8b, 0xe6, 0x71, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x8f, 0xe7, 0x71, 0x42, 0x29, 0xce, 0x73, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x8f, 0xe7, 0x71, 0x42, 0x29, 0xce, 0x73, 0x42, 0x39, 0x50, 0x01, 0x00, 0x2d, 0xcf, 0x73, 0x42,
+        0xc7, 0xb5, 0x75, 0x42, 0x47, 0x50, 0x00, 0x00, 0x2d, 0xcf, 0x73, 0x42, 0xc7, 0xb5, 0x75, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0xcb, 0xb6, 0x75, 0x42, 0x96, 0xa9, 0x76, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xcb, 0xb6, 0x75, 0x42, 0x04, 0x85, 0x79, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x9b, 0xaa, 0x76, 0x42,
+        0x66, 0x9d, 0x77, 0x42, 0x43, 0x50, 0x00, 0x00, 0x6a, 0x9e, 0x77, 0x42, 0x35, 0x91, 0x78, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x39, 0x92, 0x78, 0x42, 0x04, 0x85, 0x79, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x08, 0x86, 0x79, 0x42, 0xa2, 0x6c, 0x7b, 0x42, 0x45, 0x50, 0x00, 0x00, 0xa6, 0x6d, 0x7b, 0x42,
+        0x71, 0x60, 0x7c, 0x42, 0x3e, 0x50, 0x00, 0x00, 0xa6, 0x6d, 0x7b, 0x42, 0xbf, 0x91, 0x80, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x76, 0x61, 0x7c, 0x42, 0x41, 0x54, 0x7d, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x45, 0x55, 0x7d, 0x42, 0x10, 0x48, 0x7e, 0x42, 0x42, 0x50, 0x00, 0x00, 0x14, 0x49, 0x7e, 0x42,
+        0xdf, 0x3b, 0x7f, 0x42, 0x43, 0x50, 0x00, 0x00, 0xe3, 0x3c, 0x7f, 0x42, 0xd7, 0x17, 0x80, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xe3, 0x3c, 0x7f, 0x42, 0xbf, 0x91, 0x80, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x59, 0x18, 0x80, 0x42, 0xbf, 0x91, 0x80, 0x42, 0x47, 0x50, 0x00, 0x00, 0x41, 0x92, 0x80, 0x42,
+        0x8e, 0x85, 0x81, 0x42, 0x48, 0x50, 0x00, 0x00, 0x41, 0x92, 0x80, 0x42, 0x8e, 0x85, 0x81, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x10, 0x86, 0x81, 0x42, 0x5d, 0x79, 0x82, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x10, 0x86, 0x81, 0x42, 0x5d, 0x79, 0x82, 0x42, 0x37, 0x50, 0x01, 0x00, 0xdf, 0x79, 0x82, 0x42,
+        0x2c, 0x6d, 0x83, 0x42, 0x45, 0x50, 0x00, 0x00, 0xdf, 0x79, 0x82, 0x42, 0x2c, 0x6d, 0x83, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0xae, 0x6d, 0x83, 0x42, 0x14, 0xe7, 0x83, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xae, 0x6d, 0x83, 0x42, 0xfb, 0x60, 0x84, 0x42, 0x37, 0x50, 0x01, 0x00, 0x96, 0xe7, 0x83, 0x42,
+        0xfb, 0x60, 0x84, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x7d, 0x61, 0x84, 0x42, 0xcb, 0x54, 0x85, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x7d, 0x61, 0x84, 0x42, 0xcb, 0x54, 0x85, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0x4d, 0x55, 0x85, 0x42, 0x9a, 0x48, 0x86, 0x42, 0x42, 0x50, 0x00, 0x00, 0x4d, 0x55, 0x85, 0x42,
+        0x9a, 0x48, 0x86, 0x42, 0x32, 0x50, 0x01, 0x00, 0x1c, 0x49, 0x86, 0x42, 0x07, 0x24, 0x89, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x1c, 0x49, 0x86, 0x42, 0x07, 0x24, 0x89, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x1c, 0x49, 0x86, 0x42, 0x07, 0x24, 0x89, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x1c, 0x49, 0x86, 0x42,
+        0x69, 0x3c, 0x87, 0x42, 0x37, 0x50, 0x01, 0x00, 0xeb, 0x3c, 0x87, 0x42, 0x38, 0x30, 0x88, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xba, 0x30, 0x88, 0x42, 0x07, 0x24, 0x89, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x89, 0x24, 0x89, 0x42, 0xd6, 0x17, 0x8a, 0x42, 0x53, 0x50, 0x00, 0x00, 0x89, 0x24, 0x89, 0x42,
+        0x75, 0xff, 0x8b, 0x42, 0x37, 0x50, 0x01, 0x00, 0x58, 0x18, 0x8a, 0x42, 0xbe, 0x91, 0x8a, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x40, 0x92, 0x8a, 0x42, 0xa6, 0x0b, 0x8b, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x28, 0x0c, 0x8b, 0x42, 0x8d, 0x85, 0x8b, 0x42, 0x53, 0x50, 0x00, 0x00, 0x0f, 0x86, 0x8b, 0x42,
+        0x75, 0xff, 0x8b, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xf7, 0xff, 0x8b, 0x42, 0x44, 0xf3, 0x8c, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0xf7, 0xff, 0x8b, 0x42, 0xe2, 0xda, 0x8e, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0xc6, 0xf3, 0x8c, 0x42, 0x2c, 0x6d, 0x8d, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xae, 0x6d, 0x8d, 0x42,
+        0x13, 0xe7, 0x8d, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x95, 0xe7, 0x8d, 0x42, 0xfb, 0x60, 0x8e, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x7d, 0x61, 0x8e, 0x42, 0xe2, 0xda, 0x8e, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x64, 0xdb, 0x8e, 0x42, 0xb1, 0xce, 0x8f, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x64, 0xdb, 0x8e, 0x42,
+        0xb1, 0xce, 0x8f, 0x42, 0x34, 0x50, 0x01, 0x00, 0x34, 0xcf, 0x8f, 0x42, 0x99, 0x48, 0x90, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x34, 0xcf, 0x8f, 0x42, 0x81, 0xc2, 0x90, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x1b, 0x49, 0x90, 0x42, 0x81, 0xc2, 0x90, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x03, 0xc3, 0x90, 0x42,
+        0x68, 0x3c, 0x91, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x03, 0xc3, 0x90, 0x42, 0x50, 0xb6, 0x91, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0xea, 0x3c, 0x91, 0x42, 0x50, 0xb6, 0x91, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xd2, 0xb6, 0x91, 0x42, 0x1f, 0xaa, 0x92, 0x42, 0x49, 0x50, 0x00, 0x00, 0xd2, 0xb6, 0x91, 0x42,
+        0xee, 0x9d, 0x93, 0x42, 0x39, 0x50, 0x01, 0x00, 0xa1, 0xaa, 0x92, 0x42, 0x07, 0x24, 0x93, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x89, 0x24, 0x93, 0x42, 0xee, 0x9d, 0x93, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x70, 0x9e, 0x93, 0x42, 0xbd, 0x91, 0x94, 0x42, 0x45, 0x50, 0x00, 0x00, 0x70, 0x9e, 0x93, 0x42,
+        0xbd, 0x91, 0x94, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x3f, 0x92, 0x94, 0x42, 0xa5, 0x0b, 0x95, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x3f, 0x92, 0x94, 0x42, 0x2b, 0x6d, 0x97, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x27, 0x0c, 0x95, 0x42, 0x8d, 0x85, 0x95, 0x42, 0x47, 0x50, 0x00, 0x00, 0x0f, 0x86, 0x95, 0x42,
+        0x74, 0xff, 0x95, 0x42, 0x49, 0x50, 0x00, 0x00, 0xf6, 0xff, 0x95, 0x42, 0x5c, 0x79, 0x96, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xde, 0x79, 0x96, 0x42, 0x43, 0xf3, 0x96, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0xc5, 0xf3, 0x96, 0x42, 0x2b, 0x6d, 0x97, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xad, 0x6d, 0x97, 0x42,
+        0xfa, 0x60, 0x98, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xad, 0x6d, 0x97, 0x42, 0x12, 0xe7, 0x97, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x7c, 0x61, 0x98, 0x42, 0xc9, 0x54, 0x99, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x7c, 0x61, 0x98, 0x42, 0xe2, 0xda, 0x98, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x4b, 0x55, 0x99, 0x42,
+        0x98, 0x48, 0x9a, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x4b, 0x55, 0x99, 0x42, 0xb1, 0xce, 0x99, 0x42,
+        0x3d, 0x50, 0x01, 0x00, 0x1a, 0x49, 0x9a, 0x42, 0x68, 0x3c, 0x9b, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x1a, 0x49, 0x9a, 0x42, 0x80, 0xc2, 0x9a, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xea, 0x3c, 0x9b, 0x42,
+        0x37, 0x30, 0x9c, 0x42, 0x45, 0x50, 0x00, 0x00, 0xea, 0x3c, 0x9b, 0x42, 0x4f, 0xb6, 0x9b, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0xb9, 0x30, 0x9c, 0x42, 0x06, 0x24, 0x9d, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0xb9, 0x30, 0x9c, 0x42, 0x1e, 0xaa, 0x9c, 0x42, 0x39, 0x50, 0x01, 0x00, 0x88, 0x24, 0x9d, 0x42,
+        0x73, 0xff, 0x9f, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x88, 0x24, 0x9d, 0x42, 0xd5, 0x17, 0x9e, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x57, 0x18, 0x9e, 0x42, 0xa4, 0x0b, 0x9f, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x26, 0x0c, 0x9f, 0x42, 0x73, 0xff, 0x9f, 0x42, 0x3c, 0x50, 0x01, 0x00, 0xf6, 0xff, 0x9f, 0x42,
+        0x43, 0xf3, 0xa0, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xf6, 0xff, 0x9f, 0x42, 0x12, 0xe7, 0xa1, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xc5, 0xf3, 0xa0, 0x42, 0x2a, 0x6d, 0xa1, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xc5, 0xf3, 0xa0, 0x42, 0xe1, 0xda, 0xa2, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xac, 0x6d, 0xa1, 0x42,
+        0x12, 0xe7, 0xa1, 0x42, 0x42, 0x50, 0x00, 0x00, 0x94, 0xe7, 0xa1, 0x42, 0xe1, 0xda, 0xa2, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x94, 0xe7, 0xa1, 0x42, 0xe1, 0xda, 0xa2, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x63, 0xdb, 0xa2, 0x42, 0xb0, 0xce, 0xa3, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x63, 0xdb, 0xa2, 0x42,
+        0x7f, 0xc2, 0xa4, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x32, 0xcf, 0xa3, 0x42, 0x98, 0x48, 0xa4, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x32, 0xcf, 0xa3, 0x42, 0x4f, 0xb6, 0xa5, 0x42, 0x40, 0x50, 0x01, 0x00,
+        0x1a, 0x49, 0xa4, 0x42, 0x7f, 0xc2, 0xa4, 0x42, 0x42, 0x50, 0x00, 0x00, 0x01, 0xc3, 0xa4, 0x42,
+        0x4f, 0xb6, 0xa5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x01, 0xc3, 0xa4, 0x42, 0x4f, 0xb6, 0xa5, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0xd1, 0xb6, 0xa5, 0x42, 0x1e, 0xaa, 0xa6, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xd1, 0xb6, 0xa5, 0x42, 0x1e, 0xaa, 0xa6, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xa0, 0xaa, 0xa6, 0x42,
+        0xed, 0x9d, 0xa7, 0x42, 0x48, 0x50, 0x00, 0x00, 0xa0, 0xaa, 0xa6, 0x42, 0xed, 0x9d, 0xa7, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x6f, 0x9e, 0xa7, 0x42, 0xbc, 0x91, 0xa8, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x6f, 0x9e, 0xa7, 0x42, 0xbc, 0x91, 0xa8, 0x42, 0x37, 0x50, 0x01, 0x00, 0x3e, 0x92, 0xa8, 0x42,
+        0xa4, 0x0b, 0xa9, 0x42, 0x45, 0x50, 0x00, 0x00, 0x3e, 0x92, 0xa8, 0x42, 0x5a, 0x79, 0xaa, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x26, 0x0c, 0xa9, 0x42, 0x8b, 0x85, 0xa9, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x0d, 0x86, 0xa9, 0x42, 0x73, 0xff, 0xa9, 0x42, 0x42, 0x50, 0x00, 0x00, 0xf5, 0xff, 0xa9, 0x42,
+        0x5a, 0x79, 0xaa, 0x42, 0x43, 0x50, 0x00, 0x00, 0xdc, 0x79, 0xaa, 0x42, 0x2a, 0x6d, 0xab, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xac, 0x6d, 0xab, 0x42, 0x11, 0xe7, 0xab, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0xac, 0x6d, 0xab, 0x42, 0x97, 0x48, 0xae, 0x42, 0x32, 0x50, 0x01, 0x00, 0x93, 0xe7, 0xab, 0x42,
+        0xf9, 0x60, 0xac, 0x42, 0x40, 0x50, 0x00, 0x00, 0x7b, 0x61, 0xac, 0x42, 0xe0, 0xda, 0xac, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x62, 0xdb, 0xac, 0x42, 0xc8, 0x54, 0xad, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x4a, 0x55, 0xad, 0x42, 0xb0, 0xce, 0xad, 0x42, 0x45, 0x50, 0x00, 0x00, 0x4a, 0x55, 0xad, 0x42,
+        0x97, 0x48, 0xae, 0x42, 0x36, 0x50, 0x01, 0x00, 0x32, 0xcf, 0xad, 0x42, 0x97, 0x48, 0xae, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x19, 0x49, 0xae, 0x42, 0x66, 0x3c, 0xaf, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x19, 0x49, 0xae, 0x42, 0x66, 0x3c, 0xaf, 0x42, 0x34, 0x50, 0x01, 0x00, 0xe8, 0x3c, 0xaf, 0x42,
+        0x35, 0x30, 0xb0, 0x42, 0x47, 0x50, 0x00, 0x00, 0xe8, 0x3c, 0xaf, 0x42, 0x35, 0x30, 0xb0, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0xb8, 0x30, 0xb0, 0x42, 0x05, 0x24, 0xb1, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xb8, 0x30, 0xb0, 0x42, 0x05, 0x24, 0xb1, 0x42, 0x36, 0x50, 0x01, 0x00, 0x87, 0x24, 0xb1, 0x42,
+        0xec, 0x9d, 0xb1, 0x42, 0x47, 0x50, 0x00, 0x00, 0x87, 0x24, 0xb1, 0x42, 0xd4, 0x17, 0xb2, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x6e, 0x9e, 0xb1, 0x42, 0xd4, 0x17, 0xb2, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x56, 0x18, 0xb2, 0x42, 0xa3, 0x0b, 0xb3, 0x42, 0x43, 0x50, 0x00, 0x00, 0x56, 0x18, 0xb2, 0x42,
+        0xa3, 0x0b, 0xb3, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x25, 0x0c, 0xb3, 0x42, 0x72, 0xff, 0xb3, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x25, 0x0c, 0xb3, 0x42, 0x72, 0xff, 0xb3, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xf4, 0xff, 0xb3, 0x42, 0xe0, 0xda, 0xb6, 0x42, 0x43, 0x50, 0x00, 0x00, 0xf4, 0xff, 0xb3, 0x42,
+        0xe0, 0xda, 0xb6, 0x42, 0x3e, 0x50, 0x00, 0x00, 0xf4, 0xff, 0xb3, 0x42, 0xe0, 0xda, 0xb6, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0xf4, 0xff, 0xb3, 0x42, 0x41, 0xf3, 0xb4, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0xc3, 0xf3, 0xb4, 0x42, 0x11, 0xe7, 0xb5, 0x42, 0x32, 0x50, 0x01, 0x00, 0x93, 0xe7, 0xb5, 0x42,
+        0xe0, 0xda, 0xb6, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x78, 0x56, 0x40,
+        0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x78, 0x56, 0x40, 0x48, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xa9, 0x78, 0x56, 0x40, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xa9, 0x78, 0x56, 0x40, 0x34, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x78, 0x56, 0x40,
+        0x39, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x78, 0x56, 0x40, 0x3c, 0x40, 0x01, 0x00,
+        0x15, 0xe2, 0x61, 0x40, 0xd4, 0xb4, 0x8b, 0x40, 0x3c, 0x21, 0x00, 0x00, 0x15, 0xe2, 0x61, 0x40,
+        0xd4, 0xb4, 0x8b, 0x40, 0x40, 0x21, 0x00, 0x00, 0x15, 0xe2, 0x61, 0x40, 0xd4, 0xb4, 0x8b, 0x40,
+        0x2d, 0x21, 0x01, 0x00, 0x4d, 0x2d, 0x8d, 0x40, 0xab, 0x87, 0x9a, 0x40, 0x3c, 0x21, 0x00, 0x00,
+        0x4d, 0x2d, 0x8d, 0x40, 0xab, 0x87, 0x9a, 0x40, 0x40, 0x21, 0x00, 0x00, 0x4d, 0x2d, 0x8d, 0x40,
+        0xab, 0x87, 0x9a, 0x40, 0x2d, 0x21, 0x01, 0x00, 0x6f, 0x4b, 0x9b, 0x40, 0xcc, 0xa5, 0xa8, 0x40,
+        0x3c, 0x21, 0x00, 0x00, 0x6f, 0x4b, 0x9b, 0x40, 0xcc, 0xa5, 0xa8, 0x40, 0x40, 0x21, 0x00, 0x00,
+        0x6f, 0x4b, 0x9b, 0x40, 0xcc, 0xa5, 0xa8, 0x40, 0x2d, 0x21, 0x01, 0x00, 0x90, 0x69, 0xa9, 0x40,
+        0x5a, 0x2d, 0xc4, 0x40, 0x3b, 0x21, 0x00, 0x00, 0x90, 0x69, 0xa9, 0x40, 0x5a, 0x2d, 0xc4, 0x40,
+        0x40, 0x21, 0x00, 0x00, 0x90, 0x69, 0xa9, 0x40, 0x5a, 0x2d, 0xc4, 0x40, 0x2c, 0x21, 0x01, 0x00,
+        0xd3, 0xa5, 0xc5, 0x40, 0x9c, 0x69, 0xe0, 0x40, 0x3b, 0x21, 0x00, 0x00, 0xd3, 0xa5, 0xc5, 0x40,
+        0x9c, 0x69, 0xe0, 0x40, 0x40, 0x21, 0x00, 0x00, 0xd3, 0xa5, 0xc5, 0x40, 0x9c, 0x69, 0xe0, 0x40,
+        0x2c, 0x21, 0x01, 0x00, 0x15, 0xe2, 0xe1, 0x40, 0xdf, 0xa5, 0xfc, 0x40, 0x3b, 0x21, 0x00, 0x00,
+        0x15, 0xe2, 0xe1, 0x40, 0xdf, 0xa5, 0xfc, 0x40, 0x40, 0x21, 0x00, 0x00, 0x15, 0xe2, 0xe1, 0x40,
+        0xdf, 0xa5, 0xfc, 0x40, 0x28, 0x21, 0x01, 0x00, 0x58, 0x1e, 0xfe, 0x40, 0x5b, 0xbc, 0x05, 0x41,
+        0x3b, 0x21, 0x00, 0x00, 0x58, 0x1e, 0xfe, 0x40, 0x5b, 0xbc, 0x05, 0x41, 0x40, 0x21, 0x00, 0x00,
+        0x58, 0x1e, 0xfe, 0x40, 0x5b, 0xbc, 0x05, 0x41, 0x28, 0x21, 0x01, 0x00, 0x3d, 0x1e, 0x06, 0x41,
+        0x6b, 0xcb, 0x0c, 0x41, 0x3b, 0x21, 0x00, 0x00, 0x3d, 0x1e, 0x06, 0x41, 0x6b, 0xcb, 0x0c, 0x41,
+        0x40, 0x21, 0x00, 0x00, 0x3d, 0x1e, 0x06, 0x41, 0x6b, 0xcb, 0x0c, 0x41, 0x28, 0x21, 0x01, 0x00,
+        0x4d, 0x2d, 0x0d, 0x41, 0x32, 0x8f, 0x1a, 0x41, 0x3c, 0x21, 0x00, 0x00, 0x4d, 0x2d, 0x0d, 0x41,
+        0x32, 0x8f, 0x1a, 0x41, 0x40, 0x21, 0x00, 0x00, 0x4d, 0x2d, 0x0d, 0x41, 0x32, 0x8f, 0x1a, 0x41,
+        0x2d, 0x21, 0x01, 0x00, 0x6f, 0x4b, 0x1b, 0x41, 0x53, 0xad, 0x28, 0x41, 0x3c, 0x21, 0x00, 0x00,
+        0x6f, 0x4b, 0x1b, 0x41, 0x53, 0xad, 0x28, 0x41, 0x40, 0x21, 0x00, 0x00, 0x6f, 0x4b, 0x1b, 0x41,
+        0x53, 0xad, 0x28, 0x41, 0x2d, 0x21, 0x01, 0x00, 0x90, 0x69, 0x29, 0x41, 0x75, 0xcb, 0x36, 0x41,
+        0x3c, 0x21, 0x00, 0x00, 0x90, 0x69, 0x29, 0x41, 0x75, 0xcb, 0x36, 0x41, 0x40, 0x21, 0x00, 0x00,
+        0x90, 0x69, 0x29, 0x41, 0x75, 0xcb, 0x36, 0x41, 0x2d, 0x21, 0x01, 0x00, 0xb1, 0x87, 0x37, 0x41,
+        0xe0, 0x34, 0x3e, 0x41, 0x3c, 0x21, 0x00, 0x00, 0xb1, 0x87, 0x37, 0x41, 0xe0, 0x34, 0x3e, 0x41,
+        0x40, 0x21, 0x00, 0x00, 0xb1, 0x87, 0x37, 0x41, 0xe0, 0x34, 0x3e, 0x41, 0x2d, 0x21, 0x01, 0x00,
+        0xc2, 0x96, 0x3e, 0x41, 0xf1, 0x43, 0x45, 0x41, 0x3c, 0x21, 0x00, 0x00, 0xc2, 0x96, 0x3e, 0x41,
+        0xf1, 0x43, 0x45, 0x41, 0x3e, 0x21, 0x00, 0x00, 0xc2, 0x96, 0x3e, 0x41, 0xf1, 0x43, 0x45, 0x41,
+        0x42, 0x21, 0x00, 0x00, 0xc2, 0x96, 0x3e, 0x41, 0xf1, 0x43, 0x45, 0x41, 0x2d, 0x21, 0x01, 0x00,
+        0xd3, 0xa5, 0x45, 0x41, 0xb7, 0x07, 0x53, 0x41, 0x3c, 0x21, 0x00, 0x00, 0xd3, 0xa5, 0x45, 0x41,
+        0xb7, 0x07, 0x53, 0x41, 0x40, 0x21, 0x00, 0x00, 0xd3, 0xa5, 0x45, 0x41, 0xb7, 0x07, 0x53, 0x41,
+        0x43, 0x21, 0x00, 0x00, 0xd3, 0xa5, 0x45, 0x41, 0xb7, 0x07, 0x53, 0x41, 0x2b, 0x21, 0x01, 0x00,
+        0xf4, 0xc3, 0x53, 0x41, 0xd9, 0x25, 0x61, 0x41, 0x3c, 0x21, 0x00, 0x00, 0xf4, 0xc3, 0x53, 0x41,
+        0xd9, 0x25, 0x61, 0x41, 0x40, 0x21, 0x00, 0x00, 0xf4, 0xc3, 0x53, 0x41, 0xd9, 0x25, 0x61, 0x41,
+        0x43, 0x21, 0x00, 0x00, 0xf4, 0xc3, 0x53, 0x41, 0xd9, 0x25, 0x61, 0x41, 0x2b, 0x21, 0x01, 0x00,
+        0x15, 0xe2, 0x61, 0x41, 0xfa, 0x43, 0x6f, 0x41, 0x3b, 0x21, 0x00, 0x00, 0x15, 0xe2, 0x61, 0x41,
+        0xfa, 0x43, 0x6f, 0x41, 0x3e, 0x21, 0x00, 0x00, 0x15, 0xe2, 0x61, 0x41, 0xfa, 0x43, 0x6f, 0x41,
+        0x43, 0x21, 0x00, 0x00, 0x15, 0xe2, 0x61, 0x41, 0xfa, 0x43, 0x6f, 0x41, 0x2b, 0x21, 0x01, 0x00,
+        0x37, 0x00, 0x70, 0x41, 0x65, 0xad, 0x76, 0x41, 0x39, 0x21, 0x00, 0x00, 0x37, 0x00, 0x70, 0x41,
+        0x65, 0xad, 0x76, 0x41, 0x3c, 0x21, 0x00, 0x00, 0x37, 0x00, 0x70, 0x41, 0x65, 0xad, 0x76, 0x41,
+        0x43, 0x21, 0x00, 0x00, 0x37, 0x00, 0x70, 0x41, 0x65, 0xad, 0x76, 0x41, 0x2b, 0x21, 0x01, 0x00,
+        0x47, 0x0f, 0x77, 0x41, 0x76, 0xbc, 0x7d, 0x41, 0x3b, 0x21, 0x00, 0x00, 0x47, 0x0f, 0x77, 0x41,
+        0x76, 0xbc, 0x7d, 0x41, 0x3e, 0x21, 0x00, 0x00, 0x47, 0x0f, 0x77, 0x41, 0x76, 0xbc, 0x7d, 0x41,
+        0x43, 0x21, 0x00, 0x00, 0x47, 0x0f, 0x77, 0x41, 0x76, 0xbc, 0x7d, 0x41, 0x2b, 0x21, 0x01, 0x00,
+        0x58, 0x1e, 0x7e, 0x41, 0xd5, 0x74, 0x8c, 0x41, 0x3c, 0x21, 0x00, 0x00, 0x58, 0x1e, 0x7e, 0x41,
+        0xd5, 0x74, 0x8c, 0x41, 0x40, 0x21, 0x00, 0x00, 0x58, 0x1e, 0x7e, 0x41, 0xd5, 0x74, 0x8c, 0x41,
+        0x43, 0x21, 0x00, 0x00, 0x58, 0x1e, 0x7e, 0x41, 0xd5, 0x74, 0x8c, 0x41, 0x30, 0x21, 0x01, 0x00,
+        0x4d, 0x2d, 0x8d, 0x41, 0x40, 0xde, 0x93, 0x41, 0x40, 0x21, 0x00, 0x00, 0x4d, 0x2d, 0x8d, 0x41,
+        0x40, 0xde, 0x93, 0x41, 0x43, 0x21, 0x00, 0x00, 0x4d, 0x2d, 0x8d, 0x41, 0x40, 0xde, 0x93, 0x41,
+        0x30, 0x21, 0x01, 0x00, 0x5e, 0x3c, 0x94, 0x41, 0xf5, 0x92, 0x97, 0x41, 0x40, 0x21, 0x00, 0x00,
+        0x5e, 0x3c, 0x94, 0x41, 0xf5, 0x92, 0x97, 0x41, 0x43, 0x21, 0x00, 0x00, 0x5e, 0x3c, 0x94, 0x41,
+        0xf5, 0x92, 0x97, 0x41, 0x30, 0x21, 0x01, 0x00, 0xe6, 0xc3, 0x97, 0x41, 0x7e, 0x1a, 0x9b, 0x41,
+        0x40, 0x21, 0x00, 0x00, 0xe6, 0xc3, 0x97, 0x41, 0x7e, 0x1a, 0x9b, 0x41, 0x45, 0x21, 0x00, 0x00,
+        0xe6, 0xc3, 0x97, 0x41, 0x7e, 0x1a, 0x9b, 0x41, 0x30, 0x21, 0x01, 0x00, 0x6f, 0x4b, 0x9b, 0x41,
+        0x61, 0xfc, 0xa1, 0x41, 0x3f, 0x21, 0x00, 0x00, 0x6f, 0x4b, 0x9b, 0x41, 0x61, 0xfc, 0xa1, 0x41,
+        0x47, 0x21, 0x00, 0x00, 0x6f, 0x4b, 0x9b, 0x41, 0x61, 0xfc, 0xa1, 0x41, 0x2f, 0x21, 0x01, 0x00,
+        0x7f, 0x5a, 0xa2, 0x41, 0x72, 0x0b, 0xa9, 0x41, 0x3f, 0x21, 0x00, 0x00, 0x7f, 0x5a, 0xa2, 0x41,
+        0x72, 0x0b, 0xa9, 0x41, 0x47, 0x21, 0x00, 0x00, 0x7f, 0x5a, 0xa2, 0x41, 0x72, 0x0b, 0xa9, 0x41,
+        0x2f, 0x21, 0x01, 0x00, 0x90, 0x69, 0xa9, 0x41, 0x82, 0x1a, 0xb0, 0x41, 0x3e, 0x21, 0x00, 0x00,
+        0x90, 0x69, 0xa9, 0x41, 0x82, 0x1a, 0xb0, 0x41, 0x42, 0x21, 0x00, 0x00, 0x90, 0x69, 0xa9, 0x41,
+        0x82, 0x1a, 0xb0, 0x41, 0x2f, 0x21, 0x01, 0x00, 0xa1, 0x78, 0xb0, 0x41, 0x38, 0xcf, 0xb3, 0x41,
+        0x3e, 0x21, 0x00, 0x00, 0xa1, 0x78, 0xb0, 0x41, 0x38, 0xcf, 0xb3, 0x41, 0x42, 0x21, 0x00, 0x00,
+        0xa1, 0x78, 0xb0, 0x41, 0x38, 0xcf, 0xb3, 0x41, 0x2f, 0x21, 0x01, 0x00, 0x29, 0x00, 0xb4, 0x41,
+        0xc0, 0x56, 0xb7, 0x41, 0x3e, 0x21, 0x00, 0x00, 0x29, 0x00, 0xb4, 0x41, 0xc0, 0x56, 0xb7, 0x41,
+        0x44, 0x21, 0x00, 0x00, 0x29, 0x00, 0xb4, 0x41, 0xc0, 0x56, 0xb7, 0x41, 0x2f, 0x21, 0x01, 0x00,
+        0xb1, 0x87, 0xb7, 0x41, 0xa4, 0x38, 0xbe, 0x41, 0x3d, 0x21, 0x00, 0x00, 0xb1, 0x87, 0xb7, 0x41,
+        0xa4, 0x38, 0xbe, 0x41, 0x45, 0x21, 0x00, 0x00, 0xb1, 0x87, 0xb7, 0x41, 0xa4, 0x38, 0xbe, 0x41,
+        0x2d, 0x21, 0x01, 0x00, 0xc2, 0x96, 0xbe, 0x41, 0xb4, 0x47, 0xc5, 0x41, 0x3c, 0x21, 0x00, 0x00,
+        0xc2, 0x96, 0xbe, 0x41, 0xb4, 0x47, 0xc5, 0x41, 0x45, 0x21, 0x00, 0x00, 0xc2, 0x96, 0xbe, 0x41,
+        0xb4, 0x47, 0xc5, 0x41, 0x2d, 0x21, 0x01, 0x00, 0xd3, 0xa5, 0xc5, 0x41, 0xc5, 0x56, 0xcc, 0x41,
+        0x3c, 0x21, 0x00, 0x00, 0xd3, 0xa5, 0xc5, 0x41, 0xc5, 0x56, 0xcc, 0x41, 0x40, 0x21, 0x00, 0x00,
+        0xd3, 0xa5, 0xc5, 0x41, 0xc5, 0x56, 0xcc, 0x41, 0x2d, 0x21, 0x01, 0x00, 0xe3, 0xb4, 0xcc, 0x41,
+        0x7b, 0x0b, 0xd0, 0x41, 0x3c, 0x21, 0x00, 0x00, 0xe3, 0xb4, 0xcc, 0x41, 0x7b, 0x0b, 0xd0, 0x41,
+        0x40, 0x21, 0x00, 0x00, 0xe3, 0xb4, 0xcc, 0x41, 0x7b, 0x0b, 0xd0, 0x41, 0x2d, 0x21, 0x01, 0x00,
+        0x6c, 0x3c, 0xd0, 0x41, 0x03, 0x93, 0xd3, 0x41, 0x3c, 0x21, 0x00, 0x00, 0x6c, 0x3c, 0xd0, 0x41,
+        0x03, 0x93, 0xd3, 0x41, 0x40, 0x21, 0x00, 0x00, 0x6c, 0x3c, 0xd0, 0x41, 0x03, 0x93, 0xd3, 0x41,
+        0x2d, 0x21, 0x01, 0x00, 0xf4, 0xc3, 0xd3, 0x41, 0xe6, 0x74, 0xda, 0x41, 0x3b, 0x21, 0x00, 0x00,
+        0xf4, 0xc3, 0xd3, 0x41, 0xe6, 0x74, 0xda, 0x41, 0x40, 0x21, 0x00, 0x00, 0xf4, 0xc3, 0xd3, 0x41,
+        0xe6, 0x74, 0xda, 0x41, 0x2c, 0x21, 0x01, 0x00, 0x05, 0xd3, 0xda, 0x41, 0xf7, 0x83, 0xe1, 0x41,
+        0x3c, 0x21, 0x00, 0x00, 0x05, 0xd3, 0xda, 0x41, 0xf7, 0x83, 0xe1, 0x41, 0x40, 0x21, 0x00, 0x00,
+        0x05, 0xd3, 0xda, 0x41, 0xf7, 0x83, 0xe1, 0x41, 0x2d, 0x21, 0x01, 0x00, 0x15, 0xe2, 0xe1, 0x41,
+        0x08, 0x93, 0xe8, 0x41, 0x3b, 0x21, 0x00, 0x00, 0x15, 0xe2, 0xe1, 0x41, 0x08, 0x93, 0xe8, 0x41,
+        0x40, 0x21, 0x00, 0x00, 0x15, 0xe2, 0xe1, 0x41, 0x08, 0x93, 0xe8, 0x41, 0x28, 0x21, 0x01, 0x00,
+        0x26, 0xf1, 0xe8, 0x41, 0xbd, 0x47, 0xec, 0x41, 0x3b, 0x21, 0x00, 0x00, 0x26, 0xf1, 0xe8, 0x41,
+        0xbd, 0x47, 0xec, 0x41, 0x42, 0x21, 0x00, 0x00, 0x26, 0xf1, 0xe8, 0x41, 0xbd, 0x47, 0xec, 0x41,
+        0x28, 0x21, 0x01, 0x00, 0xae, 0x78, 0xec, 0x41, 0x46, 0xcf, 0xef, 0x41, 0x3b, 0x21, 0x00, 0x00,
+        0xae, 0x78, 0xec, 0x41, 0x46, 0xcf, 0xef, 0x41, 0x44, 0x21, 0x00, 0x00, 0xae, 0x78, 0xec, 0x41,
+        0x46, 0xcf, 0xef, 0x41, 0x28, 0x21, 0x01, 0x00, 0x37, 0x00, 0xf0, 0x41, 0xdf, 0x65, 0xfd, 0x41,
+        0x3c, 0x21, 0x00, 0x00, 0x37, 0x00, 0xf0, 0x41, 0xdf, 0x65, 0xfd, 0x41, 0x45, 0x21, 0x00, 0x00,
+        0x37, 0x00, 0xf0, 0x41, 0xdf, 0x65, 0xfd, 0x41, 0x2d, 0x21, 0x01, 0x00, 0x58, 0x1e, 0xfe, 0x41,
+        0xa5, 0x67, 0x02, 0x42, 0x40, 0x31, 0x00, 0x00, 0x58, 0x1e, 0xfe, 0x41, 0xa5, 0x67, 0x02, 0x42,
+        0x43, 0x31, 0x00, 0x00, 0x58, 0x1e, 0xfe, 0x41, 0xa5, 0x67, 0x02, 0x42, 0x30, 0x31, 0x01, 0x00,
+        0xb4, 0x96, 0x02, 0x42, 0x00, 0x42, 0x04, 0x42, 0x40, 0x31, 0x00, 0x00, 0xb4, 0x96, 0x02, 0x42,
+        0x00, 0x42, 0x04, 0x42, 0x43, 0x31, 0x00, 0x00, 0xb4, 0x96, 0x02, 0x42, 0x00, 0x42, 0x04, 0x42,
+        0x30, 0x31, 0x01, 0x00, 0x78, 0x5a, 0x04, 0x42, 0xc4, 0x05, 0x06, 0x42, 0x40, 0x31, 0x00, 0x00,
+        0x78, 0x5a, 0x04, 0x42, 0xc4, 0x05, 0x06, 0x42, 0x45, 0x31, 0x00, 0x00, 0x78, 0x5a, 0x04, 0x42,
+        0xc4, 0x05, 0x06, 0x42, 0x30, 0x31, 0x01, 0x00, 0x3d, 0x1e, 0x06, 0x42, 0xb6, 0x76, 0x09, 0x42,
+        0x3f, 0x31, 0x00, 0x00, 0x3d, 0x1e, 0x06, 0x42, 0xb6, 0x76, 0x09, 0x42, 0x47, 0x31, 0x00, 0x00,
+        0x3d, 0x1e, 0x06, 0x42, 0xb6, 0x76, 0x09, 0x42, 0x2f, 0x31, 0x01, 0x00, 0xc5, 0xa5, 0x09, 0x42,
+        0x3e, 0xfe, 0x0c, 0x42, 0x3f, 0x31, 0x00, 0x00, 0xc5, 0xa5, 0x09, 0x42, 0x3e, 0xfe, 0x0c, 0x42,
+        0x47, 0x31, 0x00, 0x00, 0xc5, 0xa5, 0x09, 0x42, 0x3e, 0xfe, 0x0c, 0x42, 0x2f, 0x31, 0x01, 0x00,
+        0x4d, 0x2d, 0x0d, 0x42, 0xc6, 0x85, 0x10, 0x42, 0x3e, 0x31, 0x00, 0x00, 0x4d, 0x2d, 0x0d, 0x42,
+        0xc6, 0x85, 0x10, 0x42, 0x42, 0x31, 0x00, 0x00, 0x4d, 0x2d, 0x0d, 0x42, 0xc6, 0x85, 0x10, 0x42,
+        0x2f, 0x31, 0x01, 0x00, 0xd6, 0xb4, 0x10, 0x42, 0x21, 0x60, 0x12, 0x42, 0x3e, 0x31, 0x00, 0x00,
+        0xd6, 0xb4, 0x10, 0x42, 0x21, 0x60, 0x12, 0x42, 0x42, 0x31, 0x00, 0x00, 0xd6, 0xb4, 0x10, 0x42,
+        0x21, 0x60, 0x12, 0x42, 0x2f, 0x31, 0x01, 0x00, 0x9a, 0x78, 0x12, 0x42, 0xe5, 0x23, 0x14, 0x42,
+        0x3e, 0x31, 0x00, 0x00, 0x9a, 0x78, 0x12, 0x42, 0xe5, 0x23, 0x14, 0x42, 0x44, 0x31, 0x00, 0x00,
+        0x9a, 0x78, 0x12, 0x42, 0xe5, 0x23, 0x14, 0x42, 0x2f, 0x31, 0x01, 0x00, 0x5e, 0x3c, 0x14, 0x42,
+        0xd7, 0x94, 0x17, 0x42, 0x3d, 0x31, 0x00, 0x00, 0x5e, 0x3c, 0x14, 0x42, 0xd7, 0x94, 0x17, 0x42,
+        0x45, 0x31, 0x00, 0x00, 0x5e, 0x3c, 0x14, 0x42, 0xd7, 0x94, 0x17, 0x42, 0x2d, 0x31, 0x01, 0x00,
+        0xe6, 0xc3, 0x17, 0x42, 0x5f, 0x1c, 0x1b, 0x42, 0x3c, 0x31, 0x00, 0x00, 0xe6, 0xc3, 0x17, 0x42,
+        0x5f, 0x1c, 0x1b, 0x42, 0x45, 0x31, 0x00, 0x00, 0xe6, 0xc3, 0x17, 0x42, 0x5f, 0x1c, 0x1b, 0x42,
+        0x2d, 0x31, 0x01, 0x00, 0x6f, 0x4b, 0x1b, 0x42, 0xe8, 0xa3, 0x1e, 0x42, 0x3c, 0x31, 0x00, 0x00,
+        0x6f, 0x4b, 0x1b, 0x42, 0xe8, 0xa3, 0x1e, 0x42, 0x40, 0x31, 0x00, 0x00, 0x6f, 0x4b, 0x1b, 0x42,
+        0xe8, 0xa3, 0x1e, 0x42, 0x2d, 0x31, 0x01, 0x00, 0xf7, 0xd2, 0x1e, 0x42, 0x43, 0x7e, 0x20, 0x42,
+        0x3c, 0x31, 0x00, 0x00, 0xf7, 0xd2, 0x1e, 0x42, 0x43, 0x7e, 0x20, 0x42, 0x40, 0x31, 0x00, 0x00,
+        0xf7, 0xd2, 0x1e, 0x42, 0x43, 0x7e, 0x20, 0x42, 0x2d, 0x31, 0x01, 0x00, 0xbb, 0x96, 0x20, 0x42,
+        0x07, 0x42, 0x22, 0x42, 0x3c, 0x31, 0x00, 0x00, 0xbb, 0x96, 0x20, 0x42, 0x07, 0x42, 0x22, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0xbb, 0x96, 0x20, 0x42, 0x07, 0x42, 0x22, 0x42, 0x2d, 0x31, 0x01, 0x00,
+        0x7f, 0x5a, 0x22, 0x42, 0xf8, 0xb2, 0x25, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x7f, 0x5a, 0x22, 0x42,
+        0xf8, 0xb2, 0x25, 0x42, 0x40, 0x31, 0x00, 0x00, 0x7f, 0x5a, 0x22, 0x42, 0xf8, 0xb2, 0x25, 0x42,
+        0x2c, 0x31, 0x01, 0x00, 0x08, 0xe2, 0x25, 0x42, 0x81, 0x3a, 0x29, 0x42, 0x3c, 0x31, 0x00, 0x00,
+        0x08, 0xe2, 0x25, 0x42, 0x81, 0x3a, 0x29, 0x42, 0x40, 0x31, 0x00, 0x00, 0x08, 0xe2, 0x25, 0x42,
+        0x81, 0x3a, 0x29, 0x42, 0x2d, 0x31, 0x01, 0x00, 0x90, 0x69, 0x29, 0x42, 0x09, 0xc2, 0x2c, 0x42,
+        0x3b, 0x31, 0x00, 0x00, 0x90, 0x69, 0x29, 0x42, 0x09, 0xc2, 0x2c, 0x42, 0x40, 0x31, 0x00, 0x00,
+        0x90, 0x69, 0x29, 0x42, 0x09, 0xc2, 0x2c, 0x42, 0x28, 0x31, 0x01, 0x00, 0x18, 0xf1, 0x2c, 0x42,
+        0x64, 0x9c, 0x2e, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x18, 0xf1, 0x2c, 0x42, 0x64, 0x9c, 0x2e, 0x42,
+        0x42, 0x31, 0x00, 0x00, 0x18, 0xf1, 0x2c, 0x42, 0x64, 0x9c, 0x2e, 0x42, 0x28, 0x31, 0x01, 0x00,
+        0xdc, 0xb4, 0x2e, 0x42, 0x28, 0x60, 0x30, 0x42, 0x3b, 0x31, 0x00, 0x00, 0xdc, 0xb4, 0x2e, 0x42,
+        0x28, 0x60, 0x30, 0x42, 0x44, 0x31, 0x00, 0x00, 0xdc, 0xb4, 0x2e, 0x42, 0x28, 0x60, 0x30, 0x42,
+        0x28, 0x31, 0x01, 0x00, 0xa1, 0x78, 0x30, 0x42, 0x75, 0x2b, 0x37, 0x42, 0x3c, 0x31, 0x00, 0x00,
+        0xa1, 0x78, 0x30, 0x42, 0x75, 0x2b, 0x37, 0x42, 0x45, 0x31, 0x00, 0x00, 0xa1, 0x78, 0x30, 0x42,
+        0x75, 0x2b, 0x37, 0x42, 0x2d, 0x31, 0x01, 0x00, 0xb1, 0x87, 0x37, 0x42, 0x2a, 0xe0, 0x3a, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0xb1, 0x87, 0x37, 0x42, 0x2a, 0xe0, 0x3a, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0x3a, 0x0f, 0x3b, 0x42, 0x85, 0xba, 0x3c, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x3a, 0x0f, 0x3b, 0x42,
+        0x85, 0xba, 0x3c, 0x42, 0x2d, 0x40, 0x01, 0x00, 0xfe, 0xd2, 0x3c, 0x42, 0x49, 0x7e, 0x3e, 0x42,
+        0x4c, 0x40, 0x00, 0x00, 0xfe, 0xd2, 0x3c, 0x42, 0x49, 0x7e, 0x3e, 0x42, 0x2d, 0x40, 0x01, 0x00,
+        0xc2, 0x96, 0x3e, 0x42, 0x3b, 0xef, 0x41, 0x42, 0x47, 0x40, 0x00, 0x00, 0xc2, 0x96, 0x3e, 0x42,
+        0x3b, 0xef, 0x41, 0x42, 0x4c, 0x40, 0x00, 0x00, 0xc2, 0x96, 0x3e, 0x42, 0x3b, 0xef, 0x41, 0x42,
+        0x2c, 0x40, 0x01, 0x00, 0x4a, 0x1e, 0x42, 0x42, 0xc3, 0x76, 0x45, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0x4a, 0x1e, 0x42, 0x42, 0xc3, 0x76, 0x45, 0x42, 0x38, 0x40, 0x01, 0x00, 0xd3, 0xa5, 0x45, 0x42,
+        0x87, 0x7a, 0x46, 0x42, 0x47, 0x40, 0x00, 0x00, 0xd3, 0xa5, 0x45, 0x42, 0x4c, 0xfe, 0x48, 0x42,
+        0x4c, 0x40, 0x00, 0x00, 0xb5, 0x87, 0x46, 0x42, 0x6a, 0x5c, 0x47, 0x42, 0x48, 0x40, 0x00, 0x00,
+        0x97, 0x69, 0x47, 0x42, 0x10, 0xc2, 0x4a, 0x42, 0x4a, 0x40, 0x00, 0x00, 0x5b, 0x2d, 0x49, 0x42,
+        0xd4, 0x85, 0x4c, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x5b, 0x2d, 0x49, 0x42, 0xa7, 0xd8, 0x4a, 0x42,
+        0x28, 0x40, 0x01, 0x00, 0x1f, 0xf1, 0x4a, 0x42, 0xd4, 0xc5, 0x4b, 0x42, 0x48, 0x40, 0x00, 0x00,
+        0x1f, 0xf1, 0x4a, 0x42, 0x6b, 0x9c, 0x4c, 0x42, 0x28, 0x40, 0x01, 0x00, 0x01, 0xd3, 0x4b, 0x42,
+        0xb6, 0xa7, 0x4c, 0x42, 0x47, 0x40, 0x00, 0x00, 0xe3, 0xb4, 0x4c, 0x42, 0x2f, 0x60, 0x4e, 0x42,
+        0x47, 0x40, 0x00, 0x00, 0xe3, 0xb4, 0x4c, 0x42, 0x5c, 0x0d, 0x50, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0xe3, 0xb4, 0x4c, 0x42, 0x5c, 0x0d, 0x50, 0x42, 0x2d, 0x40, 0x01, 0x00, 0xa7, 0x78, 0x4e, 0x42,
+        0xf3, 0x23, 0x50, 0x42, 0x48, 0x40, 0x00, 0x00, 0x6c, 0x3c, 0x50, 0x42, 0xe5, 0x94, 0x53, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0x6c, 0x3c, 0x50, 0x42, 0xe5, 0x94, 0x53, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0x6c, 0x3c, 0x50, 0x42, 0xe5, 0x94, 0x53, 0x42, 0x39, 0x40, 0x01, 0x00, 0xf4, 0xc3, 0x53, 0x42,
+        0x6d, 0x1c, 0x57, 0x42, 0x4c, 0x40, 0x00, 0x00, 0xf4, 0xc3, 0x53, 0x42, 0x6d, 0x1c, 0x57, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0x7c, 0x4b, 0x57, 0x42, 0xc8, 0xf6, 0x58, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0x7c, 0x4b, 0x57, 0x42, 0xc8, 0xf6, 0x58, 0x42, 0x2d, 0x40, 0x01, 0x00, 0x40, 0x0f, 0x59, 0x42,
+        0x8c, 0xba, 0x5a, 0x42, 0x4e, 0x40, 0x00, 0x00, 0x40, 0x0f, 0x59, 0x42, 0xf5, 0xe3, 0x59, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0x40, 0x0f, 0x59, 0x42, 0x8c, 0xba, 0x5a, 0x42, 0x2d, 0x40, 0x01, 0x00,
+        0x22, 0xf1, 0x59, 0x42, 0xd7, 0xc5, 0x5a, 0x42, 0x4a, 0x40, 0x00, 0x00, 0x05, 0xd3, 0x5a, 0x42,
+        0x7e, 0x2b, 0x5e, 0x42, 0x4f, 0x40, 0x00, 0x00, 0x05, 0xd3, 0x5a, 0x42, 0x50, 0x7e, 0x5c, 0x42,
+        0x4b, 0x40, 0x00, 0x00, 0x05, 0xd3, 0x5a, 0x42, 0x7e, 0x2b, 0x5e, 0x42, 0x2b, 0x40, 0x01, 0x00,
+        0xc9, 0x96, 0x5c, 0x42, 0x14, 0x42, 0x5e, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x8d, 0x5a, 0x5e, 0x42,
+        0x06, 0xb3, 0x61, 0x42, 0x4f, 0x40, 0x00, 0x00, 0x8d, 0x5a, 0x5e, 0x42, 0xd9, 0x05, 0x60, 0x42,
+        0x4c, 0x40, 0x00, 0x00, 0x8d, 0x5a, 0x5e, 0x42, 0x06, 0xb3, 0x61, 0x42, 0x37, 0x40, 0x01, 0x00,
+        0x51, 0x1e, 0x60, 0x42, 0x9d, 0xc9, 0x61, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x15, 0xe2, 0x61, 0x42,
+        0x8e, 0x3a, 0x65, 0x42, 0x4f, 0x40, 0x00, 0x00, 0x15, 0xe2, 0x61, 0x42, 0xca, 0xb6, 0x62, 0x42,
+        0x4a, 0x40, 0x00, 0x00, 0xf7, 0xc3, 0x62, 0x42, 0xac, 0x98, 0x63, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0xd9, 0xa5, 0x63, 0x42, 0x53, 0xfe, 0x66, 0x42, 0x4d, 0x40, 0x00, 0x00, 0x9e, 0x69, 0x65, 0x42,
+        0x17, 0xc2, 0x68, 0x42, 0x4f, 0x40, 0x00, 0x00, 0x9e, 0x69, 0x65, 0x42, 0xe9, 0x14, 0x67, 0x42,
+        0x37, 0x40, 0x01, 0x00, 0x62, 0x2d, 0x67, 0x42, 0x17, 0x02, 0x68, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0x62, 0x2d, 0x67, 0x42, 0xad, 0xd8, 0x68, 0x42, 0x37, 0x40, 0x01, 0x00, 0x44, 0x0f, 0x68, 0x42,
+        0xf9, 0xe3, 0x68, 0x42, 0x4a, 0x40, 0x00, 0x00, 0x26, 0xf1, 0x68, 0x42, 0x9f, 0x49, 0x6c, 0x42,
+        0x4f, 0x40, 0x00, 0x00, 0x26, 0xf1, 0x68, 0x42, 0x72, 0x9c, 0x6a, 0x42, 0x4a, 0x40, 0x00, 0x00,
+        0x26, 0xf1, 0x68, 0x42, 0x9f, 0x49, 0x6c, 0x42, 0x30, 0x40, 0x01, 0x00, 0xea, 0xb4, 0x6a, 0x42,
+        0x36, 0x60, 0x6c, 0x42, 0x4c, 0x40, 0x00, 0x00, 0xae, 0x78, 0x6c, 0x42, 0x27, 0xd1, 0x6f, 0x42,
+        0x4c, 0x40, 0x00, 0x00, 0xae, 0x78, 0x6c, 0x42, 0x27, 0xd1, 0x6f, 0x42, 0x3c, 0x40, 0x01, 0x00,
+        0x37, 0x00, 0x70, 0x42, 0xb0, 0x58, 0x73, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x37, 0x00, 0x70, 0x42,
+        0xb0, 0x58, 0x73, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xbf, 0x87, 0x73, 0x42, 0x0b, 0x33, 0x75, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0xbf, 0x87, 0x73, 0x42, 0x0b, 0x33, 0x75, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x83, 0x4b, 0x75, 0x42, 0xcf, 0xf6, 0x76, 0x42, 0x51, 0x50, 0x00, 0x00, 0x83, 0x4b, 0x75, 0x42,
+        0xcf, 0xf6, 0x76, 0x42, 0x30, 0x50, 0x01, 0x00, 0x47, 0x0f, 0x77, 0x42, 0xc0, 0x67, 0x7a, 0x42,
+        0x4b, 0x50, 0x00, 0x00, 0x47, 0x0f, 0x77, 0x42, 0xc0, 0x67, 0x7a, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x47, 0x0f, 0x77, 0x42, 0xc0, 0x67, 0x7a, 0x42, 0x2f, 0x50, 0x01, 0x00, 0xd0, 0x96, 0x7a, 0x42,
+        0x49, 0xef, 0x7d, 0x42, 0x53, 0x50, 0x00, 0x00, 0xd0, 0x96, 0x7a, 0x42, 0x49, 0xef, 0x7d, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x58, 0x1e, 0x7e, 0x42, 0x69, 0xbb, 0x80, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x58, 0x1e, 0x7e, 0x42, 0xa4, 0xc9, 0x7f, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x1c, 0xe2, 0x7f, 0x42,
+        0x68, 0x5b, 0x80, 0x42, 0x47, 0x50, 0x00, 0x00, 0xff, 0x61, 0x80, 0x42, 0x59, 0xcc, 0x80, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0xf0, 0xd2, 0x80, 0x42, 0x96, 0xa8, 0x81, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xf0, 0xd2, 0x80, 0x42, 0x96, 0xa8, 0x81, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xf0, 0xd2, 0x80, 0x42,
+        0x96, 0xa8, 0x81, 0x42, 0x34, 0x50, 0x01, 0x00, 0xd2, 0xb4, 0x81, 0x42, 0x78, 0x8a, 0x82, 0x42,
+        0x50, 0x50, 0x00, 0x00, 0xd2, 0xb4, 0x81, 0x42, 0x2d, 0x1f, 0x82, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0xd2, 0xb4, 0x81, 0x42, 0x78, 0x8a, 0x82, 0x42, 0x34, 0x50, 0x01, 0x00, 0xc3, 0x25, 0x82, 0x42,
+        0x1e, 0x90, 0x82, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xb4, 0x96, 0x82, 0x42, 0xf1, 0x42, 0x84, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0xb4, 0x96, 0x82, 0x42, 0x5a, 0x6c, 0x83, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xb4, 0x96, 0x82, 0x42, 0xf1, 0x42, 0x84, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x96, 0x78, 0x83, 0x42,
+        0x3c, 0x4e, 0x84, 0x42, 0x49, 0x50, 0x00, 0x00, 0x78, 0x5a, 0x84, 0x42, 0xb5, 0x06, 0x86, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x78, 0x5a, 0x84, 0x42, 0xb5, 0x06, 0x86, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x78, 0x5a, 0x84, 0x42, 0xb5, 0x06, 0x86, 0x42, 0x39, 0x50, 0x01, 0x00, 0x3d, 0x1e, 0x86, 0x42,
+        0x79, 0xca, 0x87, 0x42, 0x48, 0x50, 0x00, 0x00, 0x3d, 0x1e, 0x86, 0x42, 0x79, 0xca, 0x87, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x01, 0xe2, 0x87, 0x42, 0xa7, 0xb7, 0x88, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x01, 0xe2, 0x87, 0x42, 0xa7, 0xb7, 0x88, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xe3, 0xc3, 0x88, 0x42,
+        0x89, 0x99, 0x89, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xe3, 0xc3, 0x88, 0x42, 0x89, 0x99, 0x89, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0xc5, 0xa5, 0x89, 0x42, 0x02, 0x52, 0x8b, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xc5, 0xa5, 0x89, 0x42, 0x02, 0x52, 0x8b, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xc5, 0xa5, 0x89, 0x42,
+        0x02, 0x52, 0x8b, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x89, 0x69, 0x8b, 0x42, 0xc6, 0x15, 0x8d, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x89, 0x69, 0x8b, 0x42, 0xc6, 0x15, 0x8d, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x89, 0x69, 0x8b, 0x42, 0xc6, 0x15, 0x8d, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x4d, 0x2d, 0x8d, 0x42,
+        0x8a, 0xd9, 0x8e, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x4d, 0x2d, 0x8d, 0x42, 0xa8, 0x97, 0x8d, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x3e, 0x9e, 0x8d, 0x42, 0x99, 0x08, 0x8e, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x2f, 0x0f, 0x8e, 0x42, 0x6c, 0xbb, 0x8f, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x11, 0xf1, 0x8e, 0x42,
+        0xb7, 0xc6, 0x8f, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x11, 0xf1, 0x8e, 0x42, 0xb7, 0xc6, 0x8f, 0x42,
+        0x28, 0x50, 0x01, 0x00, 0xf3, 0xd2, 0x8f, 0x42, 0x99, 0xa8, 0x90, 0x42, 0x50, 0x50, 0x00, 0x00,
+        0xf3, 0xd2, 0x8f, 0x42, 0x4e, 0x3d, 0x90, 0x42, 0x48, 0x50, 0x00, 0x00, 0xf3, 0xd2, 0x8f, 0x42,
+        0x99, 0xa8, 0x90, 0x42, 0x28, 0x50, 0x01, 0x00, 0xe5, 0x43, 0x90, 0x42, 0x3f, 0xae, 0x90, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xd6, 0xb4, 0x90, 0x42, 0x12, 0x61, 0x92, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0xd6, 0xb4, 0x90, 0x42, 0x7b, 0x8a, 0x91, 0x42, 0x45, 0x50, 0x00, 0x00, 0xd6, 0xb4, 0x90, 0x42,
+        0x12, 0x61, 0x92, 0x42, 0x2d, 0x50, 0x01, 0x00, 0xb8, 0x96, 0x91, 0x42, 0x12, 0x01, 0x92, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xa9, 0x07, 0x92, 0x42, 0x03, 0x72, 0x92, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x9a, 0x78, 0x92, 0x42, 0x40, 0x4e, 0x93, 0x42, 0x48, 0x50, 0x00, 0x00, 0x9a, 0x78, 0x92, 0x42,
+        0xd6, 0x24, 0x94, 0x42, 0x39, 0x50, 0x01, 0x00, 0x7c, 0x5a, 0x93, 0x42, 0xd6, 0xc4, 0x93, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x6d, 0xcb, 0x93, 0x42, 0xc7, 0x35, 0x94, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x5e, 0x3c, 0x94, 0x42, 0x9b, 0xe8, 0x95, 0x42, 0x4c, 0x60, 0x00, 0x00, 0x5e, 0x3c, 0x94, 0x42,
+        0x9b, 0xe8, 0x95, 0x42, 0x4f, 0x60, 0x00, 0x00, 0x22, 0x00, 0x96, 0x42, 0xc8, 0xd5, 0x96, 0x42,
+        0x4f, 0x60, 0x00, 0x00, 0x22, 0x00, 0x96, 0x42, 0xc8, 0xd5, 0x96, 0x42, 0x30, 0x60, 0x01, 0x00,
+        0x04, 0xe2, 0x96, 0x42, 0xaa, 0xb7, 0x97, 0x42, 0x51, 0x60, 0x00, 0x00, 0x04, 0xe2, 0x96, 0x42,
+        0xaa, 0xb7, 0x97, 0x42, 0x30, 0x60, 0x01, 0x00, 0xe6, 0xc3, 0x97, 0x42, 0x23, 0x70, 0x99, 0x42,
+        0x4b, 0x60, 0x00, 0x00, 0xe6, 0xc3, 0x97, 0x42, 0x23, 0x70, 0x99, 0x42, 0x53, 0x60, 0x00, 0x00,
+        0xe6, 0xc3, 0x97, 0x42, 0x23, 0x70, 0x99, 0x42, 0x2f, 0x60, 0x01, 0x00, 0xaa, 0x87, 0x99, 0x42,
+        0xe7, 0x33, 0x9b, 0x42, 0x53, 0x60, 0x00, 0x00, 0xaa, 0x87, 0x99, 0x42, 0xe7, 0x33, 0x9b, 0x42,
+        0x3b, 0x60, 0x01, 0x00, 0x6f, 0x4b, 0x9b, 0x42, 0xab, 0xf7, 0x9c, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0x6f, 0x4b, 0x9b, 0x42, 0x14, 0x21, 0x9c, 0x42, 0x4a, 0x60, 0x00, 0x00, 0x51, 0x2d, 0x9c, 0x42,
+        0xab, 0x97, 0x9c, 0x42, 0x47, 0x60, 0x00, 0x00, 0x42, 0x9e, 0x9c, 0x42, 0x9c, 0x08, 0x9d, 0x42,
+        0x49, 0x60, 0x00, 0x00, 0x33, 0x0f, 0x9d, 0x42, 0xd9, 0xe4, 0x9d, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0x33, 0x0f, 0x9d, 0x42, 0xd9, 0xe4, 0x9d, 0x42, 0x4a, 0x60, 0x00, 0x00, 0x33, 0x0f, 0x9d, 0x42,
+        0xd9, 0xe4, 0x9d, 0x42, 0x34, 0x60, 0x01, 0x00, 0x15, 0xf1, 0x9d, 0x42, 0xbb, 0xc6, 0x9e, 0x42,
+        0x50, 0x60, 0x00, 0x00, 0x15, 0xf1, 0x9d, 0x42, 0x6f, 0x5b, 0x9e, 0x42, 0x4c, 0x60, 0x00, 0x00,
+        0x15, 0xf1, 0x9d, 0x42, 0xbb, 0xc6, 0x9e, 0x42, 0x34, 0x60, 0x01, 0x00, 0x06, 0x62, 0x9e, 0x42,
+        0x60, 0xcc, 0x9e, 0x42, 0x4a, 0x60, 0x00, 0x00, 0xf7, 0xd2, 0x9e, 0x42, 0x34, 0x7f, 0xa0, 0x42,
+        0x51, 0x60, 0x00, 0x00, 0xf7, 0xd2, 0x9e, 0x42, 0x9d, 0xa8, 0x9f, 0x42, 0x4a, 0x60, 0x00, 0x00,
+        0xf7, 0xd2, 0x9e, 0x42, 0x34, 0x7f, 0xa0, 0x42, 0x2d, 0x60, 0x01, 0x00, 0xd9, 0xb4, 0x9f, 0x42,
+        0x7f, 0x8a, 0xa0, 0x42, 0x49, 0x60, 0x00, 0x00, 0xbb, 0x96, 0xa0, 0x42, 0xf8, 0x42, 0xa2, 0x42,
+        0x51, 0x60, 0x00, 0x00, 0xbb, 0x96, 0xa0, 0x42, 0xf8, 0x42, 0xa2, 0x42, 0x48, 0x60, 0x00, 0x00,
+        0xbb, 0x96, 0xa0, 0x42, 0xf8, 0x42, 0xa2, 0x42, 0x39, 0x60, 0x01, 0x00, 0x7f, 0x5a, 0xa2, 0x42,
+        0xbc, 0x06, 0xa4, 0x42, 0x48, 0x60, 0x00, 0x00, 0x7f, 0x5a, 0xa2, 0x42, 0xbc, 0x06, 0xa4, 0x42,
+        0x4c, 0x60, 0x00, 0x00, 0x43, 0x1e, 0xa4, 0x42, 0xe9, 0xf3, 0xa4, 0x42, 0x4c, 0x60, 0x00, 0x00,
+        0x43, 0x1e, 0xa4, 0x42, 0xe9, 0xf3, 0xa4, 0x42, 0x2d, 0x60, 0x01, 0x00, 0x25, 0x00, 0xa5, 0x42,
+        0xcb, 0xd5, 0xa5, 0x42, 0x4c, 0x60, 0x00, 0x00, 0x25, 0x00, 0xa5, 0x42, 0xcb, 0xd5, 0xa5, 0x42,
+        0x2d, 0x60, 0x01, 0x00, 0x08, 0xe2, 0xa5, 0x42, 0x44, 0x8e, 0xa7, 0x42, 0x47, 0x60, 0x00, 0x00,
+        0x08, 0xe2, 0xa5, 0x42, 0x44, 0x8e, 0xa7, 0x42, 0x4c, 0x60, 0x00, 0x00, 0x08, 0xe2, 0xa5, 0x42,
+        0x44, 0x8e, 0xa7, 0x42, 0x2c, 0x60, 0x01, 0x00, 0xcc, 0xa5, 0xa7, 0x42, 0x08, 0x52, 0xa9, 0x42,
+        0x48, 0x60, 0x00, 0x00, 0xcc, 0xa5, 0xa7, 0x42, 0x08, 0x52, 0xa9, 0x42, 0x4c, 0x60, 0x00, 0x00,
+        0xcc, 0xa5, 0xa7, 0x42, 0x08, 0x52, 0xa9, 0x42, 0x2d, 0x60, 0x01, 0x00, 0x90, 0x69, 0xa9, 0x42,
+        0xcd, 0x15, 0xab, 0x42, 0x4c, 0x60, 0x00, 0x00, 0x90, 0x69, 0xa9, 0x42, 0xea, 0xd3, 0xa9, 0x42,
+        0x47, 0x60, 0x00, 0x00, 0x81, 0xda, 0xa9, 0x42, 0xdb, 0x44, 0xaa, 0x42, 0x48, 0x60, 0x00, 0x00,
+        0x72, 0x4b, 0xaa, 0x42, 0xaf, 0xf7, 0xab, 0x42, 0x4a, 0x60, 0x00, 0x00, 0x54, 0x2d, 0xab, 0x42,
+        0xfa, 0x02, 0xac, 0x42, 0x4e, 0x60, 0x00, 0x00, 0x54, 0x2d, 0xab, 0x42, 0xfa, 0x02, 0xac, 0x42,
+        0x28, 0x60, 0x01, 0x00, 0x36, 0x0f, 0xac, 0x42, 0xdc, 0xe4, 0xac, 0x42, 0x50, 0x60, 0x00, 0x00,
+        0x36, 0x0f, 0xac, 0x42, 0x91, 0x79, 0xac, 0x42, 0x48, 0x60, 0x00, 0x00, 0x36, 0x0f, 0xac, 0x42,
+        0xdc, 0xe4, 0xac, 0x42, 0x28, 0x60, 0x01, 0x00, 0x27, 0x80, 0xac, 0x42, 0x82, 0xea, 0xac, 0x42,
+        0x47, 0x60, 0x00, 0x00, 0x18, 0xf1, 0xac, 0x42, 0x82, 0x4a, 0xb0, 0x42, 0x51, 0x40, 0x00, 0x00,
+        0x18, 0xf1, 0xac, 0x42, 0x82, 0x4a, 0xb0, 0x42, 0x45, 0x40, 0x00, 0x00, 0x18, 0xf1, 0xac, 0x42,
+        0x55, 0x9d, 0xae, 0x42, 0x2d, 0x40, 0x01, 0x00, 0xdc, 0xb4, 0xae, 0x42, 0x19, 0x61, 0xb0, 0x42,
+        0x39, 0x40, 0x01, 0x00, 0xa1, 0x78, 0xb0, 0x42, 0xdd, 0x24, 0xb2, 0x42, 0x4c, 0x31, 0x00, 0x00,
+        0xa1, 0x78, 0xb0, 0x42, 0xdd, 0x24, 0xb2, 0x42, 0x34, 0x31, 0x01, 0x00, 0xa1, 0x78, 0xb0, 0x42,
+        0xdd, 0x24, 0xb2, 0x42, 0x3b, 0x31, 0x01, 0x00, 0xa1, 0x78, 0xb0, 0x42, 0xdd, 0x24, 0xb2, 0x42,
+        0x3e, 0x31, 0x01, 0x00, 0x65, 0x3c, 0xb2, 0x42, 0x0b, 0x12, 0xb3, 0x42, 0x4c, 0x31, 0x00, 0x00,
+        0x65, 0x3c, 0xb2, 0x42, 0x0b, 0x12, 0xb3, 0x42, 0x4e, 0x31, 0x00, 0x00, 0x65, 0x3c, 0xb2, 0x42,
+        0x0b, 0x12, 0xb3, 0x42, 0x34, 0x31, 0x01, 0x00, 0x65, 0x3c, 0xb2, 0x42, 0x0b, 0x12, 0xb3, 0x42,
+        0x3b, 0x31, 0x01, 0x00, 0x65, 0x3c, 0xb2, 0x42, 0x0b, 0x12, 0xb3, 0x42, 0x3e, 0x31, 0x01, 0x00,
+        0x47, 0x1e, 0xb3, 0x42, 0xed, 0xf3, 0xb3, 0x42, 0x4c, 0x31, 0x00, 0x00, 0x47, 0x1e, 0xb3, 0x42,
+        0xed, 0xf3, 0xb3, 0x42, 0x50, 0x31, 0x00, 0x00, 0x47, 0x1e, 0xb3, 0x42, 0xed, 0xf3, 0xb3, 0x42,
+        0x34, 0x31, 0x01, 0x00, 0x47, 0x1e, 0xb3, 0x42, 0xed, 0xf3, 0xb3, 0x42, 0x3b, 0x31, 0x01, 0x00,
+        0x47, 0x1e, 0xb3, 0x42, 0xed, 0xf3, 0xb3, 0x42, 0x3e, 0x31, 0x01, 0x00, 0x29, 0x00, 0xb4, 0x42,
+        0x93, 0x59, 0xb7, 0x42, 0x4c, 0x31, 0x00, 0x00, 0x29, 0x00, 0xb4, 0x42, 0x93, 0x59, 0xb7, 0x42,
+        0x51, 0x31, 0x00, 0x00, 0x29, 0x00, 0xb4, 0x42, 0x93, 0x59, 0xb7, 0x42, 0x39, 0x31, 0x01, 0x00,
+        0x29, 0x00, 0xb4, 0x42, 0x93, 0x59, 0xb7, 0x42, 0x3c, 0x31, 0x01, 0x00, 0x29, 0x00, 0xb4, 0x42,
+        0x93, 0x59, 0xb7, 0x42, 0x40, 0x31, 0x01, 0x00, 0xb1, 0x87, 0xb7, 0x42, 0xee, 0x33, 0xb9, 0x42,
+        0x40, 0x21, 0x00, 0x00, 0xb1, 0x87, 0xb7, 0x42, 0xee, 0x33, 0xb9, 0x42, 0x47, 0x21, 0x00, 0x00,
+        0xb1, 0x87, 0xb7, 0x42, 0xee, 0x33, 0xb9, 0x42, 0x4a, 0x21, 0x00, 0x00, 0xb1, 0x87, 0xb7, 0x42,
+        0xee, 0x33, 0xb9, 0x42, 0x28, 0x21, 0x01, 0x00, 0x75, 0x4b, 0xb9, 0x42, 0x1b, 0x21, 0xba, 0x42,
+        0x40, 0x21, 0x00, 0x00, 0x75, 0x4b, 0xb9, 0x42, 0x1b, 0x21, 0xba, 0x42, 0x47, 0x21, 0x00, 0x00,
+        0x75, 0x4b, 0xb9, 0x42, 0x1b, 0x21, 0xba, 0x42, 0x4a, 0x21, 0x00, 0x00, 0x75, 0x4b, 0xb9, 0x42,
+        0x1b, 0x21, 0xba, 0x42, 0x2a, 0x21, 0x01, 0x00, 0x57, 0x2d, 0xba, 0x42, 0xfd, 0x02, 0xbb, 0x42,
+        0x40, 0x21, 0x00, 0x00, 0x57, 0x2d, 0xba, 0x42, 0xfd, 0x02, 0xbb, 0x42, 0x47, 0x21, 0x00, 0x00,
+        0x57, 0x2d, 0xba, 0x42, 0xfd, 0x02, 0xbb, 0x42, 0x4a, 0x21, 0x00, 0x00, 0x57, 0x2d, 0xba, 0x42,
+        0xfd, 0x02, 0xbb, 0x42, 0x2c, 0x21, 0x01, 0x00, 0x3a, 0x0f, 0xbb, 0x42, 0x76, 0xbb, 0xbc, 0x42,
+        0x40, 0x21, 0x00, 0x00, 0x3a, 0x0f, 0xbb, 0x42, 0x76, 0xbb, 0xbc, 0x42, 0x45, 0x21, 0x00, 0x00,
+        0x3a, 0x0f, 0xbb, 0x42, 0x76, 0xbb, 0xbc, 0x42, 0x48, 0x21, 0x00, 0x00, 0x3a, 0x0f, 0xbb, 0x42,
+        0x76, 0xbb, 0xbc, 0x42, 0x2d, 0x21, 0x01, 0x00, 0xfe, 0xd2, 0xbc, 0x42, 0xa4, 0xa8, 0xbd, 0x42,
+        0x36, 0x21, 0x01, 0x00, 0xe0, 0xb4, 0xbd, 0x42, 0x86, 0x8a, 0xbe, 0x42, 0x38, 0x21, 0x01, 0x00,
+        0xc2, 0x96, 0xbe, 0x42, 0xff, 0x42, 0xc0, 0x42, 0x45, 0x21, 0x00, 0x00, 0xc2, 0x96, 0xbe, 0x42,
+        0xff, 0x42, 0xc0, 0x42, 0x48, 0x21, 0x00, 0x00, 0xc2, 0x96, 0xbe, 0x42, 0xff, 0x42, 0xc0, 0x42,
+        0x4c, 0x21, 0x00, 0x00, 0xc2, 0x96, 0xbe, 0x42, 0xff, 0x42, 0xc0, 0x42, 0x2d, 0x21, 0x01, 0x00,
+        0xc2, 0x96, 0xbe, 0x42, 0xff, 0x42, 0xc0, 0x42, 0x39, 0x21, 0x01, 0x00, 0x86, 0x5a, 0xc0, 0x42,
+        0x2c, 0x30, 0xc1, 0x42, 0x42, 0x21, 0x00, 0x00, 0x68, 0x3c, 0xc1, 0x42, 0x0e, 0x12, 0xc2, 0x42,
+        0x44, 0x21, 0x00, 0x00, 0x4a, 0x1e, 0xc2, 0x42, 0xf0, 0xf3, 0xc2, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0x4a, 0x1e, 0xc2, 0x42, 0xf0, 0xf3, 0xc2, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x4a, 0x1e, 0xc2, 0x42,
+        0xf0, 0xf3, 0xc2, 0x42, 0x4e, 0x40, 0x00, 0x00, 0x4a, 0x1e, 0xc2, 0x42, 0x10, 0xd2, 0xc8, 0x42,
+        0x2d, 0x40, 0x01, 0x00, 0x4a, 0x1e, 0xc2, 0x42, 0x10, 0xd2, 0xc8, 0x42, 0x34, 0x40, 0x01, 0x00,
+        0x4a, 0x1e, 0xc2, 0x42, 0x10, 0xd2, 0xc8, 0x42, 0x39, 0x40, 0x01, 0x00, 0x2c, 0x00, 0xc3, 0x42,
+        0xd2, 0xd5, 0xc3, 0x42, 0x50, 0x40, 0x00, 0x00, 0x0e, 0xe2, 0xc3, 0x42, 0xa6, 0xe8, 0xc8, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0x0e, 0xe2, 0xc3, 0x42, 0xa6, 0xe8, 0xc8, 0x42, 0x4c, 0x40, 0x00, 0x00,
+        0x0e, 0xe2, 0xc3, 0x42, 0xa6, 0xe8, 0xc8, 0x42, 0x51, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x7b, 0xc1, 0xb1, 0x3f, 0x4c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xda, 0x31, 0x40,
+        0x40, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xda, 0x31, 0x40, 0x43, 0x31, 0x01, 0x00,
+        0x16, 0x51, 0xbb, 0x3f, 0x48, 0x89, 0x36, 0x40, 0x53, 0x31, 0x00, 0x00, 0x16, 0x51, 0x3b, 0x40,
+        0x57, 0x57, 0xa0, 0x40, 0x53, 0x31, 0x00, 0x00, 0x16, 0x51, 0x3b, 0x40, 0xc5, 0x95, 0xb6, 0x40,
+        0x43, 0x31, 0x01, 0x00, 0x16, 0x51, 0x3b, 0x40, 0xc5, 0x95, 0xb6, 0x40, 0x47, 0x31, 0x01, 0x00,
+        0xf3, 0xe6, 0xa3, 0x40, 0xad, 0xf9, 0xae, 0x40, 0x51, 0x31, 0x00, 0x00, 0x04, 0x9c, 0xaf, 0x40,
+        0xbe, 0xae, 0xba, 0x40, 0x4a, 0x31, 0x00, 0x00, 0x16, 0x51, 0xbb, 0x40, 0x74, 0xc1, 0xe7, 0x40,
+        0x4f, 0x31, 0x00, 0x00, 0x16, 0x51, 0xbb, 0x40, 0x28, 0x1f, 0x0a, 0x41, 0x45, 0x31, 0x01, 0x00,
+        0x16, 0x51, 0xbb, 0x40, 0x28, 0x1f, 0x0a, 0x41, 0x4a, 0x31, 0x01, 0x00, 0x5b, 0x25, 0xea, 0x40,
+        0xdd, 0x4a, 0x0b, 0x41, 0x4e, 0x31, 0x00, 0x00, 0xd0, 0x7c, 0x0c, 0x41, 0x00, 0xb5, 0x22, 0x41,
+        0x48, 0x31, 0x00, 0x00, 0xd0, 0x7c, 0x0c, 0x41, 0x00, 0xb5, 0x22, 0x41, 0x4c, 0x31, 0x00, 0x00,
+        0xd0, 0x7c, 0x0c, 0x41, 0x00, 0xb5, 0x22, 0x41, 0x3c, 0x31, 0x01, 0x00, 0xd0, 0x7c, 0x0c, 0x41,
+        0x00, 0xb5, 0x22, 0x41, 0x43, 0x31, 0x01, 0x00, 0xf3, 0xe6, 0x23, 0x41, 0x22, 0x1f, 0x3a, 0x41,
+        0x4a, 0x31, 0x00, 0x00, 0xf3, 0xe6, 0x23, 0x41, 0x22, 0x1f, 0x3a, 0x41, 0x4e, 0x31, 0x00, 0x00,
+        0xf3, 0xe6, 0x23, 0x41, 0x22, 0x1f, 0x3a, 0x41, 0x3e, 0x31, 0x01, 0x00, 0xf3, 0xe6, 0x23, 0x41,
+        0x22, 0x1f, 0x3a, 0x41, 0x45, 0x31, 0x01, 0x00, 0x16, 0x51, 0x3b, 0x41, 0x0e, 0x6a, 0x46, 0x41,
+        0x4c, 0x31, 0x00, 0x00, 0x16, 0x51, 0x3b, 0x41, 0x0e, 0x6a, 0x46, 0x41, 0x40, 0x31, 0x01, 0x00,
+        0x27, 0x06, 0x47, 0x41, 0x1f, 0x1f, 0x52, 0x41, 0x47, 0x31, 0x00, 0x00, 0x38, 0xbb, 0x52, 0x41,
+        0x68, 0xf3, 0x68, 0x41, 0x53, 0x31, 0x00, 0x00, 0x38, 0xbb, 0x52, 0x41, 0x68, 0xf3, 0x68, 0x41,
+        0x4c, 0x31, 0x00, 0x00, 0x5b, 0x25, 0x6a, 0x41, 0x61, 0xbe, 0x85, 0x41, 0x56, 0x31, 0x00, 0x00,
+        0x5b, 0x25, 0x6a, 0x41, 0x53, 0x3e, 0x75, 0x41, 0x43, 0x31, 0x01, 0x00, 0x6c, 0xda, 0x75, 0x41,
+        0xb2, 0x79, 0x80, 0x41, 0x47, 0x31, 0x01, 0x00, 0xbf, 0xc7, 0x80, 0x41, 0xd7, 0xe3, 0x8b, 0x41,
+        0x4a, 0x31, 0x01, 0x00, 0x48, 0xa2, 0x86, 0x41, 0xf6, 0x66, 0x89, 0x41, 0x53, 0x31, 0x00, 0x00,
+        0x8c, 0x8f, 0x89, 0x41, 0x3a, 0x54, 0x8c, 0x41, 0x4f, 0x31, 0x00, 0x00, 0xd0, 0x7c, 0x8c, 0x41,
+        0x4c, 0x09, 0x92, 0x41, 0x51, 0x31, 0x00, 0x00, 0xd0, 0x7c, 0x8c, 0x41, 0x4c, 0x09, 0x92, 0x41,
+        0x3e, 0x31, 0x01, 0x00, 0x59, 0x57, 0x92, 0x41, 0xd5, 0xe3, 0x97, 0x41, 0x4a, 0x31, 0x00, 0x00,
+        0x59, 0x57, 0x92, 0x41, 0xd5, 0xe3, 0x97, 0x41, 0x45, 0x31, 0x01, 0x00, 0xe2, 0x31, 0x98, 0x41,
+        0x5e, 0xbe, 0x9d, 0x41, 0x4f, 0x31, 0x00, 0x00, 0xe2, 0x31, 0x98, 0x41, 0xf9, 0x4d, 0xa3, 0x41,
+        0x4a, 0x31, 0x01, 0x00, 0x6a, 0x0c, 0x9e, 0x41, 0xe6, 0x98, 0xa3, 0x41, 0x4e, 0x31, 0x00, 0x00,
+        0xf3, 0xe6, 0xa3, 0x41, 0x0b, 0x03, 0xaf, 0x41, 0x48, 0x31, 0x00, 0x00, 0xf3, 0xe6, 0xa3, 0x41,
+        0x0b, 0x03, 0xaf, 0x41, 0x4c, 0x31, 0x00, 0x00, 0xf3, 0xe6, 0xa3, 0x41, 0x6f, 0x73, 0xa9, 0x41,
+        0x3c, 0x31, 0x01, 0x00, 0x7c, 0xc1, 0xa9, 0x41, 0xf8, 0x4d, 0xaf, 0x41, 0x43, 0x34, 0x01, 0x00,
+        0x04, 0x9c, 0xaf, 0x41, 0x1c, 0xb8, 0xba, 0x41, 0x4a, 0x38, 0x00, 0x00, 0x04, 0x9c, 0xaf, 0x41,
+        0x1c, 0xb8, 0xba, 0x41, 0x4e, 0x38, 0x00, 0x00, 0x04, 0x9c, 0xaf, 0x41, 0x80, 0x28, 0xb5, 0x41,
+        0x3e, 0x38, 0x01, 0x00, 0x8d, 0x76, 0xb5, 0x41, 0x09, 0x03, 0xbb, 0x41, 0x45, 0x3c, 0x01, 0x00,
+        0x16, 0x51, 0xbb, 0x41, 0x77, 0x29, 0xc6, 0x41, 0x4c, 0x40, 0x00, 0x00, 0x16, 0x51, 0xbb, 0x41,
+        0xc0, 0xbb, 0xc0, 0x41, 0x34, 0x40, 0x01, 0x00, 0xf1, 0x07, 0xc1, 0x41, 0x9c, 0x72, 0xc6, 0x41,
+        0x3b, 0x40, 0x01, 0x00, 0xcd, 0xbe, 0xc6, 0x41, 0x2f, 0x97, 0xd1, 0x41, 0x53, 0x40, 0x00, 0x00,
+        0xcd, 0xbe, 0xc6, 0x41, 0x2f, 0x97, 0xd1, 0x41, 0x40, 0x40, 0x01, 0x00, 0x84, 0x2c, 0xd2, 0x41,
+        0x9d, 0x72, 0xe2, 0x41, 0x53, 0x40, 0x00, 0x00, 0x84, 0x2c, 0xd2, 0x41, 0x2f, 0x97, 0xd7, 0x41,
+        0x37, 0x40, 0x01, 0x00, 0x60, 0xe3, 0xd7, 0x41, 0x0a, 0x4e, 0xdd, 0x41, 0x3e, 0x40, 0x01, 0x00,
+        0x3b, 0x9a, 0xdd, 0x41, 0x9d, 0x72, 0xe8, 0x41, 0x43, 0x40, 0x01, 0x00, 0x17, 0x51, 0xe3, 0x41,
+        0xe6, 0x04, 0xe6, 0x41, 0x51, 0x40, 0x00, 0x00, 0x84, 0x2c, 0xe6, 0x41, 0x54, 0xe0, 0xe8, 0x41,
+        0x4a, 0x40, 0x00, 0x00, 0xf2, 0x07, 0xe9, 0x41, 0x54, 0xe0, 0xf3, 0x41, 0x4f, 0x40, 0x00, 0x00,
+        0xf2, 0x07, 0xe9, 0x41, 0x9d, 0x72, 0xee, 0x41, 0x32, 0x40, 0x01, 0x00, 0xce, 0xbe, 0xee, 0x41,
+        0x79, 0x29, 0xf4, 0x41, 0x39, 0x40, 0x01, 0x00, 0xa9, 0x75, 0xf4, 0x41, 0x0b, 0x4e, 0xff, 0x41,
+        0x4e, 0x40, 0x00, 0x00, 0xa9, 0x75, 0xf4, 0x41, 0x0b, 0x4e, 0xff, 0x41, 0x3e, 0x40, 0x01, 0x00,
+        0x61, 0xe3, 0xff, 0x41, 0xe1, 0x5d, 0x05, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x61, 0xe3, 0xff, 0x41,
+        0x06, 0xa7, 0x02, 0x42, 0x30, 0x40, 0x01, 0x00, 0x1e, 0xcd, 0x02, 0x42, 0x73, 0x82, 0x05, 0x42,
+        0x37, 0x40, 0x01, 0x00, 0x8c, 0xa8, 0x05, 0x42, 0xbd, 0x14, 0x0b, 0x42, 0x4e, 0x40, 0x00, 0x00,
+        0x8c, 0xa8, 0x05, 0x42, 0xe1, 0x5d, 0x08, 0x42, 0x32, 0x40, 0x01, 0x00, 0xfa, 0x83, 0x08, 0x42,
+        0x4f, 0x39, 0x0b, 0x42, 0x39, 0x40, 0x01, 0x00, 0x67, 0x5f, 0x0b, 0x42, 0x50, 0xab, 0x10, 0x42,
+        0x4c, 0x40, 0x00, 0x00, 0x67, 0x5f, 0x0b, 0x42, 0x9d, 0x04, 0x0e, 0x42, 0x34, 0x40, 0x01, 0x00,
+        0xd3, 0x29, 0x0e, 0x42, 0x09, 0xcf, 0x10, 0x42, 0x3b, 0x40, 0x01, 0x00, 0x3f, 0xf4, 0x10, 0x42,
+        0x28, 0x40, 0x16, 0x42, 0x53, 0x40, 0x00, 0x00, 0x3f, 0xf4, 0x10, 0x42, 0x75, 0x99, 0x13, 0x42,
+        0x40, 0x40, 0x01, 0x00, 0xaa, 0xbe, 0x13, 0x42, 0xe0, 0x63, 0x16, 0x42, 0x3b, 0x40, 0x01, 0x00,
+        0x16, 0x89, 0x16, 0x42, 0xb2, 0x7b, 0x1e, 0x42, 0x56, 0x40, 0x00, 0x00, 0x16, 0x89, 0x16, 0x42,
+        0x4c, 0x2e, 0x19, 0x42, 0x37, 0x40, 0x01, 0x00, 0x81, 0x53, 0x19, 0x42, 0xb7, 0xf8, 0x1b, 0x42,
+        0x3e, 0x40, 0x01, 0x00, 0xed, 0x1d, 0x1c, 0x42, 0xd6, 0x69, 0x21, 0x42, 0x43, 0x40, 0x01, 0x00,
+        0x58, 0xe8, 0x1e, 0x42, 0x35, 0x3a, 0x20, 0x42, 0x53, 0x40, 0x00, 0x00, 0x8e, 0x4d, 0x20, 0x42,
+        0x6b, 0x9f, 0x21, 0x42, 0x4f, 0x40, 0x00, 0x00, 0xc4, 0xb2, 0x21, 0x42, 0xfa, 0x57, 0x24, 0x42,
+        0x51, 0x40, 0x00, 0x00, 0xc4, 0xb2, 0x21, 0x42, 0xfa, 0x57, 0x24, 0x42, 0x32, 0x40, 0x01, 0x00,
+        0x30, 0x7d, 0x24, 0x42, 0x66, 0x22, 0x27, 0x42, 0x4a, 0x40, 0x00, 0x00, 0x30, 0x7d, 0x24, 0x42,
+        0x66, 0x22, 0x27, 0x42, 0x39, 0x40, 0x01, 0x00, 0x9b, 0x47, 0x27, 0x42, 0xd1, 0xec, 0x29, 0x42,
+        0x4f, 0x40, 0x00, 0x00, 0x9b, 0x47, 0x27, 0x42, 0xd1, 0xec, 0x29, 0x42, 0x3e, 0x40, 0x01, 0x00,
+        0x07, 0x12, 0x2a, 0x42, 0x3d, 0xb7, 0x2c, 0x42, 0x4e, 0x40, 0x00, 0x00, 0x07, 0x12, 0x2a, 0x42,
+        0x3d, 0xb7, 0x2c, 0x42, 0x39, 0x40, 0x01, 0x00, 0x72, 0xdc, 0x2c, 0x42, 0x5b, 0x28, 0x32, 0x42,
+        0x43, 0x40, 0x00, 0x00, 0x72, 0xdc, 0x2c, 0x42, 0x5b, 0x28, 0x32, 0x42, 0x48, 0x40, 0x00, 0x00,
+        0x72, 0xdc, 0x2c, 0x42, 0x5b, 0x28, 0x32, 0x42, 0x4c, 0x40, 0x00, 0x00, 0x72, 0xdc, 0x2c, 0x42,
+        0x4f, 0x2e, 0x2e, 0x42, 0x30, 0x40, 0x01, 0x00, 0xa8, 0x41, 0x2e, 0x42, 0x85, 0x93, 0x2f, 0x42,
+        0x37, 0x42, 0x01, 0x00, 0xde, 0xa6, 0x2f, 0x42, 0xba, 0xf8, 0x30, 0x42, 0x3c, 0x44, 0x01, 0x00,
+        0x14, 0x0c, 0x31, 0x42, 0xf0, 0x5d, 0x32, 0x42, 0x37, 0x46, 0x01, 0x00, 0x4a, 0x71, 0x32, 0x42,
+        0x60, 0x9e, 0x37, 0x42, 0x45, 0x48, 0x00, 0x00, 0x4a, 0x71, 0x32, 0x42, 0x60, 0x9e, 0x37, 0x42,
+        0x4a, 0x48, 0x00, 0x00, 0x4a, 0x71, 0x32, 0x42, 0x60, 0x9e, 0x37, 0x42, 0x4e, 0x48, 0x00, 0x00,
+        0x4a, 0x71, 0x32, 0x42, 0x78, 0xbb, 0x33, 0x42, 0x32, 0x48, 0x01, 0x00, 0x61, 0xce, 0x33, 0x42,
+        0x8f, 0x18, 0x35, 0x42, 0x39, 0x4a, 0x01, 0x00, 0x78, 0x2b, 0x35, 0x42, 0xa6, 0x75, 0x36, 0x42,
+        0x3e, 0x4c, 0x01, 0x00, 0x8f, 0x88, 0x36, 0x42, 0xbd, 0xd2, 0x37, 0x42, 0x39, 0x4e, 0x01, 0x00,
+        0xa6, 0xe5, 0x37, 0x42, 0x07, 0xb1, 0x3b, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xa6, 0xe5, 0x37, 0x42,
+        0x7e, 0x28, 0x39, 0x42, 0x34, 0x50, 0x01, 0x00, 0xfb, 0x3a, 0x39, 0x42, 0xd4, 0x7d, 0x3a, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x51, 0x90, 0x3a, 0x42, 0x6d, 0x17, 0x3d, 0x42, 0x42, 0x50, 0x01, 0x00,
+        0xa6, 0xe5, 0x3b, 0x42, 0x7e, 0x28, 0x3d, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xfb, 0x3a, 0x3d, 0x42,
+        0x18, 0xc2, 0x3f, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xfb, 0x3a, 0x3d, 0x42, 0xa1, 0x4a, 0x42, 0x42,
+        0x43, 0x50, 0x01, 0x00, 0xa6, 0xe5, 0x3f, 0x42, 0x7e, 0x28, 0x41, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xfc, 0x3a, 0x41, 0x42, 0xd4, 0x7d, 0x42, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x51, 0x90, 0x42, 0x42,
+        0x6e, 0x17, 0x45, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x51, 0x90, 0x42, 0x42, 0x29, 0xd3, 0x43, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0xa6, 0xe5, 0x43, 0x42, 0x7f, 0x28, 0x45, 0x42, 0x3e, 0x50, 0x01, 0x00,
+        0xfc, 0x3a, 0x45, 0x42, 0x18, 0xc2, 0x47, 0x42, 0x56, 0x50, 0x00, 0x00, 0xfc, 0x3a, 0x45, 0x42,
+        0xd4, 0x7d, 0x46, 0x42, 0x43, 0x50, 0x01, 0x00, 0x51, 0x90, 0x46, 0x42, 0x29, 0xd3, 0x47, 0x42,
+        0x45, 0x50, 0x01, 0x00, 0xa7, 0xe5, 0x47, 0x42, 0xc3, 0x6c, 0x4a, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xa7, 0xe5, 0x47, 0x42, 0x4c, 0xf5, 0x4c, 0x42, 0x47, 0x50, 0x01, 0x00, 0x51, 0x90, 0x4a, 0x42,
+        0x29, 0xd3, 0x4b, 0x42, 0x51, 0x50, 0x00, 0x00, 0xa7, 0xe5, 0x4b, 0x42, 0x7f, 0x28, 0x4d, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0xfc, 0x3a, 0x4d, 0x42, 0x5d, 0x06, 0x51, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0xfc, 0x3a, 0x4d, 0x42, 0xd4, 0x7d, 0x4e, 0x42, 0x32, 0x50, 0x01, 0x00, 0x51, 0x90, 0x4e, 0x42,
+        0x2a, 0xd3, 0x4f, 0x42, 0x39, 0x50, 0x01, 0x00, 0xa7, 0xe5, 0x4f, 0x42, 0xc3, 0x6c, 0x52, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0xfc, 0x3a, 0x51, 0x42, 0xd4, 0x7d, 0x52, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x52, 0x90, 0x52, 0x42, 0x6e, 0x17, 0x55, 0x42, 0x51, 0x50, 0x00, 0x00, 0x52, 0x90, 0x52, 0x42,
+        0xf7, 0x9f, 0x57, 0x42, 0x45, 0x50, 0x01, 0x00, 0xfc, 0x3a, 0x55, 0x42, 0xd4, 0x7d, 0x56, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x52, 0x90, 0x56, 0x42, 0x2a, 0xd3, 0x57, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xa7, 0xe5, 0x57, 0x42, 0x4c, 0xf5, 0x5c, 0x42, 0x43, 0x50, 0x00, 0x00, 0xa7, 0xe5, 0x57, 0x42,
+        0x4c, 0xf5, 0x5c, 0x42, 0x48, 0x50, 0x00, 0x00, 0xa7, 0xe5, 0x57, 0x42, 0x4c, 0xf5, 0x5c, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xa7, 0xe5, 0x57, 0x42, 0x7f, 0x28, 0x59, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0xfc, 0x3a, 0x59, 0x42, 0xd5, 0x7d, 0x5a, 0x42, 0x37, 0x50, 0x01, 0x00, 0x52, 0x90, 0x5a, 0x42,
+        0x6e, 0x17, 0x5d, 0x42, 0x3c, 0x50, 0x01, 0x00, 0xfd, 0x3a, 0x5d, 0x42, 0xa2, 0x4a, 0x62, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xfd, 0x3a, 0x5d, 0x42, 0xa2, 0x4a, 0x62, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xfd, 0x3a, 0x5d, 0x42, 0xa2, 0x4a, 0x62, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xfd, 0x3a, 0x5d, 0x42,
+        0xd5, 0x7d, 0x5e, 0x42, 0x32, 0x50, 0x01, 0x00, 0x52, 0x90, 0x5e, 0x42, 0x2a, 0xd3, 0x5f, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xa7, 0xe5, 0x5f, 0x42, 0xc4, 0x6c, 0x62, 0x42, 0x3e, 0x50, 0x01, 0x00,
+        0x52, 0x90, 0x62, 0x42, 0x95, 0x46, 0x66, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x52, 0x90, 0x62, 0x42,
+        0x26, 0xcc, 0x63, 0x42, 0x34, 0x50, 0x01, 0x00, 0x3c, 0xde, 0x63, 0x42, 0x10, 0x1a, 0x65, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x26, 0x2c, 0x65, 0x42, 0x31, 0xa5, 0x67, 0x42, 0x42, 0x50, 0x01, 0x00,
+        0x10, 0x7a, 0x66, 0x42, 0xe3, 0xb5, 0x67, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xfa, 0xc7, 0x67, 0x42,
+        0x05, 0x41, 0x6a, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xfa, 0xc7, 0x67, 0x42, 0x75, 0xbb, 0x6c, 0x42,
+        0x43, 0x50, 0x01, 0x00, 0xcd, 0x63, 0x6a, 0x42, 0xa1, 0x9f, 0x6b, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xb7, 0xb1, 0x6b, 0x42, 0x8b, 0xed, 0x6c, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xa1, 0xff, 0x6c, 0x42,
+        0xad, 0x78, 0x6f, 0x42, 0x43, 0x50, 0x00, 0x00, 0xa1, 0xff, 0x6c, 0x42, 0xad, 0x78, 0x6f, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xa1, 0xff, 0x6c, 0x42, 0xad, 0x78, 0x6f, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xa1, 0xff, 0x6c, 0x42, 0x75, 0x3b, 0x6e, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x8b, 0x4d, 0x6e, 0x42,
+        0x5f, 0x89, 0x6f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x75, 0x9b, 0x6f, 0x42, 0x80, 0x14, 0x72, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x75, 0x9b, 0x6f, 0x42, 0x80, 0x14, 0x72, 0x42, 0x56, 0x50, 0x00, 0x00,
+        0x75, 0x9b, 0x6f, 0x42, 0x48, 0xd7, 0x70, 0x42, 0x37, 0x50, 0x01, 0x00, 0x5f, 0xe9, 0x70, 0x42,
+        0x32, 0x25, 0x72, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x49, 0x37, 0x72, 0x42, 0x54, 0xb0, 0x74, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x49, 0x37, 0x72, 0x42, 0x54, 0xb0, 0x74, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x49, 0x37, 0x72, 0x42, 0xc4, 0x2a, 0x77, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x1c, 0xd3, 0x74, 0x42,
+        0xf0, 0x0e, 0x76, 0x42, 0x51, 0x50, 0x00, 0x00, 0x06, 0x21, 0x76, 0x42, 0xda, 0x5c, 0x77, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0xf0, 0x6e, 0x77, 0x42, 0xfc, 0xe7, 0x79, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0xf0, 0x6e, 0x77, 0x42, 0xc4, 0xaa, 0x78, 0x42, 0x32, 0x50, 0x01, 0x00, 0xda, 0xbc, 0x78, 0x42,
+        0xae, 0xf8, 0x79, 0x42, 0x39, 0x50, 0x01, 0x00, 0xc4, 0x0a, 0x7a, 0x42, 0x98, 0x46, 0x7b, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0xae, 0x58, 0x7b, 0x42, 0x81, 0x94, 0x7c, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xae, 0x58, 0x7b, 0x42, 0x81, 0x94, 0x7c, 0x42, 0x39, 0x50, 0x01, 0x00, 0x98, 0xa6, 0x7c, 0x42,
+        0x1d, 0xf3, 0x7c, 0x42, 0x51, 0x50, 0x00, 0x00, 0x98, 0xa6, 0x7c, 0x42, 0x09, 0xcd, 0x80, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x12, 0xfa, 0x7c, 0x42, 0x98, 0x46, 0x7d, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x8d, 0x4d, 0x7d, 0x42, 0x98, 0x26, 0x7f, 0x42, 0x51, 0x50, 0x00, 0x00, 0x6b, 0x42, 0x7f, 0x42,
+        0x20, 0x3f, 0x80, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x2b, 0x48, 0x80, 0x42, 0x14, 0xe6, 0x80, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x20, 0xef, 0x80, 0x42, 0x41, 0xca, 0x82, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x20, 0xef, 0x80, 0x42, 0x41, 0xca, 0x82, 0x42, 0x48, 0x50, 0x00, 0x00, 0x20, 0xef, 0x80, 0x42,
+        0x41, 0xca, 0x82, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x20, 0xef, 0x80, 0x42, 0x09, 0x8d, 0x81, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x15, 0x96, 0x81, 0x42, 0xfe, 0x33, 0x82, 0x42, 0x37, 0x52, 0x01, 0x00,
+        0x09, 0x3d, 0x82, 0x42, 0x8f, 0x79, 0x83, 0x42, 0x3c, 0x54, 0x01, 0x00, 0xfe, 0xe3, 0x82, 0x42,
+        0x9a, 0x32, 0x83, 0x42, 0x4e, 0x56, 0x00, 0x00, 0x79, 0x37, 0x83, 0x42, 0x15, 0x86, 0x83, 0x42,
+        0x4f, 0x57, 0x00, 0x00, 0xf3, 0x8a, 0x83, 0x42, 0x79, 0xc7, 0x84, 0x42, 0x4e, 0x58, 0x00, 0x00,
+        0xf3, 0x8a, 0x83, 0x42, 0xdd, 0x28, 0x84, 0x42, 0x32, 0x58, 0x01, 0x00, 0xe8, 0x31, 0x84, 0x42,
+        0xd2, 0xcf, 0x84, 0x42, 0x39, 0x5a, 0x01, 0x00, 0xdd, 0xd8, 0x84, 0x42, 0x63, 0x15, 0x86, 0x42,
+        0x4a, 0x5c, 0x00, 0x00, 0xdd, 0xd8, 0x84, 0x42, 0x63, 0x15, 0x86, 0x42, 0x3e, 0x5c, 0x01, 0x00,
+        0xc7, 0x26, 0x86, 0x42, 0xcc, 0xf7, 0x87, 0x42, 0x43, 0x60, 0x00, 0x00, 0xc7, 0x26, 0x86, 0x42,
+        0xcc, 0xf7, 0x87, 0x42, 0x47, 0x60, 0x00, 0x00, 0xc7, 0x26, 0x86, 0x42, 0xcc, 0xf7, 0x87, 0x42,
+        0x4c, 0x60, 0x00, 0x00, 0xc7, 0x26, 0x86, 0x42, 0x55, 0xc1, 0x86, 0x42, 0x28, 0x60, 0x01, 0x00,
+        0x2f, 0xca, 0x86, 0x42, 0xbc, 0x64, 0x87, 0x42, 0x2f, 0x60, 0x01, 0x00, 0x96, 0x6d, 0x87, 0x42,
+        0x24, 0x08, 0x88, 0x42, 0x34, 0x60, 0x01, 0x00, 0xfd, 0x10, 0x88, 0x42, 0x8b, 0xab, 0x88, 0x42,
+        0x4e, 0x60, 0x00, 0x00, 0xfd, 0x10, 0x88, 0x42, 0x8b, 0xab, 0x88, 0x42, 0x3b, 0x60, 0x01, 0x00,
+        0x65, 0xb4, 0x88, 0x42, 0x2e, 0xea, 0x89, 0x42, 0x4f, 0x60, 0x00, 0x00, 0x65, 0xb4, 0x88, 0x42,
+        0xf2, 0x4e, 0x89, 0x42, 0x40, 0x60, 0x01, 0x00, 0xcc, 0x57, 0x89, 0x42, 0x5a, 0xf2, 0x89, 0x42,
+        0x3b, 0x60, 0x01, 0x00, 0x34, 0xfb, 0x89, 0x42, 0xc1, 0x95, 0x8a, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0x34, 0xfb, 0x89, 0x42, 0xc1, 0x95, 0x8a, 0x42, 0x40, 0x60, 0x01, 0x00, 0x9b, 0x9e, 0x8a, 0x42,
+        0x29, 0x39, 0x8b, 0x42, 0x4c, 0x60, 0x00, 0x00, 0x9b, 0x9e, 0x8a, 0x42, 0x29, 0x39, 0x8b, 0x42,
+        0x3b, 0x60, 0x01, 0x00, 0x03, 0x42, 0x8b, 0x42, 0xcc, 0x77, 0x8c, 0x42, 0x43, 0x60, 0x00, 0x00,
+        0x03, 0x42, 0x8b, 0x42, 0xcc, 0x77, 0x8c, 0x42, 0x47, 0x60, 0x00, 0x00, 0x03, 0x42, 0x8b, 0x42,
+        0xcc, 0x77, 0x8c, 0x42, 0x4a, 0x60, 0x00, 0x00, 0x03, 0x42, 0x8b, 0x42, 0x90, 0xdc, 0x8b, 0x42,
+        0x2b, 0x60, 0x01, 0x00, 0x6a, 0xe5, 0x8b, 0x42, 0xf8, 0x7f, 0x8c, 0x42, 0x32, 0x60, 0x01, 0x00,
+        0xd1, 0x88, 0x8c, 0x42, 0x9b, 0xbe, 0x8d, 0x42, 0x53, 0x60, 0x00, 0x00, 0xd1, 0x88, 0x8c, 0x42,
+        0x9b, 0xbe, 0x8d, 0x42, 0x56, 0x60, 0x00, 0x00, 0xd1, 0x88, 0x8c, 0x42, 0x5f, 0x23, 0x8d, 0x42,
+        0x37, 0x60, 0x01, 0x00, 0x39, 0x2c, 0x8d, 0x42, 0xc6, 0xc6, 0x8d, 0x42, 0x3b, 0x60, 0x01, 0x00,
+        0xa0, 0xcf, 0x8d, 0x42, 0x6a, 0x05, 0x8f, 0x42, 0x53, 0x60, 0x00, 0x00, 0xa0, 0xcf, 0x8d, 0x42,
+        0x2e, 0x6a, 0x8e, 0x42, 0x3e, 0x60, 0x01, 0x00, 0x08, 0x73, 0x8e, 0x42, 0x95, 0x0d, 0x8f, 0x42,
+        0x3b, 0x60, 0x01, 0x00, 0x6f, 0x16, 0x8f, 0x42, 0xfd, 0xb0, 0x8f, 0x42, 0x51, 0x60, 0x00, 0x00,
+        0x6f, 0x16, 0x8f, 0x42, 0xfd, 0xb0, 0x8f, 0x42, 0x3e, 0x60, 0x01, 0x00, 0xd7, 0xb9, 0x8f, 0x42,
+        0x64, 0x54, 0x90, 0x42, 0x4f, 0x60, 0x00, 0x00, 0xd7, 0xb9, 0x8f, 0x42, 0x64, 0x54, 0x90, 0x42,
+        0x3b, 0x60, 0x01, 0x00, 0x3e, 0x5d, 0x90, 0x42, 0x43, 0x2e, 0x92, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0x3e, 0x5d, 0x90, 0x42, 0x43, 0x2e, 0x92, 0x42, 0x51, 0x60, 0x00, 0x00, 0x3e, 0x5d, 0x90, 0x42,
+        0xcc, 0xf7, 0x90, 0x42, 0x26, 0x60, 0x01, 0x00, 0xa5, 0x00, 0x91, 0x42, 0x33, 0x9b, 0x91, 0x42,
+        0x2d, 0x60, 0x01, 0x00, 0x0d, 0xa4, 0x91, 0x42, 0x9a, 0x3e, 0x92, 0x42, 0x32, 0x60, 0x01, 0x00,
+        0x74, 0x47, 0x92, 0x42, 0x02, 0xe2, 0x92, 0x42, 0x53, 0x60, 0x00, 0x00, 0x74, 0x47, 0x92, 0x42,
+        0x02, 0xe2, 0x92, 0x42, 0x39, 0x60, 0x01, 0x00, 0xdc, 0xea, 0x92, 0x42, 0xa5, 0x20, 0x94, 0x42,
+        0x51, 0x60, 0x00, 0x00, 0xdc, 0xea, 0x92, 0x42, 0x69, 0x85, 0x93, 0x42, 0x3e, 0x60, 0x01, 0x00,
+        0x43, 0x8e, 0x93, 0x42, 0xd1, 0x28, 0x94, 0x42, 0x39, 0x60, 0x01, 0x00, 0xab, 0x31, 0x94, 0x42,
+        0x38, 0xcc, 0x94, 0x42, 0x4f, 0x60, 0x00, 0x00, 0xab, 0x31, 0x94, 0x42, 0x38, 0xcc, 0x94, 0x42,
+        0x3e, 0x60, 0x01, 0x00, 0x12, 0xd5, 0x94, 0x42, 0xa0, 0x6f, 0x95, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0x12, 0xd5, 0x94, 0x42, 0xa0, 0x6f, 0x95, 0x42, 0x39, 0x60, 0x01, 0x00, 0x7a, 0x78, 0x95, 0x42,
+        0xbb, 0xe4, 0x97, 0x42, 0x43, 0x60, 0x00, 0x00, 0x7a, 0x78, 0x95, 0x42, 0xbb, 0xe4, 0x97, 0x42,
+        0x48, 0x60, 0x00, 0x00, 0x7a, 0x78, 0x95, 0x42, 0xbb, 0xe4, 0x97, 0x42, 0x4c, 0x60, 0x00, 0x00,
+        0x7a, 0x78, 0x95, 0x42, 0x07, 0x13, 0x96, 0x42, 0x24, 0x60, 0x01, 0x00, 0xe1, 0x1b, 0x96, 0x42,
+        0x6e, 0xb6, 0x96, 0x42, 0x2b, 0x60, 0x01, 0x00, 0x48, 0xbf, 0x96, 0x42, 0xd6, 0x59, 0x97, 0x42,
+        0x30, 0x60, 0x01, 0x00, 0xb0, 0x62, 0x97, 0x42, 0x3d, 0xfd, 0x97, 0x42, 0x34, 0x60, 0x01, 0x00,
+        0x17, 0x06, 0x98, 0x42, 0x58, 0x72, 0x9a, 0x42, 0x45, 0x60, 0x00, 0x00, 0x17, 0x06, 0x98, 0x42,
+        0x58, 0x72, 0x9a, 0x42, 0x4a, 0x60, 0x00, 0x00, 0x17, 0x06, 0x98, 0x42, 0x58, 0x72, 0x9a, 0x42,
+        0x4e, 0x60, 0x00, 0x00, 0x17, 0x06, 0x98, 0x42, 0xa5, 0xa0, 0x98, 0x42, 0x26, 0x60, 0x01, 0x00,
+        0x7f, 0xa9, 0x98, 0x42, 0x0c, 0x44, 0x99, 0x42, 0x2d, 0x60, 0x01, 0x00, 0xe6, 0x4c, 0x99, 0x42,
+        0x74, 0xe7, 0x99, 0x42, 0x32, 0x60, 0x01, 0x00, 0x4e, 0xf0, 0x99, 0x42, 0xdb, 0x8a, 0x9a, 0x42,
+        0x36, 0x60, 0x01, 0x00, 0xb5, 0x93, 0x9a, 0x42, 0x0a, 0x5b, 0x9c, 0x42, 0x43, 0x60, 0x00, 0x00,
+        0xb5, 0x93, 0x9a, 0x42, 0x0a, 0x5b, 0x9c, 0x42, 0x47, 0x60, 0x00, 0x00, 0xb5, 0x93, 0x9a, 0x42,
+        0x0a, 0x5b, 0x9c, 0x42, 0x4c, 0x60, 0x00, 0x00, 0xb5, 0x93, 0x9a, 0x42, 0x0a, 0x2b, 0x9b, 0x42,
+        0x28, 0x60, 0x01, 0x00, 0xb5, 0x33, 0x9b, 0x42, 0x0a, 0xcb, 0x9b, 0x42, 0x2f, 0x60, 0x01, 0x00,
+        0xb5, 0xd3, 0x9b, 0x42, 0x0a, 0x6b, 0x9c, 0x42, 0x34, 0x60, 0x01, 0x00, 0xb5, 0x73, 0x9c, 0x42,
+        0x0a, 0x0b, 0x9d, 0x42, 0x4e, 0x60, 0x00, 0x00, 0xb5, 0x73, 0x9c, 0x42, 0x0a, 0x0b, 0x9d, 0x42,
+        0x3b, 0x60, 0x01, 0x00, 0xb5, 0x13, 0x9d, 0x42, 0x0a, 0x43, 0x9e, 0x42, 0x4f, 0x60, 0x00, 0x00,
+        0xb5, 0x13, 0x9d, 0x42, 0x0a, 0xab, 0x9d, 0x42, 0x40, 0x60, 0x01, 0x00, 0xb5, 0xb3, 0x9d, 0x42,
+        0x0a, 0x4b, 0x9e, 0x42, 0x3b, 0x60, 0x01, 0x00, 0xb5, 0x53, 0x9e, 0x42, 0x0a, 0xeb, 0x9e, 0x42,
+        0x4e, 0x60, 0x00, 0x00, 0xb5, 0x53, 0x9e, 0x42, 0x0a, 0xeb, 0x9e, 0x42, 0x40, 0x60, 0x01, 0x00,
+        0xb5, 0xf3, 0x9e, 0x42, 0x0a, 0x8b, 0x9f, 0x42, 0x4c, 0x60, 0x00, 0x00, 0xb5, 0xf3, 0x9e, 0x42,
+        0x0a, 0x8b, 0x9f, 0x42, 0x3b, 0x60, 0x01, 0x00, 0xb5, 0x93, 0x9f, 0x42, 0x0a, 0x2b, 0xa0, 0x42,
+        0x47, 0x60, 0x00, 0x00, 0xb5, 0x93, 0x9f, 0x42, 0x0a, 0x2b, 0xa0, 0x42, 0x4a, 0x60, 0x00, 0x00,
+        0xb5, 0x93, 0x9f, 0x42, 0x0a, 0x2b, 0xa0, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xb5, 0x33, 0xa0, 0x42,
+        0x0a, 0xcb, 0xa0, 0x42, 0x43, 0x60, 0x00, 0x00, 0xb5, 0x33, 0xa0, 0x42, 0x0a, 0xcb, 0xa0, 0x42,
+        0x47, 0x60, 0x00, 0x00, 0xb5, 0x33, 0xa0, 0x42, 0x0a, 0xcb, 0xa0, 0x42, 0x32, 0x60, 0x01, 0x00,
+        0xb5, 0xd3, 0xa0, 0x42, 0x0a, 0x03, 0xa2, 0x42, 0x53, 0x60, 0x00, 0x00, 0xb5, 0xd3, 0xa0, 0x42,
+        0x0a, 0x03, 0xa2, 0x42, 0x56, 0x60, 0x00, 0x00, 0xb5, 0xd3, 0xa0, 0x42, 0x0a, 0x6b, 0xa1, 0x42,
+        0x37, 0x60, 0x01, 0x00, 0xb5, 0x73, 0xa1, 0x42, 0x0a, 0x0b, 0xa2, 0x42, 0x3b, 0x60, 0x01, 0x00,
+        0xb5, 0x13, 0xa2, 0x42, 0x0a, 0x43, 0xa3, 0x42, 0x4f, 0x60, 0x00, 0x00, 0xb5, 0x13, 0xa2, 0x42,
+        0x0a, 0x43, 0xa3, 0x42, 0x53, 0x60, 0x00, 0x00, 0xb5, 0x13, 0xa2, 0x42, 0x0a, 0xab, 0xa2, 0x42,
+        0x3e, 0x60, 0x01, 0x00, 0xb5, 0xb3, 0xa2, 0x42, 0x0a, 0x4b, 0xa3, 0x42, 0x3b, 0x60, 0x01, 0x00,
+        0xb5, 0x53, 0xa3, 0x42, 0x0a, 0xeb, 0xa3, 0x42, 0x51, 0x60, 0x00, 0x00, 0xb5, 0x53, 0xa3, 0x42,
+        0x0a, 0xeb, 0xa3, 0x42, 0x3e, 0x60, 0x01, 0x00, 0xb5, 0xf3, 0xa3, 0x42, 0x0a, 0x8b, 0xa4, 0x42,
+        0x4f, 0x60, 0x00, 0x00, 0xb5, 0xf3, 0xa3, 0x42, 0x0a, 0x8b, 0xa4, 0x42, 0x3b, 0x60, 0x01, 0x00,
+        0xb5, 0x93, 0xa4, 0x42, 0x0a, 0xc3, 0xa5, 0x42, 0x4a, 0x60, 0x00, 0x00, 0xb5, 0x93, 0xa4, 0x42,
+        0x0a, 0xc3, 0xa5, 0x42, 0x4e, 0x60, 0x00, 0x00, 0xb5, 0x93, 0xa4, 0x42, 0x0a, 0xc3, 0xa5, 0x42,
+        0x51, 0x60, 0x00, 0x00, 0xb5, 0x93, 0xa4, 0x42, 0x0a, 0x2b, 0xa5, 0x42, 0x26, 0x60, 0x01, 0x00,
+        0xb5, 0x33, 0xa5, 0x42, 0x0a, 0xcb, 0xa5, 0x42, 0x2d, 0x60, 0x01, 0x00, 0xb5, 0xd3, 0xa5, 0x42,
+        0x0a, 0x6b, 0xa6, 0x42, 0x32, 0x60, 0x01, 0x00, 0xb5, 0x73, 0xa6, 0x42, 0x0a, 0x0b, 0xa7, 0x42,
+        0x53, 0x60, 0x00, 0x00, 0xb5, 0x73, 0xa6, 0x42, 0x0a, 0x0b, 0xa7, 0x42, 0x39, 0x60, 0x01, 0x00,
+        0xb5, 0x13, 0xa7, 0x42, 0x60, 0x38, 0xa7, 0x42, 0x51, 0x60, 0x00, 0x00, 0xb5, 0x13, 0xa7, 0x42,
+        0x0a, 0xab, 0xa7, 0x42, 0x3e, 0x60, 0x01, 0x00, 0xb5, 0x3b, 0xa7, 0x42, 0x60, 0x60, 0xa7, 0x42,
+        0x53, 0x60, 0x00, 0x00, 0xb5, 0x63, 0xa7, 0x42, 0x60, 0x46, 0xa8, 0x42, 0x51, 0x60, 0x00, 0x00,
+        0xb5, 0xb3, 0xa7, 0x42, 0x0a, 0x4b, 0xa8, 0x42, 0x39, 0x60, 0x01, 0x00, 0xb5, 0x53, 0xa8, 0x42,
+        0x0a, 0xeb, 0xa8, 0x42, 0x4f, 0x60, 0x00, 0x00, 0xb5, 0x53, 0xa8, 0x42, 0x0a, 0xeb, 0xa8, 0x42,
+        0x3e, 0x60, 0x01, 0x00, 0xb5, 0xf3, 0xa8, 0x42, 0x0a, 0x8b, 0xa9, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0xb5, 0xf3, 0xa8, 0x42, 0x0a, 0x8b, 0xa9, 0x42, 0x39, 0x60, 0x01, 0x00, 0xb5, 0x93, 0xa9, 0x42,
+        0x0a, 0x5b, 0xab, 0x42, 0x43, 0x60, 0x00, 0x00, 0xb5, 0x93, 0xa9, 0x42, 0x0a, 0x5b, 0xab, 0x42,
+        0x48, 0x60, 0x00, 0x00, 0xb5, 0x93, 0xa9, 0x42, 0x0a, 0x5b, 0xab, 0x42, 0x4c, 0x60, 0x00, 0x00,
+        0xb5, 0x93, 0xa9, 0x42, 0x0a, 0x2b, 0xaa, 0x42, 0x24, 0x60, 0x01, 0x00, 0xb5, 0x33, 0xaa, 0x42,
+        0x0a, 0xcb, 0xaa, 0x42, 0x2b, 0x60, 0x01, 0x00, 0xb5, 0xd3, 0xaa, 0x42, 0x0a, 0x03, 0xac, 0x42,
+        0x30, 0x60, 0x01, 0x00, 0xb5, 0x73, 0xab, 0x42, 0x0a, 0xbf, 0xab, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0xb5, 0xc3, 0xab, 0x42, 0x0a, 0x0f, 0xac, 0x42, 0x4f, 0x60, 0x00, 0x00, 0xb5, 0x13, 0xac, 0x42,
+        0x0a, 0x43, 0xad, 0x42, 0x45, 0x60, 0x00, 0x00, 0xb5, 0x13, 0xac, 0x42, 0x0a, 0x43, 0xad, 0x42,
+        0x4a, 0x60, 0x00, 0x00, 0xb5, 0x13, 0xac, 0x42, 0x0a, 0x43, 0xad, 0x42, 0x4e, 0x60, 0x00, 0x00,
+        0xb5, 0x13, 0xac, 0x42, 0x0a, 0xab, 0xac, 0x42, 0x26, 0x60, 0x01, 0x00, 0xb5, 0xb3, 0xac, 0x42,
+        0x0a, 0x4b, 0xad, 0x42, 0x2d, 0x60, 0x01, 0x00, 0xb5, 0x53, 0xad, 0x42, 0x0a, 0x83, 0xae, 0x42,
+        0x45, 0x60, 0x00, 0x00, 0xb5, 0x53, 0xad, 0x42, 0x0a, 0x83, 0xae, 0x42, 0x4a, 0x60, 0x00, 0x00,
+        0xb5, 0x53, 0xad, 0x42, 0x0a, 0x83, 0xae, 0x42, 0x32, 0x60, 0x01, 0x00, 0xb5, 0x93, 0xae, 0x42,
+        0xfd, 0x24, 0xaf, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xb5, 0x93, 0xae, 0x42, 0x6d, 0x22, 0xb3, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0xb5, 0x93, 0xae, 0x42, 0x6d, 0x22, 0xb3, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0xb5, 0x93, 0xae, 0x42, 0x6d, 0x22, 0xb3, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x4e, 0x2d, 0xaf, 0x42,
+        0xa0, 0x75, 0xaf, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1b, 0x7a, 0xaf, 0x42, 0x6d, 0xc2, 0xaf, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xe8, 0xc6, 0xaf, 0x42, 0x30, 0x58, 0xb0, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x82, 0x60, 0xb0, 0x42, 0xc9, 0xf1, 0xb0, 0x42, 0x47, 0x50, 0x00, 0x00, 0x1b, 0xfa, 0xb0, 0x42,
+        0x63, 0x8b, 0xb1, 0x42, 0x45, 0x50, 0x00, 0x00, 0xb5, 0x93, 0xb1, 0x42, 0x07, 0xdc, 0xb1, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x81, 0xe0, 0xb1, 0x42, 0xd3, 0x28, 0xb2, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x4e, 0x2d, 0xb2, 0x42, 0x96, 0xbe, 0xb2, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xe8, 0xc6, 0xb2, 0x42,
+        0x2f, 0x58, 0xb3, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x81, 0x60, 0xb3, 0x42, 0xc9, 0xf1, 0xb3, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x81, 0x60, 0xb3, 0x42, 0x39, 0xef, 0xb7, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x81, 0x60, 0xb3, 0x42, 0x39, 0xef, 0xb7, 0x42, 0x37, 0x50, 0x01, 0x00, 0x81, 0x60, 0xb3, 0x42,
+        0x39, 0xef, 0xb7, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x1b, 0xfa, 0xb3, 0x42, 0x6d, 0x42, 0xb4, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0xe8, 0x46, 0xb4, 0x42, 0x39, 0x8f, 0xb4, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0xb4, 0x93, 0xb4, 0x42, 0xfc, 0x24, 0xb5, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x4e, 0x2d, 0xb5, 0x42,
+        0x95, 0xbe, 0xb5, 0x42, 0x47, 0x50, 0x00, 0x00, 0xe7, 0xc6, 0xb5, 0x42, 0x2f, 0x58, 0xb6, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x81, 0x60, 0xb6, 0x42, 0xd3, 0xa8, 0xb6, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x4e, 0xad, 0xb6, 0x42, 0xa0, 0xf5, 0xb6, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x1a, 0xfa, 0xb6, 0x42,
+        0x62, 0x8b, 0xb7, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xb4, 0x93, 0xb7, 0x42, 0xfc, 0x24, 0xb8, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x4e, 0x2d, 0xb8, 0x42, 0x95, 0xbe, 0xb8, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x4e, 0x2d, 0xb8, 0x42, 0x05, 0xbc, 0xbc, 0x42, 0x32, 0x50, 0x01, 0x00, 0x4e, 0x2d, 0xb8, 0x42,
+        0x05, 0xbc, 0xbc, 0x42, 0x36, 0x50, 0x01, 0x00, 0x4e, 0x2d, 0xb8, 0x42, 0x05, 0xbc, 0xbc, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xe7, 0xc6, 0xb8, 0x42, 0x39, 0x0f, 0xb9, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xb4, 0x13, 0xb9, 0x42, 0x06, 0x5c, 0xb9, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x81, 0x60, 0xb9, 0x42,
+        0xc8, 0xf1, 0xb9, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x1a, 0xfa, 0xb9, 0x42, 0x62, 0x8b, 0xba, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xb4, 0x93, 0xba, 0x42, 0xfb, 0x24, 0xbb, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x4d, 0x2d, 0xbb, 0x42, 0x9f, 0x75, 0xbb, 0x42, 0x47, 0x50, 0x00, 0x00, 0x1a, 0x7a, 0xbb, 0x42,
+        0x6c, 0xc2, 0xbb, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xe7, 0xc6, 0xbb, 0x42, 0x2e, 0x58, 0xbc, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x80, 0x60, 0xbc, 0x42, 0xc8, 0xf1, 0xbc, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x1a, 0xfa, 0xbc, 0x42, 0x61, 0x8b, 0xbd, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x1a, 0xfa, 0xbc, 0x42,
+        0x24, 0x41, 0xbf, 0x42, 0x30, 0x50, 0x01, 0x00, 0x1a, 0xfa, 0xbc, 0x42, 0x24, 0x41, 0xbf, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x1a, 0xfa, 0xbc, 0x42, 0x24, 0x41, 0xbf, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0xb3, 0x93, 0xbd, 0x42, 0x05, 0xdc, 0xbd, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x80, 0xe0, 0xbd, 0x42,
+        0xd2, 0x28, 0xbe, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x4d, 0x2d, 0xbe, 0x42, 0x94, 0xbe, 0xbe, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0xe6, 0xc6, 0xbe, 0x42, 0x38, 0x0f, 0xbf, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0xb3, 0x13, 0xbf, 0x42, 0x05, 0x5c, 0xbf, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x80, 0x60, 0xbf, 0x42,
+        0xd2, 0xa8, 0xbf, 0x42, 0x47, 0x50, 0x00, 0x00, 0x80, 0x60, 0xbf, 0x42, 0x8a, 0xa7, 0xc1, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x80, 0x60, 0xbf, 0x42, 0x8a, 0xa7, 0xc1, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x80, 0x60, 0xbf, 0x42, 0x8a, 0xa7, 0xc1, 0x42, 0x39, 0x50, 0x01, 0x00, 0x4d, 0xad, 0xbf, 0x42,
+        0x9f, 0xf5, 0xbf, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x19, 0xfa, 0xbf, 0x42, 0x6b, 0x42, 0xc0, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xe6, 0x46, 0xc0, 0x42, 0x38, 0x8f, 0xc0, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xb3, 0x93, 0xc0, 0x42, 0xfb, 0x24, 0xc1, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x4d, 0x2d, 0xc1, 0x42,
+        0x94, 0xbe, 0xc1, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xe6, 0xc6, 0xc1, 0x42, 0x2e, 0x58, 0xc2, 0x42,
+        0x58, 0x50, 0x00, 0x00, 0xe6, 0xc6, 0xc1, 0x42, 0x9e, 0x55, 0xc6, 0x42, 0x40, 0x50, 0x01, 0x00,
+        0xe6, 0xc6, 0xc1, 0x42, 0x9e, 0x55, 0xc6, 0x42, 0x43, 0x50, 0x01, 0x00, 0xe6, 0xc6, 0xc1, 0x42,
+        0x9e, 0x55, 0xc6, 0x42, 0x47, 0x50, 0x01, 0x00, 0x80, 0x60, 0xc2, 0x42, 0xd1, 0xa8, 0xc2, 0x42,
+        0x5a, 0x50, 0x00, 0x00, 0x4c, 0xad, 0xc2, 0x42, 0x9e, 0xf5, 0xc2, 0x42, 0x58, 0x50, 0x00, 0x00,
+        0x19, 0xfa, 0xc2, 0x42, 0x61, 0x8b, 0xc3, 0x42, 0x56, 0x50, 0x00, 0x00, 0xb3, 0x93, 0xc3, 0x42,
+        0xfa, 0x24, 0xc4, 0x42, 0x53, 0x50, 0x00, 0x00, 0x4c, 0x2d, 0xc4, 0x42, 0x94, 0xbe, 0xc4, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0xe6, 0xc6, 0xc4, 0x42, 0x38, 0x0f, 0xc5, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xb3, 0x13, 0xc5, 0x42, 0x04, 0x5c, 0xc5, 0x42, 0x56, 0x50, 0x00, 0x00, 0x7f, 0x60, 0xc5, 0x42,
+        0xc7, 0xf1, 0xc5, 0x42, 0x58, 0x50, 0x00, 0x00, 0x19, 0xfa, 0xc5, 0x42, 0x60, 0x8b, 0xc6, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0xb2, 0x93, 0xc6, 0x42, 0xf1, 0x27, 0xc7, 0x42, 0x58, 0x50, 0x00, 0x00,
+        0xb2, 0x93, 0xc6, 0x42, 0x36, 0x52, 0xcb, 0x42, 0x43, 0x50, 0x01, 0x00, 0xb2, 0x93, 0xc6, 0x42,
+        0x36, 0x52, 0xcb, 0x42, 0x47, 0x50, 0x01, 0x00, 0xb2, 0x93, 0xc6, 0x42, 0x36, 0x52, 0xcb, 0x42,
+        0x4a, 0x50, 0x01, 0x00, 0x6e, 0x30, 0xc7, 0x42, 0x3a, 0x7a, 0xc7, 0x42, 0x5a, 0x50, 0x00, 0x00,
+        0xcd, 0x7e, 0xc7, 0x42, 0x98, 0xc8, 0xc7, 0x42, 0x58, 0x50, 0x00, 0x00, 0x2b, 0xcd, 0xc7, 0x42,
+        0x69, 0x61, 0xc8, 0x42, 0x56, 0x50, 0x00, 0x00, 0xe7, 0x69, 0xc8, 0x42, 0x26, 0xfe, 0xc8, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0xa3, 0x06, 0xc9, 0x42, 0x31, 0xa1, 0xc9, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x0a, 0xaa, 0xc9, 0x42, 0xfa, 0xf6, 0xc9, 0x42, 0x53, 0x50, 0x00, 0x00, 0xbe, 0xfb, 0xc9, 0x42,
+        0xae, 0x48, 0xca, 0x42, 0x56, 0x50, 0x00, 0x00, 0x72, 0x4d, 0xca, 0x42, 0xff, 0xe7, 0xca, 0x42,
+        0x5b, 0x50, 0x00, 0x00, 0xd9, 0xf0, 0xca, 0x42, 0x67, 0x8b, 0xcb, 0x42, 0x5a, 0x50, 0x00, 0x00,
+        0x41, 0x94, 0xcb, 0x42, 0xad, 0x35, 0xcc, 0x42, 0x58, 0x50, 0x00, 0x00, 0x41, 0x94, 0xcb, 0x42,
+        0x27, 0xc1, 0xd0, 0x42, 0x42, 0x50, 0x01, 0x00, 0x41, 0x94, 0xcb, 0x42, 0x27, 0xc1, 0xd0, 0x42,
+        0x45, 0x50, 0x01, 0x00, 0x41, 0x94, 0xcb, 0x42, 0x27, 0xc1, 0xd0, 0x42, 0x4a, 0x50, 0x01, 0x00,
+        0xeb, 0x3e, 0xcc, 0x42, 0x46, 0x8f, 0xcc, 0x42, 0x5a, 0x50, 0x00, 0x00, 0x41, 0x94, 0xcc, 0x42,
+        0x9c, 0xe4, 0xcc, 0x42, 0x58, 0x50, 0x00, 0x00, 0x96, 0xe9, 0xcc, 0x42, 0x02, 0x8b, 0xcd, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x41, 0x94, 0xcd, 0x42, 0xad, 0x35, 0xce, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xeb, 0x3e, 0xce, 0x42, 0xda, 0xe7, 0xce, 0x42, 0x51, 0x50, 0x00, 0x00, 0x86, 0xf1, 0xce, 0x42,
+        0x9e, 0x45, 0xcf, 0x42, 0x53, 0x50, 0x00, 0x00, 0xd4, 0x4a, 0xcf, 0x42, 0xec, 0x9e, 0xcf, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x21, 0xa4, 0xcf, 0x42, 0x0f, 0x4d, 0xd0, 0x42, 0x58, 0x50, 0x00, 0x00,
+        0xbc, 0x56, 0xd0, 0x42, 0xaa, 0xff, 0xd0, 0x42, 0x56, 0x50, 0x00, 0x00, 0x57, 0x09, 0xd1, 0x42,
+        0x83, 0xba, 0xd1, 0x42, 0x5b, 0x50, 0x00, 0x00, 0x57, 0x09, 0xd1, 0x42, 0x9d, 0xe1, 0xd3, 0x42,
+        0x43, 0x50, 0x01, 0x00, 0x57, 0x09, 0xd1, 0x42, 0x9d, 0xe1, 0xd3, 0x42, 0x48, 0x50, 0x01, 0x00,
+        0x57, 0x09, 0xd1, 0x42, 0x9d, 0xe1, 0xd3, 0x42, 0x4c, 0x50, 0x01, 0x00, 0xa8, 0xc4, 0xd1, 0x42,
+        0xda, 0x1c, 0xd2, 0x42, 0x5a, 0x50, 0x00, 0x00, 0x51, 0x22, 0xd2, 0x42, 0x83, 0x7a, 0xd2, 0x42,
+        0x58, 0x50, 0x00, 0x00, 0xf9, 0x7f, 0xd2, 0x42, 0x3b, 0x3a, 0xd3, 0x42, 0x5a, 0x50, 0x00, 0x00,
+        0xe6, 0x44, 0xd3, 0x42, 0x9d, 0xa1, 0xd3, 0x42, 0x58, 0x50, 0x00, 0x00, 0x5c, 0xa7, 0xd3, 0x42,
+        0x13, 0x04, 0xd4, 0x42, 0x56, 0x50, 0x00, 0x00, 0xd2, 0x09, 0xd4, 0x42, 0x3f, 0x6a, 0xd4, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0xd2, 0x09, 0xd4, 0x42, 0xca, 0x4b, 0xd7, 0x42, 0x42, 0x50, 0x01, 0x00,
+        0xd2, 0x09, 0xd4, 0x42, 0xca, 0x4b, 0xd7, 0x42, 0x47, 0x50, 0x01, 0x00, 0xd2, 0x09, 0xd4, 0x42,
+        0xca, 0x4b, 0xd7, 0x42, 0x4a, 0x50, 0x01, 0x00, 0x38, 0x70, 0xd4, 0x42, 0xa5, 0xd0, 0xd4, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x9f, 0xd6, 0xd4, 0x42, 0x0c, 0x37, 0xd5, 0x42, 0x58, 0x50, 0x00, 0x00,
+        0x05, 0x3d, 0xd5, 0x42, 0x72, 0x9d, 0xd5, 0x42, 0x56, 0x50, 0x00, 0x00, 0x6b, 0xa3, 0xd5, 0x42,
+        0xee, 0x82, 0xd6, 0x42, 0x5b, 0x50, 0x00, 0x00, 0xba, 0x8f, 0xd6, 0x42, 0x3d, 0x6f, 0xd7, 0x42,
+        0x5a, 0x50, 0x00, 0x00, 0x09, 0x7c, 0xd7, 0x42, 0x8f, 0xf2, 0xe8, 0x42, 0x58, 0x40, 0x00, 0x00,
+        0x09, 0x7c, 0xd7, 0x42, 0x8c, 0x5b, 0xd8, 0x42, 0x28, 0x40, 0x01, 0x00, 0x58, 0x68, 0xd8, 0x42,
+        0xdb, 0x47, 0xd9, 0x42, 0x2f, 0x40, 0x01, 0x00, 0xa7, 0x54, 0xd9, 0x42, 0xcd, 0x5c, 0xda, 0x42,
+        0x34, 0x40, 0x01, 0x00, 0xed, 0x6b, 0xda, 0x42, 0x12, 0x74, 0xdb, 0x42, 0x3b, 0x40, 0x01, 0x00,
+        0x33, 0x83, 0xdb, 0x42, 0x00, 0x30, 0xe9, 0x42, 0x40, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x77, 0x77, 0xff, 0x3e, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xff, 0x3e,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbc, 0xbb, 0x7f, 0x3f, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3f, 0xbc, 0xbb, 0x7f, 0x3f, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x3f,
+        0xde, 0xdd, 0xbf, 0x3f, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0xde, 0xdd, 0xff, 0x3f,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0xde, 0xdd, 0xff, 0x3f, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0xef, 0xee, 0x1f, 0x40, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+        0xef, 0xee, 0x1f, 0x40, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x40, 0xef, 0xee, 0x3f, 0x40,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0xef, 0xee, 0x3f, 0x40, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x40, 0xef, 0xee, 0x5f, 0x40, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+        0xef, 0xee, 0x7f, 0x40, 0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x40, 0xef, 0xee, 0x7f, 0x40,
+        0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xbc, 0xfb, 0x07, 0x41, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x41, 0xbc, 0xfb, 0x07, 0x41, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x08, 0x41,
+        0xbc, 0xfb, 0x0f, 0x41, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0xbc, 0xfb, 0x0f, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x41, 0xbc, 0xfb, 0x17, 0x41, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x41, 0xbc, 0xfb, 0x1f, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x18, 0x41,
+        0xbc, 0xfb, 0x1f, 0x41, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0xbc, 0xfb, 0x27, 0x41,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0xbc, 0xfb, 0x27, 0x41, 0x33, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x28, 0x41, 0xbc, 0xfb, 0x2f, 0x41, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x41,
+        0xbc, 0xfb, 0x2f, 0x41, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x30, 0x41, 0xbc, 0xfb, 0x37, 0x41,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0xbc, 0xfb, 0x3f, 0x41, 0x3f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x38, 0x41, 0xbc, 0xfb, 0x3f, 0x41, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x41,
+        0xbc, 0xfb, 0x77, 0x41, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x41, 0xbc, 0xfb, 0x77, 0x41,
+        0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0xbc, 0xfb, 0x73, 0x41, 0x46, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x74, 0x41, 0xbc, 0xfb, 0x77, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x41,
+        0xbc, 0xfb, 0x7f, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x41, 0xbc, 0xfb, 0x7f, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x41, 0xde, 0xfd, 0x81, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x80, 0x41, 0xde, 0xfd, 0x83, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x82, 0x41,
+        0xde, 0xfd, 0x87, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x41, 0xde, 0xfd, 0x87, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x88, 0x41, 0xde, 0xfd, 0x89, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x8a, 0x41, 0xde, 0xfd, 0x8f, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x41,
+        0xde, 0xfd, 0x8f, 0x41, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41, 0xde, 0xfd, 0x91, 0x41,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0xde, 0xfd, 0x93, 0x41, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x92, 0x41, 0xde, 0xfd, 0x97, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x94, 0x41,
+        0xde, 0xfd, 0x9b, 0x41, 0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x98, 0x41, 0xde, 0xfd, 0x99, 0x41,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x41, 0xde, 0xfd, 0x9b, 0x41, 0x4b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9c, 0x41, 0xde, 0xfd, 0x9f, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x41,
+        0xde, 0xfd, 0x9f, 0x41, 0x2e, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x41, 0xde, 0xfd, 0xa3, 0x41,
+        0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x41, 0xde, 0xfd, 0xa3, 0x41, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa4, 0x41, 0xde, 0xfd, 0xa7, 0x41, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x41,
+        0xde, 0xfd, 0xa7, 0x41, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41, 0xde, 0xfd, 0xab, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x41, 0xde, 0xfd, 0xaf, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xac, 0x41, 0xde, 0xfd, 0xaf, 0x41, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x41,
+        0xde, 0xfd, 0xb3, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x41, 0xde, 0xfd, 0xbb, 0x41,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x41, 0xde, 0xfd, 0xb9, 0x41, 0x46, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xba, 0x41, 0xde, 0xfd, 0xbb, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x41,
+        0xde, 0xfd, 0xbf, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x41, 0xde, 0xfd, 0xbf, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0xde, 0xfd, 0xc1, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0xde, 0xfd, 0xc3, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x41,
+        0xde, 0xfd, 0xc7, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x41, 0xde, 0xfd, 0xc7, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x41, 0xde, 0xfd, 0xc9, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xca, 0x41, 0xde, 0xfd, 0xcf, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x41,
+        0xde, 0xfd, 0xcf, 0x41, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x41, 0xde, 0xfd, 0xd1, 0x41,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x41, 0xde, 0xfd, 0xd3, 0x41, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd2, 0x41, 0xde, 0xfd, 0xd7, 0x41, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x41,
+        0xde, 0xfd, 0xdb, 0x41, 0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x41, 0xde, 0xfd, 0xd9, 0x41,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xda, 0x41, 0xde, 0xfd, 0xdb, 0x41, 0x4b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xdc, 0x41, 0xde, 0xfd, 0xdf, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x41,
+        0xde, 0xfd, 0xdf, 0x41, 0x2e, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x41, 0xde, 0xfd, 0xe3, 0x41,
+        0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41, 0xde, 0xfd, 0xe3, 0x41, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe4, 0x41, 0xde, 0xfd, 0xe7, 0x41, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x41,
+        0xde, 0xfd, 0xeb, 0x41, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x41, 0xde, 0xfd, 0xeb, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xec, 0x41, 0xde, 0xfd, 0xef, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xec, 0x41, 0xde, 0xfd, 0xef, 0x41, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0xde, 0xfd, 0xf3, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x41, 0xde, 0xfd, 0xfb, 0x41,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf8, 0x41, 0xde, 0xfd, 0xf9, 0x41, 0x46, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xfa, 0x41, 0xde, 0xfd, 0xfb, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x41,
+        0xde, 0xfd, 0xff, 0x41, 0x46, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x41, 0xde, 0xfd, 0xff, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0xef, 0xfe, 0x01, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x02, 0x42, 0xef, 0xfe, 0x05, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42,
+        0xef, 0xfe, 0x04, 0x42, 0x46, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42, 0xef, 0xfe, 0x05, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x42, 0xef, 0xfe, 0x07, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0x42, 0xef, 0xfe, 0x07, 0x42, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x08, 0x42,
+        0xef, 0xfe, 0x09, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x42, 0xef, 0xfe, 0x0d, 0x42,
+        0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x42, 0xef, 0xfe, 0x0c, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x0d, 0x42, 0xef, 0xfe, 0x0d, 0x42, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x42,
+        0xef, 0xfe, 0x0f, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x42, 0xef, 0xfe, 0x0f, 0x42,
+        0x2e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42, 0xef, 0xfe, 0x11, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x12, 0x42, 0xef, 0xfe, 0x15, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x14, 0x42,
+        0xef, 0xfe, 0x14, 0x42, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xef, 0xfe, 0x15, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42, 0xef, 0xfe, 0x17, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x16, 0x42, 0xef, 0xfe, 0x17, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x18, 0x42,
+        0xef, 0xfe, 0x19, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x42, 0xef, 0xfe, 0x1a, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x42, 0xef, 0xfe, 0x1d, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x1b, 0x42, 0xef, 0xfe, 0x1b, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x42,
+        0xef, 0xfe, 0x1c, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x42, 0xef, 0xfe, 0x1d, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x42, 0xef, 0xfe, 0x1f, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x1e, 0x42, 0xef, 0xfe, 0x1f, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x42,
+        0xef, 0xfe, 0x21, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x42, 0xef, 0xfe, 0x21, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x22, 0x42, 0xef, 0xfe, 0x22, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x22, 0x42, 0xef, 0xfe, 0x25, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x23, 0x42,
+        0xef, 0xfe, 0x23, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0xef, 0xfe, 0x24, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x25, 0x42, 0xef, 0xfe, 0x25, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x26, 0x42, 0xef, 0xfe, 0x27, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42,
+        0xef, 0xfe, 0x27, 0x42, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42, 0xef, 0xfe, 0x29, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xef, 0xfe, 0x29, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x2a, 0x42, 0xef, 0xfe, 0x2a, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x42,
+        0xef, 0xfe, 0x2d, 0x42, 0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x42, 0xef, 0xfe, 0x2b, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x42, 0xef, 0xfe, 0x2c, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2d, 0x42, 0xef, 0xfe, 0x2d, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x42,
+        0xef, 0xfe, 0x2e, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x42, 0xef, 0xfe, 0x2f, 0x42,
+        0x2e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x42, 0xef, 0xfe, 0x2f, 0x42, 0x54, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0x42, 0xef, 0xfe, 0x30, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x42,
+        0xef, 0xfe, 0x31, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x31, 0x42, 0xef, 0xfe, 0x31, 0x42,
+        0x57, 0x50, 0x00, 0x00, 0x00, 0x00, 0x32, 0x42, 0xef, 0xfe, 0x32, 0x42, 0x59, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x32, 0x42, 0xef, 0xfe, 0x35, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x33, 0x42,
+        0xef, 0xfe, 0x33, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0x42, 0xef, 0xfe, 0x34, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x35, 0x42, 0xef, 0xfe, 0x35, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x36, 0x42, 0xef, 0xfe, 0x37, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x36, 0x42,
+        0xef, 0xfe, 0x37, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x38, 0x42, 0xef, 0xfe, 0x39, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x42, 0xef, 0xfe, 0x3a, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x3a, 0x42, 0xef, 0xfe, 0x3d, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x42,
+        0xef, 0xfe, 0x3b, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0xef, 0xfe, 0x3c, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x42, 0xef, 0xfe, 0x3d, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x3e, 0x42, 0xef, 0xfe, 0x3f, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x42,
+        0xef, 0xfe, 0x3f, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0xef, 0xfe, 0x41, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42, 0xef, 0xfe, 0x41, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x42, 0x42, 0xef, 0xfe, 0x42, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42,
+        0xef, 0xfe, 0x45, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x43, 0x42, 0xef, 0xfe, 0x43, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x44, 0x42, 0xef, 0xfe, 0x44, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x45, 0x42, 0xef, 0xfe, 0x45, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x42,
+        0xef, 0xfe, 0x47, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x42, 0xef, 0xfe, 0x47, 0x42,
+        0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x48, 0x42, 0xef, 0xfe, 0x49, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x48, 0x42, 0xef, 0xfe, 0x49, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4a, 0x42,
+        0xef, 0xfe, 0x4a, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x42, 0xef, 0xfe, 0x4d, 0x42,
+        0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4b, 0x42, 0xef, 0xfe, 0x4b, 0x42, 0x54, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x4c, 0x42, 0xef, 0xfe, 0x4c, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x42,
+        0xef, 0xfe, 0x4d, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x42, 0xef, 0xfe, 0x4e, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x42, 0xef, 0xfe, 0x4f, 0x42, 0x2e, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x4f, 0x42, 0xef, 0xfe, 0x4f, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x42,
+        0xef, 0xfe, 0x50, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x42, 0xef, 0xfe, 0x51, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x51, 0x42, 0xef, 0xfe, 0x51, 0x42, 0x57, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x52, 0x42, 0xef, 0xfe, 0x52, 0x42, 0x59, 0x50, 0x00, 0x00, 0x00, 0x00, 0x52, 0x42,
+        0xef, 0xfe, 0x55, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x53, 0x42, 0xef, 0xfe, 0x53, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x42, 0xef, 0xfe, 0x54, 0x42, 0x54, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x55, 0x42, 0xef, 0xfe, 0x55, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x56, 0x42,
+        0xef, 0xfe, 0x57, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x56, 0x42, 0xef, 0xfe, 0x57, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x42, 0xef, 0xfe, 0x59, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x5a, 0x42, 0xef, 0xfe, 0x5f, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42,
+        0xef, 0xfe, 0x64, 0x42, 0x46, 0x50, 0x00, 0x00, 0x00, 0x00, 0x65, 0x42, 0xef, 0xfe, 0x65, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x66, 0x42, 0xef, 0xfe, 0x67, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x66, 0x42, 0xef, 0xfe, 0x67, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x68, 0x42,
+        0xef, 0xfe, 0x68, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42, 0xef, 0xfe, 0x69, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x69, 0x42, 0xef, 0xfe, 0x6b, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x6a, 0x42, 0xef, 0xfe, 0x6b, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x42,
+        0xef, 0xfe, 0x6c, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x42, 0xef, 0xfe, 0x6f, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x42, 0xef, 0xfe, 0x6f, 0x42, 0x33, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x70, 0x42, 0xef, 0xfe, 0x70, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42,
+        0xef, 0xfe, 0x71, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x71, 0x42, 0xef, 0xfe, 0x73, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x72, 0x42, 0xef, 0xfe, 0x75, 0x42, 0x3f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x74, 0x42, 0xef, 0xfe, 0x74, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x75, 0x42,
+        0xef, 0xfe, 0x75, 0x42, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x76, 0x42, 0xef, 0xfe, 0x77, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x76, 0x42, 0xef, 0xfe, 0x77, 0x42, 0x2e, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x78, 0x42, 0xef, 0xfe, 0x79, 0x42, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x42,
+        0xef, 0xfe, 0x79, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x42, 0xef, 0xfe, 0x7b, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x42, 0xef, 0xfe, 0x7b, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x7c, 0x42, 0xef, 0xfe, 0x7d, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x42,
+        0xef, 0xfe, 0x7f, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x42, 0xef, 0xfe, 0x7f, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x42, 0x77, 0xff, 0x80, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x81, 0x42, 0x77, 0xff, 0x82, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x82, 0x42,
+        0x77, 0x7f, 0x82, 0x42, 0x46, 0x50, 0x00, 0x00, 0x00, 0x80, 0x82, 0x42, 0x77, 0xff, 0x82, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x42, 0x77, 0xff, 0x83, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x83, 0x42, 0x77, 0xff, 0x83, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42,
+        0x77, 0x7f, 0x84, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42, 0x77, 0xff, 0x84, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x84, 0x42, 0x77, 0xff, 0x85, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x85, 0x42, 0x77, 0xff, 0x85, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x86, 0x42,
+        0x77, 0x7f, 0x86, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x80, 0x86, 0x42, 0x77, 0xff, 0x87, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x87, 0x42, 0x77, 0xff, 0x87, 0x42, 0x33, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x88, 0x42, 0x77, 0x7f, 0x88, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42,
+        0x77, 0xff, 0x88, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x80, 0x88, 0x42, 0x77, 0xff, 0x89, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x89, 0x42, 0x77, 0xff, 0x8a, 0x42, 0x3f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8a, 0x42, 0x77, 0x7f, 0x8a, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x42,
+        0x77, 0xff, 0x8a, 0x42, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x42, 0x77, 0xff, 0x8b, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x42, 0x77, 0xff, 0x8b, 0x42, 0x2e, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8c, 0x42, 0x77, 0xff, 0x8c, 0x42, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x42,
+        0x77, 0xff, 0x8c, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x42, 0x77, 0xff, 0x8d, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x42, 0x77, 0xff, 0x8d, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8e, 0x42, 0x77, 0xff, 0x8e, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x42,
+        0x77, 0xff, 0x8e, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x42, 0x77, 0xff, 0x8f, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x42, 0x77, 0xff, 0x8f, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x42, 0x77, 0xff, 0x90, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x90, 0x42,
+        0x77, 0xff, 0x90, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x91, 0x42, 0x77, 0x7f, 0x91, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x91, 0x42, 0x77, 0xff, 0x92, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x91, 0x42, 0x77, 0xff, 0x91, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42,
+        0x77, 0x7f, 0x92, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x80, 0x92, 0x42, 0x77, 0xff, 0x92, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x93, 0x42, 0x77, 0xff, 0x93, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x93, 0x42, 0x77, 0xff, 0x93, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x94, 0x42,
+        0x77, 0xff, 0x94, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x95, 0x42, 0x77, 0xff, 0x96, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x96, 0x42, 0x77, 0x7f, 0x96, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x96, 0x42, 0x77, 0xff, 0x96, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x97, 0x42,
+        0x77, 0xff, 0x97, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x97, 0x42, 0x77, 0xff, 0x97, 0x42,
+        0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x98, 0x42, 0x77, 0xff, 0x98, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x99, 0x42, 0x77, 0xff, 0x9a, 0x42, 0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9a, 0x42,
+        0x77, 0x7f, 0x9a, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x80, 0x9a, 0x42, 0x77, 0xff, 0x9a, 0x42,
+        0x57, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x42, 0x77, 0xff, 0x9b, 0x42, 0x59, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9b, 0x42, 0x77, 0xff, 0x9b, 0x42, 0x2e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x42,
+        0x77, 0xff, 0x9c, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x42, 0x77, 0xff, 0x9e, 0x42,
+        0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9e, 0x42, 0x77, 0x7f, 0x9e, 0x42, 0x57, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x9e, 0x42, 0x77, 0xff, 0x9e, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x42,
+        0x77, 0xff, 0x9f, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x42, 0x77, 0xff, 0x9f, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x42, 0x77, 0xff, 0xa0, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa1, 0x42, 0x77, 0x7f, 0xa1, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x42,
+        0x77, 0xff, 0xa2, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa1, 0x42, 0x77, 0xff, 0xa1, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x42, 0x77, 0x7f, 0xa2, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0xa2, 0x42, 0x77, 0xff, 0xa2, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x42,
+        0x77, 0xff, 0xa3, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x42, 0x77, 0xff, 0xa3, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x42, 0x77, 0xff, 0xa4, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa4, 0x42, 0x77, 0xff, 0xa4, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa5, 0x42,
+        0x77, 0x7f, 0xa5, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x42, 0x77, 0xff, 0xa6, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa5, 0x42, 0x77, 0xff, 0xa5, 0x42, 0x54, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa6, 0x42, 0x77, 0x7f, 0xa6, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x80, 0xa6, 0x42,
+        0x77, 0xff, 0xa6, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x42, 0x77, 0xff, 0xa7, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x42, 0x77, 0xff, 0xa7, 0x42, 0x33, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa8, 0x42, 0x77, 0xff, 0xa8, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x42,
+        0x77, 0xff, 0xa8, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x42, 0x77, 0x7f, 0xa9, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x42, 0x77, 0xff, 0xaa, 0x42, 0x3f, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xa9, 0x42, 0x77, 0xff, 0xa9, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x42,
+        0x77, 0x7f, 0xaa, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x42, 0x77, 0xff, 0xaa, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xab, 0x42, 0x77, 0x7f, 0xab, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xab, 0x42, 0x77, 0xff, 0xab, 0x42, 0x2e, 0x50, 0x01, 0x00, 0x00, 0x80, 0xab, 0x42,
+        0x77, 0xff, 0xab, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x42, 0x77, 0x7f, 0xac, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x42, 0x77, 0xff, 0xac, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xac, 0x42, 0x77, 0xff, 0xac, 0x42, 0x57, 0x50, 0x00, 0x00, 0x00, 0x00, 0xad, 0x42,
+        0x77, 0x7f, 0xad, 0x42, 0x59, 0x50, 0x00, 0x00, 0x00, 0x00, 0xad, 0x42, 0x77, 0xff, 0xae, 0x42,
+        0x3a, 0x50, 0x01, 0x00, 0x00, 0x80, 0xad, 0x42, 0x77, 0xff, 0xad, 0x42, 0x56, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xae, 0x42, 0x77, 0x7f, 0xae, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x80, 0xae, 0x42,
+        0x77, 0xff, 0xae, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x42, 0x77, 0xff, 0xaf, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x42, 0x77, 0xff, 0xaf, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb0, 0x42, 0x77, 0xff, 0xb0, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x42,
+        0x77, 0x7f, 0xb1, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x42, 0x77, 0xff, 0xb2, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb1, 0x42, 0x77, 0xff, 0xb1, 0x42, 0x54, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb2, 0x42, 0x77, 0x7f, 0xb2, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x80, 0xb2, 0x42,
+        0x77, 0xff, 0xb2, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x42, 0x77, 0xff, 0xb3, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x42, 0x77, 0xff, 0xb3, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb4, 0x42, 0x77, 0xff, 0xb4, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x42,
+        0x77, 0xff, 0xb4, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb5, 0x42, 0x77, 0x7f, 0xb5, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x42, 0x77, 0xff, 0xb6, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xb5, 0x42, 0x77, 0xff, 0xb5, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x42,
+        0x77, 0x7f, 0xb6, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x80, 0xb6, 0x42, 0x77, 0xff, 0xb6, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x42, 0x77, 0xff, 0xb7, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb7, 0x42, 0x77, 0xff, 0xb7, 0x42, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x42,
+        0x77, 0xff, 0xb8, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x42, 0x77, 0xff, 0xb8, 0x42,
+        0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x42, 0x77, 0x7f, 0xb9, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb9, 0x42, 0x77, 0xff, 0xba, 0x42, 0x3f, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb9, 0x42,
+        0x77, 0xff, 0xb9, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0xba, 0x42, 0x77, 0x7f, 0xba, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x80, 0xba, 0x42, 0x77, 0xff, 0xba, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xbb, 0x42, 0x77, 0x7f, 0xbb, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x42,
+        0x77, 0xff, 0xbb, 0x42, 0x2e, 0x50, 0x01, 0x00, 0x00, 0x80, 0xbb, 0x42, 0x77, 0xff, 0xbb, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x42, 0x77, 0x7f, 0xbc, 0x42, 0x56, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xbc, 0x42, 0x77, 0xff, 0xbc, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x80, 0xbc, 0x42,
+        0x77, 0xff, 0xbc, 0x42, 0x57, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x42, 0x77, 0x7f, 0xbd, 0x42,
+        0x59, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x42, 0x77, 0xff, 0xbe, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xbd, 0x42, 0x77, 0xff, 0xbd, 0x42, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x42,
+        0x77, 0x7f, 0xbe, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x80, 0xbe, 0x42, 0x77, 0xff, 0xbe, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x42, 0x77, 0xff, 0xbf, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xbf, 0x42, 0x77, 0xff, 0xbf, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x42,
+        0x77, 0xff, 0xc0, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc1, 0x42, 0x77, 0xff, 0xc3, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc4, 0x42, 0x77, 0xff, 0xc4, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc4, 0x42, 0x77, 0xff, 0xc4, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x42,
+        0x77, 0xff, 0xc5, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x42, 0x77, 0xff, 0xc5, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x42, 0x77, 0xff, 0xc6, 0x42, 0x52, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc6, 0x42, 0x77, 0xff, 0xc7, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x42,
+        0x77, 0xff, 0xc7, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x42, 0x77, 0xff, 0xc8, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x42, 0x77, 0xff, 0xc8, 0x42, 0x33, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc9, 0x42, 0x77, 0xff, 0xc9, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x42,
+        0x77, 0xff, 0xc9, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xca, 0x42, 0x77, 0xff, 0xca, 0x42,
+        0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xca, 0x42, 0x77, 0xff, 0xcb, 0x42, 0x3f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xcb, 0x42, 0x77, 0xff, 0xcb, 0x42, 0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x42,
+        0x77, 0xff, 0xd0, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x42, 0x77, 0xff, 0xd0, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd1, 0x42, 0x77, 0xff, 0xd1, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd1, 0x42, 0x77, 0xff, 0xd1, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x42,
+        0x77, 0xff, 0xd2, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x42, 0x77, 0xff, 0xd3, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd3, 0x42, 0x77, 0xff, 0xd3, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd4, 0x42, 0x77, 0xff, 0xd4, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x42,
+        0x77, 0xff, 0xd4, 0x42, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd5, 0x42, 0x77, 0xff, 0xd5, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x42, 0x77, 0xff, 0xd5, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd6, 0x42, 0x77, 0xff, 0xd6, 0x42, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x42,
+        0x77, 0xff, 0xd7, 0x42, 0x3f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd7, 0x42, 0x77, 0xff, 0xd7, 0x42,
+        0x4b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x47, 0x91, 0x3e, 0x34, 0x50, 0x01, 0x00,
+        0x89, 0x99, 0x99, 0x3e, 0x94, 0x70, 0x15, 0x3f, 0x3b, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x3f,
+        0x58, 0x3d, 0x62, 0x3f, 0x37, 0x50, 0x01, 0x00, 0x4d, 0x66, 0x66, 0x3f, 0x0e, 0x85, 0x97, 0x3f,
+        0x3b, 0x50, 0x01, 0x00, 0x89, 0x99, 0x99, 0x3f, 0x70, 0xeb, 0xbd, 0x3f, 0x34, 0x50, 0x01, 0x00,
+        0xeb, 0xff, 0xbf, 0x3f, 0xd3, 0x51, 0xe4, 0x3f, 0x3b, 0x50, 0x01, 0x00, 0x4d, 0x66, 0xe6, 0x3f,
+        0x1a, 0x5c, 0x05, 0x40, 0x37, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x40, 0x4b, 0x8f, 0x18, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x40, 0x7d, 0xc2, 0x2b, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0xba, 0xcc, 0x2c, 0x40, 0xae, 0xf5, 0x3e, 0x40, 0x3b, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x3f, 0x40,
+        0xdf, 0x28, 0x52, 0x40, 0x37, 0x50, 0x01, 0x00, 0x1c, 0x33, 0x53, 0x40, 0x10, 0x5c, 0x65, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x4d, 0x66, 0x66, 0x40, 0x41, 0x8f, 0x78, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0x7e, 0x99, 0x79, 0x40, 0x39, 0xe1, 0x85, 0x40, 0x3b, 0x50, 0x01, 0x00, 0x58, 0x66, 0x86, 0x40,
+        0xd2, 0x7a, 0x8f, 0x40, 0x37, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x8f, 0x40, 0x6a, 0x14, 0x99, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x89, 0x99, 0x99, 0x40, 0x03, 0xae, 0xa2, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0x21, 0x33, 0xa3, 0x40, 0x9b, 0x47, 0xac, 0x40, 0x3b, 0x50, 0x01, 0x00, 0xba, 0xcc, 0xac, 0x40,
+        0x34, 0xe1, 0xb5, 0x40, 0x36, 0x50, 0x01, 0x00, 0x52, 0x66, 0xb6, 0x40, 0xcc, 0x7a, 0xbf, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0xeb, 0xff, 0xbf, 0x40, 0x65, 0x14, 0xc9, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0x84, 0x99, 0xc9, 0x40, 0xfd, 0xad, 0xd2, 0x40, 0x3b, 0x50, 0x01, 0x00, 0x1c, 0x33, 0xd3, 0x40,
+        0x96, 0x47, 0xdc, 0x40, 0x36, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xdc, 0x40, 0x2f, 0xe1, 0xe5, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x4d, 0x66, 0xe6, 0x40, 0xc7, 0x7a, 0xef, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0xe6, 0xff, 0xef, 0x40, 0x60, 0x14, 0xf9, 0x40, 0x39, 0x50, 0x01, 0x00, 0x7e, 0x99, 0xf9, 0x40,
+        0xfc, 0x56, 0x01, 0x41, 0x36, 0x50, 0x01, 0x00, 0x8b, 0x99, 0x01, 0x41, 0xc8, 0x23, 0x06, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x41, 0x95, 0xf0, 0x0a, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x24, 0x33, 0x0b, 0x41, 0x61, 0xbd, 0x0f, 0x41, 0x39, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x0f, 0x41,
+        0x2d, 0x8a, 0x14, 0x41, 0x36, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x14, 0x41, 0xf9, 0x56, 0x19, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x41, 0xc6, 0x23, 0x1e, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x55, 0x66, 0x1e, 0x41, 0xe4, 0xa8, 0x20, 0x41, 0x43, 0x50, 0x00, 0x00, 0x55, 0x66, 0x1e, 0x41,
+        0x92, 0xf0, 0x22, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xbb, 0xcc, 0x20, 0x41, 0x4a, 0x0f, 0x23, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0x21, 0x33, 0x23, 0x41, 0x5e, 0xbd, 0x27, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x21, 0x33, 0x23, 0x41, 0x5e, 0xbd, 0x27, 0x41, 0x37, 0x50, 0x01, 0x00, 0xee, 0xff, 0x27, 0x41,
+        0x7d, 0x42, 0x2a, 0x41, 0x47, 0x50, 0x00, 0x00, 0xee, 0xff, 0x27, 0x41, 0x2b, 0x8a, 0x2c, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x54, 0x66, 0x2a, 0x41, 0xe3, 0xa8, 0x2c, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0xba, 0xcc, 0x2c, 0x41, 0x0a, 0x05, 0x3f, 0x41, 0x47, 0x50, 0x00, 0x00, 0xba, 0xcc, 0x2c, 0x41,
+        0xf7, 0x56, 0x31, 0x41, 0x34, 0x50, 0x01, 0x00, 0x86, 0x99, 0x31, 0x41, 0xc3, 0x23, 0x36, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x52, 0x66, 0x36, 0x41, 0x8f, 0xf0, 0x3a, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x1f, 0x33, 0x3b, 0x41, 0x5c, 0xbd, 0x3f, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x3f, 0x41,
+        0x28, 0x8a, 0x44, 0x41, 0x32, 0x50, 0x01, 0x00, 0xb7, 0xcc, 0x44, 0x41, 0x46, 0x0f, 0x47, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0xb7, 0xcc, 0x44, 0x41, 0xf4, 0x56, 0x49, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x1d, 0x33, 0x47, 0x41, 0xad, 0x75, 0x49, 0x41, 0x43, 0x50, 0x00, 0x00, 0x84, 0x99, 0x49, 0x41,
+        0xc1, 0x23, 0x4e, 0x41, 0x42, 0x50, 0x00, 0x00, 0x84, 0x99, 0x49, 0x41, 0xc1, 0x23, 0x4e, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x50, 0x66, 0x4e, 0x41, 0xdf, 0xa8, 0x50, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x50, 0x66, 0x4e, 0x41, 0x8d, 0xf0, 0x52, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xb6, 0xcc, 0x50, 0x41,
+        0x45, 0x0f, 0x53, 0x41, 0x45, 0x50, 0x00, 0x00, 0x1c, 0x33, 0x53, 0x41, 0x6c, 0x6b, 0x65, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x1c, 0x33, 0x53, 0x41, 0x59, 0xbd, 0x57, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0xe8, 0xff, 0x57, 0x41, 0x25, 0x8a, 0x5c, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0x5c, 0x41,
+        0xf2, 0x56, 0x61, 0x41, 0x37, 0x50, 0x01, 0x00, 0x81, 0x99, 0x61, 0x41, 0xbe, 0x23, 0x66, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x4d, 0x66, 0x66, 0x41, 0x8a, 0xf0, 0x6a, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0x6b, 0x41, 0xa9, 0x75, 0x6d, 0x41, 0x42, 0x50, 0x00, 0x00, 0x1a, 0x33, 0x6b, 0x41,
+        0x56, 0xbd, 0x6f, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x80, 0x99, 0x6d, 0x41, 0x0f, 0xdc, 0x6f, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0xe6, 0xff, 0x6f, 0x41, 0x23, 0x8a, 0x74, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0xe6, 0xff, 0x6f, 0x41, 0x23, 0x8a, 0x74, 0x41, 0x36, 0x50, 0x01, 0x00, 0xb2, 0xcc, 0x74, 0x41,
+        0x41, 0x0f, 0x77, 0x41, 0x47, 0x50, 0x00, 0x00, 0xb2, 0xcc, 0x74, 0x41, 0xef, 0x56, 0x79, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x18, 0x33, 0x77, 0x41, 0xa7, 0x75, 0x79, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x7e, 0x99, 0x79, 0x41, 0xe7, 0xe8, 0x85, 0x41, 0x47, 0x50, 0x00, 0x00, 0x7e, 0x99, 0x79, 0x41,
+        0xbb, 0x23, 0x7e, 0x41, 0x32, 0x50, 0x01, 0x00, 0x4b, 0x66, 0x7e, 0x41, 0x44, 0x78, 0x81, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x8b, 0x99, 0x81, 0x41, 0xaa, 0xde, 0x83, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0xf2, 0xff, 0x83, 0x41, 0x10, 0x45, 0x86, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x58, 0x66, 0x86, 0x41,
+        0x76, 0xab, 0x88, 0x41, 0x32, 0x50, 0x01, 0x00, 0xbe, 0xcc, 0x88, 0x41, 0x05, 0xee, 0x89, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0xbe, 0xcc, 0x88, 0x41, 0xdc, 0x11, 0x8b, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0xf1, 0xff, 0x89, 0x41, 0x38, 0x21, 0x8b, 0x41, 0x40, 0x50, 0x00, 0x00, 0x24, 0x33, 0x8b, 0x41,
+        0x4c, 0x4f, 0x94, 0x41, 0x42, 0x50, 0x00, 0x00, 0x24, 0x33, 0x8b, 0x41, 0x42, 0x78, 0x8d, 0x41,
+        0x36, 0x50, 0x01, 0x00, 0x8a, 0x99, 0x8d, 0x41, 0xa9, 0xde, 0x8f, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0xf0, 0xff, 0x8f, 0x41, 0x0f, 0x45, 0x92, 0x41, 0x32, 0x50, 0x01, 0x00, 0x56, 0x66, 0x92, 0x41,
+        0x75, 0xab, 0x94, 0x41, 0x39, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x94, 0x41, 0xdb, 0x11, 0x97, 0x41,
+        0x36, 0x50, 0x01, 0x00, 0x23, 0x33, 0x97, 0x41, 0x41, 0x78, 0x99, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x89, 0x99, 0x99, 0x41, 0xa7, 0xde, 0x9b, 0x41, 0x34, 0x50, 0x01, 0x00, 0xef, 0xff, 0x9b, 0x41,
+        0x37, 0x21, 0x9d, 0x41, 0x43, 0x50, 0x00, 0x00, 0xef, 0xff, 0x9b, 0x41, 0x0d, 0x45, 0x9e, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x22, 0x33, 0x9d, 0x41, 0x6a, 0x54, 0x9e, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0x55, 0x66, 0x9e, 0x41, 0x74, 0xab, 0xa0, 0x41, 0x43, 0x50, 0x00, 0x00, 0x55, 0x66, 0x9e, 0x41,
+        0x74, 0xab, 0xa0, 0x41, 0x37, 0x50, 0x01, 0x00, 0xbb, 0xcc, 0xa0, 0x41, 0x03, 0xee, 0xa1, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0xbb, 0xcc, 0xa0, 0x41, 0xda, 0x11, 0xa3, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0xee, 0xff, 0xa1, 0x41, 0x36, 0x21, 0xa3, 0x41, 0x48, 0x50, 0x00, 0x00, 0x21, 0x33, 0xa3, 0x41,
+        0x49, 0x4f, 0xac, 0x41, 0x47, 0x50, 0x00, 0x00, 0x21, 0x33, 0xa3, 0x41, 0x40, 0x78, 0xa5, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x88, 0x99, 0xa5, 0x41, 0xa6, 0xde, 0xa7, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0xee, 0xff, 0xa7, 0x41, 0x0c, 0x45, 0xaa, 0x41, 0x37, 0x50, 0x01, 0x00, 0x54, 0x66, 0xaa, 0x41,
+        0x72, 0xab, 0xac, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xba, 0xcc, 0xac, 0x41, 0xd8, 0x11, 0xaf, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x20, 0x33, 0xaf, 0x41, 0x68, 0x54, 0xb0, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0x20, 0x33, 0xaf, 0x41, 0x3f, 0x78, 0xb1, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x53, 0x66, 0xb0, 0x41,
+        0x9b, 0x87, 0xb1, 0x41, 0x43, 0x50, 0x00, 0x00, 0x86, 0x99, 0xb1, 0x41, 0xa5, 0xde, 0xb3, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0x86, 0x99, 0xb1, 0x41, 0xa5, 0xde, 0xb3, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0xec, 0xff, 0xb3, 0x41, 0x34, 0x21, 0xb5, 0x41, 0x43, 0x50, 0x00, 0x00, 0xec, 0xff, 0xb3, 0x41,
+        0x0b, 0x45, 0xb6, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x1f, 0x33, 0xb5, 0x41, 0x67, 0x54, 0xb6, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x52, 0x66, 0xb6, 0x41, 0x7a, 0x82, 0xbf, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x52, 0x66, 0xb6, 0x41, 0x71, 0xab, 0xb8, 0x41, 0x32, 0x50, 0x01, 0x00, 0xb9, 0xcc, 0xb8, 0x41,
+        0xd7, 0x11, 0xbb, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x1f, 0x33, 0xbb, 0x41, 0x3d, 0x78, 0xbd, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x85, 0x99, 0xbd, 0x41, 0xa3, 0xde, 0xbf, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0xeb, 0xff, 0xbf, 0x41, 0x0a, 0x45, 0xc2, 0x41, 0x32, 0x50, 0x01, 0x00, 0x51, 0x66, 0xc2, 0x41,
+        0x99, 0x87, 0xc3, 0x41, 0x42, 0x50, 0x00, 0x00, 0x51, 0x66, 0xc2, 0x41, 0x70, 0xab, 0xc4, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x84, 0x99, 0xc3, 0x41, 0xcc, 0xba, 0xc4, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0xb7, 0xcc, 0xc4, 0x41, 0xd6, 0x11, 0xc7, 0x41, 0x42, 0x50, 0x00, 0x00, 0xb7, 0xcc, 0xc4, 0x41,
+        0xd6, 0x11, 0xc7, 0x41, 0x36, 0x50, 0x01, 0x00, 0x1d, 0x33, 0xc7, 0x41, 0x65, 0x54, 0xc8, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x1d, 0x33, 0xc7, 0x41, 0x3c, 0x78, 0xc9, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x51, 0x66, 0xc8, 0x41, 0x98, 0x87, 0xc9, 0x41, 0x48, 0x50, 0x00, 0x00, 0x84, 0x99, 0xc9, 0x41,
+        0xac, 0xb5, 0xd2, 0x41, 0x47, 0x50, 0x00, 0x00, 0x84, 0x99, 0xc9, 0x41, 0xa2, 0xde, 0xcb, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0xea, 0xff, 0xcb, 0x41, 0x08, 0x45, 0xce, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x50, 0x66, 0xce, 0x41, 0x6e, 0xab, 0xd0, 0x41, 0x36, 0x50, 0x01, 0x00, 0xb6, 0xcc, 0xd0, 0x41,
+        0xd4, 0x11, 0xd3, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x1c, 0x33, 0xd3, 0x41, 0x3b, 0x78, 0xd5, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x82, 0x99, 0xd5, 0x41, 0xca, 0xba, 0xd6, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0x82, 0x99, 0xd5, 0x41, 0xa1, 0xde, 0xd7, 0x41, 0x39, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xd6, 0x41,
+        0xfd, 0xed, 0xd7, 0x41, 0x40, 0x50, 0x00, 0x00, 0xe8, 0xff, 0xd7, 0x41, 0x10, 0x1c, 0xe1, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0xe8, 0xff, 0xd7, 0x41, 0x07, 0x45, 0xda, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0x4f, 0x66, 0xda, 0x41, 0x6d, 0xab, 0xdc, 0x41, 0x39, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xdc, 0x41,
+        0xd3, 0x11, 0xdf, 0x41, 0x32, 0x50, 0x01, 0x00, 0x1b, 0x33, 0xdf, 0x41, 0x39, 0x78, 0xe1, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x81, 0x99, 0xe1, 0x41, 0x9f, 0xde, 0xe3, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0xe7, 0xff, 0xe3, 0x41, 0x06, 0x45, 0xe6, 0x41, 0x39, 0x50, 0x01, 0x00, 0x4d, 0x66, 0xe6, 0x41,
+        0xc7, 0x3a, 0xed, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x4d, 0x66, 0xe6, 0x41, 0x6c, 0xab, 0xe8, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0xb3, 0xcc, 0xe8, 0x41, 0xd2, 0x11, 0xeb, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0xeb, 0x41, 0x38, 0x78, 0xed, 0x41, 0x37, 0x50, 0x01, 0x00, 0x80, 0x99, 0xed, 0x41,
+        0xa8, 0xb5, 0xf6, 0x41, 0x47, 0x50, 0x00, 0x00, 0x80, 0x99, 0xed, 0x41, 0x9e, 0xde, 0xef, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0xe6, 0xff, 0xef, 0x41, 0x04, 0x45, 0xf2, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x4c, 0x66, 0xf2, 0x41, 0x6a, 0xab, 0xf4, 0x41, 0x3b, 0x50, 0x01, 0x00, 0xb2, 0xcc, 0xf4, 0x41,
+        0xd1, 0x11, 0xf7, 0x41, 0x37, 0x50, 0x01, 0x00, 0x18, 0x33, 0xf7, 0x41, 0x37, 0x78, 0xf9, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x7e, 0x99, 0xf9, 0x41, 0xfc, 0x36, 0x00, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x7e, 0x99, 0xf9, 0x41, 0x9d, 0xde, 0xfb, 0x41, 0x32, 0x50, 0x01, 0x00, 0xe4, 0xff, 0xfb, 0x41,
+        0x03, 0x45, 0xfe, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x4b, 0x66, 0xfe, 0x41, 0xb5, 0x55, 0x00, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x58, 0x66, 0x00, 0x42, 0x6c, 0xf4, 0x04, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x58, 0x66, 0x00, 0x42, 0xe8, 0x88, 0x01, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x8b, 0x99, 0x01, 0x42,
+        0x1b, 0xbc, 0x02, 0x42, 0x32, 0x50, 0x01, 0x00, 0xbf, 0xcc, 0x02, 0x42, 0x4e, 0xef, 0x03, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xf2, 0xff, 0x03, 0x42, 0x81, 0x22, 0x05, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x25, 0x33, 0x05, 0x42, 0xb4, 0x55, 0x06, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x58, 0x66, 0x06, 0x42,
+        0x95, 0xd0, 0x09, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x58, 0x66, 0x06, 0x42, 0xe7, 0x88, 0x07, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x8b, 0x99, 0x07, 0x42, 0x1a, 0xbc, 0x08, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xbe, 0xcc, 0x08, 0x42, 0x4d, 0xef, 0x09, 0x42, 0x36, 0x50, 0x01, 0x00, 0xf1, 0xff, 0x09, 0x42,
+        0x05, 0x8e, 0x0e, 0x42, 0x47, 0x50, 0x00, 0x00, 0xf1, 0xff, 0x09, 0x42, 0x80, 0x22, 0x0b, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x24, 0x33, 0x0b, 0x42, 0xb3, 0x55, 0x0c, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x57, 0x66, 0x0c, 0x42, 0xe6, 0x88, 0x0d, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x8a, 0x99, 0x0d, 0x42,
+        0x19, 0xbc, 0x0e, 0x42, 0x36, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x0e, 0x42, 0x4c, 0xef, 0x0f, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x0f, 0x42, 0x2d, 0x6a, 0x13, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xf0, 0xff, 0x0f, 0x42, 0x80, 0x22, 0x11, 0x42, 0x32, 0x50, 0x01, 0x00, 0x23, 0x33, 0x11, 0x42,
+        0xb3, 0x55, 0x12, 0x42, 0x39, 0x50, 0x01, 0x00, 0x56, 0x66, 0x12, 0x42, 0xe6, 0x88, 0x13, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x89, 0x99, 0x13, 0x42, 0x9d, 0x27, 0x18, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x89, 0x99, 0x13, 0x42, 0x19, 0xbc, 0x14, 0x42, 0x39, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x14, 0x42,
+        0x4c, 0xef, 0x15, 0x42, 0x32, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x15, 0x42, 0x7f, 0x22, 0x17, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x23, 0x33, 0x17, 0x42, 0xb2, 0x55, 0x18, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x56, 0x66, 0x18, 0x42, 0xe5, 0x88, 0x19, 0x42, 0x39, 0x50, 0x01, 0x00, 0x89, 0x99, 0x19, 0x42,
+        0xc6, 0x03, 0x1d, 0x42, 0x47, 0x50, 0x00, 0x00, 0x89, 0x99, 0x19, 0x42, 0xc6, 0x03, 0x1d, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x89, 0x99, 0x19, 0x42, 0x18, 0xbc, 0x1a, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0xbc, 0xcc, 0x1a, 0x42, 0x4b, 0xef, 0x1b, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xef, 0xff, 0x1b, 0x42,
+        0x7e, 0x22, 0x1d, 0x42, 0x37, 0x50, 0x01, 0x00, 0x22, 0x33, 0x1d, 0x42, 0x36, 0xc1, 0x21, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x22, 0x33, 0x1d, 0x42, 0x36, 0xc1, 0x21, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x22, 0x33, 0x1d, 0x42, 0xb1, 0x55, 0x1e, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x55, 0x66, 0x1e, 0x42,
+        0xe4, 0x88, 0x1f, 0x42, 0x34, 0x50, 0x01, 0x00, 0x88, 0x99, 0x1f, 0x42, 0x17, 0xbc, 0x20, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xbb, 0xcc, 0x20, 0x42, 0x4a, 0xef, 0x21, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0xee, 0xff, 0x21, 0x42, 0x7e, 0x22, 0x23, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x21, 0x33, 0x23, 0x42,
+        0x5e, 0x9d, 0x26, 0x42, 0x47, 0x50, 0x00, 0x00, 0x21, 0x33, 0x23, 0x42, 0x5e, 0x9d, 0x26, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x21, 0x33, 0x23, 0x42, 0xb1, 0x55, 0x24, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x54, 0x66, 0x24, 0x42, 0xe4, 0x88, 0x25, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x88, 0x99, 0x25, 0x42,
+        0x17, 0xbc, 0x26, 0x42, 0x37, 0x50, 0x01, 0x00, 0xbb, 0xcc, 0x26, 0x42, 0xcf, 0x5a, 0x2b, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xbb, 0xcc, 0x26, 0x42, 0xcf, 0x5a, 0x2b, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xbb, 0xcc, 0x26, 0x42, 0x4a, 0xef, 0x27, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xee, 0xff, 0x27, 0x42,
+        0x7d, 0x22, 0x29, 0x42, 0x32, 0x50, 0x01, 0x00, 0x21, 0x33, 0x29, 0x42, 0xb0, 0x55, 0x2a, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x54, 0x66, 0x2a, 0x42, 0xe3, 0x88, 0x2b, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x87, 0x99, 0x2b, 0x42, 0x16, 0xbc, 0x2c, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xba, 0xcc, 0x2c, 0x42,
+        0xf7, 0x36, 0x30, 0x42, 0x47, 0x50, 0x00, 0x00, 0xba, 0xcc, 0x2c, 0x42, 0xf7, 0x36, 0x30, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0xba, 0xcc, 0x2c, 0x42, 0x49, 0xef, 0x2d, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xed, 0xff, 0x2d, 0x42, 0x7c, 0x22, 0x2f, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x20, 0x33, 0x2f, 0x42,
+        0xaf, 0x55, 0x30, 0x42, 0x36, 0x50, 0x01, 0x00, 0x53, 0x66, 0x30, 0x42, 0x67, 0xf4, 0x34, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x53, 0x66, 0x30, 0x42, 0x67, 0xf4, 0x34, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x53, 0x66, 0x30, 0x42, 0xe2, 0x88, 0x31, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x86, 0x99, 0x31, 0x42,
+        0x15, 0xbc, 0x32, 0x42, 0x32, 0x50, 0x01, 0x00, 0xb9, 0xcc, 0x32, 0x42, 0x49, 0xef, 0x33, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xec, 0xff, 0x33, 0x42, 0x7c, 0x22, 0x35, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x1f, 0x33, 0x35, 0x42, 0xaf, 0x55, 0x36, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x52, 0x66, 0x36, 0x42,
+        0x90, 0xd0, 0x39, 0x42, 0x45, 0x50, 0x00, 0x00, 0x52, 0x66, 0x36, 0x42, 0x90, 0xd0, 0x39, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x52, 0x66, 0x36, 0x42, 0xe2, 0x88, 0x37, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x86, 0x99, 0x37, 0x42, 0x15, 0xbc, 0x38, 0x42, 0x39, 0x50, 0x01, 0x00, 0xb9, 0xcc, 0x38, 0x42,
+        0x48, 0xef, 0x39, 0x42, 0x36, 0x50, 0x01, 0x00, 0xec, 0xff, 0x39, 0x42, 0x00, 0x8e, 0x3e, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0xec, 0xff, 0x39, 0x42, 0x00, 0x8e, 0x3e, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xec, 0xff, 0x39, 0x42, 0x7b, 0x22, 0x3b, 0x42, 0x39, 0x50, 0x01, 0x00, 0x1f, 0x33, 0x3b, 0x42,
+        0xae, 0x55, 0x3c, 0x42, 0x32, 0x50, 0x01, 0x00, 0x52, 0x66, 0x3c, 0x42, 0xe1, 0x88, 0x3d, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x85, 0x99, 0x3d, 0x42, 0x14, 0xbc, 0x3e, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0xb8, 0xcc, 0x3e, 0x42, 0x47, 0xef, 0x3f, 0x42, 0x39, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x3f, 0x42,
+        0x66, 0xb4, 0x41, 0x42, 0x47, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x3f, 0x42, 0x7a, 0x22, 0x41, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x1e, 0x33, 0x41, 0x42, 0xad, 0x55, 0x42, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xb8, 0xcc, 0x41, 0x42, 0x32, 0x81, 0x43, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x51, 0x66, 0x42, 0x42,
+        0xe0, 0x88, 0x43, 0x42, 0x37, 0x50, 0x01, 0x00, 0x84, 0x99, 0x43, 0x42, 0xff, 0x4d, 0x45, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x84, 0x99, 0x43, 0x42, 0x13, 0xbc, 0x44, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xb7, 0xcc, 0x44, 0x42, 0x47, 0xef, 0x45, 0x42, 0x34, 0x50, 0x01, 0x00, 0x51, 0x66, 0x45, 0x42,
+        0xcc, 0x1a, 0x47, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xea, 0xff, 0x45, 0x42, 0x7a, 0x22, 0x47, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x1d, 0x33, 0x47, 0x42, 0x84, 0x79, 0x49, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x1d, 0x33, 0x47, 0x42, 0xad, 0x55, 0x48, 0x42, 0x37, 0x50, 0x01, 0x00, 0x51, 0x66, 0x48, 0x42,
+        0xe0, 0x88, 0x49, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x84, 0x99, 0x49, 0x42, 0xfe, 0x4d, 0x4b, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x84, 0x99, 0x49, 0x42, 0x13, 0xbc, 0x4a, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xb7, 0xcc, 0x4a, 0x42, 0x46, 0xef, 0x4b, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x50, 0x66, 0x4b, 0x42,
+        0xcb, 0x1a, 0x4d, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xea, 0xff, 0x4b, 0x42, 0x79, 0x22, 0x4d, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x1d, 0x33, 0x4d, 0x42, 0x97, 0xe7, 0x4e, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x1d, 0x33, 0x4d, 0x42, 0xac, 0x55, 0x4e, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x50, 0x66, 0x4e, 0x42,
+        0xdf, 0x88, 0x4f, 0x42, 0x32, 0x50, 0x01, 0x00, 0xe9, 0xff, 0x4e, 0x42, 0x64, 0xb4, 0x50, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x83, 0x99, 0x4f, 0x42, 0x12, 0xbc, 0x50, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xb6, 0xcc, 0x50, 0x42, 0x1c, 0x13, 0x53, 0x42, 0x47, 0x50, 0x00, 0x00, 0xb6, 0xcc, 0x50, 0x42,
+        0x45, 0xef, 0x51, 0x42, 0x37, 0x50, 0x01, 0x00, 0xe9, 0xff, 0x51, 0x42, 0x78, 0x22, 0x53, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x1c, 0x33, 0x53, 0x42, 0x97, 0xe7, 0x54, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x1c, 0x33, 0x53, 0x42, 0xab, 0x55, 0x54, 0x42, 0x32, 0x50, 0x01, 0x00, 0x4f, 0x66, 0x54, 0x42,
+        0xde, 0x88, 0x55, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xe9, 0xff, 0x54, 0x42, 0x63, 0xb4, 0x56, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x82, 0x99, 0x55, 0x42, 0x12, 0xbc, 0x56, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0xb5, 0xcc, 0x56, 0x42, 0x30, 0x81, 0x58, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0x56, 0x42,
+        0x45, 0xef, 0x57, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xe8, 0xff, 0x57, 0x42, 0x78, 0x22, 0x59, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x82, 0x99, 0x58, 0x42, 0xfd, 0x4d, 0x5a, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x1b, 0x33, 0x59, 0x42, 0xab, 0x55, 0x5a, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x4f, 0x66, 0x5a, 0x42,
+        0xb5, 0xac, 0x5c, 0x42, 0x42, 0x50, 0x00, 0x00, 0x4f, 0x66, 0x5a, 0x42, 0xde, 0x88, 0x5b, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x82, 0x99, 0x5b, 0x42, 0x11, 0xbc, 0x5c, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xb5, 0xcc, 0x5c, 0x42, 0x2f, 0x81, 0x5e, 0x42, 0x45, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0x5c, 0x42,
+        0x44, 0xef, 0x5d, 0x42, 0x32, 0x50, 0x01, 0x00, 0xe8, 0xff, 0x5d, 0x42, 0x77, 0x22, 0x5f, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x81, 0x99, 0x5e, 0x42, 0xfc, 0x4d, 0x60, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x1b, 0x33, 0x5f, 0x42, 0xaa, 0x55, 0x60, 0x42, 0x36, 0x50, 0x01, 0x00, 0x4e, 0x66, 0x60, 0x42,
+        0xc9, 0x1a, 0x62, 0x42, 0x51, 0x50, 0x00, 0x00, 0x4e, 0x66, 0x60, 0x42, 0xdd, 0x88, 0x61, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x81, 0x99, 0x61, 0x42, 0x10, 0xbc, 0x62, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0x62, 0x42, 0x95, 0xe7, 0x63, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xb4, 0xcc, 0x62, 0x42,
+        0x43, 0xef, 0x63, 0x42, 0x39, 0x50, 0x01, 0x00, 0xe7, 0xff, 0x63, 0x42, 0x4d, 0x46, 0x66, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xe7, 0xff, 0x63, 0x42, 0x76, 0x22, 0x65, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0x65, 0x42, 0xa9, 0x55, 0x66, 0x42, 0x39, 0x50, 0x01, 0x00, 0x4d, 0x66, 0x66, 0x42,
+        0xc8, 0x1a, 0x68, 0x42, 0x47, 0x50, 0x00, 0x00, 0x4d, 0x66, 0x66, 0x42, 0xdc, 0x88, 0x67, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x80, 0x99, 0x67, 0x42, 0x10, 0xbc, 0x68, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0x68, 0x42, 0x95, 0xe7, 0x69, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xb3, 0xcc, 0x68, 0x42,
+        0x43, 0xef, 0x69, 0x42, 0x37, 0x50, 0x01, 0x00, 0xe6, 0xff, 0x69, 0x42, 0x61, 0xb4, 0x6b, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0xe6, 0xff, 0x69, 0x42, 0x76, 0x22, 0x6b, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0x6b, 0x42, 0xa9, 0x55, 0x6c, 0x42, 0x34, 0x50, 0x01, 0x00, 0xb3, 0xcc, 0x6b, 0x42,
+        0x2e, 0x81, 0x6d, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x4d, 0x66, 0x6c, 0x42, 0xdc, 0x88, 0x6d, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x80, 0x99, 0x6d, 0x42, 0xe6, 0xdf, 0x6f, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x80, 0x99, 0x6d, 0x42, 0x0f, 0xbc, 0x6e, 0x42, 0x37, 0x50, 0x01, 0x00, 0xb3, 0xcc, 0x6e, 0x42,
+        0x42, 0xef, 0x6f, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xe6, 0xff, 0x6f, 0x42, 0x60, 0xb4, 0x71, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xe6, 0xff, 0x6f, 0x42, 0x75, 0x22, 0x71, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x19, 0x33, 0x71, 0x42, 0xa8, 0x55, 0x72, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb2, 0xcc, 0x71, 0x42,
+        0x2d, 0x81, 0x73, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x4c, 0x66, 0x72, 0x42, 0xdb, 0x88, 0x73, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x7f, 0x99, 0x73, 0x42, 0xfa, 0x4d, 0x75, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x7f, 0x99, 0x73, 0x42, 0x0e, 0xbc, 0x74, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb2, 0xcc, 0x74, 0x42,
+        0x41, 0xef, 0x75, 0x42, 0x32, 0x50, 0x01, 0x00, 0x4c, 0x66, 0x75, 0x42, 0xc6, 0x1a, 0x77, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xe5, 0xff, 0x75, 0x42, 0x74, 0x22, 0x77, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x18, 0x33, 0x77, 0x42, 0x7e, 0x79, 0x79, 0x42, 0x47, 0x50, 0x00, 0x00, 0x18, 0x33, 0x77, 0x42,
+        0xa7, 0x55, 0x78, 0x42, 0x37, 0x50, 0x01, 0x00, 0x4b, 0x66, 0x78, 0x42, 0xdb, 0x88, 0x79, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x7e, 0x99, 0x79, 0x42, 0xf9, 0x4d, 0x7b, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x7e, 0x99, 0x79, 0x42, 0x0e, 0xbc, 0x7a, 0x42, 0x32, 0x50, 0x01, 0x00, 0xb1, 0xcc, 0x7a, 0x42,
+        0x41, 0xef, 0x7b, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x4b, 0x66, 0x7b, 0x42, 0xc6, 0x1a, 0x7d, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xe4, 0xff, 0x7b, 0x42, 0x74, 0x22, 0x7d, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x18, 0x33, 0x7d, 0x42, 0x92, 0xe7, 0x7e, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x18, 0x33, 0x7d, 0x42,
+        0xa7, 0x55, 0x7e, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x4b, 0x66, 0x7e, 0x42, 0xda, 0x88, 0x7f, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xe4, 0xff, 0x7e, 0x42, 0x2f, 0x5a, 0x80, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x7e, 0x99, 0x7f, 0x42, 0x06, 0x5e, 0x80, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x58, 0x66, 0x80, 0x42,
+        0x8b, 0x89, 0x81, 0x42, 0x42, 0x50, 0x00, 0x00, 0x58, 0x66, 0x80, 0x42, 0xa0, 0xf7, 0x80, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0xf2, 0xff, 0x80, 0x42, 0x3a, 0x91, 0x81, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x8b, 0x99, 0x81, 0x42, 0xc9, 0x73, 0x82, 0x42, 0x45, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x81, 0x42,
+        0xd3, 0x2a, 0x82, 0x42, 0x32, 0x50, 0x01, 0x00, 0x25, 0x33, 0x82, 0x42, 0x6d, 0xc4, 0x82, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xf2, 0x7f, 0x82, 0x42, 0x2f, 0x5a, 0x83, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xbf, 0xcc, 0x82, 0x42, 0x06, 0x5e, 0x83, 0x42, 0x36, 0x50, 0x01, 0x00, 0x58, 0x66, 0x83, 0x42,
+        0x95, 0x40, 0x84, 0x42, 0x51, 0x50, 0x00, 0x00, 0x58, 0x66, 0x83, 0x42, 0xa0, 0xf7, 0x83, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xf2, 0xff, 0x83, 0x42, 0x39, 0x91, 0x84, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xbe, 0x4c, 0x84, 0x42, 0xfc, 0x26, 0x85, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x84, 0x42,
+        0xd3, 0x2a, 0x85, 0x42, 0x39, 0x50, 0x01, 0x00, 0x25, 0x33, 0x85, 0x42, 0x58, 0x56, 0x86, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x25, 0x33, 0x85, 0x42, 0x6c, 0xc4, 0x85, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0xbe, 0xcc, 0x85, 0x42, 0x06, 0x5e, 0x86, 0x42, 0x39, 0x50, 0x01, 0x00, 0x58, 0x66, 0x86, 0x42,
+        0x9f, 0xf7, 0x86, 0x42, 0x34, 0x50, 0x01, 0x00, 0xf1, 0xff, 0x86, 0x42, 0x43, 0x48, 0x87, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0xf1, 0xff, 0x86, 0x42, 0x39, 0x91, 0x87, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xbe, 0x4c, 0x87, 0x42, 0x10, 0x95, 0x87, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x87, 0x42,
+        0xd2, 0x2a, 0x88, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x8b, 0x99, 0x87, 0x42, 0xd2, 0x2a, 0x88, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x24, 0x33, 0x88, 0x42, 0x76, 0x7b, 0x88, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x24, 0x33, 0x88, 0x42, 0x6c, 0xc4, 0x88, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xf1, 0x7f, 0x88, 0x42,
+        0x43, 0xc8, 0x88, 0x42, 0x54, 0x50, 0x00, 0x00, 0xbe, 0xcc, 0x88, 0x42, 0xc8, 0x13, 0x8b, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0xbe, 0xcc, 0x88, 0x42, 0x05, 0x5e, 0x89, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x57, 0x66, 0x89, 0x42, 0x9f, 0xf7, 0x89, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xf1, 0xff, 0x89, 0x42,
+        0x39, 0x91, 0x8a, 0x42, 0x37, 0x50, 0x01, 0x00, 0x8a, 0x99, 0x8a, 0x42, 0xd2, 0x2a, 0x8b, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x24, 0x33, 0x8b, 0x42, 0x6c, 0xc4, 0x8b, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xbe, 0xcc, 0x8b, 0x42, 0x0f, 0x15, 0x8c, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xbe, 0xcc, 0x8b, 0x42,
+        0x05, 0x5e, 0x8c, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x8a, 0x19, 0x8c, 0x42, 0xdc, 0x61, 0x8c, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x57, 0x66, 0x8c, 0x42, 0x9f, 0xf7, 0x8c, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x57, 0x66, 0x8c, 0x42, 0x9f, 0xf7, 0x8c, 0x42, 0x37, 0x50, 0x01, 0x00, 0xf1, 0xff, 0x8c, 0x42,
+        0x42, 0x48, 0x8d, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xf1, 0xff, 0x8c, 0x42, 0x38, 0x91, 0x8d, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xbd, 0x4c, 0x8d, 0x42, 0x0f, 0x95, 0x8d, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x8a, 0x99, 0x8d, 0x42, 0x94, 0xe0, 0x8f, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x8a, 0x99, 0x8d, 0x42,
+        0xd2, 0x2a, 0x8e, 0x42, 0x32, 0x50, 0x01, 0x00, 0x24, 0x33, 0x8e, 0x42, 0x6b, 0xc4, 0x8e, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x8e, 0x42, 0x05, 0x5e, 0x8f, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x57, 0x66, 0x8f, 0x42, 0x9e, 0xf7, 0x8f, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xf0, 0xff, 0x8f, 0x42,
+        0x38, 0x91, 0x90, 0x42, 0x32, 0x50, 0x01, 0x00, 0x8a, 0x99, 0x90, 0x42, 0xdc, 0xe1, 0x90, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x8a, 0x99, 0x90, 0x42, 0xd1, 0x2a, 0x91, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x57, 0xe6, 0x90, 0x42, 0xa8, 0x2e, 0x91, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x23, 0x33, 0x91, 0x42,
+        0x6b, 0xc4, 0x91, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x23, 0x33, 0x91, 0x42, 0x6b, 0xc4, 0x91, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x91, 0x42, 0x0f, 0x15, 0x92, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xbd, 0xcc, 0x91, 0x42, 0x04, 0x5e, 0x92, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x8a, 0x19, 0x92, 0x42,
+        0xdc, 0x61, 0x92, 0x42, 0x54, 0x50, 0x00, 0x00, 0x56, 0x66, 0x92, 0x42, 0x60, 0xad, 0x94, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x56, 0x66, 0x92, 0x42, 0x9e, 0xf7, 0x92, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xf0, 0xff, 0x92, 0x42, 0x38, 0x91, 0x93, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x89, 0x99, 0x93, 0x42,
+        0xd1, 0x2a, 0x94, 0x42, 0x36, 0x50, 0x01, 0x00, 0x23, 0x33, 0x94, 0x42, 0x6b, 0xc4, 0x94, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xbd, 0xcc, 0x94, 0x42, 0x04, 0x5e, 0x95, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x56, 0x66, 0x95, 0x42, 0xa8, 0xae, 0x95, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x56, 0x66, 0x95, 0x42,
+        0x9e, 0xf7, 0x95, 0x42, 0x39, 0x50, 0x01, 0x00, 0x23, 0xb3, 0x95, 0x42, 0x75, 0xfb, 0x95, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xf0, 0xff, 0x95, 0x42, 0xfa, 0x46, 0x98, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xf0, 0xff, 0x95, 0x42, 0x37, 0x91, 0x96, 0x42, 0x36, 0x50, 0x01, 0x00, 0x89, 0x99, 0x96, 0x42,
+        0xd1, 0x2a, 0x97, 0x42, 0x39, 0x50, 0x01, 0x00, 0x23, 0x33, 0x97, 0x42, 0x6a, 0xc4, 0x97, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xbc, 0xcc, 0x97, 0x42, 0x04, 0x5e, 0x98, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x56, 0x66, 0x98, 0x42, 0x9d, 0xf7, 0x98, 0x42, 0x36, 0x50, 0x01, 0x00, 0xef, 0xff, 0x98, 0x42,
+        0x37, 0x91, 0x99, 0x42, 0x39, 0x50, 0x01, 0x00, 0x89, 0x99, 0x99, 0x42, 0xd0, 0x2a, 0x9a, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x22, 0x33, 0x9a, 0x42, 0x74, 0x7b, 0x9a, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x22, 0x33, 0x9a, 0x42, 0x6a, 0xc4, 0x9a, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xef, 0x7f, 0x9a, 0x42,
+        0x41, 0xc8, 0x9a, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xbc, 0xcc, 0x9a, 0x42, 0x04, 0x5e, 0x9b, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0xbc, 0xcc, 0x9a, 0x42, 0x04, 0x5e, 0x9b, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x55, 0x66, 0x9b, 0x42, 0xa7, 0xae, 0x9b, 0x42, 0x53, 0x50, 0x00, 0x00, 0x55, 0x66, 0x9b, 0x42,
+        0x9d, 0xf7, 0x9b, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x22, 0xb3, 0x9b, 0x42, 0x74, 0xfb, 0x9b, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0xef, 0xff, 0x9b, 0x42, 0xf9, 0x46, 0x9e, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xef, 0xff, 0x9b, 0x42, 0x37, 0x91, 0x9c, 0x42, 0x34, 0x50, 0x01, 0x00, 0x88, 0x99, 0x9c, 0x42,
+        0xd0, 0x2a, 0x9d, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x22, 0x33, 0x9d, 0x42, 0x6a, 0xc4, 0x9d, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0xbc, 0xcc, 0x9d, 0x42, 0x03, 0x5e, 0x9e, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x55, 0x66, 0x9e, 0x42, 0x9d, 0xf7, 0x9e, 0x42, 0x32, 0x50, 0x01, 0x00, 0xef, 0xff, 0x9e, 0x42,
+        0x41, 0x48, 0x9f, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xef, 0xff, 0x9e, 0x42, 0x36, 0x91, 0x9f, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xbb, 0x4c, 0x9f, 0x42, 0x0d, 0x95, 0x9f, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x88, 0x99, 0x9f, 0x42, 0xd0, 0x2a, 0xa0, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x88, 0x99, 0x9f, 0x42,
+        0xd0, 0x2a, 0xa0, 0x42, 0x37, 0x50, 0x01, 0x00, 0x22, 0x33, 0xa0, 0x42, 0x74, 0x7b, 0xa0, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x22, 0x33, 0xa0, 0x42, 0x69, 0xc4, 0xa0, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xee, 0x7f, 0xa0, 0x42, 0x40, 0xc8, 0xa0, 0x42, 0x51, 0x50, 0x00, 0x00, 0xbb, 0xcc, 0xa0, 0x42,
+        0xc5, 0x13, 0xa3, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xbb, 0xcc, 0xa0, 0x42, 0x03, 0x5e, 0xa1, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x55, 0x66, 0xa1, 0x42, 0x9c, 0xf7, 0xa1, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xee, 0xff, 0xa1, 0x42, 0x36, 0x91, 0xa2, 0x42, 0x37, 0x50, 0x01, 0x00, 0x88, 0x99, 0xa2, 0x42,
+        0xcf, 0x2a, 0xa3, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x21, 0x33, 0xa3, 0x42, 0x69, 0xc4, 0xa3, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xbb, 0xcc, 0xa3, 0x42, 0x0d, 0x15, 0xa4, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0xbb, 0xcc, 0xa3, 0x42, 0x03, 0x5e, 0xa4, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x88, 0x19, 0xa4, 0x42,
+        0xda, 0x61, 0xa4, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x54, 0x66, 0xa4, 0x42, 0x9c, 0xf7, 0xa4, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x54, 0x66, 0xa4, 0x42, 0x9c, 0xf7, 0xa4, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0xee, 0xff, 0xa4, 0x42, 0x40, 0x48, 0xa5, 0x42, 0x53, 0x50, 0x00, 0x00, 0xee, 0xff, 0xa4, 0x42,
+        0x36, 0x91, 0xa5, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xbb, 0x4c, 0xa5, 0x42, 0x0d, 0x95, 0xa5, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x88, 0x99, 0xa5, 0x42, 0x92, 0xe0, 0xa7, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x88, 0x99, 0xa5, 0x42, 0xcf, 0x2a, 0xa6, 0x42, 0x32, 0x50, 0x01, 0x00, 0x21, 0x33, 0xa6, 0x42,
+        0x69, 0xc4, 0xa6, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xbb, 0xcc, 0xa6, 0x42, 0x02, 0x5e, 0xa7, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x54, 0x66, 0xa7, 0x42, 0x9c, 0xf7, 0xa7, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xee, 0xff, 0xa7, 0x42, 0x35, 0x91, 0xa8, 0x42, 0x32, 0x50, 0x01, 0x00, 0x87, 0x99, 0xa8, 0x42,
+        0xd9, 0xe1, 0xa8, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x87, 0x99, 0xa8, 0x42, 0xcf, 0x2a, 0xa9, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x54, 0xe6, 0xa8, 0x42, 0xa6, 0x2e, 0xa9, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x21, 0x33, 0xa9, 0x42, 0x2b, 0x7a, 0xab, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x21, 0x33, 0xa9, 0x42,
+        0x68, 0xc4, 0xa9, 0x42, 0x36, 0x50, 0x01, 0x00, 0xba, 0xcc, 0xa9, 0x42, 0x02, 0x5e, 0xaa, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x54, 0x66, 0xaa, 0x42, 0x9b, 0xf7, 0xaa, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xed, 0xff, 0xaa, 0x42, 0x35, 0x91, 0xab, 0x42, 0x39, 0x50, 0x01, 0x00, 0x87, 0x99, 0xab, 0x42,
+        0xce, 0x2a, 0xac, 0x42, 0x36, 0x50, 0x01, 0x00, 0x20, 0x33, 0xac, 0x42, 0x68, 0xc4, 0xac, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xba, 0xcc, 0xac, 0x42, 0xd8, 0x81, 0xae, 0x42, 0x58, 0x50, 0x00, 0x00,
+        0xba, 0xcc, 0xac, 0x42, 0x02, 0x5e, 0xad, 0x42, 0x34, 0x50, 0x01, 0x00, 0x53, 0x66, 0xad, 0x42,
+        0x9b, 0xf7, 0xad, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xed, 0xff, 0xad, 0x42, 0x35, 0x91, 0xae, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x87, 0x99, 0xae, 0x42, 0x91, 0xe0, 0xb0, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x87, 0x99, 0xae, 0x42, 0xce, 0x2a, 0xaf, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x20, 0x33, 0xaf, 0x42,
+        0x68, 0xc4, 0xaf, 0x42, 0x34, 0x50, 0x01, 0x00, 0xba, 0xcc, 0xaf, 0x42, 0x01, 0x5e, 0xb0, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x53, 0x66, 0xb0, 0x42, 0x9b, 0xf7, 0xb0, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0xed, 0xff, 0xb0, 0x42, 0x34, 0x91, 0xb1, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x86, 0x99, 0xb1, 0x42,
+        0xa5, 0x4e, 0xb3, 0x42, 0x56, 0x50, 0x00, 0x00, 0x86, 0x99, 0xb1, 0x42, 0xce, 0x2a, 0xb2, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x20, 0x33, 0xb2, 0x42, 0x67, 0xc4, 0xb2, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xb9, 0xcc, 0xb2, 0x42, 0x01, 0x5e, 0xb3, 0x42, 0x37, 0x50, 0x01, 0x00, 0x53, 0x66, 0xb3, 0x42,
+        0x5d, 0xad, 0xb5, 0x42, 0x53, 0x50, 0x00, 0x00, 0x53, 0x66, 0xb3, 0x42, 0x9a, 0xf7, 0xb3, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xec, 0xff, 0xb3, 0x42, 0x34, 0x91, 0xb4, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x86, 0x99, 0xb4, 0x42, 0xcd, 0x2a, 0xb5, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x1f, 0x33, 0xb5, 0x42,
+        0x67, 0xc4, 0xb5, 0x42, 0x37, 0x50, 0x01, 0x00, 0xb9, 0xcc, 0xb5, 0x42, 0x01, 0x5e, 0xb6, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x52, 0x66, 0xb6, 0x42, 0x71, 0x1b, 0xb8, 0x42, 0x5a, 0x50, 0x00, 0x00,
+        0x52, 0x66, 0xb6, 0x42, 0x9a, 0xf7, 0xb6, 0x42, 0x32, 0x50, 0x01, 0x00, 0xec, 0xff, 0xb6, 0x42,
+        0x34, 0x91, 0xb7, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x86, 0x99, 0xb7, 0x42, 0xcd, 0x2a, 0xb8, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x1f, 0x33, 0xb8, 0x42, 0x29, 0x7a, 0xba, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x1f, 0x33, 0xb8, 0x42, 0x67, 0xc4, 0xb8, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb9, 0xcc, 0xb8, 0x42,
+        0x00, 0x5e, 0xb9, 0x42, 0x32, 0x50, 0x01, 0x00, 0x52, 0x66, 0xb9, 0x42, 0x9a, 0xf7, 0xb9, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xec, 0xff, 0xb9, 0x42, 0x33, 0x91, 0xba, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x85, 0x99, 0xba, 0x42, 0xcd, 0x2a, 0xbb, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x1f, 0x33, 0xbb, 0x42,
+        0x3d, 0xe8, 0xbc, 0x42, 0x5a, 0x50, 0x00, 0x00, 0x1f, 0x33, 0xbb, 0x42, 0x66, 0xc4, 0xbb, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xb8, 0xcc, 0xbb, 0x42, 0x00, 0x5e, 0xbc, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x52, 0x66, 0xbc, 0x42, 0x99, 0xf7, 0xbc, 0x42, 0x36, 0x50, 0x01, 0x00, 0xeb, 0xff, 0xbc, 0x42,
+        0xf5, 0x46, 0xbf, 0x42, 0x51, 0x50, 0x00, 0x00, 0xeb, 0xff, 0xbc, 0x42, 0x33, 0x91, 0xbd, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x85, 0x99, 0xbd, 0x42, 0xcd, 0x2a, 0xbe, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x1e, 0x33, 0xbe, 0x42, 0x66, 0xc4, 0xbe, 0x42, 0x39, 0x50, 0x01, 0x00, 0xb8, 0xcc, 0xbe, 0x42,
+        0x00, 0x5e, 0xbf, 0x42, 0x36, 0x50, 0x01, 0x00, 0x51, 0x66, 0xbf, 0x42, 0x99, 0xf7, 0xbf, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xeb, 0xff, 0xbf, 0x42, 0x0a, 0xb5, 0xc1, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xeb, 0xff, 0xbf, 0x42, 0x0a, 0xb5, 0xc1, 0x42, 0x5b, 0x50, 0x00, 0x00, 0xeb, 0xff, 0xbf, 0x42,
+        0x33, 0x91, 0xc0, 0x42, 0x34, 0x50, 0x01, 0x00, 0x85, 0x99, 0xc0, 0x42, 0xcc, 0x2a, 0xc1, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x1e, 0x33, 0xc1, 0x42, 0x66, 0xc4, 0xc1, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0xb8, 0xcc, 0xc1, 0x42, 0xc2, 0x13, 0xc4, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xb8, 0xcc, 0xc1, 0x42,
+        0xc2, 0x13, 0xc4, 0x42, 0x58, 0x50, 0x00, 0x00, 0xb8, 0xcc, 0xc1, 0x42, 0xff, 0x5d, 0xc2, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x51, 0x66, 0xc2, 0x42, 0x99, 0xf7, 0xc2, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0xeb, 0xff, 0xc2, 0x42, 0x32, 0x91, 0xc3, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x84, 0x99, 0xc3, 0x42,
+        0xcc, 0x2a, 0xc4, 0x42, 0x37, 0x50, 0x01, 0x00, 0x1e, 0x33, 0xc4, 0x42, 0x65, 0xc4, 0xc4, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xb7, 0xcc, 0xc4, 0x42, 0xd6, 0x81, 0xc6, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0xb7, 0xcc, 0xc4, 0x42, 0xd6, 0x81, 0xc6, 0x42, 0x5b, 0x50, 0x00, 0x00, 0xb7, 0xcc, 0xc4, 0x42,
+        0xff, 0x5d, 0xc5, 0x42, 0x32, 0x50, 0x01, 0x00, 0x51, 0x66, 0xc5, 0x42, 0x98, 0xf7, 0xc5, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xea, 0xff, 0xc5, 0x42, 0x32, 0x91, 0xc6, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x84, 0x99, 0xc6, 0x42, 0x8e, 0xe0, 0xc8, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x84, 0x99, 0xc6, 0x42,
+        0x8e, 0xe0, 0xc8, 0x42, 0x56, 0x50, 0x00, 0x00, 0x84, 0x99, 0xc6, 0x42, 0xcc, 0x2a, 0xc7, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x1d, 0x33, 0xc7, 0x42, 0x65, 0xc4, 0xc7, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xb7, 0xcc, 0xc7, 0x42, 0xff, 0x5d, 0xc8, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x51, 0x66, 0xc8, 0x42,
+        0x98, 0xf7, 0xc8, 0x42, 0x37, 0x50, 0x01, 0x00, 0xea, 0xff, 0xc8, 0x42, 0x32, 0x91, 0xc9, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x84, 0x99, 0xc9, 0x42, 0xa2, 0x4e, 0xcb, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x84, 0x99, 0xc9, 0x42, 0xa2, 0x4e, 0xcb, 0x42, 0x5a, 0x50, 0x00, 0x00, 0x84, 0x99, 0xc9, 0x42,
+        0xcb, 0x2a, 0xca, 0x42, 0x32, 0x50, 0x01, 0x00, 0x1d, 0x33, 0xca, 0x42, 0x65, 0xc4, 0xca, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xb7, 0xcc, 0xca, 0x42, 0xfe, 0x5d, 0xcb, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x50, 0x66, 0xcb, 0x42, 0x5a, 0xad, 0xcd, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x50, 0x66, 0xcb, 0x42,
+        0x5a, 0xad, 0xcd, 0x42, 0x56, 0x50, 0x00, 0x00, 0x50, 0x66, 0xcb, 0x42, 0x98, 0xf7, 0xcb, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0xea, 0xff, 0xcb, 0x42, 0x31, 0x91, 0xcc, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x83, 0x99, 0xcc, 0x42, 0xcb, 0x2a, 0xcd, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x1d, 0x33, 0xcd, 0x42,
+        0x64, 0xc4, 0xcd, 0x42, 0x36, 0x50, 0x01, 0x00, 0xb6, 0xcc, 0xcd, 0x42, 0xfe, 0x5d, 0xce, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x50, 0x66, 0xce, 0x42, 0x6e, 0x1b, 0xd0, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x50, 0x66, 0xce, 0x42, 0x6e, 0x1b, 0xd0, 0x42, 0x5a, 0x50, 0x00, 0x00, 0x50, 0x66, 0xce, 0x42,
+        0x97, 0xf7, 0xce, 0x42, 0x32, 0x50, 0x01, 0x00, 0xe9, 0xff, 0xce, 0x42, 0x31, 0x91, 0xcf, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x83, 0x99, 0xcf, 0x42, 0xcb, 0x2a, 0xd0, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x1c, 0x33, 0xd0, 0x42, 0x26, 0x7a, 0xd2, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1c, 0x33, 0xd0, 0x42,
+        0x26, 0x7a, 0xd2, 0x42, 0x56, 0x50, 0x00, 0x00, 0x1c, 0x33, 0xd0, 0x42, 0x64, 0xc4, 0xd0, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0xb6, 0xcc, 0xd0, 0x42, 0xfe, 0x5d, 0xd1, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x50, 0x66, 0xd1, 0x42, 0x97, 0xf7, 0xd1, 0x42, 0x39, 0x50, 0x01, 0x00, 0xe9, 0xff, 0xd1, 0x42,
+        0x31, 0x91, 0xd2, 0x42, 0x36, 0x50, 0x01, 0x00, 0x83, 0x99, 0xd2, 0x42, 0xca, 0x2a, 0xd3, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x1c, 0x33, 0xd3, 0x42, 0x59, 0x0d, 0xd4, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x1c, 0x33, 0xd3, 0x42, 0x64, 0xc4, 0xd3, 0x42, 0x34, 0x50, 0x01, 0x00, 0xb6, 0xcc, 0xd3, 0x42,
+        0xfd, 0x5d, 0xd4, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x82, 0x19, 0xd4, 0x42, 0xc0, 0xf3, 0xd4, 0x42,
+        0x58, 0x50, 0x00, 0x00, 0x4f, 0x66, 0xd4, 0x42, 0x97, 0xf7, 0xd4, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0xe9, 0xff, 0xd4, 0x42, 0x26, 0xda, 0xd5, 0x42, 0x5f, 0x50, 0x00, 0x00, 0xe9, 0xff, 0xd4, 0x42,
+        0x30, 0x91, 0xd5, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x82, 0x99, 0xd5, 0x42, 0xca, 0x2a, 0xd6, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x4f, 0xe6, 0xd5, 0x42, 0x8c, 0xc0, 0xd6, 0x42, 0x58, 0x50, 0x00, 0x00,
+        0x1c, 0x33, 0xd6, 0x42, 0x63, 0xc4, 0xd6, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xd6, 0x42,
+        0xe8, 0xef, 0xd7, 0x42, 0x53, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0xd6, 0x42, 0xfd, 0x5d, 0xd7, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x4f, 0x66, 0xd7, 0x42, 0x96, 0xf7, 0xd7, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0xe8, 0xff, 0xd7, 0x42, 0x26, 0xda, 0xd8, 0x42, 0x53, 0x50, 0x00, 0x00, 0xe8, 0xff, 0xd7, 0x42,
+        0x30, 0x91, 0xd8, 0x42, 0x32, 0x50, 0x01, 0x00, 0x82, 0x99, 0xd8, 0x42, 0xca, 0x2a, 0xd9, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x4f, 0xe6, 0xd8, 0x42, 0x8c, 0xc0, 0xd9, 0x42, 0x56, 0x50, 0x00, 0x00,
+        0x1b, 0x33, 0xd9, 0x42, 0x63, 0xc4, 0xd9, 0x42, 0x37, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xd9, 0x42,
+        0xf2, 0xa6, 0xda, 0x42, 0x5f, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0xd9, 0x42, 0xfd, 0x5d, 0xda, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x4f, 0x66, 0xda, 0x42, 0x96, 0xf7, 0xda, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x1b, 0xb3, 0xda, 0x42, 0x59, 0x8d, 0xdb, 0x42, 0x56, 0x50, 0x00, 0x00, 0xe8, 0xff, 0xda, 0x42,
+        0x30, 0x91, 0xdb, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x82, 0x99, 0xdb, 0x42, 0xb5, 0xbc, 0xdc, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x82, 0x99, 0xdb, 0x42, 0xc9, 0x2a, 0xdc, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x1b, 0x33, 0xdc, 0x42, 0x63, 0xc4, 0xdc, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb5, 0xcc, 0xdc, 0x42,
+        0xf2, 0xa6, 0xdd, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xb5, 0xcc, 0xdc, 0x42, 0xfc, 0x5d, 0xdd, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x4e, 0x66, 0xdd, 0x42, 0x96, 0xf7, 0xdd, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1b, 0xb3, 0xdd, 0x42, 0x58, 0x8d, 0xde, 0x42, 0x53, 0x50, 0x00, 0x00, 0xe8, 0xff, 0xdd, 0x42,
+        0x2f, 0x91, 0xde, 0x42, 0x36, 0x50, 0x01, 0x00, 0x81, 0x99, 0xde, 0x42, 0xbf, 0x73, 0xdf, 0x42,
+        0x5a, 0x50, 0x00, 0x00, 0x81, 0x99, 0xde, 0x42, 0xc9, 0x2a, 0xdf, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1b, 0x33, 0xdf, 0x42, 0x62, 0xc4, 0xdf, 0x42, 0x32, 0x50, 0x01, 0x00, 0xe8, 0x7f, 0xdf, 0x42,
+        0x25, 0x5a, 0xe0, 0x42, 0x53, 0x50, 0x00, 0x00, 0xb4, 0xcc, 0xdf, 0x42, 0xfc, 0x5d, 0xe0, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x4e, 0x66, 0xe0, 0x42, 0x81, 0x89, 0xe1, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x4e, 0x66, 0xe0, 0x42, 0x96, 0xf7, 0xe0, 0x42, 0x36, 0x50, 0x01, 0x00, 0xe7, 0xff, 0xe0, 0x42,
+        0x2f, 0x91, 0xe1, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x81, 0x99, 0xe1, 0x42, 0xbe, 0x73, 0xe2, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x81, 0x99, 0xe1, 0x42, 0xc9, 0x2a, 0xe2, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0xe2, 0x42, 0x62, 0xc4, 0xe2, 0x42, 0x39, 0x50, 0x01, 0x00, 0xe7, 0x7f, 0xe2, 0x42,
+        0x25, 0x5a, 0xe3, 0x42, 0x56, 0x50, 0x00, 0x00, 0xb4, 0xcc, 0xe2, 0x42, 0xfc, 0x5d, 0xe3, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x4e, 0x66, 0xe3, 0x42, 0x8b, 0x40, 0xe4, 0x42, 0x5d, 0x50, 0x00, 0x00,
+        0x4e, 0x66, 0xe3, 0x42, 0x95, 0xf7, 0xe3, 0x42, 0x39, 0x50, 0x01, 0x00, 0xe7, 0xff, 0xe3, 0x42,
+        0x2f, 0x91, 0xe4, 0x42, 0x32, 0x50, 0x01, 0x00, 0xb4, 0x4c, 0xe4, 0x42, 0xf1, 0x26, 0xe5, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x81, 0x99, 0xe4, 0x42, 0xc8, 0x2a, 0xe5, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0xe5, 0x42, 0x4d, 0x56, 0xe6, 0x42, 0x51, 0x50, 0x00, 0x00, 0x1a, 0x33, 0xe5, 0x42,
+        0x62, 0xc4, 0xe5, 0x42, 0x36, 0x50, 0x01, 0x00, 0xb4, 0xcc, 0xe5, 0x42, 0xfb, 0x5d, 0xe6, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x4d, 0x66, 0xe6, 0x42, 0x8b, 0x40, 0xe7, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x4d, 0x66, 0xe6, 0x42, 0x95, 0xf7, 0xe6, 0x42, 0x34, 0x50, 0x01, 0x00, 0xe7, 0xff, 0xe6, 0x42,
+        0x2e, 0x91, 0xe7, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb4, 0x4c, 0xe7, 0x42, 0xf1, 0x26, 0xe8, 0x42,
+        0x58, 0x50, 0x00, 0x00, 0x80, 0x99, 0xe7, 0x42, 0xc8, 0x2a, 0xe8, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0xe8, 0x42, 0x57, 0x0d, 0xe9, 0x42, 0x5f, 0x50, 0x00, 0x00, 0x1a, 0x33, 0xe8, 0x42,
+        0x61, 0xc4, 0xe8, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb3, 0xcc, 0xe8, 0x42, 0xfb, 0x5d, 0xe9, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x80, 0x19, 0xe9, 0x42, 0xbd, 0xf3, 0xe9, 0x42, 0x58, 0x50, 0x00, 0x00,
+        0x4d, 0x66, 0xe9, 0x42, 0x95, 0xf7, 0xe9, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xe6, 0xff, 0xe9, 0x42,
+        0x1a, 0x23, 0xeb, 0x42, 0x53, 0x50, 0x00, 0x00, 0xe6, 0xff, 0xe9, 0x42, 0x2e, 0x91, 0xea, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x80, 0x99, 0xea, 0x42, 0xc8, 0x2a, 0xeb, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1a, 0x33, 0xeb, 0x42, 0x57, 0x0d, 0xec, 0x42, 0x53, 0x50, 0x00, 0x00, 0x1a, 0x33, 0xeb, 0x42,
+        0x61, 0xc4, 0xeb, 0x42, 0x32, 0x50, 0x01, 0x00, 0xb3, 0xcc, 0xeb, 0x42, 0xfb, 0x5d, 0xec, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x80, 0x19, 0xec, 0x42, 0xbd, 0xf3, 0xec, 0x42, 0x56, 0x50, 0x00, 0x00,
+        0x4d, 0x66, 0xec, 0x42, 0x94, 0xf7, 0xec, 0x42, 0x37, 0x50, 0x01, 0x00, 0xe6, 0xff, 0xec, 0x42,
+        0x23, 0xda, 0xed, 0x42, 0x5f, 0x50, 0x00, 0x00, 0xe6, 0xff, 0xec, 0x42, 0x2e, 0x91, 0xed, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x80, 0x99, 0xed, 0x42, 0xc7, 0x2a, 0xee, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x4c, 0xe6, 0xed, 0x42, 0x8a, 0xc0, 0xee, 0x42, 0x56, 0x50, 0x00, 0x00, 0x19, 0x33, 0xee, 0x42,
+        0x61, 0xc4, 0xee, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb3, 0xcc, 0xee, 0x42, 0xe6, 0xef, 0xef, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0xb3, 0xcc, 0xee, 0x42, 0xfa, 0x5d, 0xef, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x4c, 0x66, 0xef, 0x42, 0x94, 0xf7, 0xef, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xe6, 0xff, 0xef, 0x42,
+        0x23, 0xda, 0xf0, 0x42, 0x4e, 0x50, 0x00, 0x00, 0xe6, 0xff, 0xef, 0x42, 0x2d, 0x91, 0xf0, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x7f, 0x99, 0xf0, 0x42, 0xc7, 0x2a, 0xf1, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x4c, 0xe6, 0xf0, 0x42, 0x89, 0xc0, 0xf1, 0x42, 0x53, 0x50, 0x00, 0x00, 0x19, 0x33, 0xf1, 0x42,
+        0x60, 0xc4, 0xf1, 0x42, 0x36, 0x50, 0x01, 0x00, 0xb2, 0xcc, 0xf1, 0x42, 0xf0, 0xa6, 0xf2, 0x42,
+        0x5a, 0x50, 0x00, 0x00, 0xb2, 0xcc, 0xf1, 0x42, 0xfa, 0x5d, 0xf2, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x4c, 0x66, 0xf2, 0x42, 0x94, 0xf7, 0xf2, 0x42, 0x32, 0x50, 0x01, 0x00, 0x19, 0xb3, 0xf2, 0x42,
+        0x56, 0x8d, 0xf3, 0x42, 0x53, 0x50, 0x00, 0x00, 0xe5, 0xff, 0xf2, 0x42, 0x2d, 0x91, 0xf3, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x7f, 0x99, 0xf3, 0x42, 0xb2, 0xbc, 0xf4, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x7f, 0x99, 0xf3, 0x42, 0xc7, 0x2a, 0xf4, 0x42, 0x36, 0x50, 0x01, 0x00, 0x19, 0x33, 0xf4, 0x42,
+        0x60, 0xc4, 0xf4, 0x42, 0x3b, 0x50, 0x01, 0x00, 0xb2, 0xcc, 0xf4, 0x42, 0xef, 0xa6, 0xf5, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0xb2, 0xcc, 0xf4, 0x42, 0xfa, 0x5d, 0xf5, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x4c, 0x66, 0xf5, 0x42, 0x93, 0xf7, 0xf5, 0x42, 0x39, 0x50, 0x01, 0x00, 0x18, 0xb3, 0xf5, 0x42,
+        0x56, 0x8d, 0xf6, 0x42, 0x56, 0x50, 0x00, 0x00, 0xe5, 0xff, 0xf5, 0x42, 0x2d, 0x91, 0xf6, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x7f, 0x99, 0xf6, 0x42, 0xbc, 0x73, 0xf7, 0x42, 0x5d, 0x50, 0x00, 0x00,
+        0x7f, 0x99, 0xf6, 0x42, 0xc6, 0x2a, 0xf7, 0x42, 0x39, 0x50, 0x01, 0x00, 0x18, 0x33, 0xf7, 0x42,
+        0x60, 0xc4, 0xf7, 0x42, 0x32, 0x50, 0x01, 0x00, 0xe5, 0x7f, 0xf7, 0x42, 0x22, 0x5a, 0xf8, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0xb2, 0xcc, 0xf7, 0x42, 0xf9, 0x5d, 0xf8, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x4b, 0x66, 0xf8, 0x42, 0x7e, 0x89, 0xf9, 0x42, 0x51, 0x50, 0x00, 0x00, 0x4b, 0x66, 0xf8, 0x42,
+        0x93, 0xf7, 0xf8, 0x42, 0x36, 0x50, 0x01, 0x00, 0xe5, 0xff, 0xf8, 0x42, 0x2c, 0x91, 0xf9, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x7e, 0x99, 0xf9, 0x42, 0x36, 0x28, 0xfe, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x7e, 0x99, 0xf9, 0x42, 0x36, 0x28, 0xfe, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x7e, 0x99, 0xf9, 0x42,
+        0x36, 0x28, 0xfe, 0x42, 0x53, 0x50, 0x00, 0x00, 0x7e, 0x99, 0xf9, 0x42, 0x36, 0x28, 0xfe, 0x42,
+        0x58, 0x50, 0x00, 0x00, 0x7e, 0x99, 0xf9, 0x42, 0x36, 0x28, 0xfe, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0x7e, 0x99, 0xf9, 0x42, 0x36, 0x28, 0xfe, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x7e, 0x99, 0xf9, 0x42,
+        0x36, 0x28, 0xfe, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x50, 0xd9, 0x3e,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xbb, 0x59, 0x40, 0x30, 0x50, 0x01, 0x00,
+        0x10, 0x41, 0xe5, 0x3e, 0x0c, 0xd6, 0x28, 0x3f, 0x47, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0x2b, 0x3f,
+        0x50, 0x26, 0x62, 0x3f, 0x4c, 0x50, 0x00, 0x00, 0x10, 0x41, 0x65, 0x3f, 0x9d, 0xf4, 0xa8, 0x3f,
+        0x4a, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0xab, 0x3f, 0xe1, 0x44, 0xe2, 0x3f, 0x47, 0x50, 0x00, 0x00,
+        0x99, 0xf4, 0x00, 0x40, 0xa4, 0x1e, 0x1c, 0x40, 0x4a, 0x50, 0x00, 0x00, 0xbb, 0x9c, 0x1d, 0x40,
+        0x1c, 0x2a, 0x2b, 0x40, 0x47, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0x2b, 0x40, 0x2d, 0x7e, 0x39, 0x40,
+        0x45, 0x50, 0x00, 0x00, 0xdd, 0x44, 0x3a, 0x40, 0x3e, 0xd2, 0x47, 0x40, 0x47, 0x50, 0x00, 0x00,
+        0xee, 0x98, 0x48, 0x40, 0xf8, 0xc2, 0x63, 0x40, 0x4a, 0x50, 0x00, 0x00, 0x10, 0x41, 0x65, 0x40,
+        0x8d, 0x35, 0x80, 0x40, 0x4a, 0x50, 0x00, 0x00, 0x10, 0x41, 0x65, 0x40, 0xe1, 0x6e, 0x9b, 0x40,
+        0x34, 0x50, 0x01, 0x00, 0x99, 0xf4, 0x80, 0x40, 0x49, 0xbb, 0x87, 0x40, 0x47, 0x50, 0x00, 0x00,
+        0xa1, 0x1e, 0x88, 0x40, 0x52, 0xe5, 0x8e, 0x40, 0x4c, 0x50, 0x00, 0x00, 0xaa, 0x48, 0x8f, 0x40,
+        0xaf, 0xdd, 0x9c, 0x40, 0x4a, 0x50, 0x00, 0x00, 0xbb, 0x9c, 0x9d, 0x40, 0xc0, 0x31, 0xab, 0x40,
+        0x47, 0x50, 0x00, 0x00, 0xbb, 0x9c, 0x9d, 0x40, 0x67, 0xa4, 0xe1, 0x40, 0x32, 0x50, 0x01, 0x00,
+        0xd4, 0x1a, 0xb3, 0x40, 0xda, 0xaf, 0xc0, 0x40, 0x4a, 0x50, 0x00, 0x00, 0xe5, 0x6e, 0xc1, 0x40,
+        0x96, 0x35, 0xc8, 0x40, 0x47, 0x50, 0x00, 0x00, 0xee, 0x98, 0xc8, 0x40, 0xf3, 0x2d, 0xd6, 0x40,
+        0x45, 0x50, 0x00, 0x00, 0xff, 0xec, 0xd6, 0x40, 0xaf, 0xb3, 0xdd, 0x40, 0x40, 0x50, 0x00, 0x00,
+        0x07, 0x17, 0xde, 0x40, 0xb8, 0xdd, 0xe4, 0x40, 0x42, 0x50, 0x00, 0x00, 0x10, 0x41, 0xe5, 0x40,
+        0x15, 0xd6, 0xf2, 0x40, 0x43, 0x50, 0x00, 0x00, 0x10, 0x41, 0xe5, 0x40, 0x5d, 0x0f, 0x29, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x21, 0x95, 0xf3, 0x40, 0x68, 0x63, 0x07, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0xa1, 0x1e, 0x08, 0x41, 0xfa, 0x81, 0x0b, 0x41, 0x40, 0x50, 0x00, 0x00, 0xa5, 0xb3, 0x0b, 0x41,
+        0xfe, 0x16, 0x0f, 0x41, 0x42, 0x50, 0x00, 0x00, 0xaa, 0x48, 0x0f, 0x41, 0x97, 0x5f, 0x14, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x30, 0xa8, 0x14, 0x41, 0x88, 0x0b, 0x18, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0x34, 0x3d, 0x18, 0x41, 0xf7, 0xec, 0x19, 0x41, 0x40, 0x50, 0x00, 0x00, 0xb6, 0x07, 0x1a, 0x41,
+        0x7a, 0xb7, 0x1b, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x39, 0xd2, 0x1b, 0x41, 0xbb, 0x9c, 0x22, 0x41,
+        0x3b, 0x50, 0x00, 0x00, 0xc3, 0xc6, 0x24, 0x41, 0x1b, 0x2a, 0x28, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0xc7, 0x5b, 0x28, 0x41, 0x20, 0xbf, 0x2b, 0x41, 0x42, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0x2b, 0x41,
+        0x4e, 0xbb, 0x32, 0x41, 0x43, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0x2b, 0x41, 0xf8, 0x57, 0x40, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0xd4, 0x1a, 0x33, 0x41, 0xac, 0xb3, 0x40, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0xe5, 0x6e, 0x41, 0x41, 0x3d, 0xd2, 0x44, 0x41, 0x40, 0x50, 0x00, 0x00, 0xe5, 0x6e, 0x41, 0x41,
+        0xbb, 0x72, 0x63, 0x41, 0x32, 0x50, 0x01, 0x00, 0xe9, 0x03, 0x45, 0x41, 0x42, 0x67, 0x48, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0xee, 0x98, 0x48, 0x41, 0xdb, 0xaf, 0x4d, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x74, 0xf8, 0x4d, 0x41, 0xcc, 0x5b, 0x51, 0x41, 0x42, 0x50, 0x00, 0x00, 0x78, 0x8d, 0x51, 0x41,
+        0x3b, 0x3d, 0x53, 0x41, 0x40, 0x50, 0x00, 0x00, 0xfa, 0x57, 0x53, 0x41, 0xbd, 0x07, 0x55, 0x41,
+        0x3e, 0x50, 0x00, 0x00, 0x7c, 0x22, 0x55, 0x41, 0xff, 0xec, 0x5b, 0x41, 0x3b, 0x50, 0x00, 0x00,
+        0x07, 0x17, 0x5e, 0x41, 0x5f, 0x7a, 0x61, 0x41, 0x40, 0x50, 0x00, 0x00, 0x0b, 0xac, 0x61, 0x41,
+        0x64, 0x0f, 0x65, 0x41, 0x42, 0x50, 0x00, 0x00, 0x10, 0x41, 0x65, 0x41, 0x92, 0x0b, 0x6c, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x10, 0x41, 0x65, 0x41, 0xf2, 0xd7, 0x8d, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x18, 0x6b, 0x6c, 0x41, 0xf0, 0x03, 0x7a, 0x41, 0x45, 0x50, 0x00, 0x00, 0x29, 0xbf, 0x7a, 0x41,
+        0x81, 0x22, 0x7e, 0x41, 0x43, 0x50, 0x00, 0x00, 0x2d, 0x54, 0x7e, 0x41, 0xc3, 0xdb, 0x80, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x99, 0xf4, 0x80, 0x41, 0x10, 0x80, 0x83, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x5c, 0xa4, 0x83, 0x41, 0x08, 0x56, 0x85, 0x41, 0x45, 0x50, 0x00, 0x00, 0xde, 0x6e, 0x85, 0x41,
+        0xc0, 0x46, 0x86, 0x41, 0x43, 0x50, 0x00, 0x00, 0x1f, 0x54, 0x86, 0x41, 0x01, 0x2c, 0x87, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0x60, 0x39, 0x87, 0x41, 0xa2, 0x9e, 0x8a, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0xa5, 0xb3, 0x8b, 0x41, 0x52, 0x65, 0x8d, 0x41, 0x40, 0x50, 0x00, 0x00, 0x28, 0x7e, 0x8d, 0x41,
+        0xd4, 0x2f, 0x8f, 0x41, 0x42, 0x50, 0x00, 0x00, 0xaa, 0x48, 0x8f, 0x41, 0xeb, 0xad, 0x92, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0xaa, 0x48, 0x8f, 0x41, 0x40, 0x7c, 0x99, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x30, 0xa8, 0x94, 0x41, 0x12, 0x80, 0x95, 0x41, 0x3b, 0x50, 0x00, 0x00, 0x71, 0x8d, 0x95, 0x41,
+        0x53, 0x65, 0x96, 0x41, 0x3b, 0x50, 0x00, 0x00, 0xb2, 0x72, 0x96, 0x41, 0x89, 0x8b, 0x9b, 0x41,
+        0x3b, 0x50, 0x00, 0x00, 0xb6, 0x07, 0x9a, 0x41, 0xa2, 0x09, 0xab, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x39, 0xd2, 0x9b, 0x41, 0xe5, 0x83, 0x9d, 0x41, 0x39, 0x50, 0x00, 0x00, 0xbb, 0x9c, 0x9d, 0x41,
+        0x67, 0x4e, 0x9f, 0x41, 0x3b, 0x50, 0x00, 0x00, 0x3d, 0x67, 0x9f, 0x41, 0xa9, 0x33, 0xa6, 0x41,
+        0x39, 0x50, 0x00, 0x00, 0xc7, 0x5b, 0xa8, 0x41, 0x74, 0x0d, 0xaa, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x4a, 0x26, 0xaa, 0x41, 0xf6, 0xd7, 0xab, 0x41, 0x42, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0xab, 0x41,
+        0x0d, 0x56, 0xaf, 0x41, 0x43, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0xab, 0x41, 0x36, 0x28, 0xc7, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0xd0, 0x85, 0xaf, 0x41, 0x3c, 0x52, 0xb6, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0xd8, 0xaf, 0xb6, 0x41, 0x85, 0x61, 0xb8, 0x41, 0x40, 0x50, 0x00, 0x00, 0x5b, 0x7a, 0xb8, 0x41,
+        0x07, 0x2c, 0xba, 0x41, 0x42, 0x50, 0x00, 0x00, 0xdd, 0x44, 0xba, 0x41, 0x53, 0xd0, 0xbc, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0xa0, 0xf4, 0xbc, 0x41, 0x4c, 0xa6, 0xbe, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0x22, 0xbf, 0xbe, 0x41, 0x03, 0x97, 0xbf, 0x41, 0x40, 0x50, 0x00, 0x00, 0x63, 0xa4, 0xbf, 0x41,
+        0x45, 0x7c, 0xc0, 0x41, 0x3e, 0x50, 0x00, 0x00, 0xa4, 0x89, 0xc0, 0x41, 0xe5, 0xee, 0xc3, 0x41,
+        0x3b, 0x50, 0x00, 0x00, 0xe9, 0x03, 0xc5, 0x41, 0x96, 0xb5, 0xc6, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x6c, 0xce, 0xc6, 0x41, 0x18, 0x80, 0xc8, 0x41, 0x42, 0x50, 0x00, 0x00, 0xee, 0x98, 0xc8, 0x41,
+        0x2f, 0xfe, 0xcb, 0x41, 0x43, 0x50, 0x00, 0x00, 0xee, 0x98, 0xc8, 0x41, 0x84, 0xcc, 0xd2, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0xf2, 0x2d, 0xcc, 0x41, 0x5e, 0xfa, 0xd2, 0x41, 0x42, 0x50, 0x00, 0x00,
+        0xfa, 0x57, 0xd3, 0x41, 0xa7, 0x09, 0xd5, 0x41, 0x40, 0x50, 0x00, 0x00, 0xfa, 0x57, 0xd3, 0x41,
+        0xe5, 0x59, 0xe4, 0x41, 0x32, 0x50, 0x01, 0x00, 0x7c, 0x22, 0xd5, 0x41, 0x29, 0xd4, 0xd6, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0xff, 0xec, 0xd6, 0x41, 0x75, 0x78, 0xd9, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0xc2, 0x9c, 0xd9, 0x41, 0x6e, 0x4e, 0xdb, 0x41, 0x42, 0x50, 0x00, 0x00, 0x44, 0x67, 0xdb, 0x41,
+        0x25, 0x3f, 0xdc, 0x41, 0x40, 0x50, 0x00, 0x00, 0x85, 0x4c, 0xdc, 0x41, 0x67, 0x24, 0xdd, 0x41,
+        0x3e, 0x50, 0x00, 0x00, 0xc6, 0x31, 0xdd, 0x41, 0x07, 0x97, 0xe0, 0x41, 0x3b, 0x50, 0x00, 0x00,
+        0x0b, 0xac, 0xe1, 0x41, 0xb7, 0x5d, 0xe3, 0x41, 0x40, 0x50, 0x00, 0x00, 0x8d, 0x76, 0xe3, 0x41,
+        0x3a, 0x28, 0xe5, 0x41, 0x42, 0x50, 0x00, 0x00, 0x10, 0x41, 0xe5, 0x41, 0x51, 0xa6, 0xe8, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x10, 0x41, 0xe5, 0x41, 0x3d, 0x3c, 0x00, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x14, 0xd6, 0xe8, 0x41, 0x80, 0xa2, 0xef, 0x41, 0x45, 0x50, 0x00, 0x00, 0x1c, 0x00, 0xf0, 0x41,
+        0xc8, 0xb1, 0xf1, 0x41, 0x43, 0x50, 0x00, 0x00, 0x9e, 0xca, 0xf1, 0x41, 0x4b, 0x7c, 0xf3, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x21, 0x95, 0xf3, 0x41, 0x97, 0x20, 0xf6, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0xe4, 0x44, 0xf6, 0x41, 0x90, 0xf6, 0xf7, 0x41, 0x45, 0x50, 0x00, 0x00, 0x66, 0x0f, 0xf8, 0x41,
+        0x47, 0xe7, 0xf8, 0x41, 0x43, 0x50, 0x00, 0x00, 0xa7, 0xf4, 0xf8, 0x41, 0x88, 0xcc, 0xf9, 0x41,
+        0x42, 0x50, 0x00, 0x00, 0xe8, 0xd9, 0xf9, 0x41, 0x29, 0x3f, 0xfd, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x2d, 0x54, 0xfe, 0x41, 0xed, 0x02, 0x00, 0x42, 0x40, 0x50, 0x00, 0x00, 0x58, 0x0f, 0x00, 0x42,
+        0x2e, 0xe8, 0x00, 0x42, 0x42, 0x50, 0x00, 0x00, 0x99, 0xf4, 0x00, 0x42, 0x39, 0xa7, 0x02, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x99, 0xf4, 0x00, 0x42, 0x64, 0x0e, 0x06, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x5c, 0xa4, 0x03, 0x42, 0x4d, 0x10, 0x04, 0x42, 0x3b, 0x50, 0x00, 0x00, 0xfc, 0x16, 0x04, 0x42,
+        0xed, 0x82, 0x04, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x9d, 0x89, 0x04, 0x42, 0x08, 0x16, 0x07, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x1f, 0x54, 0x06, 0x42, 0x15, 0xd5, 0x0e, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x60, 0x39, 0x07, 0x42, 0x36, 0x12, 0x08, 0x42, 0x39, 0x50, 0x00, 0x00, 0xa1, 0x1e, 0x08, 0x42,
+        0x77, 0xf7, 0x08, 0x42, 0x3b, 0x50, 0x00, 0x00, 0xe2, 0x03, 0x09, 0x42, 0x83, 0xb6, 0x0a, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x64, 0xce, 0x0a, 0x42, 0x55, 0x3a, 0x0b, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x05, 0x41, 0x0b, 0x42, 0xf6, 0xac, 0x0b, 0x42, 0x45, 0x40, 0x00, 0x00, 0xa5, 0xb3, 0x0b, 0x42,
+        0x46, 0x66, 0x0d, 0x42, 0x45, 0x40, 0x00, 0x00, 0x28, 0x7e, 0x0d, 0x42, 0xc8, 0x30, 0x0f, 0x42,
+        0x43, 0x40, 0x00, 0x00, 0xaa, 0x48, 0x0f, 0x42, 0x15, 0xd5, 0x11, 0x42, 0x48, 0x40, 0x00, 0x00,
+        0xaa, 0x48, 0x0f, 0x42, 0x5f, 0xe4, 0x1c, 0x42, 0x30, 0x40, 0x01, 0x00, 0x6d, 0xf8, 0x11, 0x42,
+        0x98, 0x9f, 0x19, 0x42, 0x47, 0x40, 0x00, 0x00, 0xb6, 0x07, 0x1a, 0x42, 0x57, 0xba, 0x1b, 0x42,
+        0x45, 0x40, 0x00, 0x00, 0x39, 0xd2, 0x1b, 0x42, 0xd9, 0x84, 0x1d, 0x42, 0x43, 0x40, 0x00, 0x00,
+        0xbb, 0x9c, 0x1d, 0x42, 0x26, 0x29, 0x20, 0x42, 0x48, 0x40, 0x00, 0x00, 0xbb, 0x9c, 0x1d, 0x42,
+        0x86, 0xb6, 0x22, 0x42, 0x34, 0x40, 0x01, 0x00, 0x7e, 0x4c, 0x20, 0x42, 0x1f, 0xff, 0x21, 0x42,
+        0x47, 0x40, 0x00, 0x00, 0x00, 0x17, 0x22, 0x42, 0xd6, 0xef, 0x22, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0x41, 0xfc, 0x22, 0x42, 0x42, 0x3c, 0x27, 0x42, 0x42, 0x40, 0x00, 0x00, 0x41, 0xfc, 0x22, 0x42,
+        0x37, 0x7d, 0x2b, 0x42, 0x32, 0x40, 0x01, 0x00, 0x86, 0x76, 0x27, 0x42, 0x77, 0xe2, 0x27, 0x42,
+        0x45, 0x40, 0x00, 0x00, 0x27, 0xe9, 0x27, 0x42, 0x18, 0x55, 0x28, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0xc7, 0x5b, 0x28, 0x42, 0x68, 0x0e, 0x2a, 0x42, 0x45, 0x40, 0x00, 0x00, 0x4a, 0x26, 0x2a, 0x42,
+        0xea, 0xd8, 0x2b, 0x42, 0x43, 0x40, 0x00, 0x00, 0xcc, 0xf0, 0x2b, 0x42, 0x37, 0x7d, 0x2e, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0xcc, 0xf0, 0x2b, 0x42, 0x81, 0x8c, 0x39, 0x42, 0x30, 0x40, 0x01, 0x00,
+        0x8f, 0xa0, 0x2e, 0x42, 0xba, 0x47, 0x36, 0x42, 0x47, 0x40, 0x00, 0x00, 0xd8, 0xaf, 0x36, 0x42,
+        0x79, 0x62, 0x38, 0x42, 0x45, 0x40, 0x00, 0x00, 0x5b, 0x7a, 0x38, 0x42, 0xfb, 0x2c, 0x3a, 0x42,
+        0x43, 0x40, 0x00, 0x00, 0xdd, 0x44, 0x3a, 0x42, 0x48, 0xd1, 0x3c, 0x42, 0x48, 0x40, 0x00, 0x00,
+        0xdd, 0x44, 0x3a, 0x42, 0xa8, 0x5e, 0x3f, 0x42, 0x34, 0x40, 0x01, 0x00, 0xa0, 0xf4, 0x3c, 0x42,
+        0x41, 0xa7, 0x3e, 0x42, 0x47, 0x40, 0x00, 0x00, 0x22, 0xbf, 0x3e, 0x42, 0xf8, 0x97, 0x3f, 0x42,
+        0x45, 0x40, 0x00, 0x00, 0x63, 0xa4, 0x3f, 0x42, 0x04, 0x57, 0x41, 0x42, 0x42, 0x40, 0x00, 0x00,
+        0x63, 0xa4, 0x3f, 0x42, 0x2e, 0xbe, 0x44, 0x42, 0x32, 0x40, 0x01, 0x00, 0xe5, 0x6e, 0x41, 0x42,
+        0x50, 0xfb, 0x43, 0x42, 0x42, 0x40, 0x00, 0x00, 0xa8, 0x1e, 0x44, 0x42, 0x99, 0x8a, 0x44, 0x42,
+        0x45, 0x40, 0x00, 0x00, 0x49, 0x91, 0x44, 0x42, 0x3a, 0xfd, 0x44, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0xe9, 0x03, 0x45, 0x42, 0x8a, 0xb6, 0x46, 0x42, 0x45, 0x40, 0x00, 0x00, 0x6c, 0xce, 0x46, 0x42,
+        0x0c, 0x81, 0x48, 0x42, 0x43, 0x40, 0x00, 0x00, 0xee, 0x98, 0x48, 0x42, 0x8e, 0x4b, 0x4a, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xee, 0x98, 0x48, 0x42, 0xb9, 0xb2, 0x4d, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x70, 0x63, 0x4a, 0x42, 0x46, 0x3c, 0x4b, 0x42, 0x47, 0x50, 0x00, 0x00, 0xb1, 0x48, 0x4b, 0x42,
+        0x87, 0x21, 0x4c, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xf2, 0x2d, 0x4c, 0x42, 0x93, 0xe0, 0x4d, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x74, 0xf8, 0x4d, 0x42, 0x15, 0xab, 0x4f, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x74, 0xf8, 0x4d, 0x42, 0xaa, 0x5e, 0x51, 0x42, 0x30, 0x50, 0x01, 0x00, 0x37, 0xa8, 0x50, 0x42,
+        0xd8, 0x5a, 0x52, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x78, 0x8d, 0x51, 0x42, 0x43, 0xa7, 0x56, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0xb9, 0x72, 0x52, 0x42, 0x8f, 0x4b, 0x53, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xfa, 0x57, 0x53, 0x42, 0xd0, 0x30, 0x54, 0x42, 0x45, 0x50, 0x00, 0x00, 0x3b, 0x3d, 0x54, 0x42,
+        0x11, 0x16, 0x55, 0x42, 0x47, 0x50, 0x00, 0x00, 0x7c, 0x22, 0x55, 0x42, 0x1d, 0xd5, 0x56, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xff, 0xec, 0x56, 0x42, 0x9f, 0x9f, 0x58, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xff, 0xec, 0x56, 0x42, 0xca, 0x06, 0x5c, 0x42, 0x34, 0x50, 0x01, 0x00, 0x81, 0xb7, 0x58, 0x42,
+        0x57, 0x90, 0x59, 0x42, 0x47, 0x50, 0x00, 0x00, 0xc2, 0x9c, 0x59, 0x42, 0x98, 0x75, 0x5a, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x03, 0x82, 0x5a, 0x42, 0xa4, 0x34, 0x5c, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x85, 0x4c, 0x5c, 0x42, 0x26, 0xff, 0x5d, 0x42, 0x47, 0x50, 0x00, 0x00, 0x85, 0x4c, 0x5c, 0x42,
+        0xbb, 0xb2, 0x5f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x48, 0xfc, 0x5e, 0x42, 0xe9, 0xae, 0x60, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x89, 0xe1, 0x5f, 0x42, 0x54, 0xfb, 0x64, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xca, 0xc6, 0x60, 0x42, 0xa0, 0x9f, 0x61, 0x42, 0x47, 0x50, 0x00, 0x00, 0x0b, 0xac, 0x61, 0x42,
+        0xe1, 0x84, 0x62, 0x42, 0x48, 0x50, 0x00, 0x00, 0x4c, 0x91, 0x62, 0x42, 0x22, 0x6a, 0x63, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x8d, 0x76, 0x63, 0x42, 0x2e, 0x29, 0x65, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x10, 0x41, 0x65, 0x42, 0xb0, 0xf3, 0x66, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x10, 0x41, 0x65, 0x42,
+        0xdb, 0x5a, 0x6a, 0x42, 0x30, 0x50, 0x01, 0x00, 0x92, 0x0b, 0x67, 0x42, 0x68, 0xe4, 0x67, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xd3, 0xf0, 0x67, 0x42, 0xa9, 0xc9, 0x68, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x14, 0xd6, 0x68, 0x42, 0xb5, 0x88, 0x6a, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x96, 0xa0, 0x6a, 0x42,
+        0x37, 0x53, 0x6c, 0x42, 0x47, 0x50, 0x00, 0x00, 0x96, 0xa0, 0x6a, 0x42, 0xcc, 0x06, 0x6e, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x59, 0x50, 0x6d, 0x42, 0xfa, 0x02, 0x6f, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x9a, 0x35, 0x6e, 0x42, 0x65, 0x4f, 0x73, 0x42, 0x30, 0x50, 0x01, 0x00, 0xdb, 0x1a, 0x6f, 0x42,
+        0xb1, 0xf3, 0x6f, 0x42, 0x47, 0x50, 0x00, 0x00, 0x1c, 0x00, 0x70, 0x42, 0xf2, 0xd8, 0x70, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x5d, 0xe5, 0x70, 0x42, 0x33, 0xbe, 0x71, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x9e, 0xca, 0x71, 0x42, 0x3f, 0x7d, 0x73, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x21, 0x95, 0x73, 0x42,
+        0xc1, 0x47, 0x75, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x21, 0x95, 0x73, 0x42, 0xec, 0xae, 0x78, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0xa3, 0x5f, 0x75, 0x42, 0x79, 0x38, 0x76, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xe4, 0x44, 0x76, 0x42, 0xba, 0x1d, 0x77, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x25, 0x2a, 0x77, 0x42,
+        0xc5, 0xdc, 0x78, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xa7, 0xf4, 0x78, 0x42, 0x48, 0xa7, 0x7a, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xa7, 0xf4, 0x78, 0x42, 0xdd, 0x5a, 0x7c, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x6a, 0xa4, 0x7b, 0x42, 0x0b, 0x57, 0x7d, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xab, 0x89, 0x7c, 0x42,
+        0xbb, 0xd1, 0x80, 0x42, 0x32, 0x50, 0x01, 0x00, 0xec, 0x6e, 0x7d, 0x42, 0xc2, 0x47, 0x7e, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x2d, 0x54, 0x7e, 0x42, 0x03, 0x2d, 0x7f, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x6e, 0x39, 0x7f, 0x42, 0x22, 0x09, 0x80, 0x42, 0x47, 0x50, 0x00, 0x00, 0x58, 0x0f, 0x80, 0x42,
+        0xc3, 0x7b, 0x80, 0x42, 0x40, 0x50, 0x00, 0x00, 0xf8, 0x81, 0x80, 0x42, 0x63, 0xee, 0x80, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x99, 0xf4, 0x80, 0x42, 0xe9, 0xcd, 0x81, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x99, 0xf4, 0x80, 0x42, 0x73, 0xc2, 0x87, 0x42, 0x30, 0x31, 0x01, 0x00, 0xda, 0xd9, 0x81, 0x42,
+        0xf5, 0x8c, 0x83, 0x42, 0x42, 0x31, 0x00, 0x00, 0x5c, 0xa4, 0x83, 0x42, 0xc7, 0x10, 0x84, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0xfc, 0x16, 0x84, 0x42, 0x68, 0x83, 0x84, 0x42, 0x42, 0x31, 0x00, 0x00,
+        0x9d, 0x89, 0x84, 0x42, 0x7b, 0x2c, 0x85, 0x42, 0x43, 0x31, 0x00, 0x00, 0x8e, 0x35, 0x85, 0x42,
+        0xf9, 0xa1, 0x85, 0x42, 0x42, 0x31, 0x00, 0x00, 0x2e, 0xa8, 0x85, 0x42, 0x27, 0xde, 0x85, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0x7f, 0xe1, 0x85, 0x42, 0x77, 0x17, 0x86, 0x42, 0x3e, 0x31, 0x00, 0x00,
+        0xcf, 0x1a, 0x86, 0x42, 0x1f, 0xf4, 0x86, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x60, 0x39, 0x87, 0x42,
+        0xcb, 0xa5, 0x87, 0x42, 0x40, 0x31, 0x00, 0x00, 0x01, 0xac, 0x87, 0x42, 0x6c, 0x18, 0x88, 0x42,
+        0x42, 0x31, 0x00, 0x00, 0xa1, 0x1e, 0x88, 0x42, 0xf2, 0xf7, 0x88, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0xa1, 0x1e, 0x88, 0x42, 0x87, 0xab, 0x8a, 0x42, 0x34, 0x31, 0x01, 0x00, 0xe2, 0x03, 0x89, 0x42,
+        0xfd, 0xb6, 0x8a, 0x42, 0x42, 0x31, 0x00, 0x00, 0x64, 0xce, 0x8a, 0x42, 0xcf, 0x3a, 0x8b, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0x64, 0xce, 0x8a, 0x42, 0xdf, 0x0e, 0x8f, 0x42, 0x32, 0x31, 0x01, 0x00,
+        0x05, 0x41, 0x8b, 0x42, 0x70, 0xad, 0x8b, 0x42, 0x42, 0x31, 0x00, 0x00, 0xa5, 0xb3, 0x8b, 0x42,
+        0x83, 0x56, 0x8c, 0x42, 0x43, 0x31, 0x00, 0x00, 0x96, 0x5f, 0x8c, 0x42, 0x01, 0xcc, 0x8c, 0x42,
+        0x42, 0x31, 0x00, 0x00, 0x37, 0xd2, 0x8c, 0x42, 0x2f, 0x08, 0x8d, 0x42, 0x40, 0x31, 0x00, 0x00,
+        0x87, 0x0b, 0x8d, 0x42, 0x7f, 0x41, 0x8d, 0x42, 0x3e, 0x31, 0x00, 0x00, 0xd7, 0x44, 0x8d, 0x42,
+        0x28, 0x1e, 0x8e, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x69, 0x63, 0x8e, 0x42, 0xd4, 0xcf, 0x8e, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0x09, 0xd6, 0x8e, 0x42, 0x74, 0x42, 0x8f, 0x42, 0x42, 0x31, 0x00, 0x00,
+        0xaa, 0x48, 0x8f, 0x42, 0xfa, 0x21, 0x90, 0x42, 0x43, 0x31, 0x00, 0x00, 0xaa, 0x48, 0x8f, 0x42,
+        0x84, 0x16, 0x96, 0x42, 0x30, 0x31, 0x01, 0x00, 0xeb, 0x2d, 0x90, 0x42, 0x06, 0xe1, 0x91, 0x42,
+        0x45, 0x31, 0x00, 0x00, 0x6d, 0xf8, 0x91, 0x42, 0xd8, 0x64, 0x92, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x0d, 0x6b, 0x92, 0x42, 0x78, 0xd7, 0x92, 0x42, 0x45, 0x31, 0x00, 0x00, 0xae, 0xdd, 0x92, 0x42,
+        0x8c, 0x80, 0x93, 0x42, 0x47, 0x31, 0x00, 0x00, 0x9f, 0x89, 0x93, 0x42, 0x0a, 0xf6, 0x93, 0x42,
+        0x45, 0x31, 0x00, 0x00, 0x3f, 0xfc, 0x93, 0x42, 0x38, 0x32, 0x94, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x90, 0x35, 0x94, 0x42, 0x88, 0x6b, 0x94, 0x42, 0x42, 0x31, 0x00, 0x00, 0xe0, 0x6e, 0x94, 0x42,
+        0x30, 0x48, 0x95, 0x42, 0x40, 0x31, 0x00, 0x00, 0x71, 0x8d, 0x95, 0x42, 0xdc, 0xf9, 0x95, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0x12, 0x00, 0x96, 0x42, 0x7d, 0x6c, 0x96, 0x42, 0x42, 0x31, 0x00, 0x00,
+        0xb2, 0x72, 0x96, 0x42, 0x03, 0x4c, 0x97, 0x42, 0x43, 0x31, 0x00, 0x00, 0xb2, 0x72, 0x96, 0x42,
+        0x98, 0xff, 0x98, 0x42, 0x34, 0x31, 0x01, 0x00, 0x94, 0xca, 0x97, 0x42, 0x8c, 0x00, 0x98, 0x42,
+        0x3b, 0x31, 0x00, 0x00, 0xe4, 0x03, 0x98, 0x42, 0xdc, 0x39, 0x98, 0x42, 0x3b, 0x31, 0x00, 0x00,
+        0x34, 0x3d, 0x98, 0x42, 0x6a, 0x83, 0x99, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x75, 0x22, 0x99, 0x42,
+        0xf0, 0x62, 0x9d, 0x42, 0x32, 0x31, 0x01, 0x00, 0x16, 0x95, 0x99, 0x42, 0x81, 0x01, 0x9a, 0x42,
+        0x39, 0x31, 0x00, 0x00, 0xb6, 0x07, 0x9a, 0x42, 0x22, 0x74, 0x9a, 0x42, 0x3b, 0x31, 0x00, 0x00,
+        0x57, 0x7a, 0x9a, 0x42, 0x72, 0x2d, 0x9c, 0x42, 0x39, 0x31, 0x00, 0x00, 0x7a, 0xb7, 0x9c, 0x42,
+        0xe5, 0x23, 0x9d, 0x42, 0x40, 0x31, 0x00, 0x00, 0x1a, 0x2a, 0x9d, 0x42, 0x85, 0x96, 0x9d, 0x42,
+        0x42, 0x31, 0x00, 0x00, 0xbb, 0x9c, 0x9d, 0x42, 0x0b, 0x76, 0x9e, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0xbb, 0x9c, 0x9d, 0x42, 0x95, 0x6a, 0xa4, 0x42, 0x30, 0x31, 0x01, 0x00, 0xfc, 0x81, 0x9e, 0x42,
+        0x17, 0x35, 0xa0, 0x42, 0x42, 0x31, 0x00, 0x00, 0x7e, 0x4c, 0xa0, 0x42, 0xe9, 0xb8, 0xa0, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0x1e, 0xbf, 0xa0, 0x42, 0x89, 0x2b, 0xa1, 0x42, 0x42, 0x31, 0x00, 0x00,
+        0xbf, 0x31, 0xa1, 0x42, 0x9d, 0xd4, 0xa1, 0x42, 0x43, 0x31, 0x00, 0x00, 0xb0, 0xdd, 0xa1, 0x42,
+        0x1b, 0x4a, 0xa2, 0x42, 0x42, 0x31, 0x00, 0x00, 0x50, 0x50, 0xa2, 0x42, 0x49, 0x86, 0xa2, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0xa1, 0x89, 0xa2, 0x42, 0x99, 0xbf, 0xa2, 0x42, 0x3e, 0x31, 0x00, 0x00,
+        0xf1, 0xc2, 0xa2, 0x42, 0x41, 0x9c, 0xa3, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x82, 0xe1, 0xa3, 0x42,
+        0xed, 0x4d, 0xa4, 0x42, 0x40, 0x31, 0x00, 0x00, 0x23, 0x54, 0xa4, 0x42, 0x8e, 0xc0, 0xa4, 0x42,
+        0x42, 0x31, 0x00, 0x00, 0xc3, 0xc6, 0xa4, 0x42, 0x14, 0xa0, 0xa5, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0xc3, 0xc6, 0xa4, 0x42, 0xa9, 0x53, 0xa7, 0x42, 0x34, 0x31, 0x01, 0x00, 0x04, 0xac, 0xa5, 0x42,
+        0x1f, 0x5f, 0xa7, 0x42, 0x42, 0x31, 0x00, 0x00, 0x86, 0x76, 0xa7, 0x42, 0xf1, 0xe2, 0xa7, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0x86, 0x76, 0xa7, 0x42, 0x01, 0xb7, 0xab, 0x42, 0x32, 0x31, 0x01, 0x00,
+        0x27, 0xe9, 0xa7, 0x42, 0x92, 0x55, 0xa8, 0x42, 0x42, 0x31, 0x00, 0x00, 0xc7, 0x5b, 0xa8, 0x42,
+        0xa5, 0xfe, 0xa8, 0x42, 0x43, 0x31, 0x00, 0x00, 0xb8, 0x07, 0xa9, 0x42, 0x23, 0x74, 0xa9, 0x42,
+        0x42, 0x31, 0x00, 0x00, 0x59, 0x7a, 0xa9, 0x42, 0x51, 0xb0, 0xa9, 0x42, 0x40, 0x31, 0x00, 0x00,
+        0xa9, 0xb3, 0xa9, 0x42, 0xa1, 0xe9, 0xa9, 0x42, 0x3e, 0x31, 0x00, 0x00, 0xf9, 0xec, 0xa9, 0x42,
+        0x4a, 0xc6, 0xaa, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x8b, 0x0b, 0xab, 0x42, 0xf6, 0x77, 0xab, 0x42,
+        0x40, 0x31, 0x00, 0x00, 0x2b, 0x7e, 0xab, 0x42, 0x96, 0xea, 0xab, 0x42, 0x42, 0x31, 0x00, 0x00,
+        0xcc, 0xf0, 0xab, 0x42, 0x1c, 0xca, 0xac, 0x42, 0x43, 0x31, 0x00, 0x00, 0xcc, 0xf0, 0xab, 0x42,
+        0xa6, 0xbe, 0xb2, 0x42, 0x30, 0x31, 0x01, 0x00, 0x0d, 0xd6, 0xac, 0x42, 0x28, 0x89, 0xae, 0x42,
+        0x45, 0x31, 0x00, 0x00, 0x8f, 0xa0, 0xae, 0x42, 0xfa, 0x0c, 0xaf, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x2f, 0x13, 0xaf, 0x42, 0x9a, 0x7f, 0xaf, 0x42, 0x45, 0x31, 0x00, 0x00, 0xd0, 0x85, 0xaf, 0x42,
+        0xae, 0x28, 0xb0, 0x42, 0x47, 0x31, 0x00, 0x00, 0xc1, 0x31, 0xb0, 0x42, 0x2c, 0x9e, 0xb0, 0x42,
+        0x45, 0x31, 0x00, 0x00, 0x61, 0xa4, 0xb0, 0x42, 0x5a, 0xda, 0xb0, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0xb2, 0xdd, 0xb0, 0x42, 0xaa, 0x13, 0xb1, 0x42, 0x42, 0x31, 0x00, 0x00, 0x02, 0x17, 0xb1, 0x42,
+        0x52, 0xf0, 0xb1, 0x42, 0x40, 0x31, 0x00, 0x00, 0x93, 0x35, 0xb2, 0x42, 0xfe, 0xa1, 0xb2, 0x42,
+        0x43, 0x31, 0x00, 0x00, 0x34, 0xa8, 0xb2, 0x42, 0x9f, 0x14, 0xb3, 0x42, 0x45, 0x31, 0x00, 0x00,
+        0xd4, 0x1a, 0xb3, 0x42, 0x25, 0xf4, 0xb3, 0x42, 0x47, 0x31, 0x00, 0x00, 0xd4, 0x1a, 0xb3, 0x42,
+        0xba, 0xa7, 0xb5, 0x42, 0x34, 0x31, 0x01, 0x00, 0xb6, 0x72, 0xb4, 0x42, 0xae, 0xa8, 0xb4, 0x42,
+        0x45, 0x31, 0x00, 0x00, 0x06, 0xac, 0xb4, 0x42, 0xfe, 0xe1, 0xb4, 0x42, 0x45, 0x31, 0x00, 0x00,
+        0x56, 0xe5, 0xb4, 0x42, 0x8c, 0x2b, 0xb6, 0x42, 0x45, 0x31, 0x00, 0x00, 0x97, 0xca, 0xb5, 0x42,
+        0x12, 0x0b, 0xba, 0x42, 0x32, 0x31, 0x01, 0x00, 0x38, 0x3d, 0xb6, 0x42, 0xa3, 0xa9, 0xb6, 0x42,
+        0x43, 0x31, 0x00, 0x00, 0xd8, 0xaf, 0xb6, 0x42, 0x43, 0x1c, 0xb7, 0x42, 0x43, 0x31, 0x00, 0x00,
+        0x79, 0x22, 0xb7, 0x42, 0xc9, 0xfb, 0xb7, 0x42, 0x45, 0x31, 0x00, 0x00, 0xba, 0x07, 0xb8, 0x42,
+        0xb2, 0x3d, 0xb8, 0x42, 0x45, 0x31, 0x00, 0x00, 0x0a, 0x41, 0xb8, 0x42, 0x03, 0x77, 0xb8, 0x42,
+        0x45, 0x40, 0x00, 0x00, 0x5b, 0x7a, 0xb8, 0x42, 0xab, 0x53, 0xb9, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0x9c, 0x5f, 0xb9, 0x42, 0xec, 0x38, 0xba, 0x42, 0x43, 0x40, 0x00, 0x00, 0xdd, 0x44, 0xba, 0x42,
+        0x12, 0x8b, 0xbb, 0x42, 0x48, 0x40, 0x00, 0x00, 0xdd, 0x44, 0xba, 0x42, 0xb7, 0x12, 0xc1, 0x42,
+        0x30, 0x40, 0x01, 0x00, 0xbe, 0x9c, 0xbb, 0x42, 0x54, 0x70, 0xbf, 0x42, 0x47, 0x40, 0x00, 0x00,
+        0x63, 0xa4, 0xbf, 0x42, 0xb3, 0x7d, 0xc0, 0x42, 0x45, 0x40, 0x00, 0x00, 0xa4, 0x89, 0xc0, 0x42,
+        0xf4, 0x62, 0xc1, 0x42, 0x43, 0x40, 0x00, 0x00, 0xe5, 0x6e, 0xc1, 0x42, 0x1b, 0xb5, 0xc2, 0x42,
+        0x48, 0x40, 0x00, 0x00, 0xe5, 0x6e, 0xc1, 0x42, 0xcb, 0xfb, 0xc3, 0x42, 0x34, 0x40, 0x01, 0x00,
+        0xc7, 0xc6, 0xc2, 0x42, 0x17, 0xa0, 0xc3, 0x42, 0x47, 0x40, 0x00, 0x00, 0x08, 0xac, 0xc3, 0x42,
+        0x73, 0x18, 0xc4, 0x42, 0x45, 0x40, 0x00, 0x00, 0xa8, 0x1e, 0xc4, 0x42, 0xa9, 0x3e, 0xc6, 0x42,
+        0x42, 0x40, 0x00, 0x00, 0xa8, 0x1e, 0xc4, 0x42, 0x23, 0x5f, 0xc8, 0x42, 0x32, 0x40, 0x01, 0x00,
+        0xcb, 0x5b, 0xc6, 0x42, 0xc3, 0x91, 0xc6, 0x42, 0x45, 0x40, 0x00, 0x00, 0x1b, 0x95, 0xc6, 0x42,
+        0x14, 0xcb, 0xc6, 0x42, 0x45, 0x40, 0x00, 0x00, 0x6c, 0xce, 0xc6, 0x42, 0xbc, 0xa7, 0xc7, 0x42,
+        0x45, 0x40, 0x00, 0x00, 0xad, 0xb3, 0xc7, 0x42, 0xfd, 0x8c, 0xc8, 0x42, 0x43, 0x40, 0x00, 0x00,
+        0xee, 0x98, 0xc8, 0x42, 0x23, 0xdf, 0xc9, 0x42, 0x48, 0x40, 0x00, 0x00, 0xee, 0x98, 0xc8, 0x42,
+        0xc8, 0x66, 0xcf, 0x42, 0x30, 0x40, 0x01, 0x00, 0xcf, 0xf0, 0xc9, 0x42, 0x65, 0xc4, 0xcd, 0x42,
+        0x47, 0x40, 0x00, 0x00, 0x74, 0xf8, 0xcd, 0x42, 0xc4, 0xd1, 0xce, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0xb5, 0xdd, 0xce, 0x42, 0x05, 0xb7, 0xcf, 0x42, 0x43, 0x40, 0x00, 0x00, 0xf6, 0xc2, 0xcf, 0x42,
+        0x2c, 0x09, 0xd1, 0x42, 0x48, 0x40, 0x00, 0x00, 0xf6, 0xc2, 0xcf, 0x42, 0xdc, 0x4f, 0xd2, 0x42,
+        0x34, 0x40, 0x01, 0x00, 0xd8, 0x1a, 0xd1, 0x42, 0x28, 0xf4, 0xd1, 0x42, 0x47, 0x40, 0x00, 0x00,
+        0x19, 0x00, 0xd2, 0x42, 0x84, 0x6c, 0xd2, 0x42, 0x45, 0x40, 0x00, 0x00, 0xb9, 0x72, 0xd2, 0x42,
+        0xba, 0x92, 0xd4, 0x42, 0x42, 0x40, 0x00, 0x00, 0xb9, 0x72, 0xd2, 0x42, 0x9f, 0xff, 0xd4, 0x42,
+        0x32, 0x40, 0x01, 0x00, 0xdc, 0xaf, 0xd4, 0x42, 0xd4, 0xe5, 0xd4, 0x42, 0x45, 0x40, 0x00, 0x00,
+        0x2c, 0xe9, 0xd4, 0x42, 0x25, 0x1f, 0xd5, 0x42, 0x45, 0x40, 0x00, 0x00, 0x7c, 0x22, 0xd5, 0x42,
+        0xcd, 0xfb, 0xd5, 0x42, 0x45, 0x40, 0x00, 0x00, 0xbe, 0x07, 0xd6, 0x42, 0x0e, 0xe1, 0xd6, 0x42,
+        0x43, 0x40, 0x00, 0x00, 0xff, 0xec, 0xd6, 0x42, 0x4f, 0xc6, 0xd7, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xff, 0xec, 0xd6, 0x42, 0xe4, 0x79, 0xd9, 0x42, 0x30, 0x50, 0x01, 0x00, 0x40, 0xd2, 0xd7, 0x42,
+        0xab, 0x3e, 0xd8, 0x42, 0x47, 0x50, 0x00, 0x00, 0xe0, 0x44, 0xd8, 0x42, 0x4b, 0xb1, 0xd8, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x81, 0xb7, 0xd8, 0x42, 0xd1, 0x90, 0xd9, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xc2, 0x9c, 0xd9, 0x42, 0x12, 0x76, 0xda, 0x42, 0x47, 0x50, 0x00, 0x00, 0xc2, 0x9c, 0xd9, 0x42,
+        0xdd, 0x4f, 0xdb, 0x42, 0x30, 0x50, 0x01, 0x00, 0xa3, 0xf4, 0xda, 0x42, 0xf4, 0xcd, 0xdb, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x44, 0x67, 0xdb, 0x42, 0x29, 0xf4, 0xdd, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0xe4, 0xd9, 0xdb, 0x42, 0x4f, 0x46, 0xdc, 0x42, 0x47, 0x50, 0x00, 0x00, 0x85, 0x4c, 0xdc, 0x42,
+        0xf0, 0xb8, 0xdc, 0x42, 0x45, 0x50, 0x00, 0x00, 0x26, 0xbf, 0xdc, 0x42, 0x91, 0x2b, 0xdd, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xc6, 0x31, 0xdd, 0x42, 0x16, 0x0b, 0xde, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x07, 0x17, 0xde, 0x42, 0x57, 0xf0, 0xde, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x07, 0x17, 0xde, 0x42,
+        0xed, 0xa3, 0xe0, 0x42, 0x34, 0x50, 0x01, 0x00, 0x48, 0xfc, 0xde, 0x42, 0xb3, 0x68, 0xdf, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xe9, 0x6e, 0xdf, 0x42, 0x54, 0xdb, 0xdf, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x89, 0xe1, 0xdf, 0x42, 0xda, 0xba, 0xe0, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xca, 0xc6, 0xe0, 0x42,
+        0x1b, 0xa0, 0xe1, 0x42, 0x47, 0x50, 0x00, 0x00, 0xca, 0xc6, 0xe0, 0x42, 0xe5, 0x79, 0xe2, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xac, 0x1e, 0xe2, 0x42, 0xfc, 0xf7, 0xe2, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x4c, 0x91, 0xe2, 0x42, 0x32, 0x1e, 0xe5, 0x42, 0x32, 0x50, 0x01, 0x00, 0xed, 0x03, 0xe3, 0x42,
+        0x58, 0x70, 0xe3, 0x42, 0x47, 0x50, 0x00, 0x00, 0x8d, 0x76, 0xe3, 0x42, 0xf8, 0xe2, 0xe3, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x2e, 0xe9, 0xe3, 0x42, 0x99, 0x55, 0xe4, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xcf, 0x5b, 0xe4, 0x42, 0x1f, 0x35, 0xe5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x10, 0x41, 0xe5, 0x42,
+        0x60, 0x1a, 0xe6, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x10, 0x41, 0xe5, 0x42, 0xf5, 0xcd, 0xe7, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x51, 0x26, 0xe6, 0x42, 0xbc, 0x92, 0xe6, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xf1, 0x98, 0xe6, 0x42, 0x5c, 0x05, 0xe7, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x92, 0x0b, 0xe7, 0x42,
+        0xe2, 0xe4, 0xe7, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xd3, 0xf0, 0xe7, 0x42, 0x23, 0xca, 0xe8, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0xd3, 0xf0, 0xe7, 0x42, 0xee, 0xa3, 0xe9, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0xb4, 0x48, 0xe9, 0x42, 0x05, 0x22, 0xea, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x55, 0xbb, 0xe9, 0x42,
+        0x3a, 0x48, 0xec, 0x42, 0x30, 0x50, 0x01, 0x00, 0xf5, 0x2d, 0xea, 0x42, 0x60, 0x9a, 0xea, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x96, 0xa0, 0xea, 0x42, 0x01, 0x0d, 0xeb, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x36, 0x13, 0xeb, 0x42, 0xa2, 0x7f, 0xeb, 0x42, 0x47, 0x50, 0x00, 0x00, 0xd7, 0x85, 0xeb, 0x42,
+        0x27, 0x5f, 0xec, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x18, 0x6b, 0xec, 0x42, 0x68, 0x44, 0xed, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x18, 0x6b, 0xec, 0x42, 0xfe, 0xf7, 0xee, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x59, 0x50, 0xed, 0x42, 0xc4, 0xbc, 0xed, 0x42, 0x47, 0x50, 0x00, 0x00, 0xfa, 0xc2, 0xed, 0x42,
+        0x65, 0x2f, 0xee, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x9a, 0x35, 0xee, 0x42, 0xeb, 0x0e, 0xef, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xdb, 0x1a, 0xef, 0x42, 0x2c, 0xf4, 0xef, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xdb, 0x1a, 0xef, 0x42, 0xf6, 0xcd, 0xf0, 0x42, 0x32, 0x50, 0x01, 0x00, 0xbd, 0x72, 0xf0, 0x42,
+        0x0d, 0x4c, 0xf1, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x5d, 0xe5, 0xf0, 0x42, 0x43, 0x72, 0xf3, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0xfe, 0x57, 0xf1, 0x42, 0x69, 0xc4, 0xf1, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x9e, 0xca, 0xf1, 0x42, 0x09, 0x37, 0xf2, 0x42, 0x48, 0x50, 0x00, 0x00, 0x3f, 0x3d, 0xf2, 0x42,
+        0xaa, 0xa9, 0xf2, 0x42, 0x47, 0x50, 0x00, 0x00, 0xdf, 0xaf, 0xf2, 0x42, 0x30, 0x89, 0xf3, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x21, 0x95, 0xf3, 0x42, 0xfe, 0x37, 0xf4, 0x42, 0x3b, 0x31, 0x00, 0x00,
+        0x21, 0x95, 0xf3, 0x42, 0xfb, 0x62, 0xfa, 0x42, 0x30, 0x31, 0x01, 0x00, 0x11, 0x41, 0xf4, 0x42,
+        0xef, 0xe3, 0xf4, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x02, 0xed, 0xf4, 0x42, 0x6d, 0x59, 0xf5, 0x42,
+        0x3e, 0x31, 0x00, 0x00, 0xa3, 0x5f, 0xf5, 0x42, 0xf3, 0x38, 0xf6, 0x42, 0x3e, 0x31, 0x00, 0x00,
+        0xe4, 0x44, 0xf6, 0x42, 0x4f, 0xb1, 0xf6, 0x42, 0x43, 0x31, 0x00, 0x00, 0x84, 0xb7, 0xf6, 0x42,
+        0x1a, 0x8b, 0xfa, 0x42, 0x43, 0x31, 0x00, 0x00, 0x29, 0xbf, 0xfa, 0x42, 0x07, 0x62, 0xfb, 0x42,
+        0x3b, 0x31, 0x00, 0x00, 0x29, 0xbf, 0xfa, 0x42, 0x0f, 0x4c, 0xfd, 0x42, 0x34, 0x31, 0x01, 0x00,
+        0x1a, 0x6b, 0xfb, 0x42, 0xf8, 0x0d, 0xfc, 0x42, 0x3b, 0x31, 0x00, 0x00, 0x0b, 0x17, 0xfc, 0x42,
+        0x76, 0x83, 0xfc, 0x42, 0x3e, 0x31, 0x00, 0x00, 0xab, 0x89, 0xfc, 0x42, 0xfc, 0x62, 0xfd, 0x42,
+        0x3e, 0x31, 0x00, 0x00, 0xec, 0x6e, 0xfd, 0x42, 0x57, 0xdb, 0xfd, 0x42, 0x47, 0x31, 0x00, 0x00,
+        0xec, 0x6e, 0xfd, 0x42, 0xb3, 0xd7, 0x00, 0x43, 0x32, 0x31, 0x01, 0x00, 0x8d, 0xe1, 0xfd, 0x42,
+        0xc2, 0x27, 0xff, 0x42, 0x47, 0x31, 0x00, 0x00, 0x6e, 0x39, 0xff, 0x42, 0x2a, 0xe3, 0x00, 0x43,
+        0x45, 0x31, 0x00, 0x00, 0x99, 0xf4, 0x00, 0x43, 0x08, 0x46, 0x01, 0x43, 0x47, 0x31, 0x00, 0x00,
+        0x99, 0xf4, 0x00, 0x43, 0x86, 0x5b, 0x04, 0x43, 0x30, 0x31, 0x01, 0x00, 0x91, 0x4a, 0x01, 0x43,
+        0x00, 0x9c, 0x01, 0x43, 0x47, 0x31, 0x00, 0x00, 0x8a, 0xa0, 0x01, 0x43, 0xbf, 0xd6, 0x01, 0x43,
+        0x4a, 0x31, 0x00, 0x00, 0xda, 0xd9, 0x01, 0x43, 0x82, 0x46, 0x02, 0x43, 0x4a, 0x31, 0x00, 0x00,
+        0x7a, 0x4c, 0x02, 0x43, 0xb0, 0x82, 0x02, 0x43, 0x4c, 0x31, 0x00, 0x00, 0xcb, 0x85, 0x02, 0x43,
+        0xe5, 0x28, 0x03, 0x43, 0x4c, 0x31, 0x00, 0x00, 0xbb, 0x31, 0x03, 0x43, 0x49, 0x0b, 0x04, 0x43,
+        0x4a, 0x31, 0x00, 0x00, 0x4d, 0x50, 0x04, 0x43, 0x49, 0x6b, 0x04, 0x43, 0x4c, 0x31, 0x00, 0x00,
+        0xf5, 0x6c, 0x04, 0x43, 0xf1, 0x87, 0x04, 0x43, 0x4c, 0x31, 0x00, 0x00, 0x9d, 0x89, 0x04, 0x43,
+        0xb8, 0x2c, 0x05, 0x43, 0x4c, 0x31, 0x00, 0x00, 0x9d, 0x89, 0x04, 0x43, 0x10, 0xd0, 0x05, 0x43,
+        0x34, 0x31, 0x01, 0x00, 0x8e, 0x35, 0x05, 0x43, 0x8a, 0x50, 0x05, 0x43, 0x4a, 0x31, 0x00, 0x00,
+        0x36, 0x52, 0x05, 0x43, 0x32, 0x6d, 0x05, 0x43, 0x4a, 0x31, 0x00, 0x00, 0xde, 0x6e, 0x05, 0x43,
+        0xf9, 0x11, 0x06, 0x43, 0x4a, 0x31, 0x00, 0x00, 0x7f, 0xe1, 0x05, 0x43, 0xbc, 0x01, 0x08, 0x43,
+        0x32, 0x31, 0x01, 0x00, 0xcf, 0x1a, 0x06, 0x43, 0x04, 0x51, 0x06, 0x43, 0x47, 0x31, 0x00, 0x00,
+        0x1f, 0x54, 0x06, 0x43, 0xc7, 0xc0, 0x06, 0x43, 0x47, 0x31, 0x00, 0x00, 0xc0, 0xc6, 0x06, 0x43,
+        0x32, 0x0d, 0x08, 0x43, 0x45, 0x31, 0x00, 0x00, 0xa1, 0x1e, 0x08, 0x43, 0x10, 0x70, 0x08, 0x43,
+        0x3b, 0x31, 0x00, 0x00, 0xa1, 0x1e, 0x08, 0x43, 0x8f, 0x85, 0x0b, 0x43, 0x30, 0x31, 0x01, 0x00,
+        0x9a, 0x74, 0x08, 0x43, 0x08, 0xc6, 0x08, 0x43, 0x3b, 0x31, 0x00, 0x00, 0x92, 0xca, 0x08, 0x43,
+        0xc8, 0x00, 0x09, 0x43, 0x3e, 0x31, 0x00, 0x00, 0xe2, 0x03, 0x09, 0x43, 0x8a, 0x70, 0x09, 0x43,
+        0x3e, 0x31, 0x00, 0x00, 0x83, 0x76, 0x09, 0x43, 0xb8, 0xac, 0x09, 0x43, 0x43, 0x31, 0x00, 0x00,
+        0xd3, 0xaf, 0x09, 0x43, 0x9e, 0x99, 0x0b, 0x43, 0x43, 0x31, 0x00, 0x00, 0xa5, 0xb3, 0x0b, 0x43,
+        0x14, 0x05, 0x0c, 0x43, 0x3b, 0x31, 0x00, 0x00, 0xa5, 0xb3, 0x0b, 0x43, 0x18, 0xfa, 0x0c, 0x43,
+        0x34, 0x31, 0x01, 0x00, 0x9e, 0x09, 0x0c, 0x43, 0x0d, 0x5b, 0x0c, 0x43, 0x3b, 0x31, 0x00, 0x00,
+        0x96, 0x5f, 0x0c, 0x43, 0xcc, 0x95, 0x0c, 0x43, 0x3e, 0x31, 0x00, 0x00, 0xe7, 0x98, 0x0c, 0x43,
+        0x8f, 0x05, 0x0d, 0x43, 0x3e, 0x31, 0x00, 0x00, 0x87, 0x0b, 0x0d, 0x43, 0xbd, 0x41, 0x0d, 0x43,
+        0x47, 0x31, 0x00, 0x00, 0x87, 0x0b, 0x0d, 0x43, 0xc4, 0x2b, 0x0f, 0x43, 0x32, 0x31, 0x01, 0x00,
+        0xd7, 0x44, 0x0d, 0x43, 0xf2, 0xe7, 0x0d, 0x43, 0x47, 0x31, 0x00, 0x00, 0xc8, 0xf0, 0x0d, 0x43,
+        0x3b, 0x37, 0x0f, 0x43, 0x45, 0x31, 0x00, 0x00, 0xaa, 0x48, 0x0f, 0x43, 0x19, 0x9a, 0x0f, 0x43,
+        0x47, 0x31, 0x00, 0x00, 0xaa, 0x48, 0x0f, 0x43, 0x97, 0xaf, 0x12, 0x43, 0x30, 0x31, 0x01, 0x00,
+        0xa2, 0x9e, 0x0f, 0x43, 0x11, 0xf0, 0x0f, 0x43, 0x47, 0x31, 0x00, 0x00, 0x9b, 0xf4, 0x0f, 0x43,
+        0xd0, 0x2a, 0x10, 0x43, 0x4a, 0x31, 0x00, 0x00, 0xeb, 0x2d, 0x10, 0x43, 0x93, 0x9a, 0x10, 0x43,
+        0x4a, 0x31, 0x00, 0x00, 0x8b, 0xa0, 0x10, 0x43, 0xc1, 0xd6, 0x10, 0x43, 0x4c, 0x31, 0x00, 0x00,
+        0xdc, 0xd9, 0x10, 0x43, 0xf6, 0x7c, 0x11, 0x43, 0x4c, 0x31, 0x00, 0x00, 0xcc, 0x85, 0x11, 0x43,
+        0x5a, 0x5f, 0x12, 0x43, 0x4a, 0x31, 0x00, 0x00, 0x5e, 0xa4, 0x12, 0x43, 0x5a, 0xbf, 0x12, 0x43,
+        0x4c, 0x31, 0x00, 0x00, 0x06, 0xc1, 0x12, 0x43, 0x02, 0xdc, 0x12, 0x43, 0x4c, 0x31, 0x00, 0x00,
+        0xae, 0xdd, 0x12, 0x43, 0xc9, 0x80, 0x13, 0x43, 0x4c, 0x31, 0x00, 0x00, 0xae, 0xdd, 0x12, 0x43,
+        0x21, 0x24, 0x14, 0x43, 0x34, 0x31, 0x01, 0x00, 0x9f, 0x89, 0x13, 0x43, 0x9b, 0xa4, 0x13, 0x43,
+        0x4a, 0x31, 0x00, 0x00, 0x47, 0xa6, 0x13, 0x43, 0x43, 0xc1, 0x13, 0x43, 0x4a, 0x31, 0x00, 0x00,
+        0xef, 0xc2, 0x13, 0x43, 0x0a, 0x66, 0x14, 0x43, 0x4a, 0x31, 0x00, 0x00, 0x90, 0x35, 0x14, 0x43,
+        0xcd, 0x55, 0x16, 0x43, 0x32, 0x31, 0x01, 0x00, 0xe0, 0x6e, 0x14, 0x43, 0x15, 0xa5, 0x14, 0x43,
+        0x47, 0x31, 0x00, 0x00, 0x30, 0xa8, 0x14, 0x43, 0x4b, 0x4b, 0x15, 0x43, 0x47, 0x31, 0x00, 0x00,
+        0x21, 0x54, 0x15, 0x43, 0x1d, 0x6f, 0x15, 0x43, 0x45, 0x31, 0x00, 0x00, 0xc9, 0x70, 0x15, 0x43,
+        0xc5, 0x8b, 0x15, 0x43, 0x45, 0x31, 0x00, 0x00, 0x71, 0x8d, 0x15, 0x43, 0x19, 0xfa, 0x15, 0x43,
+        0x45, 0x31, 0x00, 0x00, 0x12, 0x00, 0x16, 0x43, 0xba, 0x6c, 0x16, 0x43, 0x43, 0x31, 0x00, 0x00,
+        0xb2, 0x72, 0x16, 0x43, 0xcd, 0x15, 0x17, 0x43, 0x48, 0x31, 0x00, 0x00, 0xb2, 0x72, 0x16, 0x43,
+        0xa0, 0xd9, 0x19, 0x43, 0x30, 0x31, 0x01, 0x00, 0xa3, 0x1e, 0x17, 0x43, 0x6e, 0x08, 0x19, 0x43,
+        0x47, 0x31, 0x00, 0x00, 0x75, 0x22, 0x19, 0x43, 0x1e, 0x8f, 0x19, 0x43, 0x45, 0x31, 0x00, 0x00,
+        0x16, 0x95, 0x19, 0x43, 0xbe, 0x01, 0x1a, 0x43, 0x43, 0x31, 0x00, 0x00, 0xb6, 0x07, 0x1a, 0x43,
+        0xd1, 0xaa, 0x1a, 0x43, 0x48, 0x31, 0x00, 0x00, 0xb6, 0x07, 0x1a, 0x43, 0x29, 0x4e, 0x1b, 0x43,
+        0x34, 0x31, 0x01, 0x00, 0xa7, 0xb3, 0x1a, 0x43, 0x4f, 0x20, 0x1b, 0x43, 0x47, 0x31, 0x00, 0x00,
+        0x48, 0x26, 0x1b, 0x43, 0x7d, 0x5c, 0x1b, 0x43, 0x45, 0x31, 0x00, 0x00, 0x98, 0x5f, 0x1b, 0x43,
+        0x98, 0x6f, 0x1c, 0x43, 0x42, 0x31, 0x00, 0x00, 0x98, 0x5f, 0x1b, 0x43, 0xd5, 0x7f, 0x1d, 0x43,
+        0x32, 0x31, 0x01, 0x00, 0x29, 0x7e, 0x1c, 0x43, 0x26, 0x99, 0x1c, 0x43, 0x45, 0x31, 0x00, 0x00,
+        0xd2, 0x9a, 0x1c, 0x43, 0xce, 0xb5, 0x1c, 0x43, 0x45, 0x31, 0x00, 0x00, 0x7a, 0xb7, 0x1c, 0x43,
+        0x22, 0x24, 0x1d, 0x43, 0x45, 0x31, 0x00, 0x00, 0x1a, 0x2a, 0x1d, 0x43, 0xc2, 0x96, 0x1d, 0x43,
+        0x43, 0x31, 0x00, 0x00, 0xbb, 0x9c, 0x1d, 0x43, 0xd6, 0x3f, 0x1e, 0x43, 0x48, 0x31, 0x00, 0x00,
+        0xbb, 0x9c, 0x1d, 0x43, 0xa8, 0x03, 0x21, 0x43, 0x30, 0x31, 0x01, 0x00, 0xac, 0x48, 0x1e, 0x43,
+        0x76, 0x32, 0x20, 0x43, 0x47, 0x31, 0x00, 0x00, 0x7e, 0x4c, 0x20, 0x43, 0x26, 0xb9, 0x20, 0x43,
+        0x45, 0x31, 0x00, 0x00, 0x1e, 0xbf, 0x20, 0x43, 0xc7, 0x2b, 0x21, 0x43, 0x43, 0x31, 0x00, 0x00,
+        0xbf, 0x31, 0x21, 0x43, 0xda, 0xd4, 0x21, 0x43, 0x48, 0x31, 0x00, 0x00, 0xbf, 0x31, 0x21, 0x43,
+        0x32, 0x78, 0x22, 0x43, 0x34, 0x31, 0x01, 0x00, 0xb0, 0xdd, 0x21, 0x43, 0x58, 0x4a, 0x22, 0x43,
+        0x47, 0x3c, 0x00, 0x00, 0x50, 0x50, 0x22, 0x43, 0x86, 0x86, 0x22, 0x43, 0x45, 0x44, 0x00, 0x00,
+        0xa1, 0x89, 0x22, 0x43, 0xa1, 0x99, 0x23, 0x43, 0x42, 0x48, 0x00, 0x00, 0xa1, 0x89, 0x22, 0x43,
+        0x13, 0xd0, 0x23, 0x43, 0x32, 0x48, 0x01, 0x00, 0x32, 0xa8, 0x23, 0x43, 0x2e, 0xc3, 0x23, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0xda, 0xc4, 0x23, 0x43, 0xd6, 0xdf, 0x23, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x82, 0xe1, 0x23, 0x43, 0x2a, 0x4e, 0x24, 0x43, 0x45, 0x50, 0x00, 0x00, 0x23, 0x54, 0x24, 0x43,
+        0xcb, 0xc0, 0x24, 0x43, 0x43, 0x50, 0x00, 0x00, 0xc3, 0xc6, 0x24, 0x43, 0x6b, 0x33, 0x25, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xc3, 0xc6, 0x24, 0x43, 0x36, 0x0d, 0x26, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x64, 0x39, 0x25, 0x43, 0x99, 0x6f, 0x25, 0x43, 0x47, 0x50, 0x00, 0x00, 0xb4, 0x72, 0x25, 0x43,
+        0xea, 0xa8, 0x25, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x04, 0xac, 0x25, 0x43, 0xac, 0x18, 0x26, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xa5, 0x1e, 0x26, 0x43, 0x4d, 0x8b, 0x26, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0xa5, 0x1e, 0x26, 0x43, 0x32, 0xf8, 0x26, 0x43, 0x30, 0x50, 0x01, 0x00, 0x96, 0xca, 0x26, 0x43,
+        0x3e, 0x37, 0x27, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xe6, 0x03, 0x27, 0x43, 0x59, 0x4a, 0x28, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x36, 0x3d, 0x27, 0x43, 0x6c, 0x73, 0x27, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x86, 0x76, 0x27, 0x43, 0xbc, 0xac, 0x27, 0x43, 0x45, 0x50, 0x00, 0x00, 0xd7, 0xaf, 0x27, 0x43,
+        0x0c, 0xe6, 0x27, 0x43, 0x47, 0x50, 0x00, 0x00, 0x27, 0xe9, 0x27, 0x43, 0xcf, 0x55, 0x28, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xc7, 0x5b, 0x28, 0x43, 0x70, 0xc8, 0x28, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0xc7, 0x5b, 0x28, 0x43, 0x3a, 0xa2, 0x29, 0x43, 0x34, 0x50, 0x01, 0x00, 0x68, 0xce, 0x28, 0x43,
+        0x9d, 0x04, 0x29, 0x43, 0x47, 0x50, 0x00, 0x00, 0xb8, 0x07, 0x29, 0x43, 0xee, 0x3d, 0x29, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x09, 0x41, 0x29, 0x43, 0xb1, 0xad, 0x29, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0xa9, 0xb3, 0x29, 0x43, 0x51, 0x20, 0x2a, 0x43, 0x47, 0x50, 0x00, 0x00, 0xa9, 0xb3, 0x29, 0x43,
+        0x37, 0x8d, 0x2a, 0x43, 0x32, 0x50, 0x01, 0x00, 0x9a, 0x5f, 0x2a, 0x43, 0x42, 0xcc, 0x2a, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xea, 0x98, 0x2a, 0x43, 0x5d, 0xdf, 0x2b, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x3a, 0xd2, 0x2a, 0x43, 0x70, 0x08, 0x2b, 0x43, 0x47, 0x50, 0x00, 0x00, 0x8b, 0x0b, 0x2b, 0x43,
+        0xc0, 0x41, 0x2b, 0x43, 0x48, 0x50, 0x00, 0x00, 0xdb, 0x44, 0x2b, 0x43, 0x10, 0x7b, 0x2b, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x2b, 0x7e, 0x2b, 0x43, 0xd3, 0xea, 0x2b, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0xcc, 0xf0, 0x2b, 0x43, 0x74, 0x5d, 0x2c, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xcc, 0xf0, 0x2b, 0x43,
+        0x3e, 0x37, 0x2d, 0x43, 0x30, 0x50, 0x01, 0x00, 0x6c, 0x63, 0x2c, 0x43, 0xa2, 0x99, 0x2c, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0xbc, 0x9c, 0x2c, 0x43, 0xf2, 0xd2, 0x2c, 0x43, 0x4c, 0x50, 0x00, 0x00,
+        0x0d, 0xd6, 0x2c, 0x43, 0xb5, 0x42, 0x2d, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xad, 0x48, 0x2d, 0x43,
+        0x55, 0xb5, 0x2d, 0x43, 0x47, 0x50, 0x00, 0x00, 0xad, 0x48, 0x2d, 0x43, 0x3b, 0x22, 0x2e, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x9e, 0xf4, 0x2d, 0x43, 0x46, 0x61, 0x2e, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0xee, 0x2d, 0x2e, 0x43, 0x61, 0x74, 0x2f, 0x43, 0x30, 0x50, 0x01, 0x00, 0x3f, 0x67, 0x2e, 0x43,
+        0x74, 0x9d, 0x2e, 0x43, 0x47, 0x50, 0x00, 0x00, 0x8f, 0xa0, 0x2e, 0x43, 0xc4, 0xd6, 0x2e, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0xdf, 0xd9, 0x2e, 0x43, 0x15, 0x10, 0x2f, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x2f, 0x13, 0x2f, 0x43, 0xd8, 0x7f, 0x2f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xd0, 0x85, 0x2f, 0x43,
+        0x78, 0xf2, 0x2f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xd0, 0x85, 0x2f, 0x43, 0x43, 0xcc, 0x30, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x70, 0xf8, 0x2f, 0x43, 0xa6, 0x2e, 0x30, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0xc1, 0x31, 0x30, 0x43, 0xf6, 0x67, 0x30, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x11, 0x6b, 0x30, 0x43,
+        0xb9, 0xd7, 0x30, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xb2, 0xdd, 0x30, 0x43, 0x5a, 0x4a, 0x31, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0xb2, 0xdd, 0x30, 0x43, 0x3f, 0xb7, 0x31, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0xa2, 0x89, 0x31, 0x43, 0x4a, 0xf6, 0x31, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xf3, 0xc2, 0x31, 0x43,
+        0x65, 0x09, 0x33, 0x43, 0x32, 0x50, 0x01, 0x00, 0x43, 0xfc, 0x31, 0x43, 0x78, 0x32, 0x32, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x93, 0x35, 0x32, 0x43, 0xc9, 0x6b, 0x32, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0xe3, 0x6e, 0x32, 0x43, 0x19, 0xa5, 0x32, 0x43, 0x47, 0x50, 0x00, 0x00, 0x34, 0xa8, 0x32, 0x43,
+        0xdc, 0x14, 0x33, 0x43, 0x43, 0x50, 0x00, 0x00, 0xd4, 0x1a, 0x33, 0x43, 0x7c, 0x87, 0x33, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xd4, 0x1a, 0x33, 0x43, 0x47, 0x61, 0x34, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x75, 0x8d, 0x33, 0x43, 0xaa, 0xc3, 0x33, 0x43, 0x47, 0x50, 0x00, 0x00, 0xc5, 0xc6, 0x33, 0x43,
+        0xfa, 0xfc, 0x33, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x15, 0x00, 0x34, 0x43, 0xbd, 0x6c, 0x34, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xb6, 0x72, 0x34, 0x43, 0x5e, 0xdf, 0x34, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0xb6, 0x72, 0x34, 0x43, 0x43, 0x4c, 0x35, 0x43, 0x30, 0x50, 0x01, 0x00, 0xa7, 0x1e, 0x35, 0x43,
+        0x4f, 0x8b, 0x35, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xf7, 0x57, 0x35, 0x43, 0x6a, 0x9e, 0x36, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x47, 0x91, 0x35, 0x43, 0x7d, 0xc7, 0x35, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x97, 0xca, 0x35, 0x43, 0xcd, 0x00, 0x36, 0x43, 0x45, 0x50, 0x00, 0x00, 0xe8, 0x03, 0x36, 0x43,
+        0x1d, 0x3a, 0x36, 0x43, 0x47, 0x50, 0x00, 0x00, 0x38, 0x3d, 0x36, 0x43, 0xe0, 0xa9, 0x36, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xd8, 0xaf, 0x36, 0x43, 0x81, 0x1c, 0x37, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0xd8, 0xaf, 0x36, 0x43, 0x4b, 0xf6, 0x37, 0x43, 0x34, 0x50, 0x01, 0x00, 0x79, 0x22, 0x37, 0x43,
+        0xae, 0x58, 0x37, 0x43, 0x47, 0x50, 0x00, 0x00, 0xc9, 0x5b, 0x37, 0x43, 0xff, 0x91, 0x37, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x19, 0x95, 0x37, 0x43, 0xc2, 0x01, 0x38, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0xba, 0x07, 0x38, 0x43, 0x62, 0x74, 0x38, 0x43, 0x47, 0x50, 0x00, 0x00, 0xba, 0x07, 0x38, 0x43,
+        0x47, 0xe1, 0x38, 0x43, 0x32, 0x50, 0x01, 0x00, 0xab, 0xb3, 0x38, 0x43, 0x53, 0x20, 0x39, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xfb, 0xec, 0x38, 0x43, 0x6e, 0x33, 0x3a, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x4b, 0x26, 0x39, 0x43, 0x81, 0x5c, 0x39, 0x43, 0x47, 0x50, 0x00, 0x00, 0x9c, 0x5f, 0x39, 0x43,
+        0xd1, 0x95, 0x39, 0x43, 0x48, 0x50, 0x00, 0x00, 0xec, 0x98, 0x39, 0x43, 0x21, 0xcf, 0x39, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x3c, 0xd2, 0x39, 0x43, 0xe4, 0x3e, 0x3a, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0xdd, 0x44, 0x3a, 0x43, 0x85, 0xb1, 0x3a, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xdd, 0x44, 0x3a, 0x43,
+        0x4f, 0x8b, 0x3b, 0x43, 0x30, 0x50, 0x01, 0x00, 0x7d, 0xb7, 0x3a, 0x43, 0xb3, 0xed, 0x3a, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0xcd, 0xf0, 0x3a, 0x43, 0x03, 0x27, 0x3b, 0x43, 0x4c, 0x50, 0x00, 0x00,
+        0x1e, 0x2a, 0x3b, 0x43, 0xc6, 0x96, 0x3b, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xbe, 0x9c, 0x3b, 0x43,
+        0x66, 0x09, 0x3c, 0x43, 0x47, 0x50, 0x00, 0x00, 0xbe, 0x9c, 0x3b, 0x43, 0x4c, 0x76, 0x3c, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0xaf, 0x48, 0x3c, 0x43, 0x57, 0xb5, 0x3c, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0xff, 0x81, 0x3c, 0x43, 0x72, 0xc8, 0x3d, 0x43, 0x30, 0x50, 0x01, 0x00, 0x50, 0xbb, 0x3c, 0x43,
+        0x85, 0xf1, 0x3c, 0x43, 0x47, 0x50, 0x00, 0x00, 0xa0, 0xf4, 0x3c, 0x43, 0xd5, 0x2a, 0x3d, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0xf0, 0x2d, 0x3d, 0x43, 0x26, 0x64, 0x3d, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x40, 0x67, 0x3d, 0x43, 0xe9, 0xd3, 0x3d, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xe1, 0xd9, 0x3d, 0x43,
+        0x89, 0x46, 0x3e, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xe1, 0xd9, 0x3d, 0x43, 0x54, 0x20, 0x3f, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x81, 0x4c, 0x3e, 0x43, 0xb7, 0x82, 0x3e, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0xd2, 0x85, 0x3e, 0x43, 0x07, 0xbc, 0x3e, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x22, 0xbf, 0x3e, 0x43,
+        0xca, 0x2b, 0x3f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xc2, 0x31, 0x3f, 0x43, 0x6b, 0x9e, 0x3f, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0xc2, 0x31, 0x3f, 0x43, 0x50, 0x0b, 0x40, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0xb3, 0xdd, 0x3f, 0x43, 0x5b, 0x4a, 0x40, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x04, 0x17, 0x40, 0x43,
+        0xac, 0x83, 0x40, 0x43, 0x32, 0x50, 0x01, 0x00, 0x54, 0x50, 0x40, 0x43, 0x89, 0x86, 0x40, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0xa4, 0x89, 0x40, 0x43, 0xda, 0xbf, 0x40, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0xf4, 0xc2, 0x40, 0x43, 0x2a, 0xf9, 0x40, 0x43, 0x47, 0x50, 0x00, 0x00, 0x45, 0xfc, 0x40, 0x43,
+        0xed, 0x68, 0x41, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xb4, 0xc1, 0x3e,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xb4, 0xc1, 0x3e, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x37, 0xd0, 0x11, 0x40, 0x24, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x37, 0xd0, 0x11, 0x40, 0x30, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0xcc, 0x3e, 0xda, 0x40, 0x47, 0x3f,
+        0x3c, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x4c, 0x3f, 0xa0, 0xd3, 0x96, 0x3f, 0x40, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x4c, 0x3f, 0xa0, 0xd3, 0x96, 0x3f, 0x43, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x99, 0x3f,
+        0xd4, 0x06, 0xca, 0x3f, 0x3c, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0xcc, 0x3f, 0x07, 0x3a, 0xfd, 0x3f,
+        0x40, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0xcc, 0x3f, 0x07, 0x3a, 0xfd, 0x3f, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x9d, 0x36, 0x18, 0x40, 0x3c, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x19, 0x40,
+        0x37, 0xd0, 0x31, 0x40, 0x40, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x19, 0x40, 0x37, 0xd0, 0x31, 0x40,
+        0x47, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x19, 0x40, 0x22, 0x22, 0x4a, 0x40, 0x24, 0x50, 0x01, 0x00,
+        0x9a, 0x99, 0x19, 0x40, 0x22, 0x22, 0x4a, 0x40, 0x30, 0x50, 0x01, 0x00, 0x33, 0x33, 0x33, 0x40,
+        0xd0, 0x69, 0x4b, 0x40, 0x48, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x4c, 0x40, 0x6a, 0x03, 0x65, 0x40,
+        0x41, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x4c, 0x40, 0x6a, 0x03, 0x65, 0x40, 0x45, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x4c, 0x40, 0x6d, 0xa0, 0xc7, 0x40, 0x29, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x4c, 0x40,
+        0x6d, 0xa0, 0xc7, 0x40, 0x35, 0x50, 0x01, 0x00, 0x66, 0x66, 0x66, 0x40, 0x03, 0x9d, 0x7e, 0x40,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x4f, 0x1b, 0x8c, 0x40, 0x41, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x80, 0x40, 0x4f, 0x1b, 0x8c, 0x40, 0x45, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x8c, 0x40,
+        0x1b, 0xe8, 0x98, 0x40, 0x3c, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x99, 0x40, 0xe8, 0xb4, 0xa5, 0x40,
+        0x41, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x99, 0x40, 0xe8, 0xb4, 0xa5, 0x40, 0x45, 0x50, 0x00, 0x00,
+        0x66, 0x66, 0xa6, 0x40, 0xb5, 0x81, 0xb2, 0x40, 0x3c, 0x50, 0x00, 0x00, 0x33, 0x33, 0xb3, 0x40,
+        0x07, 0x3a, 0xb9, 0x40, 0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0xb9, 0x40, 0x6d, 0xa0, 0xbf, 0x40,
+        0x46, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x4f, 0x1b, 0xcc, 0x40, 0x47, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0xcc, 0x40, 0x1b, 0xe8, 0xd8, 0x40, 0x40, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0xcc, 0x40,
+        0x1b, 0xe8, 0xd8, 0x40, 0x43, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0xcc, 0x40, 0x74, 0xda, 0x0a, 0x41,
+        0x24, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0xcc, 0x40, 0x74, 0xda, 0x0a, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x9a, 0x99, 0xd9, 0x40, 0xe8, 0xb4, 0xe5, 0x40, 0x3c, 0x50, 0x00, 0x00, 0x66, 0x66, 0xe6, 0x40,
+        0xb5, 0x81, 0xf2, 0x40, 0x40, 0x50, 0x00, 0x00, 0x66, 0x66, 0xe6, 0x40, 0xb5, 0x81, 0xf2, 0x40,
+        0x43, 0x50, 0x00, 0x00, 0x33, 0x33, 0xf3, 0x40, 0x82, 0x4e, 0xff, 0x40, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x41, 0xa7, 0x0d, 0x06, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+        0xa7, 0x0d, 0x06, 0x41, 0x43, 0x50, 0x00, 0x00, 0x66, 0x66, 0x06, 0x41, 0x0e, 0x74, 0x0c, 0x41,
+        0x3c, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x0c, 0x41, 0x74, 0xda, 0x12, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x0c, 0x41, 0x74, 0xda, 0x12, 0x41, 0x47, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x0c, 0x41,
+        0xef, 0xee, 0x18, 0x41, 0x24, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x0c, 0x41, 0xef, 0xee, 0x18, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x33, 0x33, 0x13, 0x41, 0xda, 0x40, 0x19, 0x41, 0x48, 0x50, 0x00, 0x00,
+        0x9a, 0x99, 0x19, 0x41, 0x41, 0xa7, 0x1f, 0x41, 0x41, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x19, 0x41,
+        0x41, 0xa7, 0x1f, 0x41, 0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x19, 0x41, 0x9d, 0x36, 0x4a, 0x41,
+        0x29, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x41, 0x9d, 0x36, 0x4a, 0x41, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x20, 0x41, 0xa7, 0x0d, 0x26, 0x41, 0x3c, 0x50, 0x00, 0x00, 0x66, 0x66, 0x26, 0x41,
+        0x0e, 0x74, 0x2c, 0x41, 0x41, 0x50, 0x00, 0x00, 0x66, 0x66, 0x26, 0x41, 0x0e, 0x74, 0x2c, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x2c, 0x41, 0x74, 0xda, 0x32, 0x41, 0x3c, 0x50, 0x00, 0x00,
+        0x33, 0x33, 0x33, 0x41, 0xda, 0x40, 0x39, 0x41, 0x41, 0x50, 0x00, 0x00, 0x33, 0x33, 0x33, 0x41,
+        0xda, 0x40, 0x39, 0x41, 0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x39, 0x41, 0x41, 0xa7, 0x3f, 0x41,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0x6a, 0x03, 0x43, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x33, 0x33, 0x43, 0x41, 0x9d, 0x36, 0x46, 0x41, 0x46, 0x50, 0x00, 0x00, 0x66, 0x66, 0x46, 0x41,
+        0x0e, 0x74, 0x4c, 0x41, 0x47, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x4c, 0x41, 0xda, 0x40, 0x71, 0x41,
+        0x24, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x4c, 0x41, 0xda, 0x40, 0x71, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x66, 0x66, 0x56, 0x41, 0xd0, 0x69, 0x59, 0x41, 0x40, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x59, 0x41,
+        0x41, 0xa7, 0x5f, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x41, 0x6a, 0x03, 0x63, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x33, 0x33, 0x63, 0x41, 0x93, 0x5f, 0x72, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x33, 0x33, 0x73, 0x41, 0xda, 0x40, 0x79, 0x41, 0x47, 0x50, 0x00, 0x00, 0x33, 0x33, 0x73, 0x41,
+        0x55, 0x55, 0x7f, 0x41, 0x24, 0x50, 0x01, 0x00, 0x33, 0x33, 0x73, 0x41, 0x55, 0x55, 0x7f, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x79, 0x41, 0x03, 0x9d, 0x7c, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x7c, 0x41, 0x11, 0x11, 0x8c, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x41,
+        0x82, 0x4e, 0x98, 0x41, 0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x41, 0x82, 0x4e, 0x98, 0x41,
+        0x35, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x99, 0x41, 0xa0, 0xd3, 0xab, 0x41, 0x24, 0x50, 0x01, 0x00,
+        0x9a, 0x99, 0x99, 0x41, 0xa0, 0xd3, 0xab, 0x41, 0x30, 0x50, 0x01, 0x00, 0x66, 0x66, 0x9e, 0x41,
+        0x1b, 0xe8, 0x9f, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x41, 0xd4, 0x06, 0xa3, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x33, 0x33, 0xa3, 0x41, 0xe8, 0xb4, 0xa4, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0xa4, 0x41, 0x82, 0x4e, 0xa6, 0x41, 0x43, 0x50, 0x00, 0x00, 0x66, 0x66, 0xa6, 0x41,
+        0x77, 0x77, 0xac, 0x41, 0x43, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0xac, 0x41, 0xa0, 0xd3, 0xaf, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0xac, 0x41, 0xde, 0xdd, 0xb2, 0x41, 0x24, 0x50, 0x01, 0x00,
+        0xcd, 0xcc, 0xac, 0x41, 0xde, 0xdd, 0xb2, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x41,
+        0xc9, 0x2f, 0xbf, 0x41, 0x45, 0x50, 0x00, 0x00, 0x33, 0x33, 0xb3, 0x41, 0xb5, 0x81, 0xcb, 0x41,
+        0x29, 0x50, 0x01, 0x00, 0x33, 0x33, 0xb3, 0x41, 0xb5, 0x81, 0xcb, 0x41, 0x35, 0x50, 0x01, 0x00,
+        0xcd, 0xcc, 0xcc, 0x41, 0xd4, 0x06, 0xdf, 0x41, 0x24, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0xcc, 0x41,
+        0xd4, 0x06, 0xdf, 0x41, 0x30, 0x50, 0x01, 0x00, 0x33, 0x33, 0xd3, 0x41, 0x07, 0x3a, 0xd6, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x66, 0x66, 0xd6, 0x41, 0xb5, 0x81, 0xdf, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe0, 0x41, 0xd4, 0x06, 0xe3, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41,
+        0x11, 0x11, 0xe6, 0x41, 0x24, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x11, 0x11, 0xe6, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x33, 0x33, 0xe3, 0x41, 0x44, 0x44, 0xe9, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x66, 0x66, 0xe6, 0x41, 0x6d, 0xa0, 0xf8, 0x41, 0x29, 0x50, 0x01, 0x00, 0x66, 0x66, 0xe6, 0x41,
+        0x6d, 0xa0, 0xf8, 0x41, 0x35, 0x50, 0x01, 0x00, 0x9a, 0x99, 0xe9, 0x41, 0xe8, 0xb4, 0xf2, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0xf9, 0x41, 0xab, 0xaa, 0xff, 0x41, 0x29, 0x50, 0x01, 0x00,
+        0x9a, 0x99, 0xf9, 0x41, 0xab, 0xaa, 0xff, 0x41, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42,
+        0x03, 0x1d, 0x09, 0x42, 0x24, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x03, 0x1d, 0x09, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x05, 0x42, 0x74, 0x5a, 0x06, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x66, 0x66, 0x06, 0x42, 0x41, 0x27, 0x07, 0x42, 0x43, 0x50, 0x00, 0x00, 0x33, 0x33, 0x07, 0x42,
+        0x2c, 0x79, 0x09, 0x42, 0x43, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x09, 0x42, 0x03, 0x1d, 0x0b, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x09, 0x42, 0x22, 0xa2, 0x0c, 0x42, 0x24, 0x50, 0x01, 0x00,
+        0x9a, 0x99, 0x09, 0x42, 0x22, 0xa2, 0x0c, 0x42, 0x30, 0x50, 0x01, 0x00, 0x33, 0x33, 0x0b, 0x42,
+        0x0e, 0xf4, 0x0b, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x42, 0x55, 0xd5, 0x12, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x0c, 0x42, 0xd0, 0xe9, 0x15, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0xcd, 0xcc, 0x0c, 0x42, 0xd0, 0xe9, 0x15, 0x42, 0x35, 0x50, 0x01, 0x00, 0x66, 0x66, 0x16, 0x42,
+        0xef, 0x6e, 0x19, 0x42, 0x29, 0x50, 0x01, 0x00, 0x66, 0x66, 0x16, 0x42, 0xef, 0x6e, 0x19, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x19, 0x42, 0x60, 0xac, 0x1f, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x9a, 0x99, 0x19, 0x42, 0x60, 0xac, 0x1f, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x42,
+        0xda, 0xc0, 0x1c, 0x42, 0x45, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x1c, 0x42, 0xa7, 0x8d, 0x1d, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x1d, 0x42, 0x74, 0x5a, 0x1e, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x66, 0x66, 0x1e, 0x42, 0x0e, 0xf4, 0x22, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x42,
+        0xc6, 0x12, 0x26, 0x42, 0x28, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x42, 0xc6, 0x12, 0x26, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x33, 0x33, 0x23, 0x42, 0x9d, 0xb6, 0x24, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x24, 0x42, 0x37, 0x50, 0x26, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x66, 0x66, 0x26, 0x42,
+        0x41, 0x27, 0x27, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x66, 0x66, 0x26, 0x42, 0x2c, 0x79, 0x2c, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x66, 0x66, 0x26, 0x42, 0x2c, 0x79, 0x2c, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x33, 0x33, 0x27, 0x42, 0x0e, 0xf4, 0x27, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42,
+        0xa7, 0x8d, 0x2c, 0x42, 0x45, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x2c, 0x42, 0x93, 0xdf, 0x32, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x2c, 0x42, 0x93, 0xdf, 0x32, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x33, 0x33, 0x33, 0x42, 0x9d, 0xb6, 0x34, 0x42, 0x47, 0x50, 0x00, 0x00, 0x33, 0x33, 0x33, 0x42,
+        0x37, 0x50, 0x3c, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x33, 0x33, 0x33, 0x42, 0x37, 0x50, 0x3c, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x34, 0x42, 0x74, 0x5a, 0x39, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x9a, 0x99, 0x39, 0x42, 0x22, 0xa2, 0x3c, 0x42, 0x47, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x3c, 0x42,
+        0x37, 0x50, 0x3e, 0x42, 0x48, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x3c, 0x42, 0x55, 0xd5, 0x3f, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x3c, 0x42, 0x55, 0xd5, 0x3f, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x66, 0x66, 0x3e, 0x42, 0x4b, 0xfe, 0x45, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42,
+        0x41, 0x27, 0x4c, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0x41, 0x27, 0x4c, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0x41, 0x27, 0x4c, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x66, 0x66, 0x46, 0x42, 0xd0, 0xe9, 0x47, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42,
+        0x89, 0x08, 0x4b, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x33, 0x33, 0x4b, 0x42, 0x0e, 0xf4, 0x4b, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x42, 0xda, 0xc0, 0x4c, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x4c, 0x42, 0x93, 0xdf, 0x52, 0x42, 0x29, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x4c, 0x42,
+        0x93, 0xdf, 0x52, 0x42, 0x35, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x50, 0x42, 0xa7, 0x8d, 0x51, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x51, 0x42, 0x03, 0x1d, 0x53, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x33, 0x33, 0x53, 0x42, 0xda, 0xc0, 0x57, 0x42, 0x47, 0x50, 0x00, 0x00, 0x33, 0x33, 0x53, 0x42,
+        0xf9, 0x45, 0x59, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x33, 0x33, 0x53, 0x42, 0xf9, 0x45, 0x59, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x42, 0xda, 0xc0, 0x58, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x58, 0x42, 0xa7, 0x8d, 0x59, 0x42, 0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x59, 0x42,
+        0x03, 0x1d, 0x5b, 0x42, 0x47, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x59, 0x42, 0x60, 0xac, 0x5f, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x59, 0x42, 0x60, 0xac, 0x5f, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x33, 0x33, 0x5b, 0x42, 0xda, 0xc0, 0x5f, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x42,
+        0xc6, 0x12, 0x66, 0x42, 0x28, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x42, 0xc6, 0x12, 0x66, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x66, 0x66, 0x66, 0x42, 0x2c, 0x79, 0x6c, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x66, 0x66, 0x66, 0x42, 0x2c, 0x79, 0x6c, 0x42, 0x35, 0x50, 0x01, 0x00, 0x66, 0x66, 0x6a, 0x42,
+        0x41, 0x27, 0x6b, 0x42, 0x45, 0x50, 0x00, 0x00, 0x33, 0x33, 0x6b, 0x42, 0x9d, 0xb6, 0x6c, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0xcd, 0xcc, 0x6c, 0x42, 0x37, 0x50, 0x6e, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x6c, 0x42, 0x93, 0xdf, 0x72, 0x42, 0x2b, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x6c, 0x42,
+        0x93, 0xdf, 0x72, 0x42, 0x37, 0x50, 0x01, 0x00, 0x66, 0x66, 0x6e, 0x42, 0x41, 0x27, 0x6f, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x33, 0x33, 0x6f, 0x42, 0x9d, 0xb6, 0x70, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xcd, 0xcc, 0x70, 0x42, 0xa7, 0x8d, 0x71, 0x42, 0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x71, 0x42,
+        0x7e, 0x31, 0x79, 0x42, 0x40, 0x50, 0x00, 0x00, 0x33, 0x33, 0x73, 0x42, 0xf9, 0x45, 0x79, 0x42,
+        0x24, 0x50, 0x01, 0x00, 0x33, 0x33, 0x73, 0x42, 0xf9, 0x45, 0x79, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x9a, 0x99, 0x79, 0x42, 0x60, 0xac, 0x7f, 0x42, 0x28, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x79, 0x42,
+        0x60, 0xac, 0x7f, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x42, 0x63, 0x09, 0x83, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x42, 0x63, 0x09, 0x83, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x33, 0x33, 0x81, 0x42, 0xa0, 0x93, 0x81, 0x42, 0x45, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x81, 0x42,
+        0x4f, 0x5b, 0x82, 0x42, 0x45, 0x50, 0x00, 0x00, 0x66, 0x66, 0x82, 0x42, 0x1b, 0x28, 0x83, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x33, 0x33, 0x83, 0x42, 0x07, 0x7a, 0x85, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x33, 0x33, 0x83, 0x42, 0x96, 0x3c, 0x86, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x33, 0x33, 0x83, 0x42,
+        0x96, 0x3c, 0x86, 0x42, 0x37, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x85, 0x42, 0x07, 0xfa, 0x85, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x86, 0x42, 0x6d, 0x60, 0x86, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x66, 0x66, 0x86, 0x42, 0x1b, 0x28, 0x87, 0x42, 0x48, 0x50, 0x00, 0x00, 0x66, 0x66, 0x86, 0x42,
+        0xc9, 0x6f, 0x89, 0x42, 0x26, 0x50, 0x01, 0x00, 0x66, 0x66, 0x86, 0x42, 0xc9, 0x6f, 0x89, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x33, 0x33, 0x87, 0x42, 0xa0, 0x93, 0x87, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x9a, 0x99, 0x87, 0x42, 0x07, 0xfa, 0x87, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42,
+        0x44, 0x84, 0x89, 0x42, 0x47, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x89, 0x42, 0xfd, 0xa2, 0x8c, 0x42,
+        0x28, 0x50, 0x01, 0x00, 0x9a, 0x99, 0x89, 0x42, 0xfd, 0xa2, 0x8c, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0xcd, 0xcc, 0x8c, 0x42, 0x30, 0xd6, 0x8f, 0x42, 0x29, 0x50, 0x01, 0x00, 0xcd, 0xcc, 0x8c, 0x42,
+        0x30, 0xd6, 0x8f, 0x42, 0x35, 0x50, 0x01, 0x00, 0x33, 0x33, 0x8f, 0x42, 0xa0, 0x93, 0x8f, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x9a, 0x99, 0x8f, 0x42, 0x07, 0xfa, 0x8f, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x90, 0x42, 0xd4, 0x46, 0x92, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x42,
+        0x63, 0x09, 0x93, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x42, 0x63, 0x09, 0x93, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x66, 0x66, 0x92, 0x42, 0x1b, 0x28, 0x93, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x33, 0x33, 0x93, 0x42, 0xd4, 0x46, 0x99, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x33, 0x33, 0x93, 0x42,
+        0xd4, 0x46, 0x99, 0x42, 0x40, 0x50, 0x00, 0x00, 0x33, 0x33, 0x93, 0x42, 0xd4, 0x46, 0x99, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x33, 0x33, 0x93, 0x42, 0xd4, 0x46, 0x99, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x33, 0x33, 0x93, 0x42, 0xd4, 0x46, 0x99, 0x42, 0x24, 0x50, 0x01, 0x00, 0x33, 0x33, 0x93, 0x42,
+        0xd4, 0x46, 0x99, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x72, 0x3e,
+        0x3e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x3e, 0x11, 0x11, 0xf9, 0x3e, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x3f, 0x44, 0x44, 0x9e, 0x3f, 0x48, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+        0x55, 0x55, 0x56, 0x40, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x3f, 0xab, 0xaa, 0xfc, 0x3f,
+        0x47, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x22, 0x22, 0x2f, 0x40, 0x45, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0x40, 0xbc, 0xbb, 0x7c, 0x40, 0x43, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40,
+        0x55, 0x55, 0x7e, 0x40, 0x27, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x40, 0x11, 0x91, 0x87, 0x40,
+        0x28, 0x50, 0x01, 0x00, 0x00, 0x00, 0x88, 0x40, 0x11, 0x91, 0x8f, 0x40, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x40, 0x11, 0x91, 0xa7, 0x40, 0x45, 0x60, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40,
+        0xab, 0x2a, 0xeb, 0x40, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x40, 0xab, 0x2a, 0xbf, 0x40,
+        0x43, 0x60, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x11, 0x91, 0xd7, 0x40, 0x42, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0xd8, 0x40, 0xde, 0x5d, 0xfe, 0x40, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x40,
+        0xab, 0x2a, 0xff, 0x40, 0x2c, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x41, 0x89, 0xc8, 0x03, 0x41,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x04, 0x41, 0x89, 0xc8, 0x07, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x08, 0x41, 0x89, 0xc8, 0x13, 0x41, 0x4a, 0x60, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41,
+        0x55, 0x95, 0x35, 0x41, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x14, 0x41, 0x55, 0x95, 0x1f, 0x41,
+        0x48, 0x60, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x89, 0xc8, 0x2b, 0x41, 0x47, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x2c, 0x41, 0xef, 0x2e, 0x3f, 0x41, 0x45, 0x60, 0x00, 0x00, 0x00, 0x00, 0x38, 0x41,
+        0x55, 0x95, 0x3f, 0x41, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41, 0x89, 0xc8, 0x43, 0x41,
+        0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0x44, 0x41, 0x89, 0xc8, 0x47, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x48, 0x41, 0x89, 0xc8, 0x53, 0x41, 0x43, 0x60, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41,
+        0x55, 0x95, 0x75, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x54, 0x41, 0x55, 0x95, 0x5f, 0x41,
+        0x42, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x41, 0x89, 0xc8, 0x6b, 0x41, 0x40, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x6c, 0x41, 0xef, 0x2e, 0x7f, 0x41, 0x3e, 0x60, 0x00, 0x00, 0x00, 0x00, 0x78, 0x41,
+        0x55, 0x95, 0x7f, 0x41, 0x2a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x41, 0x44, 0xe4, 0x81, 0x41,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x82, 0x41, 0x44, 0xe4, 0x83, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x84, 0x41, 0x44, 0xe4, 0x89, 0x41, 0x48, 0x60, 0x00, 0x00, 0x00, 0x00, 0x84, 0x41,
+        0xab, 0xca, 0x9a, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x41, 0xab, 0xca, 0x8f, 0x41,
+        0x47, 0x60, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0x44, 0xe4, 0x95, 0x41, 0x45, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x96, 0x41, 0xab, 0xca, 0x9b, 0x41, 0x43, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x41,
+        0xde, 0xfd, 0x9f, 0x41, 0x42, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x41, 0xab, 0xca, 0x9f, 0x41,
+        0x27, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x44, 0xe4, 0xa1, 0x41, 0x28, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa2, 0x41, 0x44, 0xe4, 0xa3, 0x41, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x41,
+        0x44, 0xe4, 0xa9, 0x41, 0x45, 0x60, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x41, 0xab, 0xca, 0xba, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x41, 0xab, 0xca, 0xaf, 0x41, 0x43, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0xb0, 0x41, 0x44, 0xe4, 0xb5, 0x41, 0x42, 0x60, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x41,
+        0xab, 0xca, 0xbb, 0x41, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x41, 0xde, 0xfd, 0xbf, 0x41,
+        0x3e, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x41, 0xab, 0xca, 0xbf, 0x41, 0x2c, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0x44, 0xe4, 0xc1, 0x41, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x41,
+        0x44, 0xe4, 0xc3, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc4, 0x41, 0x44, 0xe4, 0xc9, 0x41,
+        0x4a, 0x60, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x41, 0xab, 0xca, 0xda, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xca, 0x41, 0xab, 0xca, 0xcf, 0x41, 0x48, 0x60, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x41,
+        0x44, 0xe4, 0xd5, 0x41, 0x47, 0x60, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x41, 0x77, 0x97, 0xdf, 0x41,
+        0x45, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x41, 0xab, 0xca, 0xdf, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe0, 0x41, 0x44, 0xe4, 0xe1, 0x41, 0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe2, 0x41,
+        0x44, 0xe4, 0xe3, 0x41, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x44, 0xe4, 0xe9, 0x41,
+        0x43, 0x60, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x41, 0x77, 0x97, 0xfe, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xea, 0x41, 0xab, 0xca, 0xef, 0x41, 0x42, 0x60, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0x44, 0xe4, 0xf5, 0x41, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x89, 0x98, 0x07, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0x04, 0x42, 0x22, 0xf2, 0x04, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0x42, 0x22, 0xf2, 0x05, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x42,
+        0x22, 0xf2, 0x06, 0x42, 0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x22, 0xf2, 0x07, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x22, 0xb2, 0x0d, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x42, 0x55, 0xe5, 0x09, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x42,
+        0x55, 0xe5, 0x0b, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x42, 0x55, 0xe5, 0x0d, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x42, 0x55, 0xe5, 0x0f, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x10, 0x42, 0x55, 0xe5, 0x11, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x12, 0x42,
+        0x55, 0xe5, 0x13, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x14, 0x42, 0x22, 0xf2, 0x14, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x42, 0x55, 0xe5, 0x15, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x15, 0x42, 0x22, 0xf2, 0x15, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42,
+        0xbc, 0x6b, 0x17, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42, 0x55, 0xe5, 0x17, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x17, 0x42, 0x89, 0xf8, 0x17, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x42, 0x55, 0xe5, 0x19, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18, 0x42,
+        0x22, 0xb2, 0x1d, 0x42, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18, 0x42, 0x55, 0xe5, 0x19, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x42, 0xbc, 0xcb, 0x1d, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x1a, 0x42, 0x55, 0xe5, 0x1b, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x42,
+        0x55, 0xe5, 0x1d, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x42, 0x55, 0xe5, 0x1f, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x42, 0x55, 0xe5, 0x21, 0x42, 0x2a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x22, 0x42, 0x55, 0xe5, 0x23, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x24, 0x42,
+        0x22, 0xf2, 0x24, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x55, 0xe5, 0x25, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x25, 0x42, 0x22, 0xf2, 0x25, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x26, 0x42, 0x22, 0xf2, 0x26, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42,
+        0x55, 0xe5, 0x27, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x27, 0x42, 0xbc, 0xcb, 0x27, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x89, 0x98, 0x2f, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x28, 0x42, 0x55, 0xe5, 0x29, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x42,
+        0x55, 0xe5, 0x2b, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x42, 0x55, 0xe5, 0x2d, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x42, 0x55, 0xe5, 0x2f, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x30, 0x42, 0x55, 0xe5, 0x31, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x32, 0x42,
+        0x55, 0xe5, 0x33, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x34, 0x42, 0x22, 0xf2, 0x34, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0x42, 0x55, 0xe5, 0x35, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x35, 0x42, 0x22, 0xf2, 0x35, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x36, 0x42,
+        0x22, 0xf2, 0x36, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x36, 0x42, 0x55, 0xe5, 0x37, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x37, 0x42, 0xbc, 0xcb, 0x37, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0x42, 0x89, 0x98, 0x3f, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42,
+        0x55, 0xe5, 0x39, 0x42, 0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x42, 0x55, 0xe5, 0x3b, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x55, 0xe5, 0x3d, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3e, 0x42, 0x55, 0xe5, 0x3f, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42,
+        0x55, 0xe5, 0x41, 0x42, 0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0x42, 0x42, 0x55, 0xe5, 0x43, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x44, 0x42, 0x22, 0xf2, 0x44, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x44, 0x42, 0x55, 0xe5, 0x45, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x45, 0x42,
+        0x22, 0xf2, 0x45, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x42, 0xbc, 0x6b, 0x47, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x42, 0x55, 0xe5, 0x47, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x47, 0x42, 0x89, 0xf8, 0x47, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42,
+        0x22, 0xb2, 0x4d, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42, 0x55, 0xe5, 0x49, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4a, 0x42, 0x55, 0xe5, 0x4b, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x4c, 0x42, 0x55, 0xe5, 0x4d, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x42,
+        0x55, 0xe5, 0x4f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x50, 0x42, 0x55, 0xe5, 0x51, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x52, 0x42, 0x55, 0xe5, 0x53, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x54, 0x42, 0x22, 0xf2, 0x54, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x42,
+        0x55, 0xe5, 0x55, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x55, 0x42, 0x22, 0xf2, 0x55, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x56, 0x42, 0xbc, 0x6b, 0x57, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x56, 0x42, 0x55, 0xe5, 0x57, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x57, 0x42,
+        0x89, 0xf8, 0x57, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42, 0x55, 0xe5, 0x59, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42, 0x22, 0xb2, 0x5d, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x58, 0x42, 0x55, 0xe5, 0x59, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5a, 0x42,
+        0xbc, 0xcb, 0x5d, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x42, 0x55, 0xe5, 0x5b, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5c, 0x42, 0x55, 0xe5, 0x5d, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x5e, 0x42, 0x55, 0xe5, 0x5f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x42,
+        0x55, 0xe5, 0x61, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x62, 0x42, 0x55, 0xe5, 0x63, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42, 0x22, 0xf2, 0x64, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x64, 0x42, 0x55, 0xe5, 0x65, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x65, 0x42,
+        0x22, 0xf2, 0x65, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x66, 0x42, 0x22, 0xf2, 0x66, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x66, 0x42, 0x55, 0xe5, 0x67, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x67, 0x42, 0xbc, 0xcb, 0x67, 0x42, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42,
+        0x89, 0x98, 0x6f, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42, 0x55, 0xe5, 0x69, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x55, 0xe5, 0x6b, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x6c, 0x42, 0x55, 0xe5, 0x6d, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x42,
+        0x55, 0xe5, 0x6f, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42, 0x55, 0xe5, 0x71, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x72, 0x42, 0x55, 0xe5, 0x73, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x74, 0x42, 0x22, 0xf2, 0x74, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x74, 0x42,
+        0x55, 0xe5, 0x75, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x75, 0x42, 0x22, 0xf2, 0x75, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x76, 0x42, 0x22, 0xf2, 0x76, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x76, 0x42, 0x55, 0xe5, 0x77, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x77, 0x42,
+        0xbc, 0xcb, 0x77, 0x42, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x42, 0x89, 0x98, 0x7f, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x42, 0x55, 0xe5, 0x79, 0x42, 0x26, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x7a, 0x42, 0x55, 0xe5, 0x7b, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42,
+        0x55, 0xe5, 0x7d, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x42, 0x55, 0xe5, 0x7f, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x42, 0xab, 0xf2, 0x80, 0x42, 0x26, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x81, 0x42, 0xab, 0xf2, 0x81, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0x81, 0x42,
+        0x11, 0xf9, 0x81, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x42, 0x11, 0x79, 0x82, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x42, 0xab, 0xf2, 0x82, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x82, 0x42, 0x11, 0xf9, 0x82, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x42,
+        0xde, 0xb5, 0x83, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x42, 0xab, 0xf2, 0x83, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x83, 0x42, 0x44, 0xfc, 0x83, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x84, 0x42, 0x44, 0xcc, 0x87, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42,
+        0xab, 0xf2, 0x84, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x85, 0x42, 0xab, 0xf2, 0x85, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x86, 0x42, 0xab, 0xf2, 0x86, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x87, 0x42, 0xab, 0xf2, 0x87, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x88, 0x42,
+        0xab, 0xf2, 0x88, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x89, 0x42, 0xab, 0xf2, 0x89, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x89, 0x42, 0x11, 0xf9, 0x89, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x8a, 0x42, 0x11, 0x79, 0x8a, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x42,
+        0xab, 0xf2, 0x8a, 0x42, 0x27, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8a, 0x42, 0x11, 0xf9, 0x8a, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x42, 0xde, 0xb5, 0x8b, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x8b, 0x42, 0xab, 0xf2, 0x8b, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x8b, 0x42,
+        0x44, 0xfc, 0x8b, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x42, 0x44, 0xcc, 0x8f, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x42, 0xab, 0xf2, 0x8c, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8d, 0x42, 0xab, 0xf2, 0x8d, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x42,
+        0xab, 0xf2, 0x8e, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8f, 0x42, 0xab, 0xf2, 0x8f, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x42, 0xab, 0xf2, 0x90, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x91, 0x42, 0xab, 0xf2, 0x91, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x80, 0x91, 0x42,
+        0x11, 0xf9, 0x91, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42, 0x11, 0x79, 0x92, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42, 0xab, 0xf2, 0x92, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x92, 0x42, 0x11, 0xf9, 0x92, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x93, 0x42,
+        0xde, 0xb5, 0x93, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x93, 0x42, 0xab, 0xf2, 0x93, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x93, 0x42, 0x44, 0xfc, 0x93, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x94, 0x42, 0x44, 0xcc, 0x97, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x94, 0x42,
+        0xab, 0xf2, 0x94, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x95, 0x42, 0xab, 0xf2, 0x95, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x96, 0x42, 0xab, 0xf2, 0x96, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x97, 0x42, 0xab, 0xf2, 0x97, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x98, 0x42,
+        0xab, 0xf2, 0x98, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x99, 0x42, 0xab, 0xf2, 0x99, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9a, 0x42, 0x11, 0x79, 0x9a, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9a, 0x42, 0xab, 0xf2, 0x9a, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x9a, 0x42,
+        0x11, 0xf9, 0x9a, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x42, 0xde, 0xb5, 0x9b, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x42, 0xab, 0xf2, 0x9b, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x9b, 0x42, 0x44, 0xfc, 0x9b, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x42,
+        0x44, 0xcc, 0x9f, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x42, 0xab, 0xf2, 0x9c, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x42, 0xab, 0xf2, 0x9d, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x9e, 0x42, 0xab, 0xf2, 0x9e, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9f, 0x42,
+        0xab, 0xf2, 0x9f, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x42, 0xab, 0xf2, 0xa0, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa1, 0x42, 0xab, 0xf2, 0xa1, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xa1, 0x42, 0x11, 0xf9, 0xa1, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x42,
+        0x11, 0x79, 0xa2, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x42, 0xab, 0xf2, 0xa2, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa2, 0x42, 0x11, 0xf9, 0xa2, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa3, 0x42, 0xde, 0xb5, 0xa3, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x42,
+        0xab, 0xf2, 0xa3, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0xc0, 0xa3, 0x42, 0x44, 0xfc, 0xa3, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x42, 0x44, 0xcc, 0xa7, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa4, 0x42, 0xab, 0xf2, 0xa4, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa5, 0x42,
+        0x11, 0x79, 0xa6, 0x42, 0x3c, 0x60, 0x01, 0x00, 0x00, 0x80, 0xa6, 0x42, 0xab, 0xf2, 0xa7, 0x42,
+        0x3b, 0x60, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x42, 0x77, 0xff, 0xa9, 0x42, 0x39, 0x60, 0x01, 0x00,
+        0x00, 0x80, 0xa9, 0x42, 0x11, 0xf9, 0xa9, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x42,
+        0x11, 0x79, 0xaa, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x42, 0x77, 0xff, 0xab, 0x42,
+        0x37, 0x60, 0x01, 0x00, 0x00, 0x80, 0xaa, 0x42, 0x11, 0xf9, 0xaa, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xab, 0x42, 0xde, 0xb5, 0xab, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0xc0, 0xab, 0x42,
+        0x44, 0xfc, 0xab, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x42, 0x44, 0xcc, 0xaf, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x42, 0xab, 0xf2, 0xac, 0x42, 0x28, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xad, 0x42, 0x11, 0x79, 0xae, 0x42, 0x39, 0x60, 0x01, 0x00, 0x00, 0x80, 0xae, 0x42,
+        0xab, 0xf2, 0xaf, 0x42, 0x37, 0x60, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x42, 0x77, 0xff, 0xb1, 0x42,
+        0x36, 0x60, 0x01, 0x00, 0x00, 0x80, 0xb1, 0x42, 0x11, 0xf9, 0xb1, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb2, 0x42, 0x11, 0x79, 0xb2, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x42,
+        0x77, 0xff, 0xb3, 0x42, 0x34, 0x60, 0x01, 0x00, 0x00, 0x80, 0xb2, 0x42, 0x11, 0xf9, 0xb2, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x42, 0xde, 0xb5, 0xb3, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0xc0, 0xb3, 0x42, 0x44, 0xfc, 0xb3, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x42,
+        0x44, 0xcc, 0xb7, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x42, 0xab, 0xf2, 0xb4, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb5, 0x42, 0x11, 0x79, 0xb6, 0x42, 0x3e, 0x60, 0x01, 0x00,
+        0x00, 0x80, 0xb6, 0x42, 0xab, 0xf2, 0xb7, 0x42, 0x3c, 0x60, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x42,
+        0x77, 0xff, 0xb9, 0x42, 0x3b, 0x60, 0x01, 0x00, 0x00, 0x80, 0xb9, 0x42, 0x11, 0xf9, 0xb9, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xba, 0x42, 0x11, 0x79, 0xba, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xba, 0x42, 0x77, 0xff, 0xbb, 0x42, 0x39, 0x60, 0x01, 0x00, 0x00, 0x80, 0xba, 0x42,
+        0x11, 0xf9, 0xba, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x42, 0xde, 0xb5, 0xbb, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0xc0, 0xbb, 0x42, 0x44, 0xfc, 0xbb, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xbc, 0x42, 0x44, 0xcc, 0xbf, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x42,
+        0xab, 0xf2, 0xbc, 0x42, 0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x42, 0x11, 0x79, 0xbe, 0x42,
+        0x37, 0x60, 0x01, 0x00, 0x00, 0x80, 0xbe, 0x42, 0xab, 0xf2, 0xbf, 0x42, 0x36, 0x60, 0x01, 0x00,
+        0x00, 0x00, 0xc0, 0x42, 0x77, 0xff, 0xc1, 0x42, 0x34, 0x60, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x42,
+        0x11, 0x79, 0xc2, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x42, 0x77, 0xff, 0xc3, 0x42,
+        0x32, 0x60, 0x01, 0x00, 0x00, 0x80, 0xc2, 0x42, 0x11, 0xf9, 0xc2, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc3, 0x42, 0xde, 0xb5, 0xc3, 0x42, 0x42, 0x50, 0x00, 0x00, 0x00, 0xc0, 0xc3, 0x42,
+        0x44, 0xfc, 0xc3, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x42, 0x11, 0xd9, 0xc6, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x42, 0xab, 0xf2, 0xc4, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc5, 0x42, 0xab, 0xf2, 0xc5, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x42,
+        0xab, 0xf2, 0xc6, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x42, 0xab, 0xf2, 0xc7, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x42, 0xab, 0xf2, 0xc8, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc9, 0x42, 0xab, 0xf2, 0xc9, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xca, 0x42,
+        0x11, 0x79, 0xca, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xca, 0x42, 0xab, 0xf2, 0xca, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xca, 0x42, 0x11, 0xf9, 0xca, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xcb, 0x42, 0xde, 0xb5, 0xcb, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x42,
+        0xab, 0xf2, 0xcb, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0xcb, 0x42, 0x44, 0xfc, 0xcb, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x42, 0xab, 0xf2, 0xcc, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xcc, 0x42, 0x11, 0xd9, 0xce, 0x42, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x42,
+        0xab, 0xf2, 0xcc, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xcd, 0x42, 0xde, 0xe5, 0xce, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x42, 0xab, 0xf2, 0xcd, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xce, 0x42, 0xab, 0xf2, 0xce, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xcf, 0x42,
+        0xab, 0xf2, 0xcf, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x42, 0xab, 0xf2, 0xd0, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd1, 0x42, 0xab, 0xf2, 0xd1, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd2, 0x42, 0x11, 0x79, 0xd2, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x42,
+        0xab, 0xf2, 0xd2, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0xd2, 0x42, 0x11, 0xf9, 0xd2, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x42, 0x11, 0x79, 0xd3, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd3, 0x42, 0xab, 0xf2, 0xd3, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xd3, 0x42,
+        0xde, 0xe5, 0xd3, 0x42, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x42, 0x44, 0xcc, 0xd7, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x42, 0xab, 0xf2, 0xd4, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd5, 0x42, 0xab, 0xf2, 0xd5, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd6, 0x42,
+        0xab, 0xf2, 0xd6, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd7, 0x42, 0xab, 0xf2, 0xd7, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x42, 0xab, 0xf2, 0xd8, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd9, 0x42, 0xab, 0xf2, 0xd9, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xda, 0x42,
+        0x11, 0x79, 0xda, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xda, 0x42, 0xab, 0xf2, 0xda, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0xda, 0x42, 0x11, 0xf9, 0xda, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xdb, 0x42, 0x11, 0x79, 0xdb, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x42,
+        0xab, 0xf2, 0xdb, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xdb, 0x42, 0xde, 0xe5, 0xdb, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x42, 0x44, 0xcc, 0xdf, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xdc, 0x42, 0xab, 0xf2, 0xdc, 0x42, 0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0xdd, 0x42,
+        0xab, 0xf2, 0xdd, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xde, 0x42, 0xab, 0xf2, 0xde, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xdf, 0x42, 0xab, 0xf2, 0xdf, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe0, 0x42, 0xab, 0xf2, 0xe0, 0x42, 0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe1, 0x42,
+        0xab, 0xf2, 0xe1, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe2, 0x42, 0x11, 0x79, 0xe2, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x42, 0xab, 0xf2, 0xe2, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xe2, 0x42, 0x11, 0xf9, 0xe2, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x42,
+        0xde, 0xb5, 0xe3, 0x42, 0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x42, 0xab, 0xf2, 0xe3, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0xc0, 0xe3, 0x42, 0x44, 0xfc, 0xe3, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe4, 0x42, 0x11, 0xd9, 0xe6, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x42,
+        0xab, 0xf2, 0xe4, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe5, 0x42, 0xab, 0xf2, 0xe5, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x42, 0xab, 0xf2, 0xe6, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe7, 0x42, 0xab, 0xf2, 0xe7, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x42,
+        0xab, 0xf2, 0xe8, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe9, 0x42, 0xab, 0xf2, 0xe9, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xea, 0x42, 0x11, 0x79, 0xea, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xea, 0x42, 0xab, 0xf2, 0xea, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xea, 0x42,
+        0x11, 0xf9, 0xea, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x42, 0xde, 0xb5, 0xeb, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x42, 0xab, 0xf2, 0xeb, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0xeb, 0x42, 0x44, 0xfc, 0xeb, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xec, 0x42,
+        0xab, 0xf2, 0xec, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xec, 0x42, 0x11, 0xd9, 0xee, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0xec, 0x42, 0xab, 0xf2, 0xec, 0x42, 0x2a, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xed, 0x42, 0xde, 0xe5, 0xee, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xed, 0x42,
+        0xab, 0xf2, 0xed, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xee, 0x42, 0xab, 0xf2, 0xee, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xef, 0x42, 0xab, 0xf2, 0xef, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0x42, 0xab, 0xf2, 0xf0, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x42,
+        0xab, 0xf2, 0xf1, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x42, 0x11, 0x79, 0xf2, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x42, 0xab, 0xf2, 0xf2, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xf2, 0x42, 0x11, 0xf9, 0xf2, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x42,
+        0x11, 0x79, 0xf3, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x42, 0xab, 0xf2, 0xf3, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xf3, 0x42, 0xde, 0xe5, 0xf3, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf4, 0x42, 0x44, 0xcc, 0xf7, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x42,
+        0xab, 0xf2, 0xf4, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf5, 0x42, 0xab, 0xf2, 0xf5, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x42, 0xab, 0xf2, 0xf6, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xf7, 0x42, 0xab, 0xf2, 0xf7, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf8, 0x42,
+        0xab, 0xf2, 0xf8, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x42, 0xab, 0xf2, 0xf9, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x42, 0x11, 0x79, 0xfa, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xfa, 0x42, 0xab, 0xf2, 0xfa, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0xfa, 0x42,
+        0x11, 0xf9, 0xfa, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x42, 0x11, 0x79, 0xfb, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x42, 0xab, 0xf2, 0xfb, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xfb, 0x42, 0xde, 0xe5, 0xfb, 0x42, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x42,
+        0x44, 0xcc, 0xff, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x42, 0xab, 0xf2, 0xfc, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfd, 0x42, 0xab, 0xf2, 0xfd, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xfe, 0x42, 0xab, 0xf2, 0xfe, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xff, 0x42,
+        0xab, 0xf2, 0xff, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x43, 0x55, 0x79, 0x00, 0x43,
+        0x26, 0x50, 0x01, 0x00, 0x00, 0x80, 0x00, 0x43, 0x55, 0xf9, 0x00, 0x43, 0x2d, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x00, 0x43, 0x89, 0xfc, 0x00, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43,
+        0x89, 0x3c, 0x01, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0x55, 0x79, 0x01, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x40, 0x01, 0x43, 0x89, 0x7c, 0x01, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x01, 0x43, 0xef, 0xda, 0x01, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x01, 0x43,
+        0x55, 0xf9, 0x01, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x43, 0x22, 0xfe, 0x01, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x43, 0x22, 0xe6, 0x03, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x43, 0x55, 0x79, 0x02, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x02, 0x43,
+        0x55, 0xf9, 0x02, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x03, 0x43, 0x55, 0x79, 0x03, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x03, 0x43, 0x55, 0xf9, 0x03, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x04, 0x43, 0x55, 0x79, 0x04, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x04, 0x43,
+        0x55, 0xf9, 0x04, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x04, 0x43, 0x89, 0xfc, 0x04, 0x43,
+        0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x43, 0x89, 0x3c, 0x05, 0x43, 0x3b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0x43, 0x55, 0x79, 0x05, 0x43, 0x27, 0x50, 0x01, 0x00, 0x00, 0x40, 0x05, 0x43,
+        0x89, 0x7c, 0x05, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x05, 0x43, 0xef, 0xda, 0x05, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x05, 0x43, 0x55, 0xf9, 0x05, 0x43, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0xe0, 0x05, 0x43, 0x22, 0xfe, 0x05, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43,
+        0x22, 0xe6, 0x07, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43, 0x55, 0x79, 0x06, 0x43,
+        0x28, 0x50, 0x01, 0x00, 0x00, 0x80, 0x06, 0x43, 0x55, 0xf9, 0x06, 0x43, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x07, 0x43, 0x55, 0x79, 0x07, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x07, 0x43,
+        0x55, 0xf9, 0x07, 0x43, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x08, 0x43, 0x55, 0x79, 0x08, 0x43,
+        0x28, 0x50, 0x01, 0x00, 0x00, 0x80, 0x08, 0x43, 0x55, 0xf9, 0x08, 0x43, 0x2f, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x08, 0x43, 0x89, 0xfc, 0x08, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x09, 0x43,
+        0x89, 0x3c, 0x09, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x09, 0x43, 0x55, 0x79, 0x09, 0x43,
+        0x2c, 0x50, 0x01, 0x00, 0x00, 0x40, 0x09, 0x43, 0x89, 0x7c, 0x09, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x09, 0x43, 0xef, 0xda, 0x09, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x09, 0x43,
+        0x55, 0xf9, 0x09, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0xe0, 0x09, 0x43, 0x22, 0xfe, 0x09, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x43, 0x22, 0xe6, 0x0b, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x0a, 0x43, 0x55, 0x79, 0x0a, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0x0a, 0x43,
+        0x55, 0xf9, 0x0a, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x43, 0x55, 0x79, 0x0b, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x0b, 0x43, 0x55, 0xf9, 0x0b, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x0c, 0x43, 0x55, 0x79, 0x0c, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0x0c, 0x43,
+        0x55, 0xf9, 0x0c, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x43, 0x89, 0x3c, 0x0d, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x43, 0x55, 0x79, 0x0d, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x0d, 0x43, 0x89, 0x7c, 0x0d, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x0d, 0x43,
+        0xef, 0xda, 0x0d, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x0d, 0x43, 0x55, 0xf9, 0x0d, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0xe0, 0x0d, 0x43, 0x22, 0xfe, 0x0d, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x0e, 0x43, 0x22, 0xe6, 0x0f, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x43,
+        0x55, 0x79, 0x0e, 0x43, 0x26, 0x50, 0x01, 0x00, 0x00, 0x80, 0x0e, 0x43, 0x55, 0xf9, 0x0e, 0x43,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x43, 0x55, 0x79, 0x0f, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x0f, 0x43, 0x55, 0xf9, 0x0f, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x43,
+        0x55, 0x79, 0x10, 0x43, 0x26, 0x50, 0x01, 0x00, 0x00, 0x80, 0x10, 0x43, 0x55, 0xf9, 0x10, 0x43,
+        0x2d, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x10, 0x43, 0x89, 0xfc, 0x10, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x11, 0x43, 0x89, 0x3c, 0x11, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x11, 0x43,
+        0x55, 0x79, 0x11, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x40, 0x11, 0x43, 0x89, 0x7c, 0x11, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x11, 0x43, 0xef, 0xda, 0x11, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x11, 0x43, 0x55, 0xf9, 0x11, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x00, 0xe0, 0x11, 0x43,
+        0x22, 0xfe, 0x11, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x12, 0x43, 0x22, 0xe6, 0x13, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x12, 0x43, 0x55, 0x79, 0x12, 0x43, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x12, 0x43, 0x89, 0x3c, 0x13, 0x43, 0x3c, 0x60, 0x01, 0x00, 0x00, 0x40, 0x13, 0x43,
+        0x55, 0xf9, 0x13, 0x43, 0x3b, 0x60, 0x01, 0x00, 0x00, 0x00, 0x14, 0x43, 0xbc, 0xff, 0x14, 0x43,
+        0x39, 0x60, 0x01, 0x00, 0x00, 0xc0, 0x14, 0x43, 0x89, 0xfc, 0x14, 0x43, 0x3b, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x15, 0x43, 0x89, 0x3c, 0x15, 0x43, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x43,
+        0xbc, 0xff, 0x15, 0x43, 0x37, 0x60, 0x01, 0x00, 0x00, 0x40, 0x15, 0x43, 0x89, 0x7c, 0x15, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x15, 0x43, 0xef, 0xda, 0x15, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0xe0, 0x15, 0x43, 0x22, 0xfe, 0x15, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x43,
+        0x22, 0xe6, 0x17, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x43, 0x55, 0x79, 0x16, 0x43,
+        0x28, 0x50, 0x01, 0x00, 0x00, 0x80, 0x16, 0x43, 0x89, 0x3c, 0x17, 0x43, 0x39, 0x60, 0x01, 0x00,
+        0x00, 0x40, 0x17, 0x43, 0x55, 0xf9, 0x17, 0x43, 0x37, 0x60, 0x01, 0x00, 0x00, 0x00, 0x18, 0x43,
+        0xbc, 0xff, 0x18, 0x43, 0x36, 0x60, 0x01, 0x00, 0x00, 0xc0, 0x18, 0x43, 0x89, 0xfc, 0x18, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x19, 0x43, 0x89, 0x3c, 0x19, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x19, 0x43, 0xbc, 0xff, 0x19, 0x43, 0x34, 0x60, 0x01, 0x00, 0x00, 0x40, 0x19, 0x43,
+        0x89, 0x7c, 0x19, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x19, 0x43, 0xef, 0xda, 0x19, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x19, 0x43, 0x22, 0xfe, 0x19, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x1a, 0x43, 0x22, 0xe6, 0x1b, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x43,
+        0x55, 0x79, 0x1a, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1a, 0x43, 0x89, 0x3c, 0x1b, 0x43,
+        0x3e, 0x60, 0x01, 0x00, 0x00, 0x40, 0x1b, 0x43, 0x55, 0xf9, 0x1b, 0x43, 0x3c, 0x60, 0x01, 0x00,
+        0x00, 0x00, 0x1c, 0x43, 0xbc, 0xff, 0x1c, 0x43, 0x3b, 0x60, 0x01, 0x00, 0x00, 0xc0, 0x1c, 0x43,
+        0x89, 0xfc, 0x1c, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x43, 0x89, 0x3c, 0x1d, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x43, 0xbc, 0xff, 0x1d, 0x43, 0x39, 0x60, 0x01, 0x00,
+        0x00, 0x40, 0x1d, 0x43, 0x89, 0x7c, 0x1d, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x1d, 0x43,
+        0xef, 0xda, 0x1d, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x1d, 0x43, 0x22, 0xfe, 0x1d, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x43, 0x22, 0xe6, 0x1f, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x1e, 0x43, 0x55, 0x79, 0x1e, 0x43, 0x26, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1e, 0x43,
+        0x89, 0x3c, 0x1f, 0x43, 0x37, 0x60, 0x01, 0x00, 0x00, 0x40, 0x1f, 0x43, 0x55, 0xf9, 0x1f, 0x43,
+        0x36, 0x60, 0x01, 0x00, 0x00, 0x00, 0x20, 0x43, 0xbc, 0xff, 0x20, 0x43, 0x34, 0x60, 0x01, 0x00,
+        0x00, 0xc0, 0x20, 0x43, 0x89, 0xfc, 0x20, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x21, 0x43,
+        0x89, 0x3c, 0x21, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x21, 0x43, 0xbc, 0xff, 0x21, 0x43,
+        0x32, 0x60, 0x01, 0x00, 0x00, 0x40, 0x21, 0x43, 0x89, 0x7c, 0x21, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x21, 0x43, 0xef, 0xda, 0x21, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x43,
+        0x22, 0xfe, 0x21, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x43, 0x55, 0xd9, 0x24, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x43, 0x89, 0x3c, 0x22, 0x43, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x22, 0x43, 0x89, 0x7c, 0x22, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x22, 0x43,
+        0x89, 0xbc, 0x22, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x22, 0x43, 0x89, 0xfc, 0x22, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x23, 0x43, 0x89, 0x3c, 0x23, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x23, 0x43, 0x89, 0x7c, 0x23, 0x43, 0x3e, 0x50, 0x01, 0x00, 0x00, 0x80, 0x23, 0x43,
+        0x89, 0xec, 0x24, 0x43, 0x43, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xee, 0x72, 0x3f,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xf3, 0x3f, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xf3, 0x3f, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x11, 0x11, 0xf3, 0x3f, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x77, 0x77, 0xf9, 0x3f,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x1e, 0x40, 0x53, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x89, 0x88, 0x79, 0x40, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40,
+        0x89, 0x88, 0x79, 0x40, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x89, 0x88, 0x79, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x40, 0x22, 0x22, 0x2f, 0x40, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0x40, 0x22, 0x22, 0x3f, 0x40, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+        0x55, 0x55, 0x5e, 0x40, 0x53, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x55, 0x55, 0x7e, 0x40,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0xde, 0x5d, 0x9e, 0x40, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x80, 0x40, 0x44, 0xc4, 0xbc, 0x40, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x40,
+        0x44, 0xc4, 0xbc, 0x40, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x40, 0x44, 0xc4, 0xbc, 0x40,
+        0x3c, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x40, 0xde, 0x5d, 0xbe, 0x40, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x40, 0x44, 0xc4, 0xfc, 0x40, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40,
+        0x44, 0xc4, 0xfc, 0x40, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x44, 0xc4, 0xfc, 0x40,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x44, 0xc4, 0xfc, 0x40, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x41, 0xef, 0x2e, 0x0f, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+        0x22, 0x62, 0x1e, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x62, 0x1e, 0x41,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x62, 0x1e, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x10, 0x41, 0xef, 0x2e, 0x1f, 0x41, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41,
+        0x55, 0x95, 0x27, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x22, 0x62, 0x3e, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x41, 0x22, 0x62, 0x3e, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x20, 0x41, 0x22, 0x62, 0x3e, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x28, 0x41,
+        0x89, 0xc8, 0x2b, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x41, 0x89, 0xc8, 0x2f, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0x55, 0x95, 0x37, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0x41, 0x55, 0x95, 0x3f, 0x41, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41,
+        0x55, 0x95, 0x47, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0x22, 0x62, 0x5e, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41, 0x22, 0x62, 0x5e, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x40, 0x41, 0x22, 0x62, 0x5e, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x48, 0x41,
+        0x89, 0xc8, 0x4b, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x41, 0x89, 0xc8, 0x4f, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x41, 0x55, 0x95, 0x57, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x58, 0x41, 0x55, 0x95, 0x5f, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x41,
+        0x89, 0xc8, 0x76, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x41, 0x22, 0x62, 0x7e, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x41, 0x22, 0x62, 0x7e, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x60, 0x41, 0x22, 0x62, 0x7e, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x41,
+        0x77, 0x97, 0x87, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x41, 0x11, 0x31, 0x8f, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x41, 0x11, 0x31, 0x8f, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x80, 0x41, 0x11, 0x31, 0x8f, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x88, 0x41,
+        0x77, 0x97, 0x8f, 0x41, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0xab, 0xca, 0x93, 0x41,
+        0x53, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0x11, 0x31, 0x9f, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x90, 0x41, 0x11, 0x31, 0x9f, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41,
+        0x11, 0x31, 0x9f, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x94, 0x41, 0x44, 0xe4, 0x95, 0x41,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x96, 0x41, 0x44, 0xe4, 0x97, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x98, 0x41, 0xab, 0xca, 0x9b, 0x41, 0x53, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x41,
+        0xab, 0xca, 0x9f, 0x41, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x77, 0x97, 0xa7, 0x41,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x11, 0x31, 0xaf, 0x41, 0x35, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa0, 0x41, 0x11, 0x31, 0xaf, 0x41, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x41,
+        0x11, 0x31, 0xaf, 0x41, 0x3c, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x41, 0x77, 0x97, 0xaf, 0x41,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x41, 0x11, 0x31, 0xbf, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb0, 0x41, 0x11, 0x31, 0xbf, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x41,
+        0x11, 0x31, 0xbf, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x41, 0x11, 0x31, 0xbf, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x77, 0x97, 0xc7, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0x11, 0x31, 0xcf, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41,
+        0x11, 0x31, 0xcf, 0x41, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x11, 0x31, 0xcf, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x77, 0x97, 0xcf, 0x41, 0x4d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd0, 0x41, 0xab, 0xca, 0xd3, 0x41, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x41,
+        0x11, 0x31, 0xdf, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x41, 0x11, 0x31, 0xdf, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x41, 0x11, 0x31, 0xdf, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd4, 0x41, 0x44, 0xe4, 0xd5, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x41,
+        0x44, 0xe4, 0xd7, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x41, 0xab, 0xca, 0xdb, 0x41,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x41, 0xab, 0xca, 0xdf, 0x41, 0x4d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe0, 0x41, 0xab, 0xca, 0xe3, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41,
+        0x11, 0x31, 0xef, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x11, 0x31, 0xef, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x11, 0x31, 0xef, 0x41, 0x3e, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe4, 0x41, 0x44, 0xe4, 0xe5, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x41,
+        0x44, 0xe4, 0xe7, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0xab, 0xca, 0xeb, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xec, 0x41, 0xab, 0xca, 0xef, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf0, 0x41, 0x44, 0x64, 0xfb, 0x41, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0x11, 0x31, 0xff, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x11, 0x31, 0xff, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x11, 0x31, 0xff, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xfe, 0x41, 0x44, 0xe4, 0xff, 0x41, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+        0x22, 0xf2, 0x00, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x89, 0x98, 0x07, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x42, 0x89, 0x98, 0x07, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x42, 0x89, 0x98, 0x07, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x01, 0x42,
+        0x22, 0xf2, 0x01, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x22, 0xf2, 0x02, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0x42, 0x22, 0xf2, 0x03, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x42, 0x22, 0xf2, 0x04, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42,
+        0x22, 0xf2, 0x05, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x42, 0x22, 0xf2, 0x06, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x22, 0xf2, 0x07, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x42, 0x22, 0xf2, 0x08, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42,
+        0x89, 0x98, 0x0f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x08, 0x42, 0x89, 0x98, 0x0f, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x08, 0x42, 0x89, 0x98, 0x0f, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x09, 0x42, 0x22, 0xf2, 0x09, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x42,
+        0x22, 0xf2, 0x0a, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x42, 0x22, 0xf2, 0x0b, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x42, 0x22, 0xf2, 0x0c, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x0d, 0x42, 0x22, 0xf2, 0x0d, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x42,
+        0x22, 0xf2, 0x0e, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x22, 0xf2, 0x0f, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0xbc, 0xcb, 0x13, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x42, 0x89, 0x98, 0x17, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42,
+        0x89, 0x98, 0x17, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42, 0x89, 0x98, 0x17, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x14, 0x42, 0xef, 0x7e, 0x1d, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x42, 0x89, 0x98, 0x1f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x18, 0x42,
+        0x89, 0x98, 0x1f, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x18, 0x42, 0x89, 0x98, 0x1f, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x42, 0x22, 0xf2, 0x1f, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x42, 0x22, 0xf2, 0x20, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x42,
+        0x89, 0x98, 0x27, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x42, 0x89, 0x98, 0x27, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x42, 0x89, 0x98, 0x27, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x21, 0x42, 0x22, 0xf2, 0x21, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42,
+        0x22, 0xf2, 0x22, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x23, 0x42, 0x22, 0xf2, 0x23, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x22, 0xf2, 0x24, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x25, 0x42, 0x22, 0xf2, 0x25, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42,
+        0x22, 0xf2, 0x26, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x27, 0x42, 0x22, 0xf2, 0x27, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x22, 0xf2, 0x28, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x28, 0x42, 0x89, 0x98, 0x2f, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42,
+        0x89, 0x98, 0x2f, 0x42, 0x33, 0x50, 0x01, 0x00, 0x00, 0x00, 0x28, 0x42, 0x89, 0x98, 0x2f, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x29, 0x42, 0x22, 0xf2, 0x29, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2a, 0x42, 0x22, 0xf2, 0x2a, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x42,
+        0x22, 0xf2, 0x2b, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x42, 0x22, 0xf2, 0x2c, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x42, 0x22, 0xf2, 0x2d, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2e, 0x42, 0x22, 0xf2, 0x2e, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x42,
+        0x22, 0xf2, 0x2f, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x42, 0xbc, 0xcb, 0x33, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x42, 0x89, 0x98, 0x37, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x30, 0x42, 0x89, 0x98, 0x37, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x30, 0x42,
+        0x89, 0x98, 0x37, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x34, 0x42, 0xbc, 0xcb, 0x37, 0x42,
+        0x53, 0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0xbc, 0xcb, 0x3b, 0x42, 0x56, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0x42, 0x89, 0x98, 0x3f, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x38, 0x42,
+        0x89, 0x98, 0x3f, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x38, 0x42, 0x89, 0x98, 0x3f, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x42, 0xbc, 0xcb, 0x3f, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x42, 0xbc, 0xcb, 0x43, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42,
+        0x89, 0x98, 0x47, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0x89, 0x98, 0x47, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x42, 0x89, 0x98, 0x47, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x44, 0x42, 0xbc, 0xcb, 0x47, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42,
+        0x55, 0xe5, 0x49, 0x42, 0x53, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42, 0x89, 0x98, 0x4f, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x48, 0x42, 0x89, 0x98, 0x4f, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x48, 0x42, 0x89, 0x98, 0x4f, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4a, 0x42,
+        0x22, 0xf2, 0x4a, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x42, 0x22, 0xf2, 0x4b, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x42, 0x55, 0xe5, 0x4d, 0x42, 0x53, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x4e, 0x42, 0x55, 0xe5, 0x4f, 0x42, 0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x42,
+        0xbc, 0xcb, 0x53, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x42, 0x89, 0x98, 0x57, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x50, 0x42, 0x89, 0x98, 0x57, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x50, 0x42, 0x89, 0x98, 0x57, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x00, 0x00, 0x54, 0x42,
+        0xbc, 0xcb, 0x57, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42, 0x89, 0x98, 0x5f, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42, 0x89, 0x98, 0x5f, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x58, 0x42, 0x89, 0x98, 0x5f, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x42,
+        0x89, 0x98, 0x5f, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x42, 0xbc, 0xcb, 0x63, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x42, 0x89, 0x98, 0x67, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x60, 0x42, 0x89, 0x98, 0x67, 0x42, 0x35, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x42,
+        0x89, 0x98, 0x67, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x64, 0x42, 0xbc, 0xcb, 0x67, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42, 0x55, 0xe5, 0x69, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x68, 0x42, 0x89, 0x98, 0x6f, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x68, 0x42,
+        0x89, 0x98, 0x6f, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x68, 0x42, 0x89, 0x98, 0x6f, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x22, 0xf2, 0x6a, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x6b, 0x42, 0x22, 0xf2, 0x6b, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x42,
+        0x55, 0xe5, 0x6d, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x42, 0x55, 0xe5, 0x6f, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42, 0x55, 0xe5, 0x71, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x70, 0x42, 0x89, 0x98, 0x77, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42,
+        0x89, 0x98, 0x77, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42, 0x89, 0x98, 0x77, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x72, 0x42, 0x22, 0xf2, 0x72, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x73, 0x42, 0x22, 0xf2, 0x73, 0x42, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x74, 0x42,
+        0x55, 0xe5, 0x75, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x76, 0x42, 0x55, 0xe5, 0x77, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x42, 0x22, 0xb2, 0x7d, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0x42, 0x89, 0x98, 0x7f, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x78, 0x42,
+        0x89, 0x98, 0x7f, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x78, 0x42, 0x89, 0x98, 0x7f, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x42, 0x22, 0xf2, 0x7f, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x80, 0x42, 0x11, 0x79, 0x80, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42,
+        0x44, 0xcc, 0x83, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x42, 0x44, 0xcc, 0x83, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x80, 0x42, 0x44, 0xcc, 0x83, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x80, 0x42, 0x11, 0xf9, 0x80, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x81, 0x42,
+        0x11, 0x79, 0x81, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x80, 0x81, 0x42, 0x11, 0xf9, 0x81, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x42, 0x11, 0x79, 0x82, 0x42, 0x4c, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x82, 0x42, 0x11, 0xf9, 0x82, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x42,
+        0x11, 0x79, 0x83, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x80, 0x83, 0x42, 0x11, 0xf9, 0x83, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42, 0x11, 0x79, 0x84, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x84, 0x42, 0x44, 0xcc, 0x87, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42,
+        0x44, 0xcc, 0x87, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42, 0x44, 0xcc, 0x87, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x00, 0x80, 0x84, 0x42, 0x11, 0xf9, 0x84, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x85, 0x42, 0x11, 0x79, 0x85, 0x42, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x80, 0x85, 0x42,
+        0x11, 0xf9, 0x85, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x86, 0x42, 0x11, 0x79, 0x86, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0x80, 0x86, 0x42, 0x11, 0xf9, 0x86, 0x42, 0x4f, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x87, 0x42, 0x11, 0x79, 0x87, 0x42, 0x51, 0x50, 0x00, 0x00, 0x00, 0x80, 0x87, 0x42,
+        0x11, 0xf9, 0x87, 0x42, 0x53, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42, 0x44, 0xcc, 0x8b, 0x42,
+        0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42, 0x44, 0xcc, 0x8b, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x88, 0x42, 0x44, 0xcc, 0x8b, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x88, 0x42,
+        0x44, 0xcc, 0x8b, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x94, 0x3f, 0x3f,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xbf, 0x3f, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xbf, 0x3f, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xca, 0xbf, 0x3f, 0x3e, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x3f, 0x06, 0xaf, 0x79, 0x3f,
+        0x4a, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0x7c, 0x3f, 0xde, 0x1a, 0x96, 0x3f, 0x4d, 0x50, 0x00, 0x00,
+        0x21, 0x94, 0x97, 0x3f, 0x10, 0xaf, 0x2b, 0x40, 0x4c, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0xca, 0x3f,
+        0x6b, 0xf2, 0x44, 0x40, 0x37, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x3f, 0x6b, 0xf2, 0x44, 0x40,
+        0x3c, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x3f, 0x6b, 0xf2, 0x44, 0x40, 0x40, 0x50, 0x01, 0x00,
+        0xd6, 0x1a, 0x4a, 0x40, 0xed, 0xff, 0x88, 0x40, 0x4d, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0x4a, 0x40,
+        0xeb, 0xff, 0x94, 0x40, 0x39, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x40, 0xeb, 0xff, 0x94, 0x40,
+        0x3e, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x40, 0xeb, 0xff, 0x94, 0x40, 0x41, 0x50, 0x01, 0x00,
+        0x73, 0xf2, 0x8a, 0x40, 0xf9, 0xe4, 0x90, 0x40, 0x4f, 0x50, 0x00, 0x00, 0x4a, 0x43, 0x91, 0x40,
+        0xc9, 0x35, 0xc7, 0x40, 0x51, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x40, 0xa1, 0x86, 0xc7, 0x40,
+        0x39, 0x50, 0x01, 0x00, 0x21, 0x94, 0x97, 0x40, 0xa1, 0x86, 0xc7, 0x40, 0x3c, 0x50, 0x01, 0x00,
+        0x21, 0x94, 0x97, 0x40, 0xa1, 0x86, 0xc7, 0x40, 0x41, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x40,
+        0x58, 0x0d, 0xee, 0x40, 0x4a, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0xca, 0x40, 0x56, 0x0d, 0xfa, 0x40,
+        0x37, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x40, 0x56, 0x0d, 0xfa, 0x40, 0x3a, 0x50, 0x01, 0x00,
+        0xd6, 0x1a, 0xca, 0x40, 0x56, 0x0d, 0xfa, 0x40, 0x3e, 0x50, 0x01, 0x00, 0xde, 0xff, 0xef, 0x40,
+        0x64, 0xf2, 0xf5, 0x40, 0x4a, 0x50, 0x00, 0x00, 0xb5, 0x50, 0xf6, 0x40, 0x3b, 0x43, 0xfc, 0x40,
+        0x4d, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0xfc, 0x40, 0x06, 0x4a, 0x16, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0x8c, 0xa1, 0xfc, 0x40, 0x06, 0x4a, 0x16, 0x41, 0x37, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0xfc, 0x40,
+        0x06, 0x4a, 0x16, 0x41, 0x3c, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0xfc, 0x40, 0x06, 0x4a, 0x16, 0x41,
+        0x40, 0x50, 0x01, 0x00, 0x21, 0x94, 0x17, 0x41, 0x62, 0x8d, 0x29, 0x41, 0x4d, 0x50, 0x00, 0x00,
+        0x21, 0x94, 0x17, 0x41, 0x61, 0x8d, 0x2f, 0x41, 0x39, 0x50, 0x01, 0x00, 0x21, 0x94, 0x17, 0x41,
+        0x61, 0x8d, 0x2f, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x21, 0x94, 0x17, 0x41, 0x61, 0x8d, 0x2f, 0x41,
+        0x41, 0x50, 0x01, 0x00, 0xa5, 0x86, 0x2a, 0x41, 0xe8, 0x7f, 0x2d, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0x10, 0xaf, 0x2d, 0x41, 0x51, 0xa8, 0x3c, 0x41, 0x51, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0x30, 0x41,
+        0xbc, 0xd0, 0x48, 0x41, 0x39, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0x30, 0x41, 0xbc, 0xd0, 0x48, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0x30, 0x41, 0xbc, 0xd0, 0x48, 0x41, 0x41, 0x50, 0x01, 0x00,
+        0x29, 0x79, 0x3d, 0x41, 0x6b, 0x72, 0x49, 0x41, 0x4f, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0x4a, 0x41,
+        0x17, 0x14, 0x5c, 0x41, 0x4a, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0x4a, 0x41, 0x16, 0x14, 0x62, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x41, 0x16, 0x14, 0x62, 0x41, 0x3a, 0x50, 0x01, 0x00,
+        0xd6, 0x1a, 0x4a, 0x41, 0x16, 0x14, 0x62, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x5a, 0x0d, 0x5d, 0x41,
+        0x9d, 0x06, 0x60, 0x41, 0x4a, 0x50, 0x00, 0x00, 0xc6, 0x35, 0x60, 0x41, 0x09, 0x2f, 0x63, 0x41,
+        0x4d, 0x50, 0x00, 0x00, 0x31, 0x5e, 0x63, 0x41, 0x71, 0x57, 0x7b, 0x41, 0x4c, 0x50, 0x00, 0x00,
+        0x31, 0x5e, 0x63, 0x41, 0x71, 0x57, 0x7b, 0x41, 0x37, 0x50, 0x01, 0x00, 0x31, 0x5e, 0x63, 0x41,
+        0x71, 0x57, 0x7b, 0x41, 0x3c, 0x50, 0x01, 0x00, 0x31, 0x5e, 0x63, 0x41, 0x71, 0x57, 0x7b, 0x41,
+        0x40, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0x7c, 0x41, 0x66, 0x4d, 0x87, 0x41, 0x4d, 0x50, 0x00, 0x00,
+        0x8c, 0xa1, 0x7c, 0x41, 0x66, 0x4d, 0x8a, 0x41, 0x39, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0x7c, 0x41,
+        0x66, 0x4d, 0x8a, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0x7c, 0x41, 0x66, 0x4d, 0x8a, 0x41,
+        0x41, 0x50, 0x01, 0x00, 0x08, 0xca, 0x87, 0x41, 0xa9, 0x46, 0x89, 0x41, 0x4f, 0x50, 0x00, 0x00,
+        0x3e, 0x5e, 0x89, 0x41, 0xde, 0xda, 0x93, 0x41, 0x51, 0x50, 0x00, 0x00, 0x73, 0xf2, 0x8a, 0x41,
+        0x13, 0xef, 0x96, 0x41, 0x39, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x8a, 0x41, 0x13, 0xef, 0x96, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x8a, 0x41, 0x13, 0xef, 0x96, 0x41, 0x41, 0x50, 0x01, 0x00,
+        0xb5, 0x6b, 0x94, 0x41, 0x57, 0xe8, 0x95, 0x41, 0x45, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x95, 0x41,
+        0x8d, 0x7c, 0x97, 0x41, 0x48, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x41, 0xc2, 0x10, 0x9c, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x41, 0xc1, 0x90, 0xa3, 0x41, 0x3a, 0x50, 0x01, 0x00,
+        0x21, 0x94, 0x97, 0x41, 0xc1, 0x90, 0xa3, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x21, 0x94, 0x97, 0x41,
+        0xc1, 0x90, 0xa3, 0x41, 0x41, 0x50, 0x01, 0x00, 0xc2, 0x50, 0x9c, 0x41, 0x63, 0xcd, 0x9d, 0x41,
+        0x4c, 0x50, 0x00, 0x00, 0xf7, 0xe4, 0x9d, 0x41, 0x99, 0xe1, 0xa0, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0x63, 0x0d, 0xa1, 0x41, 0x04, 0x0a, 0xa4, 0x41, 0x48, 0x50, 0x00, 0x00, 0xce, 0x35, 0xa4, 0x41,
+        0x6f, 0x32, 0xad, 0x41, 0x45, 0x50, 0x00, 0x00, 0xce, 0x35, 0xa4, 0x41, 0x6e, 0x32, 0xb0, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0xce, 0x35, 0xa4, 0x41, 0x6e, 0x32, 0xb0, 0x41, 0x3e, 0x50, 0x01, 0x00,
+        0xce, 0x35, 0xa4, 0x41, 0x6e, 0x32, 0xb0, 0x41, 0x41, 0x50, 0x01, 0x00, 0x10, 0xaf, 0xad, 0x41,
+        0xb1, 0xab, 0xb0, 0x41, 0x45, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0xb0, 0x41, 0x1d, 0xd4, 0xb3, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0xb0, 0x41, 0x1b, 0xd4, 0xbc, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x7b, 0xd7, 0xb0, 0x41, 0x1b, 0xd4, 0xbc, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0xb0, 0x41,
+        0x1b, 0xd4, 0xbc, 0x41, 0x41, 0x50, 0x01, 0x00, 0xe7, 0xff, 0xb3, 0x41, 0x86, 0xfc, 0xc2, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x29, 0x79, 0xbd, 0x41, 0xc9, 0x75, 0xc9, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x29, 0x79, 0xbd, 0x41, 0xc9, 0x75, 0xc9, 0x41, 0x3c, 0x50, 0x01, 0x00, 0x29, 0x79, 0xbd, 0x41,
+        0xc9, 0x75, 0xc9, 0x41, 0x40, 0x50, 0x01, 0x00, 0x6b, 0xf2, 0xc6, 0x41, 0x0c, 0x6f, 0xc8, 0x41,
+        0x51, 0x50, 0x00, 0x00, 0xa1, 0x86, 0xc8, 0x41, 0x42, 0x03, 0xca, 0x41, 0x54, 0x50, 0x00, 0x00,
+        0xd6, 0x1a, 0xca, 0x41, 0x77, 0x97, 0xce, 0x41, 0x56, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0xca, 0x41,
+        0x76, 0x17, 0xd6, 0x41, 0x3a, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x41, 0x76, 0x17, 0xd6, 0x41,
+        0x3e, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0xca, 0x41, 0x76, 0x17, 0xd6, 0x41, 0x41, 0x50, 0x01, 0x00,
+        0x77, 0xd7, 0xce, 0x41, 0x19, 0x54, 0xd0, 0x41, 0x58, 0x50, 0x00, 0x00, 0xad, 0x6b, 0xd0, 0x41,
+        0x4e, 0x68, 0xd3, 0x41, 0x56, 0x50, 0x00, 0x00, 0x18, 0x94, 0xd3, 0x41, 0xba, 0x90, 0xd6, 0x41,
+        0x54, 0x50, 0x00, 0x00, 0x84, 0xbc, 0xd6, 0x41, 0x24, 0xb9, 0xdf, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x84, 0xbc, 0xd6, 0x41, 0x24, 0xb9, 0xe2, 0x41, 0x39, 0x50, 0x01, 0x00, 0x84, 0xbc, 0xd6, 0x41,
+        0x24, 0xb9, 0xe2, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x84, 0xbc, 0xd6, 0x41, 0x24, 0xb9, 0xe2, 0x41,
+        0x41, 0x50, 0x01, 0x00, 0xc6, 0x35, 0xe0, 0x41, 0x67, 0x32, 0xe3, 0x41, 0x51, 0x50, 0x00, 0x00,
+        0x31, 0x5e, 0xe3, 0x41, 0xd2, 0x5a, 0xe6, 0x41, 0x51, 0x50, 0x00, 0x00, 0x31, 0x5e, 0xe3, 0x41,
+        0xcf, 0x5a, 0xfb, 0x41, 0x37, 0x50, 0x01, 0x00, 0x31, 0x5e, 0xe3, 0x41, 0xcf, 0x5a, 0xfb, 0x41,
+        0x3c, 0x50, 0x01, 0x00, 0x31, 0x5e, 0xe3, 0x41, 0xcf, 0x5a, 0xfb, 0x41, 0x40, 0x50, 0x01, 0x00,
+        0x9c, 0x86, 0xe6, 0x41, 0x3c, 0x83, 0xf8, 0x41, 0x4f, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0xfc, 0x41,
+        0x16, 0x4f, 0x01, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0xfc, 0x41, 0x16, 0x4f, 0x04, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0xfc, 0x41, 0x16, 0x4f, 0x04, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x8c, 0xa1, 0xfc, 0x41, 0x16, 0x4f, 0x04, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x31, 0x79, 0x01, 0x42,
+        0x82, 0xf7, 0x02, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x67, 0x0d, 0x03, 0x42, 0xb7, 0x8b, 0x07, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x9d, 0xa1, 0x04, 0x42, 0xed, 0x9f, 0x0a, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x9d, 0xa1, 0x04, 0x42, 0xed, 0x9f, 0x0a, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x9d, 0xa1, 0x04, 0x42,
+        0xed, 0x9f, 0x0a, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x08, 0xca, 0x07, 0x42, 0x58, 0xc8, 0x0a, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x73, 0xf2, 0x0a, 0x42, 0xc4, 0xf0, 0x0d, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x73, 0xf2, 0x0a, 0x42, 0xc3, 0xf0, 0x10, 0x42, 0x39, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x0a, 0x42,
+        0xc3, 0xf0, 0x10, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x0a, 0x42, 0xc3, 0xf0, 0x10, 0x42,
+        0x41, 0x50, 0x01, 0x00, 0xdf, 0x1a, 0x0e, 0x42, 0x2f, 0x99, 0x0f, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x14, 0xaf, 0x0f, 0x42, 0x65, 0x2d, 0x14, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x4a, 0x43, 0x11, 0x42,
+        0x9a, 0x41, 0x17, 0x42, 0x37, 0x50, 0x01, 0x00, 0x4a, 0x43, 0x11, 0x42, 0x9a, 0x41, 0x17, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0x4a, 0x43, 0x11, 0x42, 0x9a, 0x41, 0x17, 0x42, 0x40, 0x50, 0x01, 0x00,
+        0xb5, 0x6b, 0x14, 0x42, 0x06, 0x6a, 0x17, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x21, 0x94, 0x17, 0x42,
+        0x71, 0x92, 0x1a, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x21, 0x94, 0x17, 0x42, 0x71, 0x92, 0x1d, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x21, 0x94, 0x17, 0x42, 0x71, 0x92, 0x1d, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x21, 0x94, 0x17, 0x42, 0x71, 0x92, 0x1d, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x8c, 0xbc, 0x1a, 0x42,
+        0xdd, 0x3a, 0x1c, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xc2, 0x50, 0x1c, 0x42, 0x12, 0xcf, 0x20, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0xf7, 0xe4, 0x1d, 0x42, 0x47, 0xe3, 0x23, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0xf7, 0xe4, 0x1d, 0x42, 0x47, 0xe3, 0x23, 0x42, 0x3a, 0x50, 0x01, 0x00, 0xf7, 0xe4, 0x1d, 0x42,
+        0x47, 0xe3, 0x23, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x63, 0x0d, 0x21, 0x42, 0xb3, 0x0b, 0x24, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0xce, 0x35, 0x24, 0x42, 0x1f, 0x34, 0x27, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0xce, 0x35, 0x24, 0x42, 0x1e, 0x34, 0x2a, 0x42, 0x39, 0x50, 0x01, 0x00, 0xce, 0x35, 0x24, 0x42,
+        0x1e, 0x34, 0x2a, 0x42, 0x3c, 0x50, 0x01, 0x00, 0xce, 0x35, 0x24, 0x42, 0x1e, 0x34, 0x2a, 0x42,
+        0x41, 0x50, 0x01, 0x00, 0x39, 0x5e, 0x27, 0x42, 0x8a, 0xdc, 0x28, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x6f, 0xf2, 0x28, 0x42, 0xbf, 0x70, 0x2d, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xa5, 0x86, 0x2a, 0x42,
+        0xf5, 0x84, 0x30, 0x42, 0x37, 0x50, 0x01, 0x00, 0xa5, 0x86, 0x2a, 0x42, 0xf5, 0x84, 0x30, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0xa5, 0x86, 0x2a, 0x42, 0xf5, 0x84, 0x30, 0x42, 0x40, 0x50, 0x01, 0x00,
+        0x10, 0xaf, 0x2d, 0x42, 0x61, 0xad, 0x30, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0x30, 0x42,
+        0xcc, 0xd5, 0x33, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0x30, 0x42, 0xcb, 0xd5, 0x36, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0x30, 0x42, 0xcb, 0xd5, 0x36, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x7b, 0xd7, 0x30, 0x42, 0xcb, 0xd5, 0x36, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xe7, 0xff, 0x33, 0x42,
+        0x37, 0x7e, 0x35, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x1d, 0x94, 0x35, 0x42, 0x6d, 0x12, 0x3a, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x52, 0x28, 0x37, 0x42, 0xa2, 0x26, 0x3d, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x52, 0x28, 0x37, 0x42, 0xa2, 0x26, 0x3d, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x52, 0x28, 0x37, 0x42,
+        0xa2, 0x26, 0x3d, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xbe, 0x50, 0x3a, 0x42, 0x0e, 0x4f, 0x3d, 0x42,
+        0x4d, 0x50, 0x00, 0x00, 0x29, 0x79, 0x3d, 0x42, 0x79, 0x77, 0x40, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x29, 0x79, 0x3d, 0x42, 0x79, 0x77, 0x43, 0x42, 0x39, 0x50, 0x01, 0x00, 0x29, 0x79, 0x3d, 0x42,
+        0x79, 0x77, 0x43, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x29, 0x79, 0x3d, 0x42, 0x79, 0x77, 0x43, 0x42,
+        0x41, 0x50, 0x01, 0x00, 0x94, 0xa1, 0x40, 0x42, 0xe5, 0x1f, 0x42, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0xca, 0x35, 0x42, 0x42, 0x1a, 0xb4, 0x46, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x00, 0xca, 0x43, 0x42,
+        0x50, 0xc8, 0x49, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0xca, 0x43, 0x42, 0x50, 0xc8, 0x49, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0x00, 0xca, 0x43, 0x42, 0x50, 0xc8, 0x49, 0x42, 0x40, 0x50, 0x01, 0x00,
+        0x6b, 0xf2, 0x46, 0x42, 0xbb, 0xf0, 0x49, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0x4a, 0x42,
+        0x27, 0xd9, 0x4a, 0x42, 0x56, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0x4a, 0x42, 0x26, 0x19, 0x50, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x42, 0x26, 0x19, 0x50, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0xd6, 0x1a, 0x4a, 0x42, 0x26, 0x19, 0x50, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xf1, 0xe4, 0x4a, 0x42,
+        0x42, 0xa3, 0x4b, 0x42, 0x54, 0x50, 0x00, 0x00, 0x0c, 0xaf, 0x4b, 0x42, 0x5d, 0x2d, 0x4d, 0x42,
+        0x56, 0x50, 0x00, 0x00, 0x42, 0x43, 0x4d, 0x42, 0x92, 0x01, 0x4e, 0x42, 0x54, 0x50, 0x00, 0x00,
+        0x5c, 0x0d, 0x4e, 0x42, 0xad, 0xcb, 0x4e, 0x42, 0x51, 0x50, 0x00, 0x00, 0x77, 0xd7, 0x4e, 0x42,
+        0xc8, 0xd5, 0x51, 0x42, 0x54, 0x50, 0x00, 0x00, 0xad, 0x6b, 0x50, 0x42, 0xfd, 0x69, 0x56, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0xad, 0x6b, 0x50, 0x42, 0xfd, 0x69, 0x56, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0xad, 0x6b, 0x50, 0x42, 0xfd, 0x69, 0x56, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xe3, 0xff, 0x51, 0x42,
+        0x33, 0xbe, 0x52, 0x42, 0x51, 0x50, 0x00, 0x00, 0xfd, 0xc9, 0x52, 0x42, 0x4e, 0x88, 0x53, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x18, 0x94, 0x53, 0x42, 0x69, 0x12, 0x55, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x84, 0xbc, 0x56, 0x42, 0xd4, 0x7a, 0x57, 0x42, 0x51, 0x50, 0x00, 0x00, 0x84, 0xbc, 0x56, 0x42,
+        0xd4, 0xba, 0x5c, 0x42, 0x39, 0x50, 0x01, 0x00, 0x84, 0xbc, 0x56, 0x42, 0xd4, 0xba, 0x5c, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0x84, 0xbc, 0x56, 0x42, 0xd4, 0xba, 0x5c, 0x42, 0x41, 0x50, 0x01, 0x00,
+        0x9e, 0x86, 0x57, 0x42, 0xef, 0x44, 0x58, 0x42, 0x4f, 0x50, 0x00, 0x00, 0xb9, 0x50, 0x58, 0x42,
+        0x0a, 0xcf, 0x59, 0x42, 0x51, 0x50, 0x00, 0x00, 0xef, 0xe4, 0x59, 0x42, 0x40, 0xa3, 0x5a, 0x42,
+        0x4f, 0x50, 0x00, 0x00, 0x0a, 0xaf, 0x5a, 0x42, 0x5b, 0x6d, 0x5b, 0x42, 0x4d, 0x50, 0x00, 0x00,
+        0x25, 0x79, 0x5b, 0x42, 0x75, 0x77, 0x5e, 0x42, 0x4f, 0x50, 0x00, 0x00, 0x5a, 0x0d, 0x5d, 0x42,
+        0xaa, 0x0b, 0x63, 0x42, 0x37, 0x50, 0x01, 0x00, 0x5a, 0x0d, 0x5d, 0x42, 0xaa, 0x0b, 0x63, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0x5a, 0x0d, 0x5d, 0x42, 0xaa, 0x0b, 0x63, 0x42, 0x40, 0x50, 0x01, 0x00,
+        0x90, 0xa1, 0x5e, 0x42, 0xe1, 0x5f, 0x5f, 0x42, 0x4c, 0x50, 0x00, 0x00, 0xab, 0x6b, 0x5f, 0x42,
+        0xfc, 0x29, 0x60, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xc6, 0x35, 0x60, 0x42, 0x16, 0xb4, 0x61, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x31, 0x5e, 0x63, 0x42, 0x82, 0x1c, 0x64, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x31, 0x5e, 0x63, 0x42, 0x81, 0x5c, 0x69, 0x42, 0x32, 0x50, 0x01, 0x00, 0x31, 0x5e, 0x63, 0x42,
+        0x81, 0x5c, 0x69, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x4c, 0x28, 0x64, 0x42, 0x9d, 0xe6, 0x64, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x67, 0xf2, 0x64, 0x42, 0xb7, 0x70, 0x66, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x9c, 0x86, 0x66, 0x42, 0xed, 0x44, 0x67, 0x42, 0x48, 0x50, 0x00, 0x00, 0xb7, 0x50, 0x67, 0x42,
+        0x08, 0x0f, 0x68, 0x42, 0x45, 0x50, 0x00, 0x00, 0xd2, 0x1a, 0x68, 0x42, 0x22, 0x19, 0x6b, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x08, 0xaf, 0x69, 0x42, 0x58, 0xad, 0x6f, 0x42, 0x2e, 0x50, 0x01, 0x00,
+        0x08, 0xaf, 0x69, 0x42, 0x58, 0xad, 0x6f, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x3d, 0x43, 0x6b, 0x42,
+        0x8e, 0x01, 0x6c, 0x42, 0x45, 0x50, 0x00, 0x00, 0x58, 0x0d, 0x6c, 0x42, 0xa9, 0xcb, 0x6c, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x73, 0xd7, 0x6c, 0x42, 0xc4, 0xd5, 0x6f, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xde, 0xff, 0x6f, 0x42, 0x2f, 0xbe, 0x70, 0x42, 0x45, 0x50, 0x00, 0x00, 0xde, 0xff, 0x6f, 0x42,
+        0x2e, 0xfe, 0x75, 0x42, 0x29, 0x50, 0x01, 0x00, 0xde, 0xff, 0x6f, 0x42, 0x2e, 0xfe, 0x75, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0xf9, 0xc9, 0x70, 0x42, 0x4a, 0x88, 0x71, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x14, 0x94, 0x71, 0x42, 0x65, 0x12, 0x73, 0x42, 0x45, 0x50, 0x00, 0x00, 0x4a, 0x28, 0x73, 0x42,
+        0x9b, 0xe6, 0x73, 0x42, 0x43, 0x50, 0x00, 0x00, 0x65, 0xf2, 0x73, 0x42, 0xb5, 0xb0, 0x74, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x7f, 0xbc, 0x74, 0x42, 0xd0, 0xba, 0x77, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xb5, 0x50, 0x76, 0x42, 0x05, 0x4f, 0x7c, 0x42, 0x30, 0x50, 0x01, 0x00, 0xeb, 0xe4, 0x77, 0x42,
+        0x3c, 0xa3, 0x78, 0x42, 0x40, 0x50, 0x00, 0x00, 0x06, 0xaf, 0x78, 0x42, 0x56, 0x6d, 0x79, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x20, 0x79, 0x79, 0x42, 0x71, 0xf7, 0x7a, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x56, 0x0d, 0x7b, 0x42, 0xa7, 0xcb, 0x7b, 0x42, 0x45, 0x50, 0x00, 0x00, 0x71, 0xd7, 0x7b, 0x42,
+        0xc2, 0x95, 0x7c, 0x42, 0x48, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0x7c, 0x42, 0xdd, 0x5f, 0x7d, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0x7c, 0x42, 0xee, 0x4f, 0x81, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x8c, 0xa1, 0x7c, 0x42, 0xee, 0x4f, 0x81, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xa7, 0x6b, 0x7d, 0x42,
+        0xf7, 0x29, 0x7e, 0x42, 0x48, 0x50, 0x00, 0x00, 0xc2, 0x35, 0x7e, 0x42, 0x12, 0xb4, 0x7f, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xf7, 0xc9, 0x7f, 0x42, 0x24, 0x44, 0x80, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x09, 0x4a, 0x80, 0x42, 0x31, 0xa9, 0x80, 0x42, 0x45, 0x50, 0x00, 0x00, 0x16, 0xaf, 0x80, 0x42,
+        0x3f, 0x2e, 0x82, 0x42, 0x48, 0x50, 0x00, 0x00, 0x31, 0x79, 0x81, 0x42, 0x59, 0x78, 0x84, 0x42,
+        0x2e, 0x50, 0x01, 0x00, 0x31, 0x79, 0x81, 0x42, 0x59, 0x78, 0x84, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x4c, 0x43, 0x82, 0x42, 0x74, 0xa2, 0x82, 0x42, 0x45, 0x50, 0x00, 0x00, 0x5a, 0xa8, 0x82, 0x42,
+        0x82, 0x07, 0x83, 0x42, 0x43, 0x50, 0x00, 0x00, 0x67, 0x0d, 0x83, 0x42, 0x8f, 0xcc, 0x83, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x82, 0xd7, 0x83, 0x42, 0xaa, 0x36, 0x84, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x8f, 0x3c, 0x84, 0x42, 0xb8, 0x9b, 0x84, 0x42, 0x45, 0x50, 0x00, 0x00, 0x9d, 0xa1, 0x84, 0x42,
+        0xc5, 0x00, 0x85, 0x42, 0x45, 0x50, 0x00, 0x00, 0x9d, 0xa1, 0x84, 0x42, 0xc5, 0xa0, 0x87, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x9d, 0xa1, 0x84, 0x42, 0xc5, 0xa0, 0x87, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0xaa, 0x06, 0x85, 0x42, 0xd2, 0x65, 0x85, 0x42, 0x43, 0x50, 0x00, 0x00, 0xb7, 0x6b, 0x85, 0x42,
+        0xe0, 0x2a, 0x86, 0x42, 0x45, 0x50, 0x00, 0x00, 0xd2, 0x35, 0x86, 0x42, 0xfb, 0x94, 0x86, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xe0, 0x9a, 0x86, 0x42, 0x08, 0xfa, 0x86, 0x42, 0x41, 0x50, 0x00, 0x00,
+        0xed, 0xff, 0x86, 0x42, 0x15, 0x7f, 0x88, 0x42, 0x43, 0x50, 0x00, 0x00, 0x08, 0xca, 0x87, 0x42,
+        0x30, 0xc9, 0x8a, 0x42, 0x30, 0x50, 0x01, 0x00, 0x23, 0x94, 0x88, 0x42, 0x4b, 0xf3, 0x88, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x30, 0xf9, 0x88, 0x42, 0x59, 0x58, 0x89, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x3e, 0x5e, 0x89, 0x42, 0x66, 0xbd, 0x89, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x4b, 0xc3, 0x89, 0x42,
+        0x73, 0x22, 0x8a, 0x42, 0x39, 0x50, 0x00, 0x00, 0x58, 0x28, 0x8a, 0x42, 0x81, 0x87, 0x8a, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x66, 0x8d, 0x8a, 0x42, 0x8e, 0xec, 0x8a, 0x42, 0x41, 0x50, 0x00, 0x00,
+        0x73, 0xf2, 0x8a, 0x42, 0x9c, 0x51, 0x8b, 0x42, 0x45, 0x50, 0x00, 0x00, 0x73, 0xf2, 0x8a, 0x42,
+        0x9b, 0xf1, 0x8d, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x73, 0xf2, 0x8a, 0x42, 0x9b, 0xf1, 0x8d, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x81, 0x57, 0x8b, 0x42, 0xa9, 0x76, 0x8c, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xa9, 0x86, 0x8c, 0x42, 0xd1, 0xe5, 0x8c, 0x42, 0x45, 0x50, 0x00, 0x00, 0xb6, 0xeb, 0x8c, 0x42,
+        0xdf, 0xca, 0x8e, 0x42, 0x43, 0x50, 0x00, 0x00, 0xdf, 0x1a, 0x8e, 0x42, 0x07, 0x1a, 0x91, 0x42,
+        0x2e, 0x50, 0x01, 0x00, 0xdf, 0x1a, 0x8e, 0x42, 0x07, 0x1a, 0x91, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0xf9, 0xe4, 0x8e, 0x42, 0x22, 0x44, 0x8f, 0x42, 0x45, 0x50, 0x00, 0x00, 0x07, 0x4a, 0x8f, 0x42,
+        0x2f, 0xa9, 0x8f, 0x42, 0x43, 0x50, 0x00, 0x00, 0x14, 0xaf, 0x8f, 0x42, 0x3d, 0x2e, 0x91, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x4a, 0x43, 0x91, 0x42, 0x72, 0xa2, 0x91, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x4a, 0x43, 0x91, 0x42, 0x72, 0x42, 0x94, 0x42, 0x29, 0x50, 0x01, 0x00, 0x4a, 0x43, 0x91, 0x42,
+        0x72, 0x42, 0x94, 0x42, 0x35, 0x50, 0x01, 0x00, 0x57, 0xa8, 0x91, 0x42, 0x80, 0xc7, 0x92, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x80, 0xd7, 0x92, 0x42, 0xa8, 0x36, 0x93, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x8d, 0x3c, 0x93, 0x42, 0xb5, 0x1b, 0x95, 0x42, 0x43, 0x50, 0x00, 0x00, 0xb5, 0x6b, 0x94, 0x42,
+        0xdd, 0x6a, 0x97, 0x42, 0x30, 0x50, 0x01, 0x00, 0xb5, 0x6b, 0x94, 0x42, 0xdd, 0x6a, 0x97, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0xd0, 0x35, 0x95, 0x42, 0xf9, 0x94, 0x95, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xde, 0x9a, 0x95, 0x42, 0x06, 0xfa, 0x95, 0x42, 0x43, 0x50, 0x00, 0x00, 0xeb, 0xff, 0x95, 0x42,
+        0x13, 0x7f, 0x97, 0x42, 0x43, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x42, 0x49, 0xf3, 0x97, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x21, 0x94, 0x97, 0x42, 0x49, 0x93, 0x9a, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x21, 0x94, 0x97, 0x42, 0x49, 0x93, 0x9a, 0x42, 0x37, 0x50, 0x01, 0x00, 0x2e, 0xf9, 0x97, 0x42,
+        0x56, 0x18, 0x99, 0x42, 0x43, 0x50, 0x00, 0x00, 0x56, 0x28, 0x99, 0x42, 0x7f, 0x87, 0x99, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x64, 0x8d, 0x99, 0x42, 0x8c, 0x6c, 0x9b, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x8c, 0xbc, 0x9a, 0x42, 0xb4, 0xbb, 0x9d, 0x42, 0x2e, 0x50, 0x01, 0x00, 0x8c, 0xbc, 0x9a, 0x42,
+        0xb4, 0xbb, 0x9d, 0x42, 0x3a, 0x50, 0x01, 0x00, 0xa7, 0x86, 0x9b, 0x42, 0xcf, 0xe5, 0x9b, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xb4, 0xeb, 0x9b, 0x42, 0xdd, 0x4a, 0x9c, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xc2, 0x50, 0x9c, 0x42, 0xea, 0xcf, 0x9d, 0x42, 0x43, 0x50, 0x00, 0x00, 0xf7, 0xe4, 0x9d, 0x42,
+        0x20, 0xa4, 0x9e, 0x42, 0x3c, 0x50, 0x00, 0x00, 0xf7, 0xe4, 0x9d, 0x42, 0x1f, 0xe4, 0xa0, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0xf7, 0xe4, 0x9d, 0x42, 0x1f, 0xe4, 0xa0, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x12, 0xaf, 0x9e, 0x42, 0x3b, 0x6e, 0x9f, 0x42, 0x41, 0x50, 0x00, 0x00, 0x2d, 0x79, 0x9f, 0x42,
+        0x55, 0x38, 0xa0, 0x42, 0x43, 0x50, 0x00, 0x00, 0x48, 0x43, 0xa0, 0x42, 0x70, 0xa2, 0xa0, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x55, 0xa8, 0xa0, 0x42, 0x7e, 0xc7, 0xa1, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x63, 0x0d, 0xa1, 0x42, 0x8b, 0x0c, 0xa4, 0x42, 0x30, 0x50, 0x01, 0x00, 0x7e, 0xd7, 0xa1, 0x42,
+        0xa6, 0x36, 0xa2, 0x42, 0x40, 0x50, 0x00, 0x00, 0x8b, 0x3c, 0xa2, 0x42, 0xb3, 0x9b, 0xa2, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x98, 0xa1, 0xa2, 0x42, 0xc1, 0x60, 0xa3, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0xce, 0x35, 0xa4, 0x42, 0xf6, 0x94, 0xa4, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xce, 0x35, 0xa4, 0x42,
+        0xf6, 0x34, 0xa7, 0x42, 0x32, 0x50, 0x01, 0x00, 0xce, 0x35, 0xa4, 0x42, 0xf6, 0x34, 0xa7, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0xdc, 0x9a, 0xa4, 0x42, 0x04, 0xfa, 0xa4, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0xe9, 0xff, 0xa4, 0x42, 0x11, 0xbf, 0xa5, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x04, 0xca, 0xa5, 0x42,
+        0x2c, 0x29, 0xa6, 0x42, 0x48, 0x50, 0x00, 0x00, 0x11, 0x2f, 0xa6, 0x42, 0x3a, 0x8e, 0xa6, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x1f, 0x94, 0xa6, 0x42, 0x47, 0x13, 0xa8, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x39, 0x5e, 0xa7, 0x42, 0x61, 0x5d, 0xaa, 0x42, 0x32, 0x50, 0x01, 0x00, 0x39, 0x5e, 0xa7, 0x42,
+        0x61, 0x5d, 0xaa, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x54, 0x28, 0xa8, 0x42, 0x7d, 0x87, 0xa8, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x62, 0x8d, 0xa8, 0x42, 0x8a, 0xec, 0xa8, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x6f, 0xf2, 0xa8, 0x42, 0x97, 0x71, 0xaa, 0x42, 0x45, 0x50, 0x00, 0x00, 0xa5, 0x86, 0xaa, 0x42,
+        0xcd, 0xe5, 0xaa, 0x42, 0x45, 0x50, 0x00, 0x00, 0xa5, 0x86, 0xaa, 0x42, 0xcd, 0x85, 0xad, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0xa5, 0x86, 0xaa, 0x42, 0xcd, 0x85, 0xad, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0xb2, 0xeb, 0xaa, 0x42, 0xdb, 0x4a, 0xab, 0x42, 0x43, 0x50, 0x00, 0x00, 0xc0, 0x50, 0xab, 0x42,
+        0xe8, 0x0f, 0xac, 0x42, 0x45, 0x50, 0x00, 0x00, 0xda, 0x1a, 0xac, 0x42, 0x03, 0x7a, 0xac, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xe8, 0x7f, 0xac, 0x42, 0x10, 0xdf, 0xac, 0x42, 0x41, 0x50, 0x00, 0x00,
+        0xf5, 0xe4, 0xac, 0x42, 0x1e, 0x64, 0xae, 0x42, 0x43, 0x50, 0x00, 0x00, 0x10, 0xaf, 0xad, 0x42,
+        0x38, 0xae, 0xb0, 0x42, 0x30, 0x50, 0x01, 0x00, 0x2b, 0x79, 0xae, 0x42, 0x53, 0xd8, 0xae, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x38, 0xde, 0xae, 0x42, 0x61, 0x3d, 0xaf, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x46, 0x43, 0xaf, 0x42, 0x38, 0xae, 0xb0, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0xb0, 0x42,
+        0xa4, 0x36, 0xb1, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0xb0, 0x42, 0xa3, 0xd6, 0xb3, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0xb0, 0x42, 0xa3, 0xd6, 0xb3, 0x42, 0x3e, 0x50, 0x01, 0x00,
+        0x89, 0x3c, 0xb1, 0x42, 0xb1, 0x9b, 0xb1, 0x42, 0x48, 0x50, 0x00, 0x00, 0x96, 0xa1, 0xb1, 0x42,
+        0xbf, 0x60, 0xb2, 0x42, 0x4a, 0x50, 0x00, 0x00, 0xb1, 0x6b, 0xb2, 0x42, 0xda, 0xca, 0xb2, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0xbf, 0xd0, 0xb2, 0x42, 0xe7, 0x2f, 0xb3, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xcc, 0x35, 0xb3, 0x42, 0xf4, 0xb4, 0xb4, 0x42, 0x48, 0x50, 0x00, 0x00, 0xe7, 0xff, 0xb3, 0x42,
+        0x0f, 0xff, 0xb6, 0x42, 0x32, 0x50, 0x01, 0x00, 0xe7, 0xff, 0xb3, 0x42, 0x0f, 0xff, 0xb6, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x02, 0xca, 0xb4, 0x42, 0x2a, 0x29, 0xb5, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x0f, 0x2f, 0xb5, 0x42, 0x37, 0x8e, 0xb5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x1d, 0x94, 0xb5, 0x42,
+        0x45, 0xb3, 0xb6, 0x42, 0x45, 0x50, 0x00, 0x00, 0x45, 0xc3, 0xb6, 0x42, 0x6d, 0x22, 0xb7, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x52, 0x28, 0xb7, 0x42, 0x7b, 0x87, 0xb7, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x52, 0x28, 0xb7, 0x42, 0x7a, 0x27, 0xba, 0x42, 0x29, 0x50, 0x01, 0x00, 0x52, 0x28, 0xb7, 0x42,
+        0x7a, 0x27, 0xba, 0x42, 0x35, 0x50, 0x01, 0x00, 0x60, 0x8d, 0xb7, 0x42, 0x88, 0xec, 0xb7, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x6d, 0xf2, 0xb7, 0x42, 0x95, 0xb1, 0xb8, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x88, 0xbc, 0xb8, 0x42, 0xb0, 0x1b, 0xb9, 0x42, 0x43, 0x50, 0x00, 0x00, 0x95, 0x21, 0xb9, 0x42,
+        0xbe, 0x80, 0xb9, 0x42, 0x41, 0x50, 0x00, 0x00, 0xa3, 0x86, 0xb9, 0x42, 0xcb, 0x05, 0xbb, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xbe, 0x50, 0xba, 0x42, 0xe6, 0x4f, 0xbd, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0xd8, 0x1a, 0xbb, 0x42, 0x01, 0x7a, 0xbb, 0x42, 0x40, 0x50, 0x00, 0x00, 0xe6, 0x7f, 0xbb, 0x42,
+        0x0e, 0xdf, 0xbb, 0x42, 0x3e, 0x50, 0x00, 0x00, 0xf3, 0xe4, 0xbb, 0x42, 0xe6, 0x4f, 0xbd, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0x29, 0x79, 0xbd, 0x42, 0x51, 0xd8, 0xbd, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x29, 0x79, 0xbd, 0x42, 0x51, 0x78, 0xc0, 0x42, 0x32, 0x50, 0x01, 0x00, 0x29, 0x79, 0xbd, 0x42,
+        0x51, 0x78, 0xc0, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x36, 0xde, 0xbd, 0x42, 0x5f, 0x3d, 0xbe, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x44, 0x43, 0xbe, 0x42, 0x6c, 0x02, 0xbf, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x5f, 0x0d, 0xbf, 0x42, 0x87, 0x6c, 0xbf, 0x42, 0x48, 0x50, 0x00, 0x00, 0x6c, 0x72, 0xbf, 0x42,
+        0x94, 0xd1, 0xbf, 0x42, 0x45, 0x50, 0x00, 0x00, 0x79, 0xd7, 0xbf, 0x42, 0xa2, 0x56, 0xc1, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0x94, 0xa1, 0xc0, 0x42, 0xbc, 0xa0, 0xc3, 0x42, 0x2e, 0x50, 0x01, 0x00,
+        0x94, 0xa1, 0xc0, 0x42, 0xbc, 0xa0, 0xc3, 0x42, 0x3a, 0x50, 0x01, 0x00, 0xaf, 0x6b, 0xc1, 0x42,
+        0xd7, 0xca, 0xc1, 0x42, 0x45, 0x50, 0x00, 0x00, 0xbc, 0xd0, 0xc1, 0x42, 0xe5, 0x2f, 0xc2, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xca, 0x35, 0xc2, 0x42, 0xf2, 0xb4, 0xc3, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0xca, 0xc3, 0x42, 0x28, 0x29, 0xc4, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0xca, 0xc3, 0x42,
+        0x28, 0xc9, 0xc6, 0x42, 0x29, 0x50, 0x01, 0x00, 0x00, 0xca, 0xc3, 0x42, 0x28, 0xc9, 0xc6, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x0d, 0x2f, 0xc4, 0x42, 0x35, 0x8e, 0xc4, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x1a, 0x94, 0xc4, 0x42, 0x43, 0x53, 0xc5, 0x42, 0x45, 0x50, 0x00, 0x00, 0x35, 0x5e, 0xc5, 0x42,
+        0x5e, 0xbd, 0xc5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x43, 0xc3, 0xc5, 0x42, 0x6b, 0x22, 0xc6, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x50, 0x28, 0xc6, 0x42, 0x78, 0xa7, 0xc7, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x6b, 0xf2, 0xc6, 0x42, 0x93, 0xf1, 0xc9, 0x42, 0x30, 0x50, 0x01, 0x00, 0x86, 0xbc, 0xc7, 0x42,
+        0xae, 0x1b, 0xc8, 0x42, 0x40, 0x50, 0x00, 0x00, 0x93, 0x21, 0xc8, 0x42, 0xbc, 0x80, 0xc8, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0xa1, 0x86, 0xc8, 0x42, 0xc9, 0x45, 0xc9, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0xbb, 0x50, 0xc9, 0x42, 0xe4, 0xaf, 0xc9, 0x42, 0x45, 0x50, 0x00, 0x00, 0xc9, 0xb5, 0xc9, 0x42,
+        0xf1, 0x14, 0xca, 0x42, 0x48, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0xca, 0x42, 0xff, 0x79, 0xca, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0xca, 0x42, 0xfe, 0x19, 0xcd, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0xd6, 0x1a, 0xca, 0x42, 0xfe, 0x19, 0xcd, 0x42, 0x3e, 0x50, 0x01, 0x00, 0xe4, 0x7f, 0xca, 0x42,
+        0x0c, 0xdf, 0xca, 0x42, 0x48, 0x50, 0x00, 0x00, 0xf1, 0xe4, 0xca, 0x42, 0x19, 0xa4, 0xcb, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x0c, 0xaf, 0xcb, 0x42, 0x34, 0x0e, 0xcc, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x19, 0x14, 0xcc, 0x42, 0x42, 0x73, 0xcc, 0x42, 0x45, 0x50, 0x00, 0x00, 0x27, 0x79, 0xcc, 0x42,
+        0x4f, 0xf8, 0xcd, 0x42, 0x48, 0x50, 0x00, 0x00, 0x42, 0x43, 0xcd, 0x42, 0x6a, 0x42, 0xd0, 0x42,
+        0x2e, 0x50, 0x01, 0x00, 0x42, 0x43, 0xcd, 0x42, 0x6a, 0x42, 0xd0, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x5c, 0x0d, 0xce, 0x42, 0x85, 0x6c, 0xce, 0x42, 0x45, 0x50, 0x00, 0x00, 0x6a, 0x72, 0xce, 0x42,
+        0x92, 0xd1, 0xce, 0x42, 0x43, 0x50, 0x00, 0x00, 0x77, 0xd7, 0xce, 0x42, 0xa0, 0x96, 0xcf, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x92, 0xa1, 0xcf, 0x42, 0xba, 0x00, 0xd0, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0xa0, 0x06, 0xd0, 0x42, 0xc8, 0x65, 0xd0, 0x42, 0x45, 0x50, 0x00, 0x00, 0xad, 0x6b, 0xd0, 0x42,
+        0xd5, 0xca, 0xd0, 0x42, 0x45, 0x50, 0x00, 0x00, 0xad, 0x6b, 0xd0, 0x42, 0xd5, 0x6a, 0xd3, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0xad, 0x6b, 0xd0, 0x42, 0xd5, 0x6a, 0xd3, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0xba, 0xd0, 0xd0, 0x42, 0xe3, 0x2f, 0xd1, 0x42, 0x43, 0x50, 0x00, 0x00, 0xc8, 0x35, 0xd1, 0x42,
+        0xf0, 0xf4, 0xd1, 0x42, 0x45, 0x50, 0x00, 0x00, 0xe3, 0xff, 0xd1, 0x42, 0x0b, 0x5f, 0xd2, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xf0, 0x64, 0xd2, 0x42, 0x18, 0xc4, 0xd2, 0x42, 0x41, 0x50, 0x00, 0x00,
+        0xfd, 0xc9, 0xd2, 0x42, 0x26, 0x49, 0xd4, 0x42, 0x43, 0x50, 0x00, 0x00, 0x18, 0x94, 0xd3, 0x42,
+        0x40, 0x93, 0xd6, 0x42, 0x30, 0x50, 0x01, 0x00, 0x33, 0x5e, 0xd4, 0x42, 0x5c, 0xbd, 0xd4, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x41, 0xc3, 0xd4, 0x42, 0x69, 0x22, 0xd5, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0x4e, 0x28, 0xd5, 0x42, 0x40, 0x93, 0xd6, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x84, 0xbc, 0xd6, 0x42,
+        0xac, 0x7b, 0xd7, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x84, 0xbc, 0xd6, 0x42, 0xac, 0xbb, 0xd9, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x84, 0xbc, 0xd6, 0x42, 0xac, 0xbb, 0xd9, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x9e, 0x86, 0xd7, 0x42, 0xc7, 0x45, 0xd8, 0x42, 0x41, 0x50, 0x00, 0x00, 0xb9, 0x50, 0xd8, 0x42,
+        0xe2, 0x0f, 0xd9, 0x42, 0x43, 0x50, 0x00, 0x00, 0xd4, 0x1a, 0xd9, 0x42, 0xfc, 0xd9, 0xd9, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0xef, 0xe4, 0xd9, 0x42, 0x17, 0xa4, 0xda, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0xef, 0xe4, 0xd9, 0x42, 0x17, 0xe4, 0xdc, 0x42, 0x2e, 0x50, 0x01, 0x00, 0xef, 0xe4, 0xd9, 0x42,
+        0x17, 0xe4, 0xdc, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x0a, 0xaf, 0xda, 0x42, 0x32, 0x6e, 0xdb, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0x25, 0x79, 0xdb, 0x42, 0x4d, 0x38, 0xdc, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x40, 0x43, 0xdc, 0x42, 0x68, 0xa2, 0xdc, 0x42, 0x45, 0x50, 0x00, 0x00, 0x4d, 0xa8, 0xdc, 0x42,
+        0x75, 0x07, 0xdd, 0x42, 0x3c, 0x50, 0x00, 0x00, 0x5a, 0x0d, 0xdd, 0x42, 0x83, 0xcc, 0xdd, 0x42,
+        0x3c, 0x50, 0x00, 0x00, 0x5a, 0x0d, 0xdd, 0x42, 0x82, 0x0c, 0xe0, 0x42, 0x29, 0x50, 0x01, 0x00,
+        0x5a, 0x0d, 0xdd, 0x42, 0x82, 0x0c, 0xe0, 0x42, 0x35, 0x50, 0x01, 0x00, 0x75, 0xd7, 0xdd, 0x42,
+        0x9e, 0x96, 0xde, 0x42, 0x41, 0x50, 0x00, 0x00, 0x90, 0xa1, 0xde, 0x42, 0xb8, 0x60, 0xdf, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xab, 0x6b, 0xdf, 0x42, 0xd3, 0x2a, 0xe0, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xc6, 0x35, 0xe0, 0x42, 0xee, 0xf4, 0xe0, 0x42, 0x43, 0x50, 0x00, 0x00, 0xc6, 0x35, 0xe0, 0x42,
+        0xee, 0x34, 0xe3, 0x42, 0x30, 0x50, 0x01, 0x00, 0xe1, 0xff, 0xe0, 0x42, 0x09, 0x5f, 0xe1, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0xee, 0x64, 0xe1, 0x42, 0x16, 0xc4, 0xe1, 0x42, 0x3e, 0x50, 0x00, 0x00,
+        0xfb, 0xc9, 0xe1, 0x42, 0xee, 0x34, 0xe3, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x31, 0x5e, 0xe3, 0x42,
+        0x59, 0x1d, 0xe4, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x31, 0x5e, 0xe3, 0x42, 0x59, 0x5d, 0xe6, 0x42,
+        0x2e, 0x50, 0x01, 0x00, 0x31, 0x5e, 0xe3, 0x42, 0x59, 0x5d, 0xe6, 0x42, 0x3a, 0x50, 0x01, 0x00,
+        0x4c, 0x28, 0xe4, 0x42, 0x74, 0xe7, 0xe4, 0x42, 0x41, 0x50, 0x00, 0x00, 0x67, 0xf2, 0xe4, 0x42,
+        0x8f, 0xb1, 0xe5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x82, 0xbc, 0xe5, 0x42, 0xaa, 0x7b, 0xe6, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x9c, 0x86, 0xe6, 0x42, 0xc5, 0x45, 0xe7, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x9c, 0x86, 0xe6, 0x42, 0xc4, 0x85, 0xe9, 0x42, 0x29, 0x50, 0x01, 0x00, 0x9c, 0x86, 0xe6, 0x42,
+        0xc4, 0x85, 0xe9, 0x42, 0x35, 0x50, 0x01, 0x00, 0xb7, 0x50, 0xe7, 0x42, 0xe0, 0xaf, 0xe7, 0x42,
+        0x41, 0x50, 0x00, 0x00, 0xc5, 0xb5, 0xe7, 0x42, 0xed, 0xd4, 0xe8, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xed, 0xe4, 0xe8, 0x42, 0x15, 0x44, 0xe9, 0x42, 0x45, 0x50, 0x00, 0x00, 0xfa, 0x49, 0xe9, 0x42,
+        0x23, 0xa9, 0xe9, 0x42, 0x48, 0x50, 0x00, 0x00, 0x08, 0xaf, 0xe9, 0x42, 0x30, 0xce, 0xea, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x08, 0xaf, 0xe9, 0x42, 0x30, 0xae, 0xec, 0x42, 0x2e, 0x50, 0x01, 0x00,
+        0x08, 0xaf, 0xe9, 0x42, 0x30, 0xae, 0xec, 0x42, 0x3a, 0x50, 0x01, 0x00, 0x30, 0xde, 0xea, 0x42,
+        0x58, 0x3d, 0xeb, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x3d, 0x43, 0xeb, 0x42, 0x66, 0xa2, 0xeb, 0x42,
+        0x4a, 0x50, 0x00, 0x00, 0x4b, 0xa8, 0xeb, 0x42, 0x73, 0x67, 0xec, 0x42, 0x48, 0x50, 0x00, 0x00,
+        0x66, 0x72, 0xec, 0x42, 0x8e, 0xf1, 0xed, 0x42, 0x45, 0x50, 0x00, 0x00, 0x73, 0xd7, 0xec, 0x42,
+        0x9b, 0xd6, 0xef, 0x42, 0x29, 0x50, 0x01, 0x00, 0x73, 0xd7, 0xec, 0x42, 0x9b, 0xd6, 0xef, 0x42,
+        0x35, 0x50, 0x01, 0x00, 0x9b, 0x06, 0xee, 0x42, 0xc4, 0x65, 0xee, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0xa9, 0x6b, 0xee, 0x42, 0xd1, 0x2a, 0xef, 0x42, 0x45, 0x50, 0x00, 0x00, 0xc4, 0x35, 0xef, 0x42,
+        0xec, 0x94, 0xef, 0x42, 0x45, 0x50, 0x00, 0x00, 0xd1, 0x9a, 0xef, 0x42, 0xf9, 0xf9, 0xef, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0xde, 0xff, 0xef, 0x42, 0x07, 0x5f, 0xf0, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0xde, 0xff, 0xef, 0x42, 0x06, 0xff, 0xf2, 0x42, 0x30, 0x50, 0x01, 0x00, 0xde, 0xff, 0xef, 0x42,
+        0x06, 0xff, 0xf2, 0x42, 0x3c, 0x50, 0x01, 0x00, 0xec, 0x64, 0xf0, 0x42, 0x14, 0xe4, 0xf4, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x4a, 0x28, 0xf3, 0x42, 0x72, 0x27, 0xf6, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x4a, 0x28, 0xf3, 0x42, 0x72, 0x27, 0xf6, 0x42, 0x3c, 0x50, 0x01, 0x00, 0x9a, 0x86, 0xf5, 0x42,
+        0xc3, 0xe5, 0xf5, 0x42, 0x45, 0x50, 0x00, 0x00, 0xa8, 0xeb, 0xf5, 0x42, 0xd0, 0x4a, 0xf6, 0x42,
+        0x48, 0x50, 0x00, 0x00, 0xb5, 0x50, 0xf6, 0x42, 0xdd, 0x6f, 0xf7, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xb5, 0x50, 0xf6, 0x42, 0xdd, 0x4f, 0xf9, 0x42, 0x2e, 0x50, 0x01, 0x00, 0xb5, 0x50, 0xf6, 0x42,
+        0xdd, 0x4f, 0xf9, 0x42, 0x3a, 0x50, 0x01, 0x00, 0xdd, 0x7f, 0xf7, 0x42, 0x06, 0xdf, 0xf7, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0xeb, 0xe4, 0xf7, 0x42, 0x13, 0x44, 0xf8, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0xf8, 0x49, 0xf8, 0x42, 0x21, 0x09, 0xf9, 0x42, 0x48, 0x50, 0x00, 0x00, 0x13, 0x14, 0xf9, 0x42,
+        0x3b, 0x93, 0xfa, 0x42, 0x45, 0x50, 0x00, 0x00, 0x20, 0x79, 0xf9, 0x42, 0x48, 0x78, 0xfc, 0x42,
+        0x29, 0x50, 0x01, 0x00, 0x20, 0x79, 0xf9, 0x42, 0x48, 0x78, 0xfc, 0x42, 0x35, 0x50, 0x01, 0x00,
+        0x49, 0xa8, 0xfa, 0x42, 0x71, 0x07, 0xfb, 0x42, 0x43, 0x50, 0x00, 0x00, 0x56, 0x0d, 0xfb, 0x42,
+        0x7e, 0xcc, 0xfb, 0x42, 0x45, 0x50, 0x00, 0x00, 0x71, 0xd7, 0xfb, 0x42, 0x99, 0x36, 0xfc, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x7e, 0x3c, 0xfc, 0x42, 0xa7, 0x9b, 0xfc, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x8c, 0xa1, 0xfc, 0x42, 0xb4, 0x00, 0xfd, 0x42, 0x45, 0x50, 0x00, 0x00, 0x8c, 0xa1, 0xfc, 0x42,
+        0xb4, 0xa0, 0xff, 0x42, 0x30, 0x50, 0x01, 0x00, 0x8c, 0xa1, 0xfc, 0x42, 0xb4, 0xa0, 0xff, 0x42,
+        0x3c, 0x50, 0x01, 0x00, 0x99, 0x06, 0xfd, 0x42, 0xe1, 0xc2, 0x00, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0xf7, 0xc9, 0xff, 0x42, 0x90, 0x64, 0x01, 0x43, 0x30, 0x50, 0x01, 0x00, 0xf7, 0xc9, 0xff, 0x42,
+        0x90, 0x64, 0x01, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x9d, 0xe1, 0x00, 0x43, 0x31, 0x11, 0x01, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x24, 0x14, 0x01, 0x43, 0xb8, 0x43, 0x01, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0xab, 0x46, 0x01, 0x43, 0x3f, 0x76, 0x01, 0x43, 0x4d, 0x50, 0x00, 0x00, 0x31, 0x79, 0x01, 0x43,
+        0xc5, 0xa8, 0x01, 0x43, 0x51, 0x50, 0x00, 0x00, 0x31, 0x79, 0x01, 0x43, 0xc5, 0xf8, 0x02, 0x43,
+        0x2b, 0x50, 0x01, 0x00, 0x31, 0x79, 0x01, 0x43, 0xc5, 0xf8, 0x02, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0xb8, 0xab, 0x01, 0x43, 0x4c, 0x3b, 0x02, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x4c, 0x43, 0x02, 0x43,
+        0xe0, 0x72, 0x02, 0x43, 0x51, 0x50, 0x00, 0x00, 0xd3, 0x75, 0x02, 0x43, 0x67, 0x65, 0x03, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x67, 0x0d, 0x03, 0x43, 0xfb, 0x8c, 0x04, 0x43, 0x2e, 0x50, 0x01, 0x00,
+        0x67, 0x0d, 0x03, 0x43, 0xfb, 0x8c, 0x04, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x74, 0x72, 0x03, 0x43,
+        0x09, 0xa2, 0x03, 0x43, 0x51, 0x50, 0x00, 0x00, 0xfb, 0xa4, 0x03, 0x43, 0x8f, 0xd4, 0x03, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x82, 0xd7, 0x03, 0x43, 0x16, 0x97, 0x04, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x9d, 0xa1, 0x04, 0x43, 0x31, 0xd1, 0x04, 0x43, 0x51, 0x50, 0x00, 0x00, 0x9d, 0xa1, 0x04, 0x43,
+        0x31, 0x21, 0x06, 0x43, 0x29, 0x50, 0x01, 0x00, 0x9d, 0xa1, 0x04, 0x43, 0x31, 0x21, 0x06, 0x43,
+        0x35, 0x50, 0x01, 0x00, 0x23, 0xd4, 0x04, 0x43, 0xb7, 0x63, 0x05, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0xb7, 0x6b, 0x05, 0x43, 0x4c, 0x9b, 0x05, 0x43, 0x51, 0x50, 0x00, 0x00, 0x3e, 0x9e, 0x05, 0x43,
+        0xd2, 0x8d, 0x06, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xd2, 0x35, 0x06, 0x43, 0x66, 0xb5, 0x07, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0xd2, 0x35, 0x06, 0x43, 0x66, 0xb5, 0x07, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0xe0, 0x9a, 0x06, 0x43, 0x74, 0xca, 0x06, 0x43, 0x51, 0x50, 0x00, 0x00, 0x66, 0xcd, 0x06, 0x43,
+        0xfb, 0xfc, 0x06, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xed, 0xff, 0x06, 0x43, 0x81, 0xbf, 0x07, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x08, 0xca, 0x07, 0x43, 0x9c, 0xf9, 0x07, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x08, 0xca, 0x07, 0x43, 0x9c, 0x49, 0x09, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x08, 0xca, 0x07, 0x43,
+        0x9c, 0x49, 0x09, 0x43, 0x37, 0x50, 0x01, 0x00, 0x8f, 0xfc, 0x07, 0x43, 0x23, 0x8c, 0x08, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x23, 0x94, 0x08, 0x43, 0xb7, 0xc3, 0x08, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xaa, 0xc6, 0x08, 0x43, 0x3e, 0xb6, 0x09, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x3e, 0x5e, 0x09, 0x43,
+        0xd2, 0xdd, 0x0a, 0x43, 0x2e, 0x50, 0x01, 0x00, 0x3e, 0x5e, 0x09, 0x43, 0xd2, 0xdd, 0x0a, 0x43,
+        0x3a, 0x50, 0x01, 0x00, 0x4b, 0xc3, 0x09, 0x43, 0xdf, 0xf2, 0x09, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xd2, 0xf5, 0x09, 0x43, 0x66, 0x25, 0x0a, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x58, 0x28, 0x0a, 0x43,
+        0xed, 0xe7, 0x0a, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x73, 0xf2, 0x0a, 0x43, 0x07, 0xb2, 0x0b, 0x43,
+        0x4d, 0x50, 0x00, 0x00, 0x73, 0xf2, 0x0a, 0x43, 0x07, 0x72, 0x0c, 0x43, 0x29, 0x50, 0x01, 0x00,
+        0x73, 0xf2, 0x0a, 0x43, 0x07, 0x72, 0x0c, 0x43, 0x35, 0x50, 0x01, 0x00, 0x8e, 0xbc, 0x0b, 0x43,
+        0x22, 0x7c, 0x0c, 0x43, 0x4d, 0x50, 0x00, 0x00, 0xa9, 0x86, 0x0c, 0x43, 0x3d, 0x46, 0x0d, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0xa9, 0x86, 0x0c, 0x43, 0x3d, 0x06, 0x0e, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0xa9, 0x86, 0x0c, 0x43, 0x3d, 0x06, 0x0e, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x4b, 0x83, 0x0d, 0x43,
+        0xdf, 0xb2, 0x0d, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xd1, 0xb5, 0x0d, 0x43, 0x65, 0xe5, 0x0d, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x58, 0xe8, 0x0d, 0x43, 0xec, 0x17, 0x0e, 0x43, 0x4d, 0x50, 0x00, 0x00,
+        0xdf, 0x1a, 0x0e, 0x43, 0x73, 0x4a, 0x0e, 0x43, 0x51, 0x50, 0x00, 0x00, 0xdf, 0x1a, 0x0e, 0x43,
+        0x73, 0x9a, 0x0f, 0x43, 0x2b, 0x50, 0x01, 0x00, 0xdf, 0x1a, 0x0e, 0x43, 0x73, 0x9a, 0x0f, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x65, 0x4d, 0x0e, 0x43, 0xf9, 0xdc, 0x0e, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0xf9, 0xe4, 0x0e, 0x43, 0x8e, 0x14, 0x0f, 0x43, 0x51, 0x50, 0x00, 0x00, 0x80, 0x17, 0x0f, 0x43,
+        0x14, 0x07, 0x10, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x14, 0xaf, 0x0f, 0x43, 0xa8, 0x2e, 0x11, 0x43,
+        0x2e, 0x50, 0x01, 0x00, 0x14, 0xaf, 0x0f, 0x43, 0xa8, 0x2e, 0x11, 0x43, 0x3a, 0x50, 0x01, 0x00,
+        0x22, 0x14, 0x10, 0x43, 0xb6, 0x43, 0x10, 0x43, 0x51, 0x50, 0x00, 0x00, 0xa8, 0x46, 0x10, 0x43,
+        0x3d, 0x76, 0x10, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x2f, 0x79, 0x10, 0x43, 0xc3, 0x38, 0x11, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x4a, 0x43, 0x11, 0x43, 0xde, 0x72, 0x11, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x4a, 0x43, 0x11, 0x43, 0xde, 0xc2, 0x12, 0x43, 0x29, 0x50, 0x01, 0x00, 0x4a, 0x43, 0x11, 0x43,
+        0xde, 0xc2, 0x12, 0x43, 0x35, 0x50, 0x01, 0x00, 0xd1, 0x75, 0x11, 0x43, 0x65, 0x05, 0x12, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x65, 0x0d, 0x12, 0x43, 0xf9, 0x3c, 0x12, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xec, 0x3f, 0x12, 0x43, 0x80, 0x2f, 0x13, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x80, 0xd7, 0x12, 0x43,
+        0x14, 0x57, 0x14, 0x43, 0x30, 0x50, 0x01, 0x00, 0x80, 0xd7, 0x12, 0x43, 0x14, 0x57, 0x14, 0x43,
+        0x3c, 0x50, 0x01, 0x00, 0x8d, 0x3c, 0x13, 0x43, 0x21, 0x6c, 0x13, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x14, 0x6f, 0x13, 0x43, 0xa8, 0x9e, 0x13, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x9b, 0xa1, 0x13, 0x43,
+        0x2f, 0x61, 0x14, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xb5, 0x6b, 0x14, 0x43, 0x4a, 0x9b, 0x14, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0xb5, 0x6b, 0x14, 0x43, 0x49, 0xeb, 0x15, 0x43, 0x2b, 0x50, 0x01, 0x00,
+        0xb5, 0x6b, 0x14, 0x43, 0x49, 0xeb, 0x15, 0x43, 0x37, 0x50, 0x01, 0x00, 0x3c, 0x9e, 0x14, 0x43,
+        0xd0, 0x2d, 0x15, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xd0, 0x35, 0x15, 0x43, 0x64, 0x65, 0x15, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x57, 0x68, 0x15, 0x43, 0xeb, 0x57, 0x16, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0xeb, 0xff, 0x15, 0x43, 0x7f, 0x7f, 0x17, 0x43, 0x2e, 0x50, 0x01, 0x00, 0xeb, 0xff, 0x15, 0x43,
+        0x7f, 0x7f, 0x17, 0x43, 0x3a, 0x50, 0x01, 0x00, 0xf8, 0x64, 0x16, 0x43, 0x8d, 0x94, 0x16, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x7f, 0x97, 0x16, 0x43, 0x13, 0xc7, 0x16, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x06, 0xca, 0x16, 0x43, 0x9a, 0x89, 0x17, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x21, 0x94, 0x17, 0x43,
+        0xb5, 0x53, 0x18, 0x43, 0x4d, 0x50, 0x00, 0x00, 0x21, 0x94, 0x17, 0x43, 0xb5, 0x13, 0x19, 0x43,
+        0x29, 0x50, 0x01, 0x00, 0x21, 0x94, 0x17, 0x43, 0xb5, 0x13, 0x19, 0x43, 0x35, 0x50, 0x01, 0x00,
+        0x3c, 0x5e, 0x18, 0x43, 0xd0, 0x1d, 0x19, 0x43, 0x4d, 0x50, 0x00, 0x00, 0x56, 0x28, 0x19, 0x43,
+        0xea, 0xe7, 0x19, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x56, 0x28, 0x19, 0x43, 0xea, 0xa7, 0x1a, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x56, 0x28, 0x19, 0x43, 0xea, 0xa7, 0x1a, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0x8c, 0xbc, 0x1a, 0x43, 0x20, 0x7c, 0x1b, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x8c, 0xbc, 0x1a, 0x43,
+        0x20, 0x3c, 0x1c, 0x43, 0x37, 0x50, 0x01, 0x00, 0x8c, 0xbc, 0x1a, 0x43, 0x20, 0x3c, 0x1c, 0x43,
+        0x3a, 0x50, 0x01, 0x00, 0x8c, 0xbc, 0x1a, 0x43, 0x20, 0x3c, 0x1c, 0x43, 0x3e, 0x50, 0x01, 0x00,
+        0xa7, 0x86, 0x1b, 0x43, 0x3b, 0xb6, 0x1b, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x2e, 0xb9, 0x1b, 0x43,
+        0xc2, 0xe8, 0x1b, 0x43, 0x4d, 0x50, 0x00, 0x00, 0xb4, 0xeb, 0x1b, 0x43, 0x48, 0x6b, 0x1d, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0xc2, 0x50, 0x1c, 0x43, 0x56, 0xd0, 0x1d, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0xc2, 0x50, 0x1c, 0x43, 0x56, 0xd0, 0x1d, 0x43, 0x3c, 0x50, 0x01, 0x00, 0xc2, 0x50, 0x1c, 0x43,
+        0x56, 0xd0, 0x1d, 0x43, 0x40, 0x50, 0x01, 0x00, 0xf7, 0xe4, 0x1d, 0x43, 0x8b, 0x04, 0x1f, 0x43,
+        0x4d, 0x50, 0x00, 0x00, 0xf7, 0xe4, 0x1d, 0x43, 0x8b, 0x64, 0x1f, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0xf7, 0xe4, 0x1d, 0x43, 0x8b, 0x64, 0x1f, 0x43, 0x3e, 0x50, 0x01, 0x00, 0xf7, 0xe4, 0x1d, 0x43,
+        0x8b, 0x64, 0x1f, 0x43, 0x41, 0x50, 0x01, 0x00, 0x20, 0x14, 0x1f, 0x43, 0xb4, 0x43, 0x1f, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0xa6, 0x46, 0x1f, 0x43, 0x3a, 0xf6, 0x20, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x2d, 0x79, 0x1f, 0x43, 0xc1, 0xf8, 0x20, 0x43, 0x39, 0x50, 0x01, 0x00, 0x2d, 0x79, 0x1f, 0x43,
+        0xc1, 0xf8, 0x20, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x2d, 0x79, 0x1f, 0x43, 0xc1, 0xf8, 0x20, 0x43,
+        0x41, 0x50, 0x01, 0x00, 0x63, 0x0d, 0x21, 0x43, 0xf7, 0x2c, 0x22, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x63, 0x0d, 0x21, 0x43, 0xf7, 0x8c, 0x22, 0x43, 0x37, 0x50, 0x01, 0x00, 0x63, 0x0d, 0x21, 0x43,
+        0xf7, 0x8c, 0x22, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x63, 0x0d, 0x21, 0x43, 0xf7, 0x8c, 0x22, 0x43,
+        0x3e, 0x50, 0x01, 0x00, 0x8b, 0x3c, 0x22, 0x43, 0x1f, 0x6c, 0x22, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x12, 0x6f, 0x22, 0x43, 0xa6, 0x9e, 0x22, 0x43, 0x4d, 0x50, 0x00, 0x00, 0x98, 0xa1, 0x22, 0x43,
+        0x2c, 0x21, 0x24, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x98, 0xa1, 0x22, 0x43, 0x2c, 0x21, 0x24, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x98, 0xa1, 0x22, 0x43, 0x2c, 0x21, 0x24, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0x98, 0xa1, 0x22, 0x43, 0x2c, 0x21, 0x24, 0x43, 0x40, 0x50, 0x01, 0x00, 0xce, 0x35, 0x24, 0x43,
+        0x62, 0x55, 0x25, 0x43, 0x4d, 0x50, 0x00, 0x00, 0xce, 0x35, 0x24, 0x43, 0x62, 0xb5, 0x25, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0xce, 0x35, 0x24, 0x43, 0x62, 0xb5, 0x25, 0x43, 0x3e, 0x50, 0x01, 0x00,
+        0xce, 0x35, 0x24, 0x43, 0x62, 0xb5, 0x25, 0x43, 0x41, 0x50, 0x01, 0x00, 0xf6, 0x64, 0x25, 0x43,
+        0x8b, 0x94, 0x25, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x7d, 0x97, 0x25, 0x43, 0x11, 0x87, 0x26, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x04, 0xca, 0x25, 0x43, 0x98, 0x49, 0x27, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x04, 0xca, 0x25, 0x43, 0x98, 0x49, 0x27, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x04, 0xca, 0x25, 0x43,
+        0x98, 0x49, 0x27, 0x43, 0x41, 0x50, 0x01, 0x00, 0x1f, 0x94, 0x26, 0x43, 0xb3, 0x53, 0x27, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x39, 0x5e, 0x27, 0x43, 0xcd, 0xdd, 0x28, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x39, 0x5e, 0x27, 0x43, 0xcd, 0xdd, 0x28, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x39, 0x5e, 0x27, 0x43,
+        0xce, 0xed, 0x27, 0x43, 0x3e, 0x50, 0x00, 0x00, 0xce, 0xf5, 0x27, 0x43, 0x62, 0x55, 0x28, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0xdb, 0x5a, 0x28, 0x43, 0x6f, 0x8a, 0x28, 0x43, 0x3c, 0x50, 0x00, 0x00,
+        0x62, 0x8d, 0x28, 0x43, 0xf6, 0xbc, 0x28, 0x43, 0x3e, 0x50, 0x00, 0x00, 0xe8, 0xbf, 0x28, 0x43,
+        0x7d, 0xef, 0x28, 0x43, 0x41, 0x50, 0x00, 0x00, 0x6f, 0xf2, 0x28, 0x43, 0x03, 0x72, 0x2a, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x6f, 0xf2, 0x28, 0x43, 0x03, 0x72, 0x2a, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0x6f, 0xf2, 0x28, 0x43, 0x03, 0x82, 0x29, 0x43, 0x40, 0x50, 0x00, 0x00, 0x03, 0x8a, 0x29, 0x43,
+        0x97, 0xe9, 0x29, 0x43, 0x40, 0x50, 0x00, 0x00, 0x11, 0xef, 0x29, 0x43, 0xa5, 0x1e, 0x2a, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x97, 0x21, 0x2a, 0x43, 0x2c, 0x51, 0x2a, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x1e, 0x54, 0x2a, 0x43, 0xb2, 0x83, 0x2a, 0x43, 0x43, 0x50, 0x00, 0x00, 0xa5, 0x86, 0x2a, 0x43,
+        0x39, 0x06, 0x2c, 0x43, 0x39, 0x50, 0x01, 0x00, 0xa5, 0x86, 0x2a, 0x43, 0x39, 0x16, 0x2b, 0x43,
+        0x41, 0x50, 0x00, 0x00, 0x39, 0x1e, 0x2b, 0x43, 0xcd, 0x7d, 0x2b, 0x43, 0x41, 0x50, 0x00, 0x00,
+        0x46, 0x83, 0x2b, 0x43, 0xdb, 0xb2, 0x2b, 0x43, 0x3e, 0x50, 0x00, 0x00, 0xcd, 0xb5, 0x2b, 0x43,
+        0x61, 0xe5, 0x2b, 0x43, 0x41, 0x50, 0x00, 0x00, 0x54, 0xe8, 0x2b, 0x43, 0xe8, 0x47, 0x2c, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0xda, 0x1a, 0x2c, 0x43, 0x6e, 0x9a, 0x2d, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0xda, 0x1a, 0x2c, 0x43, 0x6e, 0x9a, 0x2d, 0x43, 0x3c, 0x50, 0x01, 0x00, 0xda, 0x1a, 0x2c, 0x43,
+        0x6e, 0x9a, 0x2d, 0x43, 0x41, 0x50, 0x01, 0x00, 0x61, 0x4d, 0x2c, 0x43, 0xf5, 0x7c, 0x2c, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0xe8, 0x7f, 0x2c, 0x43, 0x7c, 0xaf, 0x2c, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x6f, 0xb2, 0x2c, 0x43, 0x03, 0xe2, 0x2c, 0x43, 0x45, 0x50, 0x00, 0x00, 0x7c, 0x17, 0x2d, 0x43,
+        0x10, 0x47, 0x2d, 0x43, 0x45, 0x50, 0x00, 0x00, 0x03, 0x4a, 0x2d, 0x43, 0x97, 0x79, 0x2d, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x89, 0x7c, 0x2d, 0x43, 0x1e, 0x3c, 0x2e, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x10, 0xaf, 0x2d, 0x43, 0xa4, 0x2e, 0x2f, 0x43, 0x35, 0x50, 0x01, 0x00, 0x10, 0xaf, 0x2d, 0x43,
+        0xa4, 0x2e, 0x2f, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x10, 0xaf, 0x2d, 0x43, 0xa4, 0x2e, 0x2f, 0x43,
+        0x3e, 0x50, 0x01, 0x00, 0xa4, 0x46, 0x2e, 0x43, 0x38, 0x76, 0x2e, 0x43, 0x4c, 0x50, 0x00, 0x00,
+        0x2b, 0x79, 0x2e, 0x43, 0xbf, 0xa8, 0x2e, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xb2, 0xab, 0x2e, 0x43,
+        0x46, 0x0b, 0x2f, 0x43, 0x48, 0x50, 0x00, 0x00, 0xbf, 0x10, 0x2f, 0x43, 0x53, 0xd0, 0x2f, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x46, 0x43, 0x2f, 0x43, 0xda, 0xc2, 0x30, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x46, 0x43, 0x2f, 0x43, 0xda, 0xc2, 0x30, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x46, 0x43, 0x2f, 0x43,
+        0xda, 0xc2, 0x30, 0x43, 0x41, 0x50, 0x01, 0x00, 0xda, 0xda, 0x2f, 0x43, 0x6e, 0x0a, 0x30, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x61, 0x0d, 0x30, 0x43, 0xf5, 0x6c, 0x30, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x6e, 0x72, 0x30, 0x43, 0x02, 0xa2, 0x30, 0x43, 0x45, 0x50, 0x00, 0x00, 0xf5, 0xa4, 0x30, 0x43,
+        0x89, 0xd4, 0x30, 0x43, 0x43, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0x30, 0x43, 0x10, 0x07, 0x31, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x7b, 0xd7, 0x30, 0x43, 0x0f, 0x57, 0x32, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x7b, 0xd7, 0x30, 0x43, 0x0f, 0x57, 0x32, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x7b, 0xd7, 0x30, 0x43,
+        0x0f, 0x57, 0x32, 0x43, 0x40, 0x50, 0x01, 0x00, 0x02, 0x0a, 0x31, 0x43, 0x96, 0x49, 0x33, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0xb1, 0x6b, 0x32, 0x43, 0x45, 0xeb, 0x33, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0xb1, 0x6b, 0x32, 0x43, 0x45, 0xeb, 0x33, 0x43, 0x3c, 0x50, 0x01, 0x00, 0xb1, 0x6b, 0x32, 0x43,
+        0x45, 0xeb, 0x33, 0x43, 0x40, 0x50, 0x01, 0x00, 0x53, 0x68, 0x33, 0x43, 0xe7, 0x97, 0x33, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0xd9, 0x9a, 0x33, 0x43, 0x6e, 0xca, 0x33, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x60, 0xcd, 0x33, 0x43, 0xf4, 0x8c, 0x34, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xe7, 0xff, 0x33, 0x43,
+        0x7b, 0x7f, 0x35, 0x43, 0x35, 0x50, 0x01, 0x00, 0xe7, 0xff, 0x33, 0x43, 0x7b, 0x7f, 0x35, 0x43,
+        0x3a, 0x50, 0x01, 0x00, 0xe7, 0xff, 0x33, 0x43, 0x7b, 0x7f, 0x35, 0x43, 0x3e, 0x50, 0x01, 0x00,
+        0x7b, 0x97, 0x34, 0x43, 0x0f, 0xc7, 0x34, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x02, 0xca, 0x34, 0x43,
+        0x96, 0xf9, 0x34, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x88, 0xfc, 0x34, 0x43, 0x1d, 0x5c, 0x35, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x96, 0x61, 0x35, 0x43, 0x2a, 0x21, 0x36, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x1d, 0x94, 0x35, 0x43, 0xb1, 0x13, 0x37, 0x43, 0x39, 0x50, 0x01, 0x00, 0x1d, 0x94, 0x35, 0x43,
+        0xb1, 0x13, 0x37, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x1d, 0x94, 0x35, 0x43, 0xb1, 0x13, 0x37, 0x43,
+        0x41, 0x50, 0x01, 0x00, 0xb1, 0x2b, 0x36, 0x43, 0x45, 0x5b, 0x36, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x37, 0x5e, 0x36, 0x43, 0xcc, 0xbd, 0x36, 0x43, 0x45, 0x50, 0x00, 0x00, 0x45, 0xc3, 0x36, 0x43,
+        0xd9, 0xf2, 0x36, 0x43, 0x45, 0x50, 0x00, 0x00, 0xcb, 0xf5, 0x36, 0x43, 0x60, 0x25, 0x37, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x52, 0x28, 0x37, 0x43, 0xe6, 0x57, 0x37, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x52, 0x28, 0x37, 0x43, 0xe6, 0xa7, 0x38, 0x43, 0x37, 0x50, 0x01, 0x00, 0x52, 0x28, 0x37, 0x43,
+        0xe6, 0xa7, 0x38, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x52, 0x28, 0x37, 0x43, 0xe6, 0xa7, 0x38, 0x43,
+        0x40, 0x50, 0x01, 0x00, 0xd9, 0x5a, 0x37, 0x43, 0x6d, 0xea, 0x37, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x6d, 0xf2, 0x37, 0x43, 0x01, 0x52, 0x38, 0x43, 0x43, 0x50, 0x00, 0x00, 0x7a, 0x57, 0x38, 0x43,
+        0x0f, 0x87, 0x38, 0x43, 0x41, 0x50, 0x00, 0x00, 0x01, 0x8a, 0x38, 0x43, 0x95, 0x79, 0x39, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x88, 0xbc, 0x38, 0x43, 0x1c, 0x3c, 0x3a, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x88, 0xbc, 0x38, 0x43, 0x1c, 0x3c, 0x3a, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x88, 0xbc, 0x38, 0x43,
+        0x1c, 0x3c, 0x3a, 0x43, 0x40, 0x50, 0x01, 0x00, 0x29, 0xb9, 0x39, 0x43, 0xbe, 0xe8, 0x39, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xb0, 0xeb, 0x39, 0x43, 0x44, 0x1b, 0x3a, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x37, 0x1e, 0x3a, 0x43, 0xcb, 0x4d, 0x3a, 0x43, 0x4d, 0x50, 0x00, 0x00, 0xbe, 0x50, 0x3a, 0x43,
+        0x52, 0x80, 0x3a, 0x43, 0x51, 0x50, 0x00, 0x00, 0xbe, 0x50, 0x3a, 0x43, 0x52, 0xd0, 0x3b, 0x43,
+        0x2b, 0x50, 0x01, 0x00, 0xbe, 0x50, 0x3a, 0x43, 0x52, 0xd0, 0x3b, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x44, 0x83, 0x3a, 0x43, 0xd8, 0x12, 0x3b, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xd8, 0x1a, 0x3b, 0x43,
+        0x6d, 0x4a, 0x3b, 0x43, 0x51, 0x50, 0x00, 0x00, 0x5f, 0x4d, 0x3b, 0x43, 0xf3, 0x3c, 0x3c, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0xf3, 0xe4, 0x3b, 0x43, 0x87, 0x64, 0x3d, 0x43, 0x2e, 0x50, 0x01, 0x00,
+        0xf3, 0xe4, 0x3b, 0x43, 0x87, 0x64, 0x3d, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x01, 0x4a, 0x3c, 0x43,
+        0x95, 0x79, 0x3c, 0x43, 0x51, 0x50, 0x00, 0x00, 0x87, 0x7c, 0x3c, 0x43, 0x1c, 0xac, 0x3c, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x0e, 0xaf, 0x3c, 0x43, 0xa2, 0x6e, 0x3d, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x29, 0x79, 0x3d, 0x43, 0xbd, 0xa8, 0x3d, 0x43, 0x51, 0x50, 0x00, 0x00, 0x29, 0x79, 0x3d, 0x43,
+        0xbd, 0xf8, 0x3e, 0x43, 0x29, 0x50, 0x01, 0x00, 0x29, 0x79, 0x3d, 0x43, 0xbd, 0xf8, 0x3e, 0x43,
+        0x35, 0x50, 0x01, 0x00, 0xb0, 0xab, 0x3d, 0x43, 0x44, 0x3b, 0x3e, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x44, 0x43, 0x3e, 0x43, 0xd8, 0x72, 0x3e, 0x43, 0x51, 0x50, 0x00, 0x00, 0xca, 0x75, 0x3e, 0x43,
+        0x5f, 0x65, 0x3f, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x5f, 0x0d, 0x3f, 0x43, 0xf3, 0x8c, 0x40, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x5f, 0x0d, 0x3f, 0x43, 0xf3, 0x8c, 0x40, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0x6c, 0x72, 0x3f, 0x43, 0x00, 0xa2, 0x3f, 0x43, 0x51, 0x50, 0x00, 0x00, 0xf3, 0xa4, 0x3f, 0x43,
+        0x87, 0xd4, 0x3f, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x79, 0xd7, 0x3f, 0x43, 0x0d, 0x97, 0x40, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x94, 0xa1, 0x40, 0x43, 0x28, 0xd1, 0x40, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x94, 0xa1, 0x40, 0x43, 0x28, 0x21, 0x42, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x94, 0xa1, 0x40, 0x43,
+        0x28, 0x21, 0x42, 0x43, 0x37, 0x50, 0x01, 0x00, 0x1b, 0xd4, 0x40, 0x43, 0xaf, 0x63, 0x41, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0xaf, 0x6b, 0x41, 0x43, 0x43, 0x9b, 0x41, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x36, 0x9e, 0x41, 0x43, 0xca, 0x8d, 0x42, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xca, 0x35, 0x42, 0x43,
+        0x5e, 0xb5, 0x43, 0x43, 0x2e, 0x50, 0x01, 0x00, 0xca, 0x35, 0x42, 0x43, 0x5e, 0xb5, 0x43, 0x43,
+        0x3a, 0x50, 0x01, 0x00, 0xd7, 0x9a, 0x42, 0x43, 0x6c, 0xca, 0x42, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x5e, 0xcd, 0x42, 0x43, 0xf2, 0xfc, 0x42, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xe5, 0xff, 0x42, 0x43,
+        0x79, 0xbf, 0x43, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x00, 0xca, 0x43, 0x43, 0x94, 0x89, 0x44, 0x43,
+        0x4d, 0x50, 0x00, 0x00, 0x00, 0xca, 0x43, 0x43, 0x94, 0x49, 0x45, 0x43, 0x29, 0x50, 0x01, 0x00,
+        0x00, 0xca, 0x43, 0x43, 0x94, 0x49, 0x45, 0x43, 0x35, 0x50, 0x01, 0x00, 0x1a, 0x94, 0x44, 0x43,
+        0xaf, 0x53, 0x45, 0x43, 0x4d, 0x50, 0x00, 0x00, 0x35, 0x5e, 0x45, 0x43, 0xc9, 0x1d, 0x46, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x35, 0x5e, 0x45, 0x43, 0xc9, 0xdd, 0x46, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x35, 0x5e, 0x45, 0x43, 0xc9, 0xdd, 0x46, 0x43, 0x3c, 0x50, 0x01, 0x00, 0xd7, 0x5a, 0x46, 0x43,
+        0x6b, 0x8a, 0x46, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x5e, 0x8d, 0x46, 0x43, 0xf2, 0xbc, 0x46, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0xe4, 0xbf, 0x46, 0x43, 0x78, 0xef, 0x46, 0x43, 0x4d, 0x50, 0x00, 0x00,
+        0x6b, 0xf2, 0x46, 0x43, 0xff, 0x21, 0x47, 0x43, 0x51, 0x50, 0x00, 0x00, 0x6b, 0xf2, 0x46, 0x43,
+        0xff, 0x71, 0x48, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x6b, 0xf2, 0x46, 0x43, 0xff, 0x71, 0x48, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0xf2, 0x24, 0x47, 0x43, 0x86, 0xb4, 0x47, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x86, 0xbc, 0x47, 0x43, 0x1a, 0xec, 0x47, 0x43, 0x51, 0x50, 0x00, 0x00, 0x0c, 0xef, 0x47, 0x43,
+        0xa1, 0xde, 0x48, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xa1, 0x86, 0x48, 0x43, 0x35, 0x06, 0x4a, 0x43,
+        0x2e, 0x50, 0x01, 0x00, 0xa1, 0x86, 0x48, 0x43, 0x35, 0x06, 0x4a, 0x43, 0x3a, 0x50, 0x01, 0x00,
+        0xae, 0xeb, 0x48, 0x43, 0x42, 0x1b, 0x49, 0x43, 0x51, 0x50, 0x00, 0x00, 0x35, 0x1e, 0x49, 0x43,
+        0xc9, 0x4d, 0x49, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xbb, 0x50, 0x49, 0x43, 0x50, 0x10, 0x4a, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0xd6, 0x1a, 0x4a, 0x43, 0x6a, 0x4a, 0x4a, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xd6, 0x1a, 0x4a, 0x43, 0x6a, 0x9a, 0x4b, 0x43, 0x29, 0x50, 0x01, 0x00, 0xd6, 0x1a, 0x4a, 0x43,
+        0x6a, 0x9a, 0x4b, 0x43, 0x35, 0x50, 0x01, 0x00, 0x5d, 0x4d, 0x4a, 0x43, 0xf1, 0xdc, 0x4a, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0xf1, 0xe4, 0x4a, 0x43, 0x85, 0x14, 0x4b, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x78, 0x17, 0x4b, 0x43, 0x0c, 0x07, 0x4c, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x0c, 0xaf, 0x4b, 0x43,
+        0xa0, 0x2e, 0x4d, 0x43, 0x30, 0x50, 0x01, 0x00, 0x0c, 0xaf, 0x4b, 0x43, 0xa0, 0x2e, 0x4d, 0x43,
+        0x3c, 0x50, 0x01, 0x00, 0x19, 0x14, 0x4c, 0x43, 0xae, 0x43, 0x4c, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xa0, 0x46, 0x4c, 0x43, 0x34, 0x76, 0x4c, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x27, 0x79, 0x4c, 0x43,
+        0xbb, 0x38, 0x4d, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x42, 0x43, 0x4d, 0x43, 0xd6, 0x72, 0x4d, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x42, 0x43, 0x4d, 0x43, 0xd6, 0xc2, 0x4e, 0x43, 0x2b, 0x50, 0x01, 0x00,
+        0x42, 0x43, 0x4d, 0x43, 0xd6, 0xc2, 0x4e, 0x43, 0x37, 0x50, 0x01, 0x00, 0xc8, 0x75, 0x4d, 0x43,
+        0x5c, 0x05, 0x4e, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x5c, 0x0d, 0x4e, 0x43, 0xf1, 0x3c, 0x4e, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0xe3, 0x3f, 0x4e, 0x43, 0x77, 0x2f, 0x4f, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x77, 0xd7, 0x4e, 0x43, 0x0b, 0x57, 0x50, 0x43, 0x2e, 0x50, 0x01, 0x00, 0x77, 0xd7, 0x4e, 0x43,
+        0x0b, 0x57, 0x50, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x85, 0x3c, 0x4f, 0x43, 0x19, 0x6c, 0x4f, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x0b, 0x6f, 0x4f, 0x43, 0xa0, 0x9e, 0x4f, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x92, 0xa1, 0x4f, 0x43, 0x26, 0x61, 0x50, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xad, 0x6b, 0x50, 0x43,
+        0x41, 0x2b, 0x51, 0x43, 0x4d, 0x50, 0x00, 0x00, 0xad, 0x6b, 0x50, 0x43, 0x41, 0xeb, 0x51, 0x43,
+        0x29, 0x50, 0x01, 0x00, 0xad, 0x6b, 0x50, 0x43, 0x41, 0xeb, 0x51, 0x43, 0x35, 0x50, 0x01, 0x00,
+        0xc8, 0x35, 0x51, 0x43, 0x5c, 0xf5, 0x51, 0x43, 0x4d, 0x50, 0x00, 0x00, 0xe3, 0xff, 0x51, 0x43,
+        0x77, 0xbf, 0x52, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xe3, 0xff, 0x51, 0x43, 0x77, 0x7f, 0x53, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0xe3, 0xff, 0x51, 0x43, 0x77, 0x7f, 0x53, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0x84, 0xfc, 0x52, 0x43, 0x18, 0x2c, 0x53, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x0b, 0x2f, 0x53, 0x43,
+        0x9f, 0x5e, 0x53, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x92, 0x61, 0x53, 0x43, 0x26, 0x91, 0x53, 0x43,
+        0x4d, 0x50, 0x00, 0x00, 0x18, 0x94, 0x53, 0x43, 0xac, 0xc3, 0x53, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x18, 0x94, 0x53, 0x43, 0xac, 0x13, 0x55, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x18, 0x94, 0x53, 0x43,
+        0xac, 0x13, 0x55, 0x43, 0x37, 0x50, 0x01, 0x00, 0x9f, 0xc6, 0x53, 0x43, 0x33, 0x56, 0x54, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x33, 0x5e, 0x54, 0x43, 0xc7, 0x8d, 0x54, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xba, 0x90, 0x54, 0x43, 0x4e, 0x80, 0x55, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x4e, 0x28, 0x55, 0x43,
+        0xe2, 0xa7, 0x56, 0x43, 0x2e, 0x50, 0x01, 0x00, 0x4e, 0x28, 0x55, 0x43, 0xe2, 0xa7, 0x56, 0x43,
+        0x3a, 0x50, 0x01, 0x00, 0x5b, 0x8d, 0x55, 0x43, 0xf0, 0xbc, 0x55, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xe2, 0xbf, 0x55, 0x43, 0x76, 0xef, 0x55, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x69, 0xf2, 0x55, 0x43,
+        0xfd, 0xb1, 0x56, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x84, 0xbc, 0x56, 0x43, 0x18, 0xec, 0x56, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x84, 0xbc, 0x56, 0x43, 0x18, 0x3c, 0x58, 0x43, 0x29, 0x50, 0x01, 0x00,
+        0x84, 0xbc, 0x56, 0x43, 0x18, 0x3c, 0x58, 0x43, 0x35, 0x50, 0x01, 0x00, 0x0a, 0xef, 0x56, 0x43,
+        0x9f, 0x7e, 0x57, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x9e, 0x86, 0x57, 0x43, 0x33, 0xb6, 0x57, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x25, 0xb9, 0x57, 0x43, 0xb9, 0xa8, 0x58, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0xb9, 0x50, 0x58, 0x43, 0x4d, 0xd0, 0x59, 0x43, 0x30, 0x50, 0x01, 0x00, 0xb9, 0x50, 0x58, 0x43,
+        0x4d, 0xd0, 0x59, 0x43, 0x3c, 0x50, 0x01, 0x00, 0xc7, 0xb5, 0x58, 0x43, 0x5b, 0xe5, 0x58, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x4d, 0xe8, 0x58, 0x43, 0xe2, 0x17, 0x59, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0xd4, 0x1a, 0x59, 0x43, 0x68, 0xda, 0x59, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xef, 0xe4, 0x59, 0x43,
+        0x83, 0xa4, 0x5a, 0x43, 0x4d, 0x50, 0x00, 0x00, 0xef, 0xe4, 0x59, 0x43, 0x83, 0x64, 0x5b, 0x43,
+        0x29, 0x50, 0x01, 0x00, 0xef, 0xe4, 0x59, 0x43, 0x83, 0x64, 0x5b, 0x43, 0x35, 0x50, 0x01, 0x00,
+        0x0a, 0xaf, 0x5a, 0x43, 0x9e, 0x6e, 0x5b, 0x43, 0x4d, 0x50, 0x00, 0x00, 0x25, 0x79, 0x5b, 0x43,
+        0xb9, 0x38, 0x5c, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x25, 0x79, 0x5b, 0x43, 0xb9, 0xf8, 0x5c, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x25, 0x79, 0x5b, 0x43, 0xb9, 0xf8, 0x5c, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0xc6, 0x75, 0x5c, 0x43, 0x5a, 0xa5, 0x5c, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x4d, 0xa8, 0x5c, 0x43,
+        0xe1, 0xd7, 0x5c, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xd4, 0xda, 0x5c, 0x43, 0x68, 0x0a, 0x5d, 0x43,
+        0x4d, 0x50, 0x00, 0x00, 0x5a, 0x0d, 0x5d, 0x43, 0xef, 0x3c, 0x5d, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x5a, 0x0d, 0x5d, 0x43, 0xee, 0x8c, 0x5e, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x5a, 0x0d, 0x5d, 0x43,
+        0xee, 0x8c, 0x5e, 0x43, 0x37, 0x50, 0x01, 0x00, 0xe1, 0x3f, 0x5d, 0x43, 0x75, 0xcf, 0x5d, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x75, 0xd7, 0x5d, 0x43, 0x09, 0x07, 0x5e, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0xfc, 0x09, 0x5e, 0x43, 0x90, 0xf9, 0x5e, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x90, 0xa1, 0x5e, 0x43,
+        0x24, 0x21, 0x60, 0x43, 0x2e, 0x50, 0x01, 0x00, 0x90, 0xa1, 0x5e, 0x43, 0x24, 0x21, 0x60, 0x43,
+        0x3a, 0x50, 0x01, 0x00, 0x9d, 0x06, 0x5f, 0x43, 0x32, 0x36, 0x5f, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x24, 0x39, 0x5f, 0x43, 0xb8, 0x68, 0x5f, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xab, 0x6b, 0x5f, 0x43,
+        0x3f, 0x2b, 0x60, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xc6, 0x35, 0x60, 0x43, 0x5a, 0x65, 0x60, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0xc6, 0x35, 0x60, 0x43, 0x5a, 0xb5, 0x61, 0x43, 0x29, 0x50, 0x01, 0x00,
+        0xc6, 0x35, 0x60, 0x43, 0x5a, 0xb5, 0x61, 0x43, 0x35, 0x50, 0x01, 0x00, 0x4c, 0x68, 0x60, 0x43,
+        0xe1, 0xf7, 0x60, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xe1, 0xff, 0x60, 0x43, 0x75, 0x2f, 0x61, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x67, 0x32, 0x61, 0x43, 0xfb, 0x21, 0x62, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0xfb, 0xc9, 0x61, 0x43, 0x8f, 0x49, 0x63, 0x43, 0x30, 0x50, 0x01, 0x00, 0xfb, 0xc9, 0x61, 0x43,
+        0x8f, 0x49, 0x63, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x09, 0x2f, 0x62, 0x43, 0x9d, 0x5e, 0x62, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x90, 0x61, 0x62, 0x43, 0x24, 0x91, 0x62, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x16, 0x94, 0x62, 0x43, 0xaa, 0x53, 0x63, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x31, 0x5e, 0x63, 0x43,
+        0xc5, 0x8d, 0x63, 0x43, 0x51, 0x50, 0x00, 0x00, 0x31, 0x5e, 0x63, 0x43, 0xc5, 0xdd, 0x64, 0x43,
+        0x2b, 0x50, 0x01, 0x00, 0x31, 0x5e, 0x63, 0x43, 0xc5, 0xdd, 0x64, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0xb8, 0x90, 0x63, 0x43, 0x4c, 0x20, 0x64, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x4c, 0x28, 0x64, 0x43,
+        0xe0, 0x57, 0x64, 0x43, 0x51, 0x50, 0x00, 0x00, 0xd3, 0x5a, 0x64, 0x43, 0x67, 0x4a, 0x65, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x67, 0xf2, 0x64, 0x43, 0xfb, 0x71, 0x66, 0x43, 0x2e, 0x50, 0x01, 0x00,
+        0x67, 0xf2, 0x64, 0x43, 0xfb, 0x71, 0x66, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x74, 0x57, 0x65, 0x43,
+        0x08, 0x87, 0x65, 0x43, 0x51, 0x50, 0x00, 0x00, 0xfb, 0x89, 0x65, 0x43, 0x8f, 0xb9, 0x65, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x82, 0xbc, 0x65, 0x43, 0x16, 0x7c, 0x66, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x9c, 0x86, 0x66, 0x43, 0x31, 0x46, 0x67, 0x43, 0x4d, 0x50, 0x00, 0x00, 0x9c, 0x86, 0x66, 0x43,
+        0x30, 0x06, 0x68, 0x43, 0x29, 0x50, 0x01, 0x00, 0x9c, 0x86, 0x66, 0x43, 0x30, 0x06, 0x68, 0x43,
+        0x35, 0x50, 0x01, 0x00, 0xb7, 0x50, 0x67, 0x43, 0x4b, 0x10, 0x68, 0x43, 0x4d, 0x50, 0x00, 0x00,
+        0xd2, 0x1a, 0x68, 0x43, 0x66, 0xda, 0x68, 0x43, 0x4f, 0x50, 0x00, 0x00, 0xd2, 0x1a, 0x68, 0x43,
+        0x66, 0x9a, 0x69, 0x43, 0x30, 0x50, 0x01, 0x00, 0xd2, 0x1a, 0x68, 0x43, 0x66, 0x9a, 0x69, 0x43,
+        0x3c, 0x50, 0x01, 0x00, 0x08, 0xaf, 0x69, 0x43, 0x9c, 0xde, 0x69, 0x43, 0x56, 0x50, 0x00, 0x00,
+        0x08, 0xaf, 0x69, 0x43, 0x9c, 0x2e, 0x6b, 0x43, 0x2e, 0x50, 0x01, 0x00, 0x08, 0xaf, 0x69, 0x43,
+        0x9c, 0x2e, 0x6b, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x8e, 0xe1, 0x69, 0x43, 0x23, 0x11, 0x6a, 0x43,
+        0x54, 0x50, 0x00, 0x00, 0x15, 0x14, 0x6a, 0x43, 0xa9, 0x73, 0x6a, 0x43, 0x56, 0x50, 0x00, 0x00,
+        0x23, 0x79, 0x6a, 0x43, 0xb7, 0xa8, 0x6a, 0x43, 0x54, 0x50, 0x00, 0x00, 0xa9, 0xab, 0x6a, 0x43,
+        0x3d, 0xdb, 0x6a, 0x43, 0x51, 0x50, 0x00, 0x00, 0x30, 0xde, 0x6a, 0x43, 0xc4, 0x9d, 0x6b, 0x43,
+        0x54, 0x50, 0x00, 0x00, 0x3d, 0x43, 0x6b, 0x43, 0xd1, 0xc2, 0x6c, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x3d, 0x43, 0x6b, 0x43, 0xd1, 0xc2, 0x6c, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x4b, 0xa8, 0x6b, 0x43,
+        0xdf, 0xd7, 0x6b, 0x43, 0x51, 0x50, 0x00, 0x00, 0xd2, 0xda, 0x6b, 0x43, 0x66, 0x0a, 0x6c, 0x43,
+        0x4f, 0x50, 0x00, 0x00, 0x58, 0x0d, 0x6c, 0x43, 0xec, 0x6c, 0x6c, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x73, 0xd7, 0x6c, 0x43, 0x07, 0x07, 0x6d, 0x43, 0x51, 0x50, 0x00, 0x00, 0x73, 0xd7, 0x6c, 0x43,
+        0x07, 0x57, 0x6e, 0x43, 0x30, 0x50, 0x01, 0x00, 0x73, 0xd7, 0x6c, 0x43, 0x07, 0x57, 0x6e, 0x43,
+        0x3c, 0x50, 0x01, 0x00, 0xfa, 0x09, 0x6d, 0x43, 0x8e, 0x39, 0x6d, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0x81, 0x3c, 0x6d, 0x43, 0x15, 0x9c, 0x6d, 0x43, 0x51, 0x50, 0x00, 0x00, 0x8e, 0xa1, 0x6d, 0x43,
+        0x22, 0x01, 0x6e, 0x43, 0x4f, 0x50, 0x00, 0x00, 0x9b, 0x06, 0x6e, 0x43, 0x30, 0x36, 0x6e, 0x43,
+        0x4d, 0x50, 0x00, 0x00, 0x22, 0x39, 0x6e, 0x43, 0xb6, 0xf8, 0x6e, 0x43, 0x4f, 0x50, 0x00, 0x00,
+        0xa9, 0x6b, 0x6e, 0x43, 0x3d, 0xeb, 0x6f, 0x43, 0x32, 0x50, 0x01, 0x00, 0xa9, 0x6b, 0x6e, 0x43,
+        0x3d, 0xeb, 0x6f, 0x43, 0x3e, 0x50, 0x01, 0x00, 0x3d, 0x03, 0x6f, 0x43, 0xd1, 0x32, 0x6f, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0xc4, 0x35, 0x6f, 0x43, 0x58, 0x65, 0x6f, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x4a, 0x68, 0x6f, 0x43, 0xde, 0xc7, 0x6f, 0x43, 0x48, 0x50, 0x00, 0x00, 0xde, 0xff, 0x6f, 0x43,
+        0x73, 0x8f, 0x70, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xde, 0xff, 0x6f, 0x43, 0x72, 0x7f, 0x71, 0x43,
+        0x2e, 0x50, 0x01, 0x00, 0xde, 0xff, 0x6f, 0x43, 0x72, 0x7f, 0x71, 0x43, 0x3a, 0x50, 0x01, 0x00,
+        0x73, 0x97, 0x70, 0x43, 0x07, 0xc7, 0x70, 0x43, 0x48, 0x50, 0x00, 0x00, 0xf9, 0xc9, 0x70, 0x43,
+        0x8d, 0xf9, 0x70, 0x43, 0x46, 0x50, 0x00, 0x00, 0x80, 0xfc, 0x70, 0x43, 0x14, 0x2c, 0x71, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x07, 0x2f, 0x71, 0x43, 0x9b, 0x5e, 0x71, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x8d, 0x61, 0x71, 0x43, 0x22, 0x91, 0x71, 0x43, 0x41, 0x50, 0x00, 0x00, 0x14, 0x94, 0x71, 0x43,
+        0xa8, 0x23, 0x72, 0x43, 0x48, 0x50, 0x00, 0x00, 0x14, 0x94, 0x71, 0x43, 0xa8, 0x13, 0x73, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x14, 0x94, 0x71, 0x43, 0xa8, 0x13, 0x73, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0xa8, 0x2b, 0x72, 0x43, 0x3c, 0x5b, 0x72, 0x43, 0x46, 0x50, 0x00, 0x00, 0x2f, 0x5e, 0x72, 0x43,
+        0xc3, 0x8d, 0x72, 0x43, 0x45, 0x50, 0x00, 0x00, 0xb6, 0x90, 0x72, 0x43, 0x4a, 0xc0, 0x72, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x3c, 0xc3, 0x72, 0x43, 0xd1, 0xf2, 0x72, 0x43, 0x41, 0x50, 0x00, 0x00,
+        0xc3, 0xf5, 0x72, 0x43, 0x57, 0x25, 0x73, 0x43, 0x40, 0x50, 0x00, 0x00, 0x4a, 0x28, 0x73, 0x43,
+        0xde, 0xb7, 0x73, 0x43, 0x48, 0x50, 0x00, 0x00, 0x4a, 0x28, 0x73, 0x43, 0xde, 0xa7, 0x74, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x4a, 0x28, 0x73, 0x43, 0xde, 0xa7, 0x74, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0xde, 0xbf, 0x73, 0x43, 0x72, 0xef, 0x73, 0x43, 0x46, 0x50, 0x00, 0x00, 0x65, 0xf2, 0x73, 0x43,
+        0xf9, 0x21, 0x74, 0x43, 0x45, 0x50, 0x00, 0x00, 0xeb, 0x24, 0x74, 0x43, 0x80, 0x54, 0x74, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x72, 0x57, 0x74, 0x43, 0x06, 0x87, 0x74, 0x43, 0x41, 0x50, 0x00, 0x00,
+        0xf9, 0x89, 0x74, 0x43, 0x8d, 0xb9, 0x74, 0x43, 0x40, 0x50, 0x00, 0x00, 0x7f, 0xbc, 0x74, 0x43,
+        0x14, 0x4c, 0x75, 0x43, 0x48, 0x50, 0x00, 0x00, 0x7f, 0xbc, 0x74, 0x43, 0x13, 0x3c, 0x76, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x14, 0x54, 0x75, 0x43, 0xa8, 0x83, 0x75, 0x43, 0x46, 0x50, 0x00, 0x00,
+        0x9a, 0x86, 0x75, 0x43, 0x2e, 0xb6, 0x75, 0x43, 0x45, 0x50, 0x00, 0x00, 0x21, 0xb9, 0x75, 0x43,
+        0xb5, 0xe8, 0x75, 0x43, 0x43, 0x50, 0x00, 0x00, 0xa8, 0xeb, 0x75, 0x43, 0x3c, 0x1b, 0x76, 0x43,
+        0x41, 0x50, 0x00, 0x00, 0x2e, 0x1e, 0x76, 0x43, 0x13, 0x3c, 0x76, 0x43, 0x3e, 0x50, 0x01, 0x00,
+        0xb5, 0x50, 0x76, 0x43, 0x49, 0xe0, 0x76, 0x43, 0x4a, 0x50, 0x00, 0x00, 0xb5, 0x50, 0x76, 0x43,
+        0x49, 0xd0, 0x77, 0x43, 0x2b, 0x50, 0x01, 0x00, 0xb5, 0x50, 0x76, 0x43, 0x49, 0xd0, 0x77, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x49, 0xe8, 0x76, 0x43, 0xdd, 0x17, 0x77, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0xd0, 0x1a, 0x77, 0x43, 0x64, 0x4a, 0x77, 0x43, 0x45, 0x50, 0x00, 0x00, 0x57, 0x4d, 0x77, 0x43,
+        0xeb, 0x7c, 0x77, 0x43, 0x43, 0x50, 0x00, 0x00, 0xdd, 0x7f, 0x77, 0x43, 0x72, 0xaf, 0x77, 0x43,
+        0x41, 0x50, 0x00, 0x00, 0x64, 0xb2, 0x77, 0x43, 0xf8, 0xe1, 0x77, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0xeb, 0xe4, 0x77, 0x43, 0x7f, 0x74, 0x78, 0x43, 0x48, 0x50, 0x00, 0x00, 0xeb, 0xe4, 0x77, 0x43,
+        0x7f, 0x64, 0x79, 0x43, 0x2b, 0x50, 0x01, 0x00, 0xeb, 0xe4, 0x77, 0x43, 0x7f, 0x64, 0x79, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x7f, 0x7c, 0x78, 0x43, 0x13, 0xac, 0x78, 0x43, 0x46, 0x50, 0x00, 0x00,
+        0x06, 0xaf, 0x78, 0x43, 0x9a, 0xde, 0x78, 0x43, 0x45, 0x50, 0x00, 0x00, 0x8c, 0xe1, 0x78, 0x43,
+        0x21, 0x11, 0x79, 0x43, 0x43, 0x50, 0x00, 0x00, 0x13, 0x14, 0x79, 0x43, 0xa7, 0x43, 0x79, 0x43,
+        0x41, 0x50, 0x00, 0x00, 0x9a, 0x46, 0x79, 0x43, 0x2e, 0x76, 0x79, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x20, 0x79, 0x79, 0x43, 0xb4, 0x78, 0x7c, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x20, 0x79, 0x79, 0x43,
+        0xb4, 0x78, 0x7c, 0x43, 0x41, 0x50, 0x00, 0x00, 0x20, 0x79, 0x79, 0x43, 0xb4, 0x78, 0x7c, 0x43,
+        0x46, 0x50, 0x00, 0x00, 0x20, 0x79, 0x79, 0x43, 0xb4, 0x78, 0x7c, 0x43, 0x2e, 0x50, 0x01, 0x00,
+        0x20, 0x79, 0x79, 0x43, 0xb4, 0x78, 0x7c, 0x43, 0x3a, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x22, 0x22, 0x72, 0x3e, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3e, 0x11, 0x11, 0xf9, 0x3e,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x89, 0x88, 0x3c, 0x3f, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x3f, 0x89, 0x88, 0x7c, 0x3f, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+        0x44, 0x44, 0x9e, 0x3f, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0xab, 0xaa, 0xbc, 0x3f,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x3f, 0x44, 0x44, 0xbe, 0x3f, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x3f, 0x89, 0x88, 0x0d, 0x40, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f,
+        0xab, 0xaa, 0xfc, 0x3f, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x1e, 0x40,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x40, 0x55, 0x55, 0x2e, 0x40, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x40, 0x55, 0x55, 0x3e, 0x40, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x30, 0x40,
+        0xef, 0xee, 0x7b, 0x40, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x55, 0x55, 0x5e, 0x40,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x40, 0x55, 0x55, 0x7e, 0x40, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x80, 0x40, 0x11, 0x91, 0x87, 0x40, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40,
+        0xab, 0x2a, 0x8f, 0x40, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x88, 0x40, 0x11, 0x91, 0x8f, 0x40,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x11, 0x91, 0x97, 0x40, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x90, 0x40, 0xab, 0x2a, 0x9f, 0x40, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x98, 0x40,
+        0x11, 0x91, 0x9f, 0x40, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x11, 0x91, 0xa7, 0x40,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0xab, 0x2a, 0xaf, 0x40, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa8, 0x40, 0x11, 0x91, 0xaf, 0x40, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x40,
+        0x44, 0xc4, 0xc6, 0x40, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x40, 0xab, 0x2a, 0xbf, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x40, 0xab, 0x2a, 0xcf, 0x40, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc8, 0x40, 0x11, 0x91, 0xcf, 0x40, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x40,
+        0xab, 0x2a, 0xdf, 0x40, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x40, 0xab, 0x2a, 0xdf, 0x40,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x40, 0xde, 0x5d, 0xfe, 0x40, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe0, 0x40, 0xab, 0x2a, 0xef, 0x40, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x40,
+        0xab, 0x2a, 0xff, 0x40, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x41, 0x89, 0xc8, 0x03, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x55, 0x95, 0x07, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x04, 0x41, 0x89, 0xc8, 0x07, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41,
+        0x89, 0xc8, 0x0b, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x55, 0x95, 0x0f, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x41, 0x89, 0xc8, 0x0f, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x41, 0x89, 0xc8, 0x13, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41,
+        0x55, 0x95, 0x17, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x14, 0x41, 0x89, 0xc8, 0x17, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18, 0x41, 0x22, 0x62, 0x23, 0x41, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x41, 0x55, 0x95, 0x1f, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x20, 0x41,
+        0x55, 0x95, 0x27, 0x41, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x24, 0x41, 0x55, 0x95, 0x2b, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x41, 0x55, 0x95, 0x2f, 0x41, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x2c, 0x41, 0x89, 0xc8, 0x2f, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x41,
+        0x89, 0xc8, 0x33, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0x55, 0x95, 0x37, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x34, 0x41, 0x22, 0x62, 0x3f, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0x41, 0x55, 0x95, 0x3f, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x41,
+        0x89, 0xc8, 0x43, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0x55, 0x95, 0x47, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x44, 0x41, 0x55, 0x95, 0x4b, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x48, 0x41, 0x55, 0x95, 0x4f, 0x41, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x41,
+        0xef, 0x2e, 0x6e, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x41, 0x55, 0x95, 0x57, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x58, 0x41, 0x55, 0x95, 0x5f, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x60, 0x41, 0x55, 0x95, 0x67, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x68, 0x41,
+        0x55, 0x95, 0x6f, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x41, 0x55, 0x95, 0x77, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x78, 0x41, 0x55, 0x95, 0x7f, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x80, 0x41, 0x44, 0xe4, 0x81, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x41,
+        0xab, 0xca, 0x83, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x82, 0x41, 0x44, 0xe4, 0x83, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x41, 0x44, 0xe4, 0x85, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x84, 0x41, 0xab, 0xca, 0x87, 0x41, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x86, 0x41,
+        0x44, 0xe4, 0x87, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x41, 0x44, 0xe4, 0x89, 0x41,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x41, 0xab, 0xca, 0x8b, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8a, 0x41, 0x44, 0xe4, 0x8b, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x41,
+        0x11, 0xb1, 0x91, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x41, 0xab, 0xca, 0x8f, 0x41,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x41, 0xab, 0xca, 0x93, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x92, 0x41, 0xab, 0xca, 0x95, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x94, 0x41,
+        0xab, 0xca, 0x97, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x96, 0x41, 0xde, 0x7d, 0x9f, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x98, 0x41, 0xab, 0xca, 0x9b, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x9c, 0x41, 0xab, 0xca, 0x9f, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x41,
+        0x44, 0xe4, 0xa1, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x41, 0xab, 0xca, 0xa3, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa2, 0x41, 0x44, 0xe4, 0xa3, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa4, 0x41, 0x44, 0xe4, 0xa5, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x41,
+        0xab, 0xca, 0xa7, 0x41, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa6, 0x41, 0x44, 0xe4, 0xa7, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x41, 0x44, 0xe4, 0xa9, 0x41, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa8, 0x41, 0xab, 0xca, 0xab, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x41,
+        0x44, 0xe4, 0xab, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x41, 0x11, 0xb1, 0xb1, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x41, 0xab, 0xca, 0xaf, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb0, 0x41, 0xab, 0xca, 0xb3, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb2, 0x41,
+        0x44, 0xe4, 0xb3, 0x41, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x41, 0xab, 0xca, 0xb7, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x41, 0xab, 0xca, 0xb7, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xb8, 0x41, 0x77, 0x97, 0xbf, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x41,
+        0xab, 0xca, 0xbb, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x41, 0xab, 0xca, 0xbf, 0x41,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x44, 0xe4, 0xc1, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc0, 0x41, 0xab, 0xca, 0xc3, 0x41, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x41,
+        0x44, 0xe4, 0xc3, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x41, 0x44, 0xe4, 0xc5, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x41, 0xab, 0xca, 0xc7, 0x41, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xc6, 0x41, 0x44, 0xe4, 0xc7, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41,
+        0x44, 0xe4, 0xc9, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0xab, 0xca, 0xcb, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xca, 0x41, 0x44, 0xe4, 0xcb, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xcc, 0x41, 0x11, 0xb1, 0xd1, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x41,
+        0xab, 0xca, 0xcf, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x41, 0xab, 0xca, 0xd3, 0x41,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x41, 0xab, 0xca, 0xd5, 0x41, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd4, 0x41, 0xab, 0xca, 0xd7, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd6, 0x41,
+        0x44, 0xe4, 0xd7, 0x41, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x41, 0x44, 0xe4, 0xd9, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x41, 0xab, 0xca, 0xdb, 0x41, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xda, 0x41, 0x11, 0xb1, 0xdf, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x41,
+        0xab, 0xca, 0xdf, 0x41, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x44, 0xe4, 0xe1, 0x41,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41, 0xab, 0xca, 0xe3, 0x41, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe2, 0x41, 0xab, 0xca, 0xe5, 0x41, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x41,
+        0xab, 0xca, 0xe7, 0x41, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x41, 0x77, 0x17, 0xf7, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0xab, 0xca, 0xeb, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xec, 0x41, 0xab, 0xca, 0xef, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x41,
+        0xab, 0xca, 0xf3, 0x41, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x41, 0xab, 0xca, 0xf7, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf8, 0x41, 0xab, 0xca, 0xfb, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xfc, 0x41, 0x44, 0xe4, 0xfd, 0x41, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x41,
+        0xab, 0xca, 0xff, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x41, 0x44, 0xe4, 0xff, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x22, 0xf2, 0x00, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x42, 0x55, 0xe5, 0x01, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x01, 0x42,
+        0x22, 0xf2, 0x01, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x22, 0xf2, 0x02, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x55, 0xe5, 0x03, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x03, 0x42, 0x22, 0xf2, 0x03, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42,
+        0x55, 0xe5, 0x05, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42, 0x55, 0xe5, 0x05, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x06, 0x42, 0x22, 0xf2, 0x06, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0x42, 0x55, 0xe5, 0x07, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x07, 0x42,
+        0x22, 0xf2, 0x07, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x22, 0xf2, 0x08, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x55, 0xe5, 0x09, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x09, 0x42, 0x22, 0xf2, 0x09, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x42,
+        0x55, 0xe5, 0x0b, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x55, 0xe5, 0x0b, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x42, 0x55, 0xe5, 0x0d, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x0e, 0x42, 0x55, 0xe5, 0x0f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x42,
+        0x22, 0xf2, 0x10, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x55, 0xe5, 0x11, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x11, 0x42, 0x22, 0xf2, 0x11, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x12, 0x42, 0x22, 0xf2, 0x12, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x12, 0x42,
+        0x55, 0xe5, 0x13, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x13, 0x42, 0x22, 0xf2, 0x13, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x42, 0x55, 0xe5, 0x15, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0x42, 0x55, 0xe5, 0x15, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x16, 0x42,
+        0x22, 0xf2, 0x16, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42, 0x55, 0xe5, 0x17, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x17, 0x42, 0x22, 0xf2, 0x17, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x42, 0x55, 0xe5, 0x19, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18, 0x42,
+        0x55, 0xe5, 0x19, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x42, 0x22, 0xf2, 0x1a, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x42, 0x55, 0xe5, 0x1b, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x1b, 0x42, 0x22, 0xf2, 0x1b, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x42,
+        0xbc, 0xcb, 0x1f, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x55, 0xe5, 0x1d, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x42, 0x55, 0xe5, 0x1f, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x20, 0x42, 0x22, 0xf2, 0x20, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x42,
+        0x55, 0xe5, 0x21, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x21, 0x42, 0x22, 0xf2, 0x21, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42, 0x22, 0xf2, 0x22, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x22, 0x42, 0x55, 0xe5, 0x23, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x23, 0x42,
+        0x22, 0xf2, 0x23, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x22, 0xf2, 0x24, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x55, 0xe5, 0x25, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x25, 0x42, 0x22, 0xf2, 0x25, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42,
+        0x22, 0xf2, 0x26, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42, 0x55, 0xe5, 0x27, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x27, 0x42, 0x22, 0xf2, 0x27, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x28, 0x42, 0x22, 0xf2, 0x28, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42,
+        0x55, 0xe5, 0x29, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x29, 0x42, 0x22, 0xf2, 0x29, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x42, 0x22, 0xb2, 0x2f, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2a, 0x42, 0x55, 0xe5, 0x2b, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x42,
+        0x55, 0xe5, 0x2d, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x42, 0x55, 0xe5, 0x2f, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x30, 0x42, 0x55, 0xe5, 0x31, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x32, 0x42, 0x55, 0xe5, 0x33, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x34, 0x42,
+        0x55, 0xe5, 0x35, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x36, 0x42, 0x55, 0xe5, 0x37, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x38, 0x42, 0x55, 0xe5, 0x39, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3a, 0x42, 0x55, 0xe5, 0x3b, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x42,
+        0x55, 0xe5, 0x3d, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x22, 0xf2, 0x3e, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x55, 0xe5, 0x3f, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3f, 0x42, 0x22, 0xf2, 0x3f, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42,
+        0x22, 0xf2, 0x40, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42, 0x55, 0xe5, 0x41, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x41, 0x42, 0x22, 0xf2, 0x41, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x42, 0x42, 0x22, 0xf2, 0x42, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42,
+        0x55, 0xe5, 0x43, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x43, 0x42, 0x22, 0xf2, 0x43, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x44, 0x42, 0x55, 0xe5, 0x45, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x44, 0x42, 0x55, 0xe5, 0x45, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x46, 0x42,
+        0x22, 0xf2, 0x46, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x42, 0x55, 0xe5, 0x47, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x47, 0x42, 0x22, 0xf2, 0x47, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x48, 0x42, 0x22, 0xf2, 0x48, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42,
+        0x55, 0xe5, 0x49, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x49, 0x42, 0x22, 0xf2, 0x49, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x42, 0x55, 0xe5, 0x4b, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x4a, 0x42, 0x55, 0xe5, 0x4b, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x42,
+        0x55, 0xe5, 0x4d, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x42, 0x55, 0xe5, 0x4f, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x50, 0x42, 0x22, 0xf2, 0x50, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x50, 0x42, 0x55, 0xe5, 0x51, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x51, 0x42,
+        0x22, 0xf2, 0x51, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x52, 0x42, 0x22, 0xf2, 0x52, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x52, 0x42, 0x55, 0xe5, 0x53, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x53, 0x42, 0x22, 0xf2, 0x53, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x42,
+        0x55, 0xe5, 0x55, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x42, 0x55, 0xe5, 0x55, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x56, 0x42, 0x22, 0xf2, 0x56, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x56, 0x42, 0x55, 0xe5, 0x57, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x57, 0x42,
+        0x22, 0xf2, 0x57, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42, 0x55, 0xe5, 0x59, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x42, 0x55, 0xe5, 0x59, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x5a, 0x42, 0x22, 0xf2, 0x5a, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x42,
+        0x55, 0xe5, 0x5b, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5b, 0x42, 0x22, 0xf2, 0x5b, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x42, 0xbc, 0xcb, 0x5f, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x5c, 0x42, 0x55, 0xe5, 0x5d, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x42,
+        0x55, 0xe5, 0x5f, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x60, 0x42, 0x22, 0xf2, 0x60, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x42, 0x55, 0xe5, 0x61, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x61, 0x42, 0x22, 0xf2, 0x61, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x62, 0x42,
+        0x22, 0xf2, 0x62, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x62, 0x42, 0x55, 0xe5, 0x63, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x63, 0x42, 0x22, 0xf2, 0x63, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x64, 0x42, 0x22, 0xf2, 0x64, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x64, 0x42,
+        0x55, 0xe5, 0x65, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x65, 0x42, 0x22, 0xf2, 0x65, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x66, 0x42, 0x22, 0xf2, 0x66, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x66, 0x42, 0x55, 0xe5, 0x67, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x67, 0x42,
+        0x22, 0xf2, 0x67, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42, 0x22, 0xf2, 0x68, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x42, 0x55, 0xe5, 0x69, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x69, 0x42, 0x22, 0xf2, 0x69, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42,
+        0x22, 0xb2, 0x6f, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x55, 0xe5, 0x6b, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x42, 0x55, 0xe5, 0x6d, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x6e, 0x42, 0x55, 0xe5, 0x6f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42,
+        0x55, 0xe5, 0x71, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x72, 0x42, 0x55, 0xe5, 0x73, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x74, 0x42, 0x55, 0xe5, 0x75, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x76, 0x42, 0x55, 0xe5, 0x77, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x78, 0x42,
+        0x55, 0xe5, 0x79, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x42, 0x55, 0xe5, 0x7b, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x44, 0xcc, 0x81, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x7e, 0x42, 0x22, 0xf2, 0x7e, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x42,
+        0x22, 0xf2, 0x7f, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x11, 0x79, 0x80, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x80, 0x42, 0x11, 0xf9, 0x80, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x81, 0x42, 0x11, 0x79, 0x81, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x81, 0x42,
+        0x11, 0xf9, 0x81, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x42, 0x44, 0xcc, 0x85, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x42, 0xab, 0xf2, 0x82, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x83, 0x42, 0xab, 0xf2, 0x83, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x42,
+        0xab, 0xf2, 0x84, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x85, 0x42, 0xab, 0xf2, 0x85, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x86, 0x42, 0x44, 0xcc, 0x89, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x86, 0x42, 0x44, 0xcc, 0x89, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x86, 0x42,
+        0x44, 0xcc, 0x89, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x86, 0x42, 0xab, 0xf2, 0x86, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x87, 0x42, 0xab, 0xf2, 0x87, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x88, 0x42, 0xab, 0xf2, 0x88, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x89, 0x42,
+        0xab, 0xf2, 0x89, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x42, 0x44, 0xcc, 0x8d, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x42, 0x44, 0xcc, 0x8d, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x8a, 0x42, 0x44, 0xcc, 0x8d, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x42,
+        0xab, 0xf2, 0x8a, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x42, 0xab, 0xf2, 0x8b, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8c, 0x42, 0xab, 0xf2, 0x8c, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x8d, 0x42, 0xab, 0xf2, 0x8d, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x42,
+        0x44, 0xcc, 0x91, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x42, 0x44, 0xcc, 0x91, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x42, 0x44, 0xcc, 0x91, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x8e, 0x42, 0xab, 0xf2, 0x8e, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8f, 0x42,
+        0xab, 0xf2, 0x8f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x90, 0x42, 0xab, 0xf2, 0x90, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x91, 0x42, 0xab, 0xf2, 0x91, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x92, 0x42, 0x44, 0xcc, 0x95, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42,
+        0x44, 0xcc, 0x95, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42, 0x44, 0xcc, 0x95, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42, 0xab, 0xf2, 0x92, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x93, 0x42, 0xab, 0xf2, 0x93, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x94, 0x42,
+        0xab, 0xf2, 0x94, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x95, 0x42, 0xab, 0xf2, 0x95, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x96, 0x42, 0x44, 0xcc, 0x99, 0x42, 0x3c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x96, 0x42, 0x44, 0xcc, 0x99, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x96, 0x42,
+        0x44, 0xcc, 0x99, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x96, 0x42, 0xab, 0xf2, 0x96, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x97, 0x42, 0xab, 0xf2, 0x97, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x98, 0x42, 0xab, 0xf2, 0x98, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x99, 0x42,
+        0xab, 0xf2, 0x99, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9a, 0x42, 0x44, 0xcc, 0x9d, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x42, 0x44, 0xcc, 0x9d, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9a, 0x42, 0x44, 0xcc, 0x9d, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x42,
+        0xab, 0xf2, 0x9a, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9b, 0x42, 0xab, 0xf2, 0x9b, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x42, 0xab, 0xf2, 0x9c, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x9d, 0x42, 0xab, 0xf2, 0x9d, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9e, 0x42,
+        0x44, 0xcc, 0xa1, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x42, 0x44, 0xcc, 0xa1, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x42, 0x44, 0xcc, 0xa1, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9e, 0x42, 0xab, 0xf2, 0x9e, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x9f, 0x42,
+        0xab, 0xf2, 0x9f, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x42, 0xab, 0xf2, 0xa0, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa1, 0x42, 0xab, 0xf2, 0xa1, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xa2, 0x42, 0x11, 0x79, 0xa2, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x42,
+        0xab, 0xf2, 0xa2, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa2, 0x42, 0x11, 0xf9, 0xa2, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x42, 0x11, 0x79, 0xa3, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa3, 0x42, 0xab, 0xf2, 0xa3, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa3, 0x42,
+        0x11, 0xf9, 0xa3, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x42, 0x11, 0x79, 0xa4, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x42, 0xab, 0xf2, 0xa4, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xa4, 0x42, 0x11, 0xf9, 0xa4, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x42,
+        0x11, 0x79, 0xa5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x42, 0xab, 0xf2, 0xa5, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa5, 0x42, 0x11, 0xf9, 0xa5, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa6, 0x42, 0xde, 0xe5, 0xa7, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x42,
+        0xab, 0xf2, 0xa6, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa7, 0x42, 0xab, 0xf2, 0xa7, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x42, 0x44, 0x6c, 0xa9, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xa8, 0x42, 0xab, 0xf2, 0xa8, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x42,
+        0xab, 0xf2, 0xa9, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xa9, 0x42, 0xab, 0x72, 0xaa, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x42, 0xab, 0xf2, 0xaa, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xaa, 0x42, 0xab, 0x72, 0xab, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xab, 0x42,
+        0xab, 0xf2, 0xab, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0xab, 0x42, 0x11, 0xf9, 0xab, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xac, 0x42, 0x11, 0x79, 0xac, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xac, 0x42, 0xab, 0xf2, 0xac, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0xac, 0x42,
+        0x11, 0xf9, 0xac, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xad, 0x42, 0xab, 0xf2, 0xad, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0xad, 0x42, 0xab, 0xf2, 0xad, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xae, 0x42, 0x44, 0x6c, 0xaf, 0x42, 0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0xae, 0x42,
+        0xab, 0xf2, 0xae, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xaf, 0x42, 0xab, 0xf2, 0xaf, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xaf, 0x42, 0x11, 0xf9, 0xaf, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb0, 0x42, 0x11, 0x79, 0xb0, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x42,
+        0xab, 0xf2, 0xb0, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0xb0, 0x42, 0xab, 0x72, 0xb1, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x42, 0xab, 0xf2, 0xb1, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xb1, 0x42, 0x44, 0xec, 0xb2, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x42,
+        0xab, 0xf2, 0xb2, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb3, 0x42, 0x11, 0x79, 0xb3, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x42, 0xab, 0xf2, 0xb3, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xb3, 0x42, 0x11, 0xf9, 0xb3, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x42,
+        0x44, 0x6c, 0xb5, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x42, 0xab, 0xf2, 0xb4, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb5, 0x42, 0xab, 0xf2, 0xb5, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xb5, 0x42, 0x11, 0xf9, 0xb5, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x42,
+        0xab, 0xf2, 0xb6, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x42, 0xab, 0xf2, 0xb6, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x42, 0xab, 0xf2, 0xb7, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xb7, 0x42, 0xab, 0xf2, 0xb7, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x42,
+        0xab, 0xf2, 0xb8, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x42, 0xab, 0xf2, 0xb9, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xba, 0x42, 0xab, 0xf2, 0xba, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xbb, 0x42, 0xab, 0xf2, 0xbb, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x42,
+        0xab, 0xf2, 0xbc, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x42, 0xab, 0xf2, 0xbd, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xbe, 0x42, 0xab, 0xf2, 0xbe, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xbf, 0x42, 0xab, 0xf2, 0xbf, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x42,
+        0xab, 0xf2, 0xc0, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc1, 0x42, 0xab, 0xf2, 0xc1, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0xc1, 0x42, 0x11, 0xf9, 0xc1, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc2, 0x42, 0x11, 0x79, 0xc2, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x42,
+        0xab, 0xf2, 0xc2, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xc2, 0x42, 0x11, 0xf9, 0xc2, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x42, 0x11, 0x79, 0xc3, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc3, 0x42, 0xab, 0xf2, 0xc3, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xc3, 0x42,
+        0x11, 0xf9, 0xc3, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x42, 0x11, 0x79, 0xc4, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x42, 0xab, 0xf2, 0xc4, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xc4, 0x42, 0xab, 0x72, 0xc5, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x42,
+        0xab, 0xf2, 0xc5, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xc5, 0x42, 0x11, 0xf9, 0xc5, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x42, 0xde, 0xe5, 0xc7, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xc6, 0x42, 0xab, 0xf2, 0xc6, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x42,
+        0xab, 0xf2, 0xc7, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x42, 0x11, 0x79, 0xc8, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x42, 0xab, 0xf2, 0xc8, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xc8, 0x42, 0x11, 0xf9, 0xc8, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x42,
+        0x11, 0x79, 0xc9, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x42, 0xab, 0xf2, 0xc9, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xc9, 0x42, 0xab, 0x72, 0xca, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xca, 0x42, 0xab, 0xf2, 0xca, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xca, 0x42,
+        0xab, 0x72, 0xcb, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x42, 0xab, 0xf2, 0xcb, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0xcb, 0x42, 0x11, 0xf9, 0xcb, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xcc, 0x42, 0x11, 0x79, 0xcc, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x42,
+        0xab, 0xf2, 0xcc, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0xcc, 0x42, 0x11, 0xf9, 0xcc, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x42, 0xab, 0xf2, 0xcd, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xcd, 0x42, 0xab, 0xf2, 0xcd, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xce, 0x42,
+        0xde, 0xe5, 0xcf, 0x42, 0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0xce, 0x42, 0xab, 0xf2, 0xce, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x00, 0x00, 0xcf, 0x42, 0xab, 0xf2, 0xcf, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd0, 0x42, 0x11, 0x79, 0xd0, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x42,
+        0xab, 0xf2, 0xd0, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0xd0, 0x42, 0x11, 0xf9, 0xd0, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x42, 0x11, 0x79, 0xd1, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd1, 0x42, 0xab, 0xf2, 0xd1, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xd1, 0x42,
+        0x11, 0xf9, 0xd1, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x42, 0x44, 0x6c, 0xd3, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x42, 0xab, 0xf2, 0xd2, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd3, 0x42, 0xab, 0xf2, 0xd3, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xd3, 0x42,
+        0xab, 0x72, 0xd4, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x42, 0xab, 0xf2, 0xd4, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x80, 0xd4, 0x42, 0x11, 0xf9, 0xd4, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xd5, 0x42, 0x11, 0x79, 0xd5, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x42,
+        0xab, 0xf2, 0xd5, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0xd5, 0x42, 0x77, 0xdf, 0xd7, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x42, 0xab, 0xf2, 0xd6, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xd7, 0x42, 0xab, 0xf2, 0xd7, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd8, 0x42,
+        0xab, 0xf2, 0xd8, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xd9, 0x42, 0xab, 0xf2, 0xd9, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xda, 0x42, 0xab, 0xf2, 0xda, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xdb, 0x42, 0xab, 0xf2, 0xdb, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xdc, 0x42,
+        0xab, 0xf2, 0xdc, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x00, 0xdd, 0x42, 0xab, 0xf2, 0xdd, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xde, 0x42, 0xab, 0xf2, 0xde, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xdf, 0x42, 0x11, 0x79, 0xdf, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x42,
+        0xab, 0xf2, 0xdf, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0xdf, 0x42, 0x11, 0xf9, 0xdf, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x42, 0x11, 0x79, 0xe0, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe0, 0x42, 0xab, 0xf2, 0xe0, 0x42, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0xe0, 0x42,
+        0x11, 0xf9, 0xe0, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x42, 0x11, 0x79, 0xe1, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x42, 0xab, 0xf2, 0xe1, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xe1, 0x42, 0x11, 0xf9, 0xe1, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x42,
+        0xab, 0xf2, 0xe2, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x42, 0xab, 0xf2, 0xe2, 0x42,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe3, 0x42, 0x11, 0x79, 0xe3, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe3, 0x42, 0xab, 0xf2, 0xe3, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xe3, 0x42,
+        0x11, 0xf9, 0xe3, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x42, 0x11, 0x79, 0xe4, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x42, 0xab, 0xf2, 0xe4, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xe4, 0x42, 0x11, 0xf9, 0xe4, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x42,
+        0xab, 0xf2, 0xe5, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x42, 0xab, 0xf2, 0xe5, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x42, 0xab, 0xf2, 0xe6, 0x42, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xe7, 0x42, 0xab, 0xf2, 0xe7, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x42,
+        0x11, 0x79, 0xe8, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x42, 0xab, 0xf2, 0xe8, 0x42,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0xe8, 0x42, 0x11, 0xf9, 0xe8, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xe9, 0x42, 0x11, 0x79, 0xe9, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x42,
+        0xab, 0xf2, 0xe9, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xe9, 0x42, 0x11, 0xf9, 0xe9, 0x42,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xea, 0x42, 0xab, 0xf2, 0xea, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xea, 0x42, 0xab, 0xf2, 0xea, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x42,
+        0x11, 0x79, 0xeb, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x42, 0xab, 0xf2, 0xeb, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0xeb, 0x42, 0x11, 0xf9, 0xeb, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xec, 0x42, 0xab, 0xf2, 0xec, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xec, 0x42,
+        0xab, 0xf2, 0xec, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xed, 0x42, 0x11, 0x79, 0xed, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xed, 0x42, 0xab, 0xf2, 0xed, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xed, 0x42, 0x11, 0xf9, 0xed, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xee, 0x42,
+        0xde, 0xe5, 0xef, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xee, 0x42, 0xab, 0xf2, 0xee, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0xef, 0x42, 0xab, 0xf2, 0xef, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0x42, 0x11, 0x79, 0xf0, 0x42, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x42,
+        0xab, 0xf2, 0xf0, 0x42, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0xf0, 0x42, 0x11, 0xf9, 0xf0, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x42, 0x11, 0x79, 0xf1, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf1, 0x42, 0xab, 0xf2, 0xf1, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x42,
+        0x11, 0xf9, 0xf1, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x42, 0x11, 0x79, 0xf2, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x42, 0xab, 0xf2, 0xf2, 0x42, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xf2, 0x42, 0x11, 0xf9, 0xf2, 0x42, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x42,
+        0x11, 0x79, 0xf3, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x42, 0xab, 0xf2, 0xf3, 0x42,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0xf3, 0x42, 0x11, 0xf9, 0xf3, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf4, 0x42, 0x11, 0x79, 0xf4, 0x42, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x42,
+        0xab, 0xf2, 0xf4, 0x42, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0xf4, 0x42, 0x11, 0xf9, 0xf4, 0x42,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x42, 0x11, 0xd9, 0xf7, 0x42, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xf5, 0x42, 0xab, 0xf2, 0xf5, 0x42, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x42,
+        0xab, 0xf2, 0xf6, 0x42, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf7, 0x42, 0xab, 0xf2, 0xf7, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xf8, 0x42, 0xab, 0xf2, 0xf8, 0x42, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xf9, 0x42, 0xab, 0xf2, 0xf9, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x42,
+        0xab, 0xf2, 0xfa, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfb, 0x42, 0xab, 0xf2, 0xfb, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x42, 0xab, 0xf2, 0xfc, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0xfd, 0x42, 0xab, 0xf2, 0xfd, 0x42, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x42,
+        0xab, 0xf2, 0xfe, 0x42, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0xff, 0x42, 0x11, 0x79, 0xff, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x42, 0xab, 0xf2, 0xff, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0xff, 0x42, 0x11, 0xf9, 0xff, 0x42, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+        0x89, 0x3c, 0x00, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x55, 0x79, 0x00, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x40, 0x00, 0x43, 0x89, 0x7c, 0x00, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x00, 0x43, 0x89, 0xbc, 0x00, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x00, 0x43,
+        0x55, 0xf9, 0x00, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x00, 0x43, 0x89, 0xfc, 0x00, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0x55, 0x79, 0x01, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x43, 0x55, 0x79, 0x01, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x01, 0x43,
+        0x89, 0xbc, 0x01, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x01, 0x43, 0x55, 0xf9, 0x01, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x01, 0x43, 0x89, 0xfc, 0x01, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x43, 0x89, 0x3c, 0x02, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x43,
+        0x55, 0x79, 0x02, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x00, 0x40, 0x02, 0x43, 0x89, 0x7c, 0x02, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x80, 0x02, 0x43, 0x55, 0xf9, 0x02, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x02, 0x43, 0x55, 0xf9, 0x02, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x03, 0x43,
+        0x55, 0x79, 0x03, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x03, 0x43, 0x55, 0xf9, 0x03, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x04, 0x43, 0x89, 0x3c, 0x04, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x43, 0x55, 0x79, 0x04, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x40, 0x04, 0x43,
+        0x89, 0x7c, 0x04, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x04, 0x43, 0x89, 0xbc, 0x04, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x04, 0x43, 0x55, 0xf9, 0x04, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x04, 0x43, 0x89, 0xfc, 0x04, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x43,
+        0x55, 0x79, 0x05, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x43, 0x55, 0x79, 0x05, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x05, 0x43, 0x89, 0xbc, 0x05, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x05, 0x43, 0x55, 0xf9, 0x05, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x05, 0x43,
+        0x89, 0xfc, 0x05, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43, 0x89, 0x3c, 0x06, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43, 0x55, 0x79, 0x06, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x06, 0x43, 0x89, 0x7c, 0x06, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x06, 0x43,
+        0x89, 0xbc, 0x06, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x06, 0x43, 0x55, 0xf9, 0x06, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x43, 0xbc, 0xef, 0x07, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x07, 0x43, 0x55, 0x79, 0x07, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x07, 0x43,
+        0x55, 0xf9, 0x07, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x08, 0x43, 0x89, 0x3c, 0x08, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x43, 0x55, 0x79, 0x08, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x08, 0x43, 0x89, 0x7c, 0x08, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x08, 0x43,
+        0x89, 0xbc, 0x08, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x08, 0x43, 0x55, 0xf9, 0x08, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x08, 0x43, 0x89, 0xfc, 0x08, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x09, 0x43, 0x89, 0x3c, 0x09, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x09, 0x43,
+        0x55, 0x79, 0x09, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x40, 0x09, 0x43, 0x89, 0x7c, 0x09, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x09, 0x43, 0x89, 0xbc, 0x09, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x09, 0x43, 0x55, 0xf9, 0x09, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x09, 0x43,
+        0x89, 0xfc, 0x09, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x43, 0x89, 0x3c, 0x0a, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x43, 0x55, 0x79, 0x0a, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x0a, 0x43, 0x89, 0x7c, 0x0a, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x80, 0x0a, 0x43,
+        0x89, 0xec, 0x0b, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x0a, 0x43, 0x55, 0xf9, 0x0a, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x43, 0x55, 0x79, 0x0b, 0x43, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x0b, 0x43, 0x55, 0xf9, 0x0b, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x43,
+        0x55, 0x79, 0x0c, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x0c, 0x43, 0x55, 0xf9, 0x0c, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x43, 0x55, 0x79, 0x0d, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x0d, 0x43, 0x55, 0xf9, 0x0d, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x43,
+        0x55, 0x79, 0x0e, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x0e, 0x43, 0x55, 0xf9, 0x0e, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x43, 0x55, 0x79, 0x0f, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x0f, 0x43, 0x55, 0xf9, 0x0f, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x43,
+        0x55, 0x79, 0x10, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x10, 0x43, 0x55, 0xf9, 0x10, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x11, 0x43, 0x89, 0x3c, 0x11, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x11, 0x43, 0x55, 0x79, 0x11, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x40, 0x11, 0x43,
+        0x89, 0x7c, 0x11, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x11, 0x43, 0x89, 0xbc, 0x11, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x11, 0x43, 0x55, 0xf9, 0x11, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x11, 0x43, 0x89, 0xfc, 0x11, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x12, 0x43,
+        0x89, 0x3c, 0x12, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x12, 0x43, 0x55, 0x79, 0x12, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x40, 0x12, 0x43, 0x89, 0x7c, 0x12, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x12, 0x43, 0x89, 0xbc, 0x12, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x12, 0x43,
+        0x55, 0xf9, 0x12, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x12, 0x43, 0x89, 0xfc, 0x12, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x13, 0x43, 0xef, 0xf2, 0x13, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x13, 0x43, 0x55, 0x79, 0x13, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x13, 0x43,
+        0x55, 0xf9, 0x13, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x14, 0x43, 0x22, 0xb6, 0x14, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x43, 0x55, 0x79, 0x14, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x14, 0x43, 0x55, 0xf9, 0x14, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x14, 0x43,
+        0x55, 0x39, 0x15, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x43, 0x55, 0x79, 0x15, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x40, 0x15, 0x43, 0x55, 0xb9, 0x15, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x15, 0x43, 0x55, 0xf9, 0x15, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x15, 0x43,
+        0x89, 0xfc, 0x15, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x43, 0x89, 0x3c, 0x16, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x43, 0x55, 0x79, 0x16, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x16, 0x43, 0x89, 0x7c, 0x16, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x16, 0x43,
+        0x55, 0xf9, 0x16, 0x43, 0x42, 0x50, 0x00, 0x00, 0x00, 0x80, 0x16, 0x43, 0x55, 0xf9, 0x16, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x17, 0x43, 0x22, 0xb6, 0x17, 0x43, 0x42, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x17, 0x43, 0x55, 0x79, 0x17, 0x43, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x80, 0x17, 0x43,
+        0x55, 0xf9, 0x17, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x17, 0x43, 0x89, 0xfc, 0x17, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18, 0x43, 0x89, 0x3c, 0x18, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x43, 0x55, 0x79, 0x18, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x40, 0x18, 0x43,
+        0x55, 0xb9, 0x18, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x18, 0x43, 0x55, 0xf9, 0x18, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x18, 0x43, 0x22, 0x76, 0x19, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x19, 0x43, 0x55, 0x79, 0x19, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x19, 0x43,
+        0x89, 0xbc, 0x19, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x80, 0x19, 0x43, 0x55, 0xf9, 0x19, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x19, 0x43, 0x89, 0xfc, 0x19, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x1a, 0x43, 0x22, 0xb6, 0x1a, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x43,
+        0x55, 0x79, 0x1a, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1a, 0x43, 0x55, 0xf9, 0x1a, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x1a, 0x43, 0x89, 0xfc, 0x1a, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x1b, 0x43, 0x55, 0x79, 0x1b, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x43,
+        0x55, 0x79, 0x1b, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1b, 0x43, 0x55, 0xf9, 0x1b, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x43, 0x55, 0xf9, 0x1b, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x1c, 0x43, 0x55, 0x79, 0x1c, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1c, 0x43,
+        0x55, 0xf9, 0x1c, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x43, 0x55, 0x79, 0x1d, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1d, 0x43, 0x55, 0xf9, 0x1d, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x1e, 0x43, 0x55, 0x79, 0x1e, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1e, 0x43,
+        0x55, 0xf9, 0x1e, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x43, 0x55, 0x79, 0x1f, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x1f, 0x43, 0x55, 0xf9, 0x1f, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x20, 0x43, 0x55, 0x79, 0x20, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x20, 0x43,
+        0x89, 0xbc, 0x20, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x20, 0x43, 0x55, 0xf9, 0x20, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x20, 0x43, 0x89, 0xfc, 0x20, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x21, 0x43, 0x55, 0x79, 0x21, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x21, 0x43,
+        0x55, 0x79, 0x21, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x21, 0x43, 0x89, 0xbc, 0x21, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x21, 0x43, 0x55, 0xf9, 0x21, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x21, 0x43, 0x89, 0xfc, 0x21, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x43,
+        0x89, 0x3c, 0x22, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x43, 0x55, 0x79, 0x22, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x40, 0x22, 0x43, 0x89, 0x7c, 0x22, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x22, 0x43, 0x89, 0xbc, 0x22, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x22, 0x43,
+        0x55, 0xf9, 0x22, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x22, 0x43, 0xef, 0xb2, 0x23, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x23, 0x43, 0x55, 0x79, 0x23, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x23, 0x43, 0x55, 0xf9, 0x23, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x23, 0x43,
+        0x89, 0xfc, 0x23, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x43, 0x89, 0x3c, 0x24, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x24, 0x43, 0x55, 0x79, 0x24, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x24, 0x43, 0x89, 0x7c, 0x24, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x24, 0x43,
+        0x89, 0xbc, 0x24, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x24, 0x43, 0x55, 0xf9, 0x24, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x24, 0x43, 0x55, 0x39, 0x25, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x25, 0x43, 0x55, 0x79, 0x25, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x40, 0x25, 0x43,
+        0x22, 0xf6, 0x25, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x25, 0x43, 0x55, 0xf9, 0x25, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x26, 0x43, 0x89, 0x3c, 0x26, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x26, 0x43, 0x55, 0x79, 0x26, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x40, 0x26, 0x43,
+        0x89, 0x7c, 0x26, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x26, 0x43, 0x89, 0xbc, 0x26, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x26, 0x43, 0x55, 0xf9, 0x26, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x26, 0x43, 0x55, 0x39, 0x27, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x27, 0x43,
+        0x55, 0x79, 0x27, 0x43, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x40, 0x27, 0x43, 0x55, 0xb9, 0x27, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x27, 0x43, 0x55, 0xf9, 0x27, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x27, 0x43, 0x89, 0xfc, 0x27, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x43,
+        0x89, 0x3c, 0x28, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x43, 0x55, 0x79, 0x28, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x40, 0x28, 0x43, 0x89, 0x7c, 0x28, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x28, 0x43, 0x89, 0xbc, 0x28, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x28, 0x43,
+        0x55, 0xf9, 0x28, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x28, 0x43, 0x89, 0xfc, 0x28, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x29, 0x43, 0x55, 0x79, 0x29, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x29, 0x43, 0x55, 0x79, 0x29, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x29, 0x43,
+        0x89, 0xbc, 0x29, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x80, 0x29, 0x43, 0x55, 0xf9, 0x29, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x29, 0x43, 0x89, 0xfc, 0x29, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2a, 0x43, 0x22, 0xb6, 0x2a, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x43,
+        0x55, 0x79, 0x2a, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x2a, 0x43, 0x55, 0xf9, 0x2a, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x2a, 0x43, 0x89, 0xfc, 0x2a, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x2b, 0x43, 0x55, 0x79, 0x2b, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x43,
+        0x55, 0x79, 0x2b, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x2b, 0x43, 0x89, 0xec, 0x2c, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x43, 0x55, 0xf9, 0x2b, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x2c, 0x43, 0x55, 0x79, 0x2c, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x2c, 0x43,
+        0x55, 0xf9, 0x2c, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x43, 0x55, 0x79, 0x2d, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x2d, 0x43, 0x55, 0xf9, 0x2d, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x2e, 0x43, 0x55, 0x79, 0x2e, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x2e, 0x43,
+        0x55, 0xf9, 0x2e, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x43, 0x55, 0x79, 0x2f, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x2f, 0x43, 0x89, 0xbc, 0x2f, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x2f, 0x43, 0x55, 0xf9, 0x2f, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x2f, 0x43,
+        0x89, 0xfc, 0x2f, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x43, 0x89, 0x3c, 0x30, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x43, 0x55, 0x79, 0x30, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x30, 0x43, 0x89, 0x7c, 0x30, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x30, 0x43,
+        0x89, 0xbc, 0x30, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x30, 0x43, 0x55, 0xf9, 0x30, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x30, 0x43, 0x89, 0xfc, 0x30, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x31, 0x43, 0x55, 0x79, 0x31, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x31, 0x43,
+        0x55, 0x79, 0x31, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x31, 0x43, 0x89, 0xbc, 0x31, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x31, 0x43, 0x55, 0xf9, 0x31, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x31, 0x43, 0x89, 0xfc, 0x31, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x32, 0x43,
+        0x89, 0x3c, 0x32, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x32, 0x43, 0x55, 0x79, 0x32, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x40, 0x32, 0x43, 0x89, 0x7c, 0x32, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x32, 0x43, 0x55, 0xf9, 0x32, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x32, 0x43,
+        0x55, 0xf9, 0x32, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x33, 0x43, 0x55, 0x79, 0x33, 0x43,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x33, 0x43, 0x55, 0xf9, 0x33, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x34, 0x43, 0x89, 0x3c, 0x34, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0x43,
+        0x55, 0x79, 0x34, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x40, 0x34, 0x43, 0x89, 0x7c, 0x34, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x34, 0x43, 0x89, 0xbc, 0x34, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x34, 0x43, 0x55, 0xf9, 0x34, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x34, 0x43,
+        0x89, 0xfc, 0x34, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x35, 0x43, 0x55, 0x79, 0x35, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x35, 0x43, 0x55, 0x79, 0x35, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x35, 0x43, 0x89, 0xbc, 0x35, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x35, 0x43,
+        0x55, 0xf9, 0x35, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x35, 0x43, 0x89, 0xfc, 0x35, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x36, 0x43, 0x55, 0x79, 0x36, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x36, 0x43, 0x55, 0x79, 0x36, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x36, 0x43,
+        0x89, 0xbc, 0x36, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x36, 0x43, 0x55, 0xf9, 0x36, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x36, 0x43, 0x89, 0xfc, 0x36, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x37, 0x43, 0xef, 0xf2, 0x37, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x37, 0x43,
+        0x55, 0x79, 0x37, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x37, 0x43, 0x55, 0xf9, 0x37, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x38, 0x43, 0x89, 0x3c, 0x38, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0x43, 0x55, 0x79, 0x38, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x40, 0x38, 0x43,
+        0x89, 0x7c, 0x38, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x38, 0x43, 0x89, 0xbc, 0x38, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x38, 0x43, 0x55, 0xf9, 0x38, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x38, 0x43, 0x89, 0xfc, 0x38, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x39, 0x43,
+        0x89, 0x3c, 0x39, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x39, 0x43, 0x55, 0x79, 0x39, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x40, 0x39, 0x43, 0x89, 0x7c, 0x39, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x39, 0x43, 0x89, 0xbc, 0x39, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x80, 0x39, 0x43,
+        0x55, 0xf9, 0x39, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x39, 0x43, 0x89, 0xfc, 0x39, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x43, 0x89, 0x3c, 0x3a, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x3a, 0x43, 0x55, 0x79, 0x3a, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x40, 0x3a, 0x43,
+        0x89, 0x7c, 0x3a, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x43, 0x89, 0xec, 0x3b, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x43, 0x55, 0xf9, 0x3a, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3b, 0x43, 0x55, 0x79, 0x3b, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x3b, 0x43,
+        0x55, 0xf9, 0x3b, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x43, 0x55, 0x79, 0x3c, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x3c, 0x43, 0x55, 0xf9, 0x3c, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3d, 0x43, 0x55, 0x79, 0x3d, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x3d, 0x43,
+        0x55, 0xf9, 0x3d, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x43, 0x55, 0x79, 0x3e, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x3e, 0x43, 0x55, 0xf9, 0x3e, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x3f, 0x43, 0x55, 0x79, 0x3f, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x3f, 0x43,
+        0x89, 0xbc, 0x3f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x43, 0x55, 0xf9, 0x3f, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x3f, 0x43, 0x89, 0xfc, 0x3f, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x43, 0x89, 0x3c, 0x40, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x43,
+        0x55, 0x79, 0x40, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x40, 0x40, 0x43, 0x89, 0x7c, 0x40, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x40, 0x43, 0x89, 0xbc, 0x40, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x40, 0x43, 0x55, 0xf9, 0x40, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x40, 0x43,
+        0x89, 0xfc, 0x40, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x41, 0x43, 0x55, 0x79, 0x41, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x41, 0x43, 0x55, 0x79, 0x41, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x41, 0x43, 0x89, 0xbc, 0x41, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x41, 0x43,
+        0x55, 0xf9, 0x41, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x41, 0x43, 0x89, 0xfc, 0x41, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x42, 0x43, 0x89, 0x3c, 0x42, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x42, 0x43, 0x55, 0x79, 0x42, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x00, 0x40, 0x42, 0x43,
+        0x89, 0x7c, 0x42, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x42, 0x43, 0x89, 0xbc, 0x42, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x42, 0x43, 0x55, 0xf9, 0x42, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x42, 0x43, 0x22, 0x76, 0x43, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x43, 0x43,
+        0x55, 0x79, 0x43, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x43, 0x43, 0x55, 0xf9, 0x43, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x44, 0x43, 0x89, 0x3c, 0x44, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x44, 0x43, 0x55, 0x79, 0x44, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x40, 0x44, 0x43,
+        0x89, 0x7c, 0x44, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x44, 0x43, 0x89, 0xbc, 0x44, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x44, 0x43, 0x55, 0xf9, 0x44, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x44, 0x43, 0x89, 0xfc, 0x44, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x45, 0x43,
+        0x55, 0x79, 0x45, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x45, 0x43, 0x55, 0x79, 0x45, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x45, 0x43, 0x89, 0xbc, 0x45, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x45, 0x43, 0x55, 0xf9, 0x45, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x45, 0x43,
+        0x89, 0xfc, 0x45, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x43, 0x89, 0x3c, 0x46, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x46, 0x43, 0x55, 0x79, 0x46, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x46, 0x43, 0x89, 0x7c, 0x46, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x46, 0x43,
+        0x89, 0xbc, 0x46, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x46, 0x43, 0x55, 0xf9, 0x46, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x46, 0x43, 0xbc, 0xef, 0x47, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x47, 0x43, 0x55, 0x79, 0x47, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x47, 0x43,
+        0x55, 0xf9, 0x47, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x48, 0x43, 0x89, 0x3c, 0x48, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x43, 0x55, 0x79, 0x48, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x48, 0x43, 0x89, 0x7c, 0x48, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x48, 0x43,
+        0x89, 0xbc, 0x48, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x48, 0x43, 0x55, 0xf9, 0x48, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x48, 0x43, 0x89, 0xfc, 0x48, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x49, 0x43, 0x89, 0x3c, 0x49, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x49, 0x43,
+        0x55, 0x79, 0x49, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x40, 0x49, 0x43, 0x89, 0x7c, 0x49, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x49, 0x43, 0x89, 0xbc, 0x49, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x49, 0x43, 0x55, 0xf9, 0x49, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x49, 0x43,
+        0x89, 0xfc, 0x49, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x43, 0x89, 0x3c, 0x4a, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x43, 0x55, 0x79, 0x4a, 0x43, 0x3c, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x4a, 0x43, 0x89, 0x7c, 0x4a, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x43,
+        0x89, 0xbc, 0x4a, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x43, 0x55, 0xf9, 0x4a, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x4a, 0x43, 0x89, 0xfc, 0x4a, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x4b, 0x43, 0xef, 0xf2, 0x4b, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x43,
+        0x55, 0x79, 0x4b, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x4b, 0x43, 0x55, 0xf9, 0x4b, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x43, 0x55, 0x79, 0x4c, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x4c, 0x43, 0x55, 0xf9, 0x4c, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4d, 0x43,
+        0x55, 0x79, 0x4d, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x4d, 0x43, 0x55, 0xf9, 0x4d, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x43, 0x55, 0x79, 0x4e, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x4e, 0x43, 0x55, 0xf9, 0x4e, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4f, 0x43,
+        0x55, 0x79, 0x4f, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x4f, 0x43, 0x89, 0xbc, 0x4f, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x4f, 0x43, 0x55, 0xf9, 0x4f, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x4f, 0x43, 0x89, 0xfc, 0x4f, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x43,
+        0x89, 0x3c, 0x50, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x43, 0x55, 0x79, 0x50, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x40, 0x50, 0x43, 0x89, 0x7c, 0x50, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x50, 0x43, 0x55, 0xf9, 0x50, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x50, 0x43,
+        0x55, 0xf9, 0x50, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x51, 0x43, 0xbc, 0x2f, 0x52, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x51, 0x43, 0x55, 0x79, 0x51, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x51, 0x43, 0x55, 0xf9, 0x51, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x52, 0x43,
+        0x55, 0x79, 0x52, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x40, 0x52, 0x43, 0x89, 0x7c, 0x52, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x52, 0x43, 0x89, 0xbc, 0x52, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x52, 0x43, 0x55, 0xf9, 0x52, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x52, 0x43,
+        0x89, 0x2c, 0x54, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x53, 0x43, 0x55, 0x79, 0x53, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x53, 0x43, 0x55, 0xf9, 0x53, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x54, 0x43, 0x55, 0x79, 0x54, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x40, 0x54, 0x43,
+        0x55, 0xb9, 0x54, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x54, 0x43, 0x55, 0xf9, 0x54, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x54, 0x43, 0xbc, 0xef, 0x55, 0x43, 0x42, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x55, 0x43, 0x55, 0x79, 0x55, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x55, 0x43,
+        0x55, 0xf9, 0x55, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x56, 0x43, 0x55, 0x79, 0x56, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x56, 0x43, 0x55, 0xf9, 0x56, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x57, 0x43, 0x55, 0x79, 0x57, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x57, 0x43,
+        0x89, 0xbc, 0x57, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x57, 0x43, 0x55, 0xf9, 0x57, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x57, 0x43, 0x89, 0xfc, 0x57, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x58, 0x43, 0x89, 0x3c, 0x58, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x43,
+        0x55, 0x79, 0x58, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x40, 0x58, 0x43, 0x89, 0x7c, 0x58, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x58, 0x43, 0x55, 0xf9, 0x58, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x58, 0x43, 0x55, 0xf9, 0x58, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x59, 0x43,
+        0xbc, 0x2f, 0x5a, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x59, 0x43, 0x55, 0x79, 0x59, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x59, 0x43, 0x55, 0xf9, 0x59, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x5a, 0x43, 0x55, 0x79, 0x5a, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x40, 0x5a, 0x43,
+        0x89, 0x7c, 0x5a, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x5a, 0x43, 0x89, 0xbc, 0x5a, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x5a, 0x43, 0x55, 0xf9, 0x5a, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x5a, 0x43, 0x89, 0x2c, 0x5c, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x43,
+        0x55, 0x79, 0x5b, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x5b, 0x43, 0x55, 0xf9, 0x5b, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5c, 0x43, 0x55, 0x79, 0x5c, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x5c, 0x43, 0x55, 0xb9, 0x5c, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x5c, 0x43,
+        0x55, 0xf9, 0x5c, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x5c, 0x43, 0x55, 0x39, 0x5d, 0x43,
+        0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x43, 0x55, 0x79, 0x5d, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x5d, 0x43, 0x55, 0xb9, 0x5d, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x80, 0x5d, 0x43,
+        0x55, 0xf9, 0x5d, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x5d, 0x43, 0xbc, 0xef, 0x5e, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x43, 0x55, 0x79, 0x5e, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x5e, 0x43, 0x55, 0xf9, 0x5e, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x5f, 0x43,
+        0x55, 0x79, 0x5f, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x5f, 0x43, 0x89, 0xbc, 0x5f, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x5f, 0x43, 0x55, 0xf9, 0x5f, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x5f, 0x43, 0x89, 0xfc, 0x5f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x43,
+        0x89, 0x3c, 0x60, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x60, 0x43, 0x55, 0x79, 0x60, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x40, 0x60, 0x43, 0x89, 0x7c, 0x60, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x60, 0x43, 0x55, 0xf9, 0x60, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x00, 0x80, 0x60, 0x43,
+        0x55, 0xf9, 0x60, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x61, 0x43, 0x89, 0x3c, 0x61, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x61, 0x43, 0x55, 0x79, 0x61, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x61, 0x43, 0x89, 0x7c, 0x61, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x61, 0x43,
+        0x55, 0xf9, 0x61, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x62, 0x43, 0x55, 0x79, 0x62, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x62, 0x43, 0x55, 0xf9, 0x62, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x63, 0x43, 0x22, 0xe6, 0x64, 0x43, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x63, 0x43,
+        0x22, 0xe6, 0x64, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x63, 0x43, 0x22, 0xe6, 0x64, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x63, 0x43, 0x55, 0x79, 0x63, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x63, 0x43, 0x55, 0xf9, 0x63, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x64, 0x43,
+        0x55, 0x79, 0x64, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x64, 0x43, 0x55, 0xf9, 0x64, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x65, 0x43, 0x22, 0xe6, 0x66, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x65, 0x43, 0x22, 0xe6, 0x66, 0x43, 0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x65, 0x43,
+        0x22, 0xe6, 0x66, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x65, 0x43, 0x55, 0x79, 0x65, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x65, 0x43, 0x55, 0xf9, 0x65, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x66, 0x43, 0x55, 0x79, 0x66, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x66, 0x43,
+        0x55, 0xf9, 0x66, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x00, 0x67, 0x43, 0x22, 0xe6, 0x68, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x67, 0x43, 0x22, 0xe6, 0x68, 0x43, 0x42, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x67, 0x43, 0x22, 0xe6, 0x68, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x67, 0x43,
+        0x55, 0x79, 0x67, 0x43, 0x2f, 0x50, 0x01, 0x00, 0x00, 0x80, 0x67, 0x43, 0x55, 0xf9, 0x67, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x68, 0x43, 0x55, 0x79, 0x68, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x68, 0x43, 0x55, 0xf9, 0x68, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x69, 0x43,
+        0x22, 0xe6, 0x6a, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x69, 0x43, 0x22, 0xe6, 0x6a, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x69, 0x43, 0x22, 0xe6, 0x6a, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x69, 0x43, 0x55, 0x79, 0x69, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x69, 0x43,
+        0x55, 0xf9, 0x69, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x43, 0x55, 0x79, 0x6a, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x6a, 0x43, 0x55, 0xf9, 0x6a, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x6b, 0x43, 0x22, 0xe6, 0x6c, 0x43, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x43,
+        0x22, 0xe6, 0x6c, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x43, 0x22, 0xe6, 0x6c, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x43, 0x55, 0x79, 0x6b, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x6b, 0x43, 0x55, 0xf9, 0x6b, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x43,
+        0x55, 0x79, 0x6c, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x6c, 0x43, 0x55, 0xf9, 0x6c, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x43, 0x22, 0xe6, 0x6e, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x6d, 0x43, 0x22, 0xe6, 0x6e, 0x43, 0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x43,
+        0x22, 0xe6, 0x6e, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x43, 0x55, 0x79, 0x6d, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x6d, 0x43, 0x55, 0xf9, 0x6d, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x6e, 0x43, 0x55, 0x79, 0x6e, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x6e, 0x43,
+        0x55, 0xf9, 0x6e, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x6f, 0x43, 0x55, 0x79, 0x6f, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x6f, 0x43, 0x89, 0xbc, 0x6f, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x6f, 0x43, 0x55, 0xf9, 0x6f, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x6f, 0x43,
+        0x89, 0xfc, 0x6f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x43, 0x89, 0x3c, 0x70, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x43, 0x55, 0x79, 0x70, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x40, 0x70, 0x43, 0x89, 0x7c, 0x70, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x70, 0x43,
+        0x89, 0xbc, 0x70, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x70, 0x43, 0x55, 0xf9, 0x70, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x70, 0x43, 0x89, 0xfc, 0x70, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x71, 0x43, 0x55, 0x79, 0x71, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x71, 0x43,
+        0x55, 0x79, 0x71, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x71, 0x43, 0x89, 0xbc, 0x71, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x71, 0x43, 0x55, 0xf9, 0x71, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x71, 0x43, 0x89, 0xfc, 0x71, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x72, 0x43,
+        0x89, 0x3c, 0x72, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x72, 0x43, 0x55, 0x79, 0x72, 0x43,
+        0x3c, 0x50, 0x01, 0x00, 0x00, 0x40, 0x72, 0x43, 0x89, 0x7c, 0x72, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x72, 0x43, 0x89, 0xec, 0x73, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x72, 0x43,
+        0x55, 0xf9, 0x72, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x73, 0x43, 0x55, 0x79, 0x73, 0x43,
+        0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x73, 0x43, 0x55, 0xf9, 0x73, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x00, 0x74, 0x43, 0x89, 0x3c, 0x74, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x74, 0x43,
+        0x55, 0x79, 0x74, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x40, 0x74, 0x43, 0x89, 0x7c, 0x74, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x74, 0x43, 0x89, 0xbc, 0x74, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x74, 0x43, 0x55, 0xf9, 0x74, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x74, 0x43,
+        0x89, 0xfc, 0x74, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x75, 0x43, 0x55, 0x79, 0x75, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x75, 0x43, 0x55, 0x79, 0x75, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x75, 0x43, 0x89, 0xbc, 0x75, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x75, 0x43,
+        0x55, 0xf9, 0x75, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x75, 0x43, 0x89, 0xfc, 0x75, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x76, 0x43, 0x55, 0x79, 0x76, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x76, 0x43, 0x55, 0x79, 0x76, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x80, 0x76, 0x43,
+        0x89, 0xbc, 0x76, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x76, 0x43, 0x55, 0xf9, 0x76, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x76, 0x43, 0x89, 0xfc, 0x76, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x77, 0x43, 0xef, 0xf2, 0x77, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x77, 0x43,
+        0x55, 0x79, 0x77, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x77, 0x43, 0x55, 0xf9, 0x77, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x78, 0x43, 0x89, 0x3c, 0x78, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0x43, 0x55, 0x79, 0x78, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x40, 0x78, 0x43,
+        0x89, 0x7c, 0x78, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x78, 0x43, 0x89, 0xbc, 0x78, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x78, 0x43, 0x55, 0xf9, 0x78, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x78, 0x43, 0x89, 0xfc, 0x78, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x79, 0x43,
+        0x89, 0x3c, 0x79, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x79, 0x43, 0x55, 0x79, 0x79, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x40, 0x79, 0x43, 0x89, 0x7c, 0x79, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x79, 0x43, 0x89, 0xbc, 0x79, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x80, 0x79, 0x43,
+        0x55, 0xf9, 0x79, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x79, 0x43, 0x89, 0xfc, 0x79, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x43, 0x89, 0x3c, 0x7a, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x7a, 0x43, 0x55, 0x79, 0x7a, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x00, 0x40, 0x7a, 0x43,
+        0x89, 0x7c, 0x7a, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x7a, 0x43, 0x89, 0xbc, 0x7a, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x7a, 0x43, 0x55, 0xf9, 0x7a, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x7a, 0x43, 0xbc, 0xef, 0x7b, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x43,
+        0x55, 0x79, 0x7b, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x7b, 0x43, 0x55, 0xf9, 0x7b, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x43, 0x55, 0x79, 0x7c, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x7c, 0x43, 0x55, 0xf9, 0x7c, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x43,
+        0x55, 0x79, 0x7d, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x7d, 0x43, 0x55, 0xf9, 0x7d, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x43, 0x55, 0x79, 0x7e, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x7e, 0x43, 0x55, 0xf9, 0x7e, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x43,
+        0x55, 0x79, 0x7f, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x7f, 0x43, 0x89, 0xbc, 0x7f, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x7f, 0x43, 0x55, 0xf9, 0x7f, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x7f, 0x43, 0x89, 0xfc, 0x7f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x43,
+        0x77, 0x2d, 0x80, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x43, 0xab, 0x3c, 0x80, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x30, 0x80, 0x43, 0x77, 0x5d, 0x80, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x80, 0x43, 0xab, 0x7c, 0x80, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x60, 0x80, 0x43,
+        0x44, 0x7e, 0x80, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x80, 0x43, 0xab, 0xbc, 0x80, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x00, 0x80, 0x80, 0x43, 0xab, 0xbc, 0x80, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x80, 0x43, 0x44, 0xde, 0x80, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x80, 0x43,
+        0xab, 0xfc, 0x80, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xe0, 0x80, 0x43, 0x44, 0xfe, 0x80, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x81, 0x43, 0x44, 0x1e, 0x81, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x81, 0x43, 0xab, 0x3c, 0x81, 0x43, 0x3c, 0x50, 0x01, 0x00, 0x00, 0x20, 0x81, 0x43,
+        0x44, 0x3e, 0x81, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x40, 0x81, 0x43, 0x44, 0xf6, 0x81, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x40, 0x81, 0x43, 0xab, 0x7c, 0x81, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x81, 0x43, 0xab, 0xbc, 0x81, 0x43, 0x2b, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x81, 0x43,
+        0xab, 0xfc, 0x81, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x82, 0x43, 0x44, 0x1e, 0x82, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x43, 0xab, 0x3c, 0x82, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0x20, 0x82, 0x43, 0x44, 0x3e, 0x82, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x40, 0x82, 0x43,
+        0x44, 0x5e, 0x82, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x40, 0x82, 0x43, 0xab, 0x7c, 0x82, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x60, 0x82, 0x43, 0x44, 0x7e, 0x82, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x82, 0x43, 0xab, 0xbc, 0x82, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x82, 0x43,
+        0xab, 0xbc, 0x82, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x82, 0x43, 0x44, 0xde, 0x82, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x82, 0x43, 0xab, 0xfc, 0x82, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0xe0, 0x82, 0x43, 0x44, 0xfe, 0x82, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x43,
+        0x44, 0x1e, 0x83, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x43, 0xab, 0x3c, 0x83, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x00, 0x20, 0x83, 0x43, 0x44, 0x3e, 0x83, 0x43, 0x48, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x83, 0x43, 0x44, 0x5e, 0x83, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x40, 0x83, 0x43,
+        0xab, 0x7c, 0x83, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x60, 0x83, 0x43, 0xde, 0xf7, 0x83, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x83, 0x43, 0xab, 0xbc, 0x83, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x83, 0x43, 0xab, 0xfc, 0x83, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x00, 0x84, 0x43,
+        0x44, 0x1e, 0x84, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0x43, 0xab, 0x3c, 0x84, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x00, 0x20, 0x84, 0x43, 0x44, 0x3e, 0x84, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x84, 0x43, 0x44, 0x5e, 0x84, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x40, 0x84, 0x43,
+        0xab, 0x7c, 0x84, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x60, 0x84, 0x43, 0x44, 0x7e, 0x84, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x00, 0x80, 0x84, 0x43, 0x44, 0x9e, 0x84, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x84, 0x43, 0xab, 0xbc, 0x84, 0x43, 0x30, 0x50, 0x01, 0x00, 0x00, 0xa0, 0x84, 0x43,
+        0x44, 0xbe, 0x84, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x84, 0x43, 0x44, 0xde, 0x84, 0x43,
+        0x48, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x84, 0x43, 0xab, 0xfc, 0x84, 0x43, 0x37, 0x50, 0x01, 0x00,
+        0x00, 0xe0, 0x84, 0x43, 0x44, 0xfe, 0x84, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x85, 0x43,
+        0x44, 0x1e, 0x85, 0x43, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x85, 0x43, 0xab, 0x3c, 0x85, 0x43,
+        0x3c, 0x50, 0x01, 0x00, 0x00, 0x20, 0x85, 0x43, 0x44, 0x3e, 0x85, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x85, 0x43, 0x44, 0x5e, 0x85, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x40, 0x85, 0x43,
+        0xab, 0x7c, 0x85, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x60, 0x85, 0x43, 0xde, 0xf7, 0x85, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x80, 0x85, 0x43, 0xab, 0xbc, 0x85, 0x43, 0x2b, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x85, 0x43, 0xab, 0xfc, 0x85, 0x43, 0x32, 0x50, 0x01, 0x00, 0x00, 0x00, 0x86, 0x43,
+        0xab, 0x3c, 0x86, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x40, 0x86, 0x43, 0xab, 0x7c, 0x86, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0x86, 0x43, 0xab, 0xbc, 0x86, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x86, 0x43, 0xab, 0xfc, 0x86, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x00, 0x87, 0x43,
+        0xab, 0x3c, 0x87, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x40, 0x87, 0x43, 0xab, 0x7c, 0x87, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0x87, 0x43, 0xab, 0xbc, 0x87, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0xc0, 0x87, 0x43, 0x44, 0xde, 0x87, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x87, 0x43,
+        0xab, 0xfc, 0x87, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0xe0, 0x87, 0x43, 0x44, 0xfe, 0x87, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x88, 0x43, 0x44, 0x1e, 0x88, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x88, 0x43, 0xab, 0x3c, 0x88, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0x20, 0x88, 0x43,
+        0x44, 0x3e, 0x88, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x40, 0x88, 0x43, 0x44, 0x5e, 0x88, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x40, 0x88, 0x43, 0xab, 0x7c, 0x88, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x60, 0x88, 0x43, 0x44, 0x7e, 0x88, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x88, 0x43,
+        0xab, 0xbc, 0x88, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x88, 0x43, 0x11, 0x73, 0x89, 0x43,
+        0x30, 0x50, 0x01, 0x00, 0x00, 0x80, 0x88, 0x43, 0x11, 0x73, 0x89, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x88, 0x43, 0x11, 0x73, 0x89, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x88, 0x43,
+        0x44, 0xde, 0x88, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x88, 0x43, 0x44, 0xfe, 0x88, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x89, 0x43, 0x44, 0x1e, 0x89, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x20, 0x89, 0x43, 0x44, 0x3e, 0x89, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x40, 0x89, 0x43,
+        0xab, 0x7c, 0x89, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x89, 0x43, 0x11, 0x73, 0x8a, 0x43,
+        0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x89, 0x43, 0x11, 0x73, 0x8a, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x89, 0x43, 0x11, 0x73, 0x8a, 0x43, 0x3e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x43,
+        0x44, 0x1e, 0x8a, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x20, 0x8a, 0x43, 0x44, 0x3e, 0x8a, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x40, 0x8a, 0x43, 0x44, 0x5e, 0x8a, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x60, 0x8a, 0x43, 0x44, 0x7e, 0x8a, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x43,
+        0xab, 0xbc, 0x8a, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x43, 0x11, 0x73, 0x8b, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8a, 0x43, 0x11, 0x73, 0x8b, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x8a, 0x43, 0x11, 0x73, 0x8b, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x8a, 0x43,
+        0x44, 0xde, 0x8a, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x8a, 0x43, 0x44, 0xfe, 0x8a, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x43, 0xab, 0x3c, 0x8b, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x8b, 0x43, 0x44, 0x5e, 0x8b, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x60, 0x8b, 0x43,
+        0x44, 0x7e, 0x8b, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x8b, 0x43, 0x77, 0xf9, 0x8b, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x8b, 0x43, 0x11, 0x73, 0x8c, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x8b, 0x43, 0x11, 0x73, 0x8c, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8b, 0x43,
+        0x11, 0x73, 0x8c, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x00, 0x8c, 0x43, 0x44, 0x1e, 0x8c, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x20, 0x8c, 0x43, 0x44, 0x3e, 0x8c, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x8c, 0x43, 0x44, 0x5e, 0x8c, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x60, 0x8c, 0x43,
+        0x44, 0x7e, 0x8c, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x8c, 0x43, 0x44, 0x9e, 0x8c, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x80, 0x8c, 0x43, 0x11, 0x73, 0x8d, 0x43, 0x30, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x8c, 0x43, 0x11, 0x73, 0x8d, 0x43, 0x34, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8c, 0x43,
+        0x11, 0x73, 0x8d, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0xa0, 0x8c, 0x43, 0x44, 0xbe, 0x8c, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x8c, 0x43, 0x44, 0xde, 0x8c, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0xe0, 0x8c, 0x43, 0x44, 0xfe, 0x8c, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x43,
+        0x44, 0x1e, 0x8d, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x20, 0x8d, 0x43, 0x44, 0x3e, 0x8d, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x40, 0x8d, 0x43, 0x44, 0xf6, 0x8d, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x8d, 0x43, 0x11, 0x73, 0x8e, 0x43, 0x37, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8d, 0x43,
+        0x11, 0x73, 0x8e, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8d, 0x43, 0x11, 0x73, 0x8e, 0x43,
+        0x3e, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8e, 0x43, 0x44, 0x66, 0x90, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x00, 0x80, 0x8e, 0x43, 0x44, 0x66, 0x90, 0x43, 0x36, 0x50, 0x01, 0x00, 0x00, 0x80, 0x8e, 0x43,
+        0x44, 0x66, 0x90, 0x43, 0x39, 0x50, 0x01, 0x00, 0x00, 0xc0, 0x8f, 0x43, 0x44, 0xde, 0x8f, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x8f, 0x43, 0x44, 0xfe, 0x8f, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x90, 0x43, 0x44, 0x1e, 0x90, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x20, 0x90, 0x43,
+        0x44, 0x3e, 0x90, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x40, 0x90, 0x43, 0x44, 0x5e, 0x90, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x60, 0x90, 0x43, 0x44, 0x7e, 0x90, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x90, 0x43, 0xab, 0xbc, 0x90, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x43,
+        0x44, 0xde, 0x90, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x90, 0x43, 0x44, 0xfe, 0x90, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x91, 0x43, 0x44, 0x1e, 0x91, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0x20, 0x91, 0x43, 0x44, 0x3e, 0x91, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x40, 0x91, 0x43,
+        0xab, 0x7c, 0x91, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x92, 0x43, 0x44, 0x1e, 0x92, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x20, 0x92, 0x43, 0x44, 0x3e, 0x92, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x92, 0x43, 0x44, 0x5e, 0x92, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x60, 0x92, 0x43,
+        0x44, 0x7e, 0x92, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x92, 0x43, 0xab, 0xbc, 0x92, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x92, 0x43, 0x44, 0xde, 0x92, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0xe0, 0x92, 0x43, 0x44, 0xfe, 0x92, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x93, 0x43,
+        0xab, 0x3c, 0x93, 0x43, 0x47, 0x50, 0x00, 0x00, 0x00, 0x40, 0x93, 0x43, 0x44, 0x5e, 0x93, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x00, 0x60, 0x93, 0x43, 0x44, 0x7e, 0x93, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x80, 0x93, 0x43, 0x77, 0xf9, 0x93, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0x94, 0x43,
+        0x44, 0x1e, 0x94, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x20, 0x94, 0x43, 0x44, 0x3e, 0x94, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x40, 0x94, 0x43, 0x44, 0x5e, 0x94, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x60, 0x94, 0x43, 0x44, 0x7e, 0x94, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x94, 0x43,
+        0x44, 0x9e, 0x94, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0xa0, 0x94, 0x43, 0x44, 0xbe, 0x94, 0x43,
+        0x43, 0x50, 0x00, 0x00, 0x00, 0xc0, 0x94, 0x43, 0x44, 0xde, 0x94, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x00, 0xe0, 0x94, 0x43, 0x44, 0xfe, 0x94, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x95, 0x43,
+        0x44, 0x1e, 0x95, 0x43, 0x40, 0x50, 0x00, 0x00, 0x00, 0x20, 0x95, 0x43, 0x44, 0x3e, 0x95, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x40, 0x95, 0x43, 0x44, 0xf6, 0x95, 0x43, 0x43, 0x50, 0x00, 0x00,
+        0x00, 0xc0, 0x97, 0x43, 0x44, 0xde, 0x97, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x97, 0x43,
+        0x44, 0xfe, 0x97, 0x43, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x98, 0x43, 0x44, 0x1e, 0x98, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x00, 0x20, 0x98, 0x43, 0x44, 0x3e, 0x98, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x00, 0x40, 0x98, 0x43, 0x44, 0x5e, 0x98, 0x43, 0x45, 0x50, 0x00, 0x00, 0x00, 0x60, 0x98, 0x43,
+        0x44, 0x7e, 0x98, 0x43, 0x43, 0x50, 0x00, 0x00, 0x00, 0x80, 0x98, 0x43, 0x77, 0xf9, 0x98, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xc0, 0x63, 0x3f, 0x2f, 0x50, 0x01, 0x00,
+        0x22, 0x00, 0xf0, 0x3e, 0x19, 0xc0, 0x30, 0x3f, 0x3b, 0x50, 0x00, 0x00, 0x19, 0x00, 0x34, 0x3f,
+        0x15, 0xe0, 0x92, 0x3f, 0x3e, 0x50, 0x00, 0x00, 0x22, 0x00, 0x70, 0x3f, 0x21, 0xe0, 0xe9, 0x3f,
+        0x36, 0x50, 0x01, 0x00, 0x15, 0x00, 0x96, 0x3f, 0x1d, 0xe0, 0xce, 0x3f, 0x3d, 0x50, 0x00, 0x00,
+        0x1d, 0x00, 0xd2, 0x3f, 0x15, 0xb0, 0x13, 0x40, 0x3e, 0x50, 0x00, 0x00, 0x22, 0x00, 0xf0, 0x3f,
+        0x15, 0x70, 0x14, 0x40, 0x2c, 0x50, 0x01, 0x00, 0x15, 0x00, 0x16, 0x40, 0x19, 0x70, 0x32, 0x40,
+        0x34, 0x50, 0x01, 0x00, 0x19, 0x00, 0x34, 0x40, 0x21, 0xf0, 0x6c, 0x40, 0x44, 0x50, 0x00, 0x00,
+        0x19, 0x00, 0x34, 0x40, 0x21, 0xf0, 0x6c, 0x40, 0x38, 0x50, 0x01, 0x00, 0x22, 0x00, 0x70, 0x40,
+        0x15, 0x78, 0x94, 0x40, 0x2d, 0x50, 0x01, 0x00, 0x13, 0x00, 0x87, 0x40, 0x14, 0x18, 0x8e, 0x40,
+        0x39, 0x50, 0x00, 0x00, 0x14, 0x80, 0x8e, 0x40, 0x16, 0xb8, 0x9c, 0x40, 0x3d, 0x50, 0x00, 0x00,
+        0x15, 0x00, 0x96, 0x40, 0x19, 0x78, 0xb2, 0x40, 0x34, 0x50, 0x01, 0x00, 0x16, 0x80, 0x9d, 0x40,
+        0x18, 0xb8, 0xab, 0x40, 0x39, 0x50, 0x00, 0x00, 0x19, 0x00, 0xb4, 0x40, 0x1d, 0x78, 0xd0, 0x40,
+        0x39, 0x50, 0x00, 0x00, 0x19, 0x00, 0xb4, 0x40, 0x1d, 0x78, 0xd0, 0x40, 0x3e, 0x50, 0x00, 0x00,
+        0x19, 0x00, 0xb4, 0x40, 0x1d, 0x78, 0xd0, 0x40, 0x32, 0x50, 0x01, 0x00, 0x1d, 0x00, 0xd2, 0x40,
+        0x21, 0x78, 0xee, 0x40, 0x39, 0x50, 0x00, 0x00, 0x1d, 0x00, 0xd2, 0x40, 0x21, 0x78, 0xee, 0x40,
+        0x3d, 0x50, 0x00, 0x00, 0x1d, 0x00, 0xd2, 0x40, 0x21, 0x78, 0xee, 0x40, 0x31, 0x50, 0x01, 0x00,
+        0x22, 0x00, 0xf0, 0x40, 0x13, 0x3c, 0x06, 0x41, 0x2f, 0x50, 0x01, 0x00, 0x24, 0x00, 0xff, 0x40,
+        0x12, 0x0c, 0x03, 0x41, 0x3b, 0x50, 0x00, 0x00, 0x12, 0x40, 0x03, 0x41, 0x13, 0x5c, 0x0a, 0x41,
+        0x3e, 0x50, 0x00, 0x00, 0x13, 0x00, 0x07, 0x41, 0x15, 0x3c, 0x15, 0x41, 0x36, 0x50, 0x01, 0x00,
+        0x13, 0xc0, 0x0a, 0x41, 0x14, 0xdc, 0x11, 0x41, 0x3d, 0x50, 0x00, 0x00, 0x14, 0x40, 0x12, 0x41,
+        0x16, 0xec, 0x1c, 0x41, 0x3e, 0x50, 0x00, 0x00, 0x15, 0x00, 0x16, 0x41, 0x16, 0x1c, 0x1d, 0x41,
+        0x2c, 0x50, 0x01, 0x00, 0x16, 0x80, 0x1d, 0x41, 0x17, 0x9c, 0x24, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x17, 0x00, 0x25, 0x41, 0x18, 0x1c, 0x2c, 0x41, 0x44, 0x50, 0x00, 0x00, 0x17, 0x00, 0x25, 0x41,
+        0x19, 0x3c, 0x33, 0x41, 0x38, 0x50, 0x01, 0x00, 0x18, 0x80, 0x2c, 0x41, 0x1a, 0xbc, 0x3a, 0x41,
+        0x40, 0x50, 0x00, 0x00, 0x19, 0x00, 0x34, 0x41, 0x1b, 0x3c, 0x42, 0x41, 0x2d, 0x50, 0x01, 0x00,
+        0x1a, 0x80, 0x3b, 0x41, 0x1b, 0x0c, 0x3f, 0x41, 0x39, 0x50, 0x00, 0x00, 0x1b, 0x40, 0x3f, 0x41,
+        0x1c, 0x5c, 0x46, 0x41, 0x3d, 0x50, 0x00, 0x00, 0x1b, 0x00, 0x43, 0x41, 0x1d, 0x3c, 0x51, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x1c, 0xc0, 0x46, 0x41, 0x1d, 0xdc, 0x4d, 0x41, 0x39, 0x50, 0x00, 0x00,
+        0x1d, 0x00, 0x52, 0x41, 0x1f, 0x3c, 0x60, 0x41, 0x39, 0x50, 0x00, 0x00, 0x1d, 0x00, 0x52, 0x41,
+        0x1f, 0x3c, 0x60, 0x41, 0x42, 0x50, 0x00, 0x00, 0x1d, 0x00, 0x52, 0x41, 0x1f, 0x3c, 0x60, 0x41,
+        0x32, 0x50, 0x01, 0x00, 0x1f, 0x00, 0x61, 0x41, 0x21, 0x3c, 0x6f, 0x41, 0x3d, 0x50, 0x00, 0x00,
+        0x1f, 0x00, 0x61, 0x41, 0x21, 0x3c, 0x6f, 0x41, 0x44, 0x50, 0x00, 0x00, 0x1f, 0x00, 0x61, 0x41,
+        0x21, 0x3c, 0x6f, 0x41, 0x31, 0x50, 0x01, 0x00, 0x22, 0x00, 0x70, 0x41, 0x23, 0xac, 0x7a, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x22, 0x00, 0x70, 0x41, 0x23, 0x1c, 0x77, 0x41, 0x2f, 0x50, 0x01, 0x00,
+        0x23, 0x80, 0x77, 0x41, 0x24, 0x9c, 0x7e, 0x41, 0x36, 0x50, 0x01, 0x00, 0x23, 0x40, 0x7b, 0x41,
+        0x12, 0x2e, 0x81, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x24, 0x00, 0x7f, 0x41, 0x13, 0x9e, 0x86, 0x41,
+        0x3b, 0x50, 0x01, 0x00, 0x12, 0x60, 0x81, 0x41, 0x12, 0x26, 0x83, 0x41, 0x49, 0x50, 0x00, 0x00,
+        0x12, 0x40, 0x83, 0x41, 0x15, 0x0e, 0x95, 0x41, 0x47, 0x50, 0x00, 0x00, 0x13, 0x00, 0x87, 0x41,
+        0x13, 0x8e, 0x8a, 0x41, 0x2c, 0x50, 0x01, 0x00, 0x13, 0xc0, 0x8a, 0x41, 0x14, 0x4e, 0x8e, 0x41,
+        0x34, 0x50, 0x01, 0x00, 0x14, 0x80, 0x8e, 0x41, 0x15, 0x9e, 0x95, 0x41, 0x3b, 0x50, 0x01, 0x00,
+        0x15, 0x00, 0x96, 0x41, 0x15, 0xc6, 0x97, 0x41, 0x49, 0x50, 0x00, 0x00, 0x15, 0x00, 0x96, 0x41,
+        0x15, 0x8e, 0x99, 0x41, 0x2a, 0x50, 0x01, 0x00, 0x15, 0xe0, 0x97, 0x41, 0x16, 0x6e, 0x9b, 0x41,
+        0x49, 0x50, 0x00, 0x00, 0x15, 0xc0, 0x99, 0x41, 0x16, 0x4e, 0x9d, 0x41, 0x31, 0x50, 0x01, 0x00,
+        0x16, 0xa0, 0x9b, 0x41, 0x17, 0xf6, 0xa0, 0x41, 0x49, 0x50, 0x00, 0x00, 0x16, 0x80, 0x9d, 0x41,
+        0x17, 0x9e, 0xa4, 0x41, 0x39, 0x50, 0x01, 0x00, 0x17, 0x40, 0xa1, 0x41, 0x17, 0xce, 0xa4, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x17, 0x00, 0xa5, 0x41, 0x18, 0x1e, 0xac, 0x41, 0x2a, 0x50, 0x01, 0x00,
+        0x17, 0x00, 0xa5, 0x41, 0x18, 0x1e, 0xac, 0x41, 0x31, 0x50, 0x01, 0x00, 0x17, 0xe0, 0xa6, 0x41,
+        0x18, 0x6e, 0xaa, 0x41, 0x45, 0x50, 0x00, 0x00, 0x17, 0xe0, 0xa6, 0x41, 0x18, 0x6e, 0xaa, 0x41,
+        0x4e, 0x50, 0x00, 0x00, 0x18, 0xa0, 0xaa, 0x41, 0x18, 0x66, 0xac, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x18, 0xa0, 0xaa, 0x41, 0x18, 0x66, 0xac, 0x41, 0x4e, 0x50, 0x00, 0x00, 0x18, 0x80, 0xac, 0x41,
+        0x19, 0x0e, 0xb0, 0x41, 0x45, 0x50, 0x00, 0x00, 0x18, 0x80, 0xac, 0x41, 0x19, 0x0e, 0xb0, 0x41,
+        0x4e, 0x50, 0x00, 0x00, 0x18, 0x80, 0xac, 0x41, 0x19, 0x9e, 0xb3, 0x41, 0x2c, 0x50, 0x01, 0x00,
+        0x18, 0x80, 0xac, 0x41, 0x19, 0x9e, 0xb3, 0x41, 0x34, 0x50, 0x01, 0x00, 0x18, 0x80, 0xac, 0x41,
+        0x19, 0x9e, 0xb3, 0x41, 0x38, 0x50, 0x01, 0x00, 0x19, 0x40, 0xb0, 0x41, 0x19, 0xce, 0xb3, 0x41,
+        0x4c, 0x50, 0x00, 0x00, 0x19, 0x00, 0xb4, 0x41, 0x1a, 0x56, 0xb9, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0x19, 0x00, 0xb4, 0x41, 0x1a, 0x8e, 0xb7, 0x41, 0x2f, 0x50, 0x01, 0x00, 0x1a, 0xc0, 0xb7, 0x41,
+        0x1a, 0x4e, 0xbb, 0x41, 0x36, 0x50, 0x01, 0x00, 0x1a, 0xa0, 0xb9, 0x41, 0x1a, 0x66, 0xbb, 0x41,
+        0x4a, 0x50, 0x00, 0x00, 0x1a, 0x80, 0xbb, 0x41, 0x1a, 0x46, 0xbd, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0x1a, 0x80, 0xbb, 0x41, 0x1b, 0x9e, 0xc2, 0x41, 0x3e, 0x50, 0x01, 0x00, 0x1a, 0x60, 0xbd, 0x41,
+        0x1b, 0x26, 0xbf, 0x41, 0x49, 0x50, 0x00, 0x00, 0x1b, 0x40, 0xbf, 0x41, 0x1d, 0x7e, 0xcd, 0x41,
+        0x47, 0x50, 0x00, 0x00, 0x1b, 0x00, 0xc3, 0x41, 0x1c, 0x8e, 0xc6, 0x41, 0x2c, 0x50, 0x01, 0x00,
+        0x1c, 0xc0, 0xc6, 0x41, 0x1c, 0x4e, 0xca, 0x41, 0x34, 0x50, 0x01, 0x00, 0x1c, 0x80, 0xca, 0x41,
+        0x1d, 0x9e, 0xd1, 0x41, 0x3b, 0x50, 0x01, 0x00, 0x1d, 0x20, 0xd0, 0x41, 0x1d, 0xe6, 0xd1, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x1d, 0x00, 0xd2, 0x41, 0x1e, 0xc6, 0xd3, 0x41, 0x49, 0x50, 0x00, 0x00,
+        0x1d, 0x00, 0xd2, 0x41, 0x1e, 0x8e, 0xd5, 0x41, 0x2a, 0x50, 0x01, 0x00, 0x1e, 0xe0, 0xd3, 0x41,
+        0x1e, 0xa6, 0xd5, 0x41, 0x49, 0x50, 0x00, 0x00, 0x1e, 0xc0, 0xd5, 0x41, 0x1e, 0x86, 0xd7, 0x41,
+        0x49, 0x50, 0x00, 0x00, 0x1e, 0xc0, 0xd5, 0x41, 0x1e, 0x4e, 0xd9, 0x41, 0x31, 0x50, 0x01, 0x00,
+        0x1e, 0xa0, 0xd7, 0x41, 0x1f, 0x2e, 0xdb, 0x41, 0x47, 0x50, 0x00, 0x00, 0x1e, 0x80, 0xd9, 0x41,
+        0x1f, 0x9e, 0xe0, 0x41, 0x36, 0x50, 0x01, 0x00, 0x1f, 0x60, 0xdb, 0x41, 0x1f, 0xee, 0xde, 0x41,
+        0x45, 0x50, 0x00, 0x00, 0x1f, 0x20, 0xdf, 0x41, 0x20, 0xae, 0xe2, 0x41, 0x45, 0x50, 0x00, 0x00,
+        0x1f, 0x00, 0xe1, 0x41, 0x20, 0x1e, 0xe8, 0x41, 0x2a, 0x50, 0x01, 0x00, 0x1f, 0x00, 0xe1, 0x41,
+        0x20, 0x1e, 0xe8, 0x41, 0x31, 0x50, 0x01, 0x00, 0x1f, 0x00, 0xe1, 0x41, 0x20, 0x1e, 0xe8, 0x41,
+        0x36, 0x50, 0x01, 0x00, 0x20, 0xe0, 0xe2, 0x41, 0x20, 0x6e, 0xe6, 0x41, 0x47, 0x50, 0x00, 0x00,
+        0x20, 0xa0, 0xe6, 0x41, 0x20, 0x66, 0xe8, 0x41, 0x49, 0x50, 0x00, 0x00, 0x21, 0x80, 0xe8, 0x41,
+        0x21, 0x0e, 0xec, 0x41, 0x47, 0x50, 0x00, 0x00, 0x21, 0x80, 0xe8, 0x41, 0x22, 0x9e, 0xef, 0x41,
+        0x2c, 0x50, 0x01, 0x00, 0x21, 0x80, 0xe8, 0x41, 0x22, 0x9e, 0xef, 0x41, 0x34, 0x50, 0x01, 0x00,
+        0x21, 0x80, 0xe8, 0x41, 0x22, 0x9e, 0xef, 0x41, 0x38, 0x50, 0x01, 0x00, 0x21, 0x40, 0xec, 0x41,
+        0x22, 0xce, 0xef, 0x41, 0x45, 0x50, 0x00, 0x00, 0x22, 0x00, 0xf0, 0x41, 0x22, 0x8e, 0xf3, 0x41,
+        0x2f, 0x50, 0x01, 0x00, 0x22, 0xc0, 0xf3, 0x41, 0x23, 0x4e, 0xf7, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0x22, 0xc0, 0xf3, 0x41, 0x23, 0x4e, 0xf7, 0x41, 0x36, 0x50, 0x01, 0x00, 0x23, 0x80, 0xf7, 0x41,
+        0x23, 0x46, 0xf9, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x23, 0x80, 0xf7, 0x41, 0x24, 0x9e, 0xfe, 0x41,
+        0x3e, 0x50, 0x01, 0x00, 0x23, 0x60, 0xf9, 0x41, 0x23, 0x26, 0xfb, 0x41, 0x4a, 0x50, 0x00, 0x00,
+        0x23, 0x40, 0xfb, 0x41, 0x23, 0x06, 0xfd, 0x41, 0x4a, 0x50, 0x00, 0x00, 0x23, 0x20, 0xfd, 0x41,
+        0x13, 0x93, 0x06, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x24, 0x00, 0xff, 0x41, 0x12, 0x47, 0x01, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0x12, 0x60, 0x01, 0x42, 0x12, 0x27, 0x03, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x12, 0x40, 0x03, 0x42, 0x13, 0xcf, 0x06, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x13, 0x00, 0x07, 0x42,
+        0x13, 0xc7, 0x08, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x13, 0xe0, 0x08, 0x42, 0x13, 0xc3, 0x09, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x13, 0xe0, 0x08, 0x42, 0x13, 0xc3, 0x09, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x13, 0xe0, 0x08, 0x42, 0x13, 0xa7, 0x0a, 0x42, 0x31, 0x50, 0x01, 0x00, 0x13, 0xd0, 0x09, 0x42,
+        0x13, 0xb3, 0x0a, 0x42, 0x39, 0x50, 0x00, 0x00, 0x13, 0xd0, 0x09, 0x42, 0x13, 0xb3, 0x0a, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x13, 0xc0, 0x0a, 0x42, 0x14, 0xa3, 0x0b, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x13, 0xc0, 0x0a, 0x42, 0x14, 0xa3, 0x0b, 0x42, 0x45, 0x50, 0x00, 0x00, 0x13, 0xc0, 0x0a, 0x42,
+        0x14, 0x4f, 0x0e, 0x42, 0x36, 0x50, 0x01, 0x00, 0x14, 0xb0, 0x0b, 0x42, 0x14, 0x93, 0x0c, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x14, 0xb0, 0x0b, 0x42, 0x14, 0x93, 0x0c, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x14, 0xa0, 0x0c, 0x42, 0x14, 0x83, 0x0d, 0x42, 0x39, 0x50, 0x00, 0x00, 0x14, 0xa0, 0x0c, 0x42,
+        0x14, 0x83, 0x0d, 0x42, 0x45, 0x50, 0x00, 0x00, 0x14, 0x90, 0x0d, 0x42, 0x14, 0x73, 0x0e, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x14, 0x90, 0x0d, 0x42, 0x14, 0x73, 0x0e, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x14, 0x80, 0x0e, 0x42, 0x14, 0x63, 0x0f, 0x42, 0x39, 0x50, 0x00, 0x00, 0x14, 0x80, 0x0e, 0x42,
+        0x14, 0x63, 0x0f, 0x42, 0x45, 0x50, 0x00, 0x00, 0x14, 0x80, 0x0e, 0x42, 0x14, 0x47, 0x10, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x14, 0x70, 0x0f, 0x42, 0x14, 0x37, 0x11, 0x42, 0x44, 0x50, 0x00, 0x00,
+        0x14, 0x60, 0x10, 0x42, 0x14, 0x27, 0x12, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x14, 0x50, 0x11, 0x42,
+        0x15, 0x17, 0x13, 0x42, 0x42, 0x50, 0x00, 0x00, 0x14, 0x40, 0x12, 0x42, 0x15, 0xcf, 0x15, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x15, 0x30, 0x13, 0x42, 0x15, 0xf7, 0x14, 0x42, 0x40, 0x50, 0x00, 0x00,
+        0x15, 0x00, 0x16, 0x42, 0x16, 0xa0, 0x1b, 0x42, 0x39, 0x50, 0x00, 0x00, 0x15, 0x00, 0x16, 0x42,
+        0x15, 0xc7, 0x17, 0x42, 0x21, 0x50, 0x01, 0x00, 0x15, 0xe0, 0x17, 0x42, 0x15, 0xc3, 0x18, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x15, 0xd0, 0x18, 0x42, 0x16, 0x97, 0x1a, 0x42, 0x31, 0x50, 0x01, 0x00,
+        0x16, 0xb0, 0x1a, 0x42, 0x16, 0x93, 0x1b, 0x42, 0x34, 0x50, 0x01, 0x00, 0x16, 0xa0, 0x1b, 0x42,
+        0x16, 0x67, 0x1d, 0x42, 0x39, 0x50, 0x01, 0x00, 0x16, 0x80, 0x1d, 0x42, 0x17, 0x9f, 0x24, 0x42,
+        0x3b, 0x50, 0x00, 0x00, 0x16, 0x80, 0x1d, 0x42, 0x17, 0x9f, 0x24, 0x42, 0x44, 0x50, 0x00, 0x00,
+        0x16, 0x80, 0x1d, 0x42, 0x16, 0x47, 0x1f, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x16, 0x60, 0x1f, 0x42,
+        0x17, 0x27, 0x21, 0x42, 0x34, 0x50, 0x01, 0x00, 0x17, 0x40, 0x21, 0x42, 0x17, 0xcf, 0x24, 0x42,
+        0x38, 0x50, 0x01, 0x00, 0x17, 0x00, 0x25, 0x42, 0x18, 0x1f, 0x2c, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x17, 0x00, 0x25, 0x42, 0x18, 0x1f, 0x2c, 0x42, 0x3d, 0x50, 0x00, 0x00, 0x17, 0x00, 0x25, 0x42,
+        0x18, 0x1f, 0x2c, 0x42, 0x42, 0x50, 0x00, 0x00, 0x17, 0x00, 0x25, 0x42, 0x18, 0x1f, 0x2c, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x17, 0x00, 0x25, 0x42, 0x17, 0xc7, 0x26, 0x42, 0x2a, 0x50, 0x01, 0x00,
+        0x17, 0xe0, 0x26, 0x42, 0x18, 0xa7, 0x28, 0x42, 0x31, 0x50, 0x01, 0x00, 0x18, 0xc0, 0x28, 0x42,
+        0x18, 0x4f, 0x2c, 0x42, 0x36, 0x50, 0x01, 0x00, 0x18, 0x80, 0x2c, 0x42, 0x19, 0x0f, 0x30, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x18, 0x80, 0x2c, 0x42, 0x19, 0x0f, 0x30, 0x42, 0x3d, 0x50, 0x00, 0x00,
+        0x18, 0x80, 0x2c, 0x42, 0x19, 0x0f, 0x30, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x18, 0x80, 0x2c, 0x42,
+        0x19, 0x0f, 0x30, 0x42, 0x31, 0x50, 0x01, 0x00, 0x18, 0x80, 0x2c, 0x42, 0x19, 0x0f, 0x30, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x19, 0x40, 0x30, 0x42, 0x19, 0xcf, 0x33, 0x42, 0x3b, 0x50, 0x00, 0x00,
+        0x19, 0x40, 0x30, 0x42, 0x19, 0xcf, 0x33, 0x42, 0x40, 0x50, 0x00, 0x00, 0x19, 0x40, 0x30, 0x42,
+        0x19, 0xcf, 0x33, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x19, 0x40, 0x30, 0x42, 0x19, 0xcf, 0x33, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x19, 0x40, 0x30, 0x42, 0x19, 0xcf, 0x33, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0x19, 0x00, 0x34, 0x42, 0x1a, 0x1f, 0x3b, 0x42, 0x40, 0x50, 0x00, 0x00, 0x19, 0x00, 0x34, 0x42,
+        0x1a, 0x1f, 0x3b, 0x42, 0x45, 0x50, 0x00, 0x00, 0x19, 0x00, 0x34, 0x42, 0x19, 0xc7, 0x35, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x19, 0xe0, 0x35, 0x42, 0x1a, 0xc3, 0x36, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x1a, 0xd0, 0x36, 0x42, 0x1a, 0x97, 0x38, 0x42, 0x39, 0x50, 0x01, 0x00, 0x1a, 0xb0, 0x38, 0x42,
+        0x1a, 0x93, 0x39, 0x42, 0x34, 0x50, 0x01, 0x00, 0x1a, 0xa0, 0x39, 0x42, 0x1a, 0x67, 0x3b, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x1a, 0x80, 0x3b, 0x42, 0x1b, 0x9f, 0x42, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x1a, 0x80, 0x3b, 0x42, 0x1b, 0x9f, 0x42, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x1a, 0x80, 0x3b, 0x42,
+        0x1a, 0x47, 0x3d, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x1a, 0x60, 0x3d, 0x42, 0x1b, 0x43, 0x3e, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x1b, 0x50, 0x3e, 0x42, 0x1b, 0x17, 0x40, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0x1b, 0x30, 0x40, 0x42, 0x1b, 0x13, 0x41, 0x42, 0x34, 0x50, 0x01, 0x00, 0x1b, 0x20, 0x41, 0x42,
+        0x1b, 0xe7, 0x42, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x1b, 0x00, 0x43, 0x42, 0x1c, 0x1f, 0x4a, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x1b, 0x00, 0x43, 0x42, 0x1c, 0x1f, 0x4a, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x1b, 0x00, 0x43, 0x42, 0x1c, 0x1f, 0x4a, 0x42, 0x49, 0x50, 0x00, 0x00, 0x1b, 0x00, 0x43, 0x42,
+        0x1c, 0x1f, 0x4a, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1b, 0x00, 0x43, 0x42, 0x1c, 0xc7, 0x44, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0x1c, 0xe0, 0x44, 0x42, 0x1c, 0xc3, 0x45, 0x42, 0x31, 0x50, 0x01, 0x00,
+        0x1c, 0xd0, 0x45, 0x42, 0x1c, 0x97, 0x47, 0x42, 0x36, 0x50, 0x01, 0x00, 0x1c, 0xb0, 0x47, 0x42,
+        0x1c, 0x93, 0x48, 0x42, 0x31, 0x50, 0x01, 0x00, 0x1c, 0xa0, 0x48, 0x42, 0x1c, 0x67, 0x4a, 0x42,
+        0x38, 0x50, 0x01, 0x00, 0x1c, 0x80, 0x4a, 0x42, 0x1d, 0x0f, 0x4e, 0x42, 0x42, 0x50, 0x00, 0x00,
+        0x1c, 0x80, 0x4a, 0x42, 0x1d, 0x47, 0x4c, 0x42, 0x26, 0x50, 0x01, 0x00, 0x1d, 0x60, 0x4c, 0x42,
+        0x1d, 0x27, 0x4e, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x1d, 0x40, 0x4e, 0x42, 0x1d, 0xcf, 0x51, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x1d, 0x40, 0x4e, 0x42, 0x1d, 0xcf, 0x51, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x1d, 0x40, 0x4e, 0x42, 0x1d, 0x07, 0x50, 0x42, 0x32, 0x50, 0x01, 0x00, 0x1d, 0x20, 0x50, 0x42,
+        0x1d, 0xe7, 0x51, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x1d, 0x00, 0x52, 0x42, 0x1e, 0x1f, 0x59, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x1d, 0x00, 0x52, 0x42, 0x1e, 0x1f, 0x59, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x1d, 0x00, 0x52, 0x42, 0x1e, 0xc7, 0x53, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x1e, 0xe0, 0x53, 0x42,
+        0x1e, 0xc3, 0x54, 0x42, 0x34, 0x50, 0x01, 0x00, 0x1e, 0xd0, 0x54, 0x42, 0x1e, 0x97, 0x56, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x1e, 0xb0, 0x56, 0x42, 0x1e, 0x93, 0x57, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x1e, 0xa0, 0x57, 0x42, 0x1e, 0x67, 0x59, 0x42, 0x3d, 0x50, 0x01, 0x00, 0x1e, 0x80, 0x59, 0x42,
+        0x1f, 0x9f, 0x60, 0x42, 0x44, 0x50, 0x00, 0x00, 0x1e, 0x80, 0x59, 0x42, 0x1f, 0x9f, 0x60, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0x1e, 0x80, 0x59, 0x42, 0x1f, 0x9f, 0x60, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x1e, 0x80, 0x59, 0x42, 0x1f, 0x9f, 0x60, 0x42, 0x50, 0x50, 0x00, 0x00, 0x1e, 0x80, 0x59, 0x42,
+        0x1f, 0x47, 0x5b, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x1f, 0x60, 0x5b, 0x42, 0x1f, 0x43, 0x5c, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x1f, 0x50, 0x5c, 0x42, 0x1f, 0x17, 0x5e, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1f, 0x30, 0x5e, 0x42, 0x1f, 0x13, 0x5f, 0x42, 0x36, 0x50, 0x01, 0x00, 0x1f, 0x20, 0x5f, 0x42,
+        0x1f, 0xe7, 0x60, 0x42, 0x3d, 0x50, 0x01, 0x00, 0x1f, 0x00, 0x61, 0x42, 0x20, 0x1f, 0x68, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x1f, 0x00, 0x61, 0x42, 0x20, 0x1f, 0x68, 0x42, 0x49, 0x50, 0x00, 0x00,
+        0x1f, 0x00, 0x61, 0x42, 0x20, 0x1f, 0x68, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1f, 0x00, 0x61, 0x42,
+        0x20, 0x1f, 0x68, 0x42, 0x51, 0x50, 0x00, 0x00, 0x1f, 0x00, 0x61, 0x42, 0x20, 0xc7, 0x62, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0x20, 0xe0, 0x62, 0x42, 0x20, 0xc3, 0x63, 0x42, 0x31, 0x50, 0x01, 0x00,
+        0x20, 0xd0, 0x63, 0x42, 0x20, 0x97, 0x65, 0x42, 0x36, 0x50, 0x01, 0x00, 0x20, 0xb0, 0x65, 0x42,
+        0x20, 0x93, 0x66, 0x42, 0x31, 0x50, 0x01, 0x00, 0x20, 0xa0, 0x66, 0x42, 0x20, 0x67, 0x68, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x21, 0x80, 0x68, 0x42, 0x21, 0x47, 0x6a, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x21, 0x80, 0x68, 0x42, 0x21, 0x0f, 0x6c, 0x42, 0x26, 0x50, 0x01, 0x00, 0x21, 0x60, 0x6a, 0x42,
+        0x21, 0x43, 0x6b, 0x42, 0x47, 0x50, 0x00, 0x00, 0x21, 0x50, 0x6b, 0x42, 0x21, 0x33, 0x6c, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0x21, 0x40, 0x6c, 0x42, 0x21, 0x07, 0x6e, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x21, 0x40, 0x6c, 0x42, 0x22, 0xcf, 0x6f, 0x42, 0x32, 0x50, 0x01, 0x00, 0x21, 0x20, 0x6e, 0x42,
+        0x22, 0xe7, 0x6f, 0x42, 0x45, 0x50, 0x00, 0x00, 0x22, 0x00, 0x70, 0x42, 0x23, 0x1f, 0x77, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x22, 0x00, 0x70, 0x42, 0x22, 0xc7, 0x71, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x22, 0xe0, 0x71, 0x42, 0x22, 0xc3, 0x72, 0x42, 0x34, 0x50, 0x01, 0x00, 0x22, 0xd0, 0x72, 0x42,
+        0x22, 0x97, 0x74, 0x42, 0x39, 0x50, 0x01, 0x00, 0x22, 0xb0, 0x74, 0x42, 0x22, 0x93, 0x75, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x22, 0xa0, 0x75, 0x42, 0x23, 0x67, 0x77, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x23, 0x80, 0x77, 0x42, 0x23, 0x47, 0x79, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x23, 0x60, 0x79, 0x42,
+        0x23, 0x27, 0x7b, 0x42, 0x34, 0x50, 0x01, 0x00, 0x23, 0x40, 0x7b, 0x42, 0x23, 0x07, 0x7d, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x23, 0x40, 0x7b, 0x42, 0x24, 0xcf, 0x7e, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0x23, 0x20, 0x7d, 0x42, 0x92, 0x03, 0x83, 0x42, 0x49, 0x50, 0x00, 0x00, 0x24, 0x00, 0x7f, 0x42,
+        0x92, 0x63, 0x80, 0x42, 0x26, 0x50, 0x01, 0x00, 0x12, 0x70, 0x80, 0x42, 0x92, 0x53, 0x81, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x12, 0x60, 0x81, 0x42, 0x92, 0x43, 0x82, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x12, 0x50, 0x82, 0x42, 0x92, 0x33, 0x83, 0x42, 0x36, 0x50, 0x01, 0x00, 0x12, 0x40, 0x83, 0x42,
+        0x93, 0xeb, 0x85, 0x42, 0x40, 0x50, 0x00, 0x00, 0x12, 0x40, 0x83, 0x42, 0x93, 0xcf, 0x86, 0x42,
+        0x28, 0x50, 0x01, 0x00, 0x12, 0x40, 0x83, 0x42, 0x93, 0xcf, 0x86, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x13, 0x88, 0x86, 0x42, 0x93, 0xf9, 0x86, 0x42, 0x45, 0x50, 0x00, 0x00, 0x13, 0x00, 0x87, 0x42,
+        0x93, 0x55, 0x88, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x13, 0x00, 0x87, 0x42, 0x93, 0xe3, 0x87, 0x42,
+        0x2f, 0x50, 0x01, 0x00, 0x13, 0xf0, 0x87, 0x42, 0x93, 0xd3, 0x88, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x13, 0x68, 0x88, 0x42, 0x93, 0x4b, 0x89, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x13, 0xe0, 0x88, 0x42,
+        0x93, 0xa7, 0x8a, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x13, 0x58, 0x89, 0x42, 0x93, 0xc9, 0x89, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0x13, 0xd0, 0x89, 0x42, 0x94, 0x5f, 0x8d, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x13, 0xc0, 0x8a, 0x42, 0x94, 0xa3, 0x8b, 0x42, 0x2c, 0x50, 0x01, 0x00, 0x14, 0xb0, 0x8b, 0x42,
+        0x94, 0x93, 0x8c, 0x42, 0x34, 0x50, 0x01, 0x00, 0x14, 0xa0, 0x8c, 0x42, 0x94, 0x67, 0x8e, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x14, 0x08, 0x8e, 0x42, 0x94, 0x79, 0x8e, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x14, 0x80, 0x8e, 0x42, 0x94, 0x63, 0x8f, 0x42, 0x49, 0x50, 0x00, 0x00, 0x14, 0x80, 0x8e, 0x42,
+        0x94, 0x63, 0x8f, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x14, 0x70, 0x8f, 0x42, 0x94, 0xe1, 0x8f, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0x14, 0x70, 0x8f, 0x42, 0x94, 0x53, 0x90, 0x42, 0x31, 0x50, 0x01, 0x00,
+        0x14, 0xe8, 0x8f, 0x42, 0x94, 0x59, 0x90, 0x42, 0x49, 0x50, 0x00, 0x00, 0x14, 0x60, 0x90, 0x42,
+        0x94, 0xd1, 0x90, 0x42, 0x47, 0x50, 0x00, 0x00, 0x14, 0x60, 0x90, 0x42, 0x94, 0x27, 0x92, 0x42,
+        0x39, 0x50, 0x01, 0x00, 0x14, 0xd8, 0x90, 0x42, 0x94, 0xbb, 0x91, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x14, 0xc8, 0x91, 0x42, 0x94, 0x39, 0x92, 0x42, 0x45, 0x50, 0x00, 0x00, 0x14, 0x40, 0x92, 0x42,
+        0x95, 0x07, 0x94, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x14, 0x40, 0x92, 0x42, 0x95, 0x07, 0x94, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x14, 0x40, 0x92, 0x42, 0x95, 0x07, 0x94, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x15, 0xb8, 0x92, 0x42, 0x95, 0x29, 0x93, 0x42, 0x45, 0x50, 0x00, 0x00, 0x15, 0x30, 0x93, 0x42,
+        0x95, 0x13, 0x94, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x15, 0x20, 0x94, 0x42, 0x95, 0x03, 0x95, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x15, 0x20, 0x94, 0x42, 0x95, 0xe7, 0x95, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x15, 0x20, 0x94, 0x42, 0x95, 0xe7, 0x95, 0x42, 0x34, 0x50, 0x01, 0x00, 0x15, 0x20, 0x94, 0x42,
+        0x95, 0xe7, 0x95, 0x42, 0x38, 0x50, 0x01, 0x00, 0x15, 0x10, 0x95, 0x42, 0x95, 0xf3, 0x95, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x15, 0x00, 0x96, 0x42, 0x95, 0xe3, 0x96, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x15, 0x00, 0x96, 0x42, 0x95, 0xe3, 0x96, 0x42, 0x2f, 0x50, 0x01, 0x00, 0x15, 0xf0, 0x96, 0x42,
+        0x95, 0x61, 0x97, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x15, 0xf0, 0x96, 0x42, 0x95, 0xd3, 0x97, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x15, 0x68, 0x97, 0x42, 0x95, 0xd9, 0x97, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x15, 0xe0, 0x97, 0x42, 0x95, 0x51, 0x98, 0x42, 0x49, 0x50, 0x00, 0x00, 0x15, 0xe0, 0x97, 0x42,
+        0x95, 0xa7, 0x99, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x15, 0x58, 0x98, 0x42, 0x96, 0x3d, 0x9d, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x15, 0xc0, 0x99, 0x42, 0x96, 0xa3, 0x9a, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x16, 0xb0, 0x9a, 0x42, 0x96, 0x93, 0x9b, 0x42, 0x34, 0x50, 0x01, 0x00, 0x16, 0xa0, 0x9b, 0x42,
+        0x96, 0x67, 0x9d, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x16, 0x80, 0x9d, 0x42, 0x96, 0xf1, 0x9d, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0x16, 0x80, 0x9d, 0x42, 0x96, 0x63, 0x9e, 0x42, 0x2a, 0x50, 0x01, 0x00,
+        0x16, 0xf8, 0x9d, 0x42, 0x96, 0xdb, 0x9e, 0x42, 0x49, 0x50, 0x00, 0x00, 0x16, 0x70, 0x9e, 0x42,
+        0x96, 0x53, 0x9f, 0x42, 0x31, 0x50, 0x01, 0x00, 0x16, 0xe8, 0x9e, 0x42, 0x96, 0xcb, 0x9f, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x16, 0x60, 0x9f, 0x42, 0x97, 0x27, 0xa1, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x16, 0xd8, 0x9f, 0x42, 0x96, 0xbb, 0xa0, 0x42, 0x45, 0x50, 0x00, 0x00, 0x16, 0xc8, 0xa0, 0x42,
+        0x97, 0xab, 0xa1, 0x42, 0x45, 0x50, 0x00, 0x00, 0x17, 0x40, 0xa1, 0x42, 0x97, 0x07, 0xa3, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0x17, 0x40, 0xa1, 0x42, 0x97, 0x07, 0xa3, 0x42, 0x31, 0x50, 0x01, 0x00,
+        0x17, 0xb8, 0xa1, 0x42, 0x97, 0x9b, 0xa2, 0x42, 0x47, 0x50, 0x00, 0x00, 0x17, 0xa8, 0xa2, 0x42,
+        0x97, 0x19, 0xa3, 0x42, 0x49, 0x50, 0x00, 0x00, 0x17, 0x20, 0xa3, 0x42, 0x97, 0x03, 0xa4, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x17, 0x20, 0xa3, 0x42, 0x97, 0xe7, 0xa4, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x17, 0x20, 0xa3, 0x42, 0x97, 0xe7, 0xa4, 0x42, 0x34, 0x50, 0x01, 0x00, 0x17, 0x20, 0xa3, 0x42,
+        0x97, 0xe7, 0xa4, 0x42, 0x38, 0x50, 0x01, 0x00, 0x17, 0x10, 0xa4, 0x42, 0x97, 0xf3, 0xa4, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x17, 0x00, 0xa5, 0x42, 0x97, 0xe3, 0xa5, 0x42, 0x2f, 0x50, 0x01, 0x00,
+        0x17, 0xf0, 0xa5, 0x42, 0x97, 0xd3, 0xa6, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x17, 0xf0, 0xa5, 0x42,
+        0x97, 0xd3, 0xa6, 0x42, 0x36, 0x50, 0x01, 0x00, 0x17, 0xe0, 0xa6, 0x42, 0x98, 0xa7, 0xa8, 0x42,
+        0x3e, 0x50, 0x01, 0x00, 0x17, 0x58, 0xa7, 0x42, 0x97, 0xc9, 0xa7, 0x42, 0x4a, 0x50, 0x00, 0x00,
+        0x17, 0xd0, 0xa7, 0x42, 0x98, 0x41, 0xa8, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x18, 0x48, 0xa8, 0x42,
+        0x98, 0x49, 0xac, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x18, 0xc0, 0xa8, 0x42, 0x98, 0xa3, 0xa9, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0x18, 0xb0, 0xa9, 0x42, 0x98, 0x93, 0xaa, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x18, 0xa0, 0xaa, 0x42, 0x98, 0x67, 0xac, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x18, 0x80, 0xac, 0x42,
+        0x98, 0x63, 0xad, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x18, 0xf8, 0xac, 0x42, 0x98, 0x69, 0xad, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x18, 0x70, 0xad, 0x42, 0x98, 0xe1, 0xad, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x18, 0x70, 0xad, 0x42, 0x98, 0x53, 0xae, 0x42, 0x31, 0x50, 0x01, 0x00, 0x18, 0x60, 0xae, 0x42,
+        0x98, 0xd1, 0xae, 0x42, 0x39, 0x50, 0x00, 0x00, 0x18, 0x60, 0xae, 0x42, 0x98, 0xd1, 0xae, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x18, 0x60, 0xae, 0x42, 0x99, 0x43, 0xaf, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x18, 0xd8, 0xae, 0x42, 0x99, 0x49, 0xaf, 0x42, 0x39, 0x50, 0x00, 0x00, 0x18, 0xd8, 0xae, 0x42,
+        0x99, 0x49, 0xaf, 0x42, 0x45, 0x50, 0x00, 0x00, 0x19, 0x50, 0xaf, 0x42, 0x99, 0xc1, 0xaf, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x19, 0x50, 0xaf, 0x42, 0x99, 0xc1, 0xaf, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x19, 0x50, 0xaf, 0x42, 0x99, 0x33, 0xb0, 0x42, 0x31, 0x50, 0x01, 0x00, 0x19, 0xc8, 0xaf, 0x42,
+        0x99, 0x39, 0xb0, 0x42, 0x39, 0x50, 0x00, 0x00, 0x19, 0xc8, 0xaf, 0x42, 0x99, 0x39, 0xb0, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x19, 0x40, 0xb0, 0x42, 0x99, 0xb1, 0xb0, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x19, 0x40, 0xb0, 0x42, 0x99, 0xb1, 0xb0, 0x42, 0x45, 0x50, 0x00, 0x00, 0x19, 0x40, 0xb0, 0x42,
+        0x99, 0x23, 0xb1, 0x42, 0x26, 0x50, 0x01, 0x00, 0x19, 0xb8, 0xb0, 0x42, 0x99, 0x9b, 0xb1, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x19, 0xb8, 0xb0, 0x42, 0x99, 0x9b, 0xb1, 0x42, 0x44, 0x50, 0x00, 0x00,
+        0x19, 0x30, 0xb1, 0x42, 0x99, 0x13, 0xb2, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x19, 0xa8, 0xb1, 0x42,
+        0x99, 0x8b, 0xb2, 0x42, 0x39, 0x50, 0x00, 0x00, 0x19, 0xa8, 0xb1, 0x42, 0x99, 0x8b, 0xb2, 0x42,
+        0x42, 0x50, 0x00, 0x00, 0x19, 0x20, 0xb2, 0x42, 0x99, 0xe7, 0xb3, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x19, 0x98, 0xb2, 0x42, 0x99, 0x7b, 0xb3, 0x42, 0x40, 0x50, 0x00, 0x00, 0x19, 0x88, 0xb3, 0x42,
+        0x99, 0xf9, 0xb3, 0x42, 0x40, 0x50, 0x00, 0x00, 0x19, 0x00, 0xb4, 0x42, 0x9a, 0xab, 0xb6, 0x42,
+        0x39, 0x50, 0x00, 0x00, 0x19, 0x00, 0xb4, 0x42, 0x99, 0xe3, 0xb4, 0x42, 0x21, 0x50, 0x01, 0x00,
+        0x19, 0xf0, 0xb4, 0x42, 0x99, 0x61, 0xb5, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x19, 0x68, 0xb5, 0x42,
+        0x99, 0x4b, 0xb6, 0x42, 0x31, 0x50, 0x01, 0x00, 0x19, 0x58, 0xb6, 0x42, 0x9a, 0xc9, 0xb6, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x1a, 0xd0, 0xb6, 0x42, 0x9a, 0xb3, 0xb7, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x1a, 0x48, 0xb7, 0x42, 0x9a, 0xb9, 0xb7, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x1a, 0xc0, 0xb7, 0x42,
+        0x9a, 0x6b, 0xba, 0x42, 0x44, 0x50, 0x00, 0x00, 0x1a, 0xc0, 0xb7, 0x42, 0x9a, 0xa3, 0xb8, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0x1a, 0xb0, 0xb8, 0x42, 0x9a, 0x21, 0xb9, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x1a, 0x28, 0xb9, 0x42, 0x9a, 0x0b, 0xba, 0x42, 0x38, 0x50, 0x01, 0x00, 0x1a, 0x18, 0xba, 0x42,
+        0x9a, 0x6d, 0xbb, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x1a, 0x90, 0xba, 0x42, 0x9a, 0x01, 0xbb, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x1a, 0x08, 0xbb, 0x42, 0x9a, 0x79, 0xbb, 0x42, 0x44, 0x50, 0x00, 0x00,
+        0x1a, 0x80, 0xbb, 0x42, 0x9a, 0x47, 0xbd, 0x42, 0x45, 0x50, 0x00, 0x00, 0x1a, 0x80, 0xbb, 0x42,
+        0x9a, 0x63, 0xbc, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x1a, 0x70, 0xbc, 0x42, 0x9a, 0xe1, 0xbc, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x1a, 0xe8, 0xbc, 0x42, 0x9b, 0xaf, 0xbe, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x1b, 0xd8, 0xbd, 0x42, 0x9b, 0x49, 0xbe, 0x42, 0x39, 0x50, 0x00, 0x00, 0x1b, 0x50, 0xbe, 0x42,
+        0x9b, 0xc1, 0xbe, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x1b, 0xc8, 0xbe, 0x42, 0x9b, 0x39, 0xbf, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x1b, 0x40, 0xbf, 0x42, 0x9b, 0x07, 0xc1, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x1b, 0x40, 0xbf, 0x42, 0x9b, 0x07, 0xc1, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x1b, 0x40, 0xbf, 0x42,
+        0x9b, 0x07, 0xc1, 0x42, 0x40, 0x50, 0x00, 0x00, 0x1b, 0x40, 0xbf, 0x42, 0x9b, 0x23, 0xc0, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0x1b, 0x30, 0xc0, 0x42, 0x9b, 0x13, 0xc1, 0x42, 0x36, 0x50, 0x01, 0x00,
+        0x1b, 0x20, 0xc1, 0x42, 0x9b, 0xe7, 0xc2, 0x42, 0x38, 0x50, 0x00, 0x00, 0x1b, 0x20, 0xc1, 0x42,
+        0x9b, 0xe7, 0xc2, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x1b, 0x20, 0xc1, 0x42, 0x9b, 0xe7, 0xc2, 0x42,
+        0x40, 0x50, 0x00, 0x00, 0x1b, 0x20, 0xc1, 0x42, 0x9b, 0xe7, 0xc2, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x1b, 0x20, 0xc1, 0x42, 0x9b, 0xe7, 0xc2, 0x42, 0x34, 0x50, 0x01, 0x00, 0x1b, 0x00, 0xc3, 0x42,
+        0x9c, 0x8f, 0xc6, 0x42, 0x40, 0x50, 0x00, 0x00, 0x1b, 0x00, 0xc3, 0x42, 0x9c, 0x8f, 0xc6, 0x42,
+        0x45, 0x50, 0x00, 0x00, 0x1b, 0x00, 0xc3, 0x42, 0x9b, 0xe3, 0xc3, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x1b, 0xf0, 0xc3, 0x42, 0x9b, 0x61, 0xc4, 0x42, 0x34, 0x50, 0x01, 0x00, 0x1b, 0x68, 0xc4, 0x42,
+        0x9c, 0x4b, 0xc5, 0x42, 0x39, 0x50, 0x01, 0x00, 0x1c, 0x58, 0xc5, 0x42, 0x9c, 0xc9, 0xc5, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x1c, 0xd0, 0xc5, 0x42, 0x9c, 0xb3, 0xc6, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1c, 0xc0, 0xc6, 0x42, 0x9c, 0x4f, 0xca, 0x42, 0x40, 0x50, 0x00, 0x00, 0x1c, 0xc0, 0xc6, 0x42,
+        0x9c, 0x4f, 0xca, 0x42, 0x47, 0x50, 0x00, 0x00, 0x1c, 0xc0, 0xc6, 0x42, 0x9c, 0x4f, 0xca, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x1c, 0xc0, 0xc6, 0x42, 0x9c, 0xa3, 0xc7, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x1c, 0xb0, 0xc7, 0x42, 0x9c, 0x21, 0xc8, 0x42, 0x34, 0x50, 0x01, 0x00, 0x1c, 0x28, 0xc8, 0x42,
+        0x9c, 0x0b, 0xc9, 0x42, 0x38, 0x50, 0x01, 0x00, 0x1c, 0x18, 0xc9, 0x42, 0x9c, 0x89, 0xc9, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x1c, 0x90, 0xc9, 0x42, 0x9c, 0x73, 0xca, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x1c, 0x80, 0xca, 0x42, 0x9d, 0x0f, 0xce, 0x42, 0x45, 0x50, 0x00, 0x00, 0x1c, 0x80, 0xca, 0x42,
+        0x9d, 0x0f, 0xce, 0x42, 0x49, 0x50, 0x00, 0x00, 0x1c, 0x80, 0xca, 0x42, 0x9d, 0x0f, 0xce, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x1c, 0x80, 0xca, 0x42, 0x9c, 0x63, 0xcb, 0x42, 0x2a, 0x50, 0x01, 0x00,
+        0x1c, 0x70, 0xcb, 0x42, 0x9d, 0xe1, 0xcb, 0x42, 0x31, 0x50, 0x01, 0x00, 0x1d, 0xe8, 0xcb, 0x42,
+        0x9d, 0xcb, 0xcc, 0x42, 0x36, 0x50, 0x01, 0x00, 0x1d, 0xd8, 0xcc, 0x42, 0x9d, 0x49, 0xcd, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x1d, 0x50, 0xcd, 0x42, 0x9d, 0x33, 0xce, 0x42, 0x38, 0x50, 0x01, 0x00,
+        0x1d, 0x40, 0xce, 0x42, 0x9d, 0x07, 0xd0, 0x42, 0x39, 0x50, 0x00, 0x00, 0x1d, 0x40, 0xce, 0x42,
+        0x9d, 0x07, 0xd0, 0x42, 0x3e, 0x50, 0x00, 0x00, 0x1d, 0x40, 0xce, 0x42, 0x9d, 0x23, 0xcf, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x1d, 0x30, 0xcf, 0x42, 0x9d, 0x13, 0xd0, 0x42, 0x2d, 0x50, 0x01, 0x00,
+        0x1d, 0x20, 0xd0, 0x42, 0x9d, 0xe7, 0xd1, 0x42, 0x39, 0x50, 0x00, 0x00, 0x1d, 0x20, 0xd0, 0x42,
+        0x9d, 0xe7, 0xd1, 0x42, 0x40, 0x50, 0x00, 0x00, 0x1d, 0x10, 0xd1, 0x42, 0x9d, 0xf3, 0xd1, 0x42,
+        0x2a, 0x50, 0x01, 0x00, 0x1d, 0x10, 0xd1, 0x42, 0x9d, 0xf3, 0xd1, 0x42, 0x32, 0x50, 0x01, 0x00,
+        0x1d, 0x00, 0xd2, 0x42, 0x9e, 0x8f, 0xd5, 0x42, 0x45, 0x50, 0x00, 0x00, 0x1d, 0x00, 0xd2, 0x42,
+        0x9e, 0x8f, 0xd5, 0x42, 0x49, 0x50, 0x00, 0x00, 0x1d, 0x00, 0xd2, 0x42, 0x9d, 0xe3, 0xd2, 0x42,
+        0x2d, 0x50, 0x01, 0x00, 0x1d, 0xf0, 0xd2, 0x42, 0x9e, 0x61, 0xd3, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x1e, 0x68, 0xd3, 0x42, 0x9e, 0x4b, 0xd4, 0x42, 0x39, 0x50, 0x01, 0x00, 0x1e, 0x58, 0xd4, 0x42,
+        0x9e, 0xc9, 0xd4, 0x42, 0x34, 0x50, 0x01, 0x00, 0x1e, 0xd0, 0xd4, 0x42, 0x9e, 0xb3, 0xd5, 0x42,
+        0x3b, 0x50, 0x01, 0x00, 0x1e, 0xc0, 0xd5, 0x42, 0x9e, 0x4f, 0xd9, 0x42, 0x44, 0x50, 0x00, 0x00,
+        0x1e, 0xc0, 0xd5, 0x42, 0x9e, 0x4f, 0xd9, 0x42, 0x49, 0x50, 0x00, 0x00, 0x1e, 0xc0, 0xd5, 0x42,
+        0x9e, 0x4f, 0xd9, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x1e, 0xc0, 0xd5, 0x42, 0x9e, 0x4f, 0xd9, 0x42,
+        0x50, 0x50, 0x00, 0x00, 0x1e, 0xc0, 0xd5, 0x42, 0x9e, 0xa3, 0xd6, 0x42, 0x2c, 0x50, 0x01, 0x00,
+        0x1e, 0xb0, 0xd6, 0x42, 0x9e, 0x21, 0xd7, 0x42, 0x36, 0x50, 0x01, 0x00, 0x1e, 0x28, 0xd7, 0x42,
+        0x9e, 0x0b, 0xd8, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x1e, 0x18, 0xd8, 0x42, 0x9e, 0x89, 0xd8, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x1e, 0x90, 0xd8, 0x42, 0x9e, 0x73, 0xd9, 0x42, 0x3d, 0x50, 0x01, 0x00,
+        0x1e, 0x80, 0xd9, 0x42, 0x9f, 0x63, 0xda, 0x42, 0x45, 0x50, 0x00, 0x00, 0x1e, 0x80, 0xd9, 0x42,
+        0x9f, 0x63, 0xda, 0x42, 0x49, 0x50, 0x00, 0x00, 0x1e, 0x80, 0xd9, 0x42, 0x9f, 0x63, 0xda, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x1e, 0x80, 0xd9, 0x42, 0x9f, 0x63, 0xda, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x1e, 0x80, 0xd9, 0x42, 0x9f, 0x63, 0xda, 0x42, 0x2a, 0x50, 0x01, 0x00, 0x1f, 0x70, 0xda, 0x42,
+        0x9f, 0xe1, 0xda, 0x42, 0x50, 0x50, 0x00, 0x00, 0x1f, 0x70, 0xda, 0x42, 0x9f, 0x53, 0xdb, 0x42,
+        0x31, 0x50, 0x01, 0x00, 0x1f, 0xe8, 0xda, 0x42, 0x9f, 0x3d, 0xdc, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x1f, 0x60, 0xdb, 0x42, 0x9f, 0x27, 0xdd, 0x42, 0x36, 0x50, 0x01, 0x00, 0x1f, 0x50, 0xdc, 0x42,
+        0x9f, 0x17, 0xde, 0x42, 0x45, 0x50, 0x00, 0x00, 0x1f, 0x40, 0xdd, 0x42, 0x9f, 0x07, 0xdf, 0x42,
+        0x26, 0x50, 0x01, 0x00, 0x1f, 0x30, 0xde, 0x42, 0x9f, 0xa1, 0xde, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x1f, 0xa8, 0xde, 0x42, 0x9f, 0x19, 0xdf, 0x42, 0x49, 0x50, 0x00, 0x00, 0x1f, 0x20, 0xdf, 0x42,
+        0x9f, 0x03, 0xe0, 0x42, 0x47, 0x50, 0x00, 0x00, 0x1f, 0x20, 0xdf, 0x42, 0x9f, 0xe7, 0xe0, 0x42,
+        0x32, 0x50, 0x01, 0x00, 0x1f, 0x10, 0xe0, 0x42, 0x9f, 0xf3, 0xe0, 0x42, 0x45, 0x50, 0x00, 0x00,
+        0x1f, 0x00, 0xe1, 0x42, 0xa0, 0x8f, 0xe4, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x1f, 0x00, 0xe1, 0x42,
+        0xa0, 0xe3, 0xe1, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x20, 0xf0, 0xe1, 0x42, 0xa0, 0x61, 0xe2, 0x42,
+        0x34, 0x50, 0x01, 0x00, 0x20, 0x68, 0xe2, 0x42, 0xa0, 0x4b, 0xe3, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x20, 0x58, 0xe3, 0x42, 0xa0, 0xc9, 0xe3, 0x42, 0x34, 0x50, 0x01, 0x00, 0x20, 0xd0, 0xe3, 0x42,
+        0xa0, 0xb3, 0xe4, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x20, 0xc0, 0xe4, 0x42, 0xa0, 0xa3, 0xe5, 0x42,
+        0x2c, 0x50, 0x01, 0x00, 0x20, 0xb0, 0xe5, 0x42, 0xa0, 0x93, 0xe6, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x20, 0xa0, 0xe6, 0x42, 0xa0, 0x83, 0xe7, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x20, 0xa0, 0xe6, 0x42,
+        0xa0, 0x67, 0xe8, 0x42, 0x38, 0x50, 0x01, 0x00, 0x20, 0x90, 0xe7, 0x42, 0xa1, 0x03, 0xec, 0x42,
+        0x49, 0x50, 0x00, 0x00, 0x21, 0x80, 0xe8, 0x42, 0xa1, 0x63, 0xe9, 0x42, 0x26, 0x50, 0x01, 0x00,
+        0x21, 0x70, 0xe9, 0x42, 0xa1, 0x53, 0xea, 0x42, 0x2d, 0x50, 0x01, 0x00, 0x21, 0x60, 0xea, 0x42,
+        0xa1, 0x43, 0xeb, 0x42, 0x32, 0x50, 0x01, 0x00, 0x21, 0x50, 0xeb, 0x42, 0xa1, 0x33, 0xec, 0x42,
+        0x36, 0x50, 0x01, 0x00, 0x21, 0x40, 0xec, 0x42, 0xa2, 0xcf, 0xef, 0x42, 0x39, 0x50, 0x00, 0x00,
+        0x21, 0x40, 0xec, 0x42, 0xa2, 0xcf, 0xef, 0x42, 0x3b, 0x50, 0x00, 0x00, 0x21, 0x40, 0xec, 0x42,
+        0xa2, 0xcf, 0xef, 0x42, 0x40, 0x50, 0x00, 0x00, 0x21, 0x40, 0xec, 0x42, 0xa2, 0xcf, 0xef, 0x42,
+        0x28, 0x50, 0x01, 0x00, 0x21, 0x40, 0xec, 0x42, 0xa2, 0xcf, 0xef, 0x42, 0x34, 0x50, 0x01, 0x00,
+        0x22, 0x00, 0xf0, 0x42, 0xa2, 0xe3, 0xf0, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x22, 0x00, 0xf0, 0x42,
+        0xa2, 0xe3, 0xf0, 0x42, 0x3b, 0x50, 0x01, 0x00, 0x22, 0xf0, 0xf0, 0x42, 0xa2, 0x61, 0xf1, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x22, 0xf0, 0xf0, 0x42, 0xa2, 0xd3, 0xf1, 0x42, 0x42, 0x50, 0x01, 0x00,
+        0x22, 0x68, 0xf1, 0x42, 0xa2, 0x4b, 0xf2, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x22, 0xe0, 0xf1, 0x42,
+        0xa2, 0xc3, 0xf2, 0x42, 0x45, 0x50, 0x01, 0x00, 0x22, 0x58, 0xf2, 0x42, 0xa2, 0x3b, 0xf3, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x22, 0xd0, 0xf2, 0x42, 0xa2, 0xb3, 0xf3, 0x42, 0x42, 0x50, 0x01, 0x00,
+        0x22, 0x48, 0xf3, 0x42, 0xa2, 0x0f, 0xf5, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x22, 0xc0, 0xf3, 0x42,
+        0xa2, 0xa3, 0xf4, 0x42, 0x38, 0x50, 0x01, 0x00, 0x22, 0xb0, 0xf4, 0x42, 0xa2, 0x93, 0xf5, 0x42,
+        0x40, 0x50, 0x01, 0x00, 0x22, 0x28, 0xf5, 0x42, 0xa2, 0x99, 0xf5, 0x42, 0x47, 0x50, 0x00, 0x00,
+        0x22, 0xa0, 0xf5, 0x42, 0xa2, 0x11, 0xf6, 0x42, 0x50, 0x50, 0x00, 0x00, 0x22, 0xa0, 0xf5, 0x42,
+        0xa2, 0x83, 0xf6, 0x42, 0x44, 0x50, 0x01, 0x00, 0x22, 0x18, 0xf6, 0x42, 0xa2, 0x89, 0xf6, 0x42,
+        0x47, 0x50, 0x00, 0x00, 0x22, 0x90, 0xf6, 0x42, 0xa3, 0x01, 0xf7, 0x42, 0x51, 0x50, 0x00, 0x00,
+        0x22, 0x90, 0xf6, 0x42, 0xa3, 0x73, 0xf7, 0x42, 0x40, 0x50, 0x01, 0x00, 0x23, 0x08, 0xf7, 0x42,
+        0xa3, 0x79, 0xf7, 0x42, 0x53, 0x50, 0x00, 0x00, 0x23, 0x80, 0xf7, 0x42, 0xa3, 0x63, 0xf8, 0x42,
+        0x51, 0x50, 0x00, 0x00, 0x23, 0x80, 0xf7, 0x42, 0xa3, 0x63, 0xf8, 0x42, 0x39, 0x50, 0x01, 0x00,
+        0x23, 0x70, 0xf8, 0x42, 0xa3, 0xe1, 0xf8, 0x42, 0x51, 0x50, 0x00, 0x00, 0x23, 0x70, 0xf8, 0x42,
+        0xa3, 0x53, 0xf9, 0x42, 0x40, 0x50, 0x01, 0x00, 0x23, 0xe8, 0xf8, 0x42, 0xa3, 0xcb, 0xf9, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x23, 0x60, 0xf9, 0x42, 0xa3, 0x43, 0xfa, 0x42, 0x45, 0x50, 0x01, 0x00,
+        0x23, 0xd8, 0xf9, 0x42, 0xa3, 0xbb, 0xfa, 0x42, 0x4a, 0x50, 0x00, 0x00, 0x23, 0x50, 0xfa, 0x42,
+        0xa3, 0x33, 0xfb, 0x42, 0x40, 0x50, 0x01, 0x00, 0x23, 0xc8, 0xfa, 0x42, 0xa3, 0xe8, 0xfa, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x23, 0xe9, 0xfa, 0x42, 0xa3, 0x90, 0xfc, 0x42, 0x4e, 0x50, 0x00, 0x00,
+        0x23, 0x40, 0xfb, 0x42, 0xa3, 0x07, 0xfd, 0x42, 0x3e, 0x50, 0x01, 0x00, 0x23, 0xa8, 0xfc, 0x42,
+        0xa3, 0x19, 0xfd, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x23, 0x20, 0xfd, 0x42, 0xa4, 0x03, 0xfe, 0x42,
+        0x4c, 0x50, 0x00, 0x00, 0x23, 0x20, 0xfd, 0x42, 0xa4, 0xe7, 0xfe, 0x42, 0x3d, 0x50, 0x01, 0x00,
+        0x24, 0x10, 0xfe, 0x42, 0xa4, 0x81, 0xfe, 0x42, 0x4e, 0x50, 0x00, 0x00, 0x24, 0x88, 0xfe, 0x42,
+        0xa4, 0xf9, 0xfe, 0x42, 0x4c, 0x50, 0x00, 0x00, 0x24, 0x00, 0xff, 0x42, 0xa4, 0xe3, 0xff, 0x42,
+        0x4e, 0x50, 0x00, 0x00, 0x24, 0x00, 0xff, 0x42, 0xa4, 0xe3, 0xff, 0x42, 0x3b, 0x50, 0x01, 0x00,
+        0x24, 0xf0, 0xff, 0x42, 0xd2, 0x30, 0x00, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x24, 0xf0, 0xff, 0x42,
+        0xd2, 0x69, 0x00, 0x43, 0x3e, 0x50, 0x01, 0x00, 0x12, 0x34, 0x00, 0x43, 0xd2, 0xa5, 0x00, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x12, 0x70, 0x00, 0x43, 0xd2, 0xe1, 0x00, 0x43, 0x42, 0x50, 0x01, 0x00,
+        0x12, 0xac, 0x00, 0x43, 0xd2, 0x1d, 0x01, 0x43, 0x47, 0x50, 0x00, 0x00, 0x12, 0xe8, 0x00, 0x43,
+        0xd2, 0x59, 0x01, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x12, 0x24, 0x01, 0x43, 0xd2, 0x40, 0x02, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x12, 0x60, 0x01, 0x43, 0xd2, 0xd1, 0x01, 0x43, 0x38, 0x50, 0x01, 0x00,
+        0x12, 0xd8, 0x01, 0x43, 0xd2, 0x49, 0x02, 0x43, 0x40, 0x50, 0x01, 0x00, 0x12, 0x50, 0x02, 0x43,
+        0xd2, 0x88, 0x02, 0x43, 0x50, 0x50, 0x00, 0x00, 0x12, 0x50, 0x02, 0x43, 0xd2, 0xc1, 0x02, 0x43,
+        0x44, 0x50, 0x01, 0x00, 0x12, 0x8c, 0x02, 0x43, 0xd2, 0xc4, 0x02, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x12, 0xc8, 0x02, 0x43, 0xd2, 0x00, 0x03, 0x43, 0x51, 0x50, 0x00, 0x00, 0x12, 0xc8, 0x02, 0x43,
+        0xd2, 0x39, 0x03, 0x43, 0x40, 0x50, 0x01, 0x00, 0x12, 0x04, 0x03, 0x43, 0xd2, 0x3c, 0x03, 0x43,
+        0x53, 0x50, 0x00, 0x00, 0x12, 0x40, 0x03, 0x43, 0xd2, 0xb1, 0x03, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x12, 0x40, 0x03, 0x43, 0xd2, 0xb1, 0x03, 0x43, 0x39, 0x50, 0x01, 0x00, 0x12, 0xb8, 0x03, 0x43,
+        0xd2, 0xf0, 0x03, 0x43, 0x51, 0x50, 0x00, 0x00, 0x12, 0xb8, 0x03, 0x43, 0xd2, 0x29, 0x04, 0x43,
+        0x40, 0x50, 0x01, 0x00, 0x12, 0xf4, 0x03, 0x43, 0xd3, 0x65, 0x04, 0x43, 0x4c, 0x50, 0x00, 0x00,
+        0x12, 0x30, 0x04, 0x43, 0xd3, 0xa1, 0x04, 0x43, 0x45, 0x50, 0x01, 0x00, 0x13, 0x6c, 0x04, 0x43,
+        0xd3, 0xdd, 0x04, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x13, 0xa8, 0x04, 0x43, 0xd3, 0x19, 0x05, 0x43,
+        0x40, 0x50, 0x01, 0x00, 0x13, 0xe4, 0x04, 0x43, 0x53, 0xf4, 0x04, 0x43, 0x4c, 0x50, 0x00, 0x00,
+        0x93, 0xf4, 0x04, 0x43, 0x53, 0xc8, 0x05, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x13, 0x20, 0x05, 0x43,
+        0xd3, 0x91, 0x05, 0x43, 0x32, 0x50, 0x01, 0x00, 0x13, 0x98, 0x05, 0x43, 0xd3, 0x09, 0x06, 0x43,
+        0x3e, 0x50, 0x01, 0x00, 0x13, 0xd4, 0x05, 0x43, 0xd3, 0x0c, 0x06, 0x43, 0x4e, 0x50, 0x00, 0x00,
+        0x13, 0x10, 0x06, 0x43, 0xd3, 0x48, 0x06, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x13, 0x10, 0x06, 0x43,
+        0xd3, 0x81, 0x06, 0x43, 0x31, 0x50, 0x01, 0x00, 0x13, 0x4c, 0x06, 0x43, 0xd3, 0x84, 0x06, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x13, 0x88, 0x06, 0x43, 0xd3, 0xc0, 0x06, 0x43, 0x4e, 0x50, 0x00, 0x00,
+        0x13, 0x88, 0x06, 0x43, 0xd3, 0xf9, 0x06, 0x43, 0x3d, 0x50, 0x01, 0x00, 0x13, 0xc4, 0x06, 0x43,
+        0xd3, 0xfc, 0x06, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x13, 0x00, 0x07, 0x43, 0xd3, 0x71, 0x07, 0x43,
+        0x4e, 0x50, 0x00, 0x00, 0x13, 0x00, 0x07, 0x43, 0xd3, 0x71, 0x07, 0x43, 0x2f, 0x50, 0x01, 0x00,
+        0x13, 0x78, 0x07, 0x43, 0xd3, 0xb0, 0x07, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x13, 0x78, 0x07, 0x43,
+        0xd3, 0xe9, 0x07, 0x43, 0x36, 0x50, 0x01, 0x00, 0x13, 0xb4, 0x07, 0x43, 0xd3, 0x25, 0x08, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x13, 0xf0, 0x07, 0x43, 0xd3, 0x61, 0x08, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x13, 0x2c, 0x08, 0x43, 0xd3, 0x9d, 0x08, 0x43, 0x47, 0x50, 0x00, 0x00, 0x13, 0x68, 0x08, 0x43,
+        0xd3, 0xd9, 0x08, 0x43, 0x36, 0x50, 0x01, 0x00, 0x13, 0xa4, 0x08, 0x43, 0xd3, 0xc0, 0x09, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x13, 0xe0, 0x08, 0x43, 0xd3, 0x51, 0x09, 0x43, 0x2c, 0x50, 0x01, 0x00,
+        0x13, 0x58, 0x09, 0x43, 0xd3, 0xc9, 0x09, 0x43, 0x34, 0x50, 0x01, 0x00, 0x13, 0xd0, 0x09, 0x43,
+        0xd3, 0x41, 0x0a, 0x43, 0x50, 0x50, 0x00, 0x00, 0x13, 0xd0, 0x09, 0x43, 0xd3, 0x41, 0x0a, 0x43,
+        0x38, 0x50, 0x01, 0x00, 0x13, 0x48, 0x0a, 0x43, 0xd3, 0x80, 0x0a, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x13, 0x48, 0x0a, 0x43, 0xd3, 0xb9, 0x0a, 0x43, 0x34, 0x50, 0x01, 0x00, 0x13, 0x84, 0x0a, 0x43,
+        0xd3, 0xbc, 0x0a, 0x43, 0x53, 0x50, 0x00, 0x00, 0x13, 0xc0, 0x0a, 0x43, 0xd3, 0x31, 0x0b, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x13, 0xc0, 0x0a, 0x43, 0xd3, 0x31, 0x0b, 0x43, 0x2f, 0x50, 0x01, 0x00,
+        0x13, 0x38, 0x0b, 0x43, 0xd3, 0x70, 0x0b, 0x43, 0x51, 0x50, 0x00, 0x00, 0x13, 0x38, 0x0b, 0x43,
+        0xd4, 0xa9, 0x0b, 0x43, 0x36, 0x50, 0x01, 0x00, 0x13, 0x74, 0x0b, 0x43, 0xd4, 0xe5, 0x0b, 0x43,
+        0x4e, 0x50, 0x00, 0x00, 0x14, 0xb0, 0x0b, 0x43, 0xd4, 0x21, 0x0c, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x14, 0xec, 0x0b, 0x43, 0xd4, 0x5d, 0x0c, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x14, 0x28, 0x0c, 0x43,
+        0xd4, 0x99, 0x0c, 0x43, 0x36, 0x50, 0x01, 0x00, 0x14, 0x64, 0x0c, 0x43, 0xd4, 0xf2, 0x0d, 0x43,
+        0x4c, 0x50, 0x00, 0x00, 0x14, 0xa0, 0x0c, 0x43, 0xd4, 0x11, 0x0d, 0x43, 0x2c, 0x50, 0x01, 0x00,
+        0x14, 0x18, 0x0d, 0x43, 0xd4, 0x89, 0x0d, 0x43, 0x34, 0x50, 0x01, 0x00, 0x14, 0x90, 0x0d, 0x43,
+        0xd4, 0x73, 0x0e, 0x43, 0x38, 0x50, 0x01, 0x00, 0x14, 0x08, 0x0e, 0x43, 0xd4, 0x40, 0x0e, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x14, 0x44, 0x0e, 0x43, 0xd4, 0x7c, 0x0e, 0x43, 0x49, 0x50, 0x00, 0x00,
+        0x14, 0x80, 0x0e, 0x43, 0xd4, 0x2a, 0x0f, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x14, 0x80, 0x0e, 0x43,
+        0xd4, 0xf1, 0x0e, 0x43, 0x2f, 0x50, 0x01, 0x00, 0x14, 0xf8, 0x0e, 0x43, 0xd4, 0x69, 0x0f, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x14, 0x34, 0x0f, 0x43, 0xd4, 0xa5, 0x0f, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x14, 0x70, 0x0f, 0x43, 0xd4, 0xe1, 0x0f, 0x43, 0x3e, 0x50, 0x01, 0x00, 0x14, 0xac, 0x0f, 0x43,
+        0xd4, 0xe4, 0x0f, 0x43, 0x49, 0x50, 0x00, 0x00, 0x14, 0xe8, 0x0f, 0x43, 0xd4, 0x21, 0x12, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x14, 0xe8, 0x0f, 0x43, 0xd4, 0x59, 0x10, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x14, 0x60, 0x10, 0x43, 0xd4, 0xd1, 0x10, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x14, 0xd8, 0x10, 0x43,
+        0xd4, 0x49, 0x11, 0x43, 0x34, 0x50, 0x01, 0x00, 0x14, 0x50, 0x11, 0x43, 0xd4, 0x33, 0x12, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x14, 0x40, 0x12, 0x43, 0xd4, 0x78, 0x12, 0x43, 0x49, 0x50, 0x00, 0x00,
+        0x14, 0x40, 0x12, 0x43, 0xd5, 0xb1, 0x12, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x14, 0x7c, 0x12, 0x43,
+        0xd5, 0xed, 0x12, 0x43, 0x49, 0x50, 0x00, 0x00, 0x15, 0xb8, 0x12, 0x43, 0xd5, 0x29, 0x13, 0x43,
+        0x31, 0x50, 0x01, 0x00, 0x15, 0xf4, 0x12, 0x43, 0xd5, 0x9e, 0x13, 0x43, 0x49, 0x50, 0x00, 0x00,
+        0x15, 0x30, 0x13, 0x43, 0xd5, 0xa1, 0x13, 0x43, 0x36, 0x50, 0x01, 0x00, 0x15, 0xa8, 0x13, 0x43,
+        0xd5, 0x19, 0x14, 0x43, 0x45, 0x50, 0x00, 0x00, 0x15, 0xa8, 0x13, 0x43, 0xd5, 0x19, 0x14, 0x43,
+        0x31, 0x50, 0x01, 0x00, 0x15, 0x20, 0x14, 0x43, 0xd5, 0x91, 0x14, 0x43, 0x2a, 0x50, 0x01, 0x00,
+        0x15, 0x20, 0x14, 0x43, 0xd5, 0x91, 0x14, 0x43, 0x31, 0x50, 0x01, 0x00, 0x15, 0x20, 0x14, 0x43,
+        0xd5, 0x91, 0x14, 0x43, 0x36, 0x50, 0x01, 0x00, 0x15, 0x5c, 0x14, 0x43, 0xd5, 0xcd, 0x14, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x15, 0x5c, 0x14, 0x43, 0xd5, 0xcd, 0x14, 0x43, 0x4e, 0x50, 0x00, 0x00,
+        0x15, 0x98, 0x14, 0x43, 0xd5, 0x09, 0x15, 0x43, 0x36, 0x50, 0x01, 0x00, 0x15, 0xd4, 0x14, 0x43,
+        0xd5, 0x0c, 0x15, 0x43, 0x45, 0x50, 0x00, 0x00, 0x15, 0xd4, 0x14, 0x43, 0xd5, 0x0c, 0x15, 0x43,
+        0x4e, 0x50, 0x00, 0x00, 0x15, 0x10, 0x15, 0x43, 0xd5, 0x81, 0x15, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x15, 0x10, 0x15, 0x43, 0xd5, 0x81, 0x15, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x15, 0x10, 0x15, 0x43,
+        0xd5, 0xba, 0x15, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x15, 0x10, 0x15, 0x43, 0xd5, 0xba, 0x15, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x15, 0x10, 0x15, 0x43, 0xd5, 0xba, 0x15, 0x43, 0x38, 0x50, 0x01, 0x00,
+        0x15, 0x88, 0x15, 0x43, 0xd5, 0xf9, 0x15, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x15, 0xc4, 0x15, 0x43,
+        0xd5, 0xfc, 0x15, 0x43, 0x38, 0x50, 0x01, 0x00, 0x15, 0x00, 0x16, 0x43, 0xd5, 0xaa, 0x16, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x15, 0x00, 0x16, 0x43, 0xd5, 0xaa, 0x16, 0x43, 0x42, 0x50, 0x00, 0x00,
+        0x15, 0x00, 0x16, 0x43, 0xd5, 0xaa, 0x16, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x15, 0x00, 0x16, 0x43,
+        0xd5, 0x71, 0x16, 0x43, 0x2f, 0x50, 0x01, 0x00, 0x15, 0x78, 0x16, 0x43, 0xd5, 0xe9, 0x16, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x15, 0xb4, 0x16, 0x43, 0xd5, 0x25, 0x17, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x15, 0xb4, 0x16, 0x43, 0xd5, 0x25, 0x17, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x15, 0xf0, 0x16, 0x43,
+        0xd5, 0xd3, 0x17, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x15, 0x2c, 0x17, 0x43, 0xd5, 0x64, 0x17, 0x43,
+        0x49, 0x50, 0x00, 0x00, 0x15, 0x68, 0x17, 0x43, 0xd5, 0x2f, 0x19, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x15, 0xe0, 0x17, 0x43, 0xd5, 0x51, 0x18, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x15, 0x58, 0x18, 0x43,
+        0xd5, 0xc9, 0x18, 0x43, 0x34, 0x50, 0x01, 0x00, 0x15, 0xd0, 0x18, 0x43, 0xd5, 0xb3, 0x19, 0x43,
+        0x3e, 0x50, 0x01, 0x00, 0x15, 0x84, 0x19, 0x43, 0xd5, 0xbc, 0x19, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x15, 0xc0, 0x19, 0x43, 0xd6, 0x31, 0x1a, 0x43, 0x49, 0x50, 0x00, 0x00, 0x15, 0xc0, 0x19, 0x43,
+        0xd6, 0x31, 0x1a, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x16, 0x38, 0x1a, 0x43, 0xd6, 0x70, 0x1a, 0x43,
+        0x49, 0x50, 0x00, 0x00, 0x16, 0x38, 0x1a, 0x43, 0xd6, 0xa9, 0x1a, 0x43, 0x31, 0x50, 0x01, 0x00,
+        0x16, 0x74, 0x1a, 0x43, 0xd6, 0xe5, 0x1a, 0x43, 0x49, 0x50, 0x00, 0x00, 0x16, 0xb0, 0x1a, 0x43,
+        0xd6, 0x21, 0x1b, 0x43, 0x39, 0x50, 0x01, 0x00, 0x16, 0xec, 0x1a, 0x43, 0xd6, 0x5d, 0x1b, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x16, 0x28, 0x1b, 0x43, 0xd6, 0x99, 0x1b, 0x43, 0x31, 0x50, 0x01, 0x00,
+        0x16, 0x64, 0x1b, 0x43, 0xd6, 0xd5, 0x1b, 0x43, 0x45, 0x50, 0x00, 0x00, 0x16, 0xa0, 0x1b, 0x43,
+        0xd6, 0x83, 0x1c, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x16, 0xa0, 0x1b, 0x43, 0xd6, 0x83, 0x1c, 0x43,
+        0x31, 0x50, 0x01, 0x00, 0x16, 0xa0, 0x1b, 0x43, 0xd6, 0x83, 0x1c, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x16, 0xdc, 0x1b, 0x43, 0xd6, 0x4d, 0x1c, 0x43, 0x47, 0x50, 0x00, 0x00, 0x16, 0x54, 0x1c, 0x43,
+        0xd6, 0x8c, 0x1c, 0x43, 0x49, 0x50, 0x00, 0x00, 0x16, 0x90, 0x1c, 0x43, 0xd6, 0x01, 0x1d, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x16, 0x90, 0x1c, 0x43, 0xd6, 0x73, 0x1d, 0x43, 0x2c, 0x50, 0x01, 0x00,
+        0x16, 0x90, 0x1c, 0x43, 0xd6, 0x73, 0x1d, 0x43, 0x34, 0x50, 0x01, 0x00, 0x16, 0x90, 0x1c, 0x43,
+        0xd6, 0x73, 0x1d, 0x43, 0x38, 0x50, 0x01, 0x00, 0x16, 0x08, 0x1d, 0x43, 0xd6, 0x79, 0x1d, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x16, 0x80, 0x1d, 0x43, 0xd6, 0xf1, 0x1d, 0x43, 0x2f, 0x50, 0x01, 0x00,
+        0x16, 0xf8, 0x1d, 0x43, 0xd6, 0x69, 0x1e, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x16, 0xf8, 0x1d, 0x43,
+        0xd6, 0x4d, 0x1f, 0x43, 0x36, 0x50, 0x01, 0x00, 0x16, 0x70, 0x1e, 0x43, 0xd6, 0xa8, 0x1e, 0x43,
+        0x4a, 0x50, 0x00, 0x00, 0x16, 0xac, 0x1e, 0x43, 0xd6, 0x1d, 0x1f, 0x43, 0x4a, 0x50, 0x00, 0x00,
+        0x16, 0x24, 0x1f, 0x43, 0xd7, 0x24, 0x21, 0x43, 0x4a, 0x50, 0x00, 0x00, 0x16, 0x60, 0x1f, 0x43,
+        0xd6, 0xd1, 0x1f, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x16, 0xd8, 0x1f, 0x43, 0xd6, 0x49, 0x20, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x16, 0x50, 0x20, 0x43, 0xd7, 0x33, 0x21, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x17, 0x40, 0x21, 0x43, 0xd7, 0xb1, 0x21, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x17, 0xb8, 0x21, 0x43,
+        0xd7, 0x29, 0x22, 0x43, 0x39, 0x50, 0x00, 0x00, 0x17, 0xb8, 0x21, 0x43, 0xd7, 0x29, 0x22, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x17, 0xb8, 0x21, 0x43, 0xd7, 0x29, 0x22, 0x43, 0x31, 0x50, 0x01, 0x00,
+        0x17, 0x30, 0x22, 0x43, 0xd7, 0x68, 0x22, 0x43, 0x39, 0x50, 0x00, 0x00, 0x17, 0x30, 0x22, 0x43,
+        0xd7, 0x68, 0x22, 0x43, 0x45, 0x50, 0x00, 0x00, 0x17, 0x30, 0x22, 0x43, 0xd7, 0xa1, 0x22, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x17, 0x6c, 0x22, 0x43, 0xd7, 0xa4, 0x22, 0x43, 0x39, 0x50, 0x00, 0x00,
+        0x17, 0x6c, 0x22, 0x43, 0xd7, 0xa4, 0x22, 0x43, 0x45, 0x50, 0x00, 0x00, 0x17, 0xa8, 0x22, 0x43,
+        0xd7, 0xe0, 0x22, 0x43, 0x39, 0x50, 0x00, 0x00, 0x17, 0xa8, 0x22, 0x43, 0xd7, 0xe0, 0x22, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x17, 0xa8, 0x22, 0x43, 0xd7, 0x19, 0x23, 0x43, 0x31, 0x50, 0x01, 0x00,
+        0x17, 0xe4, 0x22, 0x43, 0xd7, 0x1c, 0x23, 0x43, 0x39, 0x50, 0x00, 0x00, 0x17, 0xe4, 0x22, 0x43,
+        0xd7, 0x1c, 0x23, 0x43, 0x45, 0x50, 0x00, 0x00, 0x17, 0x20, 0x23, 0x43, 0xd7, 0x58, 0x23, 0x43,
+        0x39, 0x50, 0x00, 0x00, 0x17, 0x20, 0x23, 0x43, 0xd7, 0x58, 0x23, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x17, 0x20, 0x23, 0x43, 0xd7, 0x91, 0x23, 0x43, 0x26, 0x50, 0x01, 0x00, 0x17, 0x5c, 0x23, 0x43,
+        0xd7, 0xcd, 0x23, 0x43, 0x39, 0x50, 0x00, 0x00, 0x17, 0x5c, 0x23, 0x43, 0xd7, 0xcd, 0x23, 0x43,
+        0x44, 0x50, 0x00, 0x00, 0x17, 0x98, 0x23, 0x43, 0xd7, 0x09, 0x24, 0x43, 0x2d, 0x50, 0x01, 0x00,
+        0x17, 0xd4, 0x23, 0x43, 0xd7, 0x45, 0x24, 0x43, 0x39, 0x50, 0x00, 0x00, 0x17, 0xd4, 0x23, 0x43,
+        0xd7, 0x45, 0x24, 0x43, 0x44, 0x50, 0x00, 0x00, 0x17, 0x10, 0x24, 0x43, 0xd7, 0xf3, 0x24, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x17, 0x4c, 0x24, 0x43, 0xd7, 0xbd, 0x24, 0x43, 0x39, 0x50, 0x00, 0x00,
+        0x17, 0x4c, 0x24, 0x43, 0xd7, 0xbd, 0x24, 0x43, 0x42, 0x50, 0x00, 0x00, 0x17, 0x00, 0x25, 0x43,
+        0xd7, 0x55, 0x26, 0x43, 0x39, 0x50, 0x00, 0x00, 0x17, 0x00, 0x25, 0x43, 0xd7, 0x71, 0x25, 0x43,
+        0x21, 0x50, 0x01, 0x00, 0x17, 0x78, 0x25, 0x43, 0xd7, 0xb0, 0x25, 0x43, 0x2d, 0x50, 0x01, 0x00,
+        0x17, 0xb4, 0x25, 0x43, 0xd7, 0x25, 0x26, 0x43, 0x31, 0x50, 0x01, 0x00, 0x17, 0x2c, 0x26, 0x43,
+        0xd7, 0x64, 0x26, 0x43, 0x34, 0x50, 0x01, 0x00, 0x17, 0x68, 0x26, 0x43, 0xd7, 0xa0, 0x26, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x17, 0xa4, 0x26, 0x43, 0xd7, 0xdc, 0x26, 0x43, 0x3b, 0x50, 0x00, 0x00,
+        0x17, 0xa4, 0x26, 0x43, 0xd7, 0xdc, 0x26, 0x43, 0x34, 0x50, 0x01, 0x00, 0x17, 0xe0, 0x26, 0x43,
+        0xd8, 0x35, 0x28, 0x43, 0x44, 0x50, 0x00, 0x00, 0x17, 0xe0, 0x26, 0x43, 0xd7, 0x51, 0x27, 0x43,
+        0x2c, 0x50, 0x01, 0x00, 0x17, 0x58, 0x27, 0x43, 0xd7, 0x90, 0x27, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x17, 0x94, 0x27, 0x43, 0xd7, 0x05, 0x28, 0x43, 0x38, 0x50, 0x01, 0x00, 0x17, 0x0c, 0x28, 0x43,
+        0xd8, 0x44, 0x28, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x18, 0x48, 0x28, 0x43, 0xd8, 0x80, 0x28, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x18, 0x48, 0x28, 0x43, 0xd8, 0xb9, 0x28, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x18, 0x84, 0x28, 0x43, 0xd8, 0xbc, 0x28, 0x43, 0x44, 0x50, 0x00, 0x00, 0x18, 0xc0, 0x28, 0x43,
+        0xd8, 0xa3, 0x29, 0x43, 0x45, 0x50, 0x00, 0x00, 0x18, 0xc0, 0x28, 0x43, 0xd8, 0x31, 0x29, 0x43,
+        0x2a, 0x50, 0x01, 0x00, 0x18, 0x38, 0x29, 0x43, 0xd8, 0x70, 0x29, 0x43, 0x31, 0x50, 0x01, 0x00,
+        0x18, 0x74, 0x29, 0x43, 0xd8, 0x1e, 0x2a, 0x43, 0x36, 0x50, 0x01, 0x00, 0x18, 0xec, 0x29, 0x43,
+        0xd8, 0x24, 0x2a, 0x43, 0x39, 0x50, 0x00, 0x00, 0x18, 0x28, 0x2a, 0x43, 0xd8, 0x60, 0x2a, 0x43,
+        0x3b, 0x50, 0x00, 0x00, 0x18, 0x28, 0x2a, 0x43, 0xd8, 0x60, 0x2a, 0x43, 0x31, 0x50, 0x01, 0x00,
+        0x18, 0x64, 0x2a, 0x43, 0xd8, 0x9c, 0x2a, 0x43, 0x39, 0x50, 0x00, 0x00, 0x18, 0x64, 0x2a, 0x43,
+        0xd8, 0x9c, 0x2a, 0x43, 0x36, 0x50, 0x01, 0x00, 0x18, 0xa0, 0x2a, 0x43, 0xd8, 0x83, 0x2b, 0x43,
+        0x39, 0x50, 0x00, 0x00, 0x18, 0xa0, 0x2a, 0x43, 0xd8, 0x83, 0x2b, 0x43, 0x3d, 0x50, 0x00, 0x00,
+        0x18, 0xa0, 0x2a, 0x43, 0xd8, 0x11, 0x2b, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x18, 0x18, 0x2b, 0x43,
+        0xd8, 0x89, 0x2b, 0x43, 0x31, 0x50, 0x01, 0x00, 0x18, 0x90, 0x2b, 0x43, 0xd8, 0x73, 0x2c, 0x43,
+        0x38, 0x50, 0x00, 0x00, 0x18, 0x90, 0x2b, 0x43, 0xd8, 0x73, 0x2c, 0x43, 0x3b, 0x50, 0x00, 0x00,
+        0x18, 0x90, 0x2b, 0x43, 0xd8, 0x73, 0x2c, 0x43, 0x44, 0x50, 0x00, 0x00, 0x18, 0x90, 0x2b, 0x43,
+        0xd8, 0x01, 0x2c, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x18, 0x08, 0x2c, 0x43, 0xd8, 0x79, 0x2c, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x18, 0x80, 0x2c, 0x43, 0xd8, 0x47, 0x2e, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x18, 0x80, 0x2c, 0x43, 0xd8, 0x47, 0x2e, 0x43, 0x45, 0x50, 0x00, 0x00, 0x18, 0x80, 0x2c, 0x43,
+        0xd8, 0xf1, 0x2c, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x18, 0xf8, 0x2c, 0x43, 0xd8, 0x30, 0x2d, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x18, 0x34, 0x2d, 0x43, 0xd8, 0xa5, 0x2d, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x18, 0xac, 0x2d, 0x43, 0xd8, 0xe4, 0x2d, 0x43, 0x34, 0x50, 0x01, 0x00, 0x18, 0xe8, 0x2d, 0x43,
+        0xd8, 0x59, 0x2e, 0x43, 0x3d, 0x50, 0x01, 0x00, 0x18, 0x60, 0x2e, 0x43, 0xd9, 0x27, 0x30, 0x43,
+        0x40, 0x50, 0x00, 0x00, 0x18, 0x60, 0x2e, 0x43, 0xd9, 0x27, 0x30, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x18, 0x60, 0x2e, 0x43, 0xd9, 0x27, 0x30, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x18, 0x60, 0x2e, 0x43,
+        0xd8, 0xd1, 0x2e, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x18, 0xd8, 0x2e, 0x43, 0xd8, 0x10, 0x2f, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x18, 0x14, 0x2f, 0x43, 0xd9, 0x85, 0x2f, 0x43, 0x38, 0x50, 0x01, 0x00,
+        0x19, 0x8c, 0x2f, 0x43, 0xd9, 0xc4, 0x2f, 0x43, 0x34, 0x50, 0x01, 0x00, 0x19, 0xc8, 0x2f, 0x43,
+        0xd9, 0x39, 0x30, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x19, 0x40, 0x30, 0x43, 0xd9, 0x07, 0x32, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x19, 0x40, 0x30, 0x43, 0xd9, 0x07, 0x32, 0x43, 0x49, 0x50, 0x00, 0x00,
+        0x19, 0x40, 0x30, 0x43, 0xd9, 0x07, 0x32, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x19, 0x40, 0x30, 0x43,
+        0xd9, 0xb1, 0x30, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x19, 0xb8, 0x30, 0x43, 0xd9, 0xf0, 0x30, 0x43,
+        0x31, 0x50, 0x01, 0x00, 0x19, 0xf4, 0x30, 0x43, 0xd9, 0x65, 0x31, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x19, 0x6c, 0x31, 0x43, 0xd9, 0xa4, 0x31, 0x43, 0x31, 0x50, 0x01, 0x00, 0x19, 0xa8, 0x31, 0x43,
+        0xd9, 0x19, 0x32, 0x43, 0x38, 0x50, 0x01, 0x00, 0x19, 0x20, 0x32, 0x43, 0xd9, 0xca, 0x32, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x19, 0x20, 0x32, 0x43, 0xd9, 0xca, 0x32, 0x43, 0x42, 0x50, 0x00, 0x00,
+        0x19, 0x20, 0x32, 0x43, 0xd9, 0x91, 0x32, 0x43, 0x26, 0x50, 0x01, 0x00, 0x19, 0x98, 0x32, 0x43,
+        0xd9, 0x09, 0x33, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x19, 0xd4, 0x32, 0x43, 0xd9, 0x0c, 0x33, 0x43,
+        0x39, 0x50, 0x00, 0x00, 0x19, 0x10, 0x33, 0x43, 0xd9, 0xf3, 0x33, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x19, 0x10, 0x33, 0x43, 0xd9, 0xf3, 0x33, 0x43, 0x44, 0x50, 0x00, 0x00, 0x19, 0x10, 0x33, 0x43,
+        0xd9, 0x81, 0x33, 0x43, 0x32, 0x50, 0x01, 0x00, 0x19, 0x88, 0x33, 0x43, 0xd9, 0xc0, 0x33, 0x43,
+        0x2a, 0x50, 0x01, 0x00, 0x19, 0xc4, 0x33, 0x43, 0xd9, 0xfc, 0x33, 0x43, 0x32, 0x50, 0x01, 0x00,
+        0x19, 0x00, 0x34, 0x43, 0xd9, 0xc7, 0x35, 0x43, 0x45, 0x50, 0x00, 0x00, 0x19, 0x00, 0x34, 0x43,
+        0xd9, 0xc7, 0x35, 0x43, 0x49, 0x50, 0x00, 0x00, 0x19, 0x00, 0x34, 0x43, 0xd9, 0x71, 0x34, 0x43,
+        0x2d, 0x50, 0x01, 0x00, 0x19, 0x78, 0x34, 0x43, 0xd9, 0xb0, 0x34, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x19, 0xb4, 0x34, 0x43, 0xd9, 0x25, 0x35, 0x43, 0x39, 0x50, 0x01, 0x00, 0x19, 0x2c, 0x35, 0x43,
+        0xd9, 0x64, 0x35, 0x43, 0x34, 0x50, 0x01, 0x00, 0x19, 0x68, 0x35, 0x43, 0xd9, 0xd9, 0x35, 0x43,
+        0x3d, 0x50, 0x01, 0x00, 0x19, 0xe0, 0x35, 0x43, 0xda, 0xa7, 0x37, 0x43, 0x44, 0x50, 0x00, 0x00,
+        0x19, 0xe0, 0x35, 0x43, 0xda, 0xa7, 0x37, 0x43, 0x49, 0x50, 0x00, 0x00, 0x19, 0xe0, 0x35, 0x43,
+        0xda, 0xa7, 0x37, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x19, 0xe0, 0x35, 0x43, 0xda, 0xa7, 0x37, 0x43,
+        0x50, 0x50, 0x00, 0x00, 0x19, 0xe0, 0x35, 0x43, 0xd9, 0x51, 0x36, 0x43, 0x2c, 0x50, 0x01, 0x00,
+        0x19, 0x58, 0x36, 0x43, 0xda, 0x90, 0x36, 0x43, 0x36, 0x50, 0x01, 0x00, 0x1a, 0x94, 0x36, 0x43,
+        0xda, 0x05, 0x37, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x1a, 0x0c, 0x37, 0x43, 0xda, 0x44, 0x37, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x1a, 0x48, 0x37, 0x43, 0xda, 0xb9, 0x37, 0x43, 0x3d, 0x50, 0x01, 0x00,
+        0x1a, 0xc0, 0x37, 0x43, 0xda, 0x31, 0x38, 0x43, 0x45, 0x50, 0x00, 0x00, 0x1a, 0xc0, 0x37, 0x43,
+        0xda, 0x31, 0x38, 0x43, 0x49, 0x50, 0x00, 0x00, 0x1a, 0xc0, 0x37, 0x43, 0xda, 0x31, 0x38, 0x43,
+        0x4e, 0x50, 0x00, 0x00, 0x1a, 0xc0, 0x37, 0x43, 0xda, 0x31, 0x38, 0x43, 0x51, 0x50, 0x00, 0x00,
+        0x1a, 0xc0, 0x37, 0x43, 0xda, 0x31, 0x38, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x1a, 0x38, 0x38, 0x43,
+        0xda, 0x70, 0x38, 0x43, 0x50, 0x50, 0x00, 0x00, 0x1a, 0x38, 0x38, 0x43, 0xda, 0x70, 0x38, 0x43,
+        0x31, 0x50, 0x01, 0x00, 0x1a, 0x74, 0x38, 0x43, 0xda, 0x90, 0x39, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x1a, 0x74, 0x38, 0x43, 0xda, 0x90, 0x39, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x1a, 0x74, 0x38, 0x43,
+        0xda, 0xe5, 0x38, 0x43, 0x36, 0x50, 0x01, 0x00, 0x1a, 0xec, 0x38, 0x43, 0xda, 0x24, 0x39, 0x43,
+        0x31, 0x50, 0x01, 0x00, 0x1a, 0x28, 0x39, 0x43, 0xda, 0x99, 0x39, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x1a, 0xa0, 0x39, 0x43, 0xda, 0x83, 0x3a, 0x43, 0x26, 0x50, 0x01, 0x00, 0x1a, 0x18, 0x3a, 0x43,
+        0xda, 0x50, 0x3a, 0x43, 0x47, 0x50, 0x00, 0x00, 0x1a, 0x54, 0x3a, 0x43, 0xda, 0x8c, 0x3a, 0x43,
+        0x49, 0x50, 0x00, 0x00, 0x1a, 0x90, 0x3a, 0x43, 0xda, 0x01, 0x3b, 0x43, 0x47, 0x50, 0x00, 0x00,
+        0x1a, 0x90, 0x3a, 0x43, 0xda, 0x73, 0x3b, 0x43, 0x32, 0x50, 0x01, 0x00, 0x1a, 0x08, 0x3b, 0x43,
+        0xda, 0x79, 0x3b, 0x43, 0x45, 0x50, 0x00, 0x00, 0x1a, 0x80, 0x3b, 0x43, 0xda, 0xf1, 0x3b, 0x43,
+        0x2d, 0x50, 0x01, 0x00, 0x1a, 0xf8, 0x3b, 0x43, 0xda, 0x4d, 0x3d, 0x43, 0x4c, 0x50, 0x00, 0x00,
+        0x1a, 0xf8, 0x3b, 0x43, 0xda, 0x30, 0x3c, 0x43, 0x34, 0x50, 0x01, 0x00, 0x1a, 0x34, 0x3c, 0x43,
+        0xda, 0xa5, 0x3c, 0x43, 0x39, 0x50, 0x01, 0x00, 0x1a, 0xac, 0x3c, 0x43, 0xda, 0xe4, 0x3c, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x1a, 0xe8, 0x3c, 0x43, 0xda, 0x59, 0x3d, 0x43, 0x3b, 0x50, 0x01, 0x00,
+        0x1a, 0x60, 0x3d, 0x43, 0xdb, 0x43, 0x3e, 0x43, 0x44, 0x50, 0x00, 0x00, 0x1a, 0x60, 0x3d, 0x43,
+        0xdb, 0xd1, 0x3d, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x1b, 0xd8, 0x3d, 0x43, 0xdb, 0x10, 0x3e, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x1b, 0x14, 0x3e, 0x43, 0xdb, 0xbe, 0x3e, 0x43, 0x38, 0x50, 0x01, 0x00,
+        0x1b, 0x50, 0x3e, 0x43, 0xdb, 0x33, 0x3f, 0x43, 0x45, 0x50, 0x00, 0x00, 0x1b, 0x50, 0x3e, 0x43,
+        0xdb, 0x33, 0x3f, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x1b, 0xc8, 0x3e, 0x43, 0xdb, 0x39, 0x3f, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x1b, 0x40, 0x3f, 0x43, 0xdb, 0x95, 0x40, 0x43, 0x49, 0x50, 0x00, 0x00,
+        0x1b, 0x40, 0x3f, 0x43, 0xdb, 0xb1, 0x3f, 0x43, 0x2a, 0x50, 0x01, 0x00, 0x1b, 0xb8, 0x3f, 0x43,
+        0xdb, 0xf0, 0x3f, 0x43, 0x31, 0x50, 0x01, 0x00, 0x1b, 0xf4, 0x3f, 0x43, 0xdb, 0x65, 0x40, 0x43,
+        0x36, 0x50, 0x01, 0x00, 0x1b, 0x6c, 0x40, 0x43, 0xdb, 0xa4, 0x40, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x1b, 0xa8, 0x40, 0x43, 0xdb, 0x19, 0x41, 0x43, 0x3d, 0x50, 0x00, 0x00, 0x1b, 0xa8, 0x40, 0x43,
+        0xdb, 0x19, 0x41, 0x43, 0x31, 0x50, 0x01, 0x00, 0x1b, 0x20, 0x41, 0x43, 0xdb, 0x03, 0x42, 0x43,
+        0x39, 0x50, 0x00, 0x00, 0x1b, 0x20, 0x41, 0x43, 0xdb, 0x03, 0x42, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x1b, 0x20, 0x41, 0x43, 0xdb, 0x91, 0x41, 0x43, 0x26, 0x50, 0x01, 0x00, 0x1b, 0x98, 0x41, 0x43,
+        0xdb, 0xd0, 0x41, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x1b, 0xd4, 0x41, 0x43, 0xdb, 0x0c, 0x42, 0x43,
+        0x32, 0x50, 0x01, 0x00, 0x1b, 0x10, 0x42, 0x43, 0xdb, 0xf3, 0x42, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0x1b, 0x10, 0x42, 0x43, 0xdb, 0xf3, 0x42, 0x43, 0x45, 0x50, 0x00, 0x00, 0x1b, 0x10, 0x42, 0x43,
+        0xdb, 0x81, 0x42, 0x43, 0x32, 0x50, 0x01, 0x00, 0x1b, 0x88, 0x42, 0x43, 0xdb, 0xf9, 0x42, 0x43,
+        0x2a, 0x50, 0x01, 0x00, 0x1b, 0x00, 0x43, 0x43, 0xdc, 0xc7, 0x44, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x1b, 0x00, 0x43, 0x43, 0xdc, 0xc7, 0x44, 0x43, 0x49, 0x50, 0x00, 0x00, 0x1b, 0x00, 0x43, 0x43,
+        0xdb, 0x71, 0x43, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x1b, 0x78, 0x43, 0x43, 0xdb, 0xb0, 0x43, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x1b, 0xb4, 0x43, 0x43, 0xdb, 0x25, 0x44, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0x1b, 0x2c, 0x44, 0x43, 0xdb, 0x64, 0x44, 0x43, 0x34, 0x50, 0x01, 0x00, 0x1b, 0x68, 0x44, 0x43,
+        0xdc, 0xd9, 0x44, 0x43, 0x3d, 0x50, 0x01, 0x00, 0x1c, 0xe0, 0x44, 0x43, 0xdc, 0xa7, 0x46, 0x43,
+        0x44, 0x50, 0x00, 0x00, 0x1c, 0xe0, 0x44, 0x43, 0xdc, 0xa7, 0x46, 0x43, 0x49, 0x50, 0x00, 0x00,
+        0x1c, 0xe0, 0x44, 0x43, 0xdc, 0xa7, 0x46, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x1c, 0xe0, 0x44, 0x43,
+        0xdc, 0xa7, 0x46, 0x43, 0x50, 0x50, 0x00, 0x00, 0x1c, 0xe0, 0x44, 0x43, 0xdc, 0x51, 0x45, 0x43,
+        0x2c, 0x50, 0x01, 0x00, 0x1c, 0x58, 0x45, 0x43, 0xdc, 0x90, 0x45, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x1c, 0x94, 0x45, 0x43, 0xdc, 0x05, 0x46, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x1c, 0x0c, 0x46, 0x43,
+        0xdc, 0x44, 0x46, 0x43, 0x36, 0x50, 0x01, 0x00, 0x1c, 0x48, 0x46, 0x43, 0xdc, 0xb9, 0x46, 0x43,
+        0x3d, 0x50, 0x01, 0x00, 0x1c, 0xc0, 0x46, 0x43, 0xdc, 0x31, 0x47, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x1c, 0xc0, 0x46, 0x43, 0xdc, 0x31, 0x47, 0x43, 0x49, 0x50, 0x00, 0x00, 0x1c, 0xc0, 0x46, 0x43,
+        0xdc, 0x31, 0x47, 0x43, 0x4e, 0x50, 0x00, 0x00, 0x1c, 0xc0, 0x46, 0x43, 0xdc, 0x31, 0x47, 0x43,
+        0x51, 0x50, 0x00, 0x00, 0x1c, 0xc0, 0x46, 0x43, 0xdc, 0x31, 0x47, 0x43, 0x2a, 0x50, 0x01, 0x00,
+        0x1c, 0x38, 0x47, 0x43, 0xdc, 0x70, 0x47, 0x43, 0x50, 0x50, 0x00, 0x00, 0x1c, 0x38, 0x47, 0x43,
+        0xdc, 0xa9, 0x47, 0x43, 0x31, 0x50, 0x01, 0x00, 0x1c, 0x74, 0x47, 0x43, 0xdc, 0x1e, 0x48, 0x43,
+        0x4e, 0x50, 0x00, 0x00, 0x1c, 0xec, 0x47, 0x43, 0xdc, 0x96, 0x48, 0x43, 0x36, 0x50, 0x01, 0x00,
+        0x1c, 0x28, 0x48, 0x43, 0xdc, 0x0b, 0x49, 0x43, 0x45, 0x50, 0x00, 0x00, 0x1c, 0xa0, 0x48, 0x43,
+        0xdc, 0x83, 0x49, 0x43, 0x26, 0x50, 0x01, 0x00, 0x1c, 0x18, 0x49, 0x43, 0xdc, 0x50, 0x49, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x1c, 0x54, 0x49, 0x43, 0xdc, 0x8c, 0x49, 0x43, 0x49, 0x50, 0x00, 0x00,
+        0x1c, 0x90, 0x49, 0x43, 0xdc, 0x01, 0x4a, 0x43, 0x47, 0x50, 0x00, 0x00, 0x1c, 0x90, 0x49, 0x43,
+        0xdc, 0x73, 0x4a, 0x43, 0x32, 0x50, 0x01, 0x00, 0x1c, 0x08, 0x4a, 0x43, 0xdc, 0x79, 0x4a, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x1c, 0x80, 0x4a, 0x43, 0xdc, 0xf1, 0x4a, 0x43, 0x2d, 0x50, 0x01, 0x00,
+        0x1c, 0xf8, 0x4a, 0x43, 0xdd, 0x4d, 0x4c, 0x43, 0x4c, 0x50, 0x00, 0x00, 0x1c, 0xf8, 0x4a, 0x43,
+        0xdc, 0x30, 0x4b, 0x43, 0x34, 0x50, 0x01, 0x00, 0x1c, 0x34, 0x4b, 0x43, 0xdc, 0xa5, 0x4b, 0x43,
+        0x39, 0x50, 0x01, 0x00, 0x1c, 0xac, 0x4b, 0x43, 0xdd, 0xe4, 0x4b, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x1d, 0xe8, 0x4b, 0x43, 0xdd, 0x59, 0x4c, 0x43, 0x3b, 0x50, 0x01, 0x00, 0x1d, 0x60, 0x4c, 0x43,
+        0xdd, 0xd1, 0x4c, 0x43, 0x2c, 0x50, 0x01, 0x00, 0x1d, 0xd8, 0x4c, 0x43, 0xdd, 0x49, 0x4d, 0x43,
+        0x34, 0x50, 0x01, 0x00, 0x1d, 0x50, 0x4d, 0x43, 0xdd, 0xc1, 0x4d, 0x43, 0x4e, 0x50, 0x00, 0x00,
+        0x1d, 0x50, 0x4d, 0x43, 0xdd, 0x33, 0x4e, 0x43, 0x38, 0x50, 0x01, 0x00, 0x1d, 0xc8, 0x4d, 0x43,
+        0xd9, 0x1f, 0x50, 0x43, 0x49, 0x50, 0x00, 0x00, 0x1d, 0x40, 0x4e, 0x43, 0x72, 0xb9, 0x4e, 0x43,
+        0x2a, 0x50, 0x01, 0x00, 0x1d, 0xc0, 0x4e, 0x43, 0x72, 0x39, 0x4f, 0x43, 0x31, 0x50, 0x01, 0x00,
+        0x1d, 0x40, 0x4f, 0x43, 0x72, 0xb9, 0x4f, 0x43, 0x39, 0x50, 0x01, 0x00, 0x1d, 0xc0, 0x4f, 0x43,
+        0x72, 0x39, 0x50, 0x43, 0x36, 0x50, 0x01, 0x00, 0x1d, 0x40, 0x50, 0x43, 0xd5, 0xbf, 0x50, 0x43,
+        0x3e, 0x50, 0x00, 0x00, 0x1d, 0x40, 0x50, 0x43, 0xd5, 0x3f, 0x52, 0x43, 0x26, 0x50, 0x01, 0x00,
+        0xd9, 0xc6, 0x50, 0x43, 0x92, 0x06, 0x51, 0x43, 0x47, 0x50, 0x00, 0x00, 0x38, 0x0a, 0x51, 0x43,
+        0xf0, 0x49, 0x51, 0x43, 0x49, 0x50, 0x00, 0x00, 0x96, 0x4d, 0x51, 0x43, 0x4e, 0xcd, 0x51, 0x43,
+        0x47, 0x50, 0x00, 0x00, 0x53, 0xd4, 0x51, 0x43, 0xe0, 0x61, 0x53, 0x43, 0x45, 0x50, 0x00, 0x00,
+        0x0f, 0x5b, 0x52, 0x43, 0xe0, 0xe1, 0x52, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x48, 0xe9, 0x52, 0x43,
+        0x19, 0x70, 0x53, 0x43, 0x34, 0x50, 0x01, 0x00, 0x81, 0x77, 0x53, 0x43, 0x6e, 0x85, 0x54, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x9e, 0xbe, 0x53, 0x43, 0xe0, 0x01, 0x54, 0x43, 0x39, 0x50, 0x01, 0x00,
+        0xba, 0x05, 0x54, 0x43, 0x8b, 0x8c, 0x54, 0x43, 0x34, 0x50, 0x01, 0x00, 0xf3, 0x93, 0x54, 0x43,
+        0x78, 0xb7, 0x55, 0x43, 0x44, 0x50, 0x00, 0x00, 0xf3, 0x93, 0x54, 0x43, 0x8d, 0x25, 0x55, 0x43,
+        0x2c, 0x50, 0x01, 0x00, 0x8d, 0x2d, 0x55, 0x43, 0x26, 0xbf, 0x55, 0x43, 0x34, 0x50, 0x01, 0x00,
+        0x26, 0xc7, 0x55, 0x43, 0xab, 0xea, 0x56, 0x43, 0x40, 0x50, 0x00, 0x00, 0x26, 0xc7, 0x55, 0x43,
+        0xc0, 0x58, 0x56, 0x43, 0x38, 0x50, 0x01, 0x00, 0xc0, 0x60, 0x56, 0x43, 0x59, 0xf2, 0x56, 0x43,
+        0x3b, 0x50, 0x01, 0x00, 0x59, 0xfa, 0x56, 0x43, 0xad, 0xa0, 0x59, 0x43, 0x32, 0x50, 0x00, 0x00,
+        0x59, 0xfa, 0x56, 0x43, 0xad, 0xa0, 0x59, 0x43, 0x36, 0x50, 0x00, 0x00, 0x59, 0xfa, 0x56, 0x43,
+        0xad, 0xa0, 0x59, 0x43, 0x39, 0x50, 0x00, 0x00, 0x59, 0xfa, 0x56, 0x43, 0xad, 0xa0, 0x59, 0x43,
+        0x3d, 0x50, 0x00, 0x00, 0x59, 0xfa, 0x56, 0x43, 0xad, 0xa0, 0x59, 0x43, 0x40, 0x50, 0x00, 0x00,
+        0x59, 0xfa, 0x56, 0x43, 0xad, 0xa0, 0x59, 0x43, 0x26, 0x50, 0x01, 0x00, 0xc5, 0xc4, 0x59, 0x43,
+        0x19, 0x6b, 0x5c, 0x43, 0x38, 0x50, 0x00, 0x00, 0xc5, 0xc4, 0x59, 0x43, 0x19, 0x6b, 0x5c, 0x43,
+        0x3b, 0x50, 0x00, 0x00, 0xc5, 0xc4, 0x59, 0x43, 0x19, 0x6b, 0x5c, 0x43, 0x3e, 0x50, 0x00, 0x00,
+        0xc5, 0xc4, 0x59, 0x43, 0x19, 0x6b, 0x5c, 0x43, 0x42, 0x50, 0x00, 0x00, 0xc5, 0xc4, 0x59, 0x43,
+        0x19, 0x6b, 0x5c, 0x43, 0x44, 0x50, 0x00, 0x00, 0xc5, 0xc4, 0x59, 0x43, 0x19, 0x6b, 0x5c, 0x43,
+        0x28, 0x50, 0x01, 0x00, 0x30, 0x8f, 0x5c, 0x43, 0x84, 0x35, 0x5f, 0x43, 0x39, 0x50, 0x00, 0x00,
+        0x30, 0x8f, 0x5c, 0x43, 0x84, 0x35, 0x5f, 0x43, 0x3d, 0x50, 0x00, 0x00, 0x30, 0x8f, 0x5c, 0x43,
+        0x84, 0x35, 0x5f, 0x43, 0x40, 0x50, 0x00, 0x00, 0x30, 0x8f, 0x5c, 0x43, 0x84, 0x35, 0x5f, 0x43,
+        0x45, 0x50, 0x00, 0x00, 0x30, 0x8f, 0x5c, 0x43, 0x84, 0x35, 0x5f, 0x43, 0x21, 0x50, 0x01, 0x00,
+        0x30, 0x8f, 0x5c, 0x43, 0x84, 0x35, 0x5f, 0x43, 0x2d, 0x50, 0x01, 0x00, 0x47, 0x55, 0xd5, 0x3f,
+        0xef, 0xff, 0xff, 0x3f, 0x47, 0x64, 0x01, 0x00, 0xef, 0xff, 0xff, 0x3f, 0xf6, 0xff, 0x1f, 0x40,
+        0x4c, 0x64, 0x01, 0x00, 0xf6, 0xff, 0x1f, 0x40, 0x9f, 0xaa, 0x2a, 0x40, 0x4f, 0x64, 0x01, 0x00,
+        0x9f, 0xaa, 0x2a, 0x40, 0xf3, 0xff, 0x3f, 0x40, 0x4e, 0x64, 0x01, 0x00, 0xf3, 0xff, 0x3f, 0x40,
+        0x9b, 0xaa, 0x6a, 0x40, 0x4c, 0x64, 0x01, 0x00, 0x9b, 0xaa, 0x6a, 0x40, 0xef, 0xff, 0x7f, 0x40,
+        0x53, 0x64, 0x01, 0x00, 0xef, 0xff, 0x7f, 0x40, 0xf6, 0xff, 0x9f, 0x40, 0x51, 0x64, 0x01, 0x00,
+        0xf6, 0xff, 0x9f, 0x40, 0xf3, 0xff, 0xbf, 0x40, 0x4e, 0x64, 0x01, 0x00, 0xf3, 0xff, 0xbf, 0x40,
+        0xf2, 0xff, 0xcf, 0x40, 0x4c, 0x64, 0x01, 0x00, 0xf2, 0xff, 0xcf, 0x40, 0x47, 0x55, 0xd5, 0x40,
+        0x4f, 0x64, 0x01, 0x00, 0x47, 0x55, 0xd5, 0x40, 0xf1, 0xff, 0xdf, 0x40, 0x4e, 0x64, 0x01, 0x00,
+        0xf1, 0xff, 0xdf, 0x40, 0x45, 0x55, 0xf5, 0x40, 0x4a, 0x64, 0x01, 0x00, 0x45, 0x55, 0xf5, 0x40,
+        0xef, 0xff, 0xff, 0x40, 0x4d, 0x64, 0x01, 0x00, 0xef, 0xff, 0xff, 0x40, 0xa1, 0xaa, 0x1a, 0x41,
+        0x47, 0x64, 0x01, 0x00, 0xa1, 0xaa, 0x1a, 0x41, 0xf6, 0xff, 0x1f, 0x41, 0x47, 0x64, 0x01, 0x00,
+        0xf6, 0xff, 0x1f, 0x41, 0xf5, 0xff, 0x27, 0x41, 0x4c, 0x64, 0x01, 0x00, 0xf5, 0xff, 0x27, 0x41,
+        0x9f, 0xaa, 0x2a, 0x41, 0x4f, 0x64, 0x01, 0x00, 0x9f, 0xaa, 0x2a, 0x41, 0xf4, 0xff, 0x2f, 0x41,
+        0x4e, 0x64, 0x01, 0x00, 0xf4, 0xff, 0x2f, 0x41, 0x9e, 0xaa, 0x3a, 0x41, 0x4c, 0x64, 0x01, 0x00,
+        0x9e, 0xaa, 0x3a, 0x41, 0xf3, 0xff, 0x3f, 0x41, 0x53, 0x64, 0x01, 0x00, 0xf3, 0xff, 0x3f, 0x41,
+        0x9d, 0xaa, 0x4a, 0x41, 0x56, 0x64, 0x01, 0x00, 0x9d, 0xaa, 0x4a, 0x41, 0xf2, 0xff, 0x4f, 0x41,
+        0x55, 0x64, 0x01, 0x00, 0xf2, 0xff, 0x4f, 0x41, 0x9c, 0xaa, 0x5a, 0x41, 0x54, 0x64, 0x01, 0x00,
+        0x9c, 0xaa, 0x5a, 0x41, 0xf1, 0xff, 0x5f, 0x41, 0x50, 0x64, 0x01, 0x00, 0xf1, 0xff, 0x5f, 0x41,
+        0xf1, 0xff, 0x67, 0x41, 0x54, 0x64, 0x01, 0x00, 0xf1, 0xff, 0x67, 0x41, 0x9b, 0xaa, 0x6a, 0x41,
+        0x53, 0x64, 0x01, 0x00, 0x9b, 0xaa, 0x6a, 0x41, 0xf0, 0xff, 0x6f, 0x41, 0x52, 0x64, 0x01, 0x00,
+        0xf0, 0xff, 0x6f, 0x41, 0x9a, 0xaa, 0x7a, 0x41, 0x4e, 0x64, 0x01, 0x00, 0x9a, 0xaa, 0x7a, 0x41,
+        0xef, 0xff, 0x7f, 0x41, 0x4f, 0x64, 0x01, 0x00, 0xef, 0xff, 0x7f, 0x41, 0x4c, 0x55, 0x8d, 0x41,
+        0x4c, 0x64, 0x01, 0x00, 0x4c, 0x55, 0x8d, 0x41, 0xf7, 0xff, 0x8f, 0x41, 0x4f, 0x64, 0x01, 0x00,
+        0xf7, 0xff, 0x8f, 0x41, 0x4c, 0x55, 0x95, 0x41, 0x53, 0x64, 0x01, 0x00, 0x4c, 0x55, 0x95, 0x41,
+        0xf6, 0xff, 0x97, 0x41, 0x4f, 0x64, 0x01, 0x00, 0xf6, 0xff, 0x97, 0x41, 0x4b, 0x55, 0x9d, 0x41,
+        0x53, 0x64, 0x01, 0x00, 0x4b, 0x55, 0x9d, 0x41, 0xf6, 0xff, 0x9f, 0x41, 0x4f, 0x64, 0x01, 0x00,
+        0xf6, 0xff, 0x9f, 0x41, 0x4a, 0x55, 0xa5, 0x41, 0x54, 0x64, 0x01, 0x00, 0x4a, 0x55, 0xa5, 0x41,
+        0xf5, 0xff, 0xa7, 0x41, 0x53, 0x64, 0x01, 0x00, 0xf5, 0xff, 0xa7, 0x41, 0x4a, 0x55, 0xad, 0x41,
+        0x52, 0x64, 0x01, 0x00, 0x4a, 0x55, 0xad, 0x41, 0xf4, 0xff, 0xaf, 0x41, 0x4e, 0x64, 0x01, 0x00,
+        0xf4, 0xff, 0xaf, 0x41, 0xf4, 0xff, 0xb3, 0x41, 0x4f, 0x64, 0x01, 0x00, 0xf4, 0xff, 0xb3, 0x41,
+        0x49, 0x55, 0xb5, 0x41, 0x53, 0x64, 0x01, 0x00, 0x49, 0x55, 0xb5, 0x41, 0xf4, 0xff, 0xb7, 0x41,
+        0x52, 0x64, 0x01, 0x00, 0xf4, 0xff, 0xb7, 0x41, 0x49, 0x55, 0xbd, 0x41, 0x46, 0x64, 0x01, 0x00,
+        0x49, 0x55, 0xbd, 0x41, 0xf3, 0xff, 0xbf, 0x41, 0x47, 0x64, 0x01, 0x00, 0xf3, 0xff, 0xbf, 0x41,
+        0x48, 0x55, 0xcd, 0x41, 0x53, 0x64, 0x01, 0x00, 0x48, 0x55, 0xcd, 0x41, 0xf2, 0xff, 0xcf, 0x41,
+        0x4f, 0x64, 0x01, 0x00, 0xf2, 0xff, 0xcf, 0x41, 0x47, 0x55, 0xd5, 0x41, 0x53, 0x64, 0x01, 0x00,
+        0x47, 0x55, 0xd5, 0x41, 0xf2, 0xff, 0xd7, 0x41, 0x4f, 0x64, 0x01, 0x00, 0xf2, 0xff, 0xd7, 0x41,
+        0x47, 0x55, 0xdd, 0x41, 0x53, 0x64, 0x01, 0x00, 0x47, 0x55, 0xdd, 0x41, 0xf1, 0xff, 0xdf, 0x41,
+        0x4f, 0x64, 0x01, 0x00, 0xf1, 0xff, 0xdf, 0x41, 0x46, 0x55, 0xe5, 0x41, 0x56, 0x64, 0x01, 0x00,
+        0x46, 0x55, 0xe5, 0x41, 0xf1, 0xff, 0xe7, 0x41, 0x55, 0x64, 0x01, 0x00, 0xf1, 0xff, 0xe7, 0x41,
+        0x46, 0x55, 0xed, 0x41, 0x54, 0x64, 0x01, 0x00, 0x46, 0x55, 0xed, 0x41, 0xf0, 0xff, 0xef, 0x41,
+        0x50, 0x64, 0x01, 0x00, 0xf0, 0xff, 0xef, 0x41, 0xf0, 0xff, 0xf3, 0x41, 0x54, 0x64, 0x01, 0x00,
+        0xf0, 0xff, 0xf3, 0x41, 0x45, 0x55, 0xf5, 0x41, 0x53, 0x64, 0x01, 0x00, 0x45, 0x55, 0xf5, 0x41,
+        0xf0, 0xff, 0xf7, 0x41, 0x52, 0x64, 0x01, 0x00, 0xf0, 0xff, 0xf7, 0x41, 0x45, 0x55, 0xfd, 0x41,
+        0x4e, 0x64, 0x01, 0x00, 0x45, 0x55, 0xfd, 0x41, 0xef, 0xff, 0xff, 0x41, 0x4f, 0x64, 0x01, 0x00,
+        0xef, 0xff, 0xff, 0x41, 0xa2, 0xaa, 0x06, 0x42, 0x4c, 0x64, 0x01, 0x00, 0x43, 0x61, 0x6e, 0x6f,
+        0x6e, 0x32, 0x41, 0x4d, 0x53, 0x77, 0x65, 0x64, 0x65, 0x6e, 0x54, 0x77, 0x69, 0x6e, 0x6b, 0x6c,
+        0x65, 0x53, 0x75, 0x70, 0x65, 0x72, 0x6d, 0x61, 0x72, 0x69, 0x6f, 0x48, 0x69, 0x74, 0x20, 0x74,
+        0x68, 0x65, 0x20, 0x52, 0x6f, 0x61, 0x64, 0x20, 0x4a, 0x61, 0x63, 0x6b, 0x47, 0x79, 0x6d, 0x6e,
+        0x6f, 0x70, 0x65, 0x64, 0x69, 0x65, 0x20, 0x4e, 0x6f, 0x2e, 0x32, 0x46, 0x75, 0x65, 0x72, 0x20,
+        0x45, 0x6c, 0x69, 0x73, 0x65, 0x4a, 0x61, 0x63, 0x71, 0x75, 0x65, 0x4f, 0x64, 0x65, 0x20, 0x74,
+        0x6f, 0x20, 0x4a, 0x6f, 0x79, 0x48, 0x65, 0x61, 0x72, 0x74, 0x20, 0x6e, 0x20, 0x53, 0x6f, 0x75,
+        0x6c, 0x20, 0x31, 0x48, 0x65, 0x61, 0x72, 0x74, 0x20, 0x6e, 0x20, 0x53, 0x6f, 0x75, 0x6c, 0x20,
+        0x32, 0x43, 0x6f, 0x66, 0x66, 0x69, 0x6e, 0x20, 0x44, 0x61, 0x6e, 0x63, 0x65, 0x57, 0x65, 0x74,
+        0x20, 0x48, 0x61, 0x6e, 0x64, 0x73, 0x53, 0x77, 0x65, 0x64, 0x65, 0x6e, 0x20, 0x20, 0x49, 0x20,
+        0x45, 0x61, 0x73, 0x79, 0x20, 0x49, 0x46, 0x6f, 0x75, 0x72, 0x20, 0x53, 0x65, 0x61, 0x73, 0x6f,
+        0x6e, 0x73, 0x20, 0x53, 0x70, 0x72, 0x69, 0x6e, 0x67, 0x46, 0x6f, 0x75, 0x72, 0x20, 0x53, 0x65,
+        0x61, 0x73, 0x6f, 0x6e, 0x73, 0x20, 0x57, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x47, 0x61, 0x6d, 0x65,
+        0x20, 0x6f, 0x66, 0x20, 0x54, 0x68, 0x72, 0x6f, 0x6e, 0x65, 0x73, 0x4d, 0x69, 0x6e, 0x75, 0x65,
+        0x74, 0x20, 0x69, 0x6e, 0x20, 0x46, 0x20, 0x4d, 0x61, 0x6a, 0x6f, 0x72, 0x42, 0x65, 0x65, 0x74,
+        0x68, 0x6f, 0x76, 0x65, 0x6e, 0x20, 0x37, 0x74, 0x68, 0x20, 0x53, 0x79, 0x6d, 0x70, 0x68, 0x6f,
+        0x6e, 0x79, 0x46, 0x61, 0x69, 0x72, 0x79, 0x20, 0x54, 0x61, 0x69, 0x6c, 0x52, 0x69, 0x76, 0x65,
+        0x72, 0x20, 0x46, 0x6c, 0x6f, 0x77, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x59, 0x6f, 0x75, 0x41, 0x6d,
+        0x65, 0x6c, 0x69, 0x65, 0x20, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x49, 0x6e, 0x20, 0x74, 0x68, 0x65,
+        0x20, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x4c, 0x6f, 0x76, 0x65, 0x49, 0x6d, 0x61,
+        0x67, 0x69, 0x6e, 0x65, 0x54, 0x68, 0x65, 0x20, 0x57, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x54,
+        0x61, 0x6b, 0x65, 0x73, 0x20, 0x49, 0x74, 0x20, 0x41, 0x6c, 0x6c, 0x53, 0x6f, 0x6d, 0x65, 0x77,
+        0x68, 0x65, 0x72, 0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x61,
+        0x69, 0x6e, 0x62, 0x6f, 0x77, 0x50, 0x61, 0x72, 0x61, 0x64, 0x69, 0x73, 0x65, 0x4c, 0x65, 0x74,
+        0x20, 0x48, 0x65, 0x72, 0x20, 0x47, 0x6f, 0x54, 0x61, 0x6b, 0x65, 0x20, 0x4f, 0x6e, 0x20, 0x4d,
+        0x65, 0x48, 0x61, 0x72, 0x72, 0x79, 0x20, 0x50, 0x6f, 0x74, 0x74, 0x65, 0x72, 0x00, 0x00, 0x00
+};
@@ -0,0 +1,198 @@
+// Host tool that replays a script of simulated runtime events and loads through PerfGovernor (see
+// Src/PerfGovernor.h), frame by frame at the refresh rate it picks, and prints every change of the settings.
+// To check the policy without a headset.
+//
+// build: the GovernorSim target of CMakeLists.txt in this directory
+// run:
+//  ./GovernorSim [script]
+//
+// Without a script, a session with a dense passage, a too heavy GPU load and a thermal warning is replayed and
+// checked. The exit code is 1 if a setting differs from what the script expects.
+// A script has one event per line, at a time in seconds, events at the same time in the order given:
+//  <time> rates <Hz>...                  supported refresh rates, before them the rate can't be changed
+//  <time> play | pause
+//  <time> tiles <count>                  tiles on screen
+//  <time> load <cpu ms> <gpu ms>         time a frame takes on the busier CPU thread and on the GPU
+//  <time> thermal cpu|gpu normal|warning|impaired
+//  <time> expect <Hz> <cpu level> <gpu level>   the settings after the update of that frame, e.g. 72 boost boost
+//  <time> end
+// Lines starting with # are comments. The load is the same at every refresh rate, the runtime switches the
+// rate one frame after it was requested.
+
+#include "PerfGovernor.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static const char *defaultScript = R"(# menu, then a song with a dense passage
+0 rates 72 80 90 120
+0 load 3 4
+0 expect 72 powerSavings powerSavings
+10 play
+10 expect 120 sustainedHigh sustainedHigh
+20 tiles 3000
+20 load 6 5
+21 expect 120 boost sustainedHigh
+30 tiles 800
+30 load 4 5
+31 expect 120 sustainedHigh sustainedHigh
+# the GPU gets too slow even at boost, 120 Hz won't do
+40 load 4 7.5
+41 expect 120 sustainedHigh boost
+45 expect 90 sustainedHigh boost
+70 load 4 5
+71 expect 90 sustainedHigh sustainedHigh
+75 expect 120 sustainedHigh sustainedHigh
+# the headset heats up, then cools down again
+80 thermal gpu warning
+81 expect 90 sustainedHigh sustainedLow
+100 thermal gpu impaired
+101 expect 72 sustainedHigh powerSavings
+110 thermal gpu normal
+111 expect 120 sustainedHigh sustainedHigh
+# both levels and the rate drop together once paused for IDLE_DELAY
+130 pause
+132 expect 120 sustainedHigh sustainedHigh
+133.1 expect 72 powerSavings powerSavings
+150 end
+)";
+
+struct Event {
+    double time;
+    std::string line; //the rest of the line after the time
+};
+
+static bool parse(std::istream &in, std::vector<Event> &events) {
+    std::string line;
+    for (int number = 1; std::getline(in, line); number++) {
+        std::istringstream s(line);
+        Event e;
+        if (line.empty() || line[0] == '#')
+            continue;
+        if (!(s >> e.time)) {
+            fprintf(stderr, "line %d: expected a time: %s\n", number, line.c_str());
+            return false;
+        }
+        std::getline(s >> std::ws, e.line);
+        events.push_back(e);
+    }
+    return true;
+}
+
+static Thermal thermalLevel(const std::string &name) {
+    if (name == "warning")
+        return Thermal::warning;
+    if (name == "impaired")
+        return Thermal::impaired;
+    return Thermal::normal;
+}
+
+static bool parseLevel(const std::string &name, PerfLevel &level) {
+    for (size_t i = 0; i < (size_t) PerfLevel::NUM; i++) {
+        if (name == PerfGovernor::name((PerfLevel) i)) {
+            level = (PerfLevel) i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void print(double time, const PerfGovernor &governor) {
+    auto &s = governor.settings();
+    printf("%8.2f  %5.0f Hz  cpu %-13s gpu %-13s (%s)\n", time, s.refreshRate, PerfGovernor::name(s.cpu),
+           PerfGovernor::name(s.gpu), governor.reason());
+}
+
+int main(int argc, char **argv) {
+    std::vector<Event> events;
+    bool parsed;
+    if (argc > 1) {
+        std::ifstream file(argv[1]);
+        if (!file) {
+            fprintf(stderr, "could not open %s\n", argv[1]);
+            return 1;
+        }
+        parsed = parse(file, events);
+    } else {
+        std::istringstream script(defaultScript);
+        parsed = parse(script, events);
+    }
+    if (!parsed || events.empty())
+        return 1;
+
+    //as the app starts: the levels it sets when the session begins, the display at 72 Hz
+    PerfGovernor governor{{72, PerfLevel::sustainedHigh, PerfLevel::boost}};
+    PerfGovernor::Load load{1000 / 72.0f, 0, 0, false, 0};
+    float rate = 72, requested = 72;
+    double end = events.back().time;
+    size_t next = 0;
+    int failed = 0;
+    print(0, governor);
+
+    for (double time = 0; time <= end; time += 1 / rate) {
+        std::vector<const Event *> expected;
+        for (; next < events.size() && events[next].time <= time; next++) {
+            std::istringstream s(events[next].line);
+            std::string event, arg;
+            s >> event;
+            if (event == "expect") {
+                expected.push_back(&events[next]);
+                continue;
+            }
+            printf("%8.2f  %s\n", events[next].time, events[next].line.c_str());
+            if (event == "rates") {
+                std::vector<float> rates;
+                for (float r; s >> r;)
+                    rates.push_back(r);
+                governor.setRefreshRates(rates);
+            } else if (event == "play" || event == "pause") {
+                load.playing = event == "play";
+            } else if (event == "tiles") {
+                s >> load.tiles;
+            } else if (event == "load") {
+                s >> load.cpu >> load.gpu;
+            } else if (event == "thermal") {
+                std::string level;
+                s >> arg >> level;
+                governor.thermal(arg == "gpu" ? PerfDomain::gpu : PerfDomain::cpu, thermalLevel(level));
+            } else if (event != "end") {
+                fprintf(stderr, "unknown event: %s\n", events[next].line.c_str());
+                return 1;
+            }
+        }
+
+        //the runtime switches to the requested rate with the next frame
+        if (requested != rate) {
+            rate = requested;
+            governor.refreshRateChanged(rate);
+        }
+
+        load.budget = 1000 / rate;
+        if (governor.update(time, load)) {
+            print(time, governor);
+            if (governor.settings().refreshRate != 0)
+                requested = governor.settings().refreshRate;
+        }
+
+        for (const Event *e : expected) {
+            std::istringstream s(e->line);
+            std::string event, cpu, gpu;
+            PerfGovernor::Settings want;
+            if (!(s >> event >> want.refreshRate >> cpu >> gpu) || !parseLevel(cpu, want.cpu) || !parseLevel(gpu, want.gpu)) {
+                fprintf(stderr, "bad expectation: %s\n", e->line.c_str());
+                return 1;
+            }
+            if (want != governor.settings()) {
+                printf("%8.2f  expected %s\n", time, e->line.c_str() + event.size() + 1);
+                failed++;
+            }
+        }
+    }
+    if (failed > 0)
+        printf("%d expectations failed\n", failed);
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,142 @@
+// Host tool that replays a hand tracking recording (Src/HandRecording.h) through the app's frame loop, with the
+// real Engine, Piarno and KeyContacts code on top of the null GL backend (headless/NullGl.cpp), and prints the
+// keys the fingertips press and release. It can also write a scripted recording, a finger playing a C major
+// scale from middle C, to check the key contacts without a headset.
+//
+// build: the HandReplay target of CMakeLists.txt in this directory
+// run:
+//  ./HandReplay hands.bin [x y z yaw]     replay a recording, with the piano placed at x/y/z (meters, local space)
+//                                         and turned by yaw (degrees), where it was while recording
+//  ./HandReplay --synthesize scale.bin    write the scripted recording, the piano is at the origin
+//
+// Recordings are written by the app while the system property debug.piarno.record_hands is 1:
+//  adb shell setprop debug.piarno.record_hands 1
+//  adb exec-out run-as com.oculus.sdk.xrpassthrough cat files/hands.bin > hands.bin
+//
+// The app's log output goes to stderr.
+
+#include "Engine.h"
+#include "HandRecording.h"
+#include "headless/NullGl.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+//the keyboard of Piarno::buildPiano, 88 keys with white ones centered on the piano, key 0 is note 9 (offset)
+static const int FIRST_NOTE = 9, WHITE_KEYS = 52;
+static const float WIDTH_WHITE = 0.0236f;
+
+static bool isBlackNote(int note) {
+    int n = note % 12;
+    return n == 1 || n == 3 || n == 6 || n == 8 || n == 10;
+}
+
+static float whiteKeyX(int note) {
+    int white = 0;
+    for (int n = FIRST_NOTE; n < note; n++)
+        white += !isBlackNote(n);
+    return (white - WHITE_KEYS / 2) * WIDTH_WHITE;
+}
+
+static bool synthesize(const char *path) {
+    HandRecorder recorder;
+    if (!recorder.open(path)) {
+        fprintf(stderr, "can't write %s\n", path);
+        return false;
+    }
+
+    static const int scale[] = {60, 62, 64, 65, 67, 69, 71, 72};
+    static const double RATE = 72, NOTE_TIME = 0.5; //down for the first half of a note, up for the second
+    static const float RADIUS = 0.008f, HOVER = 0.03f, DEPTH = 0.01f, FRONT = 0.05f; //meters
+
+    TrackedHand hands[2];
+    hands[0].clear();
+    hands[1].clear();
+    hands[1].active = true;
+
+    int frames = (int) ((std::size(scale) + 1) * NOTE_TIME * RATE);
+    for (int frame = 0; frame < frames; frame++) {
+        double time = 1 + frame / RATE;
+        double t = frame / RATE - NOTE_TIME; //a note of rest first
+        size_t note = (size_t) std::max(0.0, t / NOTE_TIME);
+        bool down = t >= 0 && note < std::size(scale) && fmod(t, NOTE_TIME) < NOTE_TIME / 2;
+        float x = whiteKeyX(scale[std::min(note, std::size(scale) - 1)]);
+
+        //the index finger goes down into the key, the rest of the hand stays well above the keys
+        for (int j = 0; j < XR_HAND_JOINT_COUNT_EXT; j++) {
+            hands[1].joints[j] = OVR::Posef{OVR::Quatf{}, OVR::Vector3f{x, 0.1f, FRONT + 0.05f}};
+            hands[1].radii[j] = 0.01f;
+        }
+        float tip = down ? RADIUS - DEPTH : HOVER;
+        hands[1].joints[XR_HAND_JOINT_INDEX_TIP_EXT].Translation = OVR::Vector3f{x, tip, FRONT};
+        hands[1].radii[XR_HAND_JOINT_INDEX_TIP_EXT] = RADIUS;
+
+        recorder.write(time, hands);
+    }
+    printf("wrote %d frames to %s\n", frames, path);
+    return true;
+}
+
+//hold both triggers with the controllers at the ends of the piano for a frame, as the player places it
+static void placePiano(Engine &engine, Scene &scene, float x, float y, float z, float yaw) {
+    float angle = yaw + M_PI / 2;
+    OVR::Vector3f center{x, y + 0.05f, z}, side{sinf(angle) * 0.3f, 0, cosf(angle) * 0.3f};
+    scene.trackedController[0].active = scene.trackedController[2].active = true;
+    scene.trackedController[0].pose.Translation = center - side;
+    scene.trackedController[2].pose.Translation = center + side;
+    scene.leftTriggerPressed = scene.rightTriggerPressed = XR_TRUE;
+    engine.update(0.5);
+
+    //and put them away
+    scene.leftTriggerPressed = scene.rightTriggerPressed = XR_FALSE;
+    scene.trackedController[0].active = scene.trackedController[2].active = false;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 2 && strcmp(argv[1], "--synthesize") == 0)
+        return synthesize(argv[2]) ? 0 : 1;
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s hands.bin [x y z yaw] | --synthesize out.bin\n", argv[0]);
+        return 1;
+    }
+
+    HandPlayer player;
+    if (!player.open(argv[1])) {
+        fprintf(stderr, "%s is not a hand recording of version %u\n", argv[1], handrec::VERSION);
+        return 1;
+    }
+
+    AppRenderer renderer;
+    renderer.clear();
+    renderer.scene.create();
+    Scene &scene = renderer.scene;
+    Engine engine{&scene};
+
+    if (argc >= 6)
+        placePiano(engine, scene, atof(argv[2]), atof(argv[3]), atof(argv[4]), atof(argv[5]) * M_PI / 180);
+
+    const KeyContacts &keys = global::piarno->getKeyContacts();
+    int offset = global::piarno->keyOffset();
+    size_t frames = 0, presses = 0, releases = 0;
+    double time;
+    while (player.next(time, scene.trackedHand)) {
+        engine.update(time);
+        frames++;
+
+        for (size_t k = 0; k < KeyContacts::MAX_KEYS; k++) {
+            if (keys.isPressed(k)) {
+                printf("%9.3f  press   key %2zu (MIDI %3zu), %.1f mm deep\n", time, k, k + offset, keys.depth(k) * 1000);
+                presses++;
+            }
+            if (keys.isReleased(k)) {
+                printf("%9.3f  release key %2zu (MIDI %3zu)\n", time, k, k + offset);
+                releases++;
+            }
+        }
+    }
+    printf("%zu frames, %zu presses, %zu releases\n", frames, presses, releases);
+    return 0;
+}
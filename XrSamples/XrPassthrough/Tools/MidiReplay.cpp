@@ -0,0 +1,269 @@
+// Host tool that plays MIDI input into the app's frame loop in real time: the real Engine, Piarno and note
+// matching code on top of the null GL backend (headless/NullGl.cpp), with the notes coming through a
+// StreamMidiSource thread and the lock-free MidiInput ring as they do from a keyboard on the headset.
+// Reports how long the notes take to get to a frame, how far their song time is from when they were meant
+// to be played, and how the matcher paired them with the tiles.
+//
+// build: the MidiReplay target of CMakeLists.txt in this directory
+// run:
+//  ./MidiReplay song [source] [--seconds s] [--rate hz] [--late ms] [--jitter ms] [--wrong percent]
+//
+//  song       index in the song list, the song whose tiles are played
+//  source     none: the song's own notes, written into a pipe in real time
+//             a .mid file: its notes, written into a pipe in real time
+//             - or any other path: raw MIDI bytes read as they come, e.g. from a FIFO or an ALSA raw MIDI
+//             device of a keyboard (/dev/snd/midiC1D0, see amidi -l)
+//  --seconds  how much of the song to play, 20 by default
+//  --rate     frames per second of the simulated display, 72 by default
+//  --late, --jitter, --wrong  play the written notes worse: all later by ms, each off by up to +-ms, and
+//             that percentage of them a key too high
+//
+// The app's log output goes to stderr.
+
+#include "Engine.h"
+#include "SongBundle.h"
+#include "midi/MidiFile.h"
+#include "songs/bundle.h"
+#include "headless/NullGl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+static const double LEAD_IN = 3; //song time before the first note (Piarno's waitTimeBegin)
+
+struct Samples {
+    std::vector<double> values;
+
+    void add(double v) {
+        values.push_back(v);
+    }
+
+    double percentile(int p) {
+        if (values.empty())
+            return 0;
+        std::sort(values.begin(), values.end());
+        return values[std::min(values.size() - 1, values.size() * p / 100)];
+    }
+};
+
+//a message to write, at a song time without the lead-in
+struct Message {
+    double time;
+    double intended; //when it should have been played, before --late and --jitter
+    uint8_t bytes[3];
+};
+
+static bool readMidiFile(const char *path, std::vector<Message> &messages) {
+    std::ifstream in(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::vector<smf::SmfEvent> events;
+    if (!in || !smf::MidiFile::readSmfEvents(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), events))
+        return false;
+
+    for (auto &e : events) {
+        int command = e.bytes[0] & 0xf0;
+        if (e.size == 3 && (command == 0x80 || command == 0x90))
+            messages.push_back({e.seconds, e.seconds, {e.bytes[0], e.bytes[1], e.bytes[2]}});
+    }
+    return true;
+}
+
+static void readSong(size_t song, std::vector<Message> &messages) {
+    SongBundle bundle;
+    bundle.open(songBundle, sizeof(songBundle));
+    const bundle::BundleNote *notes = bundle.notes(song);
+    for (size_t i = 0; i < bundle.noteCount(song); i++) {
+        auto &n = notes[i];
+        messages.push_back({n.start, n.start, {0x90, n.key, n.velocity}});
+        messages.push_back({n.end, n.end, {0x80, n.key, 0}});
+    }
+}
+
+//moves and detunes note-ons, a release never comes before its press
+static void playWorse(std::vector<Message> &messages, double late, double jitter, double wrong) {
+    std::mt19937 random(1);
+    std::uniform_real_distribution<double> offset(-jitter, jitter), chance(0, 100);
+    double pressed[128] = {};
+    int8_t shifted[128] = {};
+    std::stable_sort(messages.begin(), messages.end(), [](const Message &a, const Message &b) { return a.time < b.time; });
+    for (auto &m : messages) {
+        uint8_t key = m.bytes[1] & 0x7f;
+        bool press = (m.bytes[0] & 0xf0) == 0x90 && m.bytes[2] > 0;
+        if (press) {
+            m.time = std::max(0.0, m.time + late + offset(random));
+            pressed[key] = m.time;
+            shifted[key] = chance(random) < wrong;
+        } else {
+            m.time = std::max(m.time + late, pressed[key] + 0.001);
+        }
+        m.bytes[1] = std::min(127, key + shifted[key]);
+    }
+    std::stable_sort(messages.begin(), messages.end(), [](const Message &a, const Message &b) { return a.time < b.time; });
+}
+
+//writes the messages at their time after start, with running status like keyboards send them
+static void writeMessages(int fd, const std::vector<Message> &messages, double start, double seconds,
+                          std::vector<double> &writeTimes) {
+    uint8_t status = 0;
+    for (size_t i = 0; i < messages.size(); i++) {
+        auto &m = messages[i];
+        if (m.time > seconds)
+            break;
+        double at = start + LEAD_IN + m.time;
+        while (MidiInput::now() < at)
+            std::this_thread::sleep_for(std::chrono::duration<double>(std::min(at - MidiInput::now(), 0.001)));
+
+        const uint8_t *bytes = m.bytes;
+        size_t size = 3;
+        if (m.bytes[0] == status) {
+            bytes++;
+            size--;
+        }
+        status = m.bytes[0];
+        writeTimes[i] = MidiInput::now(); //read by the main thread once the note came through the pipe
+        if (write(fd, bytes, size) != (ssize_t) size)
+            break;
+    }
+    close(fd);
+}
+
+int main(int argc, char **argv) {
+    const char *sourcePath = nullptr;
+    double seconds = 20, rate = 72, late = 0, jitter = 0, wrong = 0;
+    long song = -1;
+    for (int i = 1; i < argc; i++) {
+        auto option = [&](const char *name, double &value) {
+            if (strcmp(argv[i], name) != 0 || i + 1 >= argc)
+                return false;
+            value = atof(argv[++i]);
+            return true;
+        };
+        if (option("--seconds", seconds) || option("--rate", rate) || option("--late", late) ||
+            option("--jitter", jitter) || option("--wrong", wrong))
+            continue;
+        if (song < 0)
+            song = atol(argv[i]);
+        else
+            sourcePath = argv[i];
+    }
+    if (song < 0) {
+        fprintf(stderr, "usage: %s song [source.mid | - | raw MIDI path] [--seconds s] [--rate hz] [--late ms]"
+                        " [--jitter ms] [--wrong percent]\n", argv[0]);
+        return 1;
+    }
+
+    AppRenderer renderer;
+    renderer.clear();
+    renderer.scene.create();
+    Scene &scene = renderer.scene;
+    Engine engine{&scene};
+    DrawQueue frameQueue;
+    frameQueue.clear();
+    if ((size_t) song >= global::piarno->songCount()) {
+        fprintf(stderr, "there are %zu songs\n", global::piarno->songCount());
+        return 1;
+    }
+    global::piarno->selectSong(song);
+    engine.getClock().resume();
+
+    //notes written by this tool into a pipe, or a stream read as it comes
+    std::vector<Message> messages;
+    bool written = !sourcePath || (strlen(sourcePath) > 4 && !strcmp(sourcePath + strlen(sourcePath) - 4, ".mid"));
+    int fd;
+    if (written) {
+        if (sourcePath && !readMidiFile(sourcePath, messages)) {
+            fprintf(stderr, "can't read %s\n", sourcePath);
+            return 1;
+        }
+        if (!sourcePath)
+            readSong(song, messages);
+        playWorse(messages, late / 1000, jitter / 1000, wrong);
+    }
+    int pipeFds[2];
+    if (written) {
+        if (pipe(pipeFds) != 0)
+            return 1;
+        fd = pipeFds[0];
+    } else {
+        fd = strcmp(sourcePath, "-") == 0 ? 0 : open(sourcePath, O_RDONLY);
+        if (fd < 0) {
+            fprintf(stderr, "can't open %s\n", sourcePath);
+            return 1;
+        }
+    }
+
+    StreamMidiSource source;
+    source.start(fd, scene.midiInput);
+
+    //the first frame is song time 0, the writer starts the lead-in after it
+    double start = MidiInput::now() + 0.1;
+    std::vector<double> writeTimes(messages.size());
+    std::thread writer;
+    if (written)
+        writer = std::thread(writeMessages, pipeFds[1], std::cref(messages), start, seconds, std::ref(writeTimes));
+
+    printf("song %ld (%s), %.0f s at %.0f Hz\n", song, sourcePath ? sourcePath : "its own notes", seconds, rate);
+
+    Samples pipeLatency, frameLatency, timingError; //microseconds
+    size_t notes = 0, presses = 0;
+    auto &clock = engine.getClock();
+    //until the last tile that was played can't be played anymore, so the later ones don't count as missed
+    int frames = (int) ((LEAD_IN + seconds + NoteMatcher::WINDOW) * rate);
+    for (int frame = 0; frame < frames; frame++) {
+        double displayTime = start + frame / rate;
+        while (MidiInput::now() < displayTime)
+            std::this_thread::sleep_for(std::chrono::duration<double>(std::min(displayTime - MidiInput::now(), 0.001)));
+
+        engine.update(displayTime);
+        engine.render();
+        scene.drawQueue.handOff(frameQueue);
+        double updated = MidiInput::now();
+
+        for (auto &note : engine.getPlayedNotes()) {
+            frameLatency.add((updated - note.time) * 1e6);
+            if (written && notes < writeTimes.size()) {
+                pipeLatency.add((note.time - writeTimes[notes]) * 1e6);
+                if (note.isPress())
+                    timingError.add((clock.songTimeAtDisplay(note.time) - LEAD_IN - messages[notes].intended) * 1e6);
+            }
+            notes++;
+            presses += note.isPress();
+        }
+    }
+
+    source.stop();
+    if (writer.joinable())
+        writer.join();
+    if (written)
+        close(pipeFds[0]);
+    else if (fd != 0)
+        close(fd);
+
+    auto report = [](const char *name, Samples &s, double scale, const char *unit) {
+        if (!s.values.empty())
+            printf("%-42s %8.1f %8.1f %8.1f %s\n", name, s.percentile(50) / scale, s.percentile(99) / scale,
+                   s.percentile(100) / scale, unit);
+    };
+    printf("%zu notes (%zu presses), %u dropped\n\n", notes, presses, scene.midiInput.dropped());
+    printf("%-42s %8s %8s %8s\n", "", "p50", "p99", "max");
+    report("write to time stamp (pipe and thread)", pipeLatency, 1, "us");
+    report("time stamp to frame update", frameLatency, 1000, "ms");
+    report("song time of a press - intended", timingError, 1000, "ms");
+
+    auto &matcher = global::piarno->getScore().matcher();
+    printf("\ntiles: %u hit, %u missed, %u extra notes (window +-%.0f ms)\n", matcher.hits, matcher.missed,
+           matcher.extra, NoteMatcher::WINDOW * 1000);
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Host tool that runs the app's frame loop without a headset: the real Engine, Piarno, Object and render list
+// code on top of a null GL backend (headless/NullGl.cpp), with scripted controllers instead of OpenXR input.
+// Plays every bundled song at simulated refresh rates and reports, per frame, the update and record (render)
+// time on the CPU, the heap allocations and the draw calls, to benchmark changes to the per-frame code.
+//
+// build: the PiarnoBench target of CMakeLists.txt in this directory
+// run:
+//  ./PiarnoBench [seconds per song] [refresh rates...]
+//  ./PiarnoBench 60 72 90 120       (the default)
+//
+// The app's log output goes to stderr.
+//
+// Each song is selected like the song list does, then the right controller pushes the play button and the
+// left one moves over the keys and panels. The first frames of a song load it and are not counted.
+
+#include "Engine.h"
+#include "AllocationCounter.h"
+#include "headless/NullGl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static const int WARMUP_FRAMES = 30;
+
+struct Samples {
+    std::vector<float> values;
+
+    void add(float v) {
+        values.push_back(v);
+    }
+
+    float percentile(int p) {
+        if (values.empty())
+            return 0;
+        std::sort(values.begin(), values.end());
+        return values[std::min(values.size() - 1, values.size() * p / 100)];
+    }
+
+    float mean() const {
+        double sum = 0;
+        for (auto v : values)
+            sum += v;
+        return values.empty() ? 0 : sum / values.size();
+    }
+};
+
+struct Result {
+    Samples update, record, draw; //microseconds
+    Samples allocations, draws, instances, uploadedBytes; //per frame
+    uint64_t allocatingFrames = 0;
+};
+
+static float microseconds(Clock::time_point from, Clock::time_point to) {
+    return std::chrono::duration<float, std::micro>(to - from).count();
+}
+
+//the piano scene is at the origin, so positions are in the piano's frame
+static void scriptControllers(Scene &scene, int frame, double time) {
+    auto &left = scene.trackedController[0];
+    auto &right = scene.trackedController[2];
+    left.active = right.active = true;
+
+    //push the play button for a few frames, then stay away from the panels
+    bool pushing = WARMUP_FRAMES <= frame && frame < WARMUP_FRAMES + 10;
+    right.pose.Translation = pushing ? OVR::Vector3f{-0.3f, 0.0f, 0.2f} : OVR::Vector3f{0.0f, 0.5f, 0.5f};
+
+    //sweep over the keys and the control panels
+    left.pose.Translation = OVR::Vector3f{(float) sin(time * 0.7) * 0.6f, 0.03f, (float) cos(time * 0.3) * 0.2f + 0.1f};
+}
+
+static void runSong(Engine &engine, AppRenderer &renderer, DrawQueue &frameQueue, size_t song, double rate,
+                    double seconds, Result &result) {
+    Scene &scene = renderer.scene;
+    global::piarno->selectSong(song);
+
+    static double displayTime = 1; //keeps increasing over all songs, as the display time does
+    int frames = WARMUP_FRAMES + (int) (seconds * rate);
+    for (int frame = 0; frame < frames; frame++) {
+        displayTime += 1 / rate;
+        scriptControllers(scene, frame, displayTime);
+
+        uint64_t allocationsBefore = allocations::count();
+        auto start = Clock::now();
+        engine.update(displayTime);
+        auto updated = Clock::now();
+        engine.render();
+        scene.drawQueue.handOff(frameQueue);
+        auto recorded = Clock::now();
+        uint64_t allocated = allocations::count() - allocationsBefore;
+
+        //what the render thread does, without a framebuffer
+        nullgl::reset();
+        scene.streamBuffer.beginFrame(frameQueue.staging.size());
+        renderer.drawList(frameQueue);
+        scene.streamBuffer.endFrame();
+        auto drawn = Clock::now();
+
+        if (frame == WARMUP_FRAMES + 10 && engine.getClock().isPaused())
+            fprintf(stderr, "song %zu: the scripted play button push did not start playback\n", song);
+        if (frame < WARMUP_FRAMES)
+            continue;
+
+        result.update.add(microseconds(start, updated));
+        result.record.add(microseconds(updated, recorded));
+        result.draw.add(microseconds(recorded, drawn));
+        result.allocations.add(allocated);
+        result.allocatingFrames += allocated > 0;
+        result.draws.add(nullgl::counters().draws);
+        result.instances.add(nullgl::counters().instances);
+        result.uploadedBytes.add(nullgl::counters().bufferBytes);
+    }
+}
+
+static void report(const char *name, Result &r) {
+    printf("%-28s %7zu | %6.1f %6.1f %7.1f | %6.1f %6.1f %7.1f | %6.1f %6.1f | %7zu %5.1f | %5.1f %5.0f %6.0f %8.0f\n",
+           name, r.update.values.size(),
+           r.update.percentile(50), r.update.percentile(99), r.update.percentile(100),
+           r.record.percentile(50), r.record.percentile(99), r.record.percentile(100),
+           r.draw.percentile(50), r.draw.percentile(99),
+           (size_t) r.allocatingFrames, r.allocations.percentile(100),
+           r.draws.mean(), r.draws.percentile(100), r.instances.mean(), r.uploadedBytes.mean());
+}
+
+int main(int argc, char **argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : 60;
+    std::vector<double> rates;
+    for (int i = 2; i < argc; i++)
+        rates.push_back(atof(argv[i]));
+    if (rates.empty())
+        rates = {72, 90, 120};
+
+    AppRenderer renderer;
+    renderer.clear();
+    renderer.scene.create();
+    Engine engine{&renderer.scene};
+    DrawQueue frameQueue;
+    frameQueue.clear();
+
+    size_t songs = global::piarno->songCount();
+    printf("%zu songs, %.0f s each (after %d warm-up frames), times in microseconds\n\n", songs, seconds, WARMUP_FRAMES);
+    printf("%-28s %7s | %-22s | %-22s | %-13s | %-13s | %s\n", "", "frames", "update p50/p99/max",
+           "record p50/p99/max", "draw p50/p99", "alloc frames/max", "draws mean/max, instances, bytes");
+
+    for (double rate : rates) {
+        Result total;
+        for (size_t song = 0; song < songs; song++) {
+            Result result;
+            runSong(engine, renderer, frameQueue, song, rate, seconds, result);
+
+            char name[64];
+            snprintf(name, sizeof(name), "%.0f Hz song %zu", rate, song);
+            report(name, result);
+
+            for (Samples Result::*s : {&Result::update, &Result::record, &Result::draw, &Result::allocations,
+                            &Result::draws, &Result::instances, &Result::uploadedBytes}) {
+                auto &from = (result.*s).values, &to = (total.*s).values;
+                to.insert(to.end(), from.begin(), from.end());
+            }
+            total.allocatingFrames += result.allocatingFrames;
+        }
+
+        char name[64];
+        snprintf(name, sizeof(name), "%.0f Hz all songs", rate);
+        report(name, total);
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,275 @@
+// Host tool that scores a recorded session again, without the app: the input records of a session log
+// (Src/SessionLog.h) are fed to ScoreKeeper in order, over the tiles built from the song bundle as
+// Piarno::createTiles builds them. Scoring is deterministic, so every pass has to give the same result, and
+// if the app wrote the log its scored records have to come out again. Reports the score and the time per note.
+// Also writes logs of a song played with a given timing, to benchmark without a headset.
+//
+// build: the ScoreBench target of CMakeLists.txt in this directory
+// run:
+//  ./ScoreBench session.bin [--passes n]
+//  ./ScoreBench --synthesize song session.bin [--seconds s] [--late ms] [--jitter ms] [--wrong percent] [--tempo ratio]
+//
+//  session.bin   a log written by the app (adb pull of <internal data>/session.bin) or by --synthesize
+//  --passes      how often the log is scored for the timing, 20 by default
+//  --synthesize  write a log of the song's own notes: the first --seconds of it (all by default), all later
+//                by ms, each off by up to +-ms, that percentage of them a key too high, played at --tempo
+//                times the song's speed
+
+#include "ScoreKeeper.h"
+#include "SongBundle.h"
+#include "songs/bundle.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace session;
+
+static const float LEAD_IN = 3; //song time before the first note (Piarno's waitTimeBegin)
+static const int NUM_KEYS = 88, KEY_OFFSET = 9; //Piarno's piano: key 0 is MIDI key 9
+
+//the tiles of a song and the track of each tile, as Piarno::createTiles has them
+static void buildTiles(const SongBundle &songs, size_t song, TileStore &tiles, std::vector<uint8_t> &tracks) {
+    tiles.clear();
+    tracks.clear();
+    std::vector<uint16_t> seenTracks;
+    const bundle::BundleNote *notes = songs.notes(song);
+    for (size_t i = 0; i < songs.noteCount(song); i++) {
+        auto &n = notes[i];
+        int key = n.key - KEY_OFFSET;
+        if (key < 0 || key >= NUM_KEYS)
+            continue;
+
+        auto it = std::find(seenTracks.begin(), seenTracks.end(), n.track);
+        if (it == seenTracks.end())
+            it = seenTracks.insert(it, n.track);
+        tracks.push_back(std::min<size_t>(it - seenTracks.begin(), 255));
+        tiles.add(n.start + LEAD_IN, n.end + LEAD_IN, key, 0, 0, 0, 0, 255);
+    }
+}
+
+static int synthesize(const SongBundle &songs, size_t song, const char *path, double seconds, double late,
+                      double jitter, double wrong, double tempo) {
+    TileStore tiles;
+    std::vector<uint8_t> tracks;
+    buildTiles(songs, song, tiles, tracks);
+
+    //played at tempo times the speed of the song from the first note on, a release never comes before its press
+    std::mt19937 random(1);
+    std::uniform_real_distribution<double> offset(-jitter, jitter), chance(0, 100);
+    std::vector<SessionRecord> input;
+    for (size_t i = 0; i < tiles.size(); i++) {
+        if (tiles.start[i] - LEAD_IN > seconds)
+            break;
+        int key = std::min(NUM_KEYS - 1, tiles.key[i] + (chance(random) < wrong));
+        float press = LEAD_IN + (tiles.start[i] - LEAD_IN) / tempo + late + offset(random);
+        float release = std::max(LEAD_IN + (tiles.end[i] - LEAD_IN) / tempo + late, press + 0.001);
+        input.push_back({Kind::press, (uint8_t) key, 0, -1, press, 0});
+        input.push_back({Kind::release, (uint8_t) key, 0, -1, release, 0});
+    }
+    std::stable_sort(input.begin(), input.end(), [](const SessionRecord &a, const SessionRecord &b) {
+        return a.time < b.time;
+    });
+
+    SessionLog log;
+    if (!log.open(path)) {
+        fprintf(stderr, "can't write %s\n", path);
+        return 1;
+    }
+    log.write({Kind::song, 0, 0, (int32_t) song, 0, 0});
+    for (auto &r : input)
+        log.write(r);
+    printf("%s: song %zu (%s), %zu notes\n", path, song, songs.name(song).c_str(), input.size() / 2);
+    return 0;
+}
+
+//feeds the input records to the score, advancing it to each one as the frames would
+static void score(const SongBundle &songs, const std::vector<SessionRecord> &input, float end, ScoreKeeper &keeper,
+                  TileStore &tiles, std::vector<uint8_t> &tracks) {
+    for (auto &r : input) {
+        switch (r.kind) {
+            case Kind::song:
+                buildTiles(songs, r.index, tiles, tracks);
+                keeper.setSong(tiles, tracks, NUM_KEYS, r.index);
+                break;
+            case Kind::press:
+                keeper.advance(r.time);
+                keeper.press(r.key, r.time);
+                break;
+            case Kind::release:
+                keeper.advance(r.time);
+                keeper.release(r.key, r.time);
+                break;
+            case Kind::seek:
+                keeper.seek(r.time);
+                break;
+            default:
+                break;
+        }
+    }
+    keeper.advance(end);
+}
+
+static bool sameRecord(const SessionRecord &a, const SessionRecord &b) {
+    return a.kind == b.kind && a.key == b.key && a.index == b.index && a.time == b.time && a.value == b.value;
+}
+
+//the scored records of a log, missed tiles apart: the frames they were found in depend on the frame rate
+static void scoredRecords(const std::vector<SessionRecord> &records, std::vector<SessionRecord> &scored,
+                          std::vector<int32_t> &missed) {
+    for (auto &r : records) {
+        if (r.kind == Kind::missed)
+            missed.push_back(r.index);
+        else if (!isInput(r.kind))
+            scored.push_back(r);
+    }
+    std::sort(missed.begin(), missed.end());
+}
+
+static void printAccuracy(const char *name, const ScoreKeeper::Accuracy &a) {
+    printf("%-10s %6u %6u %6u %7.1f%% %8.1f %8.1f %8.1f\n", name, a.hits, a.missed, a.extra, a.accuracy() * 100,
+           a.meanOnsetError() * 1000, a.meanAbsOnsetError() * 1000, a.meanAbsOffsetError() * 1000);
+}
+
+int main(int argc, char **argv) {
+    const char *path = nullptr;
+    long song = -1;
+    double passes = 20, seconds = 1e9, late = 0, jitter = 0, wrong = 0, tempo = 1;
+    bool synthesizing = false;
+    for (int i = 1; i < argc; i++) {
+        auto option = [&](const char *name, double &value) {
+            if (strcmp(argv[i], name) != 0 || i + 1 >= argc)
+                return false;
+            value = atof(argv[++i]);
+            return true;
+        };
+        if (option("--passes", passes) || option("--seconds", seconds) || option("--late", late) ||
+            option("--jitter", jitter) || option("--wrong", wrong) || option("--tempo", tempo))
+            continue;
+        if (strcmp(argv[i], "--synthesize") == 0 && i + 1 < argc) {
+            synthesizing = true;
+            song = atol(argv[++i]);
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path || (synthesizing && (song < 0 || tempo <= 0))) {
+        fprintf(stderr, "usage: %s session.bin [--passes n]\n"
+                        "       %s --synthesize song session.bin [--seconds s] [--late ms] [--jitter ms]"
+                        " [--wrong percent] [--tempo ratio]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    SongBundle songs;
+    songs.open(songBundle, sizeof(songBundle));
+    if (synthesizing) {
+        if ((size_t) song >= songs.size()) {
+            fprintf(stderr, "there are %zu songs\n", songs.size());
+            return 1;
+        }
+        return synthesize(songs, song, path, seconds, late / 1000, jitter / 1000, wrong, tempo);
+    }
+
+    SessionReader reader;
+    if (!reader.open(path)) {
+        fprintf(stderr, "%s is not a session log\n", path);
+        return 1;
+    }
+    std::vector<SessionRecord> records, input;
+    SessionRecord record;
+    float end = 0;
+    while (reader.next(record)) {
+        if (record.kind == Kind::song && record.index >= (int32_t) songs.size()) {
+            fprintf(stderr, "the log plays song %d, there are %zu songs\n", record.index, songs.size());
+            return 1;
+        }
+        records.push_back(record);
+        if (isInput(record.kind))
+            input.push_back(record);
+        end = std::max(end, record.time);
+    }
+    size_t notes = std::count_if(input.begin(), input.end(), [](const SessionRecord &r) {
+        return r.kind == Kind::press || r.kind == Kind::release;
+    });
+    if (input.empty() || input.front().kind != Kind::song) {
+        fprintf(stderr, "%s doesn't start with a song\n", path);
+        return 1;
+    }
+
+    //once more with a log, to compare the scored records with the ones in the log
+    char rescoredPath[] = "/tmp/ScoreBenchXXXXXX";
+    int fd = mkstemp(rescoredPath);
+    if (fd < 0)
+        return 1;
+    close(fd);
+    TileStore tiles;
+    std::vector<uint8_t> tracks;
+    ScoreKeeper checked;
+    SessionLog rescoredLog;
+    rescoredLog.open(rescoredPath);
+    checked.setLog(&rescoredLog);
+    score(songs, input, end, checked, tiles, tracks);
+    rescoredLog.close();
+
+    std::vector<SessionRecord> rescored;
+    reader.open(rescoredPath);
+    while (reader.next(record))
+        rescored.push_back(record);
+    reader.close();
+    remove(rescoredPath);
+
+    //all passes have to end with the same score
+    ScoreKeeper keeper;
+    double elapsed = 0;
+    bool deterministic = true;
+    for (int pass = 0; pass < (int) passes; pass++) {
+        keeper = {};
+        auto start = std::chrono::steady_clock::now();
+        score(songs, input, end, keeper, tiles, tracks);
+        elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        auto &a = keeper.total(), &b = checked.total();
+        deterministic &= a.hits == b.hits && a.missed == b.missed && a.extra == b.extra && a.releases == b.releases &&
+                         a.onsetError == b.onsetError && a.absOffsetError == b.absOffsetError &&
+                         keeper.tempo() == checked.tempo();
+    }
+
+    printf("%s: song %d (%s), %zu input records, %zu notes, %.1f s\n\n", path, input.front().index,
+           songs.name(input.front().index).c_str(), input.size(), notes, end);
+    printf("%-10s %6s %6s %6s %8s %8s %8s %8s\n", "", "hit", "missed", "extra", "accuracy", "onset", "|onset|",
+           "|offset|");
+    printAccuracy("song", checked.total());
+    printAccuracy("left hand", checked.hand(ScoreKeeper::LEFT));
+    printAccuracy("right hand", checked.hand(ScoreKeeper::RIGHT));
+    auto &sections = checked.sections();
+    for (size_t s = 0; s < sections.size(); s++) {
+        if (sections[s].hits + sections[s].missed + sections[s].extra == 0)
+            continue;
+        std::string name = std::to_string((int) (s * ScoreKeeper::SECTION_LENGTH)) + " s";
+        printAccuracy(name.c_str(), sections[s]);
+    }
+    printf("(errors in ms, late is positive)\n\ntempo: %.3f of the song's\n", checked.tempo());
+
+    std::vector<SessionRecord> logScored, ownScored;
+    std::vector<int32_t> logMissed, ownMissed;
+    scoredRecords(records, logScored, logMissed);
+    scoredRecords(rescored, ownScored, ownMissed);
+    if (logScored.empty() && logMissed.empty()) {
+        printf("the log has no scored records to compare with\n");
+    } else {
+        bool same = logScored.size() == ownScored.size() && logMissed == ownMissed &&
+                    std::equal(logScored.begin(), logScored.end(), ownScored.begin(), sameRecord);
+        printf("scored records: %s the log's\n", same ? "same as" : "DIFFERENT from");
+        deterministic &= same;
+    }
+
+    printf("%d passes: %s, %.1f ns per note\n", (int) passes, deterministic ? "deterministic" : "NOT DETERMINISTIC",
+           passes < 1 || notes == 0 ? 0 : elapsed / (int) passes / notes * 1e9);
+    return deterministic ? 0 : 2;
+}
@@ -0,0 +1,373 @@
+// Host tool that pre-parses all songs into the binary bundle read by SongBundle (see Src/SongBundle.h).
+//
+// build: the SongBundler target of CMakeLists.txt in this directory
+// run (from Src):
+//  ../Tools/build/SongBundler songs/songs.txt songs/bundle.h [songs.bin]
+//  ../Tools/build/SongBundler songs/songs.txt --benchmark [passes]
+//
+// The .h output is embedded into the app, the optional .bin output is the same bundle as a raw file.
+// --benchmark compares MidiFile::readSmfEvents with the stream parser (MidiFile::readSmf) on all songs,
+// the join/time analysis/note linking passes of MidiFile with the compact MidiEventArray, and the
+// k-way merge in MidiFile::joinTracks with sorting all events.
+
+#include "SongBundle.h"
+#include "midi/MidiEventArray.h"
+#include "midi/MidiFile.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace bundle;
+
+struct Song {
+    std::string title;
+    std::vector<BundleNote> notes;
+    double duration;
+};
+
+static std::string directoryOf(const std::string &path) {
+    auto slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? "" : path.substr(0, slash + 1);
+}
+
+//reads a .mid file, or the byte array of a C header ("static const char bytes[] = {0x4d, ...};")
+static bool readSource(const std::string &path, std::string &bytes) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    if (path.size() >= 4 && path.compare(path.size() - 4, 4, ".mid") == 0) {
+        bytes = std::move(content);
+        return true;
+    }
+
+    auto begin = content.find('{'), end = content.rfind('}');
+    if (begin == std::string::npos || end == std::string::npos || end < begin)
+        return false;
+
+    bytes.clear();
+    const char *p = content.c_str() + begin + 1, *last = content.c_str() + end;
+    while (p < last) {
+        if (isdigit((unsigned char) *p)) {
+            char *next;
+            bytes.push_back((char) strtol(p, &next, 0));
+            p = next;
+        } else {
+            p++;
+        }
+    }
+    return true;
+}
+
+//pairs note-ons with note-offs the same way Piarno did when it parsed MIDI at runtime:
+//a release ends the latest press of that key, presses that are never released are dropped
+template<typename Events>
+static void pairNotes(const Events &events, Song &song) {
+    std::vector<long> pressed(128, -1); //index of the unreleased note per key
+    std::vector<bool> released;
+    song.notes.clear();
+    for (auto &e: events) {
+        if (e.size < 3)
+            continue;
+
+        int command = e.bytes[0], key = e.bytes[1] & 0x7f, velocity = e.bytes[2];
+        if (command == 0x90 && velocity > 0) {
+            pressed[key] = song.notes.size();
+            song.notes.push_back({(float) e.seconds, 0, (uint8_t) key, (uint8_t) velocity, 0});
+            released.push_back(false);
+        } else if ((command == 0x80 || command == 0x90) && pressed[key] != -1) {
+            auto &n = song.notes[pressed[key]];
+            n.end = (float) e.seconds;
+            n.track = (uint16_t) e.track;
+            released[pressed[key]] = true;
+            pressed[key] = -1;
+        }
+    }
+
+    //notes are in press order, so they stay sorted by start
+    size_t k = 0;
+    for (size_t i = 0; i < song.notes.size(); i++) {
+        if (released[i])
+            song.notes[k++] = song.notes[i];
+    }
+    song.notes.resize(k);
+}
+
+static bool parseSong(const std::string &bytes, Song &song, std::vector<smf::SmfEvent> &events) {
+    if (!smf::MidiFile::readSmfEvents(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), events))
+        return false;
+    pairNotes(events, song);
+    song.duration = events.empty() ? 0 : events.back().seconds;
+    return true;
+}
+
+//the same through the stream parser (MidiFile::readSmf), only used to check and benchmark parseSong
+static bool parseSongStream(const std::string &bytes, Song &song) {
+    std::istringstream file(bytes);
+    smf::MidiFile midi(file);
+    if (!midi.status())
+        return false;
+    midi.joinTracks();
+    midi.doTimeAnalysis();
+
+    struct Event {
+        uint8_t bytes[3];
+        int size, track;
+        double seconds;
+    };
+    std::vector<Event> events;
+    for (int i = 0; i < midi[0].size(); i++) {
+        auto &e = midi[0][i];
+        Event event{{0, 0, 0}, (int) e.size(), e.track, e.seconds};
+        for (int j = 0; j < 3 && j < event.size; j++)
+            event.bytes[j] = e[j];
+        events.push_back(event);
+    }
+    pairNotes(events, song);
+    song.duration = midi.getFileDurationInSeconds();
+    return true;
+}
+
+static bool sameNotes(const Song &a, const Song &b) {
+    return a.duration == b.duration && a.notes.size() == b.notes.size() &&
+           (a.notes.empty() || memcmp(a.notes.data(), b.notes.data(), a.notes.size() * sizeof(BundleNote)) == 0);
+}
+
+//parses every song with both parsers, checks they agree and prints the time per pass over all songs
+static int benchmark(const std::vector<std::string> &sources, int passes) {
+    std::vector<smf::SmfEvent> events;
+    for (auto &bytes: sources) {
+        Song a, b;
+        if (!parseSong(bytes, a, events) || !parseSongStream(bytes, b) || !sameNotes(a, b)) {
+            std::cerr << "parsers disagree\n";
+            return 1;
+        }
+    }
+
+    auto measure = [&](auto parse) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < passes; i++) {
+            for (auto &bytes: sources) {
+                Song song;
+                parse(bytes, song);
+            }
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / passes;
+    };
+    double stream = measure([](const std::string &bytes, Song &song) { parseSongStream(bytes, song); });
+    double span = measure([&](const std::string &bytes, Song &song) { parseSong(bytes, song, events); });
+
+    std::cout << sources.size() << " songs, " << passes << " passes\n";
+    std::cout << "stream parser: " << stream << " ms per pass\n";
+    std::cout << "span parser:   " << span << " ms per pass (" << stream / span << "x)\n";
+
+    //passes over already read files: MidiEventList (pointer per event) vs MidiEventArray (contiguous)
+    std::vector<smf::MidiFile> files(sources.size());
+    smf::MidiEventArray array;
+    for (size_t i = 0; i < sources.size(); i++) {
+        std::istringstream file(sources[i]);
+        files[i].read(file);
+
+        smf::MidiFile joined = files[i];
+        joined.joinTracks();
+        joined.doTimeAnalysis();
+        array.joinTracks(files[i]);
+        if (array.size() != joined[0].size()) {
+            std::cerr << "event storages disagree\n";
+            return 1;
+        }
+        for (int j = 0; j < array.size(); j++) {
+            auto &e = joined[0][j];
+            if (array[j].tick != e.tick || array[j].track != e.track || array[j].seconds != e.seconds ||
+                array[j].size != (int) e.size() || memcmp(array.getMessage(j), e.data(), e.size()) != 0) {
+                std::cerr << "event storages disagree\n";
+                return 1;
+            }
+        }
+    }
+
+    //the same work on both, the list passes change the file and splitTracks puts it back outside of the times
+    double list = 0, compact = 0;
+    for (int i = 0; i < passes; i++) {
+        for (auto &file: files) {
+            auto start = std::chrono::steady_clock::now();
+            array.joinTracks(file);
+            array.linkNotePairs();
+            auto middle = std::chrono::steady_clock::now();
+            file.joinTracks();
+            file.doTimeAnalysis();
+            file.linkNotePairs();
+            auto end = std::chrono::steady_clock::now();
+            file.splitTracks();
+            compact += std::chrono::duration<double, std::milli>(middle - start).count();
+            list += std::chrono::duration<double, std::milli>(end - middle).count();
+        }
+    }
+    list /= passes;
+    compact /= passes;
+    std::cout << "MidiEventList join/time/link: " << list << " ms per pass\n";
+    std::cout << "MidiEventArray join/time/link: " << compact << " ms per pass (" << list / compact << "x)\n";
+
+    //joinTracks merges the sorted tracks, before it appended them and sorted everything with eventcompare
+    double merge = 0, sort = 0;
+    for (int i = 0; i < passes; i++) {
+        for (auto &file: files) {
+            smf::MidiEventList sorted;
+            auto start = std::chrono::steady_clock::now();
+            for (int t = 0; t < file.getTrackCount(); t++) {
+                for (int j = 0; j < file[t].size(); j++)
+                    sorted.push_back_no_copy(&file[t][j]);
+            }
+            qsort(sorted.data(), sorted.size(), sizeof(smf::MidiEvent*), smf::eventcompare);
+            auto middle = std::chrono::steady_clock::now();
+            file.joinTracks();
+            auto end = std::chrono::steady_clock::now();
+            sort += std::chrono::duration<double, std::milli>(middle - start).count();
+            merge += std::chrono::duration<double, std::milli>(end - middle).count();
+
+            bool same = sorted.size() == file[0].size();
+            for (int j = 0; same && j < sorted.size(); j++)
+                same = &sorted[j] == &file[0][j];
+            sorted.detach(); //the events belong to the file
+            file.splitTracks();
+            if (!same) {
+                std::cerr << "joinTracks order differs from sorting\n";
+                return 1;
+            }
+        }
+    }
+    std::cout << "joinTracks with sort:  " << sort / passes << " ms per pass\n";
+    std::cout << "joinTracks with merge: " << merge / passes << " ms per pass (" << sort / merge << "x)\n";
+    return 0;
+}
+
+static std::vector<uint8_t> buildBundle(const std::vector<Song> &songs) {
+    size_t notesOffset = sizeof(BundleHeader) + songs.size() * sizeof(BundleSong);
+    size_t namesOffset = notesOffset;
+    for (auto &s: songs)
+        namesOffset += s.notes.size() * sizeof(BundleNote);
+    size_t size = namesOffset;
+    for (auto &s: songs)
+        size += s.title.size();
+    size = (size + 7) & ~size_t(7);
+
+    std::vector<uint8_t> data(size, 0);
+    BundleHeader header{MAGIC, VERSION, (uint32_t) songs.size(), (uint32_t) size};
+    memcpy(data.data(), &header, sizeof(header));
+
+    for (size_t i = 0; i < songs.size(); i++) {
+        auto &s = songs[i];
+        BundleSong entry{(uint32_t) namesOffset, (uint32_t) s.title.size(),
+                         (uint32_t) notesOffset, (uint32_t) s.notes.size(),
+                         (float) s.duration, 0};
+        memcpy(data.data() + sizeof(BundleHeader) + i * sizeof(BundleSong), &entry, sizeof(entry));
+
+        if (!s.notes.empty())
+            memcpy(data.data() + notesOffset, s.notes.data(), s.notes.size() * sizeof(BundleNote));
+        memcpy(data.data() + namesOffset, s.title.data(), s.title.size());
+        notesOffset += s.notes.size() * sizeof(BundleNote);
+        namesOffset += s.title.size();
+    }
+    return data;
+}
+
+static bool writeHeader(const std::string &path, const std::vector<uint8_t> &data, const std::string &command) {
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    out << "//\n// File automatically generated by SongBundler from command line:\n//  " << command << "\n//\n\n";
+    out << "// array size is " << data.size() << "\n";
+    out << "alignas(8) static const unsigned char songBundle[] = {";
+    char hex[8];
+    for (size_t i = 0; i < data.size(); i++) {
+        snprintf(hex, sizeof(hex), "0x%02x", data[i]);
+        out << (i % 16 == 0 ? "\n        " : " ") << hex << (i + 1 < data.size() ? "," : "");
+    }
+    out << "\n};\n";
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        std::cerr << "usage: SongBundler <songs.txt> <bundle.h> [bundle.bin]\n"
+                     "       SongBundler <songs.txt> --benchmark [passes]\n";
+        return 1;
+    }
+
+    std::ifstream manifest(argv[1]);
+    if (!manifest) {
+        std::cerr << "can't open " << argv[1] << "\n";
+        return 1;
+    }
+
+    bool benchmarking = std::string(argv[2]) == "--benchmark";
+    std::vector<std::string> sources;
+    std::vector<smf::SmfEvent> events;
+    std::vector<Song> songs;
+    std::string line;
+    while (std::getline(manifest, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        auto space = line.find(' ');
+        if (space == std::string::npos) {
+            std::cerr << "missing title: " << line << "\n";
+            return 1;
+        }
+
+        std::string source = directoryOf(argv[1]) + line.substr(0, space), bytes;
+        Song song;
+        song.title = line.substr(space + 1);
+        if (!readSource(source, bytes) || (!benchmarking && !parseSong(bytes, song, events))) {
+            std::cerr << "can't read " << source << "\n";
+            return 1;
+        }
+        if (benchmarking) {
+            sources.push_back(std::move(bytes));
+            continue;
+        }
+        std::cout << song.title << ": " << song.notes.size() << " notes, " << song.duration << " s\n";
+        songs.push_back(std::move(song));
+    }
+
+    if (benchmarking)
+        return benchmark(sources, argc > 3 ? std::max(1, atoi(argv[3])) : 20);
+
+    auto data = buildBundle(songs);
+
+    std::string command = "SongBundler";
+    for (int i = 1; i < argc; i++)
+        command += std::string(" ") + argv[i];
+    if (!writeHeader(argv[2], data, command)) {
+        std::cerr << "can't write " << argv[2] << "\n";
+        return 1;
+    }
+
+    if (argc > 3) {
+        std::ofstream bin(argv[3], std::ios::binary);
+        bin.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    //make sure the result can be read back
+    SongBundle check;
+    if (!check.open(data.data(), data.size()) || check.size() != songs.size()) {
+        std::cerr << "bundle validation failed\n";
+        return 1;
+    }
+
+    std::cout << songs.size() << " songs, " << data.size() << " bytes\n";
+    return 0;
+}
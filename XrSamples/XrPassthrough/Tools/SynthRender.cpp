@@ -0,0 +1,263 @@
+// Host tool that renders a song with the app's synthesizer into a WAV file, without an audio device: the main
+// thread's frames hand the playback clock to the Synth as Engine::update does, and render() is called in blocks
+// the way the audio callback is, ahead of when they are heard. Reports how fast the voices are mixed, and checks
+// every song note against the clock: that it started once, on the output frame the clock puts it on. The exit
+// code is 2 if a note is missing, extra or off by more than 1 ms, or the clock is sent again at the song's end.
+//
+// build: the SynthRender target of CMakeLists.txt in this directory
+// run:
+//  ./SynthRender song out.wav [--seconds s] [--rate hz] [--block frames] [--speed x] [--pause at seconds]
+//                [--seek at songTime] [--voices n] [--samples directory]
+//
+//  song       index in the song list
+//  --seconds  how long to render, 30 by default
+//  --rate     output frames per second, 48000 by default
+//  --block    frames per callback, 192 by default (the burst of the headset's low latency output)
+//  --speed    playback speed
+//  --pause    pause the song at a time (seconds from the start of the render) for some seconds
+//  --seek     jump to a song time at a time
+//  --voices   also hold that many keys, struck again every second, to mix with all voices busy
+//  --samples  <MIDI key>.ogg files to play from, the generated samples by default
+
+#include "Synth.h"
+#include "PlaybackClock.h"
+#include "SongBundle.h"
+#include "songs/bundle.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static const double LEAD_IN = 3; //song time before the first note (Piarno's waitTimeBegin)
+static const double FRAME_RATE = 72; //of the display
+static const double PREDICTION = 0.03; //a frame is updated this long before its display time
+static const int QUEUED_BLOCKS = 2; //a block is rendered this many blocks before it is heard
+
+//the clock of a display frame, as the Synth got it
+struct Frame {
+    double time, songTime, speed;
+};
+
+static bool writeWav(const char *path, const std::vector<float> &samples, int rate) {
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return false;
+    uint32_t dataSize = samples.size() * 2, channels = Synth::CHANNELS;
+    auto u32 = [&](uint32_t v) { fwrite(&v, 4, 1, file); };
+    auto u16 = [&](uint16_t v) { fwrite(&v, 2, 1, file); };
+    fwrite("RIFF", 4, 1, file);
+    u32(36 + dataSize);
+    fwrite("WAVEfmt ", 8, 1, file);
+    u32(16);
+    u16(1); //PCM
+    u16(channels);
+    u32(rate);
+    u32(rate * channels * 2);
+    u16(channels * 2);
+    u16(16);
+    fwrite("data", 4, 1, file);
+    u32(dataSize);
+    for (float s : samples)
+        u16((uint16_t) (int16_t) std::lround(s * 32767));
+    return fclose(file) == 0;
+}
+
+struct Samples {
+    std::vector<double> values;
+
+    double percentile(int p) {
+        if (values.empty())
+            return 0;
+        std::sort(values.begin(), values.end());
+        return values[std::min(values.size() - 1, values.size() * p / 100)];
+    }
+};
+
+int main(int argc, char **argv) {
+    const char *outPath = nullptr, *sampleDirectory = nullptr;
+    long song = -1;
+    double seconds = 30, rate = 48000, block = 192, speed = 1, voices = 0;
+    double pauseAt = -1, pauseFor = 0, seekAt = -1, seekTo = 0;
+    for (int i = 1; i < argc; i++) {
+        auto option = [&](const char *name, double &value) {
+            if (strcmp(argv[i], name) != 0 || i + 1 >= argc)
+                return false;
+            value = atof(argv[++i]);
+            return true;
+        };
+        auto option2 = [&](const char *name, double &first, double &second) {
+            if (strcmp(argv[i], name) != 0 || i + 2 >= argc)
+                return false;
+            first = atof(argv[++i]);
+            second = atof(argv[++i]);
+            return true;
+        };
+        if (option("--seconds", seconds) || option("--rate", rate) || option("--block", block) ||
+            option("--speed", speed) || option("--voices", voices) || option2("--pause", pauseAt, pauseFor) ||
+            option2("--seek", seekAt, seekTo))
+            continue;
+        if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+            sampleDirectory = argv[++i];
+        else if (song < 0)
+            song = atol(argv[i]);
+        else
+            outPath = argv[i];
+    }
+    if (song < 0 || !outPath || block < 1 || speed <= 0) {
+        fprintf(stderr, "usage: %s song out.wav [--seconds s] [--rate hz] [--block frames] [--speed x]"
+                        " [--pause at seconds] [--seek at songTime] [--voices n] [--samples directory]\n", argv[0]);
+        return 1;
+    }
+
+    SongBundle songs;
+    songs.open(songBundle, sizeof(songBundle));
+    if ((size_t) song >= songs.size()) {
+        fprintf(stderr, "there are %zu songs\n", songs.size());
+        return 1;
+    }
+    const bundle::BundleNote *notes = songs.notes(song);
+    size_t noteCount = songs.noteCount(song);
+
+    auto loadStart = std::chrono::steady_clock::now();
+    SampleBank bank;
+    size_t loaded = sampleDirectory ? bank.loadVorbis(sampleDirectory) : 0;
+    if (loaded == 0)
+        bank.synthesize(rate);
+    double loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - loadStart).count();
+
+    Synth synth;
+    synth.init(bank, rate);
+    synth.setSong(notes, noteCount, LEAD_IN);
+    std::vector<Synth::Onset> onsets;
+    onsets.reserve(4 * noteCount);
+    synth.setOnsetLog(&onsets);
+
+    printf("song %ld (%s), %.0f s at %.0f Hz in blocks of %.0f frames, speed %.2f\n", song, songs.name(song).c_str(),
+           seconds, rate, block, speed);
+    printf("%zu samples %s in %.0f ms\n", loaded ? loaded : 30, loaded ? "loaded" : "generated", loadSeconds * 1000);
+
+    //the display frames and the audio callbacks in the order they run; times are when they are seen or heard
+    size_t blockFrames = (size_t) block, totalFrames = (size_t) (seconds * rate);
+    std::vector<float> out(totalFrames * Synth::CHANNELS + blockFrames * Synth::CHANNELS);
+    std::vector<Frame> frames;
+    PlaybackClock clock;
+    clock.setSpeed(speed);
+    double end = songs.duration(song) + LEAD_IN;
+    clock.setEnd(end);
+    clock.resume();
+    bool paused = false, sought = false;
+    size_t resentAtEnd = 0; //frames whose clock is sent again, as a change, while the song stands at its end
+    int held = 0;
+    double renderSeconds = 0, voiceFrames = 0;
+    size_t maxVoices = 0;
+    for (size_t frame = 0, rendered = 0; rendered < totalFrames;) {
+        double displayTime = frame / FRAME_RATE;
+        double heard = (double) rendered / rate;
+        if (displayTime - PREDICTION <= heard - QUEUED_BLOCKS * blockFrames / rate) {
+            clock.tick(displayTime);
+            if (pauseAt >= 0 && !paused && displayTime >= pauseAt) {
+                clock.pause();
+                paused = true;
+            }
+            if (paused && clock.isPaused() && displayTime >= pauseAt + pauseFor)
+                clock.resume();
+            if (seekAt >= 0 && !sought && displayTime >= seekAt) {
+                clock.seek(seekTo);
+                sought = true;
+            }
+            //held keys, struck again every second
+            if (voices > 0 && (int) displayTime >= held) {
+                for (int k = 0; k < (int) voices; k++) {
+                    synth.release(21 + k * 88 / (int) voices);
+                    synth.press(21 + k * 88 / (int) voices, 80);
+                }
+                held++;
+            }
+
+            double songTime = clock.songTimeAtDisplay(displayTime), s = clock.speedAtDisplay(displayTime);
+            synth.setTiming(songTime, displayTime, s);
+            if (!frames.empty() && frames.back().songTime >= end) {
+                auto &last = frames.back();
+                double expected = last.songTime + (displayTime - last.time) * last.speed;
+                resentAtEnd += s != last.speed || std::abs(songTime - expected) >= 1e-6;
+            }
+            frames.push_back({displayTime, songTime, s});
+            frame++;
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        synth.render(out.data() + rendered * Synth::CHANNELS, blockFrames, heard);
+        renderSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        voiceFrames += (double) synth.playingVoices() * blockFrames;
+        maxVoices = std::max(maxVoices, synth.playingVoices());
+        rendered += blockFrames;
+    }
+    out.resize(totalFrames * Synth::CHANNELS);
+
+    if (!writeWav(outPath, out, (int) rate)) {
+        fprintf(stderr, "can't write %s\n", outPath);
+        return 1;
+    }
+    double audioSeconds = totalFrames / rate;
+    printf("wrote %s\n\n", outPath);
+    printf("render: %.1f ms for %.1f s of audio, %.0fx real time\n", renderSeconds * 1000, audioSeconds,
+           audioSeconds / renderSeconds);
+    printf("voices: %.1f on average, %zu at most; %.0f voices per ms (voices one core keeps playing in real time)\n",
+           voiceFrames / totalFrames, maxVoices, voiceFrames / rate / renderSeconds);
+
+    //the song time the clock was at when a frame was heard, from the last display frame before it
+    auto songTimeAt = [&](double time) {
+        auto f = std::upper_bound(frames.begin(), frames.end(), time, [](double t, const Frame &fr) {
+            return t < fr.time;
+        });
+        if (f != frames.begin())
+            --f;
+        return f->songTime + (time - f->time) * f->speed;
+    };
+
+    //notes the clock went over while playing, up to the last frame that was heard: from each frame to the next
+    std::vector<int> expected(noteCount, 0), started(noteCount, 0);
+    for (size_t f = 0; f + 1 < frames.size() && frames[f + 1].time <= audioSeconds; f++) {
+        auto &a = frames[f];
+        double to = a.songTime + (frames[f + 1].time - a.time) * a.speed;
+        for (size_t n = 0; n < noteCount; n++) {
+            double at = notes[n].start + LEAD_IN;
+            expected[n] += at >= a.songTime && at < to;
+        }
+    }
+
+    Samples error; //ms
+    size_t late = 0;
+    double lastFrame = frames.back().time;
+    for (auto &o : onsets) {
+        double heard = o.frame / rate;
+        if (heard >= lastFrame)
+            continue;
+        started[o.note]++;
+        double e = (songTimeAt(heard) - (notes[o.note].start + LEAD_IN)) / speed * 1000;
+        error.values.push_back(std::abs(e));
+        late += std::abs(e) > 1;
+    }
+    size_t expectedCount = 0, startedCount = 0, missing = 0, extra = 0;
+    for (size_t n = 0; n < noteCount; n++) {
+        expectedCount += expected[n];
+        startedCount += started[n];
+        missing += std::max(0, expected[n] - started[n]);
+        extra += std::max(0, started[n] - expected[n]);
+    }
+    printf("notes: %zu started of %zu the clock went over, %zu missing, %zu extra\n", startedCount, expectedCount,
+           missing, extra);
+    printf("onset - clock: p50 %.3f, p99 %.3f, max %.3f ms (a frame is %.3f ms), %zu off by more than 1 ms\n",
+           error.percentile(50), error.percentile(99), error.percentile(100), 1000 / rate, late);
+    if (resentAtEnd > 0)
+        printf("the clock was sent again in %zu frames at the song's end\n", resentAtEnd);
+    if (synth.dropped() > 0)
+        printf("%u events didn't fit into the ring\n", synth.dropped());
+    return missing > 0 || extra > 0 || late > 0 || resentAtEnd > 0 ? 2 : 0;
+}
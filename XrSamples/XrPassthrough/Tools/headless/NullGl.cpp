@@ -0,0 +1,142 @@
+#include "NullGl.h"
+
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <android/log.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <vector>
+
+static nullgl::Counters current;
+static GLuint nextName = 1;
+static std::vector<uint8_t> mapped; //memory handed out by glMapBufferRange
+
+nullgl::Counters& nullgl::counters() {
+    return current;
+}
+
+void nullgl::reset() {
+    current = {};
+}
+
+static void generate(GLsizei n, GLuint *names) {
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = nextName++;
+}
+
+extern "C" int __android_log_print(int prio, const char *tag, const char *fmt, ...) {
+    if (prio < ANDROID_LOG_WARN)
+        return 0;
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "%s: ", tag);
+    int n = vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    return n;
+}
+
+__eglMustCastToProperFunctionPointerType eglGetProcAddress(const char *) { return nullptr; }
+
+// objects
+void glGenBuffers(GLsizei n, GLuint *buffers) { generate(n, buffers); }
+void glGenVertexArrays(GLsizei n, GLuint *arrays) { generate(n, arrays); }
+void glGenTextures(GLsizei n, GLuint *textures) { generate(n, textures); }
+void glGenFramebuffers(GLsizei n, GLuint *framebuffers) { generate(n, framebuffers); }
+void glGenQueries(GLsizei n, GLuint *ids) { generate(n, ids); }
+GLuint glCreateShader(GLenum) { return nextName++; }
+GLuint glCreateProgram(void) { return nextName++; }
+void glDeleteBuffers(GLsizei, const GLuint *) {}
+void glDeleteVertexArrays(GLsizei, const GLuint *) {}
+void glDeleteTextures(GLsizei, const GLuint *) {}
+void glDeleteFramebuffers(GLsizei, const GLuint *) {}
+void glDeleteQueries(GLsizei, const GLuint *) {}
+void glDeleteShader(GLuint) {}
+void glDeleteProgram(GLuint) {}
+
+// buffers
+void glBindBuffer(GLenum, GLuint) {}
+void glBindBufferBase(GLenum, GLuint, GLuint) {}
+void glBufferData(GLenum, GLsizeiptr size, const void *data, GLenum) { current.bufferBytes += data ? size : 0; }
+void glBufferSubData(GLenum, GLintptr, GLsizeiptr size, const void *) { current.bufferBytes += size; }
+void *glMapBufferRange(GLenum, GLintptr, GLsizeiptr length, GLbitfield) {
+    if (mapped.size() < (size_t) length)
+        mapped.resize(length);
+    current.bufferBytes += length;
+    return mapped.data();
+}
+GLboolean glUnmapBuffer(GLenum) { return GL_TRUE; }
+
+// vertex arrays
+void glBindVertexArray(GLuint) {}
+void glEnableVertexAttribArray(GLuint) {}
+void glVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void *) {}
+void glVertexAttribDivisor(GLuint, GLuint) {}
+void glVertexAttrib4f(GLuint, GLfloat, GLfloat, GLfloat, GLfloat) {}
+
+// programs
+void glShaderSource(GLuint, GLsizei, const GLchar *const *, const GLint *) {}
+void glCompileShader(GLuint) {}
+void glGetShaderiv(GLuint, GLenum, GLint *params) { *params = GL_TRUE; }
+void glGetShaderInfoLog(GLuint, GLsizei, GLsizei *length, GLchar *infoLog) {
+    if (length)
+        *length = 0;
+    if (infoLog)
+        infoLog[0] = 0;
+}
+void glAttachShader(GLuint, GLuint) {}
+void glBindAttribLocation(GLuint, GLuint, const GLchar *) {}
+void glLinkProgram(GLuint) {}
+void glGetProgramiv(GLuint, GLenum, GLint *params) { *params = GL_TRUE; }
+void glGetProgramInfoLog(GLuint, GLsizei, GLsizei *length, GLchar *infoLog) { glGetShaderInfoLog(0, 0, length, infoLog); }
+void glUseProgram(GLuint) {}
+GLint glGetUniformLocation(GLuint, const GLchar *) { return 0; }
+GLuint glGetUniformBlockIndex(GLuint, const GLchar *) { return 0; }
+void glUniformBlockBinding(GLuint, GLuint, GLuint) {}
+void glUniform1i(GLint, GLint) {}
+void glUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) {}
+void glUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat *) {}
+
+// textures and framebuffers
+void glBindTexture(GLenum, GLuint) {}
+void glTexStorage3D(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei) {}
+void glTexParameteri(GLenum, GLenum, GLint) {}
+void glTexParameterfv(GLenum, GLenum, const GLfloat *) {}
+void glBindFramebuffer(GLenum, GLuint) {}
+GLenum glCheckFramebufferStatus(GLenum) { return GL_FRAMEBUFFER_COMPLETE; }
+void glInvalidateFramebuffer(GLenum, GLsizei, const GLenum *) {}
+
+// state
+void glEnable(GLenum) {}
+void glDisable(GLenum) {}
+void glDepthMask(GLboolean) {}
+void glDepthFunc(GLenum) {}
+void glCullFace(GLenum) {}
+void glBlendFunc(GLenum, GLenum) {}
+void glViewport(GLint, GLint, GLsizei, GLsizei) {}
+void glScissor(GLint, GLint, GLsizei, GLsizei) {}
+void glLineWidth(GLfloat) {}
+void glClearColor(GLfloat, GLfloat, GLfloat, GLfloat) {}
+void glClear(GLbitfield) {}
+GLenum glGetError(void) { return GL_NO_ERROR; }
+const GLubyte *glGetString(GLenum) { return (const GLubyte *) ""; }
+void glGetIntegerv(GLenum, GLint *data) { *data = 0; }
+
+// draws
+void glDrawElements(GLenum, GLsizei, GLenum, const void *) {
+    current.draws++;
+    current.instances++;
+}
+void glDrawElementsInstanced(GLenum, GLsizei, GLenum, const void *, GLsizei instancecount) {
+    current.draws++;
+    current.instances += instancecount;
+}
+
+// sync and queries
+GLsync glFenceSync(GLenum, GLbitfield) { return (GLsync) &current; }
+GLenum glClientWaitSync(GLsync, GLbitfield, GLuint64) { return GL_ALREADY_SIGNALED; }
+void glDeleteSync(GLsync) {}
+void glBeginQuery(GLenum, GLuint) {}
+void glEndQuery(GLenum) {}
+void glGetQueryObjectuiv(GLuint, GLenum, GLuint *params) { *params = 0; }
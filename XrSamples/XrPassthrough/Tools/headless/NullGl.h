@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// GLES 3 and EGL functions that do nothing but count what would reach the driver, so the app's render code
+// runs on a host without a GPU. Objects get unique names, mapped buffers are scratch memory, shaders always
+// compile and fences are always signaled.
+namespace nullgl {
+    struct Counters {
+        uint64_t draws; //glDrawElements and glDrawElementsInstanced calls
+        uint64_t instances; //instances drawn by them
+        uint64_t bufferBytes; //bytes given to glBufferData/glBufferSubData or written through glMapBufferRange
+    };
+
+    //counters since the last reset
+    Counters& counters();
+    void reset();
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+// Host stand-in for the NDK header, nothing of it is used by the headless build.
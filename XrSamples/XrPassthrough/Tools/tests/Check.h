@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+
+// Checks for the host tests (ctest in the build directory of Tools/CMakeLists.txt): a failed check prints
+// where it is and the test goes on, checkResult() then makes it exit with 1.
+namespace check {
+    inline int failures = 0;
+
+    inline bool report(bool ok, const char *file, int line, const char *what) {
+        if (!ok) {
+            fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+            failures++;
+        }
+        return ok;
+    }
+
+    inline bool near(double a, double b, double tolerance) {
+        return std::abs(a - b) <= tolerance;
+    }
+}
+
+#define CHECK(condition) check::report((condition), __FILE__, __LINE__, #condition)
+#define CHECK_NEAR(a, b, tolerance) check::report(check::near((a), (b), (tolerance)), __FILE__, __LINE__, \
+                                                  #a " is near " #b)
+
+//the exit code of a test's main()
+inline int checkResult() {
+    if (check::failures > 0)
+        fprintf(stderr, "%d checks failed\n", check::failures);
+    return check::failures > 0 ? 1 : 0;
+}
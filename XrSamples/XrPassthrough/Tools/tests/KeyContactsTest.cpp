@@ -0,0 +1,85 @@
+// KeyContacts on three white keys and a black key between the first two, on a piano that is moved and turned:
+// press and release depths with their hysteresis, the black key over the white ones, and the fingertips that
+// don't count (hidden, too deep, beside the keyboard).
+
+#include "KeyContacts.h"
+#include "Check.h"
+
+#include <vector>
+
+static const float WHITE = 0.0236f, BLACK = 0.012f, BLACK_TOP = 0.01f;
+
+//a key as Piarno::buildPiano lays them out: a rectangle scl.x wide and scl.y long at pos, its top at pos.y
+static Object key(float x, float z, float width, float length, float top) {
+    Object o;
+    o.pos = {x, top, z};
+    o.scl = {width, length, 1};
+    return o;
+}
+
+//a fingertip whose lowest point is at x/bottom/z in the piano's space
+static void place(Rigid &tip, const ObjectGroup &piano, float x, float bottom, float z) {
+    tip.pos = piano.transform().Transform(vec3{x, bottom + tip.radius, z});
+    tip.show = true;
+}
+
+int main() {
+    ObjectGroup piano;
+    piano.pos = {0.2f, 0.8f, -0.4f};
+    piano.rot = {0, 0.5f, 0};
+
+    std::vector<Object> keys = {key(-WHITE, 0, WHITE, 0.15f, 0), key(0, 0, WHITE, 0.15f, 0),
+                                key(WHITE, 0, WHITE, 0.15f, 0), key(-WHITE / 2, -0.025f, BLACK, 0.1f, BLACK_TOP)};
+    KeyContacts contacts;
+    contacts.setKeys(keys);
+
+    Rigid tips[2];
+    tips[0].radius = tips[1].radius = 0.008f;
+    tips[1].show = false;
+    auto frame = [&](float x, float bottom, float z) {
+        place(tips[0], piano, x, bottom, z);
+        contacts.update(piano, tips, 2);
+    };
+
+    //above the key, then touching it but not deep enough
+    frame(0, 0.01f, 0);
+    CHECK(!contacts.isDown(1));
+    CHECK(contacts.depth(1) == 0);
+    frame(0, -0.003f, 0);
+    CHECK(!contacts.isDown(1));
+    CHECK_NEAR(contacts.depth(1), 0.003f, 1e-5);
+
+    //pressed at PRESS_DEPTH, held down to RELEASE_DEPTH
+    frame(0, -0.006f, 0);
+    CHECK(contacts.isDown(1) && contacts.isPressed(1));
+    frame(0, -0.003f, 0);
+    CHECK(contacts.isDown(1) && !contacts.isPressed(1));
+    frame(0, -0.002f, 0);
+    CHECK(!contacts.isDown(1) && contacts.isReleased(1));
+    frame(0, -0.002f, 0);
+    CHECK(!contacts.isReleased(1));
+
+    //the black key is above the white keys it overlaps, behind it the white key is under the fingertip
+    frame(-WHITE / 2, BLACK_TOP - 0.006f, -0.025f);
+    CHECK(contacts.isPressed(3));
+    CHECK(!contacts.isDown(0) && !contacts.isDown(1));
+    frame(-WHITE / 2 - 0.003f, -0.006f, 0.05f);
+    CHECK(contacts.isReleased(3) && contacts.isPressed(0));
+
+    //below MAX_DEPTH the fingertip is under the keyboard, beside it on no key
+    frame(WHITE, -KeyContacts::MAX_DEPTH - 0.001f, 0);
+    CHECK(!contacts.isDown(2));
+    frame(2 * WHITE, -0.006f, 0);
+    CHECK(!contacts.isDown(0) && !contacts.isDown(1) && !contacts.isDown(2) && !contacts.isDown(3));
+
+    //of two fingertips the deeper one counts, a hidden one not at all
+    place(tips[1], piano, WHITE, -0.008f, 0.01f);
+    tips[1].show = false;
+    frame(WHITE, -0.003f, 0);
+    CHECK_NEAR(contacts.depth(2), 0.003f, 1e-5);
+    tips[1].show = true;
+    frame(WHITE, -0.003f, 0);
+    CHECK_NEAR(contacts.depth(2), 0.008f, 1e-5);
+    CHECK(contacts.isPressed(2));
+    return checkResult();
+}
@@ -0,0 +1,111 @@
+// The MIDI input path without a keyboard: MidiParser on byte streams with running status, real-time bytes and
+// system exclusive messages in between, and NoteMatcher on presses early, late, doubled and after a seek.
+
+#include "MidiInput.h"
+#include "NoteMatcher.h"
+#include "Check.h"
+
+#include <vector>
+
+//the notes a byte stream parses into, the time of each is the index of its last byte
+static std::vector<NoteEvent> parse(const std::vector<uint8_t> &bytes) {
+    MidiParser parser;
+    std::vector<NoteEvent> notes;
+    for (size_t i = 0; i < bytes.size(); i++) {
+        NoteEvent note;
+        if (parser.feed(bytes[i], i, note))
+            notes.push_back(note);
+    }
+    return notes;
+}
+
+static bool is(const NoteEvent &note, double time, int key, int velocity) {
+    return note.time == time && note.key == key && note.velocity == velocity;
+}
+
+static void testParser() {
+    //note-on, a release as note-on with velocity 0 in running status, and a note-off on another channel
+    auto notes = parse({0x90, 60, 100, 60, 0, 0x81, 62, 64});
+    if (CHECK(notes.size() == 3)) {
+        CHECK(is(notes[0], 2, 60, 100) && notes[0].isPress());
+        CHECK(is(notes[1], 4, 60, 0) && !notes[1].isPress());
+        CHECK(is(notes[2], 7, 62, 0));
+    }
+
+    //a clock and active sensing between the bytes of a message don't break it up
+    notes = parse({0x90, 0xf8, 64, 0xfe, 90});
+    CHECK(notes.size() == 1 && is(notes[0], 4, 64, 90));
+
+    //a system exclusive message is skipped with its data and ends the running status
+    notes = parse({0x90, 60, 100, 0xf0, 0x43, 0x10, 0x4c, 0xf7, 62, 100, 0x90, 64, 100});
+    CHECK(notes.size() == 2 && is(notes[0], 2, 60, 100) && is(notes[1], 12, 64, 100));
+
+    //other channel messages are dropped, also the one data byte ones, without losing the following notes
+    notes = parse({0xb0, 64, 127, 0xc0, 5, 0xd0, 40, 0xe0, 0, 64, 0x90, 65, 80});
+    CHECK(notes.size() == 1 && is(notes[0], 12, 65, 80));
+
+    //data bytes before any status byte mean nothing
+    CHECK(parse({60, 100, 62}).empty());
+}
+
+static void testMatcher() {
+    //key 5 at 1, 1.2 and 3, key 7 at 2
+    TileStore tiles;
+    for (auto [start, key] : {std::pair{1.0f, 5}, {1.2f, 5}, {2.0f, 7}, {3.0f, 5}})
+        tiles.add(start, start + 0.1f, key, 0, 0, 0.02f, 0, 255);
+    NoteMatcher matcher;
+    matcher.setTiles(tiles, 88);
+
+    //early within the window, then the second tile of the key late within it
+    auto m = matcher.press(5, 0.9f);
+    CHECK(m.tile == 0 && CHECK_NEAR(m.error, -0.1f, 1e-6));
+    CHECK(matcher.isHit(5) && matcher.isHeld(5));
+    matcher.release(5);
+    CHECK(!matcher.isHeld(5));
+    m = matcher.press(5, 1.3f);
+    CHECK(m.tile == 1 && CHECK_NEAR(m.error, 0.1f, 1e-6));
+    matcher.release(5);
+
+    //a press of the same key with no tile left in the window, one of a key not in the song and one beyond the piano
+    m = matcher.press(5, 1.35f);
+    CHECK(m.tile == -1 && !matcher.isHit(5));
+    matcher.release(5);
+    CHECK(matcher.press(8, 1.4f).tile == -1);
+    matcher.release(8);
+    CHECK(matcher.press(200, 1.4f).tile == -1);
+    matcher.release(200);
+
+    //key 7 isn't played: missed once the window after its start passed
+    matcher.advance(2.0f + NoteMatcher::WINDOW - 0.01f);
+    CHECK(matcher.result(2) == NoteMatcher::Result::pending);
+    matcher.advance(2.0f + NoteMatcher::WINDOW + 0.01f);
+    CHECK(matcher.result(2) == NoteMatcher::Result::missed);
+    CHECK(matcher.resolvedTiles() == 3);
+    CHECK(matcher.hits == 2 && matcher.missed == 1 && matcher.extra == 3);
+
+    //back to 1.5: the tiles from there on are pending again, the ones before it were played
+    matcher.seek(1.5f);
+    CHECK(matcher.result(0) == NoteMatcher::Result::hit && matcher.result(1) == NoteMatcher::Result::hit);
+    CHECK(matcher.result(2) == NoteMatcher::Result::pending);
+    CHECK(matcher.hits == 2 && matcher.missed == 0);
+    CHECK(matcher.press(7, 2.05f).tile == 2);
+    matcher.release(7);
+
+    //forward past the last tile: it is skipped, not missed
+    matcher.seek(3.5f);
+    matcher.advance(4);
+    CHECK(matcher.result(3) == NoteMatcher::Result::skipped);
+    CHECK(matcher.hits == 3 && matcher.missed == 0);
+
+    //the tiles of a key nearest to a time, whatever their results, for the tempo
+    CHECK(matcher.nearestTile(5, 0) == 0);
+    CHECK(matcher.nearestTile(5, 1.09f) == 0 && matcher.nearestTile(5, 1.11f) == 1);
+    CHECK(matcher.nearestTile(5, 2.2f) == 3 && matcher.nearestTile(5, 10) == 3);
+    CHECK(matcher.nearestTile(8, 1) == -1 && matcher.nearestTile(-1, 1) == -1 && matcher.nearestTile(88, 1) == -1);
+}
+
+int main() {
+    testParser();
+    testMatcher();
+    return checkResult();
+}
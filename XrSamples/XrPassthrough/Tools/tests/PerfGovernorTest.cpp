@@ -0,0 +1,93 @@
+// PerfGovernor on short scripted loads: power saving and the idle rate once paused whatever the load and the
+// hold of the last change, and the levels and rate picked while playing. The longer session is GovernorSim's.
+
+#include "PerfGovernor.h"
+#include "Check.h"
+
+#include <string>
+
+//updates at 72 Hz from time until time + seconds, returns the time after the last frame
+static double run(PerfGovernor &governor, double time, double seconds, const PerfGovernor::Load &load) {
+    double end = time + seconds;
+    for (; time < end; time += 1 / 72.0)
+        governor.update(time, load);
+    return time;
+}
+
+static bool is(const PerfGovernor &governor, float rate, PerfLevel cpu, PerfLevel gpu) {
+    return governor.settings() == PerfGovernor::Settings{rate, cpu, gpu};
+}
+
+int main() {
+    const float budget = 1000 / 72.0f;
+    PerfGovernor::Load light{budget, 3, 4, true, 0};
+    PerfGovernor::Load busy{budget, 3, 0.7f * budget, true, 0}; //between LOW_LOAD and HIGH_LOAD
+    PerfGovernor::Load heavy{budget, 3, 0.9f * budget, true, 0};
+
+    {
+        //the display can do 60 Hz, paused it stays at IDLE_RATE
+        PerfGovernor governor{{72, PerfLevel::sustainedHigh, PerfLevel::sustainedHigh}};
+        governor.setRefreshRates({90, 60, 72});
+        double time = run(governor, 0, 1, light);
+        CHECK(is(governor, 90, PerfLevel::sustainedHigh, PerfLevel::sustainedHigh));
+
+        PerfGovernor::Load paused = light;
+        paused.playing = false;
+        time = run(governor, time, PerfGovernor::IDLE_DELAY + 0.1, paused);
+        CHECK(is(governor, 72, PerfLevel::powerSavings, PerfLevel::powerSavings));
+    }
+
+    {
+        //the GPU raised to boost while playing, paused with a load that would keep it there while playing
+        PerfGovernor governor{{72, PerfLevel::sustainedHigh, PerfLevel::sustainedHigh}};
+        governor.setRefreshRates({72});
+        double time = run(governor, 0, PerfGovernor::RATE_HOLD, busy);
+        time = run(governor, time, 0.1, heavy);
+        time = run(governor, time, PerfGovernor::LEVEL_HOLD, busy);
+        CHECK(is(governor, 72, PerfLevel::sustainedHigh, PerfLevel::boost));
+
+        PerfGovernor::Load paused = busy;
+        paused.playing = false;
+        time = run(governor, time, PerfGovernor::IDLE_DELAY - 0.1, paused);
+        CHECK(is(governor, 72, PerfLevel::sustainedHigh, PerfLevel::boost));
+        time = run(governor, time, 0.2, paused);
+        CHECK(is(governor, 72, PerfLevel::powerSavings, PerfLevel::powerSavings));
+        CHECK(governor.reason() == std::string("paused"));
+
+        //playing again goes back to the base at once
+        time = run(governor, time, 0.1, busy);
+        CHECK(is(governor, 72, PerfLevel::sustainedHigh, PerfLevel::sustainedHigh));
+    }
+
+    {
+        //the GPU lowered from boost after the pause, power saving doesn't wait for the LEVEL_HOLD of that change
+        PerfGovernor governor{{72, PerfLevel::sustainedHigh, PerfLevel::boost}};
+        governor.setRefreshRates({72});
+        double time = run(governor, 0, PerfGovernor::LEVEL_HOLD, busy);
+        CHECK(is(governor, 72, PerfLevel::sustainedHigh, PerfLevel::boost));
+
+        PerfGovernor::Load pausedBusy = busy, paused = light;
+        pausedBusy.playing = paused.playing = false;
+        time = run(governor, time, 1, pausedBusy);
+        CHECK(is(governor, 72, PerfLevel::sustainedHigh, PerfLevel::boost));
+        time = run(governor, time, PerfGovernor::IDLE_DELAY - 1.1, paused);
+        CHECK(is(governor, 72, PerfLevel::sustainedHigh, PerfLevel::sustainedHigh));
+        time = run(governor, time, 0.2, paused);
+        CHECK(is(governor, 72, PerfLevel::powerSavings, PerfLevel::powerSavings));
+    }
+
+    {
+        //a dense passage boosts the CPU, a thermal warning caps the GPU and the rate
+        PerfGovernor governor{{72, PerfLevel::sustainedHigh, PerfLevel::sustainedHigh}};
+        governor.setRefreshRates({72, 90, 120});
+        PerfGovernor::Load dense = light;
+        dense.tiles = PerfGovernor::DENSE_TILES;
+        double time = run(governor, 0, 0.1, dense);
+        CHECK(is(governor, 120, PerfLevel::boost, PerfLevel::sustainedHigh));
+
+        governor.thermal(PerfDomain::gpu, Thermal::warning);
+        time = run(governor, time, 0.1, dense);
+        CHECK(is(governor, 90, PerfLevel::boost, PerfLevel::sustainedLow));
+    }
+    return checkResult();
+}
@@ -0,0 +1,121 @@
+// ScoreKeeper on a two handed song: the sums per song, hand and section, extra notes also of keys beyond the
+// piano, the sums of the tiles before a seek kept like in NoteMatcher, and the tempo of a player drifting further
+// than NoteMatcher::WINDOW.
+
+#include "ScoreKeeper.h"
+#include "Check.h"
+
+#include <vector>
+
+static const int NUM_KEYS = 88;
+
+//a note every half second for the given seconds, the left hand on keys 20 to 23 and the right on 60 to 66,
+//a left hand note with every second right hand one
+static void buildSong(float seconds, TileStore &tiles, std::vector<uint8_t> &tracks) {
+    tiles.clear();
+    tracks.clear();
+    for (int i = 0; i * 0.5f < seconds; i++) {
+        float start = 1 + i * 0.5f;
+        tiles.add(start, start + 0.4f, 60 + i % 7, 0, 0, 0.02f, 0, 255);
+        tracks.push_back(0);
+        if (i % 2 == 0) {
+            tiles.add(start, start + 0.9f, 20 + i / 2 % 4, 0, 0, 0.02f, 0, 255);
+            tracks.push_back(1);
+        }
+    }
+}
+
+//plays all tiles at tempo times the song's speed from the first one on, late by the given seconds
+static void play(ScoreKeeper &score, const TileStore &tiles, float tempo, float late) {
+    for (size_t i = 0; i < tiles.size(); i++) {
+        float time = 1 + (tiles.start[i] - 1) / tempo + late;
+        score.advance(time);
+        score.press(tiles.key[i], time);
+        score.release(tiles.key[i], 1 + (tiles.end[i] - 1) / tempo + late);
+    }
+    score.advance(tiles.endMax.back() / tempo + 1);
+}
+
+static void testScore() {
+    TileStore tiles;
+    std::vector<uint8_t> tracks;
+    buildSong(20, tiles, tracks);
+    ScoreKeeper score;
+    score.setSong(tiles, tracks, NUM_KEYS, 0);
+
+    //the first two notes 50 ms late, then the first right hand note once more, a press beyond each end of the
+    //piano and one of a key the song doesn't have
+    score.press(60, 1.05f);
+    score.press(20, 1.05f);
+    score.release(60, 1.45f);
+    score.release(20, 1.95f);
+    score.press(60, 1.5f);
+    score.release(60, 1.6f);
+    score.press(-3, 1.6f);
+    score.release(-3, 1.7f);
+    score.press(NUM_KEYS + 2, 1.6f);
+    score.release(NUM_KEYS + 2, 1.7f);
+    score.press(40, 1.6f);
+    score.release(40, 1.7f);
+    score.advance(3.2f);
+
+    //the notes from 1.5 to 3 are missed, four right hand and two left hand ones
+    auto &all = score.total();
+    CHECK(all.hits == 2 && all.extra == 4 && all.missed == 6);
+    CHECK_NEAR(all.meanOnsetError(), 0.05, 1e-6);
+    CHECK(all.releases == 2);
+    CHECK_NEAR(all.meanAbsOffsetError(), 0.05, 1e-6);
+    CHECK(score.matcher().extra == 4);
+
+    auto &left = score.hand(ScoreKeeper::LEFT), &right = score.hand(ScoreKeeper::RIGHT);
+    CHECK(left.hits == 1 && left.missed == 2 && left.extra == 2);
+    CHECK(right.hits == 1 && right.missed == 4 && right.extra == 2);
+    CHECK(score.sections().size() == 3 && score.sections()[0].hits == 2 && score.sections()[1].hits == 0);
+    CHECK_NEAR(all.accuracy(), 2.0 / 12, 1e-6);
+
+    //back to 2.2: the tiles from 2.05 on can be played again, the ones before keep their hits and misses with
+    //their errors, and the extra notes stay
+    score.seek(2.2f);
+    CHECK(all.hits == 2 && all.missed == 3 && all.extra == 4);
+    CHECK(score.matcher().hits == all.hits && score.matcher().missed == all.missed);
+    CHECK_NEAR(all.meanOnsetError(), 0.05, 1e-6);
+    CHECK(all.releases == 2);
+    CHECK_NEAR(all.meanAbsOffsetError(), 0.05, 1e-6);
+    CHECK(left.hits == 1 && left.missed == 1 && left.extra == 2);
+    CHECK(right.hits == 1 && right.missed == 2 && right.extra == 2);
+    CHECK(score.sections()[0].hits == 2 && score.sections()[0].missed == 3 && score.sections()[0].extra == 4);
+
+    //back to the start, then all of it played in time
+    score.seek(0);
+    CHECK(all.hits == 0 && all.missed == 0 && all.releases == 0 && all.extra == 4);
+    play(score, tiles, 1, 0);
+    CHECK(all.hits == tiles.size() && all.missed == 0 && all.extra == 4);
+    CHECK(score.sections()[1].hits + score.sections()[2].hits > 0);
+    CHECK_NEAR(score.tempo(), 1, 1e-4);
+}
+
+static void testTempo() {
+    TileStore tiles;
+    std::vector<uint8_t> tracks;
+    buildSong(60, tiles, tracks);
+
+    //not enough notes for a tempo yet
+    ScoreKeeper score;
+    score.setSong(tiles, tracks, NUM_KEYS, 0);
+    score.press(60, 1);
+    CHECK(score.tempo() == 1);
+
+    //slower and faster, a whole song: after a few seconds the presses are too far off to hit anything
+    for (float tempo : {0.98f, 0.9f, 1.1f}) {
+        score.setSong(tiles, tracks, NUM_KEYS, 0);
+        play(score, tiles, tempo, 0.03f);
+        CHECK(score.total().hits < tiles.size() / 2);
+        CHECK_NEAR(score.tempo(), tempo, 0.002);
+    }
+}
+
+int main() {
+    testScore();
+    testTempo();
+    return checkResult();
+}
@@ -0,0 +1,86 @@
+// Synth's song notes against the clock it is handed: each note starts once, on the output frame the clock puts
+// it on, through a pause, a seek back and a change of speed, rendered in blocks that don't line up with them.
+// And the clock of a frame as Engine::update hands it over, which stops at the song's end.
+
+#include "Synth.h"
+#include "PlaybackClock.h"
+#include "Check.h"
+
+#include <cmath>
+#include <vector>
+
+static const float RATE = 48000;
+static const double OFFSET = 1; //song time of the song's start
+
+static void testOnsets() {
+    //a note every quarter second from 1 to 3.75 in song time
+    std::vector<bundle::BundleNote> notes;
+    for (int k = 0; k < 12; k++)
+        notes.push_back({0.25f * k, 0.25f * k + 0.2f, (uint8_t) (60 + k), 100, 0});
+
+    SampleBank bank;
+    bank.synthesize(RATE);
+    Synth synth;
+    synth.init(bank, RATE);
+    synth.setSong(notes.data(), notes.size(), OFFSET);
+    std::vector<Synth::Onset> onsets;
+    onsets.reserve(64);
+    synth.setOnsetLog(&onsets);
+
+    //paused at 1.6 s for half a second, at 3.1 s back to song time 2 and twice as fast
+    synth.setTiming(0, 0, 1);
+    synth.setTiming(1.6, 1.6, 0);
+    synth.setTiming(1.6, 2.1, 1);
+    synth.setTiming(2, 3.1, 2);
+
+    std::vector<float> out(2 * 200 * Synth::CHANNELS);
+    size_t rendered = 0;
+    while (rendered < 4.2 * RATE) {
+        size_t frames = 100 + rendered / 7 % 300; //blocks of odd lengths
+        synth.render(out.data(), frames, rendered / RATE);
+        rendered += frames;
+    }
+
+    //when each note should be heard, in seconds, and which
+    struct Expected {
+        double time;
+        uint32_t note;
+    };
+    std::vector<Expected> expected = {{1, 0}, {1.25, 1}, {1.5, 2}, {2.25, 3}, {2.5, 4}, {2.75, 5}, {3, 6},
+                                      {3.1, 4}, {3.225, 5}, {3.35, 6}, {3.475, 7}, {3.6, 8}, {3.725, 9},
+                                      {3.85, 10}, {3.975, 11}};
+    if (!CHECK(onsets.size() == expected.size()))
+        return;
+    for (size_t i = 0; i < expected.size(); i++) {
+        CHECK(onsets[i].note == expected[i].note);
+        CHECK(onsets[i].frame == (uint64_t) std::lround(expected[i].time * RATE));
+    }
+}
+
+static void testClockAtEnd() {
+    PlaybackClock clock;
+    clock.setEnd(2);
+    clock.tick(10);
+    CHECK(clock.speedAtDisplay(10) == 0); //paused
+    clock.setSpeed(1.5);
+    clock.resume();
+    clock.tick(11);
+    CHECK_NEAR(clock.songTimeAtDisplay(11), 1.5, 1e-9);
+    CHECK(clock.speedAtDisplay(11) == 1.5);
+
+    //the song time stays at the end, so does where the synth is told the song is
+    clock.tick(12);
+    CHECK(clock.songTimeAtDisplay(12) == 2);
+    CHECK(clock.speedAtDisplay(12) == 0);
+
+    //going back from the end plays on
+    clock.seek(1);
+    clock.tick(12.5);
+    CHECK(clock.speedAtDisplay(12.5) == 1.5);
+}
+
+int main() {
+    testOnsets();
+    testClockAtEnd();
+    return checkResult();
+}
@@ -0,0 +1,86 @@
+// TileStore::update against a plain reference of the tile layout, for windows of every size from 0 to 13
+// tiles at every start modulo 4, so the padded last block of the kernel is covered. Built twice by
+// CMakeLists.txt: with the SSE2 (NEON on ARM) kernel, and with SIMD_SCALAR for the plain loops of Simd.h.
+
+#include "TileStore.h"
+#include "XrPassthroughGl.h"
+#include "Check.h"
+
+#include <algorithm>
+#include <vector>
+
+//what update() writes for tile t, computed one tile at a time like the per-Object tiles before TileStore: a rect
+//at pos (x, y, z) turned flat by rot (pi/2, 0, 0) and scaled by scl (width, length, 1), in the scene. Object.cpp
+//needs the engine, so compose(pos, rot, scl) is spelled out with the OVR matrices
+static void expectTile(const TileStore &store, size_t t, float now, float speed, float zOffset, const mat4 &scene,
+                       const std::vector<color> &palette, float &startDist, float &endDist, bool &shown,
+                       Instance &instance) {
+    startDist = (store.start[t] - now) * speed;
+    endDist = (store.end[t] - now) * speed;
+    shown = endDist > 0;
+    float clamped = std::max(0.0f, startDist);
+    float length = std::max(0.0f, endDist) - clamped;
+    float z = zOffset - (clamped + length * 0.5f);
+
+    mat4 tile = mat4::Translation(store.x[t], store.y[t], z) *
+                mat4::RotationZ(0) * mat4::RotationY(0) * mat4::RotationX(M_PI / 2) *
+                mat4::Scaling(store.width[t], length, 1);
+    instance.transform = (scene * tile).Transposed(); //column-major like InstanceBatch::add
+    const color_t *rgba = palette[store.colorIndex[t]].data();
+    std::copy(rgba, rgba + 3, instance.color);
+    instance.color[3] = store.alpha[t];
+}
+
+int main() {
+    //overlapping tiles of different lengths, some already over at the times below
+    TileStore store;
+    for (int i = 0; i < 40; i++) {
+        float start = 0.25f * i;
+        store.add(start, start + 0.1f + 0.37f * (i % 5), i % 88, -0.6f + 0.013f * i, i % 3 ? 0 : 0.02f,
+                  0.02f + 0.001f * (i % 7), i % 4, 191 + i);
+    }
+    std::vector<color> palette = {color{255, 0, 0, 255}, color{0, 255, 0, 255}, color{0, 0, 255, 255},
+                                  color{10, 20, 30, 255}};
+    mat4 scene = mat4::Translation(0.3f, 0.8f, -0.5f) * mat4::RotationY(0.7f) * mat4::RotationX(-0.2f) *
+                 mat4::Scaling(1.1f, 0.9f, 1.3f);
+    const float speed = 0.35f, zOffset = -0.075f;
+
+    InstanceBatch batch;
+    for (float now : {0.0f, 2.3f, 5.05f}) {
+        for (size_t begin = 0; begin < 4; begin++) {
+            for (size_t count = 0; count <= 13; count++) {
+                size_t finish = begin + count;
+                std::vector<float> startDist(count, -1), endDist(count, -1);
+
+                //instances are appended after the ones already in the batch
+                batch.instances.assign(3, Instance{});
+                size_t written = store.update(begin, finish, now, speed, zOffset, scene, palette, startDist.data(),
+                                              endDist.data(), batch);
+                CHECK(batch.instances.size() == 3 + written);
+
+                size_t expected = 0;
+                for (size_t t = begin; t < finish; t++) {
+                    float s, e;
+                    bool shown;
+                    Instance instance;
+                    expectTile(store, t, now, speed, zOffset, scene, palette, s, e, shown, instance);
+                    CHECK_NEAR(startDist[t - begin], s, 1e-6);
+                    CHECK_NEAR(endDist[t - begin], e, 1e-6);
+                    if (!shown)
+                        continue;
+                    if (!CHECK(3 + expected < batch.instances.size()))
+                        break;
+                    auto &out = batch.instances[3 + expected++];
+                    for (int c = 0; c < 4; c++) {
+                        for (int r = 0; r < 4; r++)
+                            CHECK_NEAR(out.transform.M[c][r], instance.transform.M[c][r], 1e-5);
+                    }
+                    for (int c = 0; c < 4; c++)
+                        CHECK(out.color[c] == instance.color[c]);
+                }
+                CHECK(written == expected);
+            }
+        }
+    }
+    return checkResult();
+}
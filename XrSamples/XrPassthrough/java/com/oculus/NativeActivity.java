@@ -1,6 +1,16 @@
 // Copyright (c) Facebook Technologies, LLC and its affiliates. All Rights reserved.
 package com.oculus;
 
+import android.content.Context;
+import android.content.pm.PackageManager;
+import android.media.midi.MidiDevice;
+import android.media.midi.MidiDeviceInfo;
+import android.media.midi.MidiManager;
+import android.os.Bundle;
+import android.os.Handler;
+import android.os.Looper;
+import java.io.IOException;
+
 /**
  * When using NativeActivity, we currently need to handle loading of dependent shared libraries
  * manually before a shared library that depends on them is loaded, since there is not currently a
@@ -25,4 +35,106 @@ public class NativeActivity extends android.app.NativeActivity {
     System.loadLibrary("openxr_loader");
     System.loadLibrary("xrpassthrough");
   }
+
+  private MidiManager midiManager;
+  private MidiManager.DeviceCallback midiDeviceCallback;
+  private MidiDevice midiDevice;
+  private boolean openingMidiDevice;
+
+  @Override
+  protected void onCreate(Bundle savedInstanceState) {
+    super.onCreate(savedInstanceState);
+    openMidiKeyboard();
+  }
+
+  @Override
+  protected void onDestroy() {
+    if (midiDeviceCallback != null) {
+      midiManager.unregisterDeviceCallback(midiDeviceCallback);
+      midiDeviceCallback = null;
+    }
+    closeMidiDevice();
+    super.onDestroy();
+  }
+
+  /**
+   * Opens the first MIDI device that sends notes, a USB keyboard, and hands it to the native code
+   * (XrPassthroughMidi.cpp). Keyboards that are plugged in later are opened when they show up.
+   */
+  private void openMidiKeyboard() {
+    if (!getPackageManager().hasSystemFeature(PackageManager.FEATURE_MIDI)) {
+      return;
+    }
+    midiManager = (MidiManager) getSystemService(Context.MIDI_SERVICE);
+    if (midiManager == null) {
+      return;
+    }
+
+    midiDeviceCallback =
+        new MidiManager.DeviceCallback() {
+          @Override
+          public void onDeviceAdded(MidiDeviceInfo info) {
+            openMidiDevice(info);
+          }
+
+          @Override
+          public void onDeviceRemoved(MidiDeviceInfo info) {
+            if (midiDevice != null && midiDevice.getInfo().getId() == info.getId()) {
+              closeMidiDevice();
+            }
+          }
+        };
+    midiManager.registerDeviceCallback(midiDeviceCallback, new Handler(Looper.getMainLooper()));
+
+    for (MidiDeviceInfo info : midiManager.getDevices()) {
+      openMidiDevice(info);
+    }
+  }
+
+  private void openMidiDevice(MidiDeviceInfo info) {
+    if (midiDevice != null || openingMidiDevice || info.getOutputPortCount() == 0) {
+      return;
+    }
+    openingMidiDevice = true;
+    midiManager.openDevice(
+        info,
+        new MidiManager.OnDeviceOpenedListener() {
+          @Override
+          public void onDeviceOpened(MidiDevice device) {
+            openingMidiDevice = false;
+            if (device == null) {
+              return;
+            }
+            // opened after onDestroy, the native code is going away
+            if (isDestroyed()) {
+              try {
+                device.close();
+              } catch (IOException e) {
+                // nothing left to do with it
+              }
+              return;
+            }
+            midiDevice = device;
+            nativeMidiDeviceOpened(device);
+          }
+        },
+        new Handler(Looper.getMainLooper()));
+  }
+
+  private void closeMidiDevice() {
+    if (midiDevice == null) {
+      return;
+    }
+    nativeMidiDeviceClosed();
+    try {
+      midiDevice.close();
+    } catch (IOException e) {
+      // nothing left to do with it
+    }
+    midiDevice = null;
+  }
+
+  private static native void nativeMidiDeviceOpened(MidiDevice device);
+
+  private static native void nativeMidiDeviceClosed();
 }